@@ -0,0 +1,38 @@
+// AliasTable — Walker/Vose alias method over a small set of weighted outcomes.
+// build() turns integer weights into one (threshold, alias) pair per column in
+// O(n); sample() is then two bounded draws and one compare regardless of n.
+// Personality compiles its RuntimeConfig drift weights into these; pure logic,
+// tested natively.
+
+#ifndef ALIAS_TABLE_H
+#define ALIAS_TABLE_H
+
+#include <stdint.h>
+#include "prng.h"
+
+class AliasTable {
+public:
+  static const int MAX_OUTCOMES = 20;  // EmotionRegistry::MAX_EMOTIONS
+
+  AliasTable();
+
+  // Compiles weights[0..n) (outcome i drawn with weight i / sum). A table whose weights
+  // are all zero always samples fallback.
+  void build(const uint8_t* weights, int n, uint8_t fallback);
+
+  // Draws one outcome index; never one whose weight was zero.
+  uint8_t sample(Prng& rng) const {
+    uint32_t col = rng.below(n_);
+    return rng.below(total_) < prob_[col] ? (uint8_t)col : alias_[col];
+  }
+
+  int size() const { return n_; }
+
+private:
+  uint16_t prob_[MAX_OUTCOMES];   // keep column with probability prob_ / total_
+  uint8_t alias_[MAX_OUTCOMES];   // otherwise take this outcome
+  uint8_t n_;
+  uint16_t total_;
+};
+
+#endif
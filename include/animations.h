@@ -15,10 +15,21 @@
 
 struct AnimState {
   int frame;
-  unsigned long lastTick;
+  unsigned long lastTick;  // deadline the last frame was scheduled for (0 = not started)
   int8_t direction;  // 1 = forward, -1 = backward (used by LOOP_PINGPONG)
 };
 
+// Per-emotion frame-rate bookkeeping — proves registered frameDelays are met.
+struct FrameStats {
+  uint32_t frames;    // frames drawn
+  uint32_t missed;    // frames drawn more than FRAME_DEADLINE_SLACK_MS past their deadline
+  uint16_t maxLateMs; // worst lateness seen
+};
+
+// Writes a pre-rendered frame into the canvas framebuffer. continuing = the buffer
+// still holds what the previous call left there. Returns false to fall back to drawing live.
+typedef bool (*FrameSourceFn)(EmotionState emotion, int frame, uint8_t* fb, bool continuing);
+
 class AnimationManager {
 public:
   AnimationManager();
@@ -29,8 +40,20 @@ public:
   // Returns true if a frame was drawn this call.
   bool tick(EmotionState emotion, ICanvas& canvas, const void* context = nullptr);
 
+  // Absolute millis() time the next frame of this emotion is due.
+  unsigned long nextDeadline(EmotionState emotion) const;
+
+  const FrameStats& getFrameStats(EmotionState emotion) const;
+  void resetFrameStats();
+
+  // Serves frames from a baked cache instead of calling the DrawFrameFn (nullptr = always draw live).
+  void setFrameSource(FrameSourceFn fn) { frameSource_ = fn; }
+
 private:
   AnimState states_[EmotionRegistry::MAX_EMOTIONS];
+  FrameStats stats_[EmotionRegistry::MAX_EMOTIONS];
+  FrameSourceFn frameSource_;
+  int cachedEmotion_;  // emotion the frame source last wrote into the canvas (-1 = none)
 };
 
 extern AnimationManager animationManager;
@@ -3,16 +3,26 @@
 
 #include <Arduino.h>
 #include "emotion.h"
+#include "ble_proto.h"
 
-// Callback for BLE-initiated emotion changes
-typedef void (*BleEmotionFn)(EmotionState emotion);
+// Callback for raw writes to the control characteristic (legacy byte or v1 batch, see ble_proto.h).
+// Runs on the NimBLE host task, not loop() — hand the request off (commandQueue)
+// rather than touching emotion state directly.
+typedef void (*BleWriteFn)(const uint8_t* data, size_t len);
 
 class BleControl {
 public:
-  void init(BleEmotionFn onEmotion);
-  void updateCurrentEmotion(uint8_t emotionId);
+  void init(BleWriteFn onWrite);
+
+  // True when emotion or attention stage differ from what subscribers last saw.
+  bool stateChanged(uint8_t emotion, uint8_t stage) { return filter_.update(emotion, stage); }
+
+  // Updates both characteristics and notifies subscribers of the STATE characteristic.
+  void publishState(const ControlState& state);
+
 private:
-  BleEmotionFn onEmotion_;
+  BleWriteFn onWrite_;
+  StateChangeFilter filter_;
 };
 
 extern BleControl bleControl;
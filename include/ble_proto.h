@@ -0,0 +1,51 @@
+// BLE control protocol — one characteristic write carries a whole batch of commands,
+// so a phone app replaces several round trips (and polling) with a single write.
+//
+//   legacy  [emotionId]                          exactly 1 byte — the original format
+//   v1      [BLE_PROTO_VERSION][record]...       2+ bytes
+//   records [SET_EMOTION][emotionId]
+//           [GESTURE][TouchGesture]
+//           [CONFIG][ConfigField][value LE32]
+//           [SEQUENCE][n][emotionId][holdMs LE16] × n   (n ≤ SCRIPT_MAX_STEPS)
+//
+// A write is validated end to end before anything is queued, so a malformed batch
+// changes nothing. Accepted records are posted to the CommandQueue in order and run
+// in loop(). The notify characteristic carries the 9-byte STATE message from
+// control_proto.h, sent only when the emotion or attention stage actually changes.
+
+#ifndef BLE_PROTO_H
+#define BLE_PROTO_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "control_proto.h"
+#include "command_queue.h"
+
+#define BLE_PROTO_VERSION 1
+
+enum BleOp : uint8_t {
+  BLE_OP_SET_EMOTION = 0x01,
+  BLE_OP_GESTURE     = 0x02,
+  BLE_OP_CONFIG      = 0x03,
+  BLE_OP_SEQUENCE    = 0x04
+};
+
+// Validates one write and posts its commands to q (source CMD_SRC_BLE, stamped now).
+// Emotion ids are checked by the consumer against the registry; everything else here.
+ControlStatus decodeBleWrite(const uint8_t* data, size_t len, CommandQueue& q, uint32_t now);
+
+// Remembers the last emotion / attention stage sent so notifications only go out on change.
+class StateChangeFilter {
+public:
+  StateChangeFilter() : primed_(false), emotion_(0), stage_(0) {}
+
+  // True on the first call and whenever either value differs from the previous call.
+  bool update(uint8_t emotion, uint8_t stage);
+
+private:
+  bool primed_;
+  uint8_t emotion_;
+  uint8_t stage_;
+};
+
+#endif // BLE_PROTO_H
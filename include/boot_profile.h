@@ -0,0 +1,38 @@
+// BootProfile — wall-clock cost of each setup() phase.
+// setup() calls mark() as each phase ends; report() prints one line with every
+// phase's duration and the time the face first moved, so a slow peripheral
+// (or a blocking WiFi connect) shows up at a glance in the boot log.
+
+#ifndef BOOT_PROFILE_H
+#define BOOT_PROFILE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+class BootProfile {
+public:
+  static const int MAX_PHASES = 16;
+
+  BootProfile();
+
+  // Ends the current phase at nowUs (micros() since reset); extra phases are ignored.
+  void mark(const char* phase, uint32_t nowUs);
+
+  int count() const { return count_; }
+  const char* name(int i) const { return names_[i]; }
+  uint32_t endUs(int i) const { return ends_[i]; }
+  uint32_t durationUs(int i) const { return ends_[i] - (i ? ends_[i - 1] : 0); }
+  uint32_t totalUs() const { return count_ ? ends_[count_ - 1] : 0; }
+
+  // "name 12.3 | name 4.0 | ... | total 812.5 ms". Returns its length (truncated to fit cap).
+  size_t format(char* out, size_t cap) const;
+
+private:
+  const char* names_[MAX_PHASES];
+  uint32_t ends_[MAX_PHASES];
+  int count_;
+};
+
+extern BootProfile bootProfile;
+
+#endif // BOOT_PROFILE_H
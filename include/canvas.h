@@ -42,6 +42,10 @@ public:
   virtual void print(const char* text) = 0;
   virtual void println(const char* text) = 0;
 
+  // Raw 1bpp SSD1306 page-layout buffer, when the canvas has one — lets
+  // FrameCache stream pre-rendered frames in without any draw calls.
+  virtual uint8_t* frameBuffer() { return nullptr; }
+
   // --- Concrete helpers (implemented via primitives above) ---
 
   // Standard rounded-rect eye pair used across nearly all emotions.
@@ -0,0 +1,55 @@
+// ClockService — cached local hour shared by everything that cares about time of day.
+// Reading the wall clock (getLocalTime) can block, so nobody does it on the hot
+// path any more: tick() refreshes the cached hour at most once per
+// CLOCK_REFRESH_MS (or right away after requestRefresh(), e.g. on NTP sync),
+// and hour()/hourAt() are plain reads. Until the wall clock is valid the hour
+// falls back to uptime, as the old millis()-based providers did.
+
+#ifndef CLOCK_SERVICE_H
+#define CLOCK_SERVICE_H
+
+#include <stdint.h>
+#include "config.h"
+
+// Reads the local hour (0–23) without blocking; false while the wall clock is unset.
+typedef bool (*WallClockFn)(int& hour);
+
+// time()/localtime_r source — valid once NTP (or anything else) has set the clock.
+bool systemLocalHour(int& hour);
+
+class ClockService {
+public:
+  ClockService();
+
+  void setSource(WallClockFn fn) { source_ = fn; }
+
+  // Refreshes the cache when CLOCK_REFRESH_MS has passed or a refresh was requested.
+  void tick(unsigned long now);
+
+  // Next tick() refreshes regardless of the interval (NTP sync, time zone change).
+  void requestRefresh() { refreshPending_ = true; }
+
+  // Cached hour as of the last refresh.
+  int hour() const { return hour_; }
+
+  // Wall-clock hour when valid, else the uptime hour for now — for callers with their own clock.
+  int hourAt(unsigned long now) const {
+    return wallClock_ ? hour_ : (int)((now / HOUR_IN_MILLIS) % 24);
+  }
+
+  bool isWallClock() const { return wallClock_; }
+  uint32_t getRefreshes() const { return refreshes_; }
+
+private:
+  WallClockFn source_;
+  int hour_;
+  bool wallClock_;
+  bool refreshPending_;
+  bool everRefreshed_;
+  unsigned long lastRefresh_;
+  uint32_t refreshes_;
+};
+
+extern ClockService clockService;
+
+#endif // CLOCK_SERVICE_H
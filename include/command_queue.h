@@ -0,0 +1,98 @@
+// CommandQueue — lock-free multi-producer/single-consumer queue of control commands.
+// BLE writes arrive on the NimBLE host task while web requests and touch gestures
+// come from loop(); all of them post here instead of calling into EmotionManager,
+// and the command task in loop() is the only consumer. Bounded ring after Vyukov:
+// each cell carries a sequence number, producers claim a cell with one CAS on the
+// enqueue index, the consumer needs no CAS at all. A full queue drops the command.
+// drain() coalesces a burst: only the last emotion requested per drain is applied,
+// so ten BLE writes in one tick start one transition instead of ten. A script is
+// posted as one batch: its begin and steps land in the queue together or not at all.
+
+#ifndef COMMAND_QUEUE_H
+#define COMMAND_QUEUE_H
+
+#include <stdint.h>
+#include <atomic>
+#include "config.h"
+
+enum CommandType : uint8_t {
+  CMD_NONE = 0,
+  CMD_SET_EMOTION,   // arg = EmotionState
+  CMD_GESTURE,       // arg = TouchGesture
+  CMD_SET_CONFIG,    // arg = ConfigField, value = new value
+  CMD_SCRIPT_BEGIN,  // starts a new scripted sequence (replaces one in progress)
+  CMD_SCRIPT_STEP    // arg = EmotionState, value = hold (ms); appended to the sequence
+};
+
+enum CommandSource : uint8_t {
+  CMD_SRC_BLE = 0,
+  CMD_SRC_WEB,
+  CMD_SRC_TOUCH
+};
+
+struct Command {
+  uint8_t type;     // CommandType
+  uint8_t source;   // CommandSource
+  uint8_t arg;
+  uint32_t time;    // millis() when posted
+  uint32_t value;   // CMD_SET_CONFIG / CMD_SCRIPT_STEP payload
+};
+
+// Result of one drain(): how many commands ran and the emotion that won, if any.
+struct CommandDrain {
+  int handled;
+  int coalesced;    // emotion requests overridden by a later one in the same drain
+  int emotion;      // winning emotion request, or -1 for none
+  uint8_t source;   // where the winning request came from
+};
+
+class CommandQueue {
+public:
+  static const uint32_t CAPACITY = COMMAND_QUEUE_SIZE;  // power of two
+  static_assert((CAPACITY & (CAPACITY - 1)) == 0, "COMMAND_QUEUE_SIZE must be a power of two");
+
+  // Handles a non-emotion command; returns the emotion it asks for, or -1.
+  typedef int (*CommandFn)(const Command& cmd, void* ctx);
+
+  CommandQueue();
+
+  // Producer (any task). False (and counted as dropped) when the queue is full.
+  bool post(uint8_t type, uint8_t source, uint8_t arg, uint32_t time, uint32_t value = 0);
+
+  // Producer (any task). Posts n commands into consecutive cells, or none of them
+  // (all n counted as dropped) when fewer than n cells are free.
+  bool postBatch(const Command* cmds, uint32_t n);
+
+  // Consumer only. Copies the oldest command into out; false when empty.
+  bool pop(Command& out);
+
+  // Consumer only. Nothing queued.
+  bool empty() const;
+
+  // Consumer only. Pops up to CAPACITY commands in order. CMD_SET_EMOTION is
+  // coalesced, everything else goes to fn; the last emotion requested (directly or
+  // by fn) wins and is returned for the caller to apply once. CMD_SCRIPT_BEGIN
+  // discards an earlier request in the same drain, since the script takes over.
+  CommandDrain drain(CommandFn fn, void* ctx);
+
+  uint32_t getPosted() const { return posted_.load(std::memory_order_relaxed); }
+  uint32_t getDropped() const { return dropped_.load(std::memory_order_relaxed); }
+  uint32_t getCoalesced() const { return coalesced_; }
+
+private:
+  struct Cell {
+    std::atomic<uint32_t> seq;   // == pos: free for producer; == pos + 1: holds a command
+    Command cmd;
+  };
+
+  Cell cells_[CAPACITY];
+  std::atomic<uint32_t> enqueuePos_;   // shared by producers
+  uint32_t dequeuePos_;                // owned by the consumer
+  std::atomic<uint32_t> posted_;
+  std::atomic<uint32_t> dropped_;
+  uint32_t coalesced_;
+};
+
+extern CommandQueue commandQueue;
+
+#endif // COMMAND_QUEUE_H
@@ -7,6 +7,12 @@
 #define SCREEN_HEIGHT 64
 #define OLED_RESET -1
 #define SCREEN_ADDRESS 0x3C
+#define OLED_I2C_CLOCK_HZ 400000  // I2C clock for frame data (Hz) — full 1KB frame ≈ 25ms, dirty windows far less
+#define OLED_I2C_CHUNK_BYTES 128  // Bytes per I2C transaction incl. 0x40 control byte (ESP32 Wire TX buffer)
+#define ENABLE_FRAME_CACHE true   // Play emotions from frames baked into flash (include/frame_cache_data.h) instead of redrawing
+#define ENABLE_ASYNC_FLUSH true   // Send frames to the OLED from a dedicated task so rendering overlaps the I2C transfer
+#define DISPLAY_TASK_STACK 3072   // Display flush task stack (bytes)
+#define DISPLAY_TASK_PRIORITY 2   // Above loop() (1) so a handed-off frame starts sending as soon as the bus is free
 
 // I2C pins for ESP32-C3 (FIXED - cannot be changed on this chip)
 #define I2C_SDA 6
@@ -21,6 +27,8 @@
 // Touch sensor configuration
 #define TOUCH_PIN 3  // GPIO3 - adjust if needed
 #define TOUCH_THRESHOLD 40
+#define TOUCH_DEBOUNCE_US     3000  // Pin must hold a new level this long before the edge counts (us)
+#define TOUCH_EDGE_QUEUE_SIZE   32  // ISR → InputManager edge ring slots (power of two)
 
 // Speaker configuration
 // IMPORTANT: GPIO9 causes display issues on ESP32-C3 (conflicts with USB/boot)
@@ -39,9 +47,32 @@
 #define BLINK_INTERVAL 3000  // 3 seconds
 #define SLEEP_TIMEOUT 300000  // 5 minutes
 #define HOUR_IN_MILLIS 3600000
+#define CLOCK_REFRESH_MS 1000  // ClockService re-reads the wall clock at most this often (ms)
 #define LONG_PRESS_MS 600
 #define DOUBLE_TAP_WINDOW_MS 300
 
+// Loop scheduling — each task runs when its own deadline passes (see scheduler.h)
+#define CONTROL_TICK_MS          50  // Personality / BLE cadence (ms)
+#define INPUT_IDLE_POLL_MS     1000  // Input task re-check with no touch activity; edges wake it sooner (ms)
+#define COMMAND_TICK_MS          20  // Command queue drain cadence; emotion requests within one tick coalesce (ms)
+#define COMMAND_QUEUE_SIZE       16  // BLE / web / touch → loop() command slots (power of two)
+#define SCRIPT_MAX_STEPS          8  // Steps in one scripted emotion sequence (BLE SEQUENCE op)
+#define FRAME_DEADLINE_SLACK_MS   5  // A frame drawn later than this past its deadline counts as missed (ms)
+#define MIN_FRAME_INTERVAL_MS    10  // Floor between renders — keeps 0ms static faces (BLINK) from redrawing every pass (ms)
+
+// Render profiling (see metrics.h) — histograms served at /api/metrics
+#define METRICS_CPU_MHZ         160  // Cycle-counter rate used to convert cycles to microseconds (MHz)
+#define METRICS_DUMP_INTERVAL_MS 60000  // Serial [METRICS] dump period (ms)
+#define REPORT_INTERVAL_MS       10000  // Serial battery / heap / frame-rate report period (ms)
+
+// Boot — setup() phases are timed and printed as one [BOOT] line (see boot_profile.h)
+#define BOOT_SERIAL_WAIT_MS     500  // Longest wait for a USB-CDC host before booting on regardless (ms)
+
+// Blink transition — on-screen hold per frame (ms): from-face, close 16→10→4, open 10→18, to-face (~1040ms total)
+#define TRANSITION_FRAME_HOLD_MS { 200, 100, 100, 200, 120, 120, 200 }
+#define FACE_MORPH_TRANSITIONS true  // Between two face-grammar emotions, morph the features over the same 7 frames instead of blinking
+#define FACE_MORPH_STEPS          6  // Blend steps in a face morph; frames 0..steps, so 6 matches the blink's 7 frames
+
 // ===== FACE GRAMMAR =====
 // Canonical neutral pose — every emotion deviates from these values.
 #define FACE_EYE_LX   38    // Left eye center X
@@ -91,6 +122,55 @@
 // Multi-touch forgiveness — deep neglect requires effort to recover
 #define FORGIVENESS_TOUCHES     3        // touches needed to forgive GRUMPY/ANGRY
 
+// Drift distributions — relative weights (0–255) per EmotionState, one row per DriftTable.
+// Columns: IDLE HAPPY SLEEPY EXCITED SAD ANGRY CONFUSED THINKING LOVE SURPRISED
+//          DEAD BORED SHY NEEDY CONTENT PLAYFUL GRUMPY BLINK
+#define DRIFT_WEIGHTS_DEFAULT { \
+  /* night 0–6     */ {30,  0, 60,  0,  0, 0,  0, 10,  0,  0, 0, 0, 0, 0,  0,  0, 0, 0}, \
+  /* morning 6–12  */ {20, 30,  0, 20,  0, 0,  0, 10,  0,  0, 0, 0, 0, 0,  5, 15, 0, 0}, \
+  /* afternoon     */ {25, 15,  0,  0,  0, 0, 10, 25,  0, 10, 0, 0, 0, 0, 10,  5, 0, 0}, \
+  /* evening 18–24 */ {25,  0, 30,  0, 10, 0,  0, 10, 15,  0, 0, 0, 0, 0, 10,  0, 0, 0}, \
+  /* positive      */ { 0,  1,  0,  1,  0, 0,  0,  0,  1,  0, 0, 0, 0, 0,  1,  1, 0, 0}, \
+  /* neutral       */ { 1,  0,  0,  0,  0, 0,  1,  1,  0,  1, 0, 0, 0, 0,  0,  0, 0, 0}, \
+  /* negative      */ { 0,  0,  1,  0,  1, 0,  0,  0,  0,  0, 0, 1, 0, 1,  0,  0, 0, 0}, \
+  /* glow          */ { 0,  1,  0,  1,  0, 0,  0,  0,  1,  1, 0, 0, 0, 0,  1,  1, 0, 0}, \
+  /* warmed        */ { 0,  1,  0,  1,  0, 0,  0,  0,  1,  0, 0, 0, 0, 0,  1,  0, 0, 0}  \
+}
+
+// Markov drift mode — next emotion from the current emotion's row of a transition matrix
+#define MARKOV_DRIFT_ENABLED false       // true = matrix drift replaces mood gravity and glow/warmth pools
+
+// Transition weights (0–255): row = current emotion, columns as above.
+#define MARKOV_MATRIX_DEFAULT { \
+  /* IDLE      */ {20, 12,  8,  4,  2, 0,  6, 14,  4,  6, 0,  4, 0,  0, 12,  6, 0, 0}, \
+  /* HAPPY     */ { 8, 20,  0, 14,  0, 0,  0,  4, 10,  6, 0,  0, 0,  0, 16, 18, 0, 0}, \
+  /* SLEEPY    */ {24,  2, 40,  0,  4, 0,  2,  6,  2,  0, 0,  8, 0,  0,  8,  0, 0, 0}, \
+  /* EXCITED   */ { 6, 22,  0, 18,  0, 0,  2,  2,  6, 14, 0,  0, 0,  0,  6, 20, 0, 0}, \
+  /* SAD       */ {16,  2, 14,  0, 24, 0,  4,  8,  0,  0, 0, 12, 0, 12,  6,  0, 0, 0}, \
+  /* ANGRY     */ {20,  0,  6,  0, 22, 0,  4,  8,  0,  0, 0, 20, 0,  8,  0,  0, 0, 0}, \
+  /* CONFUSED  */ {18,  2,  0,  0,  2, 0, 14, 26,  0, 18, 0,  4, 0,  0,  4,  4, 0, 0}, \
+  /* THINKING  */ {22,  4,  2,  2,  0, 0, 16, 22,  0, 10, 0,  6, 0,  0,  8,  4, 0, 0}, \
+  /* LOVE      */ { 8, 18,  4,  4,  0, 0,  0,  0, 24,  0, 0,  0, 0,  0, 22, 10, 0, 0}, \
+  /* SURPRISED */ {14, 14,  0, 16,  0, 0, 16, 14,  0,  8, 0,  0, 0,  0,  4, 12, 0, 0}, \
+  /* DEAD      */ {40,  0, 40,  0, 10, 0,  0,  0,  0,  0, 0, 10, 0,  0,  0,  0, 0, 0}, \
+  /* BORED     */ {22,  0, 16,  0, 12, 0,  4, 10,  0,  2, 0, 18, 0, 10,  2,  4, 0, 0}, \
+  /* SHY       */ { 8, 30,  0,  4,  0, 0,  0,  0, 20,  4, 0,  0, 0,  0, 26,  8, 0, 0}, \
+  /* NEEDY     */ {16,  4,  6,  0, 18, 0,  4,  4,  4,  0, 0, 20, 0, 20,  2,  2, 0, 0}, \
+  /* CONTENT   */ {16, 16,  8,  2,  0, 0,  0,  8, 12,  2, 0,  2, 0,  0, 26,  8, 0, 0}, \
+  /* PLAYFUL   */ { 6, 20,  0, 20,  0, 0,  4,  2,  4, 12, 0,  0, 0,  0,  8, 24, 0, 0}, \
+  /* GRUMPY    */ {20,  0,  8,  0, 18, 0,  4,  8,  0,  0, 0, 24, 0, 12,  0,  0, 0, 0}, \
+  /* BLINK     */ {30, 10,  8,  4,  2, 0,  6, 14,  4,  4, 0,  4, 0,  0, 10,  4, 0, 0}  \
+}
+
+// Column multipliers (100 = ×1.0, 0–255) applied on top of the matrix row, one row per MarkovBias.
+#define MARKOV_BIAS_DEFAULT { \
+  /* night     */ {150,  40, 255,  20,  80, 100,  50,  80,  60,  30, 100, 100, 100, 100,  80,  20, 100, 100}, \
+  /* morning   */ {100, 160,  30, 160,  60, 100,  80, 100, 100, 120, 100,  60, 100, 100, 100, 160, 100, 100}, \
+  /* afternoon */ {100, 100,  60, 100,  80, 100, 150, 160,  80, 150, 100, 100, 100, 100, 100, 100, 100, 100}, \
+  /* evening   */ {100,  80, 200,  60, 120, 100,  80, 100, 160,  60, 100, 100, 100, 100, 140,  60, 100, 100}, \
+  /* warm      */ {100, 220,  40, 220,  40, 100,  80, 100, 255, 150, 100,  40, 100,  40, 200, 220, 100, 100}  \
+}
+
 // ===== DEBUG MODE =====
 #define DEBUG_MODE_ENABLED true            // Set to true to enable debug mode
 #define DEBUG_MODE_CYCLE off              // true = cycle all emotions; false = show only DEBUG_MODE_EMOTION
@@ -102,11 +182,27 @@
 #define WIFI_AP_CHANNEL     1          // 2.4GHz ch1 — minimal BLE advertising overlap
 #define WIFI_SERVER_PORT    80
 #define WEB_MIN_FREE_HEAP   51200      // 50KB — warning threshold after WiFi init
+#define HTTP_MAX_CONNECTIONS   4       // Pooled keep-alive connections; further clients wait in the TCP backlog
+#define HTTP_MAX_HEADER_BYTES  1024    // Request line + headers per connection; larger → 431 (bytes)
+#define HTTP_MAX_REQUEST_BYTES 1536    // Head + body per connection; larger body → 413 (bytes)
+#define HTTP_TX_BUFFER_BYTES   1024    // Response head + small body per connection (bytes)
+#define HTTP_READ_SLICE_BYTES  512     // Most bytes read per connection per update() (bytes)
+#define HTTP_WRITE_SLICE_BYTES 1436    // Most bytes written per connection per update() — one TCP MSS (bytes)
+#define HTTP_KEEPALIVE_MS      5000    // Idle keep-alive connection is closed after this (ms)
+#define HTTP_REQUEST_TIMEOUT_MS 3000   // Partially received request is answered 408 after this (ms)
+#define SSE_MAX_CLIENTS     3          // Concurrent /api/events streams (open browser tabs)
+#define SSE_STATUS_INTERVAL_MS 10000   // Battery/heap/uptime snapshot pushed to open streams (ms)
+#define SSE_KEEPALIVE_MS    15000      // Comment line on a quiet stream so dead clients are noticed (ms)
+#define WS_MAX_CLIENTS      2          // Concurrent /ws control sockets
+#define WS_MAX_PAYLOAD      125        // Largest client frame accepted — the control-frame limit (bytes)
+#define MIRROR_MIN_INTERVAL_MS 33      // OLED mirror frames are at most this often, even with credit (ms)
 
 // Optional STA WiFi for NTP time sync — leave SSID empty "" to skip
 #define WIFI_STA_SSID        ""        // Home WiFi SSID (empty = AP-only mode)
 #define WIFI_STA_PASSWORD    ""        // Home WiFi password
-#define WIFI_STA_TIMEOUT_MS  10000     // Max ms to wait for STA connection
+#define WIFI_STA_TIMEOUT_MS  10000     // One STA attempt is abandoned after this (ms) — in the background, never at boot
+#define WIFI_STA_RETRY_MIN_MS 5000     // First retry delay after a failed attempt or dropped link (ms)
+#define WIFI_STA_RETRY_MAX_MS 300000   // Backoff doubles per failure up to this (ms)
 #define NTP_SERVER           "pool.ntp.org"
 #define NTP_UTC_OFFSET_S     0         // UTC offset in seconds (e.g. 18000 for UTC+5)
 #define NTP_DST_OFFSET_S     0         // DST offset (0 or 3600)
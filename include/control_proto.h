@@ -0,0 +1,67 @@
+// Binary control protocol — compact commands, acknowledgements and state pushes.
+// Carried in WebSocket binary frames on /ws; independent of the transport so the
+// same bytes can travel over other links. Every message starts with an opcode byte:
+//
+//   client → robot   [op][seq][arg]      op: SET_EMOTION (arg = emotion id),
+//                                            GESTURE (arg = TouchGesture), QUERY (no arg),
+//                                            MIRROR (arg = 1 want a frame, 0 stop)
+//   robot → client   [ACK][seq][op][status]
+//                    [STATE][emotion][attentionStage][batteryMv LE16][uptimeMs LE32]
+//                    [FRAME]... OLED mirror delta (see oled_mirror.h)
+//
+// seq is chosen by the client and echoed in the ACK so it can match replies and
+// measure round-trip time. STATE is sent after QUERY and on every emotion change.
+// MIRROR is not acknowledged: each request is a credit for exactly one FRAME, sent
+// once the screen changes, so frames never queue faster than the client draws them.
+
+#ifndef CONTROL_PROTO_H
+#define CONTROL_PROTO_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+enum ControlOp : uint8_t {
+  CTRL_SET_EMOTION = 0x01,
+  CTRL_GESTURE     = 0x02,
+  CTRL_QUERY       = 0x03,
+  CTRL_MIRROR      = 0x04,
+  CTRL_ACK         = 0x81,
+  CTRL_STATE       = 0x82,
+  CTRL_FRAME       = 0x83
+};
+
+enum ControlStatus : uint8_t {
+  CTRL_OK          = 0,
+  CTRL_BAD_LENGTH  = 1,   // message shorter or longer than its opcode requires
+  CTRL_BAD_VALUE   = 2,   // unknown emotion id or gesture
+  CTRL_UNKNOWN_OP  = 3,
+  CTRL_BAD_VERSION = 4,   // batched write with a protocol version this firmware doesn't speak
+  CTRL_BUSY        = 5    // command queue full; part of the batch was dropped
+};
+
+struct ControlCommand {
+  ControlOp op;
+  uint8_t seq;
+  uint8_t arg;
+};
+
+struct ControlState {
+  uint8_t emotion;
+  uint8_t attentionStage;
+  uint16_t batteryMv;
+  uint32_t uptimeMs;
+};
+
+#define CTRL_ACK_BYTES   4
+#define CTRL_STATE_BYTES 9
+
+// Parses one command. Fills cmd.op and cmd.seq whenever at least two bytes are present,
+// so even a rejected command can be acknowledged. Argument ranges are the caller's
+// to check (emotion ids depend on the registry); gesture codes are checked here.
+ControlStatus decodeControlCommand(const uint8_t* data, size_t len, ControlCommand& cmd);
+
+// Each returns the bytes written, or 0 if cap is too small.
+size_t encodeControlAck(uint8_t* out, size_t cap, uint8_t seq, uint8_t op, ControlStatus status);
+size_t encodeControlState(uint8_t* out, size_t cap, const ControlState& state);
+
+#endif // CONTROL_PROTO_H
@@ -0,0 +1,31 @@
+// Dirty-region tracking for 1bpp SSD1306 page-layout framebuffers.
+// Compares a new frame against the one last sent to the panel and returns the
+// smallest page/column window that covers every changed byte, so a flush only
+// pushes that window over I2C — or nothing at all when the frame is identical.
+
+#ifndef DIRTY_RECT_H
+#define DIRTY_RECT_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Changed window in SSD1306 addressing units (all bounds inclusive).
+struct DirtyRect {
+  uint8_t col0, col1;    // columns 0..width-1
+  uint8_t page0, page1;  // 8-pixel pages 0..height/8-1
+
+  int widthCols() const { return col1 - col0 + 1; }
+  int heightPages() const { return page1 - page0 + 1; }
+  int byteCount() const { return widthCols() * heightPages(); }
+};
+
+// Finds the bounding window of bytes that differ between cur and prev.
+// Returns false (out untouched) when the frames are identical.
+bool findDirtyRect(const uint8_t* cur, const uint8_t* prev, int width,
+                   int pages, DirtyRect& out);
+
+// Copies the window's bytes from src into dst (same layout), e.g. to update a shadow frame.
+void copyDirtyRect(uint8_t* dst, const uint8_t* src, int width,
+                   const DirtyRect& r);
+
+#endif // DIRTY_RECT_H
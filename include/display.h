@@ -16,12 +16,9 @@
 #include "config.h"
 #include "canvas.h"
 #include "emotion.h"
-
-// Returned by performTransitionFrame to tell main.cpp what to do
-enum TransitionResult {
-  TR_DREW_FRAME,  // Frame rendered, caller should advanceTransition()
-  TR_COMPLETE      // Final frame rendered, caller should completeTransition()
-};
+#include "transition.h"
+#include "dirty_rect.h"
+#include "frame_handoff.h"
 
 // ===== DISPLAY MANAGER =====
 class DisplayManager : public ICanvas {
@@ -29,6 +26,11 @@ public:
   DisplayManager();
 
   bool init();
+
+  // Moves panel transfers onto a dedicated FreeRTOS task. Until this is called
+  // (boot screen, init) flush() sends synchronously; afterwards it only hands
+  // the frame over and returns, so the next frame renders while this one is sent.
+  bool startFlushTask();
   void scanI2C();
   void showBootScreen();
   void drawBootFace();
@@ -55,6 +57,7 @@ public:
   void setTextColor(uint16_t color) override;
   void print(const char* text) override;
   void println(const char* text) override;
+  uint8_t* frameBuffer() override { return display.getBuffer(); }
 
   // --- Static face drawing (will migrate to EmotionRegistry in Phase 2) ---
   void drawFace_Normal();
@@ -75,8 +78,8 @@ public:
   void drawEmotionFace(EmotionState emotion);
 
   // Transition animation — decoupled from EmotionManager.
-  // main.cpp reads emotion state and passes it here; return value tells
-  // main.cpp whether to advance or complete the transition.
+  // Draws one frame and returns immediately; TransitionPlayer paces the frames.
+  // Return value tells the caller whether this was the final frame.
   TransitionResult performTransitionFrame(int frame, EmotionState current,
                                           EmotionState target);
 
@@ -87,9 +90,35 @@ public:
   // Raw display access (used by animations.cpp until Phase 2 migration)
   Adafruit_SSD1306& getDisplay() { return display; }
 
+  // Flush accounting: bytes pushed over I2C, and flushes skipped as identical
+  uint32_t getFlushedBytes() const { return flushedBytes_; }
+  uint32_t getSkippedFlushes() const { return skippedFlushes_; }
+
+  // Async flush accounting: time the display task spent on the I2C bus, frames
+  // handed over, and frames replaced before the bus was free to send them
+  uint32_t getBusBusyUs() const { return busBusyUs_; }
+  uint32_t getMaxSendUs() const { return maxSendUs_; }
+  uint32_t getHandedOffFrames() const { return handoff_.getPublished(); }
+  uint32_t getDroppedFrames() const { return handoff_.getDropped(); }
+
 private:
   Adafruit_SSD1306 display;
 
+  // Last frame sent to the panel — flush() diffs against it to find the dirty window
+  uint8_t shadow_[SCREEN_WIDTH * SCREEN_HEIGHT / 8];
+  uint32_t flushedBytes_;
+  uint32_t skippedFlushes_;
+  uint32_t busBusyUs_;
+  uint32_t maxSendUs_;
+
+  // Renderer → display task mailbox, and the task that drains it
+  FrameHandoff handoff_;
+  TaskHandle_t flushTask_;
+
+  void sendFrame(const uint8_t* frame);
+  void sendWindow(const uint8_t* frame, const DirtyRect& r);
+  static void flushTaskEntry(void* self);
+
   // Internal transition helpers
   TransitionResult sleepyTransitionFrame(int frame, EmotionState target);
 };
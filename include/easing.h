@@ -0,0 +1,45 @@
+// Easing — integer-only interpolation for the FPU-less ESP32-C3.
+// Quadratic ease-in-out (what every draw function uses) is computed exactly in
+// integers; cubic and bounce curves come from compile-time Q8.8 lookup tables.
+// No float math at runtime — soft-float multiply/divide was the hot spot of
+// every animated frame.
+
+#ifndef EASING_H
+#define EASING_H
+
+#include <stdint.h>
+
+enum EaseCurve {
+  EASE_LINEAR,
+  EASE_IN_OUT_QUAD,
+  EASE_IN_OUT_CUBIC,
+  EASE_OUT_BOUNCE
+};
+
+static const int EASE_ONE = 256;       // 1.0 in Q8.8
+static const int EASE_LUT_STEPS = 64;  // LUT segments (table has STEPS + 1 entries)
+
+// Quadratic ease-in-out: start at frame 0, end at frame >= totalFrames.
+// Exact rational form of the old float formula, truncated toward zero the same
+// way; bit-exact with it for |end - start| <= 71 and totalFrames <= 255.
+inline int easeInOutQuad(int start, int end, int frame, int totalFrames) {
+  if (totalFrames <= 0) return end;
+  if (frame > totalFrames) frame = totalFrames;
+  int32_t tt = (int32_t)totalFrames * totalFrames;
+  int32_t num;
+  if (2 * frame < totalFrames) {
+    num = 2 * (int32_t)frame * frame;
+  } else {
+    int32_t rest = totalFrames - frame;
+    num = tt - 2 * rest * rest;
+  }
+  return start + (int)((int32_t)(end - start) * num / tt);
+}
+
+// Eased progress of frame/totalFrames as Q8.8 (0..EASE_ONE).
+uint16_t easeProgressQ8(EaseCurve curve, int frame, int totalFrames);
+
+// Interpolates start..end along the curve (truncates toward zero like the float code did).
+int easeCurve(EaseCurve curve, int start, int end, int frame, int totalFrames);
+
+#endif // EASING_H
@@ -0,0 +1,62 @@
+// EdgeQueue — lock-free single-producer/single-consumer ring of timestamped pin edges.
+// The GPIO interrupt is the only producer and InputManager the only consumer, so
+// head and tail each have one writer and a pair of acquire/release atomics is
+// all the synchronisation needed — no critical section, nothing that can block
+// inside the ISR. When the ring is full the new edge is dropped and counted;
+// the consumer then re-reads the pin to resync.
+
+#ifndef EDGE_QUEUE_H
+#define EDGE_QUEUE_H
+
+#include <stdint.h>
+#include <atomic>
+#include "config.h"
+
+#ifndef IRAM_ATTR
+#define IRAM_ATTR
+#endif
+
+struct TouchEdge {
+  uint32_t us;     // micros() when the edge was seen
+  uint8_t level;   // pin level after the edge (LOW = touched)
+};
+
+class EdgeQueue {
+public:
+  static const uint8_t CAPACITY = TOUCH_EDGE_QUEUE_SIZE;  // power of two
+  static_assert((CAPACITY & (CAPACITY - 1)) == 0, "TOUCH_EDGE_QUEUE_SIZE must be a power of two");
+
+  EdgeQueue();
+
+  // Producer (ISR). Inline so it lands in the IRAM-resident handler. False when full.
+  inline bool IRAM_ATTR push(uint32_t us, uint8_t level) {
+    uint8_t head = head_.load(std::memory_order_relaxed);
+    uint8_t next = (uint8_t)((head + 1) & (CAPACITY - 1));
+    if (next == tail_.load(std::memory_order_acquire)) {
+      overflows_.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    ring_[head].us = us;
+    ring_[head].level = level;
+    head_.store(next, std::memory_order_release);
+    return true;
+  }
+
+  // Consumer. Copies the oldest edge into out; false when empty.
+  bool pop(TouchEdge& out);
+
+  bool empty() const {
+    return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_relaxed);
+  }
+
+  // Edges dropped because the ring was full since the last call; resets the count.
+  uint32_t takeOverflows() { return overflows_.exchange(0, std::memory_order_relaxed); }
+
+private:
+  TouchEdge ring_[CAPACITY];        // one slot stays empty to tell full from empty
+  std::atomic<uint8_t> head_;       // next slot to write (producer-owned)
+  std::atomic<uint8_t> tail_;       // next slot to read (consumer-owned)
+  std::atomic<uint32_t> overflows_;
+};
+
+#endif // EDGE_QUEUE_H
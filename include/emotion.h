@@ -48,6 +48,8 @@ public:
   EmotionState getPreviousEmotion() const { return previousEmotion; }
   EmotionState getTargetEmotion() const { return targetEmotion; }
   bool isTransitionActive() const { return isTransitioning; }
+  // Emotion the face shows or is transitioning to — what state pushes should report.
+  EmotionState getShownEmotion() const { return isTransitioning ? targetEmotion : currentEmotion; }
   int getTransitionFrame() const { return transitionFrame; }
 
   void startTransition();
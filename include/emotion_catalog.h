@@ -0,0 +1,11 @@
+#ifndef EMOTION_CATALOG_H
+#define EMOTION_CATALOG_H
+
+// Emotion catalog — the one list of registered emotions.
+// Lives outside main.cpp so host tools (tools/framegen.cpp) register exactly
+// the same frame counts, delays and draw functions as the firmware.
+
+// Registers all emotion definitions with per-emotion frame counts, delays, loop modes, and draw functions.
+void registerEmotions();
+
+#endif // EMOTION_CATALOG_H
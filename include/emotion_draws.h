@@ -6,6 +6,7 @@
 // The tick() method in AnimationManager handles clear/flush and frame advancement.
 
 #include "canvas.h"
+#include "face.h"
 
 // Static emotions (1 frame)
 void drawIdle(ICanvas& canvas, int frame, const void* ctx);
@@ -29,4 +30,20 @@ void drawContent(ICanvas& canvas, int frame, const void* ctx);
 void drawPlayful(ICanvas& canvas, int frame, const void* ctx);
 void drawGrumpy(ICanvas& canvas, int frame, const void* ctx);
 
+// Keyframe tracks for the emotions drawn by the face grammar (see face.h).
+// CONFUSED, THINKING, LOVE, SLEEPY, DEAD and PLAYFUL draw glyphs and shapes the
+// grammar has no channel for, so they keep hand-written draw functions.
+extern const FaceTrack FACE_IDLE;
+extern const FaceTrack FACE_BLINK;
+extern const FaceTrack FACE_HAPPY;
+extern const FaceTrack FACE_SAD;
+extern const FaceTrack FACE_ANGRY;
+extern const FaceTrack FACE_EXCITED;
+extern const FaceTrack FACE_SURPRISED;
+extern const FaceTrack FACE_BORED;
+extern const FaceTrack FACE_SHY;
+extern const FaceTrack FACE_NEEDY;
+extern const FaceTrack FACE_CONTENT;
+extern const FaceTrack FACE_GRUMPY;
+
 #endif // EMOTION_DRAWS_H
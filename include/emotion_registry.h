@@ -7,7 +7,8 @@
 
 #include "emotion.h"  // EmotionState enum
 
-class ICanvas;  // Forward declaration
+class ICanvas;     // Forward declaration
+struct FaceTrack;  // face.h
 
 // How an animation behaves when it reaches the last frame
 enum LoopBehavior {
@@ -31,6 +32,7 @@ struct EmotionDef {
   LoopBehavior loop;
   bool blinkable;              // Whether natural-blink overlay can apply
   DrawFrameFn drawFrame;       // Render function (nullptr until Phase 2)
+  const FaceTrack* face;       // Keyframe track if drawn by the face grammar, else nullptr
 };
 
 class EmotionRegistry {
@@ -0,0 +1,105 @@
+// Face grammar renderer — parametric faces driven by keyframe tracks.
+// A FaceParams holds one value per FaceChannel (eye heights, mouth shape and
+// size, brows, blush, ...). An emotion is a FaceTrack: a short frame-sorted list
+// of FaceKeys, each setting one channel at one frame and saying how the value
+// moves until that channel's next key. evaluateFace() resolves a frame to
+// params, drawFace() rasterizes them, and morphFace() blends any two faces —
+// which is how transitions between parametric emotions are drawn.
+
+#ifndef FACE_H
+#define FACE_H
+
+#include <stdint.h>
+#include "config.h"
+#include "emotion.h"
+
+class ICanvas;
+
+enum FaceChannel {
+  FC_EYE_Y,         // eye centre Y (both eyes)
+  FC_EYE_RDY,       // extra Y for the right eye only (head tilt, asymmetric beats)
+  FC_EYE_LH,        // left eye height
+  FC_EYE_RH,        // right eye height
+  FC_PUPIL_R,       // black pupil / catch-light radius (0 = none)
+  FC_PUPIL_DX,      // pupil offset from the eye centre
+  FC_PUPIL_DY,
+  FC_BROW_T,        // brow thickness (0 = no brows)
+  FC_BROW_OUTER_Y,  // brow end above the outer eye corner
+  FC_BROW_INNER_Y,  // brow end above the inner eye corner
+  FC_MOUTH_SHAPE,   // MouthShape
+  FC_MOUTH_X,       // left edge (MOUTH_RECT) or centre (all other shapes)
+  FC_MOUTH_Y,
+  FC_MOUTH_W,
+  FC_MOUTH_H,       // height; for MOUTH_V the centre's drop below the corners
+  FC_MOUTH_R,       // corner / circle radius; for MOUTH_V the line thickness
+  FC_BLUSH_R,       // blush circle radius (0 = none)
+  FC_BLUSH_LX,
+  FC_BLUSH_RX,
+  FC_BLUSH_Y,
+  FC_SPARKLE_R,     // corner sparkle radius (0 = none)
+  FC_SPARKLE_DX,    // sparkle distance from the screen's centre column
+  FC_SPARKLE_Y,
+  FC_TEAR_R,        // tear below the left eye's inner corner (0 = none)
+  FC_TEAR_Y,
+  FC_OFFSET_X,      // whole-face shift (shake, tremble, bounce); sparkles stay put
+  FC_OFFSET_Y,
+  FC_COUNT
+};
+
+enum MouthShape {
+  MOUTH_NONE,
+  MOUTH_RECT,           // rounded rect, X = left edge
+  MOUTH_RECT_CENTERED,  // rounded rect, X = centre
+  MOUTH_DISC,           // filled circle
+  MOUTH_RING,           // circle outline
+  MOUTH_V               // thick two-segment line; H > 0 sags (pout), H < 0 peaks (frown)
+};
+
+// How a channel moves from one key until its next key.
+enum FaceCurve {
+  FK_HOLD,    // stay at value
+  FK_EASE,    // quadratic ease to the next key's value, reached at its frame
+  FK_LINEAR,  // straight line to the next key's value
+  FK_PULSE1,  // value / alt alternating every frame (even frames = value)
+  FK_PULSE2,  // ... every 2 frames
+  FK_PULSE3,  // ... every 3 frames
+  FK_PULSE4   // ... every 4 frames
+};
+
+struct FaceKey {
+  uint8_t frame;
+  uint8_t channel;  // FaceChannel
+  uint8_t curve;    // FaceCurve
+  int8_t value;
+  int8_t alt;       // second value for FK_PULSE*
+};
+
+struct FaceTrack {
+  const FaceKey* keys;  // sorted by frame
+  uint8_t keyCount;
+};
+
+struct FaceParams {
+  int8_t v[FC_COUNT];
+};
+
+// Neutral face from the config.h grammar — every channel's value before its first key.
+extern const FaceParams FACE_NEUTRAL;
+
+// Resolves the track at a frame.
+void evaluateFace(const FaceTrack& track, int frame, FaceParams& out);
+
+// Rasterizes a face (eyes, pupils, brows, tear, mouth, blush, sparkles).
+void drawFace(ICanvas& canvas, const FaceParams& face);
+
+// Evaluates and draws one frame of a track.
+void drawFaceTrack(ICanvas& canvas, const FaceTrack& track, int frame);
+
+// Eases every channel from a to b; step 0 = a, step >= steps = b. Shapes switch halfway.
+void morphFace(const FaceParams& a, const FaceParams& b, int step, int steps,
+               FaceParams& out);
+
+// Params of a registered emotion's frame. Returns false for hand-drawn emotions.
+bool faceParamsFor(EmotionState emotion, int frame, FaceParams& out);
+
+#endif // FACE_H
@@ -0,0 +1,61 @@
+// FrameCache — plays animation frames pre-rendered at build time.
+// tools/framegen.cpp runs every registered DrawFrameFn for every frame index and
+// bakes the results into include/frame_cache_data.h as XOR-delta/RLE streams
+// (see frame_codec.h). render() streams a frame straight into the display's
+// framebuffer instead of re-running the geometry: stepping to a neighbouring
+// frame XORs one delta in place; anything else replays from the keyframe.
+
+#ifndef FRAME_CACHE_H
+#define FRAME_CACHE_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "emotion.h"
+#include "emotion_registry.h"
+
+static const size_t FRAME_CACHE_FRAME_BYTES = SCREEN_WIDTH * (SCREEN_HEIGHT / 8);
+
+// One baked emotion: its frames are FRAME_CACHE_OFFSETS[firstFrame .. firstFrame + frameCount].
+struct FrameCacheEntry {
+  uint8_t emotion;
+  uint8_t frameCount;
+  uint16_t firstFrame;
+};
+
+class FrameCache {
+public:
+  FrameCache();
+
+  // Enables each baked emotion whose frame count still matches the registry.
+  // Returns the number enabled; stale entries are logged and drawn live.
+  int begin();
+
+  // True when frames for the emotion can be served from flash.
+  bool has(EmotionState emotion) const;
+
+  // Writes the frame into fb (FRAME_CACHE_FRAME_BYTES, SSD1306 page layout).
+  // continuing = fb still holds whatever the previous render() left there.
+  // Returns false, leaving fb untouched, when the frame is not baked.
+  bool render(EmotionState emotion, int frame, uint8_t* fb, bool continuing);
+
+  // Flash bytes of the emotion's encoded frames (0 if not baked).
+  size_t flashBytes(EmotionState emotion) const;
+  size_t totalFlashBytes() const;
+
+  uint32_t getDeltaSteps() const { return deltaSteps_; }
+  uint32_t getKeyframeReplays() const { return keyframeReplays_; }
+
+private:
+  const FrameCacheEntry* find(EmotionState emotion) const;
+  bool applyFrame(const FrameCacheEntry& entry, int frame, uint8_t* fb) const;
+
+  uint32_t enabled_;  // bit per EmotionState
+  int emotion_;       // what fb held after the last render (-1 = unknown)
+  int frame_;
+  uint32_t deltaSteps_;
+  uint32_t keyframeReplays_;
+};
+
+extern FrameCache frameCache;
+
+#endif // FRAME_CACHE_H
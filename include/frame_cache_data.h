@@ -0,0 +1,3770 @@
+// frame_cache_data.h — GENERATED by tools/framegen.cpp. Do not edit by hand.
+// Regenerate after changing any DrawFrameFn or frame count:
+//   pio run -e framegen -t exec
+//
+// Flash used per emotion (raw = frames x 1024 B):
+//   IDLE        60 frames    789 B  ( 1.3% of raw)
+//   HAPPY       50 frames   3064 B  ( 6.0% of raw)
+//   SLEEPY      59 frames   3044 B  ( 5.0% of raw)
+//   EXCITED     40 frames  10066 B  (24.6% of raw)
+//   SAD         56 frames   2497 B  ( 4.4% of raw)
+//   ANGRY       56 frames   9871 B  (17.2% of raw)
+//   CONFUSED    44 frames   1755 B  ( 3.9% of raw)
+//   THINKING    44 frames   1327 B  ( 2.9% of raw)
+//   LOVE        44 frames   4859 B  (10.8% of raw)
+//   SURPRISED   44 frames   4316 B  ( 9.6% of raw)
+//   DEAD        70 frames   1613 B  ( 2.3% of raw)
+//   BORED       60 frames   1910 B  ( 3.1% of raw)
+//   SHY         50 frames   2255 B  ( 4.4% of raw)
+//   NEEDY       54 frames   2983 B  ( 5.4% of raw)
+//   CONTENT     60 frames   2548 B  ( 4.1% of raw)
+//   PLAYFUL     48 frames   2558 B  ( 5.2% of raw)
+//   GRUMPY      56 frames   2655 B  ( 4.6% of raw)
+//   BLINK        1 frames     55 B  ( 5.4% of raw)
+//   data 58165 B + index 3660 B = 61825 B for 896 frames
+
+#ifndef FRAME_CACHE_DATA_H
+#define FRAME_CACHE_DATA_H
+
+#include "frame_cache.h"
+
+static const uint8_t FRAME_CACHE_DATA[] PROGMEM = {
+  0xFF, 0xFF, 0x99, 0x17, 0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE,
+  0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0xF0, 0xC0, 0x9B, 0x17, 0xC0, 0xF0,
+  0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE,
+  0xFE, 0xFC, 0xFC, 0xF8, 0xF0, 0xC0, 0xB3, 0x17, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x9B, 0x17, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x17, 0x03, 0x0F, 0x1F, 0x3F,
+  0x3F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x3F,
+  0x3F, 0x1F, 0x0F, 0x03, 0x9B, 0x17, 0x03, 0x0F, 0x1F, 0x3F, 0x3F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
+  0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x3F, 0x1F, 0x0F, 0x03, 0xFF, 0xD2,
+  0x0D, 0xE0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0xF2,
+  0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xB8, 0x00, 0x80, 0x89, 0x02, 0x90, 0xF0, 0xE0, 0xF2, 0x0B, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0x99, 0x17, 0x20, 0x08, 0x04,
+  0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x02, 0x02, 0x04, 0x08, 0x20, 0x9B, 0x17, 0x20, 0x08, 0x04, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x04, 0x08, 0x20, 0xFF,
+  0xB3, 0x17, 0x02, 0x08, 0x10, 0x20, 0x20, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x20, 0x20, 0x10, 0x08, 0x02, 0x9B, 0x17, 0x02, 0x08, 0x10, 0x20,
+  0x20, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x20,
+  0x20, 0x10, 0x08, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0x00, 0x80, 0x89, 0x02, 0x90,
+  0xF0, 0xE0, 0xF2, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0xFF, 0xFF, 0x99, 0x17, 0x20, 0x08, 0x04, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x04, 0x08, 0x20, 0x9B, 0x17, 0x20, 0x08,
+  0x04, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x02, 0x02, 0x04, 0x08, 0x20, 0xFF, 0xB3, 0x17, 0x02, 0x08, 0x10, 0x20, 0x20, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x20, 0x20, 0x10, 0x08,
+  0x02, 0x9B, 0x17, 0x02, 0x08, 0x10, 0x20, 0x20, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x20, 0x20, 0x10, 0x08, 0x02, 0xFF, 0xFF, 0x99, 0x17, 0x20,
+  0x08, 0x04, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x02, 0x02, 0x04, 0x08, 0x20, 0x9B, 0x17, 0x20, 0x08, 0x04, 0x02, 0x02, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x04, 0x08,
+  0x20, 0xFF, 0xB3, 0x17, 0x02, 0x08, 0x10, 0x20, 0x20, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x20, 0x20, 0x10, 0x08, 0x02, 0x9B, 0x17, 0x02, 0x08,
+  0x10, 0x20, 0x20, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x20, 0x20, 0x10, 0x08, 0x02, 0xFF, 0xD2, 0x0D, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xEC, 0x04, 0x10, 0x04, 0x02, 0x01, 0x01, 0x8D, 0x04,
+  0x01, 0x01, 0x02, 0x04, 0x10, 0xFF, 0xE7, 0x17, 0x01, 0x04, 0x08, 0x10, 0x10, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10, 0x10, 0x08, 0x04, 0x01,
+  0xFF, 0xD2, 0x0D, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0xEC, 0x04, 0x10, 0x04, 0x02, 0x01, 0x01, 0x8D, 0x04, 0x01, 0x01, 0x02, 0x04, 0x10, 0xFF,
+  0xE7, 0x17, 0x01, 0x04, 0x08, 0x10, 0x10, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x10, 0x10, 0x08, 0x04, 0x01, 0xFF, 0xFF, 0x99, 0x17, 0x20, 0x08,
+  0x04, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x02, 0x02, 0x04, 0x08, 0x20, 0x9B, 0x17, 0x20, 0x08, 0x04, 0x02, 0x02, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x04, 0x08, 0x20,
+  0xFF, 0xB3, 0x17, 0x02, 0x08, 0x10, 0x20, 0x20, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x20, 0x20, 0x10, 0x08, 0x02, 0x9B, 0x17, 0x02, 0x08, 0x10,
+  0x20, 0x20, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x20, 0x20, 0x10, 0x08, 0x02, 0xFF, 0xFF, 0x99, 0x17, 0x80, 0xE0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFC,
+  0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xF8, 0xF8, 0xF0, 0xE0,
+  0x80, 0x9B, 0x17, 0x80, 0xE0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC,
+  0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xF8, 0xF8, 0xF0, 0xE0, 0x80, 0xB3, 0x17, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9B, 0x17, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3,
+  0x17, 0x01, 0x07, 0x0F, 0x1F, 0x1F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x1F, 0x1F, 0x0F, 0x07, 0x01, 0x9B, 0x17, 0x01, 0x07, 0x0F, 0x1F, 0x1F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x1F, 0x1F,
+  0x0F, 0x07, 0x01, 0xFF, 0xD2, 0x0F, 0x1C, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+  0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x1C, 0xFF, 0xFF, 0x99, 0x17, 0x80, 0x20, 0x10, 0x08, 0x08, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x08, 0x10,
+  0x20, 0x80, 0x9B, 0x17, 0x80, 0x20, 0x10, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x08, 0x10, 0x20, 0x80, 0xFF, 0xFF, 0xFF, 0xD1,
+  0x01, 0x1C, 0x22, 0x8D, 0x01, 0x22, 0x1C, 0xFF, 0xFF, 0x9A, 0x15, 0xC0, 0x60, 0x30, 0x30, 0x18,
+  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x30, 0x30, 0x60,
+  0xC0, 0x9D, 0x15, 0xC0, 0x60, 0x30, 0x30, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+  0x18, 0x18, 0x18, 0x18, 0x18, 0x30, 0x30, 0x60, 0xC0, 0xB4, 0x00, 0x03, 0x95, 0x00, 0x03, 0x9B,
+  0x00, 0x03, 0x95, 0x00, 0x03, 0xB3, 0x17, 0x01, 0x04, 0x08, 0x10, 0x10, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10, 0x10, 0x08, 0x04, 0x01, 0x9B,
+  0x17, 0x01, 0x04, 0x08, 0x10, 0x10, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x10, 0x10, 0x08, 0x04, 0x01, 0xFF, 0xCF, 0x15, 0x18, 0x3C, 0x62, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x62,
+  0x3C, 0x18, 0xFF, 0xFF, 0x9B, 0x13, 0x80, 0xC0, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+  0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0xC0, 0x80, 0x9F, 0x13, 0x80, 0xC0, 0x40, 0x60,
+  0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0xC0, 0x80,
+  0xB5, 0x02, 0x04, 0x03, 0x01, 0x91, 0x02, 0x01, 0x03, 0x04, 0x9B, 0x02, 0x04, 0x03, 0x01, 0x91,
+  0x02, 0x01, 0x03, 0x04, 0xB4, 0x15, 0x02, 0x04, 0x08, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x08, 0x04, 0x02, 0x9D, 0x15, 0x02, 0x04,
+  0x08, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x00, 0x08, 0x04, 0x02, 0xFF, 0xCD, 0x1A, 0x38, 0x7C, 0xFE, 0xE6, 0xC2, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC2, 0xE6,
+  0x7C, 0x38, 0xFF, 0xFF, 0x9D, 0x0F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xA3, 0x0F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xB7, 0x17, 0x08, 0x04, 0x02, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02,
+  0x04, 0x08, 0x9B, 0x17, 0x08, 0x04, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x04, 0x08, 0xB7, 0x0F, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xA3, 0x0F,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0xAD, 0x04, 0x0E, 0x1F, 0x1F, 0x1F, 0x0E, 0xD6, 0x04, 0x0E, 0x1F, 0x1F, 0x1F, 0x0E, 0xBF, 0x03,
+  0x30, 0xFC, 0xC4, 0x82, 0x96, 0x03, 0x82, 0xC4, 0xFC, 0x30, 0xE3, 0x18, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0x99, 0x17, 0x10, 0x00, 0x04, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04,
+  0x00, 0x10, 0x9B, 0x17, 0x10, 0x00, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x00, 0x10, 0xAA, 0x02, 0x80, 0x80,
+  0x80, 0x86, 0x00, 0x02, 0x93, 0x00, 0x02, 0x9D, 0x00, 0x02, 0x93, 0x00, 0x02, 0x87, 0x02, 0x80,
+  0x80, 0x80, 0x9E, 0x06, 0x0E, 0x11, 0x20, 0x20, 0x20, 0x11, 0x0E, 0xD4, 0x06, 0x0E, 0x11, 0x20,
+  0x20, 0x20, 0x11, 0x0E, 0xBD, 0x03, 0x30, 0xCC, 0x00, 0x02, 0x98, 0x03, 0x02, 0x00, 0xCC, 0x30,
+  0xE1, 0x00, 0x01, 0x98, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x99, 0x17, 0x20, 0x08, 0x08, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x08, 0x08, 0x20, 0x9B, 0x17, 0x20, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x08, 0x20, 0xA8, 0x06, 0x80,
+  0x80, 0x40, 0x40, 0x40, 0x80, 0x80, 0xD4, 0x06, 0x80, 0x80, 0x40, 0x40, 0x40, 0x80, 0x80, 0x9B,
+  0x08, 0x0E, 0x31, 0x20, 0x40, 0x40, 0x40, 0x20, 0x31, 0x0E, 0xD2, 0x08, 0x0E, 0x31, 0x20, 0x40,
+  0x40, 0x40, 0x20, 0x31, 0x0E, 0xBB, 0x03, 0x70, 0xCC, 0x00, 0x02, 0x9C, 0x00, 0x40, 0xDE, 0x1F,
+  0x01, 0x01, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x8D, 0x08, 0x80, 0x40, 0x60, 0x20, 0x20, 0x20, 0x60, 0x40, 0x80, 0xD2,
+  0x08, 0x80, 0x40, 0x60, 0x20, 0x20, 0x20, 0x60, 0x40, 0x80, 0x99, 0x0A, 0x1F, 0x31, 0x40, 0xC0,
+  0x80, 0x80, 0x80, 0xC0, 0x40, 0x31, 0x1F, 0xD0, 0x0A, 0x1F, 0x31, 0x40, 0xC0, 0x80, 0x80, 0x80,
+  0xC0, 0x40, 0x31, 0x1F, 0xFF, 0x8B, 0x04, 0x80, 0xC0, 0xC0, 0xC0, 0x80, 0xDE, 0x04, 0x80, 0xC0,
+  0xC0, 0xC0, 0x80, 0x96, 0x04, 0x03, 0x07, 0x07, 0x07, 0x03, 0xDE, 0x04, 0x03, 0x07, 0x07, 0x07,
+  0x03, 0xFF, 0x8B, 0x04, 0x80, 0xC0, 0xC0, 0xC0, 0x80, 0xDE, 0x04, 0x80, 0xC0, 0xC0, 0xC0, 0x80,
+  0x96, 0x04, 0x03, 0x07, 0x07, 0x07, 0x03, 0xDE, 0x04, 0x03, 0x07, 0x07, 0x07, 0x03, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x8D, 0x08, 0x80, 0x40, 0x60, 0x20, 0x20, 0x20, 0x60, 0x40, 0x80, 0xD2, 0x08, 0x80,
+  0x40, 0x60, 0x20, 0x20, 0x20, 0x60, 0x40, 0x80, 0x99, 0x0A, 0x1F, 0x31, 0x40, 0xC0, 0x80, 0x80,
+  0x80, 0xC0, 0x40, 0x31, 0x1F, 0xD0, 0x0A, 0x1F, 0x31, 0x40, 0xC0, 0x80, 0x80, 0x80, 0xC0, 0x40,
+  0x31, 0x1F, 0xFF, 0x8B, 0x04, 0x80, 0xC0, 0xC0, 0xC0, 0x80, 0xDE, 0x04, 0x80, 0xC0, 0xC0, 0xC0,
+  0x80, 0x96, 0x04, 0x03, 0x07, 0x07, 0x07, 0x03, 0xDE, 0x04, 0x03, 0x07, 0x07, 0x07, 0x03, 0xFF,
+  0x8B, 0x04, 0x80, 0xC0, 0xC0, 0xC0, 0x80, 0xDE, 0x04, 0x80, 0xC0, 0xC0, 0xC0, 0x80, 0x96, 0x04,
+  0x03, 0x07, 0x07, 0x07, 0x03, 0xDE, 0x04, 0x03, 0x07, 0x07, 0x07, 0x03, 0xFF, 0x98, 0x08, 0x80,
+  0x40, 0x60, 0x20, 0x20, 0x20, 0x60, 0x40, 0x80, 0xD2, 0x08, 0x80, 0x40, 0x60, 0x20, 0x20, 0x20,
+  0x60, 0x40, 0x80, 0x99, 0x0A, 0x1F, 0x31, 0x40, 0xC0, 0x80, 0x80, 0x80, 0xC0, 0x40, 0x31, 0x1F,
+  0xD0, 0x0A, 0x1F, 0x31, 0x40, 0xC0, 0x80, 0x80, 0x80, 0xC0, 0x40, 0x31, 0x1F, 0xFF, 0x8B, 0x04,
+  0x80, 0xC0, 0xC0, 0xC0, 0x80, 0xDE, 0x04, 0x80, 0xC0, 0xC0, 0xC0, 0x80, 0x96, 0x04, 0x03, 0x07,
+  0x07, 0x07, 0x03, 0xDE, 0x04, 0x03, 0x07, 0x07, 0x07, 0x03, 0xFF, 0x98, 0x08, 0x80, 0x40, 0x60,
+  0x20, 0x20, 0x20, 0x60, 0x40, 0x80, 0xD2, 0x08, 0x80, 0x40, 0x60, 0x20, 0x20, 0x20, 0x60, 0x40,
+  0x80, 0x99, 0x0A, 0x1F, 0x31, 0x40, 0xC0, 0x80, 0x80, 0x80, 0xC0, 0x40, 0x31, 0x1F, 0xD0, 0x0A,
+  0x1F, 0x31, 0x40, 0xC0, 0x80, 0x80, 0x80, 0xC0, 0x40, 0x31, 0x1F, 0xFF, 0x8B, 0x04, 0x80, 0xC0,
+  0xC0, 0xC0, 0x80, 0xDE, 0x04, 0x80, 0xC0, 0xC0, 0xC0, 0x80, 0x96, 0x04, 0x03, 0x07, 0x07, 0x07,
+  0x03, 0xDE, 0x04, 0x03, 0x07, 0x07, 0x07, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x8D, 0x08, 0x80, 0x40,
+  0x60, 0x20, 0x20, 0x20, 0x60, 0x40, 0x80, 0xD2, 0x08, 0x80, 0x40, 0x60, 0x20, 0x20, 0x20, 0x60,
+  0x40, 0x80, 0x99, 0x0A, 0x1F, 0x31, 0x40, 0xC0, 0x80, 0x80, 0x80, 0xC0, 0x40, 0x31, 0x1F, 0xD0,
+  0x0A, 0x1F, 0x31, 0x40, 0xC0, 0x80, 0x80, 0x80, 0xC0, 0x40, 0x31, 0x1F, 0xFF, 0x8B, 0x04, 0x80,
+  0xC0, 0xC0, 0xC0, 0x80, 0xDE, 0x04, 0x80, 0xC0, 0xC0, 0xC0, 0x80, 0x96, 0x04, 0x03, 0x07, 0x07,
+  0x07, 0x03, 0xDE, 0x04, 0x03, 0x07, 0x07, 0x07, 0x03, 0xFF, 0x8B, 0x04, 0x80, 0xC0, 0xC0, 0xC0,
+  0x80, 0xDE, 0x04, 0x80, 0xC0, 0xC0, 0xC0, 0x80, 0x96, 0x04, 0x03, 0x07, 0x07, 0x07, 0x03, 0xDE,
+  0x04, 0x03, 0x07, 0x07, 0x07, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x8D, 0x08, 0x80, 0x40, 0x60, 0x20,
+  0x20, 0x20, 0x60, 0x40, 0x80, 0xD2, 0x08, 0x80, 0x40, 0x60, 0x20, 0x20, 0x20, 0x60, 0x40, 0x80,
+  0x99, 0x0A, 0x1F, 0x31, 0x40, 0xC0, 0x80, 0x80, 0x80, 0xC0, 0x40, 0x31, 0x1F, 0xD0, 0x0A, 0x1F,
+  0x31, 0x40, 0xC0, 0x80, 0x80, 0x80, 0xC0, 0x40, 0x31, 0x1F, 0xFF, 0xFF, 0xFF, 0x99, 0x17, 0xF0,
+  0x0C, 0x0C, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+  0x06, 0x06, 0x06, 0x06, 0x0C, 0x0C, 0xF0, 0x9B, 0x17, 0xF0, 0x0C, 0x0C, 0x06, 0x06, 0x06, 0x06,
+  0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0C, 0x0C,
+  0xF0, 0xA7, 0x08, 0x80, 0x60, 0x60, 0x30, 0x30, 0x30, 0x60, 0x60, 0x80, 0x83, 0x15, 0x03, 0x03,
+  0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+  0x06, 0x06, 0x03, 0x03, 0x9D, 0x15, 0x03, 0x03, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+  0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x03, 0x03, 0x84, 0x08, 0x80, 0x60,
+  0x60, 0x30, 0x30, 0x30, 0x60, 0x60, 0x80, 0x9A, 0x08, 0x0D, 0x30, 0x30, 0x60, 0x60, 0x60, 0x30,
+  0x30, 0x0D, 0x9A, 0x1B, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x9B, 0x08, 0x0D, 0x30, 0x30, 0x60, 0x60, 0x60, 0x30, 0x30, 0x0D, 0xBB, 0x21, 0x6C, 0x83, 0x83,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x83, 0x6C, 0xDE,
+  0x1F, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x01,
+  0x01, 0xFF, 0xFF, 0xFF, 0x99, 0x17, 0xF0, 0x0C, 0x0C, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+  0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0C, 0x0C, 0xF0, 0x9B, 0x17,
+  0xF0, 0x0C, 0x0C, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+  0x06, 0x06, 0x06, 0x06, 0x06, 0x0C, 0x0C, 0xF0, 0xA7, 0x08, 0x80, 0x60, 0x60, 0x30, 0x30, 0x30,
+  0x60, 0x60, 0x80, 0x83, 0x15, 0x03, 0x03, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+  0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x03, 0x03, 0x9D, 0x15, 0x03, 0x03, 0x06,
+  0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+  0x06, 0x03, 0x03, 0x84, 0x08, 0x80, 0x60, 0x60, 0x30, 0x30, 0x30, 0x60, 0x60, 0x80, 0x9A, 0x08,
+  0x0D, 0x30, 0x30, 0x60, 0x60, 0x60, 0x30, 0x30, 0x0D, 0x9A, 0x1B, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x9B, 0x08, 0x0D, 0x30, 0x30, 0x60, 0x60, 0x60, 0x30,
+  0x30, 0x0D, 0xBB, 0x21, 0x6C, 0x83, 0x83, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x83, 0x83, 0x6C, 0xDE, 0x1F, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x8E, 0x06, 0x80, 0x80,
+  0x40, 0x40, 0x40, 0x80, 0x80, 0xD4, 0x06, 0x80, 0x80, 0x40, 0x40, 0x40, 0x80, 0x80, 0x9B, 0x08,
+  0x0E, 0x31, 0x20, 0x40, 0x40, 0x40, 0x20, 0x31, 0x0E, 0xD2, 0x08, 0x0E, 0x31, 0x20, 0x40, 0x40,
+  0x40, 0x20, 0x31, 0x0E, 0xBB, 0x21, 0x10, 0x0C, 0x04, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+  0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+  0x06, 0x06, 0x06, 0x06, 0x06, 0x04, 0x0C, 0x10, 0xDE, 0x1F, 0x01, 0x00, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xAE, 0x02, 0x60, 0x90, 0x08, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x99, 0x17, 0x20, 0x00, 0x08,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x08, 0x00, 0x20, 0x9B, 0x17, 0x20, 0x00, 0x08, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x00, 0x20, 0xB3,
+  0x17, 0x01, 0x00, 0x04, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x04, 0x00, 0x01, 0x9B, 0x17, 0x01, 0x00, 0x04, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x04, 0x00, 0x01, 0xFF, 0xC9, 0x03, 0x60, 0xF0, 0x98, 0x08, 0x98, 0x03, 0x08, 0x98, 0xF0, 0x60,
+  0xE0, 0x01, 0x01, 0x01, 0x98, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0x99, 0x17, 0x10, 0x08, 0x04,
+  0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x02, 0x04, 0x08, 0x10, 0x9B, 0x17, 0x10, 0x08, 0x04, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x04, 0x08, 0x10, 0xB7,
+  0x0F, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0xA3, 0x0F, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0xFF, 0xCF, 0x03, 0x60, 0xF0, 0x98, 0x08, 0x93, 0x04, 0x08, 0x98, 0xF8, 0xF0,
+  0x60, 0xE4, 0x01, 0x01, 0x01, 0x93, 0x02, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0x9E, 0x0D, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xA5, 0x0D, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xB9, 0x02, 0x04, 0x02,
+  0x01, 0x8F, 0x02, 0x01, 0x02, 0x04, 0x9D, 0x02, 0x04, 0x02, 0x01, 0x8F, 0x02, 0x01, 0x02, 0x04,
+  0xB5, 0x15, 0x04, 0x08, 0x10, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x00, 0x10, 0x08, 0x04, 0x9D, 0x15, 0x04, 0x08, 0x10, 0x00, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x10, 0x08, 0x04,
+  0xFF, 0xCE, 0x03, 0x60, 0xF0, 0x98, 0x08, 0x8F, 0x03, 0x08, 0x98, 0xF0, 0x60, 0xE9, 0x01, 0x01,
+  0x01, 0x8F, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0x9B, 0x13, 0x80, 0xC0, 0xC0, 0x60, 0x60, 0x60, 0x60,
+  0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xC0, 0xC0, 0x80, 0x9F, 0x13, 0x80,
+  0xC0, 0xC0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+  0xC0, 0xC0, 0x80, 0xB5, 0x02, 0x0C, 0x03, 0x01, 0x91, 0x02, 0x01, 0x03, 0x0C, 0x9B, 0x02, 0x0C,
+  0x03, 0x01, 0x91, 0x02, 0x01, 0x03, 0x0C, 0xB3, 0x17, 0x01, 0x04, 0x08, 0x10, 0x10, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10, 0x10, 0x08, 0x04,
+  0x01, 0x9B, 0x17, 0x01, 0x04, 0x08, 0x10, 0x10, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10, 0x10, 0x08, 0x04, 0x01, 0xFF, 0xCF, 0x02, 0x60, 0x90,
+  0x08, 0x8D, 0x02, 0x08, 0x90, 0x60, 0xED, 0x00, 0x01, 0x8D, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x90, 0x02, 0x80, 0x80, 0x80, 0xD8, 0x02, 0x80, 0x80, 0x80, 0x9E, 0x06, 0x0E, 0x11, 0x20, 0x20,
+  0x20, 0x11, 0x0E, 0xD4, 0x06, 0x0E, 0x11, 0x20, 0x20, 0x20, 0x11, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x99, 0x17, 0x01, 0x04, 0x08, 0x10, 0x10, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x10, 0x10, 0x08, 0x04, 0x01, 0x9B, 0x17, 0x01, 0x04, 0x08, 0x10,
+  0x10, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10,
+  0x10, 0x08, 0x04, 0x01, 0xFF, 0xFF, 0x9A, 0x15, 0x80, 0x40, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x20, 0x20, 0x40, 0x80, 0x9D, 0x15,
+  0x80, 0x40, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x20, 0x20, 0x40, 0x80, 0xB4, 0x00, 0x02, 0x95, 0x00, 0x02, 0x9B, 0x00, 0x02, 0x95,
+  0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x99, 0x17, 0x02, 0x08, 0x10, 0x20, 0x20, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x20, 0x20, 0x10, 0x08, 0x02,
+  0x9B, 0x17, 0x02, 0x08, 0x10, 0x20, 0x20, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x20, 0x20, 0x10, 0x08, 0x02, 0xFF, 0xD0, 0x02, 0x60, 0x90, 0x08,
+  0xFE, 0x00, 0x01, 0xFF, 0xFF, 0x9A, 0x15, 0x40, 0x20, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x10, 0x20, 0x40, 0x9D, 0x15, 0x40,
+  0x20, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x10, 0x10, 0x20, 0x40, 0xB4, 0x00, 0x01, 0x95, 0x00, 0x01, 0x9B, 0x00, 0x01, 0x95, 0x00,
+  0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x99, 0x17, 0x04, 0x10, 0x20, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x20, 0x10, 0x04, 0x9B,
+  0x17, 0x04, 0x10, 0x20, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x20, 0x10, 0x04, 0xFF, 0xFF, 0x99, 0x17, 0xC0, 0x30, 0x18,
+  0x0C, 0x0C, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+  0x0C, 0x0C, 0x18, 0x30, 0xC0, 0x9B, 0x17, 0xC0, 0x30, 0x18, 0x0C, 0x0C, 0x06, 0x06, 0x06, 0x06,
+  0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0C, 0x0C, 0x18, 0x30, 0xC0, 0xFF,
+  0xB3, 0x17, 0x04, 0x10, 0x20, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x20, 0x10, 0x04, 0x9B, 0x17, 0x04, 0x10, 0x20, 0x40,
+  0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40,
+  0x40, 0x20, 0x10, 0x04, 0xFF, 0xDF, 0x02, 0x08, 0x90, 0x60, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0x99,
+  0x17, 0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE,
+  0xFE, 0xFE, 0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0xF0, 0xC0, 0x9B, 0x17, 0xC0, 0xF0, 0xF8, 0xFC, 0xFC,
+  0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFC, 0xFC,
+  0xF8, 0xF0, 0xC0, 0xB3, 0x17, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9B, 0x17, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x17, 0x03, 0x0F, 0x1F, 0x3F, 0x3F, 0x7F, 0x7F,
+  0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x3F, 0x1F, 0x0F,
+  0x03, 0x9B, 0x17, 0x03, 0x0F, 0x1F, 0x3F, 0x3F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
+  0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x3F, 0x1F, 0x0F, 0x03, 0xD6, 0x06, 0x80, 0x80, 0x40,
+  0x40, 0x40, 0x80, 0x80, 0xF7, 0x08, 0x0E, 0x31, 0x20, 0x40, 0x40, 0x40, 0x20, 0x31, 0x0E, 0xFF,
+  0xFF, 0x99, 0x17, 0x40, 0x10, 0x08, 0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x04, 0x08, 0x10, 0x40, 0x9B, 0x17, 0x40, 0x10, 0x08,
+  0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x04, 0x04, 0x08, 0x10, 0x40, 0xFF, 0xFF, 0x99, 0x17, 0x80, 0x20, 0x10, 0x08, 0x08, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x08, 0x10, 0x20,
+  0x80, 0x9B, 0x17, 0x80, 0x20, 0x10, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x08, 0x10, 0x20, 0x80, 0xFF, 0xB3, 0x17, 0x02, 0x08,
+  0x10, 0x20, 0x20, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x20, 0x20, 0x10, 0x08, 0x02, 0x9B, 0x17, 0x02, 0x08, 0x10, 0x20, 0x20, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x20, 0x20, 0x10, 0x08, 0x02,
+  0xFF, 0xFF, 0x9A, 0x15, 0xC0, 0x60, 0x30, 0x30, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x30, 0x30, 0x60, 0xC0, 0x9D, 0x15, 0xC0, 0x60, 0x30, 0x30,
+  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x30, 0x30,
+  0x60, 0xC0, 0xB4, 0x00, 0x03, 0x95, 0x00, 0x03, 0x9B, 0x00, 0x03, 0x95, 0x00, 0x03, 0xB3, 0x17,
+  0x01, 0x04, 0x08, 0x10, 0x10, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x10, 0x10, 0x08, 0x04, 0x01, 0x9B, 0x17, 0x01, 0x04, 0x08, 0x10, 0x10, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10, 0x10, 0x08,
+  0x04, 0x01, 0xFF, 0xFF, 0x9B, 0x13, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x9F, 0x13, 0x80, 0xC0, 0xC0, 0xE0,
+  0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80,
+  0xB5, 0x03, 0x0C, 0x07, 0x03, 0x01, 0x8F, 0x03, 0x01, 0x03, 0x07, 0x0C, 0x9B, 0x03, 0x0C, 0x07,
+  0x03, 0x01, 0x8F, 0x03, 0x01, 0x03, 0x07, 0x0C, 0xB3, 0x00, 0x01, 0x82, 0x00, 0x10, 0x8D, 0x00,
+  0x10, 0x82, 0x00, 0x01, 0x9B, 0x00, 0x01, 0x82, 0x00, 0x10, 0x8D, 0x00, 0x10, 0x82, 0x00, 0x01,
+  0xD5, 0x08, 0x80, 0xC0, 0xA0, 0x60, 0x60, 0x60, 0xA0, 0xC0, 0x80, 0xF5, 0x0A, 0x1F, 0x2E, 0x71,
+  0xA0, 0xC0, 0xC0, 0xC0, 0xA0, 0x71, 0x2E, 0x1F, 0xFF, 0xFF, 0xFF, 0x9D, 0x0F, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xA3, 0x0F, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xB7,
+  0x17, 0x01, 0x02, 0x04, 0x08, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+  0x18, 0x18, 0x18, 0x18, 0x18, 0x08, 0x04, 0x02, 0x01, 0x9B, 0x17, 0x01, 0x02, 0x04, 0x08, 0x18,
+  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x08,
+  0x04, 0x02, 0x01, 0xD4, 0x0A, 0x80, 0xC0, 0x60, 0x30, 0x30, 0x30, 0x30, 0x30, 0x60, 0xC0, 0x80,
+  0xF3, 0x0C, 0x1F, 0x3F, 0x60, 0xC0, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC0, 0x60, 0x3F, 0x1F, 0xF6,
+  0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0x99, 0x17, 0x30, 0x18, 0x0C, 0x0E, 0x0E,
+  0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E,
+  0x0C, 0x18, 0x30, 0x9B, 0x17, 0x30, 0x18, 0x0C, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E,
+  0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0C, 0x18, 0x30, 0xB3, 0x02, 0x01,
+  0x02, 0x04, 0x91, 0x02, 0x04, 0x02, 0x01, 0x9B, 0x02, 0x01, 0x02, 0x04, 0x91, 0x02, 0x04, 0x02,
+  0x01, 0xFF, 0xFF, 0xFF, 0x9B, 0x13, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x9F, 0x13, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0xB7, 0x13, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x9F, 0x13, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0xD6, 0x0A, 0x80, 0x40,
+  0xA0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xA0, 0x40, 0x80, 0xF3, 0x0C, 0x63, 0xDE, 0xBF, 0x7F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xBF, 0xDE, 0x63, 0xF4, 0x08, 0x01, 0x03, 0x06, 0x06, 0x06, 0x06,
+  0x06, 0x03, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x99, 0x17, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x01, 0x9B, 0x17, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0xFF, 0xFF, 0xFF, 0x99, 0x17,
+  0xC0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+  0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xC0, 0x9B, 0x17, 0xC0, 0x60, 0x60, 0x60, 0x60, 0x60,
+  0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+  0x60, 0xC0, 0xB3, 0x17, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x9B, 0x17, 0x01, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0xD4, 0x0A, 0x80, 0xC0, 0x40, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x40, 0xC0, 0x80, 0xF2, 0x02, 0x7C, 0x83, 0x01, 0x88, 0x02, 0x01, 0x83, 0x7C, 0xF1, 0x0C, 0x01,
+  0x03, 0x06, 0x04, 0x08, 0x08, 0x08, 0x08, 0x08, 0x04, 0x06, 0x03, 0x01, 0xFF, 0xFF, 0xDF, 0x04,
+  0x40, 0x40, 0x40, 0xC0, 0x40, 0xFA, 0x04, 0x04, 0x06, 0x05, 0x04, 0x04, 0xB4, 0x17, 0x01, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x9B, 0x17, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01,
+  0xFF, 0xFF, 0xDF, 0x05, 0x40, 0x60, 0x60, 0x60, 0x20, 0x20, 0xF9, 0x05, 0x04, 0x04, 0x06, 0x06,
+  0x06, 0x02, 0xFF, 0xFF, 0xE0, 0x05, 0x20, 0x00, 0x80, 0xC0, 0x40, 0x20, 0xF9, 0x02, 0x02, 0x01,
+  0x01, 0x81, 0x00, 0x02, 0xFF, 0xFF, 0xE1, 0x04, 0x30, 0xB0, 0xF0, 0x50, 0x30, 0xFA, 0x04, 0x03,
+  0x02, 0x03, 0x03, 0x03, 0xFF, 0xFF, 0xE1, 0x05, 0x10, 0x18, 0x98, 0x98, 0x88, 0x88, 0xF9, 0x04,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0xE2, 0x05, 0x88, 0x40, 0x60, 0x30, 0x10, 0x88, 0xFF,
+  0xFF, 0xE3, 0x05, 0x88, 0x8C, 0xCC, 0xCC, 0xC4, 0x44, 0xFF, 0xFF, 0xE4, 0x04, 0x66, 0x56, 0x7E,
+  0x6A, 0x66, 0xFF, 0xFF, 0xE4, 0x05, 0x22, 0x10, 0x18, 0x0C, 0x04, 0x22, 0xFF, 0xFF, 0xDF, 0x0B,
+  0x40, 0x40, 0x40, 0xC0, 0x40, 0x00, 0x22, 0x23, 0x33, 0x33, 0x31, 0x11, 0xF3, 0x04, 0x04, 0x06,
+  0x05, 0x04, 0x04, 0xFF, 0xE6, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFA, 0x04, 0x19, 0x15, 0x1F,
+  0x1A, 0x19, 0xFF, 0xE6, 0x00, 0x80, 0x83, 0x00, 0x80, 0xF2, 0x0C, 0x40, 0x60, 0x60, 0x60, 0x20,
+  0x20, 0x00, 0x08, 0x04, 0x06, 0x03, 0x01, 0x08, 0xF2, 0x05, 0x04, 0x04, 0x06, 0x06, 0x06, 0x02,
+  0xFF, 0xE7, 0x05, 0x80, 0xC0, 0xC0, 0xC0, 0x40, 0x40, 0xF2, 0x0C, 0x20, 0x00, 0x80, 0xC0, 0x40,
+  0x20, 0x00, 0x08, 0x08, 0x0C, 0x0C, 0x0C, 0x04, 0xF2, 0x02, 0x02, 0x01, 0x01, 0x81, 0x00, 0x02,
+  0xFF, 0xE8, 0x00, 0x40, 0x81, 0x02, 0x80, 0x80, 0x40, 0xF2, 0x04, 0x30, 0xB0, 0xF0, 0x50, 0x30,
+  0x81, 0x05, 0x04, 0x02, 0x03, 0x01, 0x00, 0x04, 0xF2, 0x04, 0x03, 0x02, 0x03, 0x03, 0x03, 0xFF,
+  0xE9, 0x04, 0x60, 0x60, 0xE0, 0xA0, 0x60, 0xF2, 0x05, 0x10, 0x18, 0x98, 0x98, 0x88, 0x88, 0x81,
+  0x04, 0x06, 0x05, 0x07, 0x06, 0x06, 0xF2, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0xFF, 0xE9, 0x05,
+  0x20, 0x30, 0x30, 0x30, 0x10, 0x10, 0xF2, 0x0C, 0x88, 0x40, 0x60, 0x30, 0x10, 0x88, 0x00, 0x02,
+  0x02, 0x03, 0x03, 0x03, 0x01, 0xFF, 0xEA, 0x05, 0x10, 0x80, 0xC0, 0x60, 0x20, 0x10, 0xF2, 0x07,
+  0x88, 0x8C, 0xCC, 0xCC, 0xC4, 0x44, 0x00, 0x01, 0x83, 0x00, 0x01, 0xFF, 0xEB, 0x04, 0x98, 0x58,
+  0xF8, 0xA8, 0x98, 0xF3, 0x04, 0x66, 0x56, 0x7E, 0x6A, 0x66, 0x81, 0x04, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0xFF, 0xEB, 0x05, 0x88, 0x8C, 0xCC, 0xCC, 0xC4, 0x44, 0xF2, 0x05, 0x22, 0x10, 0x18, 0x0C,
+  0x04, 0x22, 0xFF, 0xEC, 0x05, 0x44, 0x20, 0x30, 0x18, 0x08, 0x44, 0xEC, 0x0B, 0x40, 0x40, 0x40,
+  0xC0, 0x40, 0x00, 0x22, 0x23, 0x33, 0x33, 0x31, 0x11, 0xF3, 0x04, 0x04, 0x06, 0x05, 0x04, 0x04,
+  0xFF, 0xE6, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x05, 0x44, 0x46, 0x66, 0x66, 0x62, 0x22,
+  0xF2, 0x04, 0x19, 0x15, 0x1F, 0x1A, 0x19, 0xFF, 0xE6, 0x00, 0x80, 0x83, 0x00, 0x80, 0x81, 0x04,
+  0x33, 0x2B, 0x3F, 0x35, 0x33, 0xEB, 0x0C, 0x40, 0x60, 0x60, 0x60, 0x20, 0x20, 0x00, 0x08, 0x04,
+  0x06, 0x03, 0x01, 0x08, 0xF2, 0x05, 0x04, 0x04, 0x06, 0x06, 0x06, 0x02, 0xFF, 0xE7, 0x0C, 0x80,
+  0xC0, 0xC0, 0xC0, 0x40, 0x40, 0x00, 0x11, 0x08, 0x0C, 0x06, 0x02, 0x11, 0xEB, 0x0C, 0x20, 0x00,
+  0x80, 0xC0, 0x40, 0x20, 0x00, 0x08, 0x08, 0x0C, 0x0C, 0x0C, 0x04, 0xF2, 0x02, 0x02, 0x01, 0x01,
+  0x81, 0x00, 0x02, 0xF0, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF2, 0x00, 0x40, 0x81, 0x09, 0x80,
+  0x80, 0x40, 0x00, 0x11, 0x11, 0x19, 0x19, 0x18, 0x08, 0xEB, 0x04, 0x30, 0xB0, 0xF0, 0x50, 0x30,
+  0x81, 0x05, 0x04, 0x02, 0x03, 0x01, 0x00, 0x04, 0xF2, 0x04, 0x03, 0x02, 0x03, 0x03, 0x03, 0xF0,
+  0x05, 0x80, 0xC0, 0xC0, 0xC0, 0x40, 0x40, 0xF2, 0x04, 0x60, 0x60, 0xE0, 0xA0, 0x60, 0x81, 0x05,
+  0x08, 0x08, 0x0C, 0x0C, 0x0C, 0x04, 0xEA, 0x05, 0x10, 0x18, 0x98, 0x98, 0x88, 0x88, 0x81, 0x04,
+  0x06, 0x05, 0x07, 0x06, 0x06, 0xF2, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0xF1, 0x04, 0x40, 0x40,
+  0x40, 0xC0, 0x40, 0xF2, 0x05, 0x20, 0x30, 0x30, 0x30, 0x10, 0x10, 0x81, 0x04, 0x04, 0x06, 0x05,
+  0x04, 0x04, 0xEB, 0x0C, 0x88, 0x40, 0x60, 0x30, 0x10, 0x88, 0x00, 0x02, 0x02, 0x03, 0x03, 0x03,
+  0x01, 0xFF, 0xEA, 0x05, 0x10, 0x80, 0xC0, 0x60, 0x20, 0x10, 0xF2, 0x07, 0x88, 0x8C, 0xCC, 0xCC,
+  0xC4, 0x44, 0x00, 0x01, 0x83, 0x00, 0x01, 0xFF, 0xEB, 0x04, 0x98, 0x58, 0xF8, 0xA8, 0x98, 0xF3,
+  0x04, 0x66, 0x56, 0x7E, 0x6A, 0x66, 0x81, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0xFF, 0xEB, 0x05,
+  0x88, 0x8C, 0xCC, 0xCC, 0xC4, 0x44, 0xF2, 0x05, 0x22, 0x10, 0x18, 0x0C, 0x04, 0x22, 0xFF, 0xEC,
+  0x05, 0x44, 0x20, 0x30, 0x18, 0x08, 0x44, 0xEC, 0x0B, 0x40, 0x40, 0x40, 0xC0, 0x40, 0x00, 0x22,
+  0x23, 0x33, 0x33, 0x31, 0x11, 0xF3, 0x04, 0x04, 0x06, 0x05, 0x04, 0x04, 0xFF, 0xE6, 0x04, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x81, 0x05, 0x44, 0x46, 0x66, 0x66, 0x62, 0x22, 0xF2, 0x04, 0x19, 0x15,
+  0x1F, 0x1A, 0x19, 0xFF, 0xE6, 0x00, 0x80, 0x83, 0x00, 0x80, 0x81, 0x04, 0x33, 0x2B, 0x3F, 0x35,
+  0x33, 0xEB, 0x0C, 0x40, 0x60, 0x60, 0x60, 0x20, 0x20, 0x00, 0x08, 0x04, 0x06, 0x03, 0x01, 0x08,
+  0xF2, 0x05, 0x04, 0x04, 0x06, 0x06, 0x06, 0x02, 0xFF, 0xE7, 0x0C, 0x80, 0xC0, 0xC0, 0xC0, 0x40,
+  0x40, 0x00, 0x11, 0x08, 0x0C, 0x06, 0x02, 0x11, 0xEB, 0x0C, 0x20, 0x00, 0x80, 0xC0, 0x40, 0x20,
+  0x00, 0x08, 0x08, 0x0C, 0x0C, 0x0C, 0x04, 0xF2, 0x02, 0x02, 0x01, 0x01, 0x81, 0x00, 0x02, 0xF0,
+  0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF2, 0x00, 0x40, 0x81, 0x09, 0x80, 0x80, 0x40, 0x00, 0x11,
+  0x11, 0x19, 0x19, 0x18, 0x08, 0xEB, 0x04, 0x30, 0xB0, 0xF0, 0x50, 0x30, 0x81, 0x05, 0x04, 0x02,
+  0x03, 0x01, 0x00, 0x04, 0xF2, 0x04, 0x03, 0x02, 0x03, 0x03, 0x03, 0xF0, 0x05, 0x80, 0xC0, 0xC0,
+  0xC0, 0x40, 0x40, 0xF2, 0x04, 0x60, 0x60, 0xE0, 0xA0, 0x60, 0x81, 0x05, 0x08, 0x08, 0x0C, 0x0C,
+  0x0C, 0x04, 0xEA, 0x05, 0x10, 0x18, 0x98, 0x98, 0x88, 0x88, 0x81, 0x04, 0x06, 0x05, 0x07, 0x06,
+  0x06, 0xF2, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0xF1, 0x04, 0x40, 0x40, 0x40, 0xC0, 0x40, 0xF2,
+  0x05, 0x20, 0x30, 0x30, 0x30, 0x10, 0x10, 0x81, 0x04, 0x04, 0x06, 0x05, 0x04, 0x04, 0xEB, 0x0C,
+  0x88, 0x40, 0x60, 0x30, 0x10, 0x88, 0x00, 0x02, 0x02, 0x03, 0x03, 0x03, 0x01, 0xFF, 0xEA, 0x05,
+  0x10, 0x80, 0xC0, 0x60, 0x20, 0x10, 0xF2, 0x07, 0x88, 0x8C, 0xCC, 0xCC, 0xC4, 0x44, 0x00, 0x01,
+  0x83, 0x00, 0x01, 0xFF, 0xEB, 0x04, 0x98, 0x58, 0xF8, 0xA8, 0x98, 0xF3, 0x04, 0x66, 0x56, 0x7E,
+  0x6A, 0x66, 0x81, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0xFF, 0xEB, 0x05, 0x88, 0x8C, 0xCC, 0xCC,
+  0xC4, 0x44, 0xF2, 0x05, 0x22, 0x10, 0x18, 0x0C, 0x04, 0x22, 0xFF, 0xEC, 0x04, 0x44, 0x64, 0x54,
+  0x4C, 0x44, 0xF3, 0x04, 0x22, 0x32, 0x2A, 0x26, 0x22, 0xFF, 0xFF, 0xCF, 0x0A, 0x80, 0xC0, 0xC0,
+  0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0xF2, 0x0E, 0x7C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7C, 0xF1, 0x0C, 0x01, 0x03, 0x07, 0x07, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x07, 0x07, 0x03, 0x01, 0xFF, 0xFF, 0xFF, 0x99, 0x17, 0xC0, 0x70, 0x78,
+  0x7C, 0x7C, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7C, 0x7C, 0x78, 0x70, 0xC0, 0x9B, 0x17, 0xC0, 0x70, 0x78, 0x7C, 0x7C, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7C, 0x7C, 0x78, 0x70, 0xC0, 0xB3,
+  0x17, 0x03, 0x0E, 0x1E, 0x3E, 0x3E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x3E, 0x3E, 0x1E, 0x0E, 0x03, 0x9B, 0x17, 0x03, 0x0E, 0x1E, 0x3E, 0x3E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x3E, 0x3E,
+  0x1E, 0x0E, 0x03, 0xFF, 0xFF, 0xFF, 0x99, 0x17, 0x40, 0x30, 0x38, 0x3C, 0x3C, 0x3E, 0x3E, 0x3E,
+  0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3C, 0x3C, 0x38, 0x30, 0x40,
+  0x9B, 0x17, 0x40, 0x30, 0x38, 0x3C, 0x3C, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+  0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3C, 0x3C, 0x38, 0x30, 0x40, 0xB3, 0x17, 0x02, 0x0C, 0x1C, 0x3C,
+  0x3C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x3C,
+  0x3C, 0x1C, 0x0C, 0x02, 0x9B, 0x17, 0x02, 0x0C, 0x1C, 0x3C, 0x3C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
+  0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x3C, 0x3C, 0x1C, 0x0C, 0x02, 0xFF, 0xFF,
+  0x9C, 0x11, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC0, 0xC0, 0x80, 0x80, 0xA1, 0x11, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0xB6, 0x17, 0x78, 0x3E, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3E, 0x78, 0x9B, 0x17, 0x78, 0x3E, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3E, 0x78, 0xB3, 0x17, 0x06, 0x1C,
+  0x3C, 0x7C, 0x7C, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC,
+  0xFC, 0x7C, 0x7C, 0x3C, 0x1C, 0x06, 0x9B, 0x17, 0x06, 0x1C, 0x3C, 0x7C, 0x7C, 0xFC, 0xFC, 0xFC,
+  0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0x7C, 0x7C, 0x3C, 0x1C, 0x06,
+  0xFF, 0xFF, 0x9C, 0x11, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0xA1, 0x11, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0xB6, 0x17, 0x98, 0x0E, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0E, 0x98, 0x9B, 0x17, 0x98, 0x0E, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0E, 0x98, 0xB3, 0x17,
+  0x07, 0x1F, 0x3F, 0x7F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x7F, 0x7F, 0x3F, 0x1F, 0x07, 0x9B, 0x17, 0x07, 0x1F, 0x3F, 0x7F, 0x7F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x7F, 0x3F,
+  0x1F, 0x07, 0xFF, 0xFF, 0x99, 0x17, 0x80, 0xE0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC,
+  0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xF8, 0xF8, 0xF0, 0xE0, 0x80, 0x9B, 0x17,
+  0x80, 0xE0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC,
+  0xFC, 0xFC, 0xFC, 0xF8, 0xF8, 0xF0, 0xE0, 0x80, 0xB3, 0x17, 0x9F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x9F, 0x9B, 0x17, 0x9F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x9F, 0xB3, 0x17, 0x07, 0x1F,
+  0x3F, 0x7F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x7F, 0x7F, 0x3F, 0x1F, 0x07, 0x9B, 0x17, 0x07, 0x1F, 0x3F, 0x7F, 0x7F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x7F, 0x3F, 0x1F, 0x07,
+  0xFF, 0xFF, 0x99, 0x17, 0x80, 0x20, 0x10, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x08, 0x10, 0x20, 0x80, 0x9B, 0x17, 0x80, 0x20,
+  0x10, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x08, 0x08, 0x10, 0x20, 0x80, 0xFF, 0xB3, 0x17, 0x04, 0x10, 0x20, 0x40, 0x40, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x20, 0x10,
+  0x04, 0x9B, 0x17, 0x04, 0x10, 0x20, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x20, 0x10, 0x04, 0xFF, 0xFF, 0x99, 0x17, 0xC0,
+  0x30, 0x18, 0x0C, 0x0C, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+  0x06, 0x06, 0x0C, 0x0C, 0x18, 0x30, 0xC0, 0x9B, 0x17, 0xC0, 0x30, 0x18, 0x0C, 0x0C, 0x06, 0x06,
+  0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0C, 0x0C, 0x18, 0x30,
+  0xC0, 0xFF, 0xFF, 0x99, 0x17, 0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE,
+  0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0xF0, 0xC0, 0x9B, 0x17, 0xC0,
+  0xF0, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE,
+  0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0xF0, 0xC0, 0xB3, 0x17, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC7, 0x83, 0x01, 0x01, 0x01, 0x83, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x9B, 0x17, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0x83, 0x01, 0x01,
+  0x01, 0x83, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x17, 0x03, 0x0F, 0x1F,
+  0x3F, 0x3F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
+  0x3F, 0x3F, 0x1F, 0x0F, 0x03, 0x9B, 0x17, 0x03, 0x0F, 0x1F, 0x3F, 0x3F, 0x7F, 0x7F, 0x7F, 0x7F,
+  0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x3F, 0x1F, 0x0F, 0x03, 0xFF,
+  0xCD, 0x17, 0xE0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC,
+  0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xF8, 0xF0, 0xE0, 0xE7, 0x17, 0x01, 0x03, 0x07, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x07, 0x03, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x99, 0x17, 0x04, 0x10, 0x20, 0x40, 0x40, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x20,
+  0x10, 0x04, 0x9B, 0x17, 0x04, 0x10, 0x20, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x20, 0x10, 0x04, 0xFF, 0xCC, 0x03, 0xE0,
+  0x10, 0x08, 0x04, 0x91, 0x04, 0x04, 0x0C, 0x18, 0xF0, 0xE0, 0xE4, 0x03, 0x01, 0x02, 0x04, 0x08,
+  0x91, 0x04, 0x08, 0x0C, 0x06, 0x03, 0x01, 0xFF, 0x87, 0x04, 0x0E, 0x1F, 0x1F, 0x1F, 0x0E, 0x8F,
+  0x11, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC0, 0x80, 0x80, 0xA1, 0x11, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x90, 0x04, 0x0E, 0x1F, 0x1F, 0x1F, 0x0E, 0xA0, 0x17,
+  0x38, 0x0E, 0x07, 0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x03, 0x03, 0x07, 0x0E, 0x38, 0x9B, 0x17, 0x38, 0x0E, 0x07, 0x03, 0x03, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x07,
+  0x0E, 0x38, 0xBC, 0x06, 0x24, 0x42, 0x81, 0x81, 0x81, 0x42, 0x24, 0xAC, 0x06, 0x24, 0x42, 0x81,
+  0x81, 0x81, 0x42, 0x24, 0xFF, 0xFF, 0xD1, 0x05, 0xE0, 0xF0, 0xF8, 0x1C, 0x0C, 0x04, 0x94, 0x04,
+  0x04, 0x0C, 0x18, 0xF0, 0xE0, 0xDF, 0x05, 0x01, 0x03, 0x07, 0x0E, 0x0C, 0x08, 0x94, 0x04, 0x08,
+  0x0C, 0x06, 0x03, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x99, 0x04, 0x08, 0x20, 0x40, 0x80, 0x80, 0x8D,
+  0x04, 0x80, 0x80, 0x40, 0x20, 0x08, 0x9B, 0x04, 0x08, 0x20, 0x40, 0x80, 0x80, 0x8D, 0x04, 0x80,
+  0x80, 0x40, 0x20, 0x08, 0xB8, 0x0D, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0xA5, 0x0D, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0xCD, 0x03, 0xE0, 0x10, 0x08, 0x04, 0x99, 0x04, 0x04, 0x0C, 0x18, 0xF0,
+  0xE0, 0xDC, 0x03, 0x01, 0x02, 0x04, 0x08, 0x99, 0x04, 0x08, 0x0C, 0x06, 0x03, 0x01, 0xFF, 0x9A,
+  0x15, 0x80, 0xC0, 0x60, 0x60, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x60, 0x60, 0xC0, 0x80, 0x9D, 0x15, 0x80, 0xC0, 0x60, 0x60, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x60, 0x60, 0xC0, 0x80, 0xB4,
+  0x01, 0x06, 0x01, 0x88, 0x02, 0x80, 0x80, 0x80, 0x87, 0x01, 0x01, 0x06, 0x9B, 0x01, 0x06, 0x01,
+  0x88, 0x02, 0x80, 0x80, 0x80, 0x87, 0x01, 0x01, 0x06, 0xBC, 0x06, 0x12, 0x21, 0x40, 0x40, 0x40,
+  0x21, 0x12, 0xAC, 0x06, 0x12, 0x21, 0x40, 0x40, 0x40, 0x21, 0x12, 0xBB, 0x04, 0x08, 0x20, 0x40,
+  0x80, 0x80, 0x8D, 0x04, 0x80, 0x80, 0x40, 0x20, 0x08, 0x9B, 0x04, 0x08, 0x20, 0x40, 0x80, 0x80,
+  0x8D, 0x04, 0x80, 0x80, 0x40, 0x20, 0x08, 0xB8, 0x0D, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xA5, 0x0D, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xCC, 0x03, 0xE0, 0x10, 0x08, 0x04, 0xFB, 0x03, 0x01,
+  0x02, 0x04, 0x08, 0x89, 0x04, 0x80, 0xC0, 0xC0, 0xC0, 0x80, 0xE2, 0x04, 0x80, 0xC0, 0xC0, 0xC0,
+  0x80, 0x90, 0x06, 0x0E, 0x1F, 0x1C, 0x18, 0x09, 0x07, 0x03, 0x8A, 0x17, 0xC0, 0x70, 0x38, 0x1C,
+  0x1C, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x1C,
+  0x1C, 0x38, 0x70, 0xC0, 0x9B, 0x17, 0xC0, 0x70, 0x38, 0x1C, 0x1C, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E,
+  0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x1C, 0x1C, 0x38, 0x70, 0xC0, 0x8B, 0x06,
+  0x03, 0x07, 0x09, 0x18, 0x1C, 0x1F, 0x0E, 0xA0, 0x00, 0x01, 0x87, 0x06, 0xC0, 0xE0, 0x70, 0x70,
+  0x70, 0xE0, 0xC0, 0x86, 0x00, 0x01, 0x9B, 0x00, 0x01, 0x87, 0x06, 0xC0, 0xE0, 0x70, 0x70, 0x70,
+  0xE0, 0xC0, 0x86, 0x00, 0x01, 0xBC, 0x06, 0x0F, 0x1C, 0x38, 0x38, 0x38, 0x1C, 0x0F, 0xAC, 0x06,
+  0x0F, 0x1C, 0x38, 0x38, 0x38, 0x1C, 0x0F, 0xBB, 0x17, 0x07, 0x1C, 0x38, 0x70, 0x70, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x70, 0x70, 0x38, 0x1C,
+  0x07, 0x9B, 0x17, 0x07, 0x1C, 0x38, 0x70, 0x70, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x70, 0x70, 0x38, 0x1C, 0x07, 0xCA, 0x1D, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xDE, 0x23, 0xDC, 0x8E, 0x07,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0x8E,
+  0xDC, 0xDB, 0x23, 0x01, 0x03, 0x07, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E,
+  0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E,
+  0x0E, 0x0E, 0x0E, 0x0E, 0x07, 0x03, 0x01, 0x89, 0x04, 0x80, 0xC0, 0xC0, 0xC0, 0x80, 0xE2, 0x04,
+  0x80, 0xC0, 0xC0, 0xC0, 0x80, 0x90, 0x06, 0xE0, 0xF0, 0xF3, 0xF7, 0xE7, 0x07, 0x03, 0x8A, 0x17,
+  0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0xFC, 0xFC, 0xF8, 0xF0, 0xC0, 0x9B, 0x17, 0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0xFC, 0xFC, 0xF8,
+  0xF0, 0xC0, 0x8B, 0x06, 0x03, 0x07, 0xE7, 0xF7, 0xF3, 0xF0, 0xE0, 0x8F, 0x02, 0x01, 0x01, 0x01,
+  0x8D, 0x02, 0x0F, 0x03, 0x01, 0x85, 0x06, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0, 0xE0, 0xC0, 0x84, 0x02,
+  0x01, 0x03, 0x0F, 0x9B, 0x02, 0x0F, 0x03, 0x01, 0x85, 0x06, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0, 0xE0,
+  0xC0, 0x84, 0x02, 0x01, 0x03, 0x0F, 0x8E, 0x02, 0x01, 0x01, 0x01, 0xAA, 0x06, 0x71, 0xFB, 0xFB,
+  0xFB, 0xFB, 0xFB, 0x71, 0xAC, 0x06, 0x71, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x71, 0xBB, 0x17, 0x3F,
+  0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC, 0x3F, 0x9B, 0x17, 0x3F, 0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC,
+  0x3F, 0xB5, 0x47, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0xC9, 0x23, 0x3C, 0xFE, 0x3F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x3F, 0xFE,
+  0x3C, 0xDB, 0x23, 0x0F, 0x1F, 0x3F, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x3F, 0x1F, 0x0F, 0x89, 0x04, 0x80, 0xC0, 0xC0, 0xC0, 0x80, 0xE2, 0x04,
+  0x80, 0xC0, 0xC0, 0xC0, 0x80, 0x90, 0x06, 0xE0, 0xF0, 0xF3, 0xF7, 0xE7, 0x07, 0x03, 0x8A, 0x17,
+  0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0xFC, 0xFC, 0xF8, 0xF0, 0xC0, 0x9B, 0x17, 0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0xFC, 0xFC, 0xF8,
+  0xF0, 0xC0, 0x8B, 0x06, 0x03, 0x07, 0xE7, 0xF7, 0xF3, 0xF0, 0xE0, 0x8F, 0x02, 0x01, 0x01, 0x01,
+  0x8D, 0x02, 0x0F, 0x03, 0x01, 0x85, 0x06, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0, 0xE0, 0xC0, 0x84, 0x02,
+  0x01, 0x03, 0x0F, 0x9B, 0x02, 0x0F, 0x03, 0x01, 0x85, 0x06, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0, 0xE0,
+  0xC0, 0x84, 0x02, 0x01, 0x03, 0x0F, 0x8E, 0x02, 0x01, 0x01, 0x01, 0xAA, 0x06, 0x71, 0xFB, 0xFB,
+  0xFB, 0xFB, 0xFB, 0x71, 0xAC, 0x06, 0x71, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x71, 0xBB, 0x17, 0x3F,
+  0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC, 0x3F, 0x9B, 0x17, 0x3F, 0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC,
+  0x3F, 0xB5, 0x47, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0xC9, 0x23, 0x3C, 0xFE, 0x3F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x3F, 0xFE,
+  0x3C, 0xDB, 0x23, 0x0F, 0x1F, 0x3F, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x3F, 0x1F, 0x0F, 0x89, 0x04, 0x80, 0xC0, 0xC0, 0xC0, 0x80, 0xE2, 0x04,
+  0x80, 0xC0, 0xC0, 0xC0, 0x80, 0x90, 0x06, 0xE0, 0xF0, 0xF3, 0xF7, 0xE7, 0x07, 0x03, 0x8A, 0x17,
+  0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0xFC, 0xFC, 0xF8, 0xF0, 0xC0, 0x9B, 0x17, 0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0xFC, 0xFC, 0xF8,
+  0xF0, 0xC0, 0x8B, 0x06, 0x03, 0x07, 0xE7, 0xF7, 0xF3, 0xF0, 0xE0, 0x8F, 0x02, 0x01, 0x01, 0x01,
+  0x8D, 0x02, 0x0F, 0x03, 0x01, 0x85, 0x06, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0, 0xE0, 0xC0, 0x84, 0x02,
+  0x01, 0x03, 0x0F, 0x9B, 0x02, 0x0F, 0x03, 0x01, 0x85, 0x06, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0, 0xE0,
+  0xC0, 0x84, 0x02, 0x01, 0x03, 0x0F, 0x8E, 0x02, 0x01, 0x01, 0x01, 0xAA, 0x06, 0x71, 0xFB, 0xFB,
+  0xFB, 0xFB, 0xFB, 0x71, 0xAC, 0x06, 0x71, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x71, 0xBB, 0x17, 0x3F,
+  0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC, 0x3F, 0x9B, 0x17, 0x3F, 0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC,
+  0x3F, 0xB5, 0x47, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0xC9, 0x23, 0x3C, 0xFE, 0x3F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x3F, 0xFE,
+  0x3C, 0xDB, 0x23, 0x0F, 0x1F, 0x3F, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x3F, 0x1F, 0x0F, 0x89, 0x04, 0x80, 0xC0, 0xC0, 0xC0, 0x80, 0xE2, 0x04,
+  0x80, 0xC0, 0xC0, 0xC0, 0x80, 0x90, 0x06, 0xE0, 0xF0, 0xF3, 0xF7, 0xE7, 0x07, 0x03, 0x8A, 0x17,
+  0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0xFC, 0xFC, 0xF8, 0xF0, 0xC0, 0x9B, 0x17, 0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0xFC, 0xFC, 0xF8,
+  0xF0, 0xC0, 0x8B, 0x06, 0x03, 0x07, 0xE7, 0xF7, 0xF3, 0xF0, 0xE0, 0x8F, 0x02, 0x01, 0x01, 0x01,
+  0x8D, 0x02, 0x0F, 0x03, 0x01, 0x85, 0x06, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0, 0xE0, 0xC0, 0x84, 0x02,
+  0x01, 0x03, 0x0F, 0x9B, 0x02, 0x0F, 0x03, 0x01, 0x85, 0x06, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0, 0xE0,
+  0xC0, 0x84, 0x02, 0x01, 0x03, 0x0F, 0x8E, 0x02, 0x01, 0x01, 0x01, 0xAA, 0x06, 0x71, 0xFB, 0xFB,
+  0xFB, 0xFB, 0xFB, 0x71, 0xAC, 0x06, 0x71, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x71, 0xBB, 0x17, 0x3F,
+  0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC, 0x3F, 0x9B, 0x17, 0x3F, 0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC,
+  0x3F, 0xB5, 0x47, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0xC9, 0x23, 0x3C, 0xFE, 0x3F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x3F, 0xFE,
+  0x3C, 0xDB, 0x23, 0x0F, 0x1F, 0x3F, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x3F, 0x1F, 0x0F, 0x89, 0x04, 0x80, 0xC0, 0xC0, 0xC0, 0x80, 0xE2, 0x04,
+  0x80, 0xC0, 0xC0, 0xC0, 0x80, 0x90, 0x06, 0xE0, 0xF0, 0xF3, 0xF7, 0xE7, 0x07, 0x03, 0x8A, 0x17,
+  0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0xFC, 0xFC, 0xF8, 0xF0, 0xC0, 0x9B, 0x17, 0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0xFC, 0xFC, 0xF8,
+  0xF0, 0xC0, 0x8B, 0x06, 0x03, 0x07, 0xE7, 0xF7, 0xF3, 0xF0, 0xE0, 0x8F, 0x02, 0x01, 0x01, 0x01,
+  0x8D, 0x02, 0x0F, 0x03, 0x01, 0x85, 0x06, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0, 0xE0, 0xC0, 0x84, 0x02,
+  0x01, 0x03, 0x0F, 0x9B, 0x02, 0x0F, 0x03, 0x01, 0x85, 0x06, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0, 0xE0,
+  0xC0, 0x84, 0x02, 0x01, 0x03, 0x0F, 0x8E, 0x02, 0x01, 0x01, 0x01, 0xAA, 0x06, 0x71, 0xFB, 0xFB,
+  0xFB, 0xFB, 0xFB, 0x71, 0xAC, 0x06, 0x71, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x71, 0xBB, 0x17, 0x3F,
+  0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC, 0x3F, 0x9B, 0x17, 0x3F, 0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC,
+  0x3F, 0xB5, 0x47, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0xC9, 0x23, 0x3C, 0xFE, 0x3F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x3F, 0xFE,
+  0x3C, 0xDB, 0x23, 0x0F, 0x1F, 0x3F, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x3F, 0x1F, 0x0F, 0x89, 0x04, 0x80, 0xC0, 0xC0, 0xC0, 0x80, 0xE2, 0x04,
+  0x80, 0xC0, 0xC0, 0xC0, 0x80, 0x90, 0x06, 0xE0, 0xF0, 0xF3, 0xF7, 0xE7, 0x07, 0x03, 0x8A, 0x17,
+  0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0xFC, 0xFC, 0xF8, 0xF0, 0xC0, 0x9B, 0x17, 0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0xFC, 0xFC, 0xF8,
+  0xF0, 0xC0, 0x8B, 0x06, 0x03, 0x07, 0xE7, 0xF7, 0xF3, 0xF0, 0xE0, 0x8F, 0x02, 0x01, 0x01, 0x01,
+  0x8D, 0x02, 0x0F, 0x03, 0x01, 0x85, 0x06, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0, 0xE0, 0xC0, 0x84, 0x02,
+  0x01, 0x03, 0x0F, 0x9B, 0x02, 0x0F, 0x03, 0x01, 0x85, 0x06, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0, 0xE0,
+  0xC0, 0x84, 0x02, 0x01, 0x03, 0x0F, 0x8E, 0x02, 0x01, 0x01, 0x01, 0xAA, 0x06, 0x71, 0xFB, 0xFB,
+  0xFB, 0xFB, 0xFB, 0x71, 0xAC, 0x06, 0x71, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x71, 0xBB, 0x17, 0x3F,
+  0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC, 0x3F, 0x9B, 0x17, 0x3F, 0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC,
+  0x3F, 0xB5, 0x47, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0xC9, 0x23, 0x3C, 0xFE, 0x3F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x3F, 0xFE,
+  0x3C, 0xDB, 0x23, 0x0F, 0x1F, 0x3F, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x3F, 0x1F, 0x0F, 0x89, 0x04, 0x80, 0xC0, 0xC0, 0xC0, 0x80, 0xE2, 0x04,
+  0x80, 0xC0, 0xC0, 0xC0, 0x80, 0x90, 0x06, 0xE0, 0xF0, 0xF3, 0xF7, 0xE7, 0x07, 0x03, 0x8A, 0x17,
+  0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0xFC, 0xFC, 0xF8, 0xF0, 0xC0, 0x9B, 0x17, 0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0xFC, 0xFC, 0xF8,
+  0xF0, 0xC0, 0x8B, 0x06, 0x03, 0x07, 0xE7, 0xF7, 0xF3, 0xF0, 0xE0, 0x8F, 0x02, 0x01, 0x01, 0x01,
+  0x8D, 0x02, 0x0F, 0x03, 0x01, 0x85, 0x06, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0, 0xE0, 0xC0, 0x84, 0x02,
+  0x01, 0x03, 0x0F, 0x9B, 0x02, 0x0F, 0x03, 0x01, 0x85, 0x06, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0, 0xE0,
+  0xC0, 0x84, 0x02, 0x01, 0x03, 0x0F, 0x8E, 0x02, 0x01, 0x01, 0x01, 0xAA, 0x06, 0x71, 0xFB, 0xFB,
+  0xFB, 0xFB, 0xFB, 0x71, 0xAC, 0x06, 0x71, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x71, 0xBB, 0x17, 0x3F,
+  0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC, 0x3F, 0x9B, 0x17, 0x3F, 0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC,
+  0x3F, 0xB5, 0x47, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0xC9, 0x23, 0x3C, 0xFE, 0x3F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x3F, 0xFE,
+  0x3C, 0xDB, 0x23, 0x0F, 0x1F, 0x3F, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x3F, 0x1F, 0x0F, 0x89, 0x04, 0x80, 0xC0, 0xC0, 0xC0, 0x80, 0xE2, 0x04,
+  0x80, 0xC0, 0xC0, 0xC0, 0x80, 0x90, 0x06, 0xE0, 0xF0, 0xF3, 0xF7, 0xE7, 0x07, 0x03, 0x8A, 0x17,
+  0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0xFC, 0xFC, 0xF8, 0xF0, 0xC0, 0x9B, 0x17, 0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0xFC, 0xFC, 0xF8,
+  0xF0, 0xC0, 0x8B, 0x06, 0x03, 0x07, 0xE7, 0xF7, 0xF3, 0xF0, 0xE0, 0x8F, 0x02, 0x01, 0x01, 0x01,
+  0x8D, 0x02, 0x0F, 0x03, 0x01, 0x85, 0x06, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0, 0xE0, 0xC0, 0x84, 0x02,
+  0x01, 0x03, 0x0F, 0x9B, 0x02, 0x0F, 0x03, 0x01, 0x85, 0x06, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0, 0xE0,
+  0xC0, 0x84, 0x02, 0x01, 0x03, 0x0F, 0x8E, 0x02, 0x01, 0x01, 0x01, 0xAA, 0x06, 0x71, 0xFB, 0xFB,
+  0xFB, 0xFB, 0xFB, 0x71, 0xAC, 0x06, 0x71, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x71, 0xBB, 0x17, 0x3F,
+  0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC, 0x3F, 0x9B, 0x17, 0x3F, 0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC,
+  0x3F, 0xB5, 0x47, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0xC9, 0x23, 0x3C, 0xFE, 0x3F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x3F, 0xFE,
+  0x3C, 0xDB, 0x23, 0x0F, 0x1F, 0x3F, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x3F, 0x1F, 0x0F, 0x89, 0x04, 0x80, 0xC0, 0xC0, 0xC0, 0x80, 0xE2, 0x04,
+  0x80, 0xC0, 0xC0, 0xC0, 0x80, 0x90, 0x06, 0xE0, 0xF0, 0xF3, 0xF7, 0xE7, 0x07, 0x03, 0x8A, 0x17,
+  0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0xFC, 0xFC, 0xF8, 0xF0, 0xC0, 0x9B, 0x17, 0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0xFC, 0xFC, 0xF8,
+  0xF0, 0xC0, 0x8B, 0x06, 0x03, 0x07, 0xE7, 0xF7, 0xF3, 0xF0, 0xE0, 0x8F, 0x02, 0x01, 0x01, 0x01,
+  0x8D, 0x02, 0x0F, 0x03, 0x01, 0x85, 0x06, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0, 0xE0, 0xC0, 0x84, 0x02,
+  0x01, 0x03, 0x0F, 0x9B, 0x02, 0x0F, 0x03, 0x01, 0x85, 0x06, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0, 0xE0,
+  0xC0, 0x84, 0x02, 0x01, 0x03, 0x0F, 0x8E, 0x02, 0x01, 0x01, 0x01, 0xAA, 0x06, 0x71, 0xFB, 0xFB,
+  0xFB, 0xFB, 0xFB, 0x71, 0xAC, 0x06, 0x71, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x71, 0xBB, 0x17, 0x3F,
+  0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC, 0x3F, 0x9B, 0x17, 0x3F, 0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC,
+  0x3F, 0xB5, 0x47, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0xC9, 0x23, 0x3C, 0xFE, 0x3F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x3F, 0xFE,
+  0x3C, 0xDB, 0x23, 0x0F, 0x1F, 0x3F, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x3F, 0x1F, 0x0F, 0x89, 0x04, 0x80, 0xC0, 0xC0, 0xC0, 0x80, 0xE2, 0x04,
+  0x80, 0xC0, 0xC0, 0xC0, 0x80, 0x90, 0x06, 0xE0, 0xF0, 0xF3, 0xF7, 0xE7, 0x07, 0x03, 0x8A, 0x17,
+  0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0xFC, 0xFC, 0xF8, 0xF0, 0xC0, 0x9B, 0x17, 0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0xFC, 0xFC, 0xF8,
+  0xF0, 0xC0, 0x8B, 0x06, 0x03, 0x07, 0xE7, 0xF7, 0xF3, 0xF0, 0xE0, 0x8F, 0x02, 0x01, 0x01, 0x01,
+  0x8D, 0x02, 0x0F, 0x03, 0x01, 0x85, 0x06, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0, 0xE0, 0xC0, 0x84, 0x02,
+  0x01, 0x03, 0x0F, 0x9B, 0x02, 0x0F, 0x03, 0x01, 0x85, 0x06, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0, 0xE0,
+  0xC0, 0x84, 0x02, 0x01, 0x03, 0x0F, 0x8E, 0x02, 0x01, 0x01, 0x01, 0xAA, 0x06, 0x71, 0xFB, 0xFB,
+  0xFB, 0xFB, 0xFB, 0x71, 0xAC, 0x06, 0x71, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x71, 0xBB, 0x17, 0x3F,
+  0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC, 0x3F, 0x9B, 0x17, 0x3F, 0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC,
+  0x3F, 0xB5, 0x47, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0xC9, 0x23, 0x3C, 0xFE, 0x3F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x3F, 0xFE,
+  0x3C, 0xDB, 0x23, 0x0F, 0x1F, 0x3F, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x3F, 0x1F, 0x0F, 0x89, 0x04, 0x80, 0xC0, 0xC0, 0xC0, 0x80, 0xE2, 0x04,
+  0x80, 0xC0, 0xC0, 0xC0, 0x80, 0x90, 0x06, 0xE0, 0xF0, 0xF3, 0xF7, 0xE7, 0x07, 0x03, 0x8A, 0x17,
+  0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0xFC, 0xFC, 0xF8, 0xF0, 0xC0, 0x9B, 0x17, 0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0xFC, 0xFC, 0xF8,
+  0xF0, 0xC0, 0x8B, 0x06, 0x03, 0x07, 0xE7, 0xF7, 0xF3, 0xF0, 0xE0, 0x8F, 0x02, 0x01, 0x01, 0x01,
+  0x8D, 0x02, 0x0F, 0x03, 0x01, 0x85, 0x06, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0, 0xE0, 0xC0, 0x84, 0x02,
+  0x01, 0x03, 0x0F, 0x9B, 0x02, 0x0F, 0x03, 0x01, 0x85, 0x06, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0, 0xE0,
+  0xC0, 0x84, 0x02, 0x01, 0x03, 0x0F, 0x8E, 0x02, 0x01, 0x01, 0x01, 0xAA, 0x06, 0x71, 0xFB, 0xFB,
+  0xFB, 0xFB, 0xFB, 0x71, 0xAC, 0x06, 0x71, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x71, 0xBB, 0x17, 0x3F,
+  0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC, 0x3F, 0x9B, 0x17, 0x3F, 0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC,
+  0x3F, 0xB5, 0x47, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0xC9, 0x23, 0x3C, 0xFE, 0x3F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x3F, 0xFE,
+  0x3C, 0xDB, 0x23, 0x0F, 0x1F, 0x3F, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x3F, 0x1F, 0x0F, 0x89, 0x04, 0x80, 0xC0, 0xC0, 0xC0, 0x80, 0xE2, 0x04,
+  0x80, 0xC0, 0xC0, 0xC0, 0x80, 0x90, 0x06, 0xE0, 0xF0, 0xF3, 0xF7, 0xE7, 0x07, 0x03, 0x8A, 0x17,
+  0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0xFC, 0xFC, 0xF8, 0xF0, 0xC0, 0x9B, 0x17, 0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0xFC, 0xFC, 0xF8,
+  0xF0, 0xC0, 0x8B, 0x06, 0x03, 0x07, 0xE7, 0xF7, 0xF3, 0xF0, 0xE0, 0x8F, 0x02, 0x01, 0x01, 0x01,
+  0x8D, 0x02, 0x0F, 0x03, 0x01, 0x85, 0x06, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0, 0xE0, 0xC0, 0x84, 0x02,
+  0x01, 0x03, 0x0F, 0x9B, 0x02, 0x0F, 0x03, 0x01, 0x85, 0x06, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0, 0xE0,
+  0xC0, 0x84, 0x02, 0x01, 0x03, 0x0F, 0x8E, 0x02, 0x01, 0x01, 0x01, 0xAA, 0x06, 0x71, 0xFB, 0xFB,
+  0xFB, 0xFB, 0xFB, 0x71, 0xAC, 0x06, 0x71, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x71, 0xBB, 0x17, 0x3F,
+  0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC, 0x3F, 0x9B, 0x17, 0x3F, 0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC,
+  0x3F, 0xB5, 0x47, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0xC9, 0x23, 0x3C, 0xFE, 0x3F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x3F, 0xFE,
+  0x3C, 0xDB, 0x23, 0x0F, 0x1F, 0x3F, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x3F, 0x1F, 0x0F, 0x89, 0x04, 0x80, 0xC0, 0xC0, 0xC0, 0x80, 0xE2, 0x04,
+  0x80, 0xC0, 0xC0, 0xC0, 0x80, 0x90, 0x06, 0xE0, 0xF0, 0xF3, 0xF7, 0xE7, 0x07, 0x03, 0x8A, 0x17,
+  0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0xFC, 0xFC, 0xF8, 0xF0, 0xC0, 0x9B, 0x17, 0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0xFC, 0xFC, 0xF8,
+  0xF0, 0xC0, 0x8B, 0x06, 0x03, 0x07, 0xE7, 0xF7, 0xF3, 0xF0, 0xE0, 0x8F, 0x02, 0x01, 0x01, 0x01,
+  0x8D, 0x02, 0x0F, 0x03, 0x01, 0x85, 0x06, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0, 0xE0, 0xC0, 0x84, 0x02,
+  0x01, 0x03, 0x0F, 0x9B, 0x02, 0x0F, 0x03, 0x01, 0x85, 0x06, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0, 0xE0,
+  0xC0, 0x84, 0x02, 0x01, 0x03, 0x0F, 0x8E, 0x02, 0x01, 0x01, 0x01, 0xAA, 0x06, 0x71, 0xFB, 0xFB,
+  0xFB, 0xFB, 0xFB, 0x71, 0xAC, 0x06, 0x71, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x71, 0xBB, 0x17, 0x3F,
+  0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC, 0x3F, 0x9B, 0x17, 0x3F, 0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC,
+  0x3F, 0xB5, 0x47, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0xC9, 0x23, 0x3C, 0xFE, 0x3F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x3F, 0xFE,
+  0x3C, 0xDB, 0x23, 0x0F, 0x1F, 0x3F, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x3F, 0x1F, 0x0F, 0x89, 0x04, 0x80, 0xC0, 0xC0, 0xC0, 0x80, 0xE2, 0x04,
+  0x80, 0xC0, 0xC0, 0xC0, 0x80, 0x90, 0x06, 0xE0, 0xF0, 0xF3, 0xF7, 0xE7, 0x07, 0x03, 0x8A, 0x17,
+  0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0xFC, 0xFC, 0xF8, 0xF0, 0xC0, 0x9B, 0x17, 0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0xFC, 0xFC, 0xF8,
+  0xF0, 0xC0, 0x8B, 0x06, 0x03, 0x07, 0xE7, 0xF7, 0xF3, 0xF0, 0xE0, 0x8F, 0x02, 0x01, 0x01, 0x01,
+  0x8D, 0x02, 0x0F, 0x03, 0x01, 0x85, 0x06, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0, 0xE0, 0xC0, 0x84, 0x02,
+  0x01, 0x03, 0x0F, 0x9B, 0x02, 0x0F, 0x03, 0x01, 0x85, 0x06, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0, 0xE0,
+  0xC0, 0x84, 0x02, 0x01, 0x03, 0x0F, 0x8E, 0x02, 0x01, 0x01, 0x01, 0xAA, 0x06, 0x71, 0xFB, 0xFB,
+  0xFB, 0xFB, 0xFB, 0x71, 0xAC, 0x06, 0x71, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x71, 0xBB, 0x17, 0x3F,
+  0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC, 0x3F, 0x9B, 0x17, 0x3F, 0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC,
+  0x3F, 0xB5, 0x47, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0xC9, 0x23, 0x3C, 0xFE, 0x3F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x3F, 0xFE,
+  0x3C, 0xDB, 0x23, 0x0F, 0x1F, 0x3F, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x3F, 0x1F, 0x0F, 0x89, 0x04, 0x80, 0xC0, 0xC0, 0xC0, 0x80, 0xE2, 0x04,
+  0x80, 0xC0, 0xC0, 0xC0, 0x80, 0x90, 0x06, 0xE0, 0xF0, 0xF3, 0xF7, 0xE7, 0x07, 0x03, 0x8A, 0x17,
+  0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0xFC, 0xFC, 0xF8, 0xF0, 0xC0, 0x9B, 0x17, 0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0xFC, 0xFC, 0xF8,
+  0xF0, 0xC0, 0x8B, 0x06, 0x03, 0x07, 0xE7, 0xF7, 0xF3, 0xF0, 0xE0, 0x8F, 0x02, 0x01, 0x01, 0x01,
+  0x8D, 0x02, 0x0F, 0x03, 0x01, 0x85, 0x06, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0, 0xE0, 0xC0, 0x84, 0x02,
+  0x01, 0x03, 0x0F, 0x9B, 0x02, 0x0F, 0x03, 0x01, 0x85, 0x06, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0, 0xE0,
+  0xC0, 0x84, 0x02, 0x01, 0x03, 0x0F, 0x8E, 0x02, 0x01, 0x01, 0x01, 0xAA, 0x06, 0x71, 0xFB, 0xFB,
+  0xFB, 0xFB, 0xFB, 0x71, 0xAC, 0x06, 0x71, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x71, 0xBB, 0x17, 0x3F,
+  0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC, 0x3F, 0x9B, 0x17, 0x3F, 0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC,
+  0x3F, 0xB5, 0x47, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0xC9, 0x23, 0x3C, 0xFE, 0x3F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x3F, 0xFE,
+  0x3C, 0xDB, 0x23, 0x0F, 0x1F, 0x3F, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x3F, 0x1F, 0x0F, 0x89, 0x04, 0x80, 0xC0, 0xC0, 0xC0, 0x80, 0xE2, 0x04,
+  0x80, 0xC0, 0xC0, 0xC0, 0x80, 0x90, 0x06, 0xE0, 0xF0, 0xF3, 0xF7, 0xE7, 0x07, 0x03, 0x8A, 0x17,
+  0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0xFC, 0xFC, 0xF8, 0xF0, 0xC0, 0x9B, 0x17, 0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0xFC, 0xFC, 0xF8,
+  0xF0, 0xC0, 0x8B, 0x06, 0x03, 0x07, 0xE7, 0xF7, 0xF3, 0xF0, 0xE0, 0x8F, 0x02, 0x01, 0x01, 0x01,
+  0x8D, 0x02, 0x0F, 0x03, 0x01, 0x85, 0x06, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0, 0xE0, 0xC0, 0x84, 0x02,
+  0x01, 0x03, 0x0F, 0x9B, 0x02, 0x0F, 0x03, 0x01, 0x85, 0x06, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0, 0xE0,
+  0xC0, 0x84, 0x02, 0x01, 0x03, 0x0F, 0x8E, 0x02, 0x01, 0x01, 0x01, 0xAA, 0x06, 0x71, 0xFB, 0xFB,
+  0xFB, 0xFB, 0xFB, 0x71, 0xAC, 0x06, 0x71, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x71, 0xBB, 0x17, 0x3F,
+  0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC, 0x3F, 0x9B, 0x17, 0x3F, 0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC,
+  0x3F, 0xB5, 0x47, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0xC9, 0x23, 0x3C, 0xFE, 0x3F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x3F, 0xFE,
+  0x3C, 0xDB, 0x23, 0x0F, 0x1F, 0x3F, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x3F, 0x1F, 0x0F, 0x89, 0x04, 0x80, 0xC0, 0xC0, 0xC0, 0x80, 0xE2, 0x04,
+  0x80, 0xC0, 0xC0, 0xC0, 0x80, 0x90, 0x06, 0xE0, 0xF0, 0xF3, 0xF7, 0xE7, 0x07, 0x03, 0x8A, 0x17,
+  0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0xFC, 0xFC, 0xF8, 0xF0, 0xC0, 0x9B, 0x17, 0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0xFC, 0xFC, 0xF8,
+  0xF0, 0xC0, 0x8B, 0x06, 0x03, 0x07, 0xE7, 0xF7, 0xF3, 0xF0, 0xE0, 0x8F, 0x02, 0x01, 0x01, 0x01,
+  0x8D, 0x02, 0x0F, 0x03, 0x01, 0x85, 0x06, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0, 0xE0, 0xC0, 0x84, 0x02,
+  0x01, 0x03, 0x0F, 0x9B, 0x02, 0x0F, 0x03, 0x01, 0x85, 0x06, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0, 0xE0,
+  0xC0, 0x84, 0x02, 0x01, 0x03, 0x0F, 0x8E, 0x02, 0x01, 0x01, 0x01, 0xAA, 0x06, 0x71, 0xFB, 0xFB,
+  0xFB, 0xFB, 0xFB, 0x71, 0xAC, 0x06, 0x71, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x71, 0xBB, 0x17, 0x3F,
+  0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC, 0x3F, 0x9B, 0x17, 0x3F, 0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC,
+  0x3F, 0xB5, 0x47, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0xC9, 0x23, 0x3C, 0xFE, 0x3F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x3F, 0xFE,
+  0x3C, 0xDB, 0x23, 0x0F, 0x1F, 0x3F, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x3F, 0x1F, 0x0F, 0x89, 0x04, 0x80, 0xC0, 0xC0, 0xC0, 0x80, 0xE2, 0x04,
+  0x80, 0xC0, 0xC0, 0xC0, 0x80, 0x90, 0x06, 0xE0, 0xF0, 0xF3, 0xF7, 0xE7, 0x07, 0x03, 0x8A, 0x17,
+  0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0xFC, 0xFC, 0xF8, 0xF0, 0xC0, 0x9B, 0x17, 0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0xFC, 0xFC, 0xF8,
+  0xF0, 0xC0, 0x8B, 0x06, 0x03, 0x07, 0xE7, 0xF7, 0xF3, 0xF0, 0xE0, 0x8F, 0x02, 0x01, 0x01, 0x01,
+  0x8D, 0x02, 0x0F, 0x03, 0x01, 0x85, 0x06, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0, 0xE0, 0xC0, 0x84, 0x02,
+  0x01, 0x03, 0x0F, 0x9B, 0x02, 0x0F, 0x03, 0x01, 0x85, 0x06, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0, 0xE0,
+  0xC0, 0x84, 0x02, 0x01, 0x03, 0x0F, 0x8E, 0x02, 0x01, 0x01, 0x01, 0xAA, 0x06, 0x71, 0xFB, 0xFB,
+  0xFB, 0xFB, 0xFB, 0x71, 0xAC, 0x06, 0x71, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x71, 0xBB, 0x17, 0x3F,
+  0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC, 0x3F, 0x9B, 0x17, 0x3F, 0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC,
+  0x3F, 0xB5, 0x47, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0xC9, 0x23, 0x3C, 0xFE, 0x3F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x3F, 0xFE,
+  0x3C, 0xDB, 0x23, 0x0F, 0x1F, 0x3F, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x3F, 0x1F, 0x0F, 0x89, 0x04, 0x80, 0xC0, 0xC0, 0xC0, 0x80, 0xE2, 0x04,
+  0x80, 0xC0, 0xC0, 0xC0, 0x80, 0x90, 0x06, 0xE0, 0xF0, 0xF3, 0xF7, 0xE7, 0x07, 0x03, 0x8A, 0x17,
+  0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0xFC, 0xFC, 0xF8, 0xF0, 0xC0, 0x9B, 0x17, 0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0xFC, 0xFC, 0xF8,
+  0xF0, 0xC0, 0x8B, 0x06, 0x03, 0x07, 0xE7, 0xF7, 0xF3, 0xF0, 0xE0, 0x8F, 0x02, 0x01, 0x01, 0x01,
+  0x8D, 0x02, 0x0F, 0x03, 0x01, 0x85, 0x06, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0, 0xE0, 0xC0, 0x84, 0x02,
+  0x01, 0x03, 0x0F, 0x9B, 0x02, 0x0F, 0x03, 0x01, 0x85, 0x06, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0, 0xE0,
+  0xC0, 0x84, 0x02, 0x01, 0x03, 0x0F, 0x8E, 0x02, 0x01, 0x01, 0x01, 0xAA, 0x06, 0x71, 0xFB, 0xFB,
+  0xFB, 0xFB, 0xFB, 0x71, 0xAC, 0x06, 0x71, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x71, 0xBB, 0x17, 0x3F,
+  0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC, 0x3F, 0x9B, 0x17, 0x3F, 0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC,
+  0x3F, 0xB5, 0x47, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0xC9, 0x23, 0x3C, 0xFE, 0x3F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x3F, 0xFE,
+  0x3C, 0xDB, 0x23, 0x0F, 0x1F, 0x3F, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x3F, 0x1F, 0x0F, 0xFF, 0x87, 0x04, 0xE0, 0xF0, 0xF0, 0xF0, 0xE0, 0x8C,
+  0x17, 0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0xFC, 0xFC, 0xF8, 0xF0, 0xC0, 0x9B, 0x17, 0xC0, 0xF0, 0xF8, 0xFC, 0xFC,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0xFC, 0xFC,
+  0xF8, 0xF0, 0xC0, 0x8D, 0x04, 0xE0, 0xF0, 0xF0, 0xF0, 0xE0, 0x8F, 0x02, 0x01, 0x01, 0x01, 0x8D,
+  0x02, 0x0F, 0x03, 0x01, 0x85, 0x06, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0, 0xE0, 0xC0, 0x84, 0x02, 0x01,
+  0x03, 0x0F, 0x9B, 0x02, 0x0F, 0x03, 0x01, 0x85, 0x06, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0, 0xE0, 0xC0,
+  0x84, 0x02, 0x01, 0x03, 0x0F, 0x8E, 0x02, 0x01, 0x01, 0x01, 0xAA, 0x06, 0x71, 0xFB, 0xFB, 0xFB,
+  0xFB, 0xFB, 0x71, 0xAC, 0x06, 0x71, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x71, 0xBB, 0x17, 0x3F, 0xFC,
+  0xF8, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xE0, 0xF0, 0xF0, 0xF8, 0xFC, 0x3F, 0x9B, 0x17, 0x3F, 0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xE0, 0xE1, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC, 0x3F,
+  0xB5, 0x47, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0xC9, 0x23, 0x3C, 0xFE, 0x3F, 0x1F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x3F, 0xFE, 0x3C,
+  0xDB, 0x23, 0x0F, 0x1F, 0x3F, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x3F, 0x1F, 0x0F, 0xFF, 0x99, 0x17, 0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0xFC, 0xFC, 0xF8, 0xF0,
+  0xC0, 0x9B, 0x17, 0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0xFC, 0xFC, 0xF8, 0xF0, 0xC0, 0xB3, 0x02, 0x0F, 0x03, 0x01,
+  0x85, 0x06, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0, 0xE0, 0xC0, 0x84, 0x02, 0x01, 0x03, 0x0F, 0x9B, 0x02,
+  0x0F, 0x03, 0x01, 0x85, 0x06, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0, 0xE0, 0xC0, 0x84, 0x02, 0x01, 0x03,
+  0x0F, 0xBC, 0x06, 0x71, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x71, 0xAC, 0x06, 0x71, 0xFB, 0xFB, 0xFB,
+  0xFB, 0xFB, 0x71, 0xBB, 0x17, 0x3F, 0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xE1, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC, 0x3F, 0x9B, 0x17, 0x3F,
+  0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC, 0x3F, 0xB5, 0x47, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0x00, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x01, 0x03, 0x03,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x03,
+  0x01, 0xC9, 0x23, 0x3C, 0xFE, 0x3F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x3F, 0xFE, 0x3C, 0xDB, 0x23, 0x0F, 0x1F, 0x3F, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+  0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x3F, 0x1F, 0x0F, 0xFF, 0x99, 0x17,
+  0x80, 0xE0, 0xF0, 0xF8, 0xF8, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
+  0x7C, 0x7C, 0x7C, 0xF8, 0xF8, 0xF0, 0xE0, 0x80, 0x9B, 0x17, 0x80, 0xE0, 0xF0, 0xF8, 0xF8, 0x7C,
+  0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0xF8, 0xF8, 0xF0,
+  0xE0, 0x80, 0xB3, 0x02, 0x0F, 0x03, 0x01, 0x85, 0x06, 0x80, 0xC0, 0xE0, 0xE0, 0xE0, 0xC0, 0x80,
+  0x84, 0x02, 0x01, 0x03, 0x0F, 0x9B, 0x02, 0x0F, 0x03, 0x01, 0x85, 0x06, 0x80, 0xC0, 0xE0, 0xE0,
+  0xE0, 0xC0, 0x80, 0x84, 0x02, 0x01, 0x03, 0x0F, 0xBC, 0x06, 0x73, 0xFF, 0xF3, 0xF3, 0xF3, 0xFF,
+  0x73, 0xAC, 0x06, 0x73, 0xFF, 0xF3, 0xF3, 0xF3, 0xFF, 0x73, 0xBB, 0x17, 0x3E, 0xF8, 0xF0, 0xE0,
+  0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC1, 0xC1, 0xC1, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0,
+  0xE0, 0xF0, 0xF8, 0x3E, 0x9B, 0x17, 0x3E, 0xF8, 0xF0, 0xE0, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC0, 0xC1, 0xC1, 0xC1, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xE0, 0xF0, 0xF8, 0x3E, 0xB5, 0x13,
+  0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x03, 0x03, 0x01, 0x9F, 0x13, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0xC9, 0x23, 0x78, 0x7C, 0x3E, 0x1F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x3E, 0x7C, 0x78,
+  0xDB, 0x23, 0x0F, 0x1F, 0x3E, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
+  0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
+  0x7C, 0x7C, 0x7C, 0x3E, 0x1F, 0x0F, 0xFF, 0x99, 0x17, 0x80, 0xE0, 0xF0, 0x78, 0x78, 0x3C, 0x3C,
+  0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x78, 0x78, 0xF0, 0xE0,
+  0x80, 0x9B, 0x17, 0x80, 0xE0, 0xF0, 0x78, 0x78, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
+  0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x78, 0x78, 0xF0, 0xE0, 0x80, 0xB3, 0x01, 0x07, 0x01, 0x86,
+  0x06, 0x80, 0xC0, 0xE0, 0xE0, 0xE0, 0xC0, 0x80, 0x85, 0x01, 0x01, 0x07, 0x9B, 0x01, 0x07, 0x01,
+  0x86, 0x06, 0x80, 0xC0, 0xE0, 0xE0, 0xE0, 0xC0, 0x80, 0x85, 0x01, 0x01, 0x07, 0xBC, 0x06, 0x3B,
+  0x7B, 0xF1, 0xF1, 0xF1, 0x7B, 0x3B, 0xAC, 0x06, 0x3B, 0x7B, 0xF1, 0xF1, 0xF1, 0x7B, 0x3B, 0xBB,
+  0x17, 0x1E, 0x78, 0xF0, 0xE0, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xE0, 0xF0, 0x78, 0x1E, 0x9B, 0x17, 0x1E, 0x78, 0xF0, 0xE0, 0xE0,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xE0,
+  0xF0, 0x78, 0x1E, 0xB6, 0x11, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0xA1, 0x11, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0xCA, 0x23, 0xF8, 0x3C, 0x1E,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x1E, 0x3C,
+  0xF8, 0xDB, 0x23, 0x07, 0x0F, 0x1E, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
+  0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
+  0x3C, 0x3C, 0x3C, 0x3C, 0x1E, 0x0F, 0x07, 0xFF, 0x9A, 0x15, 0xC0, 0xE0, 0x70, 0x70, 0x38, 0x38,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x70, 0x70, 0xE0, 0xC0,
+  0x9D, 0x15, 0xC0, 0xE0, 0x70, 0x70, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+  0x38, 0x38, 0x38, 0x38, 0x70, 0x70, 0xE0, 0xC0, 0xB4, 0x01, 0x07, 0x01, 0x87, 0x04, 0x80, 0xC0,
+  0xC0, 0xC0, 0x80, 0x86, 0x01, 0x01, 0x07, 0x9B, 0x01, 0x07, 0x01, 0x87, 0x04, 0x80, 0xC0, 0xC0,
+  0xC0, 0x80, 0x86, 0x01, 0x01, 0x07, 0xBC, 0x06, 0x3F, 0x73, 0xE1, 0xE1, 0xE1, 0x73, 0x3F, 0xAC,
+  0x06, 0x3F, 0x73, 0xE1, 0xE1, 0xE1, 0x73, 0x3F, 0xBB, 0x17, 0x1C, 0x70, 0xE0, 0xC0, 0xC0, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0xE0,
+  0x70, 0x1C, 0x9B, 0x17, 0x1C, 0x70, 0xE0, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0x70, 0x1C, 0xB6, 0x11, 0x01, 0x01,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01,
+  0xA1, 0x11, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x01, 0x01, 0xCA, 0x23, 0x70, 0x38, 0x1C, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E,
+  0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E,
+  0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x1C, 0x38, 0x70, 0xDB, 0x23, 0x07, 0x0E, 0x1C, 0x38,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x1C, 0x0E, 0x07,
+  0xFF, 0x9A, 0x15, 0xC0, 0x60, 0x30, 0x30, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+  0x18, 0x18, 0x18, 0x18, 0x18, 0x30, 0x30, 0x60, 0xC0, 0x9D, 0x15, 0xC0, 0x60, 0x30, 0x30, 0x18,
+  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x30, 0x30, 0x60,
+  0xC0, 0xB4, 0x00, 0x03, 0x88, 0x04, 0x80, 0xC0, 0xC0, 0xC0, 0x80, 0x87, 0x00, 0x03, 0x9B, 0x00,
+  0x03, 0x88, 0x04, 0x80, 0xC0, 0xC0, 0xC0, 0x80, 0x87, 0x00, 0x03, 0xBC, 0x06, 0x1B, 0x31, 0x60,
+  0x60, 0x60, 0x31, 0x1B, 0xAC, 0x06, 0x1B, 0x31, 0x60, 0x60, 0x60, 0x31, 0x1B, 0xBB, 0x17, 0x0C,
+  0x30, 0x60, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0xC0, 0xC0, 0x60, 0x30, 0x0C, 0x9B, 0x17, 0x0C, 0x30, 0x60, 0xC0, 0xC0, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0x60, 0x30,
+  0x0C, 0xB8, 0x0D, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0xA5, 0x0D, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0xCC, 0x23, 0x30, 0x18, 0x0C, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+  0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+  0x06, 0x06, 0x06, 0x06, 0x0C, 0x18, 0x30, 0xDB, 0x23, 0x03, 0x06, 0x0C, 0x18, 0x18, 0x18, 0x18,
+  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x0C, 0x06, 0x03, 0xFF, 0x9A, 0x15,
+  0x80, 0x40, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x20, 0x20, 0x40, 0x80, 0x9D, 0x15, 0x80, 0x40, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x20, 0x20, 0x40, 0x80, 0xB4, 0x00,
+  0x02, 0x89, 0x02, 0x80, 0x80, 0x80, 0x88, 0x00, 0x02, 0x9B, 0x00, 0x02, 0x89, 0x02, 0x80, 0x80,
+  0x80, 0x88, 0x00, 0x02, 0xBC, 0x06, 0x12, 0x21, 0x40, 0x40, 0x40, 0x21, 0x12, 0xAC, 0x06, 0x12,
+  0x21, 0x40, 0x40, 0x40, 0x21, 0x12, 0xBB, 0x04, 0x08, 0x20, 0x40, 0x80, 0x80, 0x8D, 0x04, 0x80,
+  0x80, 0x40, 0x20, 0x08, 0x9B, 0x04, 0x08, 0x20, 0x40, 0x80, 0x80, 0x8D, 0x04, 0x80, 0x80, 0x40,
+  0x20, 0x08, 0xB8, 0x0D, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0xA5, 0x0D, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0xCC, 0x04, 0xC0, 0xE0, 0xF0, 0xF8, 0x98, 0x81, 0x15, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x81, 0x04, 0x98, 0xF8, 0xF0, 0xE0, 0xC0, 0xDB, 0x23, 0x03, 0x07, 0x0F, 0x1F, 0x1F, 0x1E,
+  0x1E, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
+  0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1E, 0x1E, 0x1F, 0x1F, 0x0F, 0x07, 0x03, 0xFF, 0x9A,
+  0x15, 0x80, 0xC0, 0x60, 0x60, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x60, 0x60, 0xC0, 0x80, 0x9D, 0x15, 0x80, 0xC0, 0x60, 0x60, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x60, 0x60, 0xC0, 0x80, 0xB4,
+  0x01, 0x06, 0x01, 0x93, 0x01, 0x01, 0x06, 0x9B, 0x01, 0x06, 0x01, 0x93, 0x01, 0x01, 0x06, 0xFF,
+  0xB3, 0x17, 0x04, 0x10, 0x20, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x20, 0x10, 0x04, 0x9B, 0x17, 0x04, 0x10, 0x20, 0x40,
+  0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40,
+  0x40, 0x20, 0x10, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0x99, 0x17, 0x02, 0x08, 0x10, 0x20, 0x20, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x20, 0x20, 0x10,
+  0x08, 0x02, 0x9B, 0x17, 0x02, 0x08, 0x10, 0x20, 0x20, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x20, 0x20, 0x10, 0x08, 0x02, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xB1, 0x1B, 0x60, 0x18, 0x08, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x18, 0x60,
+  0xE4, 0x00, 0x01, 0x97, 0x00, 0x01, 0xFF, 0x9C, 0x11, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0xA1, 0x11, 0x80, 0x80, 0xC0,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0xB6,
+  0x04, 0x18, 0x06, 0x03, 0x01, 0x01, 0x85, 0x02, 0x80, 0x80, 0x80, 0x84, 0x04, 0x01, 0x01, 0x03,
+  0x06, 0x18, 0x9B, 0x04, 0x18, 0x06, 0x03, 0x01, 0x01, 0x85, 0x02, 0x80, 0x80, 0x80, 0x84, 0x04,
+  0x01, 0x01, 0x03, 0x06, 0x18, 0xBC, 0x06, 0x12, 0x21, 0x40, 0x40, 0x40, 0x21, 0x12, 0xAC, 0x06,
+  0x12, 0x21, 0x40, 0x40, 0x40, 0x21, 0x12, 0xBB, 0x17, 0x02, 0x08, 0x10, 0x20, 0x20, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x20, 0x20, 0x10, 0x08,
+  0x02, 0x9B, 0x17, 0x02, 0x08, 0x10, 0x20, 0x20, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x20, 0x20, 0x10, 0x08, 0x02, 0xFF, 0xFF, 0x99, 0x17, 0x20,
+  0x08, 0x04, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x02, 0x02, 0x04, 0x08, 0x20, 0x9B, 0x17, 0x20, 0x08, 0x04, 0x02, 0x02, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x04, 0x08,
+  0x20, 0xBC, 0x06, 0x24, 0x42, 0x81, 0x81, 0x81, 0x42, 0x24, 0xAC, 0x06, 0x24, 0x42, 0x81, 0x81,
+  0x81, 0x42, 0x24, 0xFF, 0xFF, 0x99, 0x17, 0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0xFE, 0xFE,
+  0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0xF0, 0xC0, 0x9B,
+  0x17, 0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE,
+  0xFE, 0xFE, 0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0xF0, 0xC0, 0xB3, 0x17, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x9B, 0x17, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x17, 0x03,
+  0x0F, 0x1F, 0x3F, 0x3F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
+  0x7F, 0x7F, 0x3F, 0x3F, 0x1F, 0x0F, 0x03, 0x9B, 0x17, 0x03, 0x0F, 0x1F, 0x3F, 0x3F, 0x7F, 0x7F,
+  0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x3F, 0x1F, 0x0F,
+  0x03, 0xFF, 0xD4, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF6, 0x09, 0x01, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x01, 0xFF, 0xFF, 0x99, 0x17, 0xC0, 0x30, 0x18, 0x0C,
+  0x0C, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0C,
+  0x0C, 0x18, 0x30, 0xC0, 0x9B, 0x17, 0xC0, 0x30, 0x18, 0x0C, 0x0C, 0x06, 0x06, 0x06, 0x06, 0x06,
+  0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0C, 0x0C, 0x18, 0x30, 0xC0, 0xFF, 0xB3,
+  0x17, 0x04, 0x10, 0x20, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x20, 0x10, 0x04, 0x9B, 0x17, 0x04, 0x10, 0x20, 0x40, 0x40,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40,
+  0x20, 0x10, 0x04, 0xFF, 0xFF, 0x9A, 0x15, 0xC0, 0x60, 0x30, 0x30, 0x18, 0x18, 0x18, 0x18, 0x18,
+  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x30, 0x30, 0x60, 0xC0, 0x9D, 0x15, 0xC0,
+  0x60, 0x30, 0x30, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+  0x18, 0x30, 0x30, 0x60, 0xC0, 0xB4, 0x00, 0x03, 0x95, 0x00, 0x03, 0x9B, 0x00, 0x03, 0x95, 0x00,
+  0x03, 0xFF, 0xFF, 0xD4, 0x00, 0x80, 0xFD, 0x01, 0x01, 0x02, 0xFF, 0xFF, 0x9B, 0x13, 0x80, 0x40,
+  0x40, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40,
+  0x40, 0x80, 0x9F, 0x13, 0x80, 0x40, 0x40, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x40, 0x80, 0xB5, 0x01, 0x04, 0x01, 0x93, 0x01, 0x01, 0x04,
+  0x9B, 0x01, 0x04, 0x01, 0x93, 0x01, 0x01, 0x04, 0xFF, 0xFF, 0x9C, 0x11, 0x80, 0x80, 0xC0, 0xC0,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0xA1, 0x11,
+  0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0x80, 0x80, 0xB6, 0x04, 0x18, 0x06, 0x03, 0x01, 0x01, 0x8D, 0x04, 0x01, 0x01, 0x03, 0x06, 0x18,
+  0x9B, 0x04, 0x18, 0x06, 0x03, 0x01, 0x01, 0x8D, 0x04, 0x01, 0x01, 0x03, 0x06, 0x18, 0xB3, 0x04,
+  0x08, 0x20, 0x40, 0x80, 0x80, 0x8D, 0x04, 0x80, 0x80, 0x40, 0x20, 0x08, 0x9B, 0x04, 0x08, 0x20,
+  0x40, 0x80, 0x80, 0x8D, 0x04, 0x80, 0x80, 0x40, 0x20, 0x08, 0xB8, 0x0D, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xA5, 0x0D, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0x99, 0x17, 0x20,
+  0x08, 0x04, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x02, 0x02, 0x04, 0x08, 0x20, 0x9B, 0x17, 0x20, 0x08, 0x04, 0x02, 0x02, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x04, 0x08,
+  0x20, 0xFF, 0xFF, 0xDB, 0x00, 0x80, 0xFE, 0x01, 0x02, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAE,
+  0x02, 0x04, 0x0E, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAD, 0x04, 0x0E, 0x1B, 0x11, 0x1B, 0x0E,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAD, 0x04, 0x12, 0x21, 0x21, 0x21, 0x12, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xAD, 0x04, 0x24, 0x42, 0x42, 0x42, 0x24, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAD, 0x04, 0xD8,
+  0x8C, 0x84, 0x8C, 0xD8, 0xFB, 0x02, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAD, 0x04,
+  0x20, 0x10, 0x00, 0x10, 0x20, 0xFA, 0x04, 0x01, 0x02, 0x02, 0x02, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xAD, 0x04, 0xC0, 0x60, 0x00, 0x60, 0xC0, 0xFA, 0x04, 0x06, 0x0C, 0x0C, 0x0C, 0x06, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xAE, 0x02, 0x80, 0x00, 0x80, 0xFB, 0x04, 0x3F, 0x73, 0x70, 0x73, 0x3F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAD, 0x04, 0xD8, 0x8C, 0x80, 0x8C, 0xD8, 0xFB, 0x02, 0x01,
+  0x01, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAD, 0x04, 0x60, 0x30, 0x00, 0x30, 0x60, 0xFA,
+  0x04, 0x03, 0x06, 0x06, 0x06, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAD, 0x04, 0x80, 0x40,
+  0x00, 0x40, 0x80, 0xFA, 0x04, 0x04, 0x08, 0x08, 0x08, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xAE, 0x02, 0x80, 0x00, 0x80, 0xFB, 0x04, 0x09, 0x10, 0x10, 0x10, 0x09, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xAD, 0x04, 0x12, 0x21, 0x20, 0x21, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xAD, 0x04, 0x24, 0x42, 0x40, 0x42, 0x24, 0xFF, 0xFF, 0xFF, 0x99, 0x05, 0xC0, 0x30, 0x08,
+  0x04, 0x00, 0x02, 0x8C, 0x05, 0x02, 0x00, 0x04, 0x08, 0x30, 0xC0, 0x9A, 0x05, 0xC0, 0x30, 0x08,
+  0x04, 0x00, 0x02, 0x8C, 0x05, 0x02, 0x00, 0x04, 0x08, 0x30, 0xC0, 0xB2, 0x03, 0x0F, 0x30, 0x40,
+  0x80, 0x90, 0x03, 0x80, 0x40, 0x30, 0x0F, 0x9A, 0x03, 0x0F, 0x30, 0x40, 0x80, 0x90, 0x03, 0x80,
+  0x40, 0x30, 0x0F, 0xB7, 0x00, 0x01, 0x8C, 0x00, 0x01, 0x81, 0x00, 0xF8, 0xA1, 0x00, 0x01, 0x8C,
+  0x00, 0x01, 0xCD, 0x00, 0xFF, 0x8A, 0x00, 0x80, 0x84, 0x00, 0x80, 0xEA, 0x04, 0x38, 0x7C, 0x7F,
+  0x7C, 0x38, 0x87, 0x01, 0x01, 0x02, 0x84, 0x01, 0x02, 0x01, 0xFF, 0xFF, 0xFF, 0x98, 0x06, 0xC0,
+  0xF0, 0x38, 0x0C, 0x04, 0x02, 0x02, 0x8B, 0x06, 0x02, 0x02, 0x04, 0x0C, 0x38, 0xF0, 0xC0, 0x99,
+  0x06, 0xC0, 0xF0, 0x38, 0x0C, 0x04, 0x02, 0x02, 0x8B, 0x06, 0x02, 0x02, 0x04, 0x0C, 0x38, 0xF0,
+  0xC0, 0xB1, 0x04, 0x0F, 0x3F, 0x70, 0xC0, 0x80, 0x8F, 0x04, 0x80, 0xC0, 0x70, 0x3F, 0x0F, 0x99,
+  0x04, 0x0F, 0x3F, 0x70, 0xC0, 0x80, 0x8F, 0x04, 0x80, 0xC0, 0x70, 0x3F, 0x0F, 0xB6, 0x01, 0x01,
+  0x01, 0x8B, 0x01, 0x01, 0x01, 0xA3, 0x01, 0x01, 0x01, 0x8B, 0x01, 0x01, 0x01, 0xD8, 0x01, 0x80,
+  0x80, 0x83, 0x01, 0x80, 0x80, 0xF6, 0x02, 0x01, 0x03, 0x02, 0x83, 0x02, 0x02, 0x03, 0x01, 0xFF,
+  0xFF, 0xFF, 0x98, 0x06, 0xC0, 0xF0, 0x38, 0x0C, 0x04, 0x02, 0x02, 0x8B, 0x06, 0x02, 0x02, 0x04,
+  0x0C, 0x38, 0xF0, 0xC0, 0x99, 0x06, 0xC0, 0xF0, 0x38, 0x0C, 0x04, 0x02, 0x02, 0x8B, 0x06, 0x02,
+  0x02, 0x04, 0x0C, 0x38, 0xF0, 0xC0, 0xB1, 0x04, 0x0F, 0x3F, 0x70, 0xC0, 0x80, 0x8F, 0x04, 0x80,
+  0xC0, 0x70, 0x3F, 0x0F, 0x99, 0x04, 0x0F, 0x3F, 0x70, 0xC0, 0x80, 0x8F, 0x04, 0x80, 0xC0, 0x70,
+  0x3F, 0x0F, 0xB6, 0x01, 0x01, 0x01, 0x8B, 0x01, 0x01, 0x01, 0xA3, 0x01, 0x01, 0x01, 0x8B, 0x01,
+  0x01, 0x01, 0xD8, 0x01, 0x80, 0x80, 0x83, 0x01, 0x80, 0x80, 0xF6, 0x02, 0x01, 0x03, 0x02, 0x83,
+  0x02, 0x02, 0x03, 0x01, 0xFF, 0xFF, 0xFF, 0x98, 0x06, 0xC0, 0xF0, 0x38, 0x0C, 0x04, 0x02, 0x02,
+  0x8B, 0x06, 0x02, 0x02, 0x04, 0x0C, 0x38, 0xF0, 0xC0, 0x99, 0x06, 0xC0, 0xF0, 0x38, 0x0C, 0x04,
+  0x02, 0x02, 0x8B, 0x06, 0x02, 0x02, 0x04, 0x0C, 0x38, 0xF0, 0xC0, 0xB1, 0x04, 0x0F, 0x3F, 0x70,
+  0xC0, 0x80, 0x8F, 0x04, 0x80, 0xC0, 0x70, 0x3F, 0x0F, 0x99, 0x04, 0x0F, 0x3F, 0x70, 0xC0, 0x80,
+  0x8F, 0x04, 0x80, 0xC0, 0x70, 0x3F, 0x0F, 0xB6, 0x01, 0x01, 0x01, 0x8B, 0x01, 0x01, 0x01, 0xA3,
+  0x01, 0x01, 0x01, 0x8B, 0x01, 0x01, 0x01, 0xD8, 0x01, 0x80, 0x80, 0x83, 0x01, 0x80, 0x80, 0xF6,
+  0x02, 0x01, 0x03, 0x02, 0x83, 0x02, 0x02, 0x03, 0x01, 0xFF, 0xFF, 0xFF, 0x98, 0x06, 0xC0, 0xF0,
+  0x38, 0x0C, 0x04, 0x02, 0x02, 0x8B, 0x06, 0x02, 0x02, 0x04, 0x0C, 0x38, 0xF0, 0xC0, 0x99, 0x06,
+  0xC0, 0xF0, 0x38, 0x0C, 0x04, 0x02, 0x02, 0x8B, 0x06, 0x02, 0x02, 0x04, 0x0C, 0x38, 0xF0, 0xC0,
+  0xB1, 0x04, 0x0F, 0x3F, 0x70, 0xC0, 0x80, 0x8F, 0x04, 0x80, 0xC0, 0x70, 0x3F, 0x0F, 0x99, 0x04,
+  0x0F, 0x3F, 0x70, 0xC0, 0x80, 0x8F, 0x04, 0x80, 0xC0, 0x70, 0x3F, 0x0F, 0xB6, 0x01, 0x01, 0x01,
+  0x8B, 0x01, 0x01, 0x01, 0xA3, 0x01, 0x01, 0x01, 0x8B, 0x01, 0x01, 0x01, 0xD8, 0x01, 0x80, 0x80,
+  0x83, 0x01, 0x80, 0x80, 0xF6, 0x02, 0x01, 0x03, 0x02, 0x83, 0x02, 0x02, 0x03, 0x01, 0xFF, 0xFF,
+  0xFF, 0x98, 0x06, 0xC0, 0xF0, 0x38, 0x0C, 0x04, 0x02, 0x02, 0x8B, 0x06, 0x02, 0x02, 0x04, 0x0C,
+  0x38, 0xF0, 0xC0, 0x99, 0x06, 0xC0, 0xF0, 0x38, 0x0C, 0x04, 0x02, 0x02, 0x8B, 0x06, 0x02, 0x02,
+  0x04, 0x0C, 0x38, 0xF0, 0xC0, 0xB1, 0x04, 0x0F, 0x3F, 0x70, 0xC0, 0x80, 0x8F, 0x04, 0x80, 0xC0,
+  0x70, 0x3F, 0x0F, 0x99, 0x04, 0x0F, 0x3F, 0x70, 0xC0, 0x80, 0x8F, 0x04, 0x80, 0xC0, 0x70, 0x3F,
+  0x0F, 0xB6, 0x01, 0x01, 0x01, 0x8B, 0x01, 0x01, 0x01, 0xA3, 0x01, 0x01, 0x01, 0x8B, 0x01, 0x01,
+  0x01, 0xD8, 0x01, 0x80, 0x80, 0x83, 0x01, 0x80, 0x80, 0xF6, 0x02, 0x01, 0x03, 0x02, 0x83, 0x02,
+  0x02, 0x03, 0x01, 0xFF, 0xFF, 0xFF, 0x98, 0x06, 0xC0, 0xF0, 0x38, 0x0C, 0x04, 0x02, 0x02, 0x8B,
+  0x06, 0x02, 0x02, 0x04, 0x0C, 0x38, 0xF0, 0xC0, 0x99, 0x06, 0xC0, 0xF0, 0x38, 0x0C, 0x04, 0x02,
+  0x02, 0x8B, 0x06, 0x02, 0x02, 0x04, 0x0C, 0x38, 0xF0, 0xC0, 0xB1, 0x04, 0x0F, 0x3F, 0x70, 0xC0,
+  0x80, 0x8F, 0x04, 0x80, 0xC0, 0x70, 0x3F, 0x0F, 0x99, 0x04, 0x0F, 0x3F, 0x70, 0xC0, 0x80, 0x8F,
+  0x04, 0x80, 0xC0, 0x70, 0x3F, 0x0F, 0xB6, 0x01, 0x01, 0x01, 0x8B, 0x01, 0x01, 0x01, 0xA3, 0x01,
+  0x01, 0x01, 0x8B, 0x01, 0x01, 0x01, 0xD8, 0x01, 0x80, 0x80, 0x83, 0x01, 0x80, 0x80, 0xF6, 0x02,
+  0x01, 0x03, 0x02, 0x83, 0x02, 0x02, 0x03, 0x01, 0xFF, 0xFF, 0xFF, 0x98, 0x06, 0xC0, 0xF0, 0x38,
+  0x0C, 0x04, 0x02, 0x02, 0x8B, 0x06, 0x02, 0x02, 0x04, 0x0C, 0x38, 0xF0, 0xC0, 0x99, 0x06, 0xC0,
+  0xF0, 0x38, 0x0C, 0x04, 0x02, 0x02, 0x8B, 0x06, 0x02, 0x02, 0x04, 0x0C, 0x38, 0xF0, 0xC0, 0xB1,
+  0x04, 0x0F, 0x3F, 0x70, 0xC0, 0x80, 0x8F, 0x04, 0x80, 0xC0, 0x70, 0x3F, 0x0F, 0x99, 0x04, 0x0F,
+  0x3F, 0x70, 0xC0, 0x80, 0x8F, 0x04, 0x80, 0xC0, 0x70, 0x3F, 0x0F, 0xB6, 0x01, 0x01, 0x01, 0x8B,
+  0x01, 0x01, 0x01, 0xA3, 0x01, 0x01, 0x01, 0x8B, 0x01, 0x01, 0x01, 0xD8, 0x01, 0x80, 0x80, 0x83,
+  0x01, 0x80, 0x80, 0xF6, 0x02, 0x01, 0x03, 0x02, 0x83, 0x02, 0x02, 0x03, 0x01, 0xFF, 0xFF, 0xFF,
+  0x98, 0x06, 0xC0, 0xF0, 0x38, 0x0C, 0x04, 0x02, 0x02, 0x8B, 0x06, 0x02, 0x02, 0x04, 0x0C, 0x38,
+  0xF0, 0xC0, 0x99, 0x06, 0xC0, 0xF0, 0x38, 0x0C, 0x04, 0x02, 0x02, 0x8B, 0x06, 0x02, 0x02, 0x04,
+  0x0C, 0x38, 0xF0, 0xC0, 0xB1, 0x04, 0x0F, 0x3F, 0x70, 0xC0, 0x80, 0x8F, 0x04, 0x80, 0xC0, 0x70,
+  0x3F, 0x0F, 0x99, 0x04, 0x0F, 0x3F, 0x70, 0xC0, 0x80, 0x8F, 0x04, 0x80, 0xC0, 0x70, 0x3F, 0x0F,
+  0xB6, 0x01, 0x01, 0x01, 0x8B, 0x01, 0x01, 0x01, 0xA3, 0x01, 0x01, 0x01, 0x8B, 0x01, 0x01, 0x01,
+  0xD8, 0x01, 0x80, 0x80, 0x83, 0x01, 0x80, 0x80, 0xF6, 0x02, 0x01, 0x03, 0x02, 0x83, 0x02, 0x02,
+  0x03, 0x01, 0xFF, 0xFF, 0xFF, 0x98, 0x06, 0xC0, 0xF0, 0x38, 0x0C, 0x04, 0x02, 0x02, 0x8B, 0x06,
+  0x02, 0x02, 0x04, 0x0C, 0x38, 0xF0, 0xC0, 0x99, 0x06, 0xC0, 0xF0, 0x38, 0x0C, 0x04, 0x02, 0x02,
+  0x8B, 0x06, 0x02, 0x02, 0x04, 0x0C, 0x38, 0xF0, 0xC0, 0xB1, 0x04, 0x0F, 0x3F, 0x70, 0xC0, 0x80,
+  0x8F, 0x04, 0x80, 0xC0, 0x70, 0x3F, 0x0F, 0x99, 0x04, 0x0F, 0x3F, 0x70, 0xC0, 0x80, 0x8F, 0x04,
+  0x80, 0xC0, 0x70, 0x3F, 0x0F, 0xB6, 0x01, 0x01, 0x01, 0x8B, 0x01, 0x01, 0x01, 0xA3, 0x01, 0x01,
+  0x01, 0x8B, 0x01, 0x01, 0x01, 0xD8, 0x01, 0x80, 0x80, 0x83, 0x01, 0x80, 0x80, 0xF6, 0x02, 0x01,
+  0x03, 0x02, 0x83, 0x02, 0x02, 0x03, 0x01, 0xFF, 0xFF, 0xFF, 0x98, 0x05, 0xC0, 0x30, 0x08, 0x04,
+  0x00, 0x02, 0x8C, 0x05, 0x02, 0x00, 0x04, 0x08, 0x30, 0xC0, 0x9A, 0x05, 0xC0, 0x30, 0x08, 0x04,
+  0x00, 0x02, 0x8C, 0x05, 0x02, 0x00, 0x04, 0x08, 0x30, 0xC0, 0xB2, 0x03, 0x0F, 0x30, 0x40, 0x80,
+  0x90, 0x03, 0x80, 0x40, 0x30, 0x0F, 0x9A, 0x03, 0x0F, 0x30, 0x40, 0x80, 0x90, 0x03, 0x80, 0x40,
+  0x30, 0x0F, 0xB7, 0x00, 0x01, 0x8C, 0x00, 0x01, 0xA4, 0x00, 0x01, 0x8C, 0x00, 0x01, 0xD9, 0x09,
+  0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0xE0, 0xE0, 0xE0, 0xC0, 0xF4, 0x09, 0x01, 0x03, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x00, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0x99, 0x17, 0x20, 0x08, 0x04, 0x02, 0x02,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02,
+  0x04, 0x08, 0x20, 0x9B, 0x17, 0x20, 0x08, 0x04, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x04, 0x08, 0x20, 0xFF, 0xFF, 0x9E,
+  0x0D, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xA5,
+  0x0D, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xB8,
+  0x04, 0x10, 0x04, 0x02, 0x01, 0x01, 0x8D, 0x04, 0x01, 0x01, 0x02, 0x04, 0x10, 0x9B, 0x04, 0x10,
+  0x04, 0x02, 0x01, 0x01, 0x8D, 0x04, 0x01, 0x01, 0x02, 0x04, 0x10, 0xFF, 0xFF, 0x9C, 0x11, 0x80,
+  0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80,
+  0x80, 0xA1, 0x11, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x80, 0x80, 0xB6, 0x02, 0x08, 0x02, 0x01, 0x91, 0x02, 0x01, 0x02, 0x08, 0x9B,
+  0x02, 0x08, 0x02, 0x01, 0x91, 0x02, 0x01, 0x02, 0x08, 0xFF, 0xFF, 0x9B, 0x13, 0x80, 0x40, 0x40,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x40,
+  0x80, 0x9F, 0x13, 0x80, 0x40, 0x40, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x40, 0x40, 0x80, 0xB5, 0x01, 0x04, 0x01, 0x93, 0x01, 0x01, 0x04, 0x9B,
+  0x01, 0x04, 0x01, 0x93, 0x01, 0x01, 0x04, 0xB3, 0x04, 0x08, 0x20, 0x40, 0x80, 0x80, 0x8D, 0x04,
+  0x80, 0x80, 0x40, 0x20, 0x08, 0x9B, 0x04, 0x08, 0x20, 0x40, 0x80, 0x80, 0x8D, 0x04, 0x80, 0x80,
+  0x40, 0x20, 0x08, 0xB8, 0x0D, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0xA5, 0x0D, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0xFF, 0xFF, 0x9A, 0x15, 0x80, 0x40, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x20, 0x20, 0x40, 0x80, 0x9D, 0x15, 0x80,
+  0x40, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x20, 0x20, 0x40, 0x80, 0xB4, 0x00, 0x02, 0x95, 0x00, 0x02, 0x9B, 0x00, 0x02, 0x95, 0x00,
+  0x02, 0xFF, 0xFF, 0xD2, 0x0D, 0xE0, 0xF0, 0x30, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x30, 0xF0, 0xE0, 0xF2, 0x01, 0x01, 0x01, 0x87, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0x9A, 0x15, 0x40,
+  0x20, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x10, 0x10, 0x20, 0x40, 0x9D, 0x15, 0x40, 0x20, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x10, 0x20, 0x40, 0xB4, 0x00, 0x01,
+  0x95, 0x00, 0x01, 0x9B, 0x00, 0x01, 0x95, 0x00, 0x01, 0xFF, 0xFF, 0x99, 0x17, 0xC0, 0x30, 0x18,
+  0x0C, 0x0C, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+  0x0C, 0x0C, 0x18, 0x30, 0xC0, 0x9B, 0x17, 0xC0, 0x30, 0x18, 0x0C, 0x0C, 0x06, 0x06, 0x06, 0x06,
+  0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0C, 0x0C, 0x18, 0x30, 0xC0, 0xFF,
+  0xB3, 0x17, 0x04, 0x10, 0x20, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x20, 0x10, 0x04, 0x9B, 0x17, 0x04, 0x10, 0x20, 0x40,
+  0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40,
+  0x40, 0x20, 0x10, 0x04, 0xFF, 0x91, 0x1A, 0x06, 0x06, 0x06, 0x0C, 0x0C, 0x0C, 0x0C, 0x18, 0x18,
+  0x18, 0x18, 0x30, 0x30, 0x30, 0x30, 0x60, 0x60, 0x60, 0x60, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80,
+  0x80, 0x80, 0xA7, 0x19, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0x60, 0x60, 0x60, 0x60,
+  0x30, 0x30, 0x30, 0x30, 0x18, 0x18, 0x18, 0x18, 0x0C, 0x0C, 0x0C, 0x0C, 0x06, 0x06, 0xAC, 0x16,
+  0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE1, 0xE1, 0xE1,
+  0xE1, 0xC3, 0xC3, 0x83, 0x03, 0x06, 0x06, 0x9A, 0x15, 0x06, 0x06, 0x86, 0xC3, 0xC3, 0xE3, 0xE3,
+  0xE1, 0xE1, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0xB5,
+  0x17, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x9B, 0x17, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0xB3, 0x17, 0x03, 0x0F, 0x1F, 0x3F, 0x3F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
+  0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x3F, 0x1F, 0x0F, 0x03, 0x9B, 0x17, 0x03,
+  0x0F, 0x1F, 0x3F, 0x3F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
+  0x7F, 0x7F, 0x3F, 0x3F, 0x1F, 0x0F, 0x03, 0xFF, 0xD0, 0x11, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xEC, 0x13, 0x03, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x03, 0xFF, 0xFF, 0x9B, 0x13, 0x80, 0x40, 0x40, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x40, 0x80, 0x9F, 0x13, 0x80, 0x40, 0x40, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x40, 0x80,
+  0xB5, 0x01, 0x04, 0x01, 0x93, 0x01, 0x01, 0x04, 0x9B, 0x01, 0x04, 0x01, 0x93, 0x01, 0x01, 0x04,
+  0xFF, 0x91, 0x1A, 0x1A, 0x1A, 0x1A, 0x34, 0x34, 0x34, 0x34, 0x68, 0x68, 0x68, 0x68, 0xD0, 0xD0,
+  0xD0, 0xD0, 0xA0, 0xA0, 0xA0, 0xA0, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0xA7, 0x19,
+  0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0xA0, 0xA0, 0xA0, 0xA0, 0xD0, 0xD0, 0xD0, 0xD0,
+  0x68, 0x68, 0x68, 0x68, 0x34, 0x34, 0x34, 0x34, 0x1A, 0x1A, 0xAD, 0x15, 0x80, 0x80, 0xC0, 0xC0,
+  0xC1, 0xC1, 0xC1, 0xC1, 0xC3, 0xC3, 0xC3, 0xC3, 0xC6, 0xC6, 0xC6, 0xC6, 0x8D, 0x8D, 0x0D, 0x0D,
+  0x1A, 0x1A, 0x9A, 0x14, 0x1A, 0x1A, 0x1A, 0x8D, 0x8D, 0xCD, 0xCD, 0xC6, 0xC6, 0xC6, 0xC6, 0xC3,
+  0xC3, 0xC3, 0xC3, 0xC1, 0xC1, 0xC1, 0xC1, 0x80, 0x80, 0xB6, 0x04, 0x18, 0x06, 0x03, 0x01, 0x01,
+  0x8D, 0x04, 0x01, 0x01, 0x03, 0x06, 0x18, 0x9B, 0x04, 0x18, 0x06, 0x03, 0x01, 0x01, 0x8D, 0x04,
+  0x01, 0x01, 0x03, 0x06, 0x18, 0xFF, 0x91, 0x16, 0x64, 0x64, 0x64, 0xC8, 0xC8, 0xC8, 0xC8, 0x90,
+  0x90, 0x90, 0x90, 0x20, 0x20, 0x20, 0x20, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0xAF,
+  0x15, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x20, 0x20, 0x20, 0x20, 0x90, 0x90, 0x90,
+  0x90, 0xC8, 0xC8, 0xC8, 0xC8, 0x64, 0x64, 0xA9, 0x19, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03,
+  0x03, 0x06, 0x06, 0x06, 0x06, 0x0C, 0x0C, 0x0C, 0x0C, 0x19, 0x19, 0x19, 0x19, 0x32, 0x32, 0x32,
+  0x32, 0x64, 0x64, 0x9A, 0x1A, 0x64, 0x64, 0x64, 0x32, 0x32, 0x32, 0x32, 0x19, 0x19, 0x19, 0x19,
+  0x0C, 0x0C, 0x0C, 0x0C, 0x06, 0x06, 0x06, 0x06, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0x01, 0x01,
+  0xB0, 0x17, 0x20, 0x08, 0x04, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x04, 0x08, 0x20, 0x9B, 0x17, 0x20, 0x08, 0x04, 0x02,
+  0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02,
+  0x02, 0x04, 0x08, 0x20, 0xFF, 0xFF, 0xFF, 0x9A, 0x15, 0x10, 0x08, 0x04, 0x00, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x04, 0x08, 0x10, 0x9D,
+  0x15, 0x10, 0x08, 0x04, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x00, 0x04, 0x08, 0x10, 0xB4, 0x00, 0x04, 0x82, 0x00, 0x40, 0x8D, 0x00, 0x40,
+  0x82, 0x00, 0x04, 0x9B, 0x00, 0x04, 0x82, 0x00, 0x40, 0x8D, 0x00, 0x40, 0x82, 0x00, 0x04, 0xFF,
+  0x91, 0x12, 0x88, 0x88, 0x88, 0x10, 0x10, 0x10, 0x10, 0x20, 0x20, 0x20, 0x20, 0x40, 0x40, 0x40,
+  0x40, 0x80, 0x80, 0x80, 0x80, 0xB7, 0x11, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x20,
+  0x20, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x88, 0x88, 0xA2, 0x20, 0x01, 0x01, 0x01, 0x03, 0x03,
+  0x03, 0x03, 0x06, 0x06, 0x06, 0x06, 0x0C, 0x0C, 0x0C, 0x0C, 0x18, 0x18, 0x18, 0x18, 0x31, 0x31,
+  0x31, 0x31, 0x62, 0x62, 0x62, 0x62, 0xC4, 0xC4, 0xC4, 0xC4, 0x88, 0x88, 0x9A, 0x20, 0x88, 0x88,
+  0x88, 0xC4, 0xC4, 0xC4, 0xC4, 0x62, 0x62, 0x62, 0x62, 0x31, 0x31, 0x31, 0x31, 0x18, 0x18, 0x18,
+  0x18, 0x0C, 0x0C, 0x0C, 0x0C, 0x06, 0x06, 0x06, 0x06, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0xAA,
+  0x18, 0x40, 0x20, 0x10, 0x08, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x10, 0x20, 0x41, 0x01, 0x9A, 0x17, 0x41, 0x21, 0x11, 0x08,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x08, 0x10, 0x20, 0x40, 0xFF, 0x91, 0x11, 0xF0, 0xF0, 0xF0, 0x10, 0x10, 0x10, 0x00, 0x20, 0x20,
+  0x20, 0x00, 0x40, 0x40, 0x40, 0x00, 0x80, 0x80, 0x80, 0xBC, 0x10, 0x80, 0x80, 0x80, 0x00, 0x40,
+  0x40, 0x40, 0x00, 0x20, 0x20, 0x20, 0x00, 0x10, 0x10, 0xE0, 0xF0, 0xF0, 0x9F, 0x23, 0x01, 0x01,
+  0x01, 0x02, 0x02, 0x02, 0x00, 0x04, 0x04, 0x04, 0x00, 0x08, 0x08, 0x08, 0x00, 0x10, 0x10, 0x10,
+  0x00, 0x21, 0x21, 0x21, 0x00, 0x42, 0x42, 0x42, 0x00, 0x84, 0x84, 0x84, 0x00, 0x08, 0x08, 0xF8,
+  0xF0, 0xF0, 0x97, 0x23, 0xF0, 0xF0, 0xF0, 0x08, 0x08, 0x08, 0x00, 0x84, 0x84, 0x84, 0x00, 0x42,
+  0x42, 0x42, 0x00, 0x21, 0x21, 0x21, 0x00, 0x10, 0x10, 0x10, 0x00, 0x08, 0x08, 0x08, 0x00, 0x04,
+  0x04, 0x04, 0x00, 0x02, 0x02, 0x03, 0x01, 0x01, 0xA7, 0x06, 0x80, 0xC0, 0xE0, 0x70, 0x38, 0x18,
+  0x08, 0x8C, 0x07, 0x08, 0x18, 0x38, 0x71, 0xE1, 0xC0, 0x81, 0x01, 0x97, 0x06, 0x81, 0xC1, 0xE1,
+  0x71, 0x39, 0x19, 0x08, 0x8C, 0x06, 0x08, 0x18, 0x38, 0x70, 0xE0, 0xC0, 0x80, 0xB0, 0x06, 0x07,
+  0x0F, 0x1F, 0x38, 0x70, 0x60, 0x40, 0x8C, 0x06, 0x40, 0x60, 0x70, 0x38, 0x1F, 0x0F, 0x07, 0x98,
+  0x06, 0x07, 0x0F, 0x1F, 0x38, 0x70, 0x60, 0x40, 0x8C, 0x06, 0x40, 0x60, 0x70, 0x38, 0x1F, 0x0F,
+  0x07, 0xFF, 0xCD, 0x02, 0x80, 0x80, 0x80, 0x8E, 0x02, 0x80, 0x80, 0x80, 0xE9, 0x03, 0x03, 0x07,
+  0x07, 0x04, 0x8E, 0x03, 0x04, 0x07, 0x07, 0x03, 0xFF, 0x8E, 0x14, 0xF0, 0xF0, 0xF0, 0xE0, 0xE0,
+  0xE0, 0x10, 0x30, 0x30, 0x20, 0x20, 0x60, 0x60, 0x40, 0x40, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0x80,
+  0xB9, 0x13, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0x40, 0x40, 0x60, 0x60, 0x20, 0x20, 0x30, 0x30,
+  0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0x9C, 0x26, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x02, 0x06,
+  0x06, 0x04, 0x04, 0x0C, 0x0C, 0x08, 0x08, 0x18, 0x18, 0x10, 0x10, 0x31, 0x31, 0x21, 0x21, 0x63,
+  0x63, 0x42, 0x42, 0xC6, 0xC6, 0x84, 0x84, 0x8C, 0x8C, 0xF8, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0x94,
+  0x26, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0x08, 0x8C, 0x8C, 0x84, 0x84, 0xC6, 0xC6, 0x42, 0x42,
+  0x63, 0x63, 0x21, 0x21, 0x31, 0x31, 0x10, 0x10, 0x18, 0x18, 0x08, 0x08, 0x0C, 0x0C, 0x04, 0x04,
+  0x06, 0x06, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0xA4, 0x09, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xF8,
+  0x78, 0x38, 0x18, 0x08, 0x89, 0x0A, 0x08, 0x18, 0x38, 0x79, 0xF9, 0xF8, 0xF0, 0xE0, 0xC0, 0x81,
+  0x01, 0x94, 0x09, 0x81, 0xC1, 0xE1, 0xF0, 0xF8, 0xF8, 0x79, 0x39, 0x19, 0x08, 0x89, 0x09, 0x08,
+  0x18, 0x38, 0x78, 0xF8, 0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0xAD, 0x09, 0x07, 0x0F, 0x1F, 0x3F, 0x7F,
+  0x7F, 0x78, 0x70, 0x60, 0x40, 0x89, 0x09, 0x40, 0x60, 0x70, 0x78, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F,
+  0x07, 0x95, 0x09, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0x7F, 0x78, 0x70, 0x60, 0x40, 0x89, 0x09, 0x40,
+  0x60, 0x70, 0x78, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0xFF, 0xCA, 0x05, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x8B, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE6, 0x06, 0x03, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x04, 0x8B, 0x06, 0x04, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0xFF, 0x8E, 0x14, 0xF0,
+  0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0x10, 0x30, 0x30, 0x20, 0x20, 0x60, 0x60, 0x40, 0x40, 0xC0, 0xC0,
+  0x80, 0x80, 0x80, 0x80, 0xB9, 0x13, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0x40, 0x40, 0x60, 0x60,
+  0x20, 0x20, 0x30, 0x30, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0x9C, 0x26, 0x01, 0x01, 0x01, 0x03,
+  0x03, 0x03, 0x02, 0x06, 0x06, 0x04, 0x04, 0x0C, 0x0C, 0x08, 0x08, 0x18, 0x18, 0x10, 0x10, 0x31,
+  0x31, 0x21, 0x21, 0x63, 0x63, 0x42, 0x42, 0xC6, 0xC6, 0x84, 0x84, 0x8C, 0x8C, 0xF8, 0xF8, 0xF8,
+  0xF8, 0xF0, 0xF0, 0x94, 0x26, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0x08, 0x8C, 0x8C, 0x84, 0x84,
+  0xC6, 0xC6, 0x42, 0x42, 0x63, 0x63, 0x21, 0x21, 0x31, 0x31, 0x10, 0x10, 0x18, 0x18, 0x08, 0x08,
+  0x0C, 0x0C, 0x04, 0x04, 0x06, 0x06, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0xA4, 0x09, 0x80, 0xC0,
+  0xE0, 0xF0, 0xF8, 0xF8, 0x78, 0x38, 0x18, 0x08, 0x89, 0x0A, 0x08, 0x18, 0x38, 0x79, 0xF9, 0xF8,
+  0xF0, 0xE0, 0xC0, 0x81, 0x01, 0x94, 0x09, 0x81, 0xC1, 0xE1, 0xF0, 0xF8, 0xF8, 0x79, 0x39, 0x19,
+  0x08, 0x89, 0x09, 0x08, 0x18, 0x38, 0x78, 0xF8, 0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0xAD, 0x09, 0x07,
+  0x0F, 0x1F, 0x3F, 0x7F, 0x7F, 0x78, 0x70, 0x60, 0x40, 0x89, 0x09, 0x40, 0x60, 0x70, 0x78, 0x7F,
+  0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0x95, 0x09, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0x7F, 0x78, 0x70, 0x60,
+  0x40, 0x89, 0x09, 0x40, 0x60, 0x70, 0x78, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0xFF, 0xCA, 0x05,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8B, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE6, 0x06,
+  0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x04, 0x8B, 0x06, 0x04, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03,
+  0xFF, 0x8E, 0x14, 0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0x10, 0x30, 0x30, 0x20, 0x20, 0x60, 0x60,
+  0x40, 0x40, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0x80, 0xB9, 0x13, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xC0,
+  0x40, 0x40, 0x60, 0x60, 0x20, 0x20, 0x30, 0x30, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0x9C, 0x26,
+  0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x02, 0x06, 0x06, 0x04, 0x04, 0x0C, 0x0C, 0x08, 0x08, 0x18,
+  0x18, 0x10, 0x10, 0x31, 0x31, 0x21, 0x21, 0x63, 0x63, 0x42, 0x42, 0xC6, 0xC6, 0x84, 0x84, 0x8C,
+  0x8C, 0xF8, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0x94, 0x26, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0x08,
+  0x8C, 0x8C, 0x84, 0x84, 0xC6, 0xC6, 0x42, 0x42, 0x63, 0x63, 0x21, 0x21, 0x31, 0x31, 0x10, 0x10,
+  0x18, 0x18, 0x08, 0x08, 0x0C, 0x0C, 0x04, 0x04, 0x06, 0x06, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01,
+  0xA4, 0x09, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xF8, 0x78, 0x38, 0x18, 0x08, 0x89, 0x0A, 0x08, 0x18,
+  0x38, 0x79, 0xF9, 0xF8, 0xF0, 0xE0, 0xC0, 0x81, 0x01, 0x94, 0x09, 0x81, 0xC1, 0xE1, 0xF0, 0xF8,
+  0xF8, 0x79, 0x39, 0x19, 0x08, 0x89, 0x09, 0x08, 0x18, 0x38, 0x78, 0xF8, 0xF8, 0xF0, 0xE0, 0xC0,
+  0x80, 0xAD, 0x09, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0x7F, 0x78, 0x70, 0x60, 0x40, 0x89, 0x09, 0x40,
+  0x60, 0x70, 0x78, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0x95, 0x09, 0x07, 0x0F, 0x1F, 0x3F, 0x7F,
+  0x7F, 0x78, 0x70, 0x60, 0x40, 0x89, 0x09, 0x40, 0x60, 0x70, 0x78, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F,
+  0x07, 0xFF, 0xCA, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8B, 0x05, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0xE6, 0x06, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x04, 0x8B, 0x06, 0x04, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x03, 0xFF, 0x8E, 0x14, 0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0x10, 0x30, 0x30,
+  0x20, 0x20, 0x60, 0x60, 0x40, 0x40, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0x80, 0xB9, 0x13, 0x80, 0x80,
+  0x80, 0x80, 0xC0, 0xC0, 0x40, 0x40, 0x60, 0x60, 0x20, 0x20, 0x30, 0x30, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xF0, 0xF0, 0x9C, 0x26, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x02, 0x06, 0x06, 0x04, 0x04, 0x0C,
+  0x0C, 0x08, 0x08, 0x18, 0x18, 0x10, 0x10, 0x31, 0x31, 0x21, 0x21, 0x63, 0x63, 0x42, 0x42, 0xC6,
+  0xC6, 0x84, 0x84, 0x8C, 0x8C, 0xF8, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0x94, 0x26, 0xF0, 0xF0, 0xF0,
+  0xF8, 0xF8, 0xF8, 0x08, 0x8C, 0x8C, 0x84, 0x84, 0xC6, 0xC6, 0x42, 0x42, 0x63, 0x63, 0x21, 0x21,
+  0x31, 0x31, 0x10, 0x10, 0x18, 0x18, 0x08, 0x08, 0x0C, 0x0C, 0x04, 0x04, 0x06, 0x06, 0x03, 0x03,
+  0x03, 0x03, 0x01, 0x01, 0xA4, 0x09, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xF8, 0x78, 0x38, 0x18, 0x08,
+  0x89, 0x0A, 0x08, 0x18, 0x38, 0x79, 0xF9, 0xF8, 0xF0, 0xE0, 0xC0, 0x81, 0x01, 0x94, 0x09, 0x81,
+  0xC1, 0xE1, 0xF0, 0xF8, 0xF8, 0x79, 0x39, 0x19, 0x08, 0x89, 0x09, 0x08, 0x18, 0x38, 0x78, 0xF8,
+  0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0xAD, 0x09, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0x7F, 0x78, 0x70, 0x60,
+  0x40, 0x89, 0x09, 0x40, 0x60, 0x70, 0x78, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0x95, 0x09, 0x07,
+  0x0F, 0x1F, 0x3F, 0x7F, 0x7F, 0x78, 0x70, 0x60, 0x40, 0x89, 0x09, 0x40, 0x60, 0x70, 0x78, 0x7F,
+  0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0xFF, 0xCA, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8B, 0x05,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE6, 0x06, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x04, 0x8B,
+  0x06, 0x04, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0xFF, 0x8E, 0x14, 0xF0, 0xF0, 0xF0, 0xE0, 0xE0,
+  0xE0, 0x10, 0x30, 0x30, 0x20, 0x20, 0x60, 0x60, 0x40, 0x40, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0x80,
+  0xB9, 0x13, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0x40, 0x40, 0x60, 0x60, 0x20, 0x20, 0x30, 0x30,
+  0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0x9C, 0x26, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x02, 0x06,
+  0x06, 0x04, 0x04, 0x0C, 0x0C, 0x08, 0x08, 0x18, 0x18, 0x10, 0x10, 0x31, 0x31, 0x21, 0x21, 0x63,
+  0x63, 0x42, 0x42, 0xC6, 0xC6, 0x84, 0x84, 0x8C, 0x8C, 0xF8, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0x94,
+  0x26, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0x08, 0x8C, 0x8C, 0x84, 0x84, 0xC6, 0xC6, 0x42, 0x42,
+  0x63, 0x63, 0x21, 0x21, 0x31, 0x31, 0x10, 0x10, 0x18, 0x18, 0x08, 0x08, 0x0C, 0x0C, 0x04, 0x04,
+  0x06, 0x06, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0xA4, 0x09, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xF8,
+  0x78, 0x38, 0x18, 0x08, 0x89, 0x0A, 0x08, 0x18, 0x38, 0x79, 0xF9, 0xF8, 0xF0, 0xE0, 0xC0, 0x81,
+  0x01, 0x94, 0x09, 0x81, 0xC1, 0xE1, 0xF0, 0xF8, 0xF8, 0x79, 0x39, 0x19, 0x08, 0x89, 0x09, 0x08,
+  0x18, 0x38, 0x78, 0xF8, 0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0xAD, 0x09, 0x07, 0x0F, 0x1F, 0x3F, 0x7F,
+  0x7F, 0x78, 0x70, 0x60, 0x40, 0x89, 0x09, 0x40, 0x60, 0x70, 0x78, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F,
+  0x07, 0x95, 0x09, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0x7F, 0x78, 0x70, 0x60, 0x40, 0x89, 0x09, 0x40,
+  0x60, 0x70, 0x78, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0xFF, 0xCA, 0x05, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x8B, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE6, 0x06, 0x03, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x04, 0x8B, 0x06, 0x04, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0xFF, 0x8E, 0x14, 0xF0,
+  0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0x10, 0x30, 0x30, 0x20, 0x20, 0x60, 0x60, 0x40, 0x40, 0xC0, 0xC0,
+  0x80, 0x80, 0x80, 0x80, 0xB9, 0x13, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0x40, 0x40, 0x60, 0x60,
+  0x20, 0x20, 0x30, 0x30, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0x9C, 0x26, 0x01, 0x01, 0x01, 0x03,
+  0x03, 0x03, 0x02, 0x06, 0x06, 0x04, 0x04, 0x0C, 0x0C, 0x08, 0x08, 0x18, 0x18, 0x10, 0x10, 0x31,
+  0x31, 0x21, 0x21, 0x63, 0x63, 0x42, 0x42, 0xC6, 0xC6, 0x84, 0x84, 0x8C, 0x8C, 0xF8, 0xF8, 0xF8,
+  0xF8, 0xF0, 0xF0, 0x94, 0x26, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0x08, 0x8C, 0x8C, 0x84, 0x84,
+  0xC6, 0xC6, 0x42, 0x42, 0x63, 0x63, 0x21, 0x21, 0x31, 0x31, 0x10, 0x10, 0x18, 0x18, 0x08, 0x08,
+  0x0C, 0x0C, 0x04, 0x04, 0x06, 0x06, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0xA4, 0x09, 0x80, 0xC0,
+  0xE0, 0xF0, 0xF8, 0xF8, 0x78, 0x38, 0x18, 0x08, 0x89, 0x0A, 0x08, 0x18, 0x38, 0x79, 0xF9, 0xF8,
+  0xF0, 0xE0, 0xC0, 0x81, 0x01, 0x94, 0x09, 0x81, 0xC1, 0xE1, 0xF0, 0xF8, 0xF8, 0x79, 0x39, 0x19,
+  0x08, 0x89, 0x09, 0x08, 0x18, 0x38, 0x78, 0xF8, 0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0xAD, 0x09, 0x07,
+  0x0F, 0x1F, 0x3F, 0x7F, 0x7F, 0x78, 0x70, 0x60, 0x40, 0x89, 0x09, 0x40, 0x60, 0x70, 0x78, 0x7F,
+  0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0x95, 0x09, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0x7F, 0x78, 0x70, 0x60,
+  0x40, 0x89, 0x09, 0x40, 0x60, 0x70, 0x78, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0xFF, 0xCA, 0x05,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8B, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE6, 0x06,
+  0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x04, 0x8B, 0x06, 0x04, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03,
+  0xFF, 0x8E, 0x14, 0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0x10, 0x30, 0x30, 0x20, 0x20, 0x60, 0x60,
+  0x40, 0x40, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0x80, 0xB9, 0x13, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xC0,
+  0x40, 0x40, 0x60, 0x60, 0x20, 0x20, 0x30, 0x30, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0x9C, 0x26,
+  0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x02, 0x06, 0x06, 0x04, 0x04, 0x0C, 0x0C, 0x08, 0x08, 0x18,
+  0x18, 0x10, 0x10, 0x31, 0x31, 0x21, 0x21, 0x63, 0x63, 0x42, 0x42, 0xC6, 0xC6, 0x84, 0x84, 0x8C,
+  0x8C, 0xF8, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0x94, 0x26, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0x08,
+  0x8C, 0x8C, 0x84, 0x84, 0xC6, 0xC6, 0x42, 0x42, 0x63, 0x63, 0x21, 0x21, 0x31, 0x31, 0x10, 0x10,
+  0x18, 0x18, 0x08, 0x08, 0x0C, 0x0C, 0x04, 0x04, 0x06, 0x06, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01,
+  0xA4, 0x09, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xF8, 0x78, 0x38, 0x18, 0x08, 0x89, 0x0A, 0x08, 0x18,
+  0x38, 0x79, 0xF9, 0xF8, 0xF0, 0xE0, 0xC0, 0x81, 0x01, 0x94, 0x09, 0x81, 0xC1, 0xE1, 0xF0, 0xF8,
+  0xF8, 0x79, 0x39, 0x19, 0x08, 0x89, 0x09, 0x08, 0x18, 0x38, 0x78, 0xF8, 0xF8, 0xF0, 0xE0, 0xC0,
+  0x80, 0xAD, 0x09, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0x7F, 0x78, 0x70, 0x60, 0x40, 0x89, 0x09, 0x40,
+  0x60, 0x70, 0x78, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0x95, 0x09, 0x07, 0x0F, 0x1F, 0x3F, 0x7F,
+  0x7F, 0x78, 0x70, 0x60, 0x40, 0x89, 0x09, 0x40, 0x60, 0x70, 0x78, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F,
+  0x07, 0xFF, 0xCA, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8B, 0x05, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0xE6, 0x06, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x04, 0x8B, 0x06, 0x04, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x03, 0xFF, 0x8E, 0x14, 0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0x10, 0x30, 0x30,
+  0x20, 0x20, 0x60, 0x60, 0x40, 0x40, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0x80, 0xB9, 0x13, 0x80, 0x80,
+  0x80, 0x80, 0xC0, 0xC0, 0x40, 0x40, 0x60, 0x60, 0x20, 0x20, 0x30, 0x30, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xF0, 0xF0, 0x9C, 0x26, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x02, 0x06, 0x06, 0x04, 0x04, 0x0C,
+  0x0C, 0x08, 0x08, 0x18, 0x18, 0x10, 0x10, 0x31, 0x31, 0x21, 0x21, 0x63, 0x63, 0x42, 0x42, 0xC6,
+  0xC6, 0x84, 0x84, 0x8C, 0x8C, 0xF8, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0x94, 0x26, 0xF0, 0xF0, 0xF0,
+  0xF8, 0xF8, 0xF8, 0x08, 0x8C, 0x8C, 0x84, 0x84, 0xC6, 0xC6, 0x42, 0x42, 0x63, 0x63, 0x21, 0x21,
+  0x31, 0x31, 0x10, 0x10, 0x18, 0x18, 0x08, 0x08, 0x0C, 0x0C, 0x04, 0x04, 0x06, 0x06, 0x03, 0x03,
+  0x03, 0x03, 0x01, 0x01, 0xA4, 0x09, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xF8, 0x78, 0x38, 0x18, 0x08,
+  0x89, 0x0A, 0x08, 0x18, 0x38, 0x79, 0xF9, 0xF8, 0xF0, 0xE0, 0xC0, 0x81, 0x01, 0x94, 0x09, 0x81,
+  0xC1, 0xE1, 0xF0, 0xF8, 0xF8, 0x79, 0x39, 0x19, 0x08, 0x89, 0x09, 0x08, 0x18, 0x38, 0x78, 0xF8,
+  0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0xAD, 0x09, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0x7F, 0x78, 0x70, 0x60,
+  0x40, 0x89, 0x09, 0x40, 0x60, 0x70, 0x78, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0x95, 0x09, 0x07,
+  0x0F, 0x1F, 0x3F, 0x7F, 0x7F, 0x78, 0x70, 0x60, 0x40, 0x89, 0x09, 0x40, 0x60, 0x70, 0x78, 0x7F,
+  0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0xFF, 0xCA, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8B, 0x05,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE6, 0x06, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x04, 0x8B,
+  0x06, 0x04, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0xFF, 0x8E, 0x14, 0xF0, 0xF0, 0xF0, 0xE0, 0xE0,
+  0xE0, 0x10, 0x30, 0x30, 0x20, 0x20, 0x60, 0x60, 0x40, 0x40, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0x80,
+  0xB9, 0x13, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0x40, 0x40, 0x60, 0x60, 0x20, 0x20, 0x30, 0x30,
+  0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0x9C, 0x26, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x02, 0x06,
+  0x06, 0x04, 0x04, 0x0C, 0x0C, 0x08, 0x08, 0x18, 0x18, 0x10, 0x10, 0x31, 0x31, 0x21, 0x21, 0x63,
+  0x63, 0x42, 0x42, 0xC6, 0xC6, 0x84, 0x84, 0x8C, 0x8C, 0xF8, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0x94,
+  0x26, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0x08, 0x8C, 0x8C, 0x84, 0x84, 0xC6, 0xC6, 0x42, 0x42,
+  0x63, 0x63, 0x21, 0x21, 0x31, 0x31, 0x10, 0x10, 0x18, 0x18, 0x08, 0x08, 0x0C, 0x0C, 0x04, 0x04,
+  0x06, 0x06, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0xA4, 0x09, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xF8,
+  0x78, 0x38, 0x18, 0x08, 0x89, 0x0A, 0x08, 0x18, 0x38, 0x79, 0xF9, 0xF8, 0xF0, 0xE0, 0xC0, 0x81,
+  0x01, 0x94, 0x09, 0x81, 0xC1, 0xE1, 0xF0, 0xF8, 0xF8, 0x79, 0x39, 0x19, 0x08, 0x89, 0x09, 0x08,
+  0x18, 0x38, 0x78, 0xF8, 0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0xAD, 0x09, 0x07, 0x0F, 0x1F, 0x3F, 0x7F,
+  0x7F, 0x78, 0x70, 0x60, 0x40, 0x89, 0x09, 0x40, 0x60, 0x70, 0x78, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F,
+  0x07, 0x95, 0x09, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0x7F, 0x78, 0x70, 0x60, 0x40, 0x89, 0x09, 0x40,
+  0x60, 0x70, 0x78, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0xFF, 0xCA, 0x05, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x8B, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE6, 0x06, 0x03, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x04, 0x8B, 0x06, 0x04, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0xFF, 0x8E, 0x14, 0xF0,
+  0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0x10, 0x30, 0x30, 0x20, 0x20, 0x60, 0x60, 0x40, 0x40, 0xC0, 0xC0,
+  0x80, 0x80, 0x80, 0x80, 0xB9, 0x13, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0x40, 0x40, 0x60, 0x60,
+  0x20, 0x20, 0x30, 0x30, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0x9C, 0x26, 0x01, 0x01, 0x01, 0x03,
+  0x03, 0x03, 0x02, 0x06, 0x06, 0x04, 0x04, 0x0C, 0x0C, 0x08, 0x08, 0x18, 0x18, 0x10, 0x10, 0x31,
+  0x31, 0x21, 0x21, 0x63, 0x63, 0x42, 0x42, 0xC6, 0xC6, 0x84, 0x84, 0x8C, 0x8C, 0xF8, 0xF8, 0xF8,
+  0xF8, 0xF0, 0xF0, 0x94, 0x26, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0x08, 0x8C, 0x8C, 0x84, 0x84,
+  0xC6, 0xC6, 0x42, 0x42, 0x63, 0x63, 0x21, 0x21, 0x31, 0x31, 0x10, 0x10, 0x18, 0x18, 0x08, 0x08,
+  0x0C, 0x0C, 0x04, 0x04, 0x06, 0x06, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0xA4, 0x09, 0x80, 0xC0,
+  0xE0, 0xF0, 0xF8, 0xF8, 0x78, 0x38, 0x18, 0x08, 0x89, 0x0A, 0x08, 0x18, 0x38, 0x79, 0xF9, 0xF8,
+  0xF0, 0xE0, 0xC0, 0x81, 0x01, 0x94, 0x09, 0x81, 0xC1, 0xE1, 0xF0, 0xF8, 0xF8, 0x79, 0x39, 0x19,
+  0x08, 0x89, 0x09, 0x08, 0x18, 0x38, 0x78, 0xF8, 0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0xAD, 0x09, 0x07,
+  0x0F, 0x1F, 0x3F, 0x7F, 0x7F, 0x78, 0x70, 0x60, 0x40, 0x89, 0x09, 0x40, 0x60, 0x70, 0x78, 0x7F,
+  0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0x95, 0x09, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0x7F, 0x78, 0x70, 0x60,
+  0x40, 0x89, 0x09, 0x40, 0x60, 0x70, 0x78, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0xFF, 0xCA, 0x05,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8B, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE6, 0x06,
+  0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x04, 0x8B, 0x06, 0x04, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03,
+  0xFF, 0x8E, 0x14, 0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0x10, 0x30, 0x30, 0x20, 0x20, 0x60, 0x60,
+  0x40, 0x40, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0x80, 0xB9, 0x13, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xC0,
+  0x40, 0x40, 0x60, 0x60, 0x20, 0x20, 0x30, 0x30, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0x9C, 0x26,
+  0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x02, 0x06, 0x06, 0x04, 0x04, 0x0C, 0x0C, 0x08, 0x08, 0x18,
+  0x18, 0x10, 0x10, 0x31, 0x31, 0x21, 0x21, 0x63, 0x63, 0x42, 0x42, 0xC6, 0xC6, 0x84, 0x84, 0x8C,
+  0x8C, 0xF8, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0x94, 0x26, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0x08,
+  0x8C, 0x8C, 0x84, 0x84, 0xC6, 0xC6, 0x42, 0x42, 0x63, 0x63, 0x21, 0x21, 0x31, 0x31, 0x10, 0x10,
+  0x18, 0x18, 0x08, 0x08, 0x0C, 0x0C, 0x04, 0x04, 0x06, 0x06, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01,
+  0xA4, 0x09, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xF8, 0x78, 0x38, 0x18, 0x08, 0x89, 0x0A, 0x08, 0x18,
+  0x38, 0x79, 0xF9, 0xF8, 0xF0, 0xE0, 0xC0, 0x81, 0x01, 0x94, 0x09, 0x81, 0xC1, 0xE1, 0xF0, 0xF8,
+  0xF8, 0x79, 0x39, 0x19, 0x08, 0x89, 0x09, 0x08, 0x18, 0x38, 0x78, 0xF8, 0xF8, 0xF0, 0xE0, 0xC0,
+  0x80, 0xAD, 0x09, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0x7F, 0x78, 0x70, 0x60, 0x40, 0x89, 0x09, 0x40,
+  0x60, 0x70, 0x78, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0x95, 0x09, 0x07, 0x0F, 0x1F, 0x3F, 0x7F,
+  0x7F, 0x78, 0x70, 0x60, 0x40, 0x89, 0x09, 0x40, 0x60, 0x70, 0x78, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F,
+  0x07, 0xFF, 0xCA, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8B, 0x05, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0xE6, 0x06, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x04, 0x8B, 0x06, 0x04, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x03, 0xFF, 0x8E, 0x14, 0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0x10, 0x30, 0x30,
+  0x20, 0x20, 0x60, 0x60, 0x40, 0x40, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0x80, 0xB9, 0x13, 0x80, 0x80,
+  0x80, 0x80, 0xC0, 0xC0, 0x40, 0x40, 0x60, 0x60, 0x20, 0x20, 0x30, 0x30, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xF0, 0xF0, 0x9C, 0x26, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x02, 0x06, 0x06, 0x04, 0x04, 0x0C,
+  0x0C, 0x08, 0x08, 0x18, 0x18, 0x10, 0x10, 0x31, 0x31, 0x21, 0x21, 0x63, 0x63, 0x42, 0x42, 0xC6,
+  0xC6, 0x84, 0x84, 0x8C, 0x8C, 0xF8, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0x94, 0x26, 0xF0, 0xF0, 0xF0,
+  0xF8, 0xF8, 0xF8, 0x08, 0x8C, 0x8C, 0x84, 0x84, 0xC6, 0xC6, 0x42, 0x42, 0x63, 0x63, 0x21, 0x21,
+  0x31, 0x31, 0x10, 0x10, 0x18, 0x18, 0x08, 0x08, 0x0C, 0x0C, 0x04, 0x04, 0x06, 0x06, 0x03, 0x03,
+  0x03, 0x03, 0x01, 0x01, 0xA4, 0x09, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xF8, 0x78, 0x38, 0x18, 0x08,
+  0x89, 0x0A, 0x08, 0x18, 0x38, 0x79, 0xF9, 0xF8, 0xF0, 0xE0, 0xC0, 0x81, 0x01, 0x94, 0x09, 0x81,
+  0xC1, 0xE1, 0xF0, 0xF8, 0xF8, 0x79, 0x39, 0x19, 0x08, 0x89, 0x09, 0x08, 0x18, 0x38, 0x78, 0xF8,
+  0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0xAD, 0x09, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0x7F, 0x78, 0x70, 0x60,
+  0x40, 0x89, 0x09, 0x40, 0x60, 0x70, 0x78, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0x95, 0x09, 0x07,
+  0x0F, 0x1F, 0x3F, 0x7F, 0x7F, 0x78, 0x70, 0x60, 0x40, 0x89, 0x09, 0x40, 0x60, 0x70, 0x78, 0x7F,
+  0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0xFF, 0xCA, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8B, 0x05,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE6, 0x06, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x04, 0x8B,
+  0x06, 0x04, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0xFF, 0x8E, 0x14, 0xF0, 0xF0, 0xF0, 0xE0, 0xE0,
+  0xE0, 0x10, 0x30, 0x30, 0x20, 0x20, 0x60, 0x60, 0x40, 0x40, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0x80,
+  0xB9, 0x13, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0x40, 0x40, 0x60, 0x60, 0x20, 0x20, 0x30, 0x30,
+  0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0x9C, 0x26, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x02, 0x06,
+  0x06, 0x04, 0x04, 0x0C, 0x0C, 0x08, 0x08, 0x18, 0x18, 0x10, 0x10, 0x31, 0x31, 0x21, 0x21, 0x63,
+  0x63, 0x42, 0x42, 0xC6, 0xC6, 0x84, 0x84, 0x8C, 0x8C, 0xF8, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0x94,
+  0x26, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0x08, 0x8C, 0x8C, 0x84, 0x84, 0xC6, 0xC6, 0x42, 0x42,
+  0x63, 0x63, 0x21, 0x21, 0x31, 0x31, 0x10, 0x10, 0x18, 0x18, 0x08, 0x08, 0x0C, 0x0C, 0x04, 0x04,
+  0x06, 0x06, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0xA4, 0x09, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xF8,
+  0x78, 0x38, 0x18, 0x08, 0x89, 0x0A, 0x08, 0x18, 0x38, 0x79, 0xF9, 0xF8, 0xF0, 0xE0, 0xC0, 0x81,
+  0x01, 0x94, 0x09, 0x81, 0xC1, 0xE1, 0xF0, 0xF8, 0xF8, 0x79, 0x39, 0x19, 0x08, 0x89, 0x09, 0x08,
+  0x18, 0x38, 0x78, 0xF8, 0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0xAD, 0x09, 0x07, 0x0F, 0x1F, 0x3F, 0x7F,
+  0x7F, 0x78, 0x70, 0x60, 0x40, 0x89, 0x09, 0x40, 0x60, 0x70, 0x78, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F,
+  0x07, 0x95, 0x09, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0x7F, 0x78, 0x70, 0x60, 0x40, 0x89, 0x09, 0x40,
+  0x60, 0x70, 0x78, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0xFF, 0xCA, 0x05, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x8B, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE6, 0x06, 0x03, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x04, 0x8B, 0x06, 0x04, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0xFF, 0x8E, 0x14, 0xF0,
+  0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0x10, 0x30, 0x30, 0x20, 0x20, 0x60, 0x60, 0x40, 0x40, 0xC0, 0xC0,
+  0x80, 0x80, 0x80, 0x80, 0xB9, 0x13, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0x40, 0x40, 0x60, 0x60,
+  0x20, 0x20, 0x30, 0x30, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0x9C, 0x26, 0x01, 0x01, 0x01, 0x03,
+  0x03, 0x03, 0x02, 0x06, 0x06, 0x04, 0x04, 0x0C, 0x0C, 0x08, 0x08, 0x18, 0x18, 0x10, 0x10, 0x31,
+  0x31, 0x21, 0x21, 0x63, 0x63, 0x42, 0x42, 0xC6, 0xC6, 0x84, 0x84, 0x8C, 0x8C, 0xF8, 0xF8, 0xF8,
+  0xF8, 0xF0, 0xF0, 0x94, 0x26, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0x08, 0x8C, 0x8C, 0x84, 0x84,
+  0xC6, 0xC6, 0x42, 0x42, 0x63, 0x63, 0x21, 0x21, 0x31, 0x31, 0x10, 0x10, 0x18, 0x18, 0x08, 0x08,
+  0x0C, 0x0C, 0x04, 0x04, 0x06, 0x06, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0xA4, 0x09, 0x80, 0xC0,
+  0xE0, 0xF0, 0xF8, 0xF8, 0x78, 0x38, 0x18, 0x08, 0x89, 0x0A, 0x08, 0x18, 0x38, 0x79, 0xF9, 0xF8,
+  0xF0, 0xE0, 0xC0, 0x81, 0x01, 0x94, 0x09, 0x81, 0xC1, 0xE1, 0xF0, 0xF8, 0xF8, 0x79, 0x39, 0x19,
+  0x08, 0x89, 0x09, 0x08, 0x18, 0x38, 0x78, 0xF8, 0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0xAD, 0x09, 0x07,
+  0x0F, 0x1F, 0x3F, 0x7F, 0x7F, 0x78, 0x70, 0x60, 0x40, 0x89, 0x09, 0x40, 0x60, 0x70, 0x78, 0x7F,
+  0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0x95, 0x09, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0x7F, 0x78, 0x70, 0x60,
+  0x40, 0x89, 0x09, 0x40, 0x60, 0x70, 0x78, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0xFF, 0xCA, 0x05,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8B, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE6, 0x06,
+  0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x04, 0x8B, 0x06, 0x04, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03,
+  0xFF, 0x8E, 0x14, 0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0x10, 0x30, 0x30, 0x20, 0x20, 0x60, 0x60,
+  0x40, 0x40, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0x80, 0xB9, 0x13, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xC0,
+  0x40, 0x40, 0x60, 0x60, 0x20, 0x20, 0x30, 0x30, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0x9C, 0x26,
+  0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x02, 0x06, 0x06, 0x04, 0x04, 0x0C, 0x0C, 0x08, 0x08, 0x18,
+  0x18, 0x10, 0x10, 0x31, 0x31, 0x21, 0x21, 0x63, 0x63, 0x42, 0x42, 0xC6, 0xC6, 0x84, 0x84, 0x8C,
+  0x8C, 0xF8, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0x94, 0x26, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0x08,
+  0x8C, 0x8C, 0x84, 0x84, 0xC6, 0xC6, 0x42, 0x42, 0x63, 0x63, 0x21, 0x21, 0x31, 0x31, 0x10, 0x10,
+  0x18, 0x18, 0x08, 0x08, 0x0C, 0x0C, 0x04, 0x04, 0x06, 0x06, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01,
+  0xA4, 0x09, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xF8, 0x78, 0x38, 0x18, 0x08, 0x89, 0x0A, 0x08, 0x18,
+  0x38, 0x79, 0xF9, 0xF8, 0xF0, 0xE0, 0xC0, 0x81, 0x01, 0x94, 0x09, 0x81, 0xC1, 0xE1, 0xF0, 0xF8,
+  0xF8, 0x79, 0x39, 0x19, 0x08, 0x89, 0x09, 0x08, 0x18, 0x38, 0x78, 0xF8, 0xF8, 0xF0, 0xE0, 0xC0,
+  0x80, 0xAD, 0x09, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0x7F, 0x78, 0x70, 0x60, 0x40, 0x89, 0x09, 0x40,
+  0x60, 0x70, 0x78, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0x95, 0x09, 0x07, 0x0F, 0x1F, 0x3F, 0x7F,
+  0x7F, 0x78, 0x70, 0x60, 0x40, 0x89, 0x09, 0x40, 0x60, 0x70, 0x78, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F,
+  0x07, 0xFF, 0xCA, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8B, 0x05, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0xE6, 0x06, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x04, 0x8B, 0x06, 0x04, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x03, 0xFF, 0x8E, 0x14, 0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0x10, 0x30, 0x30,
+  0x20, 0x20, 0x60, 0x60, 0x40, 0x40, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0x80, 0xB9, 0x13, 0x80, 0x80,
+  0x80, 0x80, 0xC0, 0xC0, 0x40, 0x40, 0x60, 0x60, 0x20, 0x20, 0x30, 0x30, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xF0, 0xF0, 0x9C, 0x26, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x02, 0x06, 0x06, 0x04, 0x04, 0x0C,
+  0x0C, 0x08, 0x08, 0x18, 0x18, 0x10, 0x10, 0x31, 0x31, 0x21, 0x21, 0x63, 0x63, 0x42, 0x42, 0xC6,
+  0xC6, 0x84, 0x84, 0x8C, 0x8C, 0xF8, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0x94, 0x26, 0xF0, 0xF0, 0xF0,
+  0xF8, 0xF8, 0xF8, 0x08, 0x8C, 0x8C, 0x84, 0x84, 0xC6, 0xC6, 0x42, 0x42, 0x63, 0x63, 0x21, 0x21,
+  0x31, 0x31, 0x10, 0x10, 0x18, 0x18, 0x08, 0x08, 0x0C, 0x0C, 0x04, 0x04, 0x06, 0x06, 0x03, 0x03,
+  0x03, 0x03, 0x01, 0x01, 0xA4, 0x09, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xF8, 0x78, 0x38, 0x18, 0x08,
+  0x89, 0x0A, 0x08, 0x18, 0x38, 0x79, 0xF9, 0xF8, 0xF0, 0xE0, 0xC0, 0x81, 0x01, 0x94, 0x09, 0x81,
+  0xC1, 0xE1, 0xF0, 0xF8, 0xF8, 0x79, 0x39, 0x19, 0x08, 0x89, 0x09, 0x08, 0x18, 0x38, 0x78, 0xF8,
+  0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0xAD, 0x09, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0x7F, 0x78, 0x70, 0x60,
+  0x40, 0x89, 0x09, 0x40, 0x60, 0x70, 0x78, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0x95, 0x09, 0x07,
+  0x0F, 0x1F, 0x3F, 0x7F, 0x7F, 0x78, 0x70, 0x60, 0x40, 0x89, 0x09, 0x40, 0x60, 0x70, 0x78, 0x7F,
+  0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0xFF, 0xCA, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8B, 0x05,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE6, 0x06, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x04, 0x8B,
+  0x06, 0x04, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0xFF, 0x8E, 0x14, 0xF0, 0xF0, 0xF0, 0xE0, 0xE0,
+  0xE0, 0x10, 0x30, 0x30, 0x20, 0x20, 0x60, 0x60, 0x40, 0x40, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0x80,
+  0xB9, 0x13, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0x40, 0x40, 0x60, 0x60, 0x20, 0x20, 0x30, 0x30,
+  0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0x9C, 0x26, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x02, 0x06,
+  0x06, 0x04, 0x04, 0x0C, 0x0C, 0x08, 0x08, 0x18, 0x18, 0x10, 0x10, 0x31, 0x31, 0x21, 0x21, 0x63,
+  0x63, 0x42, 0x42, 0xC6, 0xC6, 0x84, 0x84, 0x8C, 0x8C, 0xF8, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0x94,
+  0x26, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0x08, 0x8C, 0x8C, 0x84, 0x84, 0xC6, 0xC6, 0x42, 0x42,
+  0x63, 0x63, 0x21, 0x21, 0x31, 0x31, 0x10, 0x10, 0x18, 0x18, 0x08, 0x08, 0x0C, 0x0C, 0x04, 0x04,
+  0x06, 0x06, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0xA4, 0x09, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xF8,
+  0x78, 0x38, 0x18, 0x08, 0x89, 0x0A, 0x08, 0x18, 0x38, 0x79, 0xF9, 0xF8, 0xF0, 0xE0, 0xC0, 0x81,
+  0x01, 0x94, 0x09, 0x81, 0xC1, 0xE1, 0xF0, 0xF8, 0xF8, 0x79, 0x39, 0x19, 0x08, 0x89, 0x09, 0x08,
+  0x18, 0x38, 0x78, 0xF8, 0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0xAD, 0x09, 0x07, 0x0F, 0x1F, 0x3F, 0x7F,
+  0x7F, 0x78, 0x70, 0x60, 0x40, 0x89, 0x09, 0x40, 0x60, 0x70, 0x78, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F,
+  0x07, 0x95, 0x09, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0x7F, 0x78, 0x70, 0x60, 0x40, 0x89, 0x09, 0x40,
+  0x60, 0x70, 0x78, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0xFF, 0xCA, 0x05, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x8B, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE6, 0x06, 0x03, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x04, 0x8B, 0x06, 0x04, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0xFF, 0x8E, 0x14, 0xF0,
+  0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0x10, 0x30, 0x30, 0x20, 0x20, 0x60, 0x60, 0x40, 0x40, 0xC0, 0xC0,
+  0x80, 0x80, 0x80, 0x80, 0xB9, 0x13, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0x40, 0x40, 0x60, 0x60,
+  0x20, 0x20, 0x30, 0x30, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0x9C, 0x26, 0x01, 0x01, 0x01, 0x03,
+  0x03, 0x03, 0x02, 0x06, 0x06, 0x04, 0x04, 0x0C, 0x0C, 0x08, 0x08, 0x18, 0x18, 0x10, 0x10, 0x31,
+  0x31, 0x21, 0x21, 0x63, 0x63, 0x42, 0x42, 0xC6, 0xC6, 0x84, 0x84, 0x8C, 0x8C, 0xF8, 0xF8, 0xF8,
+  0xF8, 0xF0, 0xF0, 0x94, 0x26, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0x08, 0x8C, 0x8C, 0x84, 0x84,
+  0xC6, 0xC6, 0x42, 0x42, 0x63, 0x63, 0x21, 0x21, 0x31, 0x31, 0x10, 0x10, 0x18, 0x18, 0x08, 0x08,
+  0x0C, 0x0C, 0x04, 0x04, 0x06, 0x06, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0xA4, 0x09, 0x80, 0xC0,
+  0xE0, 0xF0, 0xF8, 0xF8, 0x78, 0x38, 0x18, 0x08, 0x89, 0x0A, 0x08, 0x18, 0x38, 0x79, 0xF9, 0xF8,
+  0xF0, 0xE0, 0xC0, 0x81, 0x01, 0x94, 0x09, 0x81, 0xC1, 0xE1, 0xF0, 0xF8, 0xF8, 0x79, 0x39, 0x19,
+  0x08, 0x89, 0x09, 0x08, 0x18, 0x38, 0x78, 0xF8, 0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0xAD, 0x09, 0x07,
+  0x0F, 0x1F, 0x3F, 0x7F, 0x7F, 0x78, 0x70, 0x60, 0x40, 0x89, 0x09, 0x40, 0x60, 0x70, 0x78, 0x7F,
+  0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0x95, 0x09, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0x7F, 0x78, 0x70, 0x60,
+  0x40, 0x89, 0x09, 0x40, 0x60, 0x70, 0x78, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0xFF, 0xCA, 0x05,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8B, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE6, 0x06,
+  0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x04, 0x8B, 0x06, 0x04, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03,
+  0xFF, 0x8E, 0x14, 0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0x10, 0x30, 0x30, 0x20, 0x20, 0x60, 0x60,
+  0x40, 0x40, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0x80, 0xB9, 0x13, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xC0,
+  0x40, 0x40, 0x60, 0x60, 0x20, 0x20, 0x30, 0x30, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0x9C, 0x26,
+  0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x02, 0x06, 0x06, 0x04, 0x04, 0x0C, 0x0C, 0x08, 0x08, 0x18,
+  0x18, 0x10, 0x10, 0x31, 0x31, 0x21, 0x21, 0x63, 0x63, 0x42, 0x42, 0xC6, 0xC6, 0x84, 0x84, 0x8C,
+  0x8C, 0xF8, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0x94, 0x26, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0x08,
+  0x8C, 0x8C, 0x84, 0x84, 0xC6, 0xC6, 0x42, 0x42, 0x63, 0x63, 0x21, 0x21, 0x31, 0x31, 0x10, 0x10,
+  0x18, 0x18, 0x08, 0x08, 0x0C, 0x0C, 0x04, 0x04, 0x06, 0x06, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01,
+  0xA4, 0x09, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xF8, 0x78, 0x38, 0x18, 0x08, 0x89, 0x0A, 0x08, 0x18,
+  0x38, 0x79, 0xF9, 0xF8, 0xF0, 0xE0, 0xC0, 0x81, 0x01, 0x94, 0x09, 0x81, 0xC1, 0xE1, 0xF0, 0xF8,
+  0xF8, 0x79, 0x39, 0x19, 0x08, 0x89, 0x09, 0x08, 0x18, 0x38, 0x78, 0xF8, 0xF8, 0xF0, 0xE0, 0xC0,
+  0x80, 0xAD, 0x09, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0x7F, 0x78, 0x70, 0x60, 0x40, 0x89, 0x09, 0x40,
+  0x60, 0x70, 0x78, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0x95, 0x09, 0x07, 0x0F, 0x1F, 0x3F, 0x7F,
+  0x7F, 0x78, 0x70, 0x60, 0x40, 0x89, 0x09, 0x40, 0x60, 0x70, 0x78, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F,
+  0x07, 0xFF, 0xCA, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8B, 0x05, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0xE6, 0x06, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x04, 0x8B, 0x06, 0x04, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x03, 0xFF, 0x8E, 0x19, 0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0x38, 0x38,
+  0x38, 0x30, 0x70, 0x70, 0x70, 0x60, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x80,
+  0x80, 0xB4, 0x14, 0x80, 0x80, 0x80, 0x00, 0x40, 0x40, 0x40, 0x00, 0x20, 0x20, 0x20, 0x00, 0x10,
+  0x10, 0xE0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0x9B, 0x27, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03,
+  0x03, 0x06, 0x06, 0x06, 0x04, 0x0C, 0x0C, 0x0C, 0x08, 0x18, 0x18, 0x18, 0x10, 0x31, 0x31, 0x31,
+  0x21, 0x63, 0x63, 0x63, 0x43, 0xC7, 0xC7, 0xC7, 0x86, 0x8E, 0x8E, 0x7E, 0xFC, 0xFC, 0xFC, 0xFC,
+  0xF8, 0xF8, 0x93, 0x27, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0xF8, 0x84, 0x84, 0x84, 0x80, 0xC2,
+  0xC2, 0xC2, 0x40, 0x61, 0x61, 0x61, 0x20, 0x30, 0x30, 0x30, 0x10, 0x18, 0x18, 0x18, 0x08, 0x0C,
+  0x0C, 0x0C, 0x04, 0x06, 0x06, 0x07, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0xA3, 0x1F, 0x80, 0xC0,
+  0xE0, 0xF0, 0xF8, 0xF8, 0xF8, 0x78, 0x38, 0x18, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x00, 0x10, 0x30, 0x71, 0xF1, 0xF0, 0xF0, 0xF0, 0xE0, 0xC0, 0x81, 0x01, 0x93, 0x1E,
+  0x81, 0xC1, 0xE1, 0xF0, 0xF8, 0xF8, 0xF8, 0x79, 0x39, 0x19, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x00, 0x10, 0x30, 0x70, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0xC0, 0x80, 0xAC,
+  0x09, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0x7F, 0x7F, 0x70, 0x60, 0x40, 0x89, 0x0A, 0x40, 0x60, 0x70,
+  0x78, 0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F, 0x94, 0x09, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0x7F,
+  0x7F, 0x70, 0x60, 0x40, 0x89, 0x0A, 0x40, 0x60, 0x70, 0x78, 0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x1F,
+  0x0F, 0xFF, 0xC9, 0x06, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8A, 0x06, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0xE5, 0x07, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x04, 0x8A, 0x07,
+  0x04, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0xFF, 0x8D, 0x1A, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xE0, 0x18, 0x18, 0x18, 0x30, 0x30, 0x30, 0x30, 0x60, 0x60, 0x60, 0x60, 0xC0, 0xC0,
+  0xC0, 0xC0, 0x80, 0x80, 0x80, 0x80, 0xAF, 0x19, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0,
+  0x60, 0x60, 0x60, 0x60, 0x30, 0x30, 0x30, 0x30, 0x18, 0x18, 0xE0, 0xE0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF8, 0xF8, 0x9A, 0x28, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x07, 0x06, 0x06, 0x06, 0x0C,
+  0x0C, 0x0C, 0x0C, 0x18, 0x18, 0x18, 0x18, 0x30, 0x30, 0x30, 0x30, 0x61, 0x61, 0x61, 0x61, 0xC3,
+  0xC3, 0xC3, 0xC3, 0x86, 0x86, 0x7E, 0x7E, 0xFC, 0xFC, 0xFC, 0xFC, 0xF8, 0xF8, 0x92, 0x28, 0xF8,
+  0xF8, 0xF8, 0xFC, 0xFC, 0xFC, 0xFC, 0x7E, 0x86, 0x86, 0x86, 0xC3, 0xC3, 0xC3, 0xC3, 0x61, 0x61,
+  0x61, 0x61, 0x30, 0x30, 0x30, 0x30, 0x18, 0x18, 0x18, 0x18, 0x0C, 0x0C, 0x0C, 0x0C, 0x06, 0x06,
+  0x07, 0x07, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0xA2, 0x0A, 0x80, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0x70, 0x30, 0x10, 0x89, 0x0B, 0x10, 0x30, 0x71, 0xF1, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0,
+  0xC0, 0x81, 0x01, 0x92, 0x0A, 0x81, 0xC1, 0xE1, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x71, 0x31, 0x11,
+  0x89, 0x0A, 0x10, 0x30, 0x70, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0xC0, 0x80, 0xAB, 0x0A, 0x0F,
+  0x1F, 0x3F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x70, 0x60, 0x40, 0x89, 0x0A, 0x40, 0x60, 0x70, 0x7F,
+  0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F, 0x93, 0x0A, 0x0F, 0x1F, 0x3F, 0x7F, 0x7F, 0x7F, 0x7F,
+  0x7F, 0x70, 0x60, 0x40, 0x89, 0x0A, 0x40, 0x60, 0x70, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x1F,
+  0x0F, 0xFF, 0xC8, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x89, 0x07, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE4, 0x08, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x04, 0x89, 0x08, 0x04, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0xFF, 0x8D, 0x1A, 0xF8,
+  0xF8, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x18, 0x18, 0x18, 0x30, 0x30, 0x30, 0x30, 0x60, 0x60,
+  0x60, 0x60, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0x80, 0xAF, 0x19, 0x80, 0x80, 0x80, 0x80,
+  0xC0, 0xC0, 0xC0, 0xC0, 0x60, 0x60, 0x60, 0x60, 0x30, 0x30, 0x30, 0x30, 0x18, 0x18, 0xE0, 0xE0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0x9A, 0x28, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x07,
+  0x06, 0x06, 0x06, 0x0C, 0x0C, 0x0C, 0x0C, 0x18, 0x18, 0x18, 0x18, 0x30, 0x30, 0x30, 0x30, 0x61,
+  0x61, 0x61, 0x61, 0xC3, 0xC3, 0xC3, 0xC3, 0x86, 0x86, 0x7E, 0x7E, 0xFC, 0xFC, 0xFC, 0xFC, 0xF8,
+  0xF8, 0x92, 0x28, 0xF8, 0xF8, 0xF8, 0xFC, 0xFC, 0xFC, 0xFC, 0x7E, 0x86, 0x86, 0x86, 0xC3, 0xC3,
+  0xC3, 0xC3, 0x61, 0x61, 0x61, 0x61, 0x30, 0x30, 0x30, 0x30, 0x18, 0x18, 0x18, 0x18, 0x0C, 0x0C,
+  0x0C, 0x0C, 0x06, 0x06, 0x07, 0x07, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0xA2, 0x0A, 0x80, 0xC0,
+  0xE0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x70, 0x30, 0x10, 0x89, 0x0B, 0x10, 0x30, 0x71, 0xF1, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xE0, 0xC0, 0x81, 0x01, 0x92, 0x0A, 0x81, 0xC1, 0xE1, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0x71, 0x31, 0x11, 0x89, 0x0A, 0x10, 0x30, 0x70, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0xC0,
+  0x80, 0xAB, 0x0A, 0x0F, 0x1F, 0x3F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x70, 0x60, 0x40, 0x89, 0x0A,
+  0x40, 0x60, 0x70, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F, 0x93, 0x0A, 0x0F, 0x1F, 0x3F,
+  0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x70, 0x60, 0x40, 0x89, 0x0A, 0x40, 0x60, 0x70, 0x7F, 0x7F, 0x7F,
+  0x7F, 0x7F, 0x3F, 0x1F, 0x0F, 0xFF, 0xC8, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x89, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE4, 0x08, 0x03, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x04, 0x89, 0x08, 0x04, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03,
+  0xFF, 0x8D, 0x1A, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x18, 0x18, 0x18, 0x30, 0x30,
+  0x30, 0x30, 0x60, 0x60, 0x60, 0x60, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0x80, 0xAF, 0x19,
+  0x80, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0x60, 0x60, 0x60, 0x60, 0x30, 0x30, 0x30, 0x30,
+  0x18, 0x18, 0xE0, 0xE0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0x9A, 0x28, 0x01, 0x01, 0x01, 0x03,
+  0x03, 0x03, 0x03, 0x07, 0x06, 0x06, 0x06, 0x0C, 0x0C, 0x0C, 0x0C, 0x18, 0x18, 0x18, 0x18, 0x30,
+  0x30, 0x30, 0x30, 0x61, 0x61, 0x61, 0x61, 0xC3, 0xC3, 0xC3, 0xC3, 0x86, 0x86, 0x7E, 0x7E, 0xFC,
+  0xFC, 0xFC, 0xFC, 0xF8, 0xF8, 0x92, 0x28, 0xF8, 0xF8, 0xF8, 0xFC, 0xFC, 0xFC, 0xFC, 0x7E, 0x86,
+  0x86, 0x86, 0xC3, 0xC3, 0xC3, 0xC3, 0x61, 0x61, 0x61, 0x61, 0x30, 0x30, 0x30, 0x30, 0x18, 0x18,
+  0x18, 0x18, 0x0C, 0x0C, 0x0C, 0x0C, 0x06, 0x06, 0x07, 0x07, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01,
+  0xA2, 0x0A, 0x80, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x70, 0x30, 0x10, 0x89, 0x0B, 0x10,
+  0x30, 0x71, 0xF1, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0xC0, 0x81, 0x01, 0x92, 0x0A, 0x81, 0xC1, 0xE1,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x71, 0x31, 0x11, 0x89, 0x0A, 0x10, 0x30, 0x70, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xE0, 0xC0, 0x80, 0xAB, 0x0A, 0x0F, 0x1F, 0x3F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x70,
+  0x60, 0x40, 0x89, 0x0A, 0x40, 0x60, 0x70, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F, 0x93,
+  0x0A, 0x0F, 0x1F, 0x3F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x70, 0x60, 0x40, 0x89, 0x0A, 0x40, 0x60,
+  0x70, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F, 0xFF, 0xC8, 0x07, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x89, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE4, 0x08,
+  0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x04, 0x89, 0x08, 0x04, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x03, 0xFF, 0x8D, 0x1A, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x18,
+  0x18, 0x18, 0x30, 0x30, 0x30, 0x30, 0x60, 0x60, 0x60, 0x60, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80,
+  0x80, 0x80, 0xAF, 0x19, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0x60, 0x60, 0x60, 0x60,
+  0x30, 0x30, 0x30, 0x30, 0x18, 0x18, 0xE0, 0xE0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0x9A, 0x28,
+  0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x07, 0x06, 0x06, 0x06, 0x0C, 0x0C, 0x0C, 0x0C, 0x18,
+  0x18, 0x18, 0x18, 0x30, 0x30, 0x30, 0x30, 0x61, 0x61, 0x61, 0x61, 0xC3, 0xC3, 0xC3, 0xC3, 0x86,
+  0x86, 0x7E, 0x7E, 0xFC, 0xFC, 0xFC, 0xFC, 0xF8, 0xF8, 0x92, 0x28, 0xF8, 0xF8, 0xF8, 0xFC, 0xFC,
+  0xFC, 0xFC, 0x7E, 0x86, 0x86, 0x86, 0xC3, 0xC3, 0xC3, 0xC3, 0x61, 0x61, 0x61, 0x61, 0x30, 0x30,
+  0x30, 0x30, 0x18, 0x18, 0x18, 0x18, 0x0C, 0x0C, 0x0C, 0x0C, 0x06, 0x06, 0x07, 0x07, 0x03, 0x03,
+  0x03, 0x03, 0x01, 0x01, 0xA2, 0x0A, 0x80, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x70, 0x30,
+  0x10, 0x89, 0x0B, 0x10, 0x30, 0x71, 0xF1, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0xC0, 0x81, 0x01, 0x92,
+  0x0A, 0x81, 0xC1, 0xE1, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x71, 0x31, 0x11, 0x89, 0x0A, 0x10, 0x30,
+  0x70, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0xC0, 0x80, 0xAB, 0x0A, 0x0F, 0x1F, 0x3F, 0x7F, 0x7F,
+  0x7F, 0x7F, 0x7F, 0x70, 0x60, 0x40, 0x89, 0x0A, 0x40, 0x60, 0x70, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
+  0x3F, 0x1F, 0x0F, 0x93, 0x0A, 0x0F, 0x1F, 0x3F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x70, 0x60, 0x40,
+  0x89, 0x0A, 0x40, 0x60, 0x70, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F, 0xFF, 0xC8, 0x07,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x89, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0xE4, 0x08, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x04, 0x89, 0x08, 0x04,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0xFF, 0x8D, 0x1A, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xE0, 0x18, 0x18, 0x18, 0x30, 0x30, 0x30, 0x30, 0x60, 0x60, 0x60, 0x60, 0xC0, 0xC0,
+  0xC0, 0xC0, 0x80, 0x80, 0x80, 0x80, 0xAF, 0x19, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0,
+  0x60, 0x60, 0x60, 0x60, 0x30, 0x30, 0x30, 0x30, 0x18, 0x18, 0xE0, 0xE0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF8, 0xF8, 0x9A, 0x28, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x07, 0x06, 0x06, 0x06, 0x0C,
+  0x0C, 0x0C, 0x0C, 0x18, 0x18, 0x18, 0x18, 0x30, 0x30, 0x30, 0x30, 0x61, 0x61, 0x61, 0x61, 0xC3,
+  0xC3, 0xC3, 0xC3, 0x86, 0x86, 0x7E, 0x7E, 0xFC, 0xFC, 0xFC, 0xFC, 0xF8, 0xF8, 0x92, 0x28, 0xF8,
+  0xF8, 0xF8, 0xFC, 0xFC, 0xFC, 0xFC, 0x7E, 0x86, 0x86, 0x86, 0xC3, 0xC3, 0xC3, 0xC3, 0x61, 0x61,
+  0x61, 0x61, 0x30, 0x30, 0x30, 0x30, 0x18, 0x18, 0x18, 0x18, 0x0C, 0x0C, 0x0C, 0x0C, 0x06, 0x06,
+  0x07, 0x07, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0xA2, 0x0A, 0x80, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0x70, 0x30, 0x10, 0x89, 0x0B, 0x10, 0x30, 0x71, 0xF1, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0,
+  0xC0, 0x81, 0x01, 0x92, 0x0A, 0x81, 0xC1, 0xE1, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x71, 0x31, 0x11,
+  0x89, 0x0A, 0x10, 0x30, 0x70, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0xC0, 0x80, 0xAB, 0x0A, 0x0F,
+  0x1F, 0x3F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x70, 0x60, 0x40, 0x89, 0x0A, 0x40, 0x60, 0x70, 0x7F,
+  0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F, 0x93, 0x0A, 0x0F, 0x1F, 0x3F, 0x7F, 0x7F, 0x7F, 0x7F,
+  0x7F, 0x70, 0x60, 0x40, 0x89, 0x0A, 0x40, 0x60, 0x70, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x1F,
+  0x0F, 0xFF, 0xC8, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x89, 0x07, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE4, 0x08, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x04, 0x89, 0x08, 0x04, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0xFF, 0x8D, 0x1A, 0xF8,
+  0xF8, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x18, 0x18, 0x18, 0x30, 0x30, 0x30, 0x30, 0x60, 0x60,
+  0x60, 0x60, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0x80, 0xAF, 0x19, 0x80, 0x80, 0x80, 0x80,
+  0xC0, 0xC0, 0xC0, 0xC0, 0x60, 0x60, 0x60, 0x60, 0x30, 0x30, 0x30, 0x30, 0x18, 0x18, 0xE0, 0xE0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0x9A, 0x28, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x07,
+  0x06, 0x06, 0x06, 0x0C, 0x0C, 0x0C, 0x0C, 0x18, 0x18, 0x18, 0x18, 0x30, 0x30, 0x30, 0x30, 0x61,
+  0x61, 0x61, 0x61, 0xC3, 0xC3, 0xC3, 0xC3, 0x86, 0x86, 0x7E, 0x7E, 0xFC, 0xFC, 0xFC, 0xFC, 0xF8,
+  0xF8, 0x92, 0x28, 0xF8, 0xF8, 0xF8, 0xFC, 0xFC, 0xFC, 0xFC, 0x7E, 0x86, 0x86, 0x86, 0xC3, 0xC3,
+  0xC3, 0xC3, 0x61, 0x61, 0x61, 0x61, 0x30, 0x30, 0x30, 0x30, 0x18, 0x18, 0x18, 0x18, 0x0C, 0x0C,
+  0x0C, 0x0C, 0x06, 0x06, 0x07, 0x07, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0xA2, 0x0A, 0x80, 0xC0,
+  0xE0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x70, 0x30, 0x10, 0x89, 0x0B, 0x10, 0x30, 0x71, 0xF1, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xE0, 0xC0, 0x81, 0x01, 0x92, 0x0A, 0x81, 0xC1, 0xE1, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0x71, 0x31, 0x11, 0x89, 0x0A, 0x10, 0x30, 0x70, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0xC0,
+  0x80, 0xAB, 0x0A, 0x0F, 0x1F, 0x3F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x70, 0x60, 0x40, 0x89, 0x0A,
+  0x40, 0x60, 0x70, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F, 0x93, 0x0A, 0x0F, 0x1F, 0x3F,
+  0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x70, 0x60, 0x40, 0x89, 0x0A, 0x40, 0x60, 0x70, 0x7F, 0x7F, 0x7F,
+  0x7F, 0x7F, 0x3F, 0x1F, 0x0F, 0xFF, 0xC8, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x89, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE4, 0x08, 0x03, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x04, 0x89, 0x08, 0x04, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03,
+  0xFF, 0x8D, 0x1A, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x18, 0x18, 0x18, 0x30, 0x30,
+  0x30, 0x30, 0x60, 0x60, 0x60, 0x60, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0x80, 0xAF, 0x19,
+  0x80, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0x60, 0x60, 0x60, 0x60, 0x30, 0x30, 0x30, 0x30,
+  0x18, 0x18, 0xE0, 0xE0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0x9A, 0x28, 0x01, 0x01, 0x01, 0x03,
+  0x03, 0x03, 0x03, 0x07, 0x06, 0x06, 0x06, 0x0C, 0x0C, 0x0C, 0x0C, 0x18, 0x18, 0x18, 0x18, 0x30,
+  0x30, 0x30, 0x30, 0x61, 0x61, 0x61, 0x61, 0xC3, 0xC3, 0xC3, 0xC3, 0x86, 0x86, 0x7E, 0x7E, 0xFC,
+  0xFC, 0xFC, 0xFC, 0xF8, 0xF8, 0x92, 0x28, 0xF8, 0xF8, 0xF8, 0xFC, 0xFC, 0xFC, 0xFC, 0x7E, 0x86,
+  0x86, 0x86, 0xC3, 0xC3, 0xC3, 0xC3, 0x61, 0x61, 0x61, 0x61, 0x30, 0x30, 0x30, 0x30, 0x18, 0x18,
+  0x18, 0x18, 0x0C, 0x0C, 0x0C, 0x0C, 0x06, 0x06, 0x07, 0x07, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01,
+  0xA2, 0x0A, 0x80, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x70, 0x30, 0x10, 0x89, 0x0B, 0x10,
+  0x30, 0x71, 0xF1, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0xC0, 0x81, 0x01, 0x92, 0x0A, 0x81, 0xC1, 0xE1,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x71, 0x31, 0x11, 0x89, 0x0A, 0x10, 0x30, 0x70, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xE0, 0xC0, 0x80, 0xAB, 0x0A, 0x0F, 0x1F, 0x3F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x70,
+  0x60, 0x40, 0x89, 0x0A, 0x40, 0x60, 0x70, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F, 0x93,
+  0x0A, 0x0F, 0x1F, 0x3F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x70, 0x60, 0x40, 0x89, 0x0A, 0x40, 0x60,
+  0x70, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F, 0xFF, 0xC8, 0x07, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x89, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE4, 0x08,
+  0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x04, 0x89, 0x08, 0x04, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x03, 0xFF, 0x8D, 0x1A, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0x18,
+  0x18, 0x18, 0x30, 0x30, 0x30, 0x30, 0x60, 0x60, 0x60, 0x60, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80,
+  0x80, 0x80, 0xAF, 0x19, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0x60, 0x60, 0x60, 0x60,
+  0x30, 0x30, 0x30, 0x30, 0x18, 0x18, 0xE0, 0xE0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0x9A, 0x28,
+  0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x07, 0x06, 0x06, 0x06, 0x0C, 0x0C, 0x0C, 0x0C, 0x18,
+  0x18, 0x18, 0x18, 0x30, 0x30, 0x30, 0x30, 0x61, 0x61, 0x61, 0x61, 0xC3, 0xC3, 0xC3, 0xC3, 0x86,
+  0x86, 0x7E, 0x7E, 0xFC, 0xFC, 0xFC, 0xFC, 0xF8, 0xF8, 0x92, 0x28, 0xF8, 0xF8, 0xF8, 0xFC, 0xFC,
+  0xFC, 0xFC, 0x7E, 0x86, 0x86, 0x86, 0xC3, 0xC3, 0xC3, 0xC3, 0x61, 0x61, 0x61, 0x61, 0x30, 0x30,
+  0x30, 0x30, 0x18, 0x18, 0x18, 0x18, 0x0C, 0x0C, 0x0C, 0x0C, 0x06, 0x06, 0x07, 0x07, 0x03, 0x03,
+  0x03, 0x03, 0x01, 0x01, 0xA2, 0x0A, 0x80, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x70, 0x30,
+  0x10, 0x89, 0x0B, 0x10, 0x30, 0x71, 0xF1, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0xC0, 0x81, 0x01, 0x92,
+  0x0A, 0x81, 0xC1, 0xE1, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x71, 0x31, 0x11, 0x89, 0x0A, 0x10, 0x30,
+  0x70, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0xC0, 0x80, 0xAB, 0x0A, 0x0F, 0x1F, 0x3F, 0x7F, 0x7F,
+  0x7F, 0x7F, 0x7F, 0x70, 0x60, 0x40, 0x89, 0x0A, 0x40, 0x60, 0x70, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
+  0x3F, 0x1F, 0x0F, 0x93, 0x0A, 0x0F, 0x1F, 0x3F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x70, 0x60, 0x40,
+  0x89, 0x0A, 0x40, 0x60, 0x70, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F, 0xFF, 0xC8, 0x07,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x89, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0xE4, 0x08, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x04, 0x89, 0x08, 0x04,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0xFF, 0x8D, 0x1A, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xE0, 0x18, 0x18, 0x18, 0x30, 0x30, 0x30, 0x30, 0x60, 0x60, 0x60, 0x60, 0xC0, 0xC0,
+  0xC0, 0xC0, 0x80, 0x80, 0x80, 0x80, 0xAF, 0x19, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0,
+  0x60, 0x60, 0x60, 0x60, 0x30, 0x30, 0x30, 0x30, 0x18, 0x18, 0xE0, 0xE0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF8, 0xF8, 0x9A, 0x28, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x07, 0x06, 0x06, 0x06, 0x0C,
+  0x0C, 0x0C, 0x0C, 0x18, 0x18, 0x18, 0x18, 0x30, 0x30, 0x30, 0x30, 0x61, 0x61, 0x61, 0x61, 0xC3,
+  0xC3, 0xC3, 0xC3, 0x86, 0x86, 0x7E, 0x7E, 0xFC, 0xFC, 0xFC, 0xFC, 0xF8, 0xF8, 0x92, 0x28, 0xF8,
+  0xF8, 0xF8, 0xFC, 0xFC, 0xFC, 0xFC, 0x7E, 0x86, 0x86, 0x86, 0xC3, 0xC3, 0xC3, 0xC3, 0x61, 0x61,
+  0x61, 0x61, 0x30, 0x30, 0x30, 0x30, 0x18, 0x18, 0x18, 0x18, 0x0C, 0x0C, 0x0C, 0x0C, 0x06, 0x06,
+  0x07, 0x07, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0xA2, 0x0A, 0x80, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0x70, 0x30, 0x10, 0x89, 0x0B, 0x10, 0x30, 0x71, 0xF1, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0,
+  0xC0, 0x81, 0x01, 0x92, 0x0A, 0x81, 0xC1, 0xE1, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x71, 0x31, 0x11,
+  0x89, 0x0A, 0x10, 0x30, 0x70, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0xC0, 0x80, 0xAB, 0x0A, 0x0F,
+  0x1F, 0x3F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x70, 0x60, 0x40, 0x89, 0x0A, 0x40, 0x60, 0x70, 0x7F,
+  0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F, 0x93, 0x0A, 0x0F, 0x1F, 0x3F, 0x7F, 0x7F, 0x7F, 0x7F,
+  0x7F, 0x70, 0x60, 0x40, 0x89, 0x0A, 0x40, 0x60, 0x70, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x1F,
+  0x0F, 0xFF, 0xC8, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x89, 0x07, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE4, 0x08, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x04, 0x89, 0x08, 0x04, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0xFF, 0x8D, 0x03, 0xF8,
+  0xF8, 0xF8, 0xF0, 0xC6, 0x15, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0x60, 0x60, 0x60,
+  0x60, 0x30, 0x30, 0x30, 0x30, 0x18, 0x18, 0xE0, 0xE0, 0xF0, 0xF0, 0x9E, 0x1E, 0x01, 0x01, 0x01,
+  0x03, 0x02, 0x02, 0x02, 0x04, 0x04, 0x04, 0x04, 0x08, 0x08, 0x08, 0x08, 0x10, 0x10, 0x10, 0x10,
+  0x20, 0x20, 0x20, 0x20, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x81, 0x03, 0xF8, 0xF8,
+  0xF0, 0xF0, 0x96, 0x24, 0xF8, 0xF8, 0xF8, 0xFC, 0x0C, 0x0C, 0x0C, 0x86, 0x86, 0x86, 0x86, 0x43,
+  0x43, 0x43, 0x43, 0x21, 0x21, 0x21, 0x21, 0x10, 0x10, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x04,
+  0x04, 0x04, 0x04, 0x02, 0x02, 0x03, 0x03, 0x01, 0x01, 0xA6, 0x1C, 0x80, 0xC0, 0xE0, 0xF0, 0x70,
+  0x30, 0x10, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x18, 0x38, 0x79, 0xF1, 0xE0, 0xC0, 0x81, 0x01, 0x96, 0x1B, 0x81, 0xC1, 0xE1, 0xF0, 0x71, 0x31,
+  0x11, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x18,
+  0x38, 0x78, 0xF0, 0xE0, 0xC0, 0x80, 0xAF, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0x78, 0x70, 0x60, 0x40,
+  0x8C, 0x06, 0x40, 0x60, 0x70, 0x3F, 0x1F, 0x0F, 0x07, 0x97, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0x78,
+  0x70, 0x60, 0x40, 0x8C, 0x06, 0x40, 0x60, 0x70, 0x3F, 0x1F, 0x0F, 0x07, 0xFF, 0xCC, 0x16, 0x80,
+  0x80, 0x80, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0xE7, 0x17, 0x03, 0x07, 0x07, 0x07, 0x06, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x03, 0x03, 0x03, 0x01,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x99, 0x17, 0x08, 0x10, 0x20, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x20, 0x10, 0x08, 0x9B, 0x17,
+  0x08, 0x10, 0x20, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x40, 0x20, 0x10, 0x08, 0xFF, 0x91, 0x12, 0x88, 0x88, 0x88, 0x10, 0x10,
+  0x10, 0x10, 0x20, 0x20, 0x20, 0x20, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0xB7, 0x11,
+  0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x20, 0x20, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10,
+  0x88, 0x88, 0xA2, 0x20, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x06, 0x06, 0x06, 0x06, 0x0C,
+  0x0C, 0x0C, 0x0C, 0x18, 0x18, 0x18, 0x18, 0x31, 0x31, 0x31, 0x31, 0x62, 0x62, 0x62, 0x62, 0xC4,
+  0xC4, 0xC4, 0xC4, 0x88, 0x88, 0x9A, 0x20, 0x88, 0x88, 0x88, 0xC4, 0xC4, 0xC4, 0xC4, 0x62, 0x62,
+  0x62, 0x62, 0x31, 0x31, 0x31, 0x31, 0x18, 0x18, 0x18, 0x18, 0x0C, 0x0C, 0x0C, 0x0C, 0x06, 0x06,
+  0x06, 0x06, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0xAA, 0x18, 0x40, 0x30, 0x18, 0x0C, 0x04, 0x06,
+  0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x04, 0x0C, 0x18,
+  0x30, 0x41, 0x01, 0x9A, 0x17, 0x41, 0x31, 0x19, 0x0C, 0x04, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+  0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x04, 0x0C, 0x18, 0x30, 0x40, 0xB3, 0x00, 0x08,
+  0x82, 0x00, 0x80, 0x8D, 0x00, 0x80, 0x82, 0x00, 0x08, 0x9B, 0x00, 0x08, 0x82, 0x00, 0x80, 0x8D,
+  0x00, 0x80, 0x82, 0x00, 0x08, 0xFF, 0x91, 0x16, 0x64, 0x64, 0x64, 0xC8, 0xC8, 0xC8, 0xC8, 0x90,
+  0x90, 0x90, 0x90, 0x20, 0x20, 0x20, 0x20, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0xAF,
+  0x15, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x20, 0x20, 0x20, 0x20, 0x90, 0x90, 0x90,
+  0x90, 0xC8, 0xC8, 0xC8, 0xC8, 0x64, 0x64, 0xA9, 0x19, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x83,
+  0x83, 0x86, 0x86, 0x86, 0x86, 0x8C, 0x8C, 0x8C, 0x8C, 0x99, 0x99, 0x99, 0x99, 0x32, 0x32, 0x32,
+  0x32, 0x64, 0x64, 0x9A, 0x1A, 0x64, 0x64, 0x64, 0x32, 0x32, 0xB2, 0xB2, 0x99, 0x99, 0x99, 0x99,
+  0x8C, 0x8C, 0x8C, 0x8C, 0x86, 0x86, 0x86, 0x86, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0x01, 0x01,
+  0xB0, 0x17, 0x30, 0x0C, 0x06, 0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x06, 0x0C, 0x30, 0x9B, 0x17, 0x30, 0x0C, 0x06, 0x03,
+  0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03,
+  0x03, 0x06, 0x0C, 0x30, 0xB3, 0x17, 0x04, 0x10, 0x20, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x20, 0x10, 0x04, 0x9B, 0x17,
+  0x04, 0x10, 0x20, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x40, 0x40, 0x20, 0x10, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0x99, 0x17, 0x04, 0x10,
+  0x20, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x40, 0x40, 0x20, 0x10, 0x04, 0x9B, 0x17, 0x04, 0x10, 0x20, 0x40, 0x40, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x20, 0x10, 0x04,
+  0xFF, 0x91, 0x1A, 0x1A, 0x1A, 0x1A, 0x34, 0x34, 0x34, 0x34, 0x68, 0x68, 0x68, 0x68, 0xD0, 0xD0,
+  0xD0, 0xD0, 0xA0, 0xA0, 0xA0, 0xA0, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0xA7, 0x19,
+  0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0xA0, 0xA0, 0xA0, 0xA0, 0xD0, 0xD0, 0xD0, 0xD0,
+  0x68, 0x68, 0x68, 0x68, 0x34, 0x34, 0x34, 0x34, 0x1A, 0x1A, 0xAC, 0x16, 0x80, 0xC0, 0xC0, 0x60,
+  0x60, 0x61, 0x61, 0x61, 0x61, 0x63, 0x63, 0x63, 0x63, 0x66, 0x66, 0x66, 0x66, 0xCD, 0xCD, 0x8D,
+  0x0D, 0x1A, 0x1A, 0x9A, 0x15, 0x1A, 0x1A, 0x9A, 0xCD, 0xCD, 0x6D, 0x6D, 0x66, 0x66, 0x66, 0x66,
+  0x63, 0x63, 0x63, 0x63, 0x61, 0x61, 0x61, 0x61, 0xC0, 0xC0, 0x80, 0xB5, 0x02, 0x0C, 0x03, 0x01,
+  0x91, 0x02, 0x01, 0x03, 0x0C, 0x9B, 0x02, 0x0C, 0x03, 0x01, 0x91, 0x02, 0x01, 0x03, 0x0C, 0xB3,
+  0x17, 0x04, 0x10, 0x20, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x20, 0x10, 0x04, 0x9B, 0x17, 0x04, 0x10, 0x20, 0x40, 0x40,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40,
+  0x20, 0x10, 0x04, 0xFF, 0xFF, 0x99, 0x17, 0x80, 0xE0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFC, 0xFC, 0xFC,
+  0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xF8, 0xF8, 0xF0, 0xE0, 0x80, 0x9B,
+  0x17, 0x80, 0xE0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC,
+  0xFC, 0xFC, 0xFC, 0xFC, 0xF8, 0xF8, 0xF0, 0xE0, 0x80, 0xB3, 0x17, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x9B, 0x17, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x17, 0x01,
+  0x07, 0x0F, 0x1F, 0x1F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x1F, 0x1F, 0x0F, 0x07, 0x01, 0x9B, 0x17, 0x01, 0x07, 0x0F, 0x1F, 0x1F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x1F, 0x1F, 0x0F, 0x07,
+  0x01, 0xFF, 0xD2, 0x0D, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xE0, 0xC0, 0xF2, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0xFF, 0xFF, 0x99, 0x17, 0x40, 0x10, 0x08, 0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x04, 0x08, 0x10, 0x40, 0x9B, 0x17, 0x80, 0x20,
+  0x10, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x08, 0x08, 0x10, 0x20, 0x80, 0xFF, 0x9C, 0x11, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0xEA, 0x17, 0x38, 0x0E, 0x07,
+  0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x03, 0x03, 0x07, 0x0E, 0x38, 0x9C, 0x15, 0x40, 0x20, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x10, 0x20, 0x40, 0xE8, 0x00, 0x81,
+  0x95, 0x00, 0x81, 0xB3, 0x17, 0x01, 0x04, 0x08, 0x10, 0x10, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10, 0x10, 0x08, 0x04, 0x01, 0x9B, 0x17, 0x01,
+  0x06, 0x0C, 0x18, 0x18, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x18, 0x18, 0x0C, 0x06, 0x01, 0xFF, 0x9A, 0x15, 0x80, 0xC0, 0x60, 0x60, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x60, 0x60, 0xC0, 0x80,
+  0xE8, 0x01, 0x06, 0x01, 0x93, 0x01, 0x01, 0x06, 0x9C, 0x15, 0x80, 0x40, 0x20, 0x20, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x20, 0x20, 0x40, 0x80,
+  0xB4, 0x00, 0x80, 0x95, 0x00, 0x80, 0x9B, 0x00, 0x42, 0x95, 0x00, 0x42, 0xB4, 0x15, 0x02, 0x04,
+  0x08, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x08, 0x08, 0x04, 0x02, 0x9D, 0x15, 0x01, 0x02, 0x04, 0x04, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x04, 0x04, 0x02, 0x01, 0xFF, 0x9A, 0x15, 0x40,
+  0x20, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x10, 0x10, 0x20, 0x40, 0xE8, 0x00, 0x01, 0x95, 0x00, 0x01, 0x9D, 0x13, 0x80, 0x40, 0x00,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x40,
+  0x80, 0xE9, 0x01, 0x40, 0x01, 0x93, 0x01, 0x01, 0x40, 0xEB, 0x00, 0x04, 0x8D, 0x00, 0x04, 0xFF,
+  0x99, 0x17, 0xC0, 0x30, 0x18, 0x0C, 0x0C, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+  0x06, 0x06, 0x06, 0x06, 0x06, 0x0C, 0x0C, 0x18, 0x30, 0xC0, 0xFF, 0x9E, 0x11, 0x80, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0xB6,
+  0x00, 0x40, 0x95, 0x00, 0x40, 0x9B, 0x02, 0x04, 0x02, 0x01, 0x91, 0x02, 0x01, 0x02, 0x04, 0xB4,
+  0x15, 0x01, 0x02, 0x04, 0x04, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x04, 0x04, 0x02, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0x03, 0xC0,
+  0xE0, 0xE0, 0x20, 0x88, 0x01, 0x20, 0xC0, 0xF1, 0x02, 0x01, 0x01, 0x01, 0x88, 0x00, 0x01, 0xFF,
+  0xED, 0x04, 0x02, 0x01, 0x51, 0x09, 0x06, 0xFF, 0xFF, 0xF3, 0x04, 0x02, 0x01, 0x51, 0x09, 0x06,
+  0xFF, 0xED, 0x04, 0x02, 0x01, 0x51, 0x09, 0x06, 0xFF, 0x80, 0x04, 0x02, 0x01, 0x51, 0x09, 0x06,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xC0, 0xE0, 0x20, 0x87, 0x02, 0x20, 0xE0, 0xC0, 0xF2, 0x01, 0x01,
+  0x01, 0x87, 0x01, 0x01, 0x01, 0xFF, 0x99, 0x17, 0xC0, 0x30, 0x18, 0x0C, 0x0C, 0x06, 0x06, 0x06,
+  0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0C, 0x0C, 0x18, 0x30, 0xC0,
+  0xFF, 0x9D, 0x13, 0x80, 0xC0, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+  0x60, 0x60, 0x60, 0x60, 0x40, 0xC0, 0x80, 0xE9, 0x02, 0x44, 0x03, 0x01, 0x91, 0x02, 0x01, 0x03,
+  0x44, 0xEB, 0x00, 0x04, 0x8D, 0x00, 0x04, 0xFF, 0x9A, 0x15, 0xC0, 0xE0, 0x70, 0x70, 0x38, 0x38,
+  0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x70, 0x70, 0xE0, 0xC0,
+  0xE8, 0x01, 0x07, 0x01, 0x93, 0x01, 0x01, 0x07, 0x9B, 0x17, 0x80, 0xE0, 0x70, 0x38, 0x38, 0x1C,
+  0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x38, 0x38, 0x70,
+  0xE0, 0x80, 0xE7, 0x00, 0x03, 0x95, 0x00, 0x03, 0xFF, 0x9C, 0x11, 0x80, 0x80, 0xC0, 0xC0, 0xC0,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0xA3, 0x0D, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xB8, 0x17, 0x38,
+  0x0E, 0x07, 0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x03, 0x03, 0x07, 0x0E, 0x38, 0x9B, 0x17, 0x70, 0x1C, 0x0E, 0x07, 0x07, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0x07, 0x0E, 0x1C,
+  0x70, 0xFF, 0xCE, 0x15, 0x80, 0xC0, 0xE0, 0xE0, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+  0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0xE0, 0xE0, 0xC0, 0x80, 0xB4, 0x17, 0xC0, 0x70, 0x38, 0x1C,
+  0x1C, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x1C,
+  0x1C, 0x38, 0x70, 0xC0, 0x9B, 0x02, 0x0E, 0x03, 0x01, 0x91, 0x02, 0x01, 0x03, 0x0E, 0xB3, 0x00,
+  0x01, 0x95, 0x00, 0x01, 0xFF, 0xCD, 0x17, 0x80, 0x60, 0x30, 0x18, 0x18, 0x0C, 0x0C, 0x0C, 0x0C,
+  0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x18, 0x18, 0x30, 0x60, 0x80, 0xB4,
+  0x15, 0x80, 0xC0, 0x60, 0x20, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x20, 0x60, 0xC0, 0x80, 0x9C, 0x00, 0x01, 0x95, 0x00, 0x01, 0xB3, 0x01, 0x42,
+  0x01, 0x93, 0x01, 0x01, 0x42, 0xEB, 0x00, 0x04, 0x8D, 0x00, 0x04, 0xFF, 0xCD, 0x17, 0x40, 0x10,
+  0x08, 0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x04, 0x04, 0x08, 0x10, 0x40, 0xB6, 0x11, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0xEA, 0x02, 0x04, 0x02, 0x01, 0x91,
+  0x02, 0x01, 0x02, 0x04, 0xEB, 0x04, 0x80, 0x40, 0x40, 0x40, 0x80, 0xFC, 0x02, 0x14, 0x02, 0x01,
+  0x84, 0x05, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF7, 0x01, 0x03, 0x03, 0x81, 0x05, 0xC0, 0xC0,
+  0x30, 0x30, 0x0F, 0x0F, 0xF9, 0x01, 0x0C, 0x0C, 0xEB, 0x04, 0x80, 0x40, 0x40, 0x40, 0x80, 0xDC,
+  0x17, 0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE,
+  0xFE, 0xFE, 0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0xF0, 0xC0, 0x87, 0x02, 0x14, 0x02, 0x01, 0x84, 0x05,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xA0, 0x11, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x9E, 0x17, 0xFF, 0xFF, 0xFF, 0x7F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x7F, 0xFF, 0xFF, 0xFF, 0x8D, 0x01, 0x03, 0x03, 0x81, 0x05, 0xC0, 0xC0, 0x30, 0x30, 0x0F, 0x0F,
+  0x9B, 0x02, 0x44, 0x82, 0x01, 0x91, 0x02, 0x01, 0x82, 0x44, 0x9B, 0x01, 0x03, 0x81, 0x93, 0x01,
+  0x81, 0x03, 0x91, 0x01, 0x0C, 0x0C, 0xA1, 0x13, 0x01, 0x02, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x02, 0x01, 0x9F, 0x13, 0x01, 0x02,
+  0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00,
+  0x02, 0x01, 0xFF, 0xD4, 0x01, 0xC0, 0x20, 0x89, 0x01, 0x20, 0xC0, 0xF2, 0x00, 0x01, 0x89, 0x00,
+  0x01, 0xFF, 0xFF, 0xFF, 0x99, 0x01, 0x40, 0x80, 0x93, 0x01, 0x80, 0x40, 0x9B, 0x01, 0x40, 0x80,
+  0x93, 0x01, 0x80, 0x40, 0xB5, 0x13, 0x01, 0x02, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x02, 0x01, 0x9F, 0x13, 0x01, 0x02, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x02, 0x01,
+  0xFF, 0xFF, 0x9A, 0x15, 0x80, 0xC0, 0x60, 0x20, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x20, 0x60, 0xC0, 0x80, 0x9D, 0x15, 0x80, 0xC0, 0x60, 0x20,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x20, 0x60,
+  0xC0, 0x80, 0xB4, 0x01, 0x02, 0x01, 0x93, 0x01, 0x01, 0x02, 0x9B, 0x01, 0x02, 0x01, 0x93, 0x01,
+  0x01, 0x02, 0xB4, 0x15, 0x01, 0x02, 0x04, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x04, 0x02, 0x01, 0x9D, 0x15, 0x01, 0x02, 0x04, 0x00,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x04,
+  0x02, 0x01, 0xFF, 0xFF, 0x9A, 0x15, 0x40, 0x20, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x10, 0x20, 0x40, 0x9D, 0x15, 0x40, 0x20,
+  0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x10, 0x10, 0x20, 0x40, 0xB4, 0x00, 0x81, 0x95, 0x00, 0x81, 0x9B, 0x00, 0x81, 0x95, 0x00, 0x81,
+  0xB4, 0x15, 0x02, 0x04, 0x08, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x08, 0x08, 0x04, 0x02, 0x9D, 0x15, 0x02, 0x04, 0x08, 0x08, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x08, 0x08, 0x04, 0x02,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x99, 0x17, 0x01, 0x04, 0x08, 0x10, 0x10, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10, 0x10, 0x08, 0x04, 0x01, 0x9B, 0x17,
+  0x01, 0x04, 0x08, 0x10, 0x10, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x10, 0x10, 0x08, 0x04, 0x01, 0xFF, 0xFF, 0x99, 0x17, 0x80, 0x20, 0x10, 0x08,
+  0x08, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08,
+  0x08, 0x10, 0x20, 0x80, 0x9B, 0x17, 0x80, 0x20, 0x10, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x08, 0x10, 0x20, 0x80, 0xFF, 0xFF,
+  0x99, 0x17, 0x80, 0xE0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC,
+  0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xF8, 0xF8, 0xF0, 0xE0, 0x80, 0x9B, 0x17, 0x80, 0xE0, 0xF0, 0xF8,
+  0xF8, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xF8,
+  0xF8, 0xF0, 0xE0, 0x80, 0xB3, 0x17, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9B, 0x17,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x17, 0x01, 0x07, 0x0F, 0x1F, 0x1F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x1F, 0x1F, 0x0F,
+  0x07, 0x01, 0x9B, 0x17, 0x01, 0x07, 0x0F, 0x1F, 0x1F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x1F, 0x1F, 0x0F, 0x07, 0x01, 0xFF, 0xD3, 0x0B, 0xC0,
+  0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0xF4, 0x09, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0x99, 0x17, 0x80, 0x20, 0x10, 0x08, 0x08,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x08,
+  0x10, 0x20, 0x80, 0x9B, 0x17, 0x80, 0x20, 0x10, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x08, 0x10, 0x20, 0x80, 0xFF, 0xFF, 0x9A,
+  0x15, 0x40, 0x20, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x10, 0x10, 0x20, 0x40, 0x9D, 0x15, 0x40, 0x20, 0x10, 0x10, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x10, 0x20, 0x40, 0xB4,
+  0x00, 0x01, 0x95, 0x00, 0x01, 0x9B, 0x00, 0x01, 0x95, 0x00, 0x01, 0xB3, 0x17, 0x01, 0x04, 0x08,
+  0x10, 0x10, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x10, 0x10, 0x08, 0x04, 0x01, 0x9B, 0x17, 0x01, 0x04, 0x08, 0x10, 0x10, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10, 0x10, 0x08, 0x04, 0x01, 0xFF,
+  0xFF, 0xFF, 0x99, 0x00, 0x80, 0x95, 0x00, 0x80, 0x9B, 0x00, 0x80, 0x95, 0x00, 0x80, 0xB4, 0x15,
+  0x02, 0x04, 0x08, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x08, 0x08, 0x04, 0x02, 0x9D, 0x15, 0x02, 0x04, 0x08, 0x08, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x08, 0x08, 0x04, 0x02, 0xFF, 0xFF,
+  0x9A, 0x15, 0x80, 0x40, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x20, 0x20, 0x40, 0x80, 0x9D, 0x15, 0x80, 0x40, 0x20, 0x20, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x20, 0x20, 0x40, 0x80,
+  0xB4, 0x00, 0x02, 0x95, 0x00, 0x02, 0x9B, 0x00, 0x02, 0x95, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x99,
+  0x00, 0x40, 0x95, 0x00, 0x40, 0x9B, 0x00, 0x40, 0x95, 0x00, 0x40, 0xB4, 0x15, 0x01, 0x02, 0x04,
+  0x04, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x04,
+  0x04, 0x02, 0x01, 0x9D, 0x15, 0x01, 0x02, 0x04, 0x04, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x04, 0x04, 0x02, 0x01, 0xFF, 0xED, 0x02, 0x1C, 0x1C,
+  0x1C, 0xFF, 0xF3, 0x02, 0x1C, 0x1C, 0x1C, 0xFF, 0xF9, 0x02, 0x1C, 0x1C, 0x1C, 0xF1, 0x02, 0xC0,
+  0xC0, 0xC0, 0xF8, 0x08, 0x1C, 0x1C, 0x1C, 0x00, 0xFF, 0xFF, 0xE3, 0x1C, 0x1C, 0x82, 0x02, 0x1C,
+  0x1C, 0x1C, 0xF4, 0x02, 0xCF, 0xCF, 0xCF, 0xFC, 0x02, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0x99,
+  0x00, 0x40, 0x95, 0x00, 0x40, 0x9B, 0x00, 0x40, 0x95, 0x00, 0x40, 0xB4, 0x15, 0x01, 0x02, 0x04,
+  0x04, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x04,
+  0x04, 0x02, 0x01, 0x9D, 0x15, 0x01, 0x02, 0x04, 0x04, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x04, 0x04, 0x02, 0x01, 0xFF, 0xFF, 0x99, 0x17, 0x80,
+  0xE0, 0x70, 0x38, 0x38, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
+  0x1C, 0x1C, 0x38, 0x38, 0x70, 0xE0, 0x80, 0x9B, 0x17, 0x80, 0xE0, 0x70, 0x38, 0x38, 0x1C, 0x1C,
+  0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x38, 0x38, 0x70, 0xE0,
+  0x80, 0xB3, 0x00, 0x83, 0x95, 0x00, 0x83, 0x9B, 0x00, 0x83, 0x95, 0x00, 0x83, 0xB3, 0x17, 0x01,
+  0x06, 0x0C, 0x18, 0x18, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x18, 0x18, 0x0C, 0x06, 0x01, 0x9B, 0x17, 0x01, 0x06, 0x0C, 0x18, 0x18, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x18, 0x18, 0x0C, 0x06,
+  0x01, 0xFF, 0xFF, 0x99, 0x17, 0x60, 0x18, 0x0C, 0x06, 0x06, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x06, 0x06, 0x0C, 0x18, 0x60, 0x9B, 0x17, 0x60,
+  0x18, 0x0C, 0x06, 0x06, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x06, 0x06, 0x0C, 0x18, 0x60, 0xFF, 0xB3, 0x17, 0x06, 0x18, 0x30, 0x60, 0x60, 0xC0,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x60, 0x60, 0x30,
+  0x18, 0x06, 0x9B, 0x17, 0x06, 0x18, 0x30, 0x60, 0x60, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x60, 0x60, 0x30, 0x18, 0x06, 0xFF, 0x9E, 0x0D, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xA5, 0x0D, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xB8, 0x04, 0x10,
+  0x04, 0x02, 0x01, 0x01, 0x8D, 0x04, 0x01, 0x01, 0x02, 0x04, 0x10, 0x9B, 0x04, 0x10, 0x04, 0x02,
+  0x01, 0x01, 0x8D, 0x04, 0x01, 0x01, 0x02, 0x04, 0x10, 0xFF, 0xB3, 0x04, 0x08, 0x20, 0x40, 0x80,
+  0x80, 0x8D, 0x04, 0x80, 0x80, 0x40, 0x20, 0x08, 0x9B, 0x04, 0x08, 0x20, 0x40, 0x80, 0x80, 0x8D,
+  0x04, 0x80, 0x80, 0x40, 0x20, 0x08, 0xB8, 0x0D, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xA5, 0x0D, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xF1, 0x02, 0xC0, 0xC0, 0xC0, 0xFC, 0x02, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x02, 0xCF, 0xCF, 0xCF, 0xFC, 0x02, 0x01, 0x01, 0x01, 0xFF, 0x9E, 0x0D, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xA5, 0x0D, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xB8, 0x04, 0x10, 0x04, 0x02,
+  0x01, 0x01, 0x8D, 0x04, 0x01, 0x01, 0x02, 0x04, 0x10, 0x9B, 0x04, 0x10, 0x04, 0x02, 0x01, 0x01,
+  0x8D, 0x04, 0x01, 0x01, 0x02, 0x04, 0x10, 0xFF, 0xFF, 0x99, 0x17, 0x20, 0x08, 0x04, 0x02, 0x02,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02,
+  0x04, 0x08, 0x20, 0x9B, 0x17, 0x20, 0x08, 0x04, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x04, 0x08, 0x20, 0xFF, 0xB3, 0x17,
+  0x0C, 0x30, 0x60, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0xC0, 0xC0, 0x60, 0x30, 0x0C, 0x9B, 0x17, 0x0C, 0x30, 0x60, 0xC0, 0xC0, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0x60,
+  0x30, 0x0C, 0xB8, 0x0D, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0xA5, 0x0D, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0xFF, 0xFF, 0x99, 0x17, 0x40, 0x10, 0x08, 0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x04, 0x08, 0x10, 0x40, 0x9B, 0x17,
+  0x40, 0x10, 0x08, 0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x04, 0x04, 0x08, 0x10, 0x40, 0xFF, 0xB3, 0x17, 0x02, 0x08, 0x10, 0x20, 0x20,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x20, 0x20,
+  0x10, 0x08, 0x02, 0x9B, 0x17, 0x02, 0x08, 0x10, 0x20, 0x20, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x20, 0x20, 0x10, 0x08, 0x02, 0xFF, 0xFF, 0x9A,
+  0x15, 0xC0, 0xE0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+  0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0xE0, 0xC0, 0x9D, 0x15, 0xC0, 0xE0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8,
+  0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0xE0, 0xC0, 0xB4,
+  0x17, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9B, 0x17, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xB4, 0x15, 0x03, 0x07, 0x0F, 0x0F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x0F, 0x0F, 0x07, 0x03, 0x9D, 0x15, 0x03, 0x07, 0x0F,
+  0x0F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x0F,
+  0x0F, 0x07, 0x03, 0xFF, 0xD3, 0x0D, 0x70, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+  0xF8, 0xF8, 0xF8, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC5, 0x01, 0x88, 0x70, 0xFF, 0xFF,
+  0x9A, 0x15, 0xC0, 0xE0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+  0xF8, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0xE0, 0xC0, 0x9D, 0x15, 0xC0, 0xE0, 0xF0, 0xF0, 0xF8, 0xF8,
+  0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0xE0, 0xC0,
+  0xB4, 0x17, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x03, 0x03, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03,
+  0x01, 0x01, 0x01, 0x03, 0x03, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0x9B, 0x17, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x8F, 0x03, 0x03, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x01, 0x01, 0x01, 0x03, 0x03, 0x8F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xB4, 0x15, 0x03, 0x07, 0x0F, 0x0F, 0x1F, 0x1E, 0x1E, 0x1C, 0x18, 0x10,
+  0x00, 0x20, 0x00, 0x10, 0x18, 0x1C, 0x1E, 0x1E, 0x0F, 0x0F, 0x07, 0x03, 0x9D, 0x15, 0x03, 0x07,
+  0x0F, 0x0F, 0x1F, 0x1E, 0x1E, 0x1C, 0x18, 0x10, 0x00, 0x20, 0x00, 0x10, 0x18, 0x1C, 0x1E, 0x1E,
+  0x0F, 0x0F, 0x07, 0x03, 0xFF, 0xD1, 0x02, 0x70, 0xF8, 0x88, 0x8C, 0x01, 0x88, 0x70, 0xFF, 0xFF,
+  0x9C, 0x12, 0x80, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xE0, 0xC0, 0x80, 0xA0, 0x12, 0x80, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0,
+  0xC0, 0xE0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0xC0, 0x80, 0xB7, 0x14, 0x1F, 0x3F, 0x7F, 0x8F,
+  0x03, 0x03, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x01, 0x01, 0x01, 0x03, 0x03, 0x8F, 0x7F, 0x3F,
+  0x1F, 0x9E, 0x14, 0x1F, 0x3F, 0x7F, 0x8F, 0x03, 0x03, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x01,
+  0x01, 0x01, 0x03, 0x03, 0x8F, 0x7F, 0x3F, 0x1F, 0xBB, 0x0A, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40,
+  0x20, 0x10, 0x08, 0x04, 0x02, 0xA8, 0x0A, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x20, 0x10, 0x08,
+  0x04, 0x02, 0xFF, 0xD4, 0x02, 0xE0, 0xF0, 0x88, 0x8F, 0x03, 0x88, 0xF8, 0xF0, 0xE0, 0xE9, 0x14,
+  0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x01, 0xFF, 0xFF, 0x9B, 0x14, 0x80, 0x40, 0x20, 0x10, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x10, 0x20, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x20, 0x40, 0x80, 0x9E, 0x14,
+  0x80, 0x40, 0x20, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x20, 0x10, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x10, 0x20, 0x40, 0x80, 0xB6, 0x03, 0x10, 0x20, 0x40, 0x80, 0x8C, 0x03, 0x80, 0x40, 0x20,
+  0x10, 0x9E, 0x03, 0x10, 0x20, 0x40, 0x80, 0x8C, 0x03, 0x80, 0x40, 0x20, 0x10, 0xBA, 0x0C, 0x01,
+  0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0xA6, 0x0C, 0x01, 0x02,
+  0x04, 0x08, 0x10, 0x20, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0xFF, 0xD1, 0x03, 0xE0, 0xF0,
+  0x18, 0x08, 0x92, 0x02, 0x08, 0x10, 0xE0, 0xE6, 0x02, 0x01, 0x03, 0x02, 0x92, 0x01, 0x02, 0x01,
+  0xFF, 0xFF, 0x9A, 0x16, 0xC0, 0x70, 0x38, 0x1C, 0x0C, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0C, 0x1C,
+  0x0C, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0C, 0x1C, 0x38, 0x70, 0xC0, 0x9C, 0x16, 0xC0, 0x70, 0x38,
+  0x1C, 0x0C, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0C, 0x1C, 0x0C, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0C,
+  0x1C, 0x38, 0x70, 0xC0, 0xB4, 0x03, 0x07, 0x10, 0x20, 0x40, 0x8E, 0x03, 0x40, 0x20, 0x10, 0x07,
+  0x9C, 0x03, 0x07, 0x10, 0x20, 0x40, 0x8E, 0x03, 0x40, 0x20, 0x10, 0x07, 0xB9, 0x0C, 0x01, 0x02,
+  0x04, 0x08, 0x10, 0x20, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0xA6, 0x0C, 0x01, 0x02, 0x04,
+  0x08, 0x10, 0x20, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0xFF, 0xD0, 0x01, 0xC0, 0x10, 0x97,
+  0x01, 0x10, 0xC0, 0xE4, 0x19, 0x03, 0x02, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x02, 0x03, 0xF1,
+  0x07, 0x80, 0x40, 0x40, 0xC0, 0xC0, 0x40, 0x40, 0x80, 0xF7, 0x07, 0x03, 0x04, 0x04, 0x07, 0x07,
+  0x04, 0x04, 0x03, 0x9E, 0x1A, 0xC0, 0xF0, 0x38, 0x0C, 0x06, 0x02, 0x03, 0x01, 0x01, 0x01, 0x01,
+  0x00, 0x02, 0x00, 0x02, 0x00, 0x01, 0x01, 0x01, 0x01, 0x03, 0x02, 0x06, 0x0C, 0x38, 0xF0, 0xC0,
+  0x98, 0x1A, 0xC0, 0xF0, 0x38, 0x0C, 0x06, 0x02, 0x03, 0x01, 0x01, 0x01, 0x01, 0x00, 0x02, 0x00,
+  0x02, 0x00, 0x01, 0x01, 0x01, 0x01, 0x03, 0x02, 0x06, 0x0C, 0x38, 0xF0, 0xC0, 0xB0, 0x06, 0x07,
+  0x1F, 0x38, 0x60, 0xC0, 0x80, 0x80, 0x8C, 0x06, 0x80, 0x80, 0xC0, 0x60, 0x38, 0x1F, 0x07, 0x98,
+  0x06, 0x07, 0x1F, 0x38, 0x60, 0xC0, 0x80, 0x80, 0x8C, 0x06, 0x80, 0x80, 0xC0, 0x60, 0x38, 0x1F,
+  0x07, 0xB6, 0x0E, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC0, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C,
+  0x06, 0x03, 0xA4, 0x0E, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC0, 0x80, 0xC0, 0x60, 0x30, 0x18,
+  0x0C, 0x06, 0x03, 0xA9, 0x08, 0x38, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0x38, 0x90, 0x00,
+  0x01, 0xB2, 0x00, 0x01, 0x90, 0x08, 0x38, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0x38, 0x99,
+  0x02, 0x01, 0x01, 0x01, 0x9D, 0x1F, 0xE0, 0xF8, 0x38, 0x0C, 0x0C, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x0C, 0x0C, 0x38, 0xF8, 0xE0, 0x9E, 0x02, 0x01, 0x01, 0x01, 0xBE, 0x03, 0x03, 0x03, 0x04,
+  0x04, 0x95, 0x03, 0x04, 0x04, 0x03, 0x03, 0xFF, 0xFF, 0x98, 0x1A, 0xC0, 0xF0, 0xF8, 0x3C, 0x1E,
+  0x0E, 0x07, 0x03, 0x03, 0x03, 0x03, 0x02, 0x06, 0x0C, 0x06, 0x02, 0x03, 0x03, 0x03, 0x03, 0x07,
+  0x0E, 0x1E, 0x3C, 0xF8, 0xF0, 0xC0, 0x98, 0x1A, 0xC0, 0xF0, 0xF8, 0x3C, 0x1E, 0x0E, 0x07, 0x03,
+  0x03, 0x03, 0x03, 0x02, 0x06, 0x0C, 0x06, 0x02, 0x03, 0x03, 0x03, 0x03, 0x07, 0x0E, 0x1E, 0x3C,
+  0xF8, 0xF0, 0xC0, 0xB0, 0x07, 0x07, 0x1F, 0x3F, 0x78, 0xF0, 0xE0, 0xC0, 0x80, 0x8A, 0x07, 0x80,
+  0xC0, 0xE0, 0xF0, 0x78, 0x3F, 0x1F, 0x07, 0x98, 0x07, 0x07, 0x1F, 0x3F, 0x78, 0xF0, 0xE0, 0xC0,
+  0x80, 0x8A, 0x07, 0x80, 0xC0, 0xE0, 0xF0, 0x78, 0x3F, 0x1F, 0x07, 0xB6, 0x0E, 0x03, 0x07, 0x0F,
+  0x1E, 0x3C, 0x78, 0xF0, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x03, 0xA4, 0x0E, 0x03, 0x07,
+  0x0F, 0x1E, 0x3C, 0x78, 0xF0, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x03, 0xA9, 0x08, 0x38,
+  0xC6, 0x82, 0x01, 0x01, 0x01, 0x82, 0xC6, 0x38, 0x90, 0x00, 0x01, 0xB2, 0x00, 0x01, 0x90, 0x08,
+  0x38, 0xC6, 0x82, 0x01, 0x01, 0x01, 0x82, 0xC6, 0x38, 0x99, 0x02, 0x01, 0x01, 0x01, 0xDC, 0x02,
+  0x01, 0x01, 0x01, 0xF1, 0x07, 0x80, 0x40, 0x40, 0xC0, 0xC0, 0x40, 0x40, 0x80, 0x8F, 0x07, 0x0E,
+  0x11, 0x11, 0x1F, 0x1F, 0x11, 0x11, 0x0E, 0xDF, 0x07, 0x03, 0x04, 0x04, 0x07, 0x07, 0x04, 0x04,
+  0x03, 0x9E, 0x1A, 0xC0, 0xF0, 0xF8, 0x3C, 0x1E, 0x0E, 0x07, 0x03, 0x03, 0x03, 0x03, 0x02, 0x06,
+  0x0C, 0x06, 0x02, 0x03, 0x03, 0x03, 0x03, 0x07, 0x0E, 0x1E, 0x3C, 0xF8, 0xF0, 0xC0, 0x98, 0x1A,
+  0xC0, 0xF0, 0xF8, 0x3C, 0x1E, 0x0E, 0x07, 0x03, 0x03, 0x03, 0x03, 0x02, 0x06, 0x0C, 0x06, 0x02,
+  0x03, 0x03, 0x03, 0x03, 0x07, 0x0E, 0x1E, 0x3C, 0xF8, 0xF0, 0xC0, 0xB0, 0x07, 0x07, 0x1F, 0x3F,
+  0x78, 0xF0, 0xE0, 0xC0, 0x80, 0x8A, 0x07, 0x80, 0xC0, 0xE0, 0xF0, 0x78, 0x3F, 0x1F, 0x07, 0x98,
+  0x07, 0x07, 0x1F, 0x3F, 0x78, 0xF0, 0xE0, 0xC0, 0x80, 0x8A, 0x07, 0x80, 0xC0, 0xE0, 0xF0, 0x78,
+  0x3F, 0x1F, 0x07, 0xB6, 0x0E, 0x03, 0x07, 0x0F, 0x1E, 0x3C, 0x78, 0xF0, 0xE0, 0xF0, 0x78, 0x3C,
+  0x1E, 0x0F, 0x07, 0x03, 0xA4, 0x0E, 0x03, 0x07, 0x0F, 0x1E, 0x3C, 0x78, 0xF0, 0xE0, 0xF0, 0x78,
+  0x3C, 0x1E, 0x0F, 0x07, 0x03, 0xA9, 0x08, 0x38, 0xC6, 0x82, 0x01, 0x01, 0x01, 0x82, 0xC6, 0x38,
+  0x90, 0x00, 0x01, 0xB2, 0x00, 0x01, 0x90, 0x08, 0x38, 0xC6, 0x82, 0x01, 0x01, 0x01, 0x82, 0xC6,
+  0x38, 0x99, 0x02, 0x01, 0x01, 0x01, 0xDC, 0x02, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0x98, 0x1A, 0xC0,
+  0xF0, 0xF8, 0x3C, 0x1E, 0x0E, 0x07, 0x03, 0x03, 0x03, 0x03, 0x02, 0x06, 0x0C, 0x06, 0x02, 0x03,
+  0x03, 0x03, 0x03, 0x07, 0x0E, 0x1E, 0x3C, 0xF8, 0xF0, 0xC0, 0x98, 0x1A, 0xC0, 0xF0, 0xF8, 0x3C,
+  0x1E, 0x0E, 0x07, 0x03, 0x03, 0x03, 0x03, 0x02, 0x06, 0x0C, 0x06, 0x02, 0x03, 0x03, 0x03, 0x03,
+  0x07, 0x0E, 0x1E, 0x3C, 0xF8, 0xF0, 0xC0, 0xB0, 0x07, 0x07, 0x1F, 0x3F, 0x78, 0xF0, 0xE0, 0xC0,
+  0x80, 0x8A, 0x07, 0x80, 0xC0, 0xE0, 0xF0, 0x78, 0x3F, 0x1F, 0x07, 0x98, 0x07, 0x07, 0x1F, 0x3F,
+  0x78, 0xF0, 0xE0, 0xC0, 0x80, 0x8A, 0x07, 0x80, 0xC0, 0xE0, 0xF0, 0x78, 0x3F, 0x1F, 0x07, 0xB6,
+  0x0E, 0x03, 0x07, 0x0F, 0x1E, 0x3C, 0x78, 0xF0, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x03,
+  0xA4, 0x0E, 0x03, 0x07, 0x0F, 0x1E, 0x3C, 0x78, 0xF0, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07,
+  0x03, 0xA9, 0x08, 0x38, 0xC6, 0x82, 0x01, 0x01, 0x01, 0x82, 0xC6, 0x38, 0x90, 0x00, 0x01, 0xB2,
+  0x00, 0x01, 0x90, 0x08, 0x38, 0xC6, 0x82, 0x01, 0x01, 0x01, 0x82, 0xC6, 0x38, 0x99, 0x02, 0x01,
+  0x01, 0x01, 0xDC, 0x02, 0x01, 0x01, 0x01, 0xF1, 0x07, 0x80, 0x40, 0x40, 0xC0, 0xC0, 0x40, 0x40,
+  0x80, 0x8F, 0x07, 0x0E, 0x11, 0x11, 0x1F, 0x1F, 0x11, 0x11, 0x0E, 0xDF, 0x07, 0x03, 0x04, 0x04,
+  0x07, 0x07, 0x04, 0x04, 0x03, 0x9E, 0x1A, 0xC0, 0xF0, 0xF8, 0x3C, 0x1E, 0x0E, 0x07, 0x03, 0x03,
+  0x03, 0x03, 0x02, 0x06, 0x0C, 0x06, 0x02, 0x03, 0x03, 0x03, 0x03, 0x07, 0x0E, 0x1E, 0x3C, 0xF8,
+  0xF0, 0xC0, 0x98, 0x1A, 0xC0, 0xF0, 0xF8, 0x3C, 0x1E, 0x0E, 0x07, 0x03, 0x03, 0x03, 0x03, 0x02,
+  0x06, 0x0C, 0x06, 0x02, 0x03, 0x03, 0x03, 0x03, 0x07, 0x0E, 0x1E, 0x3C, 0xF8, 0xF0, 0xC0, 0xB0,
+  0x07, 0x07, 0x1F, 0x3F, 0x78, 0xF0, 0xE0, 0xC0, 0x80, 0x8A, 0x07, 0x80, 0xC0, 0xE0, 0xF0, 0x78,
+  0x3F, 0x1F, 0x07, 0x98, 0x07, 0x07, 0x1F, 0x3F, 0x78, 0xF0, 0xE0, 0xC0, 0x80, 0x8A, 0x07, 0x80,
+  0xC0, 0xE0, 0xF0, 0x78, 0x3F, 0x1F, 0x07, 0xB6, 0x0E, 0x03, 0x07, 0x0F, 0x1E, 0x3C, 0x78, 0xF0,
+  0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x03, 0xA4, 0x0E, 0x03, 0x07, 0x0F, 0x1E, 0x3C, 0x78,
+  0xF0, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x03, 0xA9, 0x08, 0x38, 0xC6, 0x82, 0x01, 0x01,
+  0x01, 0x82, 0xC6, 0x38, 0x90, 0x00, 0x01, 0xB2, 0x00, 0x01, 0x90, 0x08, 0x38, 0xC6, 0x82, 0x01,
+  0x01, 0x01, 0x82, 0xC6, 0x38, 0x99, 0x02, 0x01, 0x01, 0x01, 0xDC, 0x02, 0x01, 0x01, 0x01, 0xFF,
+  0xFF, 0x98, 0x1A, 0xC0, 0xF0, 0xF8, 0x3C, 0x1E, 0x0E, 0x07, 0x03, 0x03, 0x03, 0x03, 0x02, 0x06,
+  0x0C, 0x06, 0x02, 0x03, 0x03, 0x03, 0x03, 0x07, 0x0E, 0x1E, 0x3C, 0xF8, 0xF0, 0xC0, 0x98, 0x1A,
+  0xC0, 0xF0, 0xF8, 0x3C, 0x1E, 0x0E, 0x07, 0x03, 0x03, 0x03, 0x03, 0x02, 0x06, 0x0C, 0x06, 0x02,
+  0x03, 0x03, 0x03, 0x03, 0x07, 0x0E, 0x1E, 0x3C, 0xF8, 0xF0, 0xC0, 0xB0, 0x07, 0x07, 0x1F, 0x3F,
+  0x78, 0xF0, 0xE0, 0xC0, 0x80, 0x8A, 0x07, 0x80, 0xC0, 0xE0, 0xF0, 0x78, 0x3F, 0x1F, 0x07, 0x98,
+  0x07, 0x07, 0x1F, 0x3F, 0x78, 0xF0, 0xE0, 0xC0, 0x80, 0x8A, 0x07, 0x80, 0xC0, 0xE0, 0xF0, 0x78,
+  0x3F, 0x1F, 0x07, 0xB6, 0x0E, 0x03, 0x07, 0x0F, 0x1E, 0x3C, 0x78, 0xF0, 0xE0, 0xF0, 0x78, 0x3C,
+  0x1E, 0x0F, 0x07, 0x03, 0xA4, 0x0E, 0x03, 0x07, 0x0F, 0x1E, 0x3C, 0x78, 0xF0, 0xE0, 0xF0, 0x78,
+  0x3C, 0x1E, 0x0F, 0x07, 0x03, 0xA9, 0x08, 0x38, 0xC6, 0x82, 0x01, 0x01, 0x01, 0x82, 0xC6, 0x38,
+  0x90, 0x00, 0x01, 0xB2, 0x00, 0x01, 0x90, 0x08, 0x38, 0xC6, 0x82, 0x01, 0x01, 0x01, 0x82, 0xC6,
+  0x38, 0x99, 0x02, 0x01, 0x01, 0x01, 0xDC, 0x02, 0x01, 0x01, 0x01, 0xF1, 0x07, 0x80, 0x40, 0x40,
+  0xC0, 0xC0, 0x40, 0x40, 0x80, 0x8F, 0x07, 0x0E, 0x11, 0x11, 0x1F, 0x1F, 0x11, 0x11, 0x0E, 0xDF,
+  0x07, 0x03, 0x04, 0x04, 0x07, 0x07, 0x04, 0x04, 0x03, 0x9E, 0x1A, 0xC0, 0xF0, 0xF8, 0x3C, 0x1E,
+  0x0E, 0x07, 0x03, 0x03, 0x03, 0x03, 0x02, 0x06, 0x0C, 0x06, 0x02, 0x03, 0x03, 0x03, 0x03, 0x07,
+  0x0E, 0x1E, 0x3C, 0xF8, 0xF0, 0xC0, 0x98, 0x1A, 0xC0, 0xF0, 0xF8, 0x3C, 0x1E, 0x0E, 0x07, 0x03,
+  0x03, 0x03, 0x03, 0x02, 0x06, 0x0C, 0x06, 0x02, 0x03, 0x03, 0x03, 0x03, 0x07, 0x0E, 0x1E, 0x3C,
+  0xF8, 0xF0, 0xC0, 0xB0, 0x07, 0x07, 0x1F, 0x3F, 0x78, 0xF0, 0xE0, 0xC0, 0x80, 0x8A, 0x07, 0x80,
+  0xC0, 0xE0, 0xF0, 0x78, 0x3F, 0x1F, 0x07, 0x98, 0x07, 0x07, 0x1F, 0x3F, 0x78, 0xF0, 0xE0, 0xC0,
+  0x80, 0x8A, 0x07, 0x80, 0xC0, 0xE0, 0xF0, 0x78, 0x3F, 0x1F, 0x07, 0xB6, 0x0E, 0x03, 0x07, 0x0F,
+  0x1E, 0x3C, 0x78, 0xF0, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x03, 0xA4, 0x0E, 0x03, 0x07,
+  0x0F, 0x1E, 0x3C, 0x78, 0xF0, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x03, 0xA9, 0x08, 0x38,
+  0xC6, 0x82, 0x01, 0x01, 0x01, 0x82, 0xC6, 0x38, 0x90, 0x00, 0x01, 0xB2, 0x00, 0x01, 0x90, 0x08,
+  0x38, 0xC6, 0x82, 0x01, 0x01, 0x01, 0x82, 0xC6, 0x38, 0x99, 0x02, 0x01, 0x01, 0x01, 0xDC, 0x02,
+  0x01, 0x01, 0x01, 0xFF, 0xFF, 0x98, 0x1A, 0xC0, 0xF0, 0xF8, 0x3C, 0x1E, 0x0E, 0x07, 0x03, 0x03,
+  0x03, 0x03, 0x02, 0x06, 0x0C, 0x06, 0x02, 0x03, 0x03, 0x03, 0x03, 0x07, 0x0E, 0x1E, 0x3C, 0xF8,
+  0xF0, 0xC0, 0x98, 0x1A, 0xC0, 0xF0, 0xF8, 0x3C, 0x1E, 0x0E, 0x07, 0x03, 0x03, 0x03, 0x03, 0x02,
+  0x06, 0x0C, 0x06, 0x02, 0x03, 0x03, 0x03, 0x03, 0x07, 0x0E, 0x1E, 0x3C, 0xF8, 0xF0, 0xC0, 0xB0,
+  0x07, 0x07, 0x1F, 0x3F, 0x78, 0xF0, 0xE0, 0xC0, 0x80, 0x8A, 0x07, 0x80, 0xC0, 0xE0, 0xF0, 0x78,
+  0x3F, 0x1F, 0x07, 0x98, 0x07, 0x07, 0x1F, 0x3F, 0x78, 0xF0, 0xE0, 0xC0, 0x80, 0x8A, 0x07, 0x80,
+  0xC0, 0xE0, 0xF0, 0x78, 0x3F, 0x1F, 0x07, 0xB6, 0x0E, 0x03, 0x07, 0x0F, 0x1E, 0x3C, 0x78, 0xF0,
+  0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x03, 0xA4, 0x0E, 0x03, 0x07, 0x0F, 0x1E, 0x3C, 0x78,
+  0xF0, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x03, 0xA9, 0x08, 0x38, 0xC6, 0x82, 0x01, 0x01,
+  0x01, 0x82, 0xC6, 0x38, 0x90, 0x00, 0x01, 0xB2, 0x00, 0x01, 0x90, 0x08, 0x38, 0xC6, 0x82, 0x01,
+  0x01, 0x01, 0x82, 0xC6, 0x38, 0x99, 0x02, 0x01, 0x01, 0x01, 0xDC, 0x02, 0x01, 0x01, 0x01, 0xF1,
+  0x07, 0x80, 0x40, 0x40, 0xC0, 0xC0, 0x40, 0x40, 0x80, 0x8F, 0x07, 0x0E, 0x11, 0x11, 0x1F, 0x1F,
+  0x11, 0x11, 0x0E, 0xDF, 0x07, 0x03, 0x04, 0x04, 0x07, 0x07, 0x04, 0x04, 0x03, 0x9E, 0x1A, 0xC0,
+  0xF0, 0xF8, 0x3C, 0x1E, 0x0E, 0x07, 0x03, 0x03, 0x03, 0x03, 0x02, 0x06, 0x0C, 0x06, 0x02, 0x03,
+  0x03, 0x03, 0x03, 0x07, 0x0E, 0x1E, 0x3C, 0xF8, 0xF0, 0xC0, 0x98, 0x1A, 0xC0, 0xF0, 0xF8, 0x3C,
+  0x1E, 0x0E, 0x07, 0x03, 0x03, 0x03, 0x03, 0x02, 0x06, 0x0C, 0x06, 0x02, 0x03, 0x03, 0x03, 0x03,
+  0x07, 0x0E, 0x1E, 0x3C, 0xF8, 0xF0, 0xC0, 0xB0, 0x07, 0x07, 0x1F, 0x3F, 0x78, 0xF0, 0xE0, 0xC0,
+  0x80, 0x8A, 0x07, 0x80, 0xC0, 0xE0, 0xF0, 0x78, 0x3F, 0x1F, 0x07, 0x98, 0x07, 0x07, 0x1F, 0x3F,
+  0x78, 0xF0, 0xE0, 0xC0, 0x80, 0x8A, 0x07, 0x80, 0xC0, 0xE0, 0xF0, 0x78, 0x3F, 0x1F, 0x07, 0xB6,
+  0x0E, 0x03, 0x07, 0x0F, 0x1E, 0x3C, 0x78, 0xF0, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x03,
+  0xA4, 0x0E, 0x03, 0x07, 0x0F, 0x1E, 0x3C, 0x78, 0xF0, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07,
+  0x03, 0xA9, 0x08, 0x38, 0xC6, 0x82, 0x01, 0x01, 0x01, 0x82, 0xC6, 0x38, 0x90, 0x00, 0x01, 0xB2,
+  0x00, 0x01, 0x90, 0x08, 0x38, 0xC6, 0x82, 0x01, 0x01, 0x01, 0x82, 0xC6, 0x38, 0x99, 0x02, 0x01,
+  0x01, 0x01, 0xDC, 0x02, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0x98, 0x1A, 0xC0, 0xF0, 0xF8, 0x3C, 0x1E,
+  0x0E, 0x07, 0x03, 0x03, 0x03, 0x03, 0x02, 0x06, 0x0C, 0x06, 0x02, 0x03, 0x03, 0x03, 0x03, 0x07,
+  0x0E, 0x1E, 0x3C, 0xF8, 0xF0, 0xC0, 0x98, 0x1A, 0xC0, 0xF0, 0xF8, 0x3C, 0x1E, 0x0E, 0x07, 0x03,
+  0x03, 0x03, 0x03, 0x02, 0x06, 0x0C, 0x06, 0x02, 0x03, 0x03, 0x03, 0x03, 0x07, 0x0E, 0x1E, 0x3C,
+  0xF8, 0xF0, 0xC0, 0xB0, 0x07, 0x07, 0x1F, 0x3F, 0x78, 0xF0, 0xE0, 0xC0, 0x80, 0x8A, 0x07, 0x80,
+  0xC0, 0xE0, 0xF0, 0x78, 0x3F, 0x1F, 0x07, 0x98, 0x07, 0x07, 0x1F, 0x3F, 0x78, 0xF0, 0xE0, 0xC0,
+  0x80, 0x8A, 0x07, 0x80, 0xC0, 0xE0, 0xF0, 0x78, 0x3F, 0x1F, 0x07, 0xB6, 0x0E, 0x03, 0x07, 0x0F,
+  0x1E, 0x3C, 0x78, 0xF0, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x03, 0xA4, 0x0E, 0x03, 0x07,
+  0x0F, 0x1E, 0x3C, 0x78, 0xF0, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x03, 0xA9, 0x08, 0x38,
+  0xC6, 0x82, 0x01, 0x01, 0x01, 0x82, 0xC6, 0x38, 0x90, 0x00, 0x01, 0xB2, 0x00, 0x01, 0x90, 0x08,
+  0x38, 0xC6, 0x82, 0x01, 0x01, 0x01, 0x82, 0xC6, 0x38, 0x99, 0x02, 0x01, 0x01, 0x01, 0xDC, 0x02,
+  0x01, 0x01, 0x01, 0xF1, 0x07, 0x80, 0x40, 0x40, 0xC0, 0xC0, 0x40, 0x40, 0x80, 0x8F, 0x07, 0x0E,
+  0x11, 0x11, 0x1F, 0x1F, 0x11, 0x11, 0x0E, 0xDF, 0x07, 0x03, 0x04, 0x04, 0x07, 0x07, 0x04, 0x04,
+  0x03, 0x9E, 0x1A, 0xC0, 0xF0, 0xF8, 0x3C, 0x1E, 0x0E, 0x07, 0x03, 0x03, 0x03, 0x03, 0x02, 0x06,
+  0x0C, 0x06, 0x02, 0x03, 0x03, 0x03, 0x03, 0x07, 0x0E, 0x1E, 0x3C, 0xF8, 0xF0, 0xC0, 0x98, 0x1A,
+  0xC0, 0xF0, 0xF8, 0x3C, 0x1E, 0x0E, 0x07, 0x03, 0x03, 0x03, 0x03, 0x02, 0x06, 0x0C, 0x06, 0x02,
+  0x03, 0x03, 0x03, 0x03, 0x07, 0x0E, 0x1E, 0x3C, 0xF8, 0xF0, 0xC0, 0xB0, 0x07, 0x07, 0x1F, 0x3F,
+  0x78, 0xF0, 0xE0, 0xC0, 0x80, 0x8A, 0x07, 0x80, 0xC0, 0xE0, 0xF0, 0x78, 0x3F, 0x1F, 0x07, 0x98,
+  0x07, 0x07, 0x1F, 0x3F, 0x78, 0xF0, 0xE0, 0xC0, 0x80, 0x8A, 0x07, 0x80, 0xC0, 0xE0, 0xF0, 0x78,
+  0x3F, 0x1F, 0x07, 0xB6, 0x0E, 0x03, 0x07, 0x0F, 0x1E, 0x3C, 0x78, 0xF0, 0xE0, 0xF0, 0x78, 0x3C,
+  0x1E, 0x0F, 0x07, 0x03, 0xA4, 0x0E, 0x03, 0x07, 0x0F, 0x1E, 0x3C, 0x78, 0xF0, 0xE0, 0xF0, 0x78,
+  0x3C, 0x1E, 0x0F, 0x07, 0x03, 0xA9, 0x08, 0x38, 0xC6, 0x82, 0x01, 0x01, 0x01, 0x82, 0xC6, 0x38,
+  0x90, 0x00, 0x01, 0xB2, 0x00, 0x01, 0x90, 0x08, 0x38, 0xC6, 0x82, 0x01, 0x01, 0x01, 0x82, 0xC6,
+  0x38, 0x99, 0x02, 0x01, 0x01, 0x01, 0xDC, 0x02, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0x98, 0x1A, 0xC0,
+  0xF0, 0xF8, 0x3C, 0x1E, 0x0E, 0x07, 0x03, 0x03, 0x03, 0x03, 0x02, 0x06, 0x0C, 0x06, 0x02, 0x03,
+  0x03, 0x03, 0x03, 0x07, 0x0E, 0x1E, 0x3C, 0xF8, 0xF0, 0xC0, 0x98, 0x1A, 0xC0, 0xF0, 0xF8, 0x3C,
+  0x1E, 0x0E, 0x07, 0x03, 0x03, 0x03, 0x03, 0x02, 0x06, 0x0C, 0x06, 0x02, 0x03, 0x03, 0x03, 0x03,
+  0x07, 0x0E, 0x1E, 0x3C, 0xF8, 0xF0, 0xC0, 0xB0, 0x07, 0x07, 0x1F, 0x3F, 0x78, 0xF0, 0xE0, 0xC0,
+  0x80, 0x8A, 0x07, 0x80, 0xC0, 0xE0, 0xF0, 0x78, 0x3F, 0x1F, 0x07, 0x98, 0x07, 0x07, 0x1F, 0x3F,
+  0x78, 0xF0, 0xE0, 0xC0, 0x80, 0x8A, 0x07, 0x80, 0xC0, 0xE0, 0xF0, 0x78, 0x3F, 0x1F, 0x07, 0xB6,
+  0x0E, 0x03, 0x07, 0x0F, 0x1E, 0x3C, 0x78, 0xF0, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x03,
+  0xA4, 0x0E, 0x03, 0x07, 0x0F, 0x1E, 0x3C, 0x78, 0xF0, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07,
+  0x03, 0xA9, 0x08, 0x38, 0xC6, 0x82, 0x01, 0x01, 0x01, 0x82, 0xC6, 0x38, 0x90, 0x00, 0x01, 0xB2,
+  0x00, 0x01, 0x90, 0x08, 0x38, 0xC6, 0x82, 0x01, 0x01, 0x01, 0x82, 0xC6, 0x38, 0x99, 0x02, 0x01,
+  0x01, 0x01, 0xDC, 0x02, 0x01, 0x01, 0x01, 0xF1, 0x07, 0x80, 0x40, 0x40, 0xC0, 0xC0, 0x40, 0x40,
+  0x80, 0x8F, 0x07, 0x0E, 0x11, 0x11, 0x1F, 0x1F, 0x11, 0x11, 0x0E, 0xDF, 0x07, 0x03, 0x04, 0x04,
+  0x07, 0x07, 0x04, 0x04, 0x03, 0x9E, 0x1A, 0xC0, 0xF0, 0xF8, 0x3C, 0x1E, 0x0E, 0x07, 0x03, 0x03,
+  0x03, 0x03, 0x02, 0x06, 0x0C, 0x06, 0x02, 0x03, 0x03, 0x03, 0x03, 0x07, 0x0E, 0x1E, 0x3C, 0xF8,
+  0xF0, 0xC0, 0x98, 0x1A, 0xC0, 0xF0, 0xF8, 0x3C, 0x1E, 0x0E, 0x07, 0x03, 0x03, 0x03, 0x03, 0x02,
+  0x06, 0x0C, 0x06, 0x02, 0x03, 0x03, 0x03, 0x03, 0x07, 0x0E, 0x1E, 0x3C, 0xF8, 0xF0, 0xC0, 0xB0,
+  0x07, 0x07, 0x1F, 0x3F, 0x78, 0xF0, 0xE0, 0xC0, 0x80, 0x8A, 0x07, 0x80, 0xC0, 0xE0, 0xF0, 0x78,
+  0x3F, 0x1F, 0x07, 0x98, 0x07, 0x07, 0x1F, 0x3F, 0x78, 0xF0, 0xE0, 0xC0, 0x80, 0x8A, 0x07, 0x80,
+  0xC0, 0xE0, 0xF0, 0x78, 0x3F, 0x1F, 0x07, 0xB6, 0x0E, 0x03, 0x07, 0x0F, 0x1E, 0x3C, 0x78, 0xF0,
+  0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x03, 0xA4, 0x0E, 0x03, 0x07, 0x0F, 0x1E, 0x3C, 0x78,
+  0xF0, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x03, 0xA9, 0x08, 0x38, 0xC6, 0x82, 0x01, 0x01,
+  0x01, 0x82, 0xC6, 0x38, 0x90, 0x00, 0x01, 0xB2, 0x00, 0x01, 0x90, 0x08, 0x38, 0xC6, 0x82, 0x01,
+  0x01, 0x01, 0x82, 0xC6, 0x38, 0x99, 0x02, 0x01, 0x01, 0x01, 0xDC, 0x02, 0x01, 0x01, 0x01, 0xFF,
+  0xFF, 0x98, 0x1A, 0xC0, 0xF0, 0xF8, 0x3C, 0x1E, 0x0E, 0x07, 0x03, 0x03, 0x03, 0x03, 0x02, 0x06,
+  0x0C, 0x06, 0x02, 0x03, 0x03, 0x03, 0x03, 0x07, 0x0E, 0x1E, 0x3C, 0xF8, 0xF0, 0xC0, 0x98, 0x1A,
+  0xC0, 0xF0, 0xF8, 0x3C, 0x1E, 0x0E, 0x07, 0x03, 0x03, 0x03, 0x03, 0x02, 0x06, 0x0C, 0x06, 0x02,
+  0x03, 0x03, 0x03, 0x03, 0x07, 0x0E, 0x1E, 0x3C, 0xF8, 0xF0, 0xC0, 0xB0, 0x07, 0x07, 0x1F, 0x3F,
+  0x78, 0xF0, 0xE0, 0xC0, 0x80, 0x8A, 0x07, 0x80, 0xC0, 0xE0, 0xF0, 0x78, 0x3F, 0x1F, 0x07, 0x98,
+  0x07, 0x07, 0x1F, 0x3F, 0x78, 0xF0, 0xE0, 0xC0, 0x80, 0x8A, 0x07, 0x80, 0xC0, 0xE0, 0xF0, 0x78,
+  0x3F, 0x1F, 0x07, 0xB6, 0x0E, 0x03, 0x07, 0x0F, 0x1E, 0x3C, 0x78, 0xF0, 0xE0, 0xF0, 0x78, 0x3C,
+  0x1E, 0x0F, 0x07, 0x03, 0xA4, 0x0E, 0x03, 0x07, 0x0F, 0x1E, 0x3C, 0x78, 0xF0, 0xE0, 0xF0, 0x78,
+  0x3C, 0x1E, 0x0F, 0x07, 0x03, 0xA9, 0x08, 0x38, 0xC6, 0x82, 0x01, 0x01, 0x01, 0x82, 0xC6, 0x38,
+  0x90, 0x00, 0x01, 0xB2, 0x00, 0x01, 0x90, 0x08, 0x38, 0xC6, 0x82, 0x01, 0x01, 0x01, 0x82, 0xC6,
+  0x38, 0x99, 0x02, 0x01, 0x01, 0x01, 0xDC, 0x02, 0x01, 0x01, 0x01, 0xF1, 0x07, 0x80, 0x40, 0x40,
+  0xC0, 0xC0, 0x40, 0x40, 0x80, 0x8F, 0x07, 0x0E, 0x11, 0x11, 0x1F, 0x1F, 0x11, 0x11, 0x0E, 0xDF,
+  0x07, 0x03, 0x04, 0x04, 0x07, 0x07, 0x04, 0x04, 0x03, 0x9E, 0x1A, 0xC0, 0xF0, 0xF8, 0x3C, 0x1E,
+  0x0E, 0x07, 0x03, 0x03, 0x03, 0x03, 0x02, 0x06, 0x0C, 0x06, 0x02, 0x03, 0x03, 0x03, 0x03, 0x07,
+  0x0E, 0x1E, 0x3C, 0xF8, 0xF0, 0xC0, 0x98, 0x1A, 0xC0, 0xF0, 0xF8, 0x3C, 0x1E, 0x0E, 0x07, 0x03,
+  0x03, 0x03, 0x03, 0x02, 0x06, 0x0C, 0x06, 0x02, 0x03, 0x03, 0x03, 0x03, 0x07, 0x0E, 0x1E, 0x3C,
+  0xF8, 0xF0, 0xC0, 0xB0, 0x07, 0x07, 0x1F, 0x3F, 0x78, 0xF0, 0xE0, 0xC0, 0x80, 0x8A, 0x07, 0x80,
+  0xC0, 0xE0, 0xF0, 0x78, 0x3F, 0x1F, 0x07, 0x98, 0x07, 0x07, 0x1F, 0x3F, 0x78, 0xF0, 0xE0, 0xC0,
+  0x80, 0x8A, 0x07, 0x80, 0xC0, 0xE0, 0xF0, 0x78, 0x3F, 0x1F, 0x07, 0xB6, 0x0E, 0x03, 0x07, 0x0F,
+  0x1E, 0x3C, 0x78, 0xF0, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x03, 0xA4, 0x0E, 0x03, 0x07,
+  0x0F, 0x1E, 0x3C, 0x78, 0xF0, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x03, 0xA9, 0x08, 0x38,
+  0xC6, 0x82, 0x01, 0x01, 0x01, 0x82, 0xC6, 0x38, 0x90, 0x00, 0x01, 0xB2, 0x00, 0x01, 0x90, 0x08,
+  0x38, 0xC6, 0x82, 0x01, 0x01, 0x01, 0x82, 0xC6, 0x38, 0x99, 0x02, 0x01, 0x01, 0x01, 0xDC, 0x02,
+  0x01, 0x01, 0x01, 0xFF, 0xFF, 0x98, 0x1A, 0xC0, 0xF0, 0xF8, 0x3C, 0x1E, 0x0E, 0x07, 0x03, 0x03,
+  0x03, 0x03, 0x02, 0x06, 0x0C, 0x06, 0x02, 0x03, 0x03, 0x03, 0x03, 0x07, 0x0E, 0x1E, 0x3C, 0xF8,
+  0xF0, 0xC0, 0x98, 0x1A, 0xC0, 0xF0, 0xF8, 0x3C, 0x1E, 0x0E, 0x07, 0x03, 0x03, 0x03, 0x03, 0x02,
+  0x06, 0x0C, 0x06, 0x02, 0x03, 0x03, 0x03, 0x03, 0x07, 0x0E, 0x1E, 0x3C, 0xF8, 0xF0, 0xC0, 0xB0,
+  0x07, 0x07, 0x1F, 0x3F, 0x78, 0xF0, 0xE0, 0xC0, 0x80, 0x8A, 0x07, 0x80, 0xC0, 0xE0, 0xF0, 0x78,
+  0x3F, 0x1F, 0x07, 0x98, 0x07, 0x07, 0x1F, 0x3F, 0x78, 0xF0, 0xE0, 0xC0, 0x80, 0x8A, 0x07, 0x80,
+  0xC0, 0xE0, 0xF0, 0x78, 0x3F, 0x1F, 0x07, 0xB6, 0x0E, 0x03, 0x07, 0x0F, 0x1E, 0x3C, 0x78, 0xF0,
+  0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x03, 0xA4, 0x0E, 0x03, 0x07, 0x0F, 0x1E, 0x3C, 0x78,
+  0xF0, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x03, 0xA9, 0x08, 0x38, 0xC6, 0x82, 0x01, 0x01,
+  0x01, 0x82, 0xC6, 0x38, 0x90, 0x00, 0x01, 0xB2, 0x00, 0x01, 0x90, 0x08, 0x38, 0xC6, 0x82, 0x01,
+  0x01, 0x01, 0x82, 0xC6, 0x38, 0x99, 0x02, 0x01, 0x01, 0x01, 0xDC, 0x02, 0x01, 0x01, 0x01, 0xF1,
+  0x07, 0x80, 0x40, 0x40, 0xC0, 0xC0, 0x40, 0x40, 0x80, 0x8F, 0x07, 0x0E, 0x11, 0x11, 0x1F, 0x1F,
+  0x11, 0x11, 0x0E, 0xDF, 0x07, 0x03, 0x04, 0x04, 0x07, 0x07, 0x04, 0x04, 0x03, 0x9E, 0x1A, 0xC0,
+  0xF0, 0xF8, 0x3C, 0x1E, 0x0E, 0x07, 0x03, 0x03, 0x03, 0x03, 0x02, 0x06, 0x0C, 0x06, 0x02, 0x03,
+  0x03, 0x03, 0x03, 0x07, 0x0E, 0x1E, 0x3C, 0xF8, 0xF0, 0xC0, 0x98, 0x1A, 0xC0, 0xF0, 0xF8, 0x3C,
+  0x1E, 0x0E, 0x07, 0x03, 0x03, 0x03, 0x03, 0x02, 0x06, 0x0C, 0x06, 0x02, 0x03, 0x03, 0x03, 0x03,
+  0x07, 0x0E, 0x1E, 0x3C, 0xF8, 0xF0, 0xC0, 0xB0, 0x07, 0x07, 0x1F, 0x3F, 0x78, 0xF0, 0xE0, 0xC0,
+  0x80, 0x8A, 0x07, 0x80, 0xC0, 0xE0, 0xF0, 0x78, 0x3F, 0x1F, 0x07, 0x98, 0x07, 0x07, 0x1F, 0x3F,
+  0x78, 0xF0, 0xE0, 0xC0, 0x80, 0x8A, 0x07, 0x80, 0xC0, 0xE0, 0xF0, 0x78, 0x3F, 0x1F, 0x07, 0xB6,
+  0x0E, 0x03, 0x07, 0x0F, 0x1E, 0x3C, 0x78, 0xF0, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x03,
+  0xA4, 0x0E, 0x03, 0x07, 0x0F, 0x1E, 0x3C, 0x78, 0xF0, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07,
+  0x03, 0xA9, 0x08, 0x38, 0xC6, 0x82, 0x01, 0x01, 0x01, 0x82, 0xC6, 0x38, 0x90, 0x00, 0x01, 0xB2,
+  0x00, 0x01, 0x90, 0x08, 0x38, 0xC6, 0x82, 0x01, 0x01, 0x01, 0x82, 0xC6, 0x38, 0x99, 0x02, 0x01,
+  0x01, 0x01, 0xDC, 0x02, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0x98, 0x1A, 0xC0, 0xF0, 0xF8, 0x3C, 0x1E,
+  0x0E, 0x07, 0x03, 0x03, 0x03, 0x03, 0x02, 0x06, 0x0C, 0x06, 0x02, 0x03, 0x03, 0x03, 0x03, 0x07,
+  0x0E, 0x1E, 0x3C, 0xF8, 0xF0, 0xC0, 0x98, 0x1A, 0xC0, 0xF0, 0xF8, 0x3C, 0x1E, 0x0E, 0x07, 0x03,
+  0x03, 0x03, 0x03, 0x02, 0x06, 0x0C, 0x06, 0x02, 0x03, 0x03, 0x03, 0x03, 0x07, 0x0E, 0x1E, 0x3C,
+  0xF8, 0xF0, 0xC0, 0xB0, 0x07, 0x07, 0x1F, 0x3F, 0x78, 0xF0, 0xE0, 0xC0, 0x80, 0x8A, 0x07, 0x80,
+  0xC0, 0xE0, 0xF0, 0x78, 0x3F, 0x1F, 0x07, 0x98, 0x07, 0x07, 0x1F, 0x3F, 0x78, 0xF0, 0xE0, 0xC0,
+  0x80, 0x8A, 0x07, 0x80, 0xC0, 0xE0, 0xF0, 0x78, 0x3F, 0x1F, 0x07, 0xB6, 0x0E, 0x03, 0x07, 0x0F,
+  0x1E, 0x3C, 0x78, 0xF0, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x03, 0xA4, 0x0E, 0x03, 0x07,
+  0x0F, 0x1E, 0x3C, 0x78, 0xF0, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x03, 0xA9, 0x08, 0x38,
+  0xC6, 0x82, 0x01, 0x01, 0x01, 0x82, 0xC6, 0x38, 0x90, 0x00, 0x01, 0xB2, 0x00, 0x01, 0x90, 0x08,
+  0x38, 0xC6, 0x82, 0x01, 0x01, 0x01, 0x82, 0xC6, 0x38, 0x99, 0x02, 0x01, 0x01, 0x01, 0xDC, 0x02,
+  0x01, 0x01, 0x01, 0xF1, 0x07, 0x80, 0x40, 0x40, 0xC0, 0xC0, 0x40, 0x40, 0x80, 0x8F, 0x07, 0x0E,
+  0x11, 0x11, 0x1F, 0x1F, 0x11, 0x11, 0x0E, 0xDF, 0x07, 0x03, 0x04, 0x04, 0x07, 0x07, 0x04, 0x04,
+  0x03, 0x9E, 0x1A, 0xC0, 0xF0, 0xF8, 0x3C, 0x1E, 0x0E, 0x07, 0x03, 0x03, 0x03, 0x03, 0x02, 0x06,
+  0x0C, 0x06, 0x02, 0x03, 0x03, 0x03, 0x03, 0x07, 0x0E, 0x1E, 0x3C, 0xF8, 0xF0, 0xC0, 0x98, 0x1A,
+  0xC0, 0xF0, 0xF8, 0x3C, 0x1E, 0x0E, 0x07, 0x03, 0x03, 0x03, 0x03, 0x02, 0x06, 0x0C, 0x06, 0x02,
+  0x03, 0x03, 0x03, 0x03, 0x07, 0x0E, 0x1E, 0x3C, 0xF8, 0xF0, 0xC0, 0xB0, 0x07, 0x07, 0x1F, 0x3F,
+  0x78, 0xF0, 0xE0, 0xC0, 0x80, 0x8A, 0x07, 0x80, 0xC0, 0xE0, 0xF0, 0x78, 0x3F, 0x1F, 0x07, 0x98,
+  0x07, 0x07, 0x1F, 0x3F, 0x78, 0xF0, 0xE0, 0xC0, 0x80, 0x8A, 0x07, 0x80, 0xC0, 0xE0, 0xF0, 0x78,
+  0x3F, 0x1F, 0x07, 0xB6, 0x0E, 0x03, 0x07, 0x0F, 0x1E, 0x3C, 0x78, 0xF0, 0xE0, 0xF0, 0x78, 0x3C,
+  0x1E, 0x0F, 0x07, 0x03, 0xA4, 0x0E, 0x03, 0x07, 0x0F, 0x1E, 0x3C, 0x78, 0xF0, 0xE0, 0xF0, 0x78,
+  0x3C, 0x1E, 0x0F, 0x07, 0x03, 0xA9, 0x08, 0x38, 0xC6, 0x82, 0x01, 0x01, 0x01, 0x82, 0xC6, 0x38,
+  0x90, 0x00, 0x01, 0xB2, 0x00, 0x01, 0x90, 0x08, 0x38, 0xC6, 0x82, 0x01, 0x01, 0x01, 0x82, 0xC6,
+  0x38, 0x99, 0x02, 0x01, 0x01, 0x01, 0xDC, 0x02, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0x98, 0x1A, 0xC0,
+  0xF0, 0xF8, 0x3C, 0x1E, 0x0E, 0x07, 0x03, 0x03, 0x03, 0x03, 0x02, 0x06, 0x0C, 0x06, 0x02, 0x03,
+  0x03, 0x03, 0x03, 0x07, 0x0E, 0x1E, 0x3C, 0xF8, 0xF0, 0xC0, 0x98, 0x1A, 0xC0, 0xF0, 0xF8, 0x3C,
+  0x1E, 0x0E, 0x07, 0x03, 0x03, 0x03, 0x03, 0x02, 0x06, 0x0C, 0x06, 0x02, 0x03, 0x03, 0x03, 0x03,
+  0x07, 0x0E, 0x1E, 0x3C, 0xF8, 0xF0, 0xC0, 0xB0, 0x07, 0x07, 0x1F, 0x3F, 0x78, 0xF0, 0xE0, 0xC0,
+  0x80, 0x8A, 0x07, 0x80, 0xC0, 0xE0, 0xF0, 0x78, 0x3F, 0x1F, 0x07, 0x98, 0x07, 0x07, 0x1F, 0x3F,
+  0x78, 0xF0, 0xE0, 0xC0, 0x80, 0x8A, 0x07, 0x80, 0xC0, 0xE0, 0xF0, 0x78, 0x3F, 0x1F, 0x07, 0xB6,
+  0x0E, 0x03, 0x07, 0x0F, 0x1E, 0x3C, 0x78, 0xF0, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x03,
+  0xA4, 0x0E, 0x03, 0x07, 0x0F, 0x1E, 0x3C, 0x78, 0xF0, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07,
+  0x03, 0xA9, 0x08, 0x38, 0xC6, 0x82, 0x01, 0x01, 0x01, 0x82, 0xC6, 0x38, 0x90, 0x00, 0x01, 0xB2,
+  0x00, 0x01, 0x90, 0x08, 0x38, 0xC6, 0x82, 0x01, 0x01, 0x01, 0x82, 0xC6, 0x38, 0x99, 0x02, 0x01,
+  0x01, 0x01, 0xDC, 0x02, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0x9A, 0x16, 0xC0, 0x30, 0x18, 0x0C, 0x04,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x0C, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x0C, 0x18,
+  0x30, 0xC0, 0x9C, 0x16, 0xC0, 0x30, 0x18, 0x0C, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x0C,
+  0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x0C, 0x18, 0x30, 0xC0, 0xB4, 0x05, 0x07, 0x18, 0x30,
+  0x60, 0x40, 0x80, 0x8A, 0x05, 0x80, 0x40, 0x60, 0x30, 0x18, 0x07, 0x9C, 0x05, 0x07, 0x18, 0x30,
+  0x60, 0x40, 0x80, 0x8A, 0x05, 0x80, 0x40, 0x60, 0x30, 0x18, 0x07, 0xB9, 0x0C, 0x01, 0x03, 0x06,
+  0x0C, 0x18, 0x30, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0xA6, 0x0C, 0x01, 0x03, 0x06, 0x0C,
+  0x18, 0x30, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0xAA, 0x08, 0x38, 0xC6, 0x82, 0x01, 0x01,
+  0x01, 0x82, 0xC6, 0x38, 0xD6, 0x08, 0x38, 0xC6, 0x82, 0x01, 0x01, 0x01, 0x82, 0xC6, 0x38, 0x99,
+  0x02, 0x01, 0x01, 0x01, 0xDC, 0x02, 0x01, 0x01, 0x01, 0x8A, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0xF8, 0x07, 0x09, 0x19, 0x19, 0x10, 0x10, 0x19, 0x19, 0x09, 0x8B, 0x06, 0xC0, 0xC0, 0x40,
+  0x40, 0xC0, 0x40, 0x80, 0xF6, 0x08, 0x07, 0x0B, 0x0C, 0x0B, 0x08, 0x0F, 0x0C, 0x03, 0x03, 0x8A,
+  0x07, 0x40, 0x60, 0x60, 0x20, 0x20, 0x60, 0x60, 0x40, 0xF7, 0x07, 0x02, 0x06, 0x06, 0x04, 0x04,
+  0x06, 0x06, 0x02, 0x8A, 0x08, 0xC0, 0xC0, 0x30, 0xF0, 0x10, 0xD0, 0x30, 0xD0, 0xE0, 0xF6, 0x06,
+  0x01, 0x02, 0x03, 0x02, 0x02, 0x03, 0x03, 0x8B, 0x07, 0x90, 0x98, 0x98, 0x08, 0x08, 0x98, 0x98,
+  0x90, 0xF8, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x8B, 0x08, 0x70, 0xB0, 0xCC, 0xBC, 0x84,
+  0xF4, 0xCC, 0x34, 0x38, 0x8C, 0x07, 0x24, 0x66, 0x66, 0x42, 0x42, 0x66, 0x66, 0x24, 0x8C, 0x08,
+  0x1C, 0x2C, 0x33, 0x2F, 0x21, 0x3D, 0x33, 0x0D, 0x0E, 0x8D, 0x07, 0x09, 0x19, 0x19, 0x10, 0x10,
+  0x19, 0x19, 0x09, 0x8D, 0x07, 0x07, 0x08, 0x08, 0x0F, 0x0F, 0x08, 0x08, 0x07, 0xFF, 0xFF, 0xFF,
+  0xF7, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0xDA, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0x97, 0x03,
+  0x7C, 0xC6, 0x01, 0x01, 0x82, 0x03, 0x01, 0x01, 0xC6, 0x7C, 0xD4, 0x03, 0x7C, 0xC6, 0x01, 0x01,
+  0x82, 0x03, 0x01, 0x01, 0xC6, 0x7C, 0x96, 0x06, 0x01, 0x03, 0x02, 0x02, 0x02, 0x03, 0x01, 0xD8,
+  0x06, 0x01, 0x03, 0x02, 0x02, 0x02, 0x03, 0x01, 0xFF, 0xFF, 0x99, 0x17, 0x80, 0xE0, 0xF0, 0xF8,
+  0xF8, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xF8,
+  0xF8, 0xF0, 0xE0, 0x80, 0x9B, 0x17, 0x80, 0xE0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC,
+  0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xF8, 0xF8, 0xF0, 0xE0, 0x80, 0xB3, 0x17,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0x83, 0x01, 0x01, 0x01, 0x83, 0xC7,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9B, 0x17, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC7, 0x83, 0x01, 0x01, 0x01, 0x83, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xB3, 0x17, 0x01, 0x07, 0x0F, 0x1F, 0x1F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x1F, 0x1F, 0x0F, 0x07, 0x01, 0x9B, 0x17, 0x01, 0x07,
+  0x0F, 0x1F, 0x1F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x1F, 0x1F, 0x0F, 0x07, 0x01, 0xFF, 0xD5, 0x08, 0x70, 0xFC, 0xFC, 0xFE, 0xFE, 0xFE, 0xFC,
+  0xFC, 0x70, 0xF7, 0x06, 0x01, 0x01, 0x03, 0x03, 0x03, 0x01, 0x01, 0xFF, 0xFF, 0x99, 0x17, 0x40,
+  0x10, 0x08, 0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x04, 0x04, 0x08, 0x10, 0x40, 0x9B, 0x17, 0x40, 0x10, 0x08, 0x04, 0x04, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x04, 0x08, 0x10,
+  0x40, 0xFF, 0xB3, 0x17, 0x02, 0x08, 0x10, 0x20, 0x20, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x20, 0x20, 0x10, 0x08, 0x02, 0x9B, 0x17, 0x02, 0x08,
+  0x10, 0x20, 0x20, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x20, 0x20, 0x10, 0x08, 0x02, 0xFF, 0x9C, 0x11, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0xA1, 0x11, 0x80, 0x80, 0xC0,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0xB6,
+  0x17, 0x38, 0x0E, 0x07, 0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x81, 0x81, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x07, 0x0E, 0x38, 0x9B, 0x17, 0x38, 0x0E, 0x07, 0x03, 0x03,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x81, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03,
+  0x07, 0x0E, 0x38, 0xBC, 0x06, 0x36, 0x63, 0xC1, 0xC1, 0xC1, 0x63, 0x36, 0xAC, 0x06, 0x36, 0x63,
+  0xC1, 0xC1, 0xC1, 0x63, 0x36, 0xFF, 0xDF, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF6, 0x0C, 0xF8,
+  0xFC, 0x8E, 0x03, 0x03, 0x01, 0x01, 0x01, 0x03, 0x03, 0x8E, 0xFC, 0xF8, 0xF3, 0x0A, 0x01, 0x03,
+  0x06, 0x0E, 0x0C, 0x0C, 0x0C, 0x0E, 0x06, 0x03, 0x01, 0xFF, 0x9B, 0x13, 0x80, 0x40, 0x40, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x40, 0x80,
+  0x9F, 0x13, 0x80, 0x40, 0x40, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x40, 0x40, 0x80, 0xB5, 0x01, 0x04, 0x01, 0x93, 0x01, 0x01, 0x04, 0x9B, 0x01,
+  0x04, 0x01, 0x93, 0x01, 0x01, 0x04, 0xFF, 0xB3, 0x17, 0x04, 0x10, 0x20, 0x40, 0x40, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x20, 0x10,
+  0x04, 0x9B, 0x17, 0x04, 0x10, 0x20, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x20, 0x10, 0x04, 0xFF, 0x9A, 0x15, 0xC0, 0x60,
+  0x30, 0x30, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+  0x30, 0x30, 0x60, 0xC0, 0x9D, 0x15, 0xC0, 0x60, 0x30, 0x30, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x30, 0x30, 0x60, 0xC0, 0xB4, 0x00, 0x03, 0x88,
+  0x04, 0x80, 0x40, 0x40, 0x40, 0x80, 0x87, 0x00, 0x03, 0x9B, 0x00, 0x03, 0x88, 0x04, 0x80, 0x40,
+  0x40, 0x40, 0x80, 0x87, 0x00, 0x03, 0xBC, 0x06, 0x09, 0x10, 0x20, 0x20, 0x20, 0x10, 0x09, 0xAC,
+  0x06, 0x09, 0x10, 0x20, 0x20, 0x20, 0x10, 0x09, 0xBB, 0x17, 0x04, 0x10, 0x20, 0x40, 0x40, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x20,
+  0x10, 0x04, 0x9B, 0x17, 0x04, 0x10, 0x20, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x20, 0x10, 0x04, 0xD5, 0x08, 0x80, 0x80,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0xF3, 0x03, 0xF8, 0x06, 0x03, 0x01, 0x86, 0x03, 0x01,
+  0x03, 0x06, 0xF8, 0xF1, 0x0C, 0x03, 0x06, 0x0C, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x08, 0x0C,
+  0x06, 0x03, 0xFF, 0x9A, 0x15, 0xC0, 0xE0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+  0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0xE0, 0xC0, 0x9D, 0x15, 0xC0, 0xE0, 0xF0,
+  0xF0, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF0,
+  0xF0, 0xE0, 0xC0, 0xB4, 0x17, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F,
+  0x3F, 0x3F, 0x3F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9B, 0x17, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x3F, 0x3F, 0x3F, 0x7F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x17, 0x9F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x08, 0x00, 0x10, 0x10, 0x10, 0x00, 0x08, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x9F, 0x9B, 0x17, 0x9F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x08, 0x00, 0x10, 0x10,
+  0x10, 0x00, 0x08, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x9F, 0xB3, 0x17, 0x03, 0x0F, 0x1F,
+  0x3F, 0x3F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
+  0x3F, 0x3F, 0x1F, 0x0F, 0x03, 0x9B, 0x17, 0x03, 0x0F, 0x1F, 0x3F, 0x3F, 0x7F, 0x7F, 0x7F, 0x7F,
+  0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x3F, 0x1F, 0x0F, 0x03, 0xFF,
+  0x9A, 0x15, 0xC0, 0xE0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+  0xF8, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0xE0, 0xC0, 0x9D, 0x15, 0xC0, 0xE0, 0xF0, 0xF0, 0xF8, 0xF8,
+  0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0xE0, 0xC0,
+  0xB4, 0x17, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x3F, 0x3F, 0x3F,
+  0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9B, 0x17, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x3F, 0x3F, 0x3F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x17, 0x9F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x08,
+  0x00, 0x10, 0x10, 0x10, 0x00, 0x08, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x9F, 0x9B, 0x17,
+  0x9F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x08, 0x00, 0x10, 0x10, 0x10, 0x00, 0x08,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x9F, 0xB3, 0x17, 0x03, 0x0F, 0x1F, 0x3F, 0x3F, 0x7F,
+  0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x3F, 0x1F,
+  0x0F, 0x03, 0x9B, 0x17, 0x03, 0x0F, 0x1F, 0x3F, 0x3F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
+  0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x3F, 0x1F, 0x0F, 0x03, 0xFF, 0x99, 0x17, 0x80,
+  0x20, 0x10, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x08, 0x08, 0x10, 0x20, 0x80, 0x9B, 0x17, 0x80, 0x20, 0x10, 0x08, 0x08, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x08, 0x10, 0x20,
+  0x80, 0xBC, 0x06, 0x80, 0x40, 0x20, 0x20, 0x20, 0x40, 0x80, 0xAC, 0x06, 0x80, 0x40, 0x20, 0x20,
+  0x20, 0x40, 0x80, 0xC4, 0x06, 0x04, 0x08, 0x10, 0x10, 0x10, 0x08, 0x04, 0xAC, 0x06, 0x04, 0x08,
+  0x10, 0x10, 0x10, 0x08, 0x04, 0xBB, 0x17, 0x02, 0x08, 0x10, 0x20, 0x20, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x20, 0x20, 0x10, 0x08, 0x02, 0x9B,
+  0x17, 0x02, 0x08, 0x10, 0x20, 0x20, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x20, 0x20, 0x10, 0x08, 0x02, 0xD4, 0x0A, 0x80, 0x40, 0x40, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x40, 0x40, 0x80, 0xF1, 0x02, 0xF8, 0x06, 0x01, 0x8A, 0x02, 0x01, 0x06, 0xF8,
+  0xEF, 0x0E, 0x03, 0x04, 0x08, 0x10, 0x10, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10, 0x10, 0x08, 0x04,
+  0x03, 0xFF, 0x99, 0x17, 0x80, 0x60, 0x30, 0x18, 0x18, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+  0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x18, 0x18, 0x30, 0x60, 0x80, 0x9B, 0x17, 0x80, 0x60,
+  0x30, 0x18, 0x18, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+  0x0C, 0x18, 0x18, 0x30, 0x60, 0x80, 0xB3, 0x00, 0x01, 0x87, 0x06, 0x80, 0xC0, 0x60, 0x60, 0x60,
+  0xC0, 0x80, 0x86, 0x00, 0x01, 0x9B, 0x00, 0x01, 0x87, 0x06, 0x80, 0xC0, 0x60, 0x60, 0x60, 0xC0,
+  0x80, 0x86, 0x00, 0x01, 0xBC, 0x06, 0x0D, 0x18, 0x30, 0x30, 0x30, 0x18, 0x0D, 0xAC, 0x06, 0x0D,
+  0x18, 0x30, 0x30, 0x30, 0x18, 0x0D, 0xBB, 0x17, 0x06, 0x18, 0x30, 0x60, 0x60, 0xC0, 0xC0, 0xC0,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x60, 0x60, 0x30, 0x18, 0x06,
+  0x9B, 0x17, 0x06, 0x18, 0x30, 0x60, 0x60, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x60, 0x60, 0x30, 0x18, 0x06, 0xD4, 0x0A, 0x80, 0xC0, 0xC0, 0x60,
+  0x60, 0x60, 0x60, 0x60, 0xC0, 0xC0, 0x80, 0xF1, 0x04, 0xF8, 0xFE, 0x07, 0x03, 0x01, 0x86, 0x04,
+  0x01, 0x03, 0x07, 0xFE, 0xF8, 0xEF, 0x0E, 0x03, 0x07, 0x0E, 0x1C, 0x18, 0x30, 0x30, 0x30, 0x30,
+  0x30, 0x18, 0x1C, 0x0E, 0x07, 0x03, 0xFF, 0x99, 0x17, 0x80, 0x60, 0x30, 0x18, 0x18, 0x0C, 0x0C,
+  0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x18, 0x18, 0x30, 0x60,
+  0x80, 0x9B, 0x17, 0x80, 0x60, 0x30, 0x18, 0x18, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+  0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x18, 0x18, 0x30, 0x60, 0x80, 0xB3, 0x00, 0x01, 0x87, 0x06,
+  0x80, 0xC0, 0x60, 0x60, 0x60, 0xC0, 0x80, 0x86, 0x00, 0x01, 0x9B, 0x00, 0x01, 0x87, 0x06, 0x80,
+  0xC0, 0x60, 0x60, 0x60, 0xC0, 0x80, 0x86, 0x00, 0x01, 0xBC, 0x06, 0x0D, 0x18, 0x30, 0x30, 0x30,
+  0x18, 0x0D, 0xAC, 0x06, 0x0D, 0x18, 0x30, 0x30, 0x30, 0x18, 0x0D, 0xBB, 0x17, 0x06, 0x18, 0x30,
+  0x60, 0x60, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0x60, 0x60, 0x30, 0x18, 0x06, 0x9B, 0x17, 0x06, 0x18, 0x30, 0x60, 0x60, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x60, 0x60, 0x30, 0x18, 0x06, 0xD4,
+  0x0A, 0x80, 0xC0, 0xC0, 0x60, 0x60, 0x60, 0x60, 0x60, 0xC0, 0xC0, 0x80, 0xF1, 0x04, 0xF8, 0xFE,
+  0x07, 0x03, 0x01, 0x86, 0x04, 0x01, 0x03, 0x07, 0xFE, 0xF8, 0xEF, 0x0E, 0x03, 0x07, 0x0E, 0x1C,
+  0x18, 0x30, 0x30, 0x30, 0x30, 0x30, 0x18, 0x1C, 0x0E, 0x07, 0x03, 0xFF, 0x99, 0x17, 0x80, 0x60,
+  0x30, 0x18, 0x18, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+  0x0C, 0x18, 0x18, 0x30, 0x60, 0x80, 0x9B, 0x17, 0x80, 0x60, 0x30, 0x18, 0x18, 0x0C, 0x0C, 0x0C,
+  0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x18, 0x18, 0x30, 0x60, 0x80,
+  0xB3, 0x00, 0x01, 0x87, 0x06, 0x80, 0xC0, 0x60, 0x60, 0x60, 0xC0, 0x80, 0x86, 0x00, 0x01, 0x9B,
+  0x00, 0x01, 0x87, 0x06, 0x80, 0xC0, 0x60, 0x60, 0x60, 0xC0, 0x80, 0x86, 0x00, 0x01, 0xBC, 0x06,
+  0x0D, 0x18, 0x30, 0x30, 0x30, 0x18, 0x0D, 0xAC, 0x06, 0x0D, 0x18, 0x30, 0x30, 0x30, 0x18, 0x0D,
+  0xBB, 0x17, 0x06, 0x18, 0x30, 0x60, 0x60, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x60, 0x60, 0x30, 0x18, 0x06, 0x9B, 0x17, 0x06, 0x18, 0x30, 0x60,
+  0x60, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x60,
+  0x60, 0x30, 0x18, 0x06, 0xD4, 0x0A, 0x80, 0xC0, 0xC0, 0x60, 0x60, 0x60, 0x60, 0x60, 0xC0, 0xC0,
+  0x80, 0xF1, 0x04, 0xF8, 0xFE, 0x07, 0x03, 0x01, 0x86, 0x04, 0x01, 0x03, 0x07, 0xFE, 0xF8, 0xEF,
+  0x0E, 0x03, 0x07, 0x0E, 0x1C, 0x18, 0x30, 0x30, 0x30, 0x30, 0x30, 0x18, 0x1C, 0x0E, 0x07, 0x03,
+  0xFF, 0x99, 0x17, 0x80, 0x60, 0x30, 0x18, 0x18, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+  0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x18, 0x18, 0x30, 0x60, 0x80, 0x9B, 0x17, 0x80, 0x60, 0x30,
+  0x18, 0x18, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+  0x18, 0x18, 0x30, 0x60, 0x80, 0xB3, 0x00, 0x01, 0x87, 0x06, 0x80, 0xC0, 0x60, 0x60, 0x60, 0xC0,
+  0x80, 0x86, 0x00, 0x01, 0x9B, 0x00, 0x01, 0x87, 0x06, 0x80, 0xC0, 0x60, 0x60, 0x60, 0xC0, 0x80,
+  0x86, 0x00, 0x01, 0xBC, 0x06, 0x0D, 0x18, 0x30, 0x30, 0x30, 0x18, 0x0D, 0xAC, 0x06, 0x0D, 0x18,
+  0x30, 0x30, 0x30, 0x18, 0x0D, 0xBB, 0x17, 0x06, 0x18, 0x30, 0x60, 0x60, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x60, 0x60, 0x30, 0x18, 0x06, 0x9B,
+  0x17, 0x06, 0x18, 0x30, 0x60, 0x60, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC0, 0xC0, 0xC0, 0xC0, 0x60, 0x60, 0x30, 0x18, 0x06, 0xD4, 0x0A, 0x80, 0xC0, 0xC0, 0x60, 0x60,
+  0x60, 0x60, 0x60, 0xC0, 0xC0, 0x80, 0xF1, 0x04, 0xF8, 0xFE, 0x07, 0x03, 0x01, 0x86, 0x04, 0x01,
+  0x03, 0x07, 0xFE, 0xF8, 0xEF, 0x0E, 0x03, 0x07, 0x0E, 0x1C, 0x18, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x18, 0x1C, 0x0E, 0x07, 0x03, 0xFF, 0x99, 0x17, 0x80, 0x60, 0x30, 0x18, 0x18, 0x0C, 0x0C, 0x0C,
+  0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x18, 0x18, 0x30, 0x60, 0x80,
+  0x9B, 0x17, 0x80, 0x60, 0x30, 0x18, 0x18, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+  0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x18, 0x18, 0x30, 0x60, 0x80, 0xB3, 0x00, 0x01, 0x87, 0x06, 0x80,
+  0xC0, 0x60, 0x60, 0x60, 0xC0, 0x80, 0x86, 0x00, 0x01, 0x9B, 0x00, 0x01, 0x87, 0x06, 0x80, 0xC0,
+  0x60, 0x60, 0x60, 0xC0, 0x80, 0x86, 0x00, 0x01, 0xBC, 0x06, 0x0D, 0x18, 0x30, 0x30, 0x30, 0x18,
+  0x0D, 0xAC, 0x06, 0x0D, 0x18, 0x30, 0x30, 0x30, 0x18, 0x0D, 0xBB, 0x17, 0x06, 0x18, 0x30, 0x60,
+  0x60, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x60,
+  0x60, 0x30, 0x18, 0x06, 0x9B, 0x17, 0x06, 0x18, 0x30, 0x60, 0x60, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x60, 0x60, 0x30, 0x18, 0x06, 0xD4, 0x0A,
+  0x80, 0xC0, 0xC0, 0x60, 0x60, 0x60, 0x60, 0x60, 0xC0, 0xC0, 0x80, 0xF1, 0x04, 0xF8, 0xFE, 0x07,
+  0x03, 0x01, 0x86, 0x04, 0x01, 0x03, 0x07, 0xFE, 0xF8, 0xEF, 0x0E, 0x03, 0x07, 0x0E, 0x1C, 0x18,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x18, 0x1C, 0x0E, 0x07, 0x03, 0xFF, 0x99, 0x17, 0x80, 0x60, 0x30,
+  0x18, 0x18, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+  0x18, 0x18, 0x30, 0x60, 0x80, 0x9B, 0x17, 0x80, 0x60, 0x30, 0x18, 0x18, 0x0C, 0x0C, 0x0C, 0x0C,
+  0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x18, 0x18, 0x30, 0x60, 0x80, 0xB3,
+  0x00, 0x01, 0x87, 0x06, 0x80, 0xC0, 0x60, 0x60, 0x60, 0xC0, 0x80, 0x86, 0x00, 0x01, 0x9B, 0x00,
+  0x01, 0x87, 0x06, 0x80, 0xC0, 0x60, 0x60, 0x60, 0xC0, 0x80, 0x86, 0x00, 0x01, 0xBC, 0x06, 0x0D,
+  0x18, 0x30, 0x30, 0x30, 0x18, 0x0D, 0xAC, 0x06, 0x0D, 0x18, 0x30, 0x30, 0x30, 0x18, 0x0D, 0xBB,
+  0x17, 0x06, 0x18, 0x30, 0x60, 0x60, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC0, 0xC0, 0xC0, 0xC0, 0x60, 0x60, 0x30, 0x18, 0x06, 0x9B, 0x17, 0x06, 0x18, 0x30, 0x60, 0x60,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x60, 0x60,
+  0x30, 0x18, 0x06, 0xD4, 0x0A, 0x80, 0xC0, 0xC0, 0x60, 0x60, 0x60, 0x60, 0x60, 0xC0, 0xC0, 0x80,
+  0xF1, 0x04, 0xF8, 0xFE, 0x07, 0x03, 0x01, 0x86, 0x04, 0x01, 0x03, 0x07, 0xFE, 0xF8, 0xEF, 0x0E,
+  0x03, 0x07, 0x0E, 0x1C, 0x18, 0x30, 0x30, 0x30, 0x30, 0x30, 0x18, 0x1C, 0x0E, 0x07, 0x03, 0xFF,
+  0x99, 0x17, 0x80, 0x60, 0x30, 0x18, 0x18, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+  0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x18, 0x18, 0x30, 0x60, 0x80, 0x9B, 0x17, 0x80, 0x60, 0x30, 0x18,
+  0x18, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x18,
+  0x18, 0x30, 0x60, 0x80, 0xB3, 0x00, 0x01, 0x87, 0x06, 0x80, 0xC0, 0x60, 0x60, 0x60, 0xC0, 0x80,
+  0x86, 0x00, 0x01, 0x9B, 0x00, 0x01, 0x87, 0x06, 0x80, 0xC0, 0x60, 0x60, 0x60, 0xC0, 0x80, 0x86,
+  0x00, 0x01, 0xBC, 0x06, 0x0D, 0x18, 0x30, 0x30, 0x30, 0x18, 0x0D, 0xAC, 0x06, 0x0D, 0x18, 0x30,
+  0x30, 0x30, 0x18, 0x0D, 0xBB, 0x17, 0x06, 0x18, 0x30, 0x60, 0x60, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x60, 0x60, 0x30, 0x18, 0x06, 0x9B, 0x17,
+  0x06, 0x18, 0x30, 0x60, 0x60, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC0, 0xC0, 0xC0, 0x60, 0x60, 0x30, 0x18, 0x06, 0xD4, 0x0A, 0x80, 0xC0, 0xC0, 0x60, 0x60, 0x60,
+  0x60, 0x60, 0xC0, 0xC0, 0x80, 0xF1, 0x04, 0xF8, 0xFE, 0x07, 0x03, 0x01, 0x86, 0x04, 0x01, 0x03,
+  0x07, 0xFE, 0xF8, 0xEF, 0x0E, 0x03, 0x07, 0x0E, 0x1C, 0x18, 0x30, 0x30, 0x30, 0x30, 0x30, 0x18,
+  0x1C, 0x0E, 0x07, 0x03, 0xFF, 0x99, 0x17, 0x80, 0x60, 0x30, 0x18, 0x18, 0x0C, 0x0C, 0x0C, 0x0C,
+  0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x18, 0x18, 0x30, 0x60, 0x80, 0x9B,
+  0x17, 0x80, 0x60, 0x30, 0x18, 0x18, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+  0x0C, 0x0C, 0x0C, 0x0C, 0x18, 0x18, 0x30, 0x60, 0x80, 0xB3, 0x00, 0x01, 0x87, 0x06, 0x80, 0xC0,
+  0x60, 0x60, 0x60, 0xC0, 0x80, 0x86, 0x00, 0x01, 0x9B, 0x00, 0x01, 0x87, 0x06, 0x80, 0xC0, 0x60,
+  0x60, 0x60, 0xC0, 0x80, 0x86, 0x00, 0x01, 0xBC, 0x06, 0x0D, 0x18, 0x30, 0x30, 0x30, 0x18, 0x0D,
+  0xAC, 0x06, 0x0D, 0x18, 0x30, 0x30, 0x30, 0x18, 0x0D, 0xBB, 0x17, 0x06, 0x18, 0x30, 0x60, 0x60,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x60, 0x60,
+  0x30, 0x18, 0x06, 0x9B, 0x17, 0x06, 0x18, 0x30, 0x60, 0x60, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x60, 0x60, 0x30, 0x18, 0x06, 0xD4, 0x0A, 0x80,
+  0xC0, 0xC0, 0x60, 0x60, 0x60, 0x60, 0x60, 0xC0, 0xC0, 0x80, 0xF1, 0x04, 0xF8, 0xFE, 0x07, 0x03,
+  0x01, 0x86, 0x04, 0x01, 0x03, 0x07, 0xFE, 0xF8, 0xEF, 0x0E, 0x03, 0x07, 0x0E, 0x1C, 0x18, 0x30,
+  0x30, 0x30, 0x30, 0x30, 0x18, 0x1C, 0x0E, 0x07, 0x03, 0xFF, 0x99, 0x17, 0x80, 0x60, 0x30, 0x18,
+  0x18, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x18,
+  0x18, 0x30, 0x60, 0x80, 0x9B, 0x17, 0x80, 0x60, 0x30, 0x18, 0x18, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+  0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x18, 0x18, 0x30, 0x60, 0x80, 0xB3, 0x00,
+  0x01, 0x87, 0x06, 0x80, 0xC0, 0x60, 0x60, 0x60, 0xC0, 0x80, 0x86, 0x00, 0x01, 0x9B, 0x00, 0x01,
+  0x87, 0x06, 0x80, 0xC0, 0x60, 0x60, 0x60, 0xC0, 0x80, 0x86, 0x00, 0x01, 0xBC, 0x06, 0x0D, 0x18,
+  0x30, 0x30, 0x30, 0x18, 0x0D, 0xAC, 0x06, 0x0D, 0x18, 0x30, 0x30, 0x30, 0x18, 0x0D, 0xBB, 0x17,
+  0x06, 0x18, 0x30, 0x60, 0x60, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC0, 0xC0, 0xC0, 0x60, 0x60, 0x30, 0x18, 0x06, 0x9B, 0x17, 0x06, 0x18, 0x30, 0x60, 0x60, 0xC0,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x60, 0x60, 0x30,
+  0x18, 0x06, 0xD4, 0x0A, 0x80, 0xC0, 0xC0, 0x60, 0x60, 0x60, 0x60, 0x60, 0xC0, 0xC0, 0x80, 0xF1,
+  0x04, 0xF8, 0xFE, 0x07, 0x03, 0x01, 0x86, 0x04, 0x01, 0x03, 0x07, 0xFE, 0xF8, 0xEF, 0x0E, 0x03,
+  0x07, 0x0E, 0x1C, 0x18, 0x30, 0x30, 0x30, 0x30, 0x30, 0x18, 0x1C, 0x0E, 0x07, 0x03, 0xFF, 0x99,
+  0x17, 0x80, 0x60, 0x30, 0x18, 0x18, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+  0x0C, 0x0C, 0x0C, 0x0C, 0x18, 0x18, 0x30, 0x60, 0x80, 0x9B, 0x17, 0x80, 0x60, 0x30, 0x18, 0x18,
+  0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x18, 0x18,
+  0x30, 0x60, 0x80, 0xB3, 0x00, 0x01, 0x87, 0x06, 0x80, 0xC0, 0x60, 0x60, 0x60, 0xC0, 0x80, 0x86,
+  0x00, 0x01, 0x9B, 0x00, 0x01, 0x87, 0x06, 0x80, 0xC0, 0x60, 0x60, 0x60, 0xC0, 0x80, 0x86, 0x00,
+  0x01, 0xBC, 0x06, 0x0D, 0x18, 0x30, 0x30, 0x30, 0x18, 0x0D, 0xAC, 0x06, 0x0D, 0x18, 0x30, 0x30,
+  0x30, 0x18, 0x0D, 0xBB, 0x17, 0x06, 0x18, 0x30, 0x60, 0x60, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x60, 0x60, 0x30, 0x18, 0x06, 0x9B, 0x17, 0x06,
+  0x18, 0x30, 0x60, 0x60, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC0, 0xC0, 0x60, 0x60, 0x30, 0x18, 0x06, 0xD4, 0x0A, 0x80, 0xC0, 0xC0, 0x60, 0x60, 0x60, 0x60,
+  0x60, 0xC0, 0xC0, 0x80, 0xF1, 0x04, 0xF8, 0xFE, 0x07, 0x03, 0x01, 0x86, 0x04, 0x01, 0x03, 0x07,
+  0xFE, 0xF8, 0xEF, 0x0E, 0x03, 0x07, 0x0E, 0x1C, 0x18, 0x30, 0x30, 0x30, 0x30, 0x30, 0x18, 0x1C,
+  0x0E, 0x07, 0x03, 0xFF, 0x99, 0x17, 0x80, 0x60, 0x30, 0x18, 0x18, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+  0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x18, 0x18, 0x30, 0x60, 0x80, 0x9B, 0x17,
+  0x80, 0x60, 0x30, 0x18, 0x18, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+  0x0C, 0x0C, 0x0C, 0x18, 0x18, 0x30, 0x60, 0x80, 0xB3, 0x00, 0x01, 0x87, 0x06, 0x80, 0xC0, 0x60,
+  0x60, 0x60, 0xC0, 0x80, 0x86, 0x00, 0x01, 0x9B, 0x00, 0x01, 0x87, 0x06, 0x80, 0xC0, 0x60, 0x60,
+  0x60, 0xC0, 0x80, 0x86, 0x00, 0x01, 0xBC, 0x06, 0x0D, 0x18, 0x30, 0x30, 0x30, 0x18, 0x0D, 0xAC,
+  0x06, 0x0D, 0x18, 0x30, 0x30, 0x30, 0x18, 0x0D, 0xBB, 0x17, 0x06, 0x18, 0x30, 0x60, 0x60, 0xC0,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x60, 0x60, 0x30,
+  0x18, 0x06, 0x9B, 0x17, 0x06, 0x18, 0x30, 0x60, 0x60, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x60, 0x60, 0x30, 0x18, 0x06, 0xD4, 0x0A, 0x80, 0xC0,
+  0xC0, 0x60, 0x60, 0x60, 0x60, 0x60, 0xC0, 0xC0, 0x80, 0xF1, 0x04, 0xF8, 0xFE, 0x07, 0x03, 0x01,
+  0x86, 0x04, 0x01, 0x03, 0x07, 0xFE, 0xF8, 0xEF, 0x0E, 0x03, 0x07, 0x0E, 0x1C, 0x18, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x18, 0x1C, 0x0E, 0x07, 0x03, 0xFF, 0x9A, 0x15, 0x40, 0x20, 0x10, 0x10, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x10, 0x20,
+  0x40, 0x9D, 0x15, 0x40, 0x20, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x10, 0x20, 0x40, 0xB4, 0x00, 0x01, 0x88, 0x04, 0x80, 0x40,
+  0x40, 0x40, 0x80, 0x87, 0x00, 0x01, 0x9B, 0x00, 0x01, 0x88, 0x04, 0x80, 0x40, 0x40, 0x40, 0x80,
+  0x87, 0x00, 0x01, 0xBC, 0x06, 0x09, 0x10, 0x20, 0x20, 0x20, 0x10, 0x09, 0xAC, 0x06, 0x09, 0x10,
+  0x20, 0x20, 0x20, 0x10, 0x09, 0xBB, 0x17, 0x04, 0x10, 0x20, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x20, 0x10, 0x04, 0x9B,
+  0x17, 0x04, 0x10, 0x20, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x20, 0x10, 0x04, 0xD5, 0x08, 0x80, 0x80, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x80, 0x80, 0xF3, 0x03, 0xF8, 0x06, 0x03, 0x01, 0x86, 0x03, 0x01, 0x03, 0x06, 0xF8,
+  0xF1, 0x0C, 0x03, 0x06, 0x0C, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x08, 0x0C, 0x06, 0x03, 0xFF,
+  0x9A, 0x15, 0x40, 0x20, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x10, 0x10, 0x20, 0x40, 0x9D, 0x15, 0x40, 0x20, 0x10, 0x10, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x10, 0x20, 0x40,
+  0xB4, 0x00, 0x01, 0x95, 0x00, 0x01, 0x9B, 0x00, 0x01, 0x95, 0x00, 0x01, 0xFF, 0x9A, 0x15, 0x80,
+  0x40, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x20, 0x20, 0x40, 0x80, 0x9D, 0x15, 0x80, 0x40, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x20, 0x20, 0x40, 0x80, 0xB4, 0x00, 0x02,
+  0x88, 0x04, 0x80, 0x40, 0x40, 0x40, 0x80, 0x87, 0x00, 0x02, 0x9B, 0x00, 0x02, 0x88, 0x04, 0x80,
+  0x40, 0x40, 0x40, 0x80, 0x87, 0x00, 0x02, 0xBC, 0x06, 0x09, 0x10, 0x20, 0x20, 0x20, 0x10, 0x09,
+  0xAC, 0x06, 0x09, 0x10, 0x20, 0x20, 0x20, 0x10, 0x09, 0xFF, 0xDD, 0x08, 0x80, 0x80, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x80, 0x80, 0xF3, 0x03, 0xF8, 0x06, 0x03, 0x01, 0x86, 0x03, 0x01, 0x03, 0x06,
+  0xF8, 0xF1, 0x0C, 0x03, 0x06, 0x0C, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x08, 0x0C, 0x06, 0x03,
+  0xFF, 0x9B, 0x13, 0x80, 0x40, 0x40, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x40, 0x40, 0x80, 0x9F, 0x13, 0x80, 0x40, 0x40, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x40, 0x80, 0xB5, 0x01, 0x04,
+  0x01, 0x93, 0x01, 0x01, 0x04, 0x9B, 0x01, 0x04, 0x01, 0x93, 0x01, 0x01, 0x04, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x99, 0x17, 0x02, 0x08, 0x10, 0x20, 0x20, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x20, 0x20, 0x10, 0x08, 0x02, 0x9B, 0x17, 0x02, 0x08, 0x10,
+  0x20, 0x20, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x20, 0x20, 0x10, 0x08, 0x02, 0xFF, 0x9C, 0x11, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0xA1, 0x11, 0x80, 0x80, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0xB6, 0x02,
+  0x08, 0x02, 0x01, 0x91, 0x02, 0x01, 0x02, 0x08, 0x9B, 0x02, 0x08, 0x02, 0x01, 0x91, 0x02, 0x01,
+  0x02, 0x08, 0xFF, 0x9E, 0x0D, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0xA5, 0x0D, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0xB8, 0x04, 0x10, 0x04, 0x02, 0x01, 0x01, 0x85, 0x02, 0x80, 0x80, 0x80, 0x84,
+  0x04, 0x01, 0x01, 0x02, 0x04, 0x10, 0x9B, 0x04, 0x10, 0x04, 0x02, 0x01, 0x01, 0x85, 0x02, 0x80,
+  0x80, 0x80, 0x84, 0x04, 0x01, 0x01, 0x02, 0x04, 0x10, 0xBC, 0x06, 0x12, 0x21, 0x40, 0x40, 0x40,
+  0x21, 0x12, 0xAC, 0x06, 0x12, 0x21, 0x40, 0x40, 0x40, 0x21, 0x12, 0xFF, 0xDF, 0x04, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0xF6, 0x03, 0xF8, 0x04, 0x02, 0x01, 0x84, 0x03, 0x01, 0x02, 0x04, 0xF8, 0xF3,
+  0x0A, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08, 0x08, 0x08, 0x04, 0x02, 0x01, 0xFF, 0xFF, 0x99, 0x17,
+  0x20, 0x08, 0x04, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x02, 0x02, 0x04, 0x08, 0x20, 0x9B, 0x17, 0x20, 0x08, 0x04, 0x02, 0x02, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x04,
+  0x08, 0x20, 0xFF, 0xFF, 0x99, 0x17, 0x40, 0x10, 0x08, 0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x04, 0x08, 0x10, 0x40, 0x9B, 0x17,
+  0x40, 0x10, 0x08, 0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x04, 0x04, 0x08, 0x10, 0x40, 0xBC, 0x06, 0x24, 0x42, 0x81, 0x81, 0x81, 0x42,
+  0x24, 0xAC, 0x06, 0x24, 0x42, 0x81, 0x81, 0x81, 0x42, 0x24, 0xFF, 0xFF, 0xDC, 0x0A, 0xF8, 0x8C,
+  0x02, 0x03, 0x01, 0x01, 0x01, 0x03, 0x02, 0x8C, 0xF8, 0xF5, 0x08, 0x01, 0x02, 0x06, 0x04, 0x04,
+  0x04, 0x06, 0x02, 0x01, 0xFF, 0xFF, 0x99, 0x17, 0x80, 0xE0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFC, 0xFC,
+  0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xF8, 0xF8, 0xF0, 0xE0, 0x80,
+  0x9B, 0x17, 0x80, 0xE0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC,
+  0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xF8, 0xF8, 0xF0, 0xE0, 0x80, 0xB3, 0x17, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x9B, 0x17, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x17,
+  0x01, 0x07, 0x0F, 0x1F, 0x1F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x1F, 0x1F, 0x0F, 0x07, 0x01, 0x9B, 0x17, 0x01, 0x07, 0x0F, 0x1F, 0x1F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x1F, 0x1F, 0x0F,
+  0x07, 0x01, 0xFF, 0xD5, 0x08, 0x38, 0xC6, 0x82, 0x01, 0x01, 0x01, 0x82, 0xC6, 0x38, 0xF9, 0x02,
+  0x01, 0x01, 0x01, 0xFF, 0xFF, 0x99, 0x17, 0x80, 0x20, 0x10, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x08, 0x10, 0x20, 0x80, 0x9B,
+  0x17, 0x80, 0x20, 0x10, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x08, 0x08, 0x10, 0x20, 0x80, 0xFF, 0xB3, 0x17, 0x01, 0x04, 0x08, 0x10,
+  0x10, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10,
+  0x10, 0x08, 0x04, 0x01, 0x9B, 0x17, 0x01, 0x04, 0x08, 0x10, 0x10, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10, 0x10, 0x08, 0x04, 0x01, 0xFF, 0xFF,
+  0x9A, 0x15, 0x40, 0x20, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x10, 0x10, 0x20, 0x40, 0x9D, 0x15, 0x40, 0x20, 0x10, 0x10, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x10, 0x20, 0x40,
+  0xB4, 0x00, 0x81, 0x95, 0x00, 0x81, 0x9B, 0x00, 0x81, 0x95, 0x00, 0x81, 0xB4, 0x15, 0x02, 0x04,
+  0x08, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x08, 0x08, 0x04, 0x02, 0x9D, 0x15, 0x02, 0x04, 0x08, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x08, 0x08, 0x04, 0x02, 0xFF, 0xFF, 0x9A, 0x15,
+  0x80, 0xC0, 0xE0, 0x60, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+  0x70, 0x70, 0x60, 0xE0, 0xC0, 0x80, 0x9D, 0x15, 0x80, 0xC0, 0xE0, 0x60, 0x70, 0x70, 0x70, 0x70,
+  0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x60, 0xE0, 0xC0, 0x80, 0xB4, 0x02,
+  0x06, 0x03, 0x01, 0x91, 0x02, 0x01, 0x03, 0x06, 0x9B, 0x02, 0x06, 0x03, 0x01, 0x91, 0x02, 0x01,
+  0x03, 0x06, 0xB4, 0x15, 0x01, 0x02, 0x04, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x04, 0x02, 0x01, 0x9D, 0x15, 0x01, 0x02, 0x04, 0x00,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x04,
+  0x02, 0x01, 0xFF, 0xFF, 0x9D, 0x0F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xA3, 0x0F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xB7, 0x17, 0x08, 0x00, 0x02, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02,
+  0x00, 0x08, 0x9B, 0x17, 0x08, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00, 0x08, 0xB4, 0x00, 0x01, 0x81,
+  0x0F, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x81, 0x00, 0x01, 0x9D, 0x00, 0x01, 0x81, 0x0F, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x81, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x99,
+  0x17, 0x40, 0x84, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x84, 0x40, 0x9B, 0x17, 0x40, 0x84, 0x00, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x00, 0x84, 0x40, 0xB4, 0x15, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0x9D, 0x15, 0x01, 0x01, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0x99, 0x17, 0x40, 0x80, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x80, 0x40,
+  0x9B, 0x17, 0x40, 0x80, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x80, 0x40, 0xFF, 0xFF, 0xFF, 0x99, 0x17, 0x10,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x9B, 0x17, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x10, 0xFF, 0xFF, 0x9B, 0x04, 0x30, 0x60, 0xC0, 0xC0, 0x80, 0x8A, 0x04, 0x80, 0xC0, 0xC0, 0x60,
+  0x30, 0x9E, 0x04, 0x30, 0x60, 0xC0, 0xC0, 0x80, 0x8A, 0x04, 0x80, 0xC0, 0xC0, 0x60, 0x30, 0xB4,
+  0x17, 0x60, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF1, 0xF3, 0x76, 0x3C, 0x3C, 0x88, 0xC0, 0x88, 0x3C,
+  0x3C, 0x76, 0xF3, 0xF1, 0xF0, 0xF0, 0xF0, 0xF0, 0x60, 0x9B, 0x17, 0x60, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF1, 0xF3, 0x76, 0x3C, 0x3C, 0x88, 0xC0, 0x88, 0x3C, 0x3C, 0x76, 0xF3, 0xF1, 0xF0, 0xF0,
+  0xF0, 0xF0, 0x60, 0xB5, 0x06, 0x30, 0x18, 0x0C, 0x0C, 0x06, 0x03, 0x01, 0x86, 0x06, 0x01, 0x03,
+  0x06, 0x0C, 0x0C, 0x18, 0x30, 0x9E, 0x06, 0x30, 0x18, 0x0C, 0x0C, 0x06, 0x03, 0x01, 0x86, 0x06,
+  0x01, 0x03, 0x06, 0x0C, 0x0C, 0x18, 0x30, 0xFF, 0xD6, 0x08, 0x38, 0xC6, 0x82, 0x01, 0x01, 0x01,
+  0x82, 0xC6, 0x38, 0xF9, 0x02, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0x9B, 0x01, 0xC0, 0x80, 0x90, 0x01,
+  0x80, 0xC0, 0x9E, 0x01, 0xC0, 0x80, 0x90, 0x01, 0x80, 0xC0, 0xB7, 0x12, 0x01, 0x03, 0x03, 0x06,
+  0x0C, 0x18, 0x30, 0x30, 0x80, 0xC0, 0x80, 0x30, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x03, 0x01, 0xA0,
+  0x12, 0x01, 0x03, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x30, 0x80, 0xC0, 0x80, 0x30, 0x30, 0x18, 0x0C,
+  0x06, 0x03, 0x03, 0x01, 0xB7, 0x14, 0xC0, 0x60, 0x30, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x03, 0x01,
+  0x00, 0x01, 0x03, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x30, 0x60, 0xC0, 0x9E, 0x14, 0xC0, 0x60, 0x30,
+  0x30, 0x18, 0x0C, 0x06, 0x03, 0x03, 0x01, 0x00, 0x01, 0x03, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x30,
+  0x60, 0xC0, 0xFF, 0xD4, 0x0B, 0x60, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0x60, 0xF6, 0x05, 0x01, 0x03, 0x03, 0x03, 0x03, 0x01, 0xFF, 0xFF, 0xFF, 0x9B, 0x06, 0x01, 0x02,
+  0x04, 0x04, 0x08, 0x10, 0x20, 0x86, 0x06, 0x20, 0x10, 0x08, 0x04, 0x04, 0x02, 0x01, 0x9E, 0x06,
+  0x01, 0x02, 0x04, 0x04, 0x08, 0x10, 0x20, 0x86, 0x06, 0x20, 0x10, 0x08, 0x04, 0x04, 0x02, 0x01,
+  0xB7, 0x12, 0x80, 0x40, 0x40, 0x20, 0x10, 0x08, 0x04, 0x04, 0x02, 0x01, 0x02, 0x04, 0x04, 0x08,
+  0x10, 0x20, 0x40, 0x40, 0x80, 0xA0, 0x12, 0x80, 0x40, 0x40, 0x20, 0x10, 0x08, 0x04, 0x04, 0x02,
+  0x01, 0x02, 0x04, 0x04, 0x08, 0x10, 0x20, 0x40, 0x40, 0x80, 0xB7, 0x00, 0x01, 0x92, 0x00, 0x01,
+  0x9E, 0x00, 0x01, 0x92, 0x00, 0x01, 0xFF, 0x8E, 0x02, 0x80, 0x80, 0x80, 0xFA, 0x06, 0x0E, 0x11,
+  0x20, 0x20, 0x20, 0x11, 0x0E, 0xD8, 0x06, 0xE0, 0x10, 0x08, 0x08, 0x08, 0x10, 0xE0, 0xF9, 0x04,
+  0x01, 0x02, 0x02, 0x02, 0x01, 0xFF, 0xFF, 0xC6, 0x01, 0xA0, 0x10, 0x87, 0x01, 0x10, 0xA0, 0xF4,
+  0x09, 0x01, 0x03, 0x02, 0x0C, 0x1C, 0x3C, 0x3C, 0x1E, 0x0F, 0x01, 0xFF, 0x8E, 0x04, 0x80, 0x80,
+  0x00, 0x80, 0x80, 0xF8, 0x08, 0x0E, 0x11, 0x2E, 0x31, 0x00, 0x31, 0x2E, 0x11, 0x0E, 0xD4, 0x08,
+  0xE0, 0x10, 0xE8, 0x18, 0x00, 0x18, 0xE8, 0x10, 0xE0, 0xF7, 0x06, 0x01, 0x02, 0x03, 0x00, 0x03,
+  0x02, 0x01, 0xFF, 0x8E, 0x04, 0x80, 0x80, 0x00, 0x80, 0x80, 0xF8, 0x08, 0x0E, 0x11, 0x2E, 0x31,
+  0x00, 0x31, 0x2E, 0x11, 0x0E, 0xD4, 0x08, 0xE0, 0x10, 0xE8, 0x18, 0x00, 0x18, 0xE8, 0x10, 0xE0,
+  0xF7, 0x06, 0x01, 0x02, 0x03, 0x00, 0x03, 0x02, 0x01, 0xFF, 0x8E, 0x04, 0x80, 0x80, 0x00, 0x80,
+  0x80, 0xF8, 0x08, 0x0E, 0x11, 0x2E, 0x31, 0x00, 0x31, 0x2E, 0x11, 0x0E, 0xD4, 0x08, 0xE0, 0x10,
+  0xE8, 0x18, 0x00, 0x18, 0xE8, 0x10, 0xE0, 0xF7, 0x06, 0x01, 0x02, 0x03, 0x00, 0x03, 0x02, 0x01,
+  0xFF, 0x8E, 0x04, 0x80, 0x80, 0x00, 0x80, 0x80, 0xF8, 0x08, 0x0E, 0x11, 0x2E, 0x31, 0x00, 0x31,
+  0x2E, 0x11, 0x0E, 0xD4, 0x08, 0xE0, 0x10, 0xE8, 0x18, 0x00, 0x18, 0xE8, 0x10, 0xE0, 0xF7, 0x06,
+  0x01, 0x02, 0x03, 0x00, 0x03, 0x02, 0x01, 0xFF, 0x8E, 0x04, 0x80, 0x80, 0x00, 0x80, 0x80, 0xF8,
+  0x08, 0x0E, 0x11, 0x2E, 0x31, 0x00, 0x31, 0x2E, 0x11, 0x0E, 0xD4, 0x08, 0xE0, 0x10, 0xE8, 0x18,
+  0x00, 0x18, 0xE8, 0x10, 0xE0, 0xF7, 0x06, 0x01, 0x02, 0x03, 0x00, 0x03, 0x02, 0x01, 0xFF, 0x90,
+  0x02, 0x80, 0x80, 0x80, 0xFA, 0x06, 0x0E, 0x11, 0x20, 0x20, 0x20, 0x11, 0x0E, 0xD4, 0x06, 0xE0,
+  0x10, 0x08, 0x08, 0x08, 0x10, 0xE0, 0xF9, 0x04, 0x01, 0x02, 0x02, 0x02, 0x01, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xB9, 0x02, 0xC0, 0x20, 0x10, 0x86, 0x02, 0x10, 0x20, 0xC0, 0xF3, 0x0A, 0x01,
+  0x02, 0x00, 0x0C, 0x10, 0x20, 0x00, 0x20, 0x10, 0x0E, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xB9, 0x02, 0xC0, 0x20, 0x10, 0x86, 0x02, 0x10, 0x20, 0xC0, 0xF3, 0x0A, 0x01, 0x02, 0x00, 0x0C,
+  0x10, 0x20, 0x00, 0x20, 0x10, 0x0E, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0x02, 0xC0,
+  0x20, 0x10, 0x86, 0x02, 0x10, 0x20, 0xC0, 0xF3, 0x0A, 0x01, 0x02, 0x00, 0x0C, 0x10, 0x20, 0x00,
+  0x20, 0x10, 0x0E, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0x02, 0xC0, 0x20, 0x10, 0x86,
+  0x02, 0x10, 0x20, 0xC0, 0xF3, 0x0A, 0x01, 0x02, 0x00, 0x0C, 0x10, 0x20, 0x00, 0x20, 0x10, 0x0E,
+  0x01, 0xFF, 0xFF, 0x99, 0x17, 0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE,
+  0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0xF0, 0xC0, 0x9C, 0x15, 0xC0,
+  0xE0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+  0xF8, 0xF0, 0xF0, 0xE0, 0xC0, 0xB4, 0x17, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9B,
+  0x17, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x17, 0x03, 0x0F, 0x1F, 0x3F, 0x3F,
+  0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x3F,
+  0x1F, 0x0F, 0x03, 0x9B, 0x17, 0x0F, 0x3F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x3F, 0x0F, 0xEC, 0x0D, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xD7, 0x0D, 0xC0,
+  0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0xF2, 0x0B, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0x99, 0x17, 0x40,
+  0x10, 0x08, 0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x04, 0x04, 0x08, 0x10, 0x40, 0x9C, 0x15, 0x40, 0x20, 0x10, 0x10, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x10, 0x20, 0x40, 0xE8,
+  0x00, 0x01, 0x95, 0x00, 0x01, 0xFF, 0xFF, 0x99, 0x17, 0x80, 0x20, 0x10, 0x08, 0x08, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x08, 0x10, 0x20,
+  0x80, 0x9C, 0x15, 0x80, 0x40, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x20, 0x20, 0x40, 0x80, 0xE8, 0x00, 0x02, 0x95, 0x00, 0x02, 0xB3,
+  0x17, 0x02, 0x08, 0x10, 0x20, 0x20, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x20, 0x20, 0x10, 0x08, 0x02, 0x9B, 0x04, 0x08, 0x20, 0x40, 0x80, 0x80,
+  0x8D, 0x04, 0x80, 0x80, 0x40, 0x20, 0x08, 0xEC, 0x0D, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x99, 0x17, 0x01, 0x04, 0x08,
+  0x10, 0x10, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x10, 0x10, 0x08, 0x04, 0x01, 0x9B, 0x17, 0x04, 0x10, 0x20, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x20, 0x10, 0x04, 0xFF,
+  0xFF, 0x9A, 0x15, 0xC0, 0x60, 0x30, 0x30, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+  0x18, 0x18, 0x18, 0x18, 0x18, 0x30, 0x30, 0x60, 0xC0, 0x9E, 0x13, 0x80, 0xC0, 0xC0, 0x60, 0x60,
+  0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xC0, 0xC0, 0x80, 0xB5,
+  0x00, 0x83, 0x95, 0x00, 0x83, 0x9B, 0x02, 0x0C, 0x03, 0x01, 0x91, 0x02, 0x01, 0x03, 0x0C, 0xB4,
+  0x15, 0x02, 0x04, 0x08, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x08, 0x08, 0x04, 0x02, 0x9C, 0x17, 0x02, 0x08, 0x10, 0x20, 0x20, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x20, 0x20, 0x10, 0x08,
+  0x02, 0xFF, 0xFF, 0x9B, 0x13, 0x80, 0x40, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x40, 0x80, 0xA2, 0x0D, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xB9, 0x00, 0x01, 0x93, 0x00, 0x01, 0x9D,
+  0x02, 0x04, 0x02, 0x01, 0x8F, 0x02, 0x01, 0x02, 0x04, 0xB5, 0x15, 0x01, 0x02, 0x04, 0x00, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x04, 0x02,
+  0x01, 0x9D, 0x15, 0x04, 0x08, 0x10, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x10, 0x08, 0x04, 0xFF, 0xFF, 0xFF, 0x99, 0x01, 0x40, 0x80,
+  0x93, 0x01, 0x80, 0x40, 0xE9, 0x13, 0x01, 0x02, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x02, 0x01, 0x9D, 0x17, 0x01, 0x02, 0x04, 0x08,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x08, 0x04, 0x02, 0x01, 0xFF, 0xFF, 0x9D, 0x0F, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xFF, 0xA3, 0x0F, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xBB, 0x0F, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xA3, 0x0F, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xFF,
+  0xFF, 0x9C, 0x11, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0xEA, 0x02, 0x04, 0x80, 0x01, 0x91, 0x02, 0x01, 0x80, 0x04, 0x9B,
+  0x17, 0x10, 0x00, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x00, 0x10, 0xE8, 0x00, 0x02, 0x93, 0x00, 0x02, 0xFF,
+  0xFF, 0xFF, 0x99, 0x02, 0x20, 0x80, 0x80, 0x91, 0x02, 0x80, 0x80, 0x20, 0x9B, 0x00, 0x80, 0x95,
+  0x00, 0x80, 0xB6, 0x11, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x9F, 0x15, 0x02, 0x02, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x02, 0x02, 0xFF, 0xFF,
+  0xFF, 0x99, 0x17, 0x18, 0x66, 0x66, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7,
+  0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0x66, 0x66, 0x18, 0x9B, 0x17, 0x60, 0x98, 0x98,
+  0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C,
+  0x9C, 0x9C, 0x98, 0x98, 0x60, 0xE8, 0x15, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0xFF, 0xFF, 0xFF,
+  0x99, 0x17, 0x18, 0x66, 0x66, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7,
+  0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0x66, 0x66, 0x18, 0x9B, 0x17, 0x60, 0x98, 0x98, 0x9C,
+  0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C,
+  0x9C, 0x98, 0x98, 0x60, 0xE8, 0x15, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xB8, 0x0D, 0xC0, 0xE0, 0xE0, 0x00, 0xF8, 0xE8, 0xE4, 0xE4, 0xE4, 0xE8, 0xF8, 0x00,
+  0xE0, 0xC0, 0xF2, 0x0B, 0x01, 0x01, 0x01, 0x02, 0x03, 0x05, 0x05, 0x05, 0x03, 0x02, 0x01, 0x01,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0x0D, 0xC0, 0xE0, 0xE0, 0x00, 0xF8, 0xE8, 0xE4, 0xE4,
+  0xE4, 0xE8, 0xF8, 0x00, 0xE0, 0xC0, 0xF2, 0x0B, 0x01, 0x01, 0x01, 0x02, 0x03, 0x05, 0x05, 0x05,
+  0x03, 0x02, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0x99, 0x02, 0x20, 0x80, 0x80, 0x91, 0x02, 0x80, 0x80,
+  0x20, 0x9B, 0x00, 0x80, 0x95, 0x00, 0x80, 0xB6, 0x11, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x9F, 0x15, 0x02, 0x02, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x02, 0x02, 0xFF, 0xFF, 0x9C, 0x11, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xEA, 0x02, 0x04, 0x80, 0x01, 0x91, 0x02,
+  0x01, 0x80, 0x04, 0x9B, 0x17, 0x10, 0x00, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x00, 0x10, 0xE8, 0x00, 0x02,
+  0x93, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x99, 0x01, 0x40, 0x80, 0x93, 0x01, 0x80, 0x40, 0xE9, 0x13,
+  0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x01, 0x9D, 0x17, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x04, 0x02, 0x01, 0xFF, 0xFF,
+  0x9D, 0x0F, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0xFF, 0xA3, 0x0F, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0xBB, 0x0F, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0xA3, 0x0F, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0xFF, 0xFF, 0x9B, 0x13, 0x80, 0x40, 0x00,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x40,
+  0x80, 0xA2, 0x0D, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0xB9, 0x00, 0x01, 0x93, 0x00, 0x01, 0x9D, 0x02, 0x04, 0x02, 0x01, 0x8F, 0x02, 0x01, 0x02,
+  0x04, 0xB5, 0x15, 0x01, 0x02, 0x04, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x04, 0x02, 0x01, 0x9D, 0x15, 0x04, 0x08, 0x10, 0x00, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x10, 0x08,
+  0x04, 0xFF, 0xFF, 0x9A, 0x15, 0x80, 0x40, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x20, 0x20, 0x40, 0x80, 0x9F, 0x11, 0x80, 0x80, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0xB6,
+  0x00, 0x02, 0x95, 0x00, 0x02, 0x9B, 0x02, 0x08, 0x02, 0x01, 0x91, 0x02, 0x01, 0x02, 0x08, 0xFF,
+  0xFF, 0x9A, 0x15, 0x40, 0x20, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x10, 0x20, 0x40, 0x9E, 0x13, 0x80, 0x40, 0x40, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x40, 0x80, 0xB5,
+  0x00, 0x81, 0x95, 0x00, 0x81, 0x9B, 0x01, 0x04, 0x01, 0x93, 0x01, 0x01, 0x04, 0xB4, 0x15, 0x02,
+  0x04, 0x08, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x08, 0x08, 0x04, 0x02, 0x9C, 0x17, 0x02, 0x08, 0x10, 0x20, 0x20, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x20, 0x20, 0x10, 0x08, 0x02, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x99, 0x17, 0x01, 0x04, 0x08, 0x10, 0x10, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10, 0x10, 0x08, 0x04, 0x01, 0x9B, 0x17, 0x04,
+  0x10, 0x20, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x40, 0x40, 0x20, 0x10, 0x04, 0xFF, 0xFF, 0x99, 0x17, 0x80, 0x20, 0x10, 0x08, 0x08,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x08,
+  0x10, 0x20, 0x80, 0x9C, 0x15, 0x80, 0x40, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x20, 0x20, 0x40, 0x80, 0xE8, 0x00, 0x02, 0x95, 0x00,
+  0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x99, 0x17, 0x02, 0x08, 0x10, 0x20, 0x20, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x20, 0x20, 0x10, 0x08, 0x02, 0x9B,
+  0x04, 0x08, 0x20, 0x40, 0x80, 0x80, 0x8D, 0x04, 0x80, 0x80, 0x40, 0x20, 0x08, 0xEC, 0x0D, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0x99,
+  0x17, 0x40, 0x10, 0x08, 0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x04, 0x04, 0x08, 0x10, 0x40, 0x9C, 0x15, 0x40, 0x20, 0x10, 0x10, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x10, 0x20,
+  0x40, 0xE8, 0x00, 0x01, 0x95, 0x00, 0x01, 0xFF, 0xFF, 0x99, 0x17, 0xC0, 0xF0, 0xF8, 0xFC, 0xFC,
+  0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFC, 0xFC,
+  0xF8, 0xF0, 0xC0, 0x9B, 0x17, 0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE,
+  0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0xF0, 0xC0, 0xB3, 0x17, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9B, 0x17, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xB3, 0x17, 0x03, 0x0F, 0x1F, 0x3F, 0x3F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
+  0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x3F, 0x1F, 0x0F, 0x03, 0x9B, 0x17, 0x03, 0x0F, 0x1F,
+  0x3F, 0x3F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
+  0x3F, 0x3F, 0x1F, 0x0F, 0x03, 0xFF, 0xFF, 0x99, 0x17, 0x40, 0x10, 0x08, 0x04, 0x04, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x04, 0x08, 0x10,
+  0x40, 0x9B, 0x17, 0x40, 0x10, 0x08, 0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x04, 0x08, 0x10, 0x40, 0xFF, 0xB3, 0x17, 0x02, 0x08,
+  0x10, 0x20, 0x20, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x20, 0x20, 0x10, 0x08, 0x02, 0xFF, 0xFF, 0x99, 0x17, 0x80, 0x60, 0x30, 0x18, 0x18, 0x0C,
+  0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x18, 0x18, 0x30,
+  0x60, 0x80, 0x9B, 0x17, 0x80, 0x20, 0x10, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x08, 0x10, 0x20, 0x80, 0xB3, 0x00, 0x81, 0x95,
+  0x00, 0x81, 0xE7, 0x17, 0x01, 0x06, 0x0C, 0x18, 0x18, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x18, 0x18, 0x0C, 0x06, 0x01, 0x9B, 0x17, 0x03, 0x0C,
+  0x18, 0x30, 0x30, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+  0x60, 0x30, 0x30, 0x18, 0x0C, 0x03, 0xFF, 0xFF, 0x9A, 0x15, 0x80, 0xC0, 0x60, 0x60, 0x70, 0x70,
+  0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x60, 0x60, 0xC0, 0x80,
+  0x9D, 0x15, 0xC0, 0x60, 0x30, 0x30, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+  0x18, 0x18, 0x18, 0x18, 0x30, 0x30, 0x60, 0xC0, 0xB4, 0x01, 0x02, 0x01, 0x93, 0x01, 0x01, 0x02,
+  0x9B, 0x00, 0x83, 0x95, 0x00, 0x83, 0xB4, 0x15, 0x01, 0x02, 0x04, 0x04, 0x0C, 0x0C, 0x0C, 0x0C,
+  0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x04, 0x04, 0x02, 0x01, 0x9D, 0x15,
+  0x02, 0x04, 0x08, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x08, 0x08, 0x04, 0x02, 0xA9, 0x02, 0x04, 0x0E, 0x04, 0xD8, 0x02, 0x04, 0x0E, 0x04,
+  0xFF, 0xFF, 0x9C, 0x11, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xA0, 0x13, 0x80, 0x40, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x40, 0x80, 0xB5, 0x17, 0x44, 0x82,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x82, 0x44, 0x9B, 0x01, 0x40, 0x81, 0x93, 0x01, 0x81, 0x40, 0xB5, 0x13,
+  0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x01, 0x9E, 0x15, 0x01, 0x03, 0x06, 0x04, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+  0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x04, 0x06, 0x03, 0x01, 0xFF, 0xFF, 0xD1, 0x0F,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0xB9, 0x13, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
+  0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x9D, 0x01, 0x40, 0x80, 0x93, 0x01, 0x80, 0x40, 0xE9, 0x01,
+  0x01, 0x02, 0x8F, 0x01, 0x02, 0x01, 0xA9, 0x04, 0x0E, 0x1B, 0x11, 0x1B, 0x0E, 0xD6, 0x04, 0x0E,
+  0x1B, 0x11, 0x1B, 0x0E, 0xFF, 0xFF, 0xFF, 0x99, 0x17, 0x20, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x20, 0x9B, 0x01, 0x40, 0x80, 0x93, 0x01, 0x80, 0x40, 0xA8, 0x02, 0x80, 0x80, 0x80, 0xBD, 0x13,
+  0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x01, 0x86, 0x02, 0x80, 0x80, 0x80, 0x9E, 0x06, 0x0E, 0x11, 0x20, 0x20, 0x20,
+  0x11, 0x0E, 0xD4, 0x06, 0x0E, 0x11, 0x20, 0x20, 0x20, 0x11, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C,
+  0x06, 0x80, 0x80, 0x40, 0x40, 0x40, 0x80, 0x80, 0xD4, 0x06, 0x80, 0x80, 0x40, 0x40, 0x40, 0x80,
+  0x80, 0x9B, 0x08, 0x0E, 0x31, 0x20, 0x40, 0x40, 0x40, 0x20, 0x31, 0x0E, 0xD2, 0x08, 0x0E, 0x31,
+  0x20, 0x40, 0x40, 0x40, 0x20, 0x31, 0x0E, 0xCA, 0x07, 0x40, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x8B, 0x08, 0x80, 0x40, 0x60, 0x20, 0x20, 0x20, 0x60, 0x40, 0x80,
+  0xD2, 0x08, 0x80, 0x40, 0x60, 0x20, 0x20, 0x20, 0x60, 0x40, 0x80, 0x99, 0x0A, 0x1F, 0x31, 0x40,
+  0xC0, 0x80, 0x80, 0x80, 0xC0, 0x40, 0x31, 0x1F, 0xD0, 0x0A, 0x1F, 0x31, 0x40, 0xC0, 0x80, 0x80,
+  0x80, 0xC0, 0x40, 0x31, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x8B, 0x08, 0x80, 0x40, 0x60, 0x20, 0x20,
+  0x20, 0x60, 0x40, 0x80, 0xD2, 0x08, 0x80, 0x40, 0x60, 0x20, 0x20, 0x20, 0x60, 0x40, 0x80, 0x99,
+  0x0A, 0x1F, 0x31, 0x40, 0xC0, 0x80, 0x80, 0x80, 0xC0, 0x40, 0x31, 0x1F, 0xD0, 0x0A, 0x1F, 0x31,
+  0x40, 0xC0, 0x80, 0x80, 0x80, 0xC0, 0x40, 0x31, 0x1F, 0xFF, 0xFF, 0xFF, 0xCD, 0x01, 0x40, 0x80,
+  0x93, 0x01, 0x80, 0x40, 0xE9, 0x13, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x8B, 0x08,
+  0x80, 0x40, 0x60, 0x20, 0x20, 0x20, 0x60, 0x40, 0x80, 0xD2, 0x08, 0x80, 0x40, 0x60, 0x20, 0x20,
+  0x20, 0x60, 0x40, 0x80, 0x99, 0x0A, 0x1F, 0x31, 0x40, 0xC0, 0x80, 0x80, 0x80, 0xC0, 0x40, 0x31,
+  0x1F, 0xD0, 0x0A, 0x1F, 0x31, 0x40, 0xC0, 0x80, 0x80, 0x80, 0xC0, 0x40, 0x31, 0x1F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x8B, 0x08, 0x80, 0x40, 0x60, 0x20, 0x20, 0x20, 0x60, 0x40, 0x80, 0xD2, 0x08, 0x80,
+  0x40, 0x60, 0x20, 0x20, 0x20, 0x60, 0x40, 0x80, 0x99, 0x0A, 0x1F, 0x31, 0x40, 0xC0, 0x80, 0x80,
+  0x80, 0xC0, 0x40, 0x31, 0x1F, 0xD0, 0x0A, 0x1F, 0x31, 0x40, 0xC0, 0x80, 0x80, 0x80, 0xC0, 0x40,
+  0x31, 0x1F, 0xFF, 0xFF, 0xD1, 0x0F, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xB7, 0x17, 0x08, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08,
+  0x9B, 0x01, 0x40, 0x80, 0x93, 0x01, 0x80, 0x40, 0xA5, 0x08, 0x80, 0x40, 0x60, 0x20, 0x20, 0x20,
+  0x60, 0x40, 0x80, 0xBA, 0x01, 0x01, 0x02, 0x8F, 0x01, 0x02, 0x01, 0x83, 0x08, 0x80, 0x40, 0x60,
+  0x20, 0x20, 0x20, 0x60, 0x40, 0x80, 0x99, 0x0A, 0x1F, 0x31, 0x40, 0xC0, 0x80, 0x80, 0x80, 0xC0,
+  0x40, 0x31, 0x1F, 0xD0, 0x0A, 0x1F, 0x31, 0x40, 0xC0, 0x80, 0x80, 0x80, 0xC0, 0x40, 0x31, 0x1F,
+  0xFF, 0xFF, 0xFF, 0x99, 0x17, 0x08, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0xFF, 0xFF, 0xFF,
+  0x99, 0x17, 0x20, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x20, 0x9B, 0x01, 0x40, 0x80, 0x93, 0x01,
+  0x80, 0x40, 0xE9, 0x13, 0x01, 0x02, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x02, 0x01, 0xFF, 0xDE, 0x01, 0xA0, 0x40, 0xFF, 0xFF, 0xCF,
+  0x13, 0x80, 0x40, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x00, 0x40, 0x80, 0xB5, 0x17, 0x20, 0x40, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x40, 0x20, 0x9B,
+  0x01, 0x40, 0x01, 0x93, 0x01, 0x01, 0x40, 0xEB, 0x00, 0x04, 0x8D, 0x00, 0x04, 0xFF, 0xE1, 0x01,
+  0xA0, 0x40, 0xFF, 0xFF, 0xFF, 0x9A, 0x15, 0x42, 0x00, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x00, 0x42, 0x9C, 0x00, 0x40,
+  0x95, 0x00, 0x40, 0xE8, 0x15, 0x01, 0x02, 0x04, 0x04, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x04, 0x04, 0x02, 0x01, 0xFF, 0xDF, 0x01, 0xA0, 0x40,
+  0xFF, 0xFF, 0xCE, 0x15, 0x80, 0x40, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x20, 0x20, 0x40, 0x80, 0xB4, 0x02, 0x20, 0x80, 0x80, 0x91,
+  0x02, 0x80, 0x80, 0x20, 0x9B, 0x00, 0x02, 0x95, 0x00, 0x02, 0xB6, 0x11, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xFF, 0xFF,
+  0x96, 0x01, 0xA0, 0x40, 0xFF, 0xFF, 0x9C, 0x11, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xEA, 0x02, 0x04, 0x80, 0x01, 0x91,
+  0x02, 0x01, 0x80, 0x04, 0x9B, 0x00, 0x80, 0x95, 0x00, 0x80, 0xE8, 0x15, 0x02, 0x04, 0x08, 0x08,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x08, 0x08,
+  0x04, 0x02, 0xFF, 0xE1, 0x01, 0xA0, 0x40, 0xFF, 0xFF, 0xFF, 0x99, 0x01, 0x40, 0x80, 0x93, 0x01,
+  0x80, 0x40, 0xE9, 0x13, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0xFF, 0xFF, 0x9D, 0x0F, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xA0, 0x15, 0x40, 0x20,
+  0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x10, 0x10, 0x20, 0x40, 0xB4, 0x01, 0x40, 0x80, 0x93, 0x01, 0x80, 0x40, 0x9B, 0x00, 0x01, 0x95,
+  0x00, 0x01, 0xB5, 0x01, 0x01, 0x02, 0x8F, 0x01, 0x02, 0x01, 0xFF, 0xFF, 0x8B, 0x00, 0x80, 0x8A,
+  0x01, 0xA0, 0xC0, 0xF2, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0xFF, 0xFF, 0xFF, 0x99, 0x01, 0x40, 0x80, 0x93, 0x01, 0x80, 0x40, 0xE9, 0x13, 0x01, 0x02,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x02, 0x01, 0xFF, 0xFF, 0x9B, 0x13, 0x80, 0x40, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x40, 0x80, 0xE9, 0x01, 0x40, 0x01, 0x93, 0x01,
+  0x01, 0x40, 0xEB, 0x00, 0x04, 0x8D, 0x00, 0x04, 0x9F, 0x17, 0x01, 0x04, 0x08, 0x10, 0x10, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10, 0x10, 0x08,
+  0x04, 0x01, 0xFF, 0xE2, 0x01, 0x20, 0xC0, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0x9A, 0x15, 0x80, 0x40,
+  0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x20, 0x20, 0x40, 0x80, 0x9C, 0x17, 0x80, 0x20, 0x10, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x08, 0x10, 0x20, 0x80, 0xB3, 0x00,
+  0x42, 0x95, 0x00, 0x42, 0xD9, 0x08, 0x80, 0x40, 0x60, 0x20, 0x20, 0x20, 0x60, 0x40, 0x80, 0x85,
+  0x15, 0x01, 0x02, 0x04, 0x04, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x04, 0x04, 0x02, 0x01, 0xB6, 0x08, 0x80, 0x40, 0x60, 0x20, 0x20, 0x20, 0x60,
+  0x40, 0x80, 0x99, 0x0A, 0x1F, 0x31, 0x40, 0xC0, 0x80, 0x80, 0x80, 0xC0, 0x40, 0x31, 0x1F, 0xD0,
+  0x0A, 0x1F, 0x31, 0x40, 0xC0, 0x80, 0x80, 0x80, 0xC0, 0x40, 0x31, 0x1F, 0xD7, 0x01, 0x20, 0xC0,
+  0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x99, 0x00, 0x80, 0x95, 0x00, 0x80, 0xE8, 0x15, 0x02, 0x04,
+  0x08, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x08, 0x08, 0x04, 0x02, 0xFF, 0xFF, 0x9A, 0x15, 0x40, 0x20, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x10, 0x20, 0x40, 0xE8, 0x00,
+  0x01, 0x95, 0x00, 0x01, 0xFF, 0x9B, 0x17, 0x02, 0x08, 0x10, 0x20, 0x20, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x20, 0x20, 0x10, 0x08, 0x02, 0xFF,
+  0xE4, 0x01, 0x20, 0xC0, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x99, 0x17, 0x01, 0x04, 0x08,
+  0x10, 0x10, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x10, 0x10, 0x08, 0x04, 0x01, 0xFF, 0xFF, 0x99, 0x17, 0x80, 0x20, 0x10, 0x08, 0x08, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x08, 0x10, 0x20,
+  0x80, 0x9B, 0x17, 0x40, 0x10, 0x08, 0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x04, 0x08, 0x10, 0x40, 0xFF, 0xA6, 0x06, 0x80, 0x80,
+  0x40, 0x40, 0x40, 0x80, 0x80, 0xD4, 0x06, 0x80, 0x80, 0x40, 0x40, 0x40, 0x80, 0x80, 0x9B, 0x08,
+  0x0E, 0x31, 0x20, 0x40, 0x40, 0x40, 0x20, 0x31, 0x0E, 0xD2, 0x08, 0x0E, 0x31, 0x20, 0x40, 0x40,
+  0x40, 0x20, 0x31, 0x0E, 0xDA, 0x01, 0x20, 0xC0, 0xED, 0x11, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC8, 0x04, 0x20, 0xE0, 0xE0, 0xE0, 0xC0, 0xFA, 0x04, 0x02, 0x03, 0x03, 0x03, 0x01,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x8E, 0x02, 0x80, 0x80, 0x80, 0x87, 0x17, 0x02, 0x08, 0x10, 0x20, 0x20,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x20, 0x20,
+  0x10, 0x08, 0x02, 0xB8, 0x02, 0x80, 0x80, 0x80, 0x9E, 0x06, 0x0E, 0x11, 0x20, 0x20, 0x20, 0x11,
+  0x0E, 0xD4, 0x06, 0x0E, 0x11, 0x20, 0x20, 0x20, 0x11, 0x0E, 0xFF, 0xFF, 0x99, 0x17, 0x40, 0x10,
+  0x08, 0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x04, 0x04, 0x08, 0x10, 0x40, 0xFF, 0xFF, 0xDB, 0x04, 0x0E, 0x1B, 0x11, 0x1B, 0x0E, 0xD6,
+  0x04, 0x0E, 0x1B, 0x11, 0x1B, 0x0E, 0xFF, 0xFF, 0x99, 0x17, 0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFE,
+  0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFC, 0xFC, 0xF8,
+  0xF0, 0xC0, 0x9B, 0x17, 0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE,
+  0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0xF0, 0xC0, 0xB3, 0x17, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9B, 0x17, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xB3, 0x17, 0x03, 0x0F, 0x1F, 0x3F, 0x3F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
+  0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x3F, 0x1F, 0x0F, 0x03, 0x9B, 0x17, 0x03, 0x0F, 0x1F, 0x3F,
+  0x3F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x3F,
+  0x3F, 0x1F, 0x0F, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x99, 0x17, 0x04, 0x10, 0x20, 0x40, 0x40, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x20,
+  0x10, 0x04, 0x9B, 0x17, 0x04, 0x10, 0x20, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x20, 0x10, 0x04, 0xFF, 0x9E, 0x0D, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xA5, 0x0D, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xB8, 0x17, 0x30,
+  0x0C, 0x06, 0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x03, 0x03, 0x06, 0x0C, 0x30, 0x9B, 0x17, 0x30, 0x0C, 0x06, 0x03, 0x03, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x06, 0x0C,
+  0x30, 0xFF, 0xB3, 0x17, 0x04, 0x10, 0x20, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x20, 0x10, 0x04, 0x9B, 0x17, 0x04, 0x10,
+  0x20, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x40, 0x40, 0x20, 0x10, 0x04, 0xFF, 0xD7, 0x05, 0xE0, 0xC0, 0x00, 0x80, 0xC0, 0xE0, 0xFA,
+  0x03, 0x03, 0x07, 0x03, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x99, 0x17, 0x04, 0x10, 0x20, 0x40, 0x40,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40,
+  0x20, 0x10, 0x04, 0x9B, 0x17, 0x04, 0x10, 0x20, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x20, 0x10, 0x04, 0xFF, 0xD6, 0x02,
+  0xE0, 0x20, 0x40, 0x81, 0x02, 0x40, 0x20, 0xE0, 0xF8, 0x00, 0x01, 0x82, 0x01, 0x02, 0x01, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBB, 0x01, 0xE0, 0x20, 0xFE, 0x00, 0x01, 0xFF, 0x9B, 0x13, 0x80,
+  0xC0, 0xC0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+  0xC0, 0xC0, 0x80, 0x9F, 0x13, 0x80, 0xC0, 0xC0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+  0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xC0, 0xC0, 0x80, 0xB5, 0x02, 0x0C, 0x03, 0x01, 0x91, 0x02,
+  0x01, 0x03, 0x0C, 0x9B, 0x02, 0x0C, 0x03, 0x01, 0x91, 0x02, 0x01, 0x03, 0x0C, 0xFF, 0xB3, 0x17,
+  0x04, 0x10, 0x20, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x40, 0x40, 0x20, 0x10, 0x04, 0x9B, 0x17, 0x04, 0x10, 0x20, 0x40, 0x40, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x20,
+  0x10, 0x04, 0xFF, 0xD4, 0x03, 0xE0, 0x20, 0x00, 0x40, 0x84, 0x01, 0x20, 0xE0, 0xF5, 0x02, 0x01,
+  0x00, 0x02, 0x84, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x99, 0x17, 0x04, 0x10, 0x20, 0x40, 0x40,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40,
+  0x20, 0x10, 0x04, 0x9B, 0x17, 0x04, 0x10, 0x20, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x20, 0x10, 0x04, 0xFF, 0xDA, 0x05,
+  0x80, 0x00, 0x40, 0x00, 0x20, 0xE0, 0xF9, 0x04, 0x04, 0x00, 0x02, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xB9, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC6, 0x00, 0xE0, 0xFF,
+  0x9A, 0x15, 0xC0, 0x60, 0x30, 0x30, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+  0x18, 0x18, 0x18, 0x18, 0x30, 0x30, 0x60, 0xC0, 0x9D, 0x15, 0xC0, 0x60, 0x30, 0x30, 0x18, 0x18,
+  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x30, 0x30, 0x60, 0xC0,
+  0xB4, 0x00, 0x03, 0x95, 0x00, 0x03, 0x9B, 0x00, 0x03, 0x95, 0x00, 0x03, 0xFF, 0xB3, 0x17, 0x04,
+  0x10, 0x20, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x40, 0x40, 0x20, 0x10, 0x04, 0x9B, 0x17, 0x04, 0x10, 0x20, 0x40, 0x40, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x20, 0x10,
+  0x04, 0xFF, 0xD2, 0x06, 0xE0, 0x00, 0x20, 0x00, 0x40, 0x00, 0x80, 0xFA, 0x04, 0x01, 0x00, 0x02,
+  0x00, 0x04, 0xFF, 0xFF, 0xA7, 0x04, 0x38, 0x7C, 0x7C, 0x7C, 0x38, 0xAE, 0x04, 0x38, 0x7C, 0x7C,
+  0x7C, 0x38, 0xFF, 0xFF, 0xFF, 0xD7, 0x0E, 0xE0, 0x00, 0x20, 0x00, 0x40, 0x40, 0x80, 0x80, 0x80,
+  0x40, 0x40, 0x00, 0x20, 0x00, 0xE0, 0xF2, 0x0A, 0x01, 0x00, 0x02, 0x02, 0x04, 0x04, 0x04, 0x02,
+  0x02, 0x00, 0x01, 0xFF, 0x9A, 0x15, 0x40, 0x20, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x10, 0x20, 0x40, 0x9D, 0x15, 0x40, 0x20,
+  0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x10, 0x10, 0x20, 0x40, 0xB4, 0x00, 0x01, 0x95, 0x00, 0x01, 0x9B, 0x00, 0x01, 0x95, 0x00, 0x01,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x99, 0x17, 0x02, 0x08, 0x10, 0x20, 0x20, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x20, 0x20, 0x10, 0x08, 0x02, 0x9B, 0x17,
+  0x02, 0x08, 0x10, 0x20, 0x20, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x20, 0x20, 0x10, 0x08, 0x02, 0xFF, 0xD2, 0x0E, 0xE0, 0x00, 0x20, 0x00, 0x40,
+  0x40, 0x80, 0x80, 0x80, 0x40, 0x40, 0x00, 0x20, 0x00, 0xE0, 0xF2, 0x0A, 0x01, 0x00, 0x02, 0x02,
+  0x04, 0x04, 0x04, 0x02, 0x02, 0x00, 0x01, 0xFF, 0x9A, 0x15, 0x80, 0x40, 0x20, 0x20, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x20, 0x20, 0x40, 0x80,
+  0x9D, 0x15, 0x80, 0x40, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x20, 0x20, 0x40, 0x80, 0xB4, 0x00, 0x02, 0x95, 0x00, 0x02, 0x9B, 0x00,
+  0x02, 0x95, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0x0E, 0xE0, 0x00, 0x20, 0x00,
+  0x40, 0x40, 0x80, 0x80, 0x80, 0x40, 0x40, 0x00, 0x20, 0x00, 0xE0, 0xF2, 0x0A, 0x01, 0x00, 0x02,
+  0x02, 0x04, 0x04, 0x04, 0x02, 0x02, 0x00, 0x01, 0xFF, 0x9A, 0x15, 0x80, 0x40, 0x20, 0x20, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x20, 0x20, 0x40,
+  0x80, 0x9D, 0x15, 0x80, 0x40, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x20, 0x20, 0x40, 0x80, 0xB4, 0x00, 0x02, 0x95, 0x00, 0x02, 0x9B,
+  0x00, 0x02, 0x95, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x99, 0x17, 0x02, 0x08, 0x10, 0x20, 0x20,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x20, 0x20,
+  0x10, 0x08, 0x02, 0x9B, 0x17, 0x02, 0x08, 0x10, 0x20, 0x20, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x20, 0x20, 0x10, 0x08, 0x02, 0xFF, 0x9A, 0x15,
+  0x40, 0x20, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x10, 0x10, 0x20, 0x40, 0x9D, 0x15, 0x40, 0x20, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x10, 0x20, 0x40, 0xB4, 0x00,
+  0x01, 0x95, 0x00, 0x01, 0x9B, 0x00, 0x01, 0x95, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD2, 0x0E, 0xE0,
+  0x00, 0x20, 0x00, 0x40, 0x40, 0x80, 0x80, 0x80, 0x40, 0x40, 0x00, 0x20, 0x00, 0xE0, 0xF2, 0x0A,
+  0x01, 0x00, 0x02, 0x02, 0x04, 0x04, 0x04, 0x02, 0x02, 0x00, 0x01, 0xFF, 0x9A, 0x15, 0x40, 0x20,
+  0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x10, 0x10, 0x20, 0x40, 0x9D, 0x15, 0x40, 0x20, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x10, 0x20, 0x40, 0xB4, 0x00, 0x01, 0x95,
+  0x00, 0x01, 0x9B, 0x00, 0x01, 0x95, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD2, 0x0E, 0xE0, 0x00, 0x20,
+  0x00, 0x40, 0x40, 0x80, 0x80, 0x80, 0x40, 0x40, 0x00, 0x20, 0x00, 0xE0, 0xF2, 0x0A, 0x01, 0x00,
+  0x02, 0x02, 0x04, 0x04, 0x04, 0x02, 0x02, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x99, 0x17, 0x02,
+  0x08, 0x10, 0x20, 0x20, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x20, 0x20, 0x10, 0x08, 0x02, 0x9B, 0x17, 0x02, 0x08, 0x10, 0x20, 0x20, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x20, 0x20, 0x10, 0x08,
+  0x02, 0xFF, 0x9A, 0x15, 0x80, 0x40, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x20, 0x20, 0x40, 0x80, 0x9D, 0x15, 0x80, 0x40, 0x20, 0x20,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x20, 0x20,
+  0x40, 0x80, 0xB4, 0x00, 0x02, 0x95, 0x00, 0x02, 0x9B, 0x00, 0x02, 0x95, 0x00, 0x02, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0x0E, 0xE0, 0x00, 0x20, 0x00, 0x40, 0x40, 0x80, 0x80, 0x80, 0x40,
+  0x40, 0x00, 0x20, 0x00, 0xE0, 0xF2, 0x0A, 0x01, 0x00, 0x02, 0x02, 0x04, 0x04, 0x04, 0x02, 0x02,
+  0x00, 0x01, 0xFF, 0x9A, 0x15, 0x80, 0x40, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x20, 0x20, 0x40, 0x80, 0x9D, 0x15, 0x80, 0x40, 0x20,
+  0x20, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x20,
+  0x20, 0x40, 0x80, 0xB4, 0x00, 0x02, 0x95, 0x00, 0x02, 0x9B, 0x00, 0x02, 0x95, 0x00, 0x02, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x99, 0x17, 0x02, 0x08, 0x10, 0x20, 0x20, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x20, 0x20, 0x10, 0x08, 0x02, 0x9B, 0x17, 0x02,
+  0x08, 0x10, 0x20, 0x20, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x20, 0x20, 0x10, 0x08, 0x02, 0xFF, 0xD2, 0x0E, 0xE0, 0x00, 0x20, 0x00, 0x40, 0x40,
+  0x80, 0x80, 0x80, 0x40, 0x40, 0x00, 0x20, 0x00, 0xE0, 0xF2, 0x0A, 0x01, 0x00, 0x02, 0x02, 0x04,
+  0x04, 0x04, 0x02, 0x02, 0x00, 0x01, 0xFF, 0x9A, 0x15, 0x40, 0x20, 0x10, 0x10, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x10, 0x20, 0x40, 0x9D,
+  0x15, 0x40, 0x20, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x10, 0x10, 0x20, 0x40, 0xB4, 0x00, 0x01, 0x95, 0x00, 0x01, 0x9B, 0x00, 0x01,
+  0x95, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0x0E, 0xE0, 0x00, 0x20, 0x00, 0x40,
+  0x40, 0x80, 0x80, 0x80, 0x40, 0x40, 0x00, 0x20, 0x00, 0xE0, 0xF2, 0x0A, 0x01, 0x00, 0x02, 0x02,
+  0x04, 0x04, 0x04, 0x02, 0x02, 0x00, 0x01, 0xFF, 0x9A, 0x15, 0x40, 0x20, 0x10, 0x10, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x10, 0x20, 0x40,
+  0x9D, 0x15, 0x40, 0x20, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x10, 0x10, 0x20, 0x40, 0xB4, 0x00, 0x01, 0x95, 0x00, 0x01, 0x9B, 0x00,
+  0x01, 0x95, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD6, 0x06, 0x40, 0x40, 0x80, 0x80, 0x80, 0x40, 0x40,
+  0xF8, 0x06, 0x02, 0x02, 0x04, 0x04, 0x04, 0x02, 0x02, 0xFF, 0x9A, 0x15, 0x40, 0x20, 0x10, 0x10,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x10,
+  0x20, 0x40, 0x9D, 0x15, 0x40, 0x20, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x10, 0x20, 0x40, 0xB4, 0x00, 0x01, 0x95, 0x00, 0x01,
+  0x9B, 0x00, 0x01, 0x95, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD6, 0x06, 0x40, 0x40, 0x80, 0x80, 0x80,
+  0x40, 0x40, 0xF8, 0x06, 0x02, 0x02, 0x04, 0x04, 0x04, 0x02, 0x02, 0xFF, 0x9A, 0x15, 0x40, 0x20,
+  0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x10, 0x10, 0x20, 0x40, 0x9D, 0x15, 0x40, 0x20, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x10, 0x20, 0x40, 0xB4, 0x00, 0x01, 0x95,
+  0x00, 0x01, 0x9B, 0x00, 0x01, 0x95, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD6, 0x06, 0x40, 0x40, 0x80,
+  0x80, 0x80, 0x40, 0x40, 0xF8, 0x06, 0x02, 0x02, 0x04, 0x04, 0x04, 0x02, 0x02, 0xFF, 0x9A, 0x15,
+  0x40, 0x20, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x10, 0x10, 0x20, 0x40, 0x9D, 0x15, 0x40, 0x20, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x10, 0x20, 0x40, 0xB4, 0x00,
+  0x01, 0x95, 0x00, 0x01, 0x9B, 0x00, 0x01, 0x95, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD6, 0x06, 0x40,
+  0x40, 0x80, 0x80, 0x80, 0x40, 0x40, 0xF8, 0x06, 0x02, 0x02, 0x04, 0x04, 0x04, 0x02, 0x02, 0xFF,
+  0x9A, 0x15, 0x40, 0x20, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x10, 0x10, 0x20, 0x40, 0x9D, 0x15, 0x40, 0x20, 0x10, 0x10, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x10, 0x20, 0x40,
+  0xB4, 0x00, 0x01, 0x95, 0x00, 0x01, 0x9B, 0x00, 0x01, 0x95, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD6,
+  0x06, 0x40, 0x40, 0x80, 0x80, 0x80, 0x40, 0x40, 0xF8, 0x06, 0x02, 0x02, 0x04, 0x04, 0x04, 0x02,
+  0x02, 0xFF, 0x9A, 0x15, 0x40, 0x20, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x10, 0x20, 0x40, 0x9D, 0x15, 0x40, 0x20, 0x10, 0x10,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x10,
+  0x20, 0x40, 0xB4, 0x00, 0x01, 0x95, 0x00, 0x01, 0x9B, 0x00, 0x01, 0x95, 0x00, 0x01, 0xFF, 0xFF,
+  0xFF, 0xD6, 0x06, 0x40, 0x40, 0x80, 0x80, 0x80, 0x40, 0x40, 0xF8, 0x06, 0x02, 0x02, 0x04, 0x04,
+  0x04, 0x02, 0x02, 0xFF, 0x9A, 0x15, 0x40, 0x20, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x10, 0x20, 0x40, 0x9D, 0x15, 0x40, 0x20,
+  0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x10, 0x10, 0x20, 0x40, 0xB4, 0x00, 0x01, 0x95, 0x00, 0x01, 0x9B, 0x00, 0x01, 0x95, 0x00, 0x01,
+  0xFF, 0xFF, 0xFF, 0xD6, 0x06, 0x40, 0x40, 0x80, 0x80, 0x80, 0x40, 0x40, 0xF8, 0x06, 0x02, 0x02,
+  0x04, 0x04, 0x04, 0x02, 0x02, 0xFF, 0x9A, 0x15, 0x40, 0x20, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x10, 0x20, 0x40, 0x9D, 0x15,
+  0x40, 0x20, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x10, 0x10, 0x20, 0x40, 0xB4, 0x00, 0x01, 0x95, 0x00, 0x01, 0x9B, 0x00, 0x01, 0x95,
+  0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD6, 0x06, 0x40, 0x40, 0x80, 0x80, 0x80, 0x40, 0x40, 0xF8, 0x06,
+  0x02, 0x02, 0x04, 0x04, 0x04, 0x02, 0x02, 0xFF, 0x9A, 0x15, 0x40, 0x20, 0x10, 0x10, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x10, 0x20, 0x40,
+  0x9D, 0x15, 0x40, 0x20, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x10, 0x10, 0x20, 0x40, 0xB4, 0x00, 0x01, 0x95, 0x00, 0x01, 0x9B, 0x00,
+  0x01, 0x95, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD6, 0x06, 0x40, 0x40, 0x80, 0x80, 0x80, 0x40, 0x40,
+  0xF8, 0x06, 0x02, 0x02, 0x04, 0x04, 0x04, 0x02, 0x02, 0xFF, 0x9A, 0x15, 0x40, 0x20, 0x10, 0x10,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x10,
+  0x20, 0x40, 0x9D, 0x15, 0x40, 0x20, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x10, 0x20, 0x40, 0xB4, 0x00, 0x01, 0x8C, 0x04, 0x38,
+  0x7C, 0x7C, 0x7C, 0x38, 0x83, 0x00, 0x01, 0x9B, 0x00, 0x01, 0x8C, 0x04, 0x38, 0x7C, 0x7C, 0x7C,
+  0x38, 0x83, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD6, 0x06, 0x40, 0x40, 0x80, 0x80, 0x80, 0x40, 0x40,
+  0xF8, 0x06, 0x02, 0x02, 0x04, 0x04, 0x04, 0x02, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB8,
+  0x06, 0xE0, 0x00, 0x20, 0x00, 0x40, 0x00, 0x80, 0x86, 0x00, 0xE0, 0xF2, 0x04, 0x01, 0x00, 0x02,
+  0x00, 0x04, 0xFF, 0x9A, 0x15, 0xC0, 0x60, 0x30, 0x30, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x30, 0x30, 0x60, 0xC0, 0x9D, 0x15, 0xC0, 0x60, 0x30,
+  0x30, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x30,
+  0x30, 0x60, 0xC0, 0xB4, 0x00, 0x03, 0x95, 0x00, 0x03, 0x9B, 0x00, 0x03, 0x95, 0x00, 0x03, 0xFF,
+  0xFF, 0xFF, 0xD3, 0x04, 0xE0, 0xE0, 0x20, 0x00, 0x40, 0x81, 0x05, 0x80, 0x00, 0x40, 0x00, 0x20,
+  0xE0, 0xF4, 0x02, 0x01, 0x00, 0x02, 0x81, 0x04, 0x04, 0x00, 0x02, 0x00, 0x01, 0xFF, 0x9B, 0x13,
+  0x80, 0x40, 0x40, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x40, 0x40, 0x80, 0x9F, 0x13, 0x80, 0x40, 0x40, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x40, 0x80, 0xB5, 0x01, 0x04, 0x01, 0x93, 0x01,
+  0x01, 0x04, 0x9B, 0x01, 0x04, 0x01, 0x93, 0x01, 0x01, 0x04, 0xFF, 0xFF, 0xFF, 0xD5, 0x01, 0xE0,
+  0x20, 0x83, 0x03, 0x40, 0x20, 0xC0, 0xE0, 0xF6, 0x00, 0x01, 0x83, 0x02, 0x02, 0x01, 0x01, 0xFF,
+  0x9C, 0x11, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC0, 0xC0, 0x80, 0x80, 0xA1, 0x11, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0xB6, 0x04, 0x18, 0x06, 0x03, 0x01, 0x01, 0x8D,
+  0x04, 0x01, 0x01, 0x03, 0x06, 0x18, 0x9B, 0x04, 0x18, 0x06, 0x03, 0x01, 0x01, 0x8D, 0x04, 0x01,
+  0x01, 0x03, 0x06, 0x18, 0xFF, 0xFF, 0xFF, 0xD6, 0x06, 0xE0, 0xC0, 0x80, 0x00, 0x80, 0xC0, 0xE0,
+  0xF9, 0x04, 0x01, 0x03, 0x07, 0x03, 0x01, 0xFF, 0xFF, 0x99, 0x17, 0x20, 0x08, 0x04, 0x02, 0x02,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02,
+  0x04, 0x08, 0x20, 0x9B, 0x17, 0x20, 0x08, 0x04, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x04, 0x08, 0x20, 0xFF, 0xFF, 0x99,
+  0x17, 0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE,
+  0xFE, 0xFE, 0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0xF0, 0xC0, 0x9B, 0x17, 0xC0, 0xF0, 0xF8, 0xFC, 0xFC,
+  0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFC, 0xFC,
+  0xF8, 0xF0, 0xC0, 0xB3, 0x17, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9B, 0x17, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x17, 0x03, 0x0F, 0x1F, 0x3F, 0x3F, 0x7F, 0x7F,
+  0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x3F, 0x1F, 0x0F,
+  0x03, 0x9B, 0x17, 0x03, 0x0F, 0x1F, 0x3F, 0x3F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
+  0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x3F, 0x1F, 0x0F, 0x03, 0xFF, 0xD2, 0x0D, 0x70, 0xF8,
+  0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x70, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC5, 0x01, 0x88, 0x70, 0xFF, 0xFF, 0x99, 0x17, 0x40, 0x10, 0x08, 0x04, 0x04, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x04, 0x08,
+  0x10, 0x40, 0x9B, 0x17, 0x40, 0x10, 0x08, 0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x04, 0x08, 0x10, 0x40, 0xFF, 0xFF, 0xFF, 0xD1,
+  0x01, 0x70, 0x88, 0xFF, 0xFF, 0xFF, 0xFF, 0x99, 0x17, 0x02, 0x08, 0x10, 0x20, 0x20, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x20, 0x20, 0x10, 0x08,
+  0x02, 0x9B, 0x17, 0x02, 0x08, 0x10, 0x20, 0x20, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x20, 0x20, 0x10, 0x08, 0x02, 0xFF, 0xE0, 0x01, 0x88, 0x70,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x02, 0x10, 0x38, 0x10, 0xD8, 0x02, 0x10, 0x38, 0x10, 0xC6,
+  0x01, 0x70, 0x88, 0x8E, 0x01, 0x88, 0x70, 0xFF, 0xFF, 0x99, 0x17, 0x80, 0x20, 0x10, 0x08, 0x08,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x08,
+  0x10, 0x20, 0x80, 0x9B, 0x17, 0x80, 0x20, 0x10, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x08, 0x10, 0x20, 0x80, 0xFF, 0xB3, 0x17,
+  0x01, 0x04, 0x08, 0x10, 0x10, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x10, 0x10, 0x08, 0x04, 0x01, 0x9B, 0x17, 0x01, 0x04, 0x08, 0x10, 0x10, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10, 0x10, 0x08,
+  0x04, 0x01, 0xFF, 0xCF, 0x01, 0x60, 0x80, 0x90, 0x01, 0x80, 0x60, 0xEC, 0x10, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xFF, 0xFF,
+  0x9A, 0x15, 0x40, 0x20, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x10, 0x10, 0x20, 0x40, 0x9D, 0x15, 0x40, 0x20, 0x10, 0x10, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x10, 0x20, 0x40,
+  0xB4, 0x00, 0x01, 0x95, 0x00, 0x01, 0x9B, 0x00, 0x01, 0x95, 0x00, 0x01, 0xFF, 0xFF, 0xCE, 0x02,
+  0x60, 0x90, 0x08, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x02, 0x60, 0x90,
+  0x08, 0x91, 0x02, 0x08, 0x90, 0x60, 0xE9, 0x00, 0x01, 0x91, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x99,
+  0x00, 0x80, 0x95, 0x00, 0x80, 0x9B, 0x00, 0x80, 0x95, 0x00, 0x80, 0xB4, 0x15, 0x02, 0x04, 0x08,
+  0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x08,
+  0x08, 0x04, 0x02, 0x9D, 0x15, 0x02, 0x04, 0x08, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x08, 0x08, 0x04, 0x02, 0xAA, 0x04, 0x38, 0x6C, 0x44,
+  0x6C, 0x38, 0xD6, 0x04, 0x38, 0x6C, 0x44, 0x6C, 0x38, 0xD8, 0x02, 0x08, 0x90, 0x60, 0xFC, 0x00,
+  0x01, 0xFF, 0xFF, 0x9A, 0x15, 0x80, 0x40, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x20, 0x20, 0x40, 0x80, 0x9D, 0x15, 0x80, 0x40, 0x20,
+  0x20, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x20,
+  0x20, 0x40, 0x80, 0xB4, 0x00, 0x02, 0x95, 0x00, 0x02, 0x9B, 0x00, 0x02, 0x95, 0x00, 0x02, 0xFF,
+  0xA8, 0x06, 0x38, 0x44, 0x82, 0x82, 0x82, 0x44, 0x38, 0xD4, 0x06, 0x38, 0x44, 0x82, 0x82, 0x82,
+  0x44, 0x38, 0xC0, 0x02, 0x60, 0x90, 0x08, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xCA, 0x02, 0x08, 0x90, 0x60, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0x9B, 0x13, 0x80, 0x40, 0x40, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x40, 0x80,
+  0x9F, 0x13, 0x80, 0x40, 0x40, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x40, 0x40, 0x80, 0xB5, 0x01, 0x04, 0x01, 0x93, 0x01, 0x01, 0x04, 0x9B, 0x01,
+  0x04, 0x01, 0x93, 0x01, 0x01, 0x04, 0xFF, 0xA7, 0x08, 0x38, 0xC6, 0x82, 0x01, 0x01, 0x01, 0x82,
+  0xC6, 0x38, 0xD2, 0x08, 0x38, 0xC6, 0x82, 0x01, 0x01, 0x01, 0x82, 0xC6, 0x38, 0x9D, 0x02, 0x01,
+  0x01, 0x01, 0x9D, 0x02, 0xE0, 0x90, 0x08, 0x97, 0x00, 0x80, 0x9E, 0x02, 0x01, 0x01, 0x01, 0xC2,
+  0x19, 0x01, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F,
+  0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0xD6, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0x9B, 0x03, 0x7C,
+  0xC6, 0x01, 0x01, 0x82, 0x03, 0x01, 0x01, 0xC6, 0x7C, 0xD0, 0x03, 0x7C, 0xC6, 0x01, 0x01, 0x82,
+  0x03, 0x01, 0x01, 0xC6, 0x7C, 0x9A, 0x06, 0x01, 0x03, 0x02, 0x02, 0x02, 0x03, 0x01, 0xD4, 0x06,
+  0x01, 0x03, 0x02, 0x02, 0x02, 0x03, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x04, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0xD6, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0x9B, 0x03, 0x7C, 0xC6, 0x01, 0x01, 0x82,
+  0x03, 0x01, 0x01, 0xC6, 0x7C, 0xD0, 0x03, 0x7C, 0xC6, 0x01, 0x01, 0x82, 0x03, 0x01, 0x01, 0xC6,
+  0x7C, 0x9A, 0x06, 0x01, 0x03, 0x02, 0x02, 0x02, 0x03, 0x01, 0xD4, 0x06, 0x01, 0x03, 0x02, 0x02,
+  0x02, 0x03, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0xD6, 0x04,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x9B, 0x03, 0x7C, 0xC6, 0x01, 0x01, 0x82, 0x03, 0x01, 0x01, 0xC6,
+  0x7C, 0xD0, 0x03, 0x7C, 0xC6, 0x01, 0x01, 0x82, 0x03, 0x01, 0x01, 0xC6, 0x7C, 0x9A, 0x06, 0x01,
+  0x03, 0x02, 0x02, 0x02, 0x03, 0x01, 0xD4, 0x06, 0x01, 0x03, 0x02, 0x02, 0x02, 0x03, 0x01, 0xFF,
+  0xFF, 0x9B, 0x13, 0x80, 0x40, 0x40, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x40, 0x40, 0x80, 0x9F, 0x13, 0x80, 0x40, 0x40, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x40, 0x80, 0xB5, 0x01, 0x44,
+  0x01, 0x93, 0x01, 0x01, 0x44, 0x9B, 0x01, 0x44, 0x01, 0x93, 0x01, 0x01, 0x44, 0xB4, 0x15, 0x01,
+  0x02, 0x04, 0x04, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x04, 0x04, 0x02, 0x01, 0x9D, 0x15, 0x01, 0x02, 0x04, 0x04, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x04, 0x04, 0x02, 0x01, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x8F, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0xD6, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0x9B,
+  0x03, 0x7C, 0xC6, 0x01, 0x01, 0x82, 0x03, 0x01, 0x01, 0xC6, 0x7C, 0xD0, 0x03, 0x7C, 0xC6, 0x01,
+  0x01, 0x82, 0x03, 0x01, 0x01, 0xC6, 0x7C, 0x9A, 0x06, 0x01, 0x03, 0x02, 0x02, 0x02, 0x03, 0x01,
+  0xD4, 0x06, 0x01, 0x03, 0x02, 0x02, 0x02, 0x03, 0x01, 0xFF, 0xFF, 0x9B, 0x13, 0x80, 0x40, 0x40,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x40,
+  0x80, 0x9F, 0x13, 0x80, 0x40, 0x40, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x40, 0x40, 0x80, 0xB5, 0x01, 0x44, 0x01, 0x93, 0x01, 0x01, 0x44, 0x9B,
+  0x01, 0x44, 0x01, 0x93, 0x01, 0x01, 0x44, 0xB4, 0x15, 0x01, 0x02, 0x04, 0x04, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x04, 0x04, 0x02, 0x01, 0x9D,
+  0x15, 0x01, 0x02, 0x04, 0x04, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x04, 0x04, 0x02, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x04, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0xD6, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0x9B, 0x03, 0x7C, 0xC6, 0x01, 0x01, 0x82,
+  0x03, 0x01, 0x01, 0xC6, 0x7C, 0xD0, 0x03, 0x7C, 0xC6, 0x01, 0x01, 0x82, 0x03, 0x01, 0x01, 0xC6,
+  0x7C, 0x9A, 0x06, 0x01, 0x03, 0x02, 0x02, 0x02, 0x03, 0x01, 0xD4, 0x06, 0x01, 0x03, 0x02, 0x02,
+  0x02, 0x03, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0xD6, 0x04,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x9B, 0x03, 0x7C, 0xC6, 0x01, 0x01, 0x82, 0x03, 0x01, 0x01, 0xC6,
+  0x7C, 0xD0, 0x03, 0x7C, 0xC6, 0x01, 0x01, 0x82, 0x03, 0x01, 0x01, 0xC6, 0x7C, 0x9A, 0x06, 0x01,
+  0x03, 0x02, 0x02, 0x02, 0x03, 0x01, 0xD4, 0x06, 0x01, 0x03, 0x02, 0x02, 0x02, 0x03, 0x01, 0xFF,
+  0xFF, 0x9B, 0x13, 0x80, 0x40, 0x40, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x40, 0x40, 0x80, 0x9F, 0x13, 0x80, 0x40, 0x40, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x40, 0x80, 0xB5, 0x01, 0x44,
+  0x01, 0x93, 0x01, 0x01, 0x44, 0x9B, 0x01, 0x44, 0x01, 0x93, 0x01, 0x01, 0x44, 0xB4, 0x15, 0x01,
+  0x02, 0x04, 0x04, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x04, 0x04, 0x02, 0x01, 0x9D, 0x15, 0x01, 0x02, 0x04, 0x04, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x04, 0x04, 0x02, 0x01, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x8F, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0xD6, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0x9B,
+  0x03, 0x7C, 0xC6, 0x01, 0x01, 0x82, 0x03, 0x01, 0x01, 0xC6, 0x7C, 0xD0, 0x03, 0x7C, 0xC6, 0x01,
+  0x01, 0x82, 0x03, 0x01, 0x01, 0xC6, 0x7C, 0x9A, 0x06, 0x01, 0x03, 0x02, 0x02, 0x02, 0x03, 0x01,
+  0xD4, 0x06, 0x01, 0x03, 0x02, 0x02, 0x02, 0x03, 0x01, 0xFF, 0xFF, 0x9B, 0x13, 0x80, 0x40, 0x40,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x40,
+  0x80, 0x9F, 0x13, 0x80, 0x40, 0x40, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x40, 0x40, 0x80, 0xB5, 0x01, 0x44, 0x01, 0x93, 0x01, 0x01, 0x44, 0x9B,
+  0x01, 0x44, 0x01, 0x93, 0x01, 0x01, 0x44, 0xA9, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0x85, 0x15,
+  0x01, 0x02, 0x04, 0x04, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x04, 0x04, 0x02, 0x01, 0x9D, 0x15, 0x01, 0x02, 0x04, 0x04, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x04, 0x04, 0x02, 0x01, 0x86, 0x04,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x9B, 0x03, 0x7C, 0xC6, 0x01, 0x01, 0x82, 0x03, 0x01, 0x01, 0xC6,
+  0x7C, 0xD0, 0x03, 0x7C, 0xC6, 0x01, 0x01, 0x82, 0x03, 0x01, 0x01, 0xC6, 0x7C, 0x9A, 0x06, 0x01,
+  0x03, 0x02, 0x02, 0x02, 0x03, 0x01, 0xD4, 0x06, 0x01, 0x03, 0x02, 0x02, 0x02, 0x03, 0x01, 0xFF,
+  0xFF, 0x9C, 0x11, 0x80, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x00, 0x80, 0xA1, 0x11, 0x80, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x80, 0xB7, 0x01, 0x02, 0x01, 0x91, 0x01, 0x01,
+  0x02, 0x9D, 0x01, 0x02, 0x01, 0x91, 0x01, 0x01, 0x02, 0xB5, 0x15, 0x01, 0x02, 0x04, 0x00, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x04, 0x02,
+  0x01, 0x9D, 0x15, 0x01, 0x02, 0x04, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x04, 0x02, 0x01, 0xFF, 0xFF, 0x9D, 0x0F, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xA3, 0x0F, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xB7,
+  0x17, 0x48, 0x84, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x84, 0x48, 0x9B, 0x17, 0x48, 0x84, 0x02, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x02, 0x84, 0x48, 0xB5, 0x13, 0x01, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x01, 0x9F, 0x13, 0x01, 0x03, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x01, 0xFF,
+  0xFF, 0xFF, 0x99, 0x17, 0x10, 0x08, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C,
+  0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x08, 0x10, 0x9B, 0x17, 0x10, 0x08,
+  0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C,
+  0x8C, 0x8C, 0x8C, 0x8C, 0x08, 0x10, 0xFF, 0xFF, 0xFF, 0x99, 0x17, 0x50, 0x88, 0x88, 0x88, 0x88,
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+  0x88, 0x88, 0x50, 0x9B, 0x17, 0x50, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x50, 0xFF, 0xFF, 0xFF,
+  0x99, 0x17, 0x88, 0x04, 0x06, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x06, 0x04, 0x88, 0x9B, 0x17, 0x88, 0x04, 0x06, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x06, 0x04, 0x88, 0xB4, 0x15, 0x01, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x01, 0x9D, 0x15, 0x01, 0x03,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x03, 0x01, 0xFF, 0xFF, 0x9C, 0x11, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0xA1, 0x11, 0x80, 0x80, 0xC0, 0xC0,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0xB6, 0x02,
+  0x80, 0x02, 0x01, 0x91, 0x02, 0x01, 0x02, 0x80, 0x9B, 0x02, 0x80, 0x02, 0x01, 0x91, 0x02, 0x01,
+  0x02, 0x80, 0xB8, 0x0D, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0xA5, 0x0D, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0x02, 0xE0, 0x10, 0x08, 0xFD, 0x01, 0x01,
+  0x02, 0xFF, 0xFF, 0xFF, 0x99, 0x00, 0x80, 0x95, 0x00, 0x80, 0x9B, 0x00, 0x80, 0x95, 0x00, 0x80,
+  0xB4, 0x15, 0x02, 0x04, 0x08, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x08, 0x08, 0x04, 0x02, 0x9D, 0x15, 0x02, 0x04, 0x08, 0x08, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x08, 0x08, 0x04, 0x02,
+  0xFF, 0xE5, 0x02, 0x08, 0x10, 0xE0, 0xFC, 0x01, 0x02, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xB2, 0x02, 0xE0, 0x10, 0x08, 0xFD, 0x01, 0x01, 0x02, 0xFF, 0xFF, 0x9B, 0x13, 0x80, 0x40, 0x40,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x40,
+  0x80, 0x9F, 0x13, 0x80, 0x40, 0x40, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x40, 0x40, 0x80, 0xB5, 0x01, 0x04, 0x01, 0x93, 0x01, 0x01, 0x04, 0x9B,
+  0x01, 0x04, 0x01, 0x93, 0x01, 0x01, 0x04, 0xFF, 0xA7, 0x08, 0x38, 0xC6, 0x82, 0x01, 0x01, 0x01,
+  0x82, 0xC6, 0x38, 0xD2, 0x08, 0x38, 0xC6, 0x82, 0x01, 0x01, 0x01, 0x82, 0xC6, 0x38, 0x9D, 0x02,
+  0x01, 0x01, 0x01, 0xB5, 0x02, 0x08, 0x10, 0xE0, 0x9F, 0x02, 0x01, 0x01, 0x01, 0xD9, 0x01, 0x02,
+  0x01, 0xFF, 0xFF, 0x99, 0x17, 0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE,
+  0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0xF0, 0xC0, 0x9B, 0x17, 0xC0,
+  0xF0, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE,
+  0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0xF0, 0xC0, 0xB3, 0x17, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x9B, 0x17, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x17, 0x03, 0x0F, 0x1F,
+  0x3F, 0x3F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
+  0x3F, 0x3F, 0x1F, 0x0F, 0x03, 0x9B, 0x17, 0x03, 0x0F, 0x1F, 0x3F, 0x3F, 0x7F, 0x7F, 0x7F, 0x7F,
+  0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x3F, 0x1F, 0x0F, 0x03, 0xFF,
+  0xFF, 0xD7, 0x04, 0x1C, 0x1C, 0x1C, 0x1C, 0x0E, 0xFF, 0xFF, 0x99, 0x17, 0x40, 0x10, 0x08, 0x04,
+  0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04,
+  0x04, 0x08, 0x10, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8A, 0x00, 0x1C, 0x84, 0x00, 0x0E, 0xFF,
+  0xFF, 0x99, 0x17, 0x80, 0x20, 0x10, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x08, 0x10, 0x20, 0x80, 0xFF, 0xE7, 0x17, 0x02, 0x08,
+  0x10, 0x20, 0x20, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x20, 0x20, 0x10, 0x08, 0x02, 0xFF, 0xFF, 0xFF, 0x89, 0x00, 0x1C, 0x81, 0x05, 0x12, 0x12,
+  0x12, 0x00, 0x09, 0x07, 0xFF, 0xFF, 0x9A, 0x15, 0x40, 0x20, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x10, 0x20, 0x40, 0xE8, 0x00,
+  0x81, 0x95, 0x00, 0x81, 0xE7, 0x17, 0x01, 0x06, 0x0C, 0x18, 0x18, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x18, 0x18, 0x0C, 0x06, 0x01, 0xFF, 0xFF,
+  0x93, 0x01, 0x80, 0x80, 0xF0, 0x05, 0x1C, 0x1C, 0x1C, 0x00, 0x12, 0x12, 0x82, 0x00, 0x09, 0x81,
+  0x02, 0x07, 0x03, 0x03, 0xFF, 0xFF, 0x9A, 0x15, 0x80, 0x40, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x20, 0x20, 0x40, 0x80, 0xE8, 0x00,
+  0x42, 0x95, 0x00, 0x42, 0xE8, 0x15, 0x01, 0x02, 0x04, 0x04, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x04, 0x04, 0x02, 0x01, 0xFF, 0xFF, 0x91, 0x06,
+  0x80, 0x80, 0x80, 0x00, 0x40, 0xC0, 0xC0, 0xEC, 0x12, 0x1C, 0x1C, 0x00, 0x12, 0x12, 0x12, 0x00,
+  0x09, 0x09, 0x09, 0x09, 0x00, 0x04, 0x04, 0x04, 0x00, 0x02, 0x01, 0x01, 0xFF, 0xFF, 0x9B, 0x13,
+  0x80, 0x40, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x00, 0x40, 0x80, 0xEA, 0x00, 0x81, 0x93, 0x00, 0x81, 0xEA, 0x13, 0x01, 0x02, 0x00, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x02, 0x01,
+  0xFF, 0xFF, 0x91, 0x00, 0x80, 0x82, 0x00, 0x40, 0x81, 0x01, 0x20, 0xE0, 0xEA, 0x00, 0x1C, 0x81,
+  0x00, 0x12, 0x87, 0x00, 0x04, 0x82, 0x00, 0x02, 0x81, 0x00, 0x01, 0xFF, 0xFF, 0x9D, 0x0F, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xEB,
+  0x01, 0x40, 0x80, 0x93, 0x01, 0x80, 0x40, 0xE9, 0x01, 0x01, 0x02, 0x8F, 0x01, 0x02, 0x01, 0xFF,
+  0xFF, 0x98, 0x02, 0x20, 0x00, 0xE0, 0xE8, 0x00, 0x1C, 0x81, 0x00, 0x12, 0x8F, 0x00, 0x01, 0xFF,
+  0xFF, 0xFF, 0x99, 0x01, 0x40, 0x80, 0x93, 0x01, 0x80, 0x40, 0xE9, 0x13, 0x01, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01,
+  0xFF, 0xFF, 0x8E, 0x0D, 0x80, 0x80, 0x80, 0x00, 0x40, 0x40, 0x40, 0x00, 0x20, 0x20, 0x20, 0x00,
+  0x90, 0x70, 0xE6, 0x00, 0x1C, 0x81, 0x00, 0x12, 0x82, 0x0E, 0x09, 0x09, 0x09, 0x00, 0x04, 0x04,
+  0x04, 0x00, 0x02, 0x02, 0x02, 0x00, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0x9C, 0x11, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xEA,
+  0x02, 0x04, 0x80, 0x01, 0x91, 0x02, 0x01, 0x80, 0x04, 0xFF, 0xFF, 0xFF, 0x99, 0x17, 0x20, 0xC2,
+  0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x80, 0xC2, 0x20, 0xEA, 0x11, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0x99, 0x17, 0x08,
+  0x04, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46,
+  0x46, 0x46, 0x46, 0x46, 0x46, 0x04, 0x08, 0xFF, 0xFF, 0xFF, 0x99, 0x17, 0x10, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x10, 0xFF, 0xFF, 0xFF, 0x99, 0x17, 0x10, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x10, 0xFF, 0xFF, 0xFF, 0x99, 0x17, 0x08, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0xFF, 0xFF,
+  0xFF, 0x99, 0x17, 0x20, 0x40, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2,
+  0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0x40, 0x20, 0xFF, 0xFF, 0xFF, 0x99, 0x17,
+  0x20, 0x02, 0x80, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x80, 0x02, 0x20, 0xFF, 0xFF, 0xFF, 0x99, 0x02, 0x20, 0x80, 0x80,
+  0x91, 0x02, 0x80, 0x80, 0x20, 0xEA, 0x11, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0x9C, 0x11, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xEA,
+  0x02, 0x04, 0x80, 0x01, 0x91, 0x02, 0x01, 0x80, 0x04, 0xFF, 0xD2, 0x0D, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xB9, 0x15, 0x80, 0xC0, 0x60, 0x60,
+  0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+  0xC0, 0x80, 0x9C, 0x17, 0x30, 0x0C, 0x06, 0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x06, 0x0C, 0x30, 0xB3, 0x17, 0x33, 0x61,
+  0xC0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0xC0, 0x61, 0x33, 0xEA, 0x11, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x9E, 0x17, 0x03, 0x0C, 0x18, 0x30,
+  0x30, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x30,
+  0x30, 0x18, 0x0C, 0x03, 0xFF, 0xD0, 0x15, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0x60,
+  0x60, 0x60, 0x60, 0xB0, 0xB0, 0xB0, 0xB0, 0xD8, 0xD8, 0xD8, 0xD8, 0x6C, 0x6C, 0xE6, 0x12, 0x1B,
+  0x1B, 0x1B, 0x0D, 0x0D, 0x0D, 0x0D, 0x06, 0x06, 0x06, 0x06, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01,
+  0x01, 0x01, 0xFF, 0xD2, 0x0D, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0xB9, 0x15, 0x80, 0xC0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+  0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xC0, 0x80, 0x9C, 0x17, 0x30, 0x0C, 0x06,
+  0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x03, 0x03, 0x06, 0x0C, 0x30, 0xB3, 0x17, 0x33, 0x61, 0xC0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC0, 0x61, 0x33, 0xEA,
+  0x11, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x9E, 0x17, 0x03, 0x0C, 0x18, 0x30, 0x30, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+  0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x30, 0x30, 0x18, 0x0C, 0x03, 0xFF, 0xD0, 0x15,
+  0x80, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0x60, 0x60, 0x60, 0x60, 0xB0, 0xB0, 0xB0, 0xB0,
+  0xD8, 0xD8, 0xD8, 0xD8, 0x6C, 0x6C, 0xE6, 0x12, 0x1B, 0x1B, 0x1B, 0x0D, 0x0D, 0x0D, 0x0D, 0x06,
+  0x06, 0x06, 0x06, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 0xFF, 0xD2, 0x0D, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xB9, 0x15, 0x80, 0xC0,
+  0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+  0x60, 0x60, 0xC0, 0x80, 0x9C, 0x17, 0x30, 0x0C, 0x06, 0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x06, 0x0C, 0x30, 0xB3, 0x17,
+  0x33, 0x61, 0xC0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0xC0, 0x61, 0x33, 0xEA, 0x11, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x9E, 0x17, 0x03, 0x0C,
+  0x18, 0x30, 0x30, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+  0x60, 0x30, 0x30, 0x18, 0x0C, 0x03, 0xFF, 0xD0, 0x15, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0xC0,
+  0xC0, 0x60, 0x60, 0x60, 0x60, 0xB0, 0xB0, 0xB0, 0xB0, 0xD8, 0xD8, 0xD8, 0xD8, 0x6C, 0x6C, 0xE6,
+  0x12, 0x1B, 0x1B, 0x1B, 0x0D, 0x0D, 0x0D, 0x0D, 0x06, 0x06, 0x06, 0x06, 0x03, 0x03, 0x03, 0x03,
+  0x01, 0x01, 0x01, 0x01, 0xFF, 0xD2, 0x0D, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0xB9, 0x15, 0x80, 0xC0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+  0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xC0, 0x80, 0x9C, 0x17, 0x30,
+  0x0C, 0x06, 0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x03, 0x03, 0x06, 0x0C, 0x30, 0xB3, 0x17, 0x33, 0x61, 0xC0, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC0, 0x61,
+  0x33, 0xEA, 0x11, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x9E, 0x17, 0x03, 0x0C, 0x18, 0x30, 0x30, 0x60, 0x60, 0x60, 0x60,
+  0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x30, 0x30, 0x18, 0x0C, 0x03, 0xFF,
+  0xD0, 0x15, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0x60, 0x60, 0x60, 0x60, 0xB0, 0xB0,
+  0xB0, 0xB0, 0xD8, 0xD8, 0xD8, 0xD8, 0x6C, 0x6C, 0xE6, 0x12, 0x1B, 0x1B, 0x1B, 0x0D, 0x0D, 0x0D,
+  0x0D, 0x06, 0x06, 0x06, 0x06, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 0xFF, 0xD2, 0x0D,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xB9, 0x15,
+  0x80, 0xC0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+  0x60, 0x60, 0x60, 0x60, 0xC0, 0x80, 0x9C, 0x17, 0x30, 0x0C, 0x06, 0x03, 0x03, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x06, 0x0C, 0x30,
+  0xB3, 0x17, 0x33, 0x61, 0xC0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC0, 0x61, 0x33, 0xEA, 0x11, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x9E, 0x17,
+  0x03, 0x0C, 0x18, 0x30, 0x30, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+  0x60, 0x60, 0x60, 0x30, 0x30, 0x18, 0x0C, 0x03, 0xFF, 0xD0, 0x15, 0x80, 0x80, 0x80, 0x80, 0xC0,
+  0xC0, 0xC0, 0xC0, 0x60, 0x60, 0x60, 0x60, 0xB0, 0xB0, 0xB0, 0xB0, 0xD8, 0xD8, 0xD8, 0xD8, 0x6C,
+  0x6C, 0xE6, 0x12, 0x1B, 0x1B, 0x1B, 0x0D, 0x0D, 0x0D, 0x0D, 0x06, 0x06, 0x06, 0x06, 0x03, 0x03,
+  0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 0xFF, 0xD2, 0x0D, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xB9, 0x15, 0x80, 0xC0, 0x60, 0x60, 0x60, 0x60, 0x60,
+  0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xC0, 0x80, 0x9C,
+  0x17, 0x30, 0x0C, 0x06, 0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x06, 0x0C, 0x30, 0xB3, 0x17, 0x33, 0x61, 0xC0, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xC0, 0x61, 0x33, 0xEA, 0x11, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x9E, 0x17, 0x03, 0x0C, 0x18, 0x30, 0x30, 0x60, 0x60,
+  0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x30, 0x30, 0x18, 0x0C,
+  0x03, 0xFF, 0xD0, 0x15, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0x60, 0x60, 0x60, 0x60,
+  0xB0, 0xB0, 0xB0, 0xB0, 0xD8, 0xD8, 0xD8, 0xD8, 0x6C, 0x6C, 0xE6, 0x12, 0x1B, 0x1B, 0x1B, 0x0D,
+  0x0D, 0x0D, 0x0D, 0x06, 0x06, 0x06, 0x06, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 0xFF,
+  0xFF, 0xFF, 0x99, 0x01, 0x40, 0x80, 0x93, 0x01, 0x80, 0x40, 0xE9, 0x13, 0x01, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01,
+  0xFF, 0xFF, 0x8E, 0x0D, 0x80, 0x80, 0x80, 0x00, 0x40, 0x40, 0x40, 0x00, 0x20, 0x20, 0x20, 0x00,
+  0x90, 0x70, 0xE6, 0x00, 0x1C, 0x81, 0x00, 0x12, 0x82, 0x0E, 0x09, 0x09, 0x09, 0x00, 0x04, 0x04,
+  0x04, 0x00, 0x02, 0x02, 0x02, 0x00, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0x9D, 0x0F, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xEB, 0x01, 0x40,
+  0x80, 0x93, 0x01, 0x80, 0x40, 0xE9, 0x01, 0x01, 0x02, 0x8F, 0x01, 0x02, 0x01, 0xFF, 0xFF, 0x98,
+  0x02, 0x20, 0x00, 0xE0, 0xE8, 0x00, 0x1C, 0x81, 0x00, 0x12, 0x8F, 0x00, 0x01, 0xFF, 0xFF, 0x9B,
+  0x13, 0x80, 0x40, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x00, 0x40, 0x80, 0xEA, 0x00, 0x81, 0x93, 0x00, 0x81, 0xEA, 0x13, 0x01, 0x02, 0x00,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x02,
+  0x01, 0xFF, 0xFF, 0x91, 0x00, 0x80, 0x82, 0x00, 0x40, 0x81, 0x01, 0xE0, 0xE0, 0xEA, 0x04, 0x1C,
+  0x1C, 0x00, 0x12, 0x12, 0x82, 0x00, 0x09, 0x82, 0x00, 0x04, 0x82, 0x00, 0x02, 0xFF, 0xFF, 0x9A,
+  0x15, 0x80, 0x40, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x20, 0x20, 0x40, 0x80, 0xE8, 0x00, 0xC2, 0x95, 0x00, 0xC2, 0xE8, 0x15, 0x03,
+  0x06, 0x0C, 0x0C, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+  0x18, 0x0C, 0x0C, 0x06, 0x03, 0xFF, 0xFF, 0x91, 0x01, 0x80, 0x80, 0x81, 0x01, 0xC0, 0xC0, 0xEE,
+  0x0C, 0x1C, 0x1C, 0x00, 0x12, 0x12, 0x12, 0x00, 0x09, 0x09, 0x09, 0x00, 0x04, 0x04, 0x81, 0x01,
+  0x01, 0x01, 0xFF, 0xFF, 0x9A, 0x15, 0x40, 0x20, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x10, 0x20, 0x40, 0xE8, 0x00, 0x01, 0x95,
+  0x00, 0x01, 0xE7, 0x17, 0x01, 0x04, 0x08, 0x10, 0x10, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10, 0x10, 0x08, 0x04, 0x01, 0xFF, 0xFF, 0x92, 0x01,
+  0x80, 0x80, 0xF2, 0x01, 0x1C, 0x1C, 0x81, 0x00, 0x12, 0x82, 0x00, 0x09, 0x81, 0x01, 0x03, 0x03,
+  0xFF, 0xFF, 0x99, 0x17, 0x80, 0x20, 0x10, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x08, 0x10, 0x20, 0x80, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x89, 0x00, 0x1C, 0x81, 0x05, 0x12, 0x12, 0x12, 0x00, 0x09, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x99, 0x17, 0x02, 0x08, 0x10, 0x20, 0x20, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x20, 0x20, 0x10, 0x08, 0x02, 0xFF, 0xFF, 0xFF, 0x8A, 0x00, 0x1C,
+  0x84, 0x00, 0x0E, 0xFF, 0xFF, 0x99, 0x17, 0x40, 0x10, 0x08, 0x04, 0x04, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x04, 0x08, 0x10, 0x40, 0xFF,
+  0x91, 0x20, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+  0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+  0x06, 0x06, 0x06, 0x9A, 0x20, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+  0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+  0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0xAA, 0x17, 0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0xFE,
+  0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0xF0, 0xC0,
+  0x9B, 0x17, 0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE,
+  0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0xF0, 0xC0, 0xB3, 0x17, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x9B, 0x17, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x17,
+  0x03, 0x0F, 0x1F, 0x3F, 0x3F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
+  0x7F, 0x7F, 0x7F, 0x3F, 0x3F, 0x1F, 0x0F, 0x03, 0x9B, 0x17, 0x03, 0x0F, 0x1F, 0x3F, 0x3F, 0x7F,
+  0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x3F, 0x1F,
+  0x0F, 0x03, 0xFF, 0xFF, 0x99, 0x17, 0x40, 0x10, 0x08, 0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x04, 0x08, 0x10, 0x40, 0x9B, 0x17,
+  0x40, 0x10, 0x08, 0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x04, 0x04, 0x08, 0x10, 0x40, 0xFF, 0x91, 0x20, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+  0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+  0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x9A, 0x20, 0x0A, 0x0A,
+  0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+  0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0xAA,
+  0x17, 0x80, 0x20, 0x10, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x08, 0x08, 0x10, 0x20, 0x80, 0x9B, 0x17, 0x80, 0x20, 0x10, 0x08, 0x08,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x08,
+  0x10, 0x20, 0x80, 0xFF, 0xB3, 0x17, 0x02, 0x08, 0x10, 0x20, 0x20, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x20, 0x20, 0x10, 0x08, 0x02, 0x9B, 0x17,
+  0x02, 0x08, 0x10, 0x20, 0x20, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x20, 0x20, 0x10, 0x08, 0x02, 0xFF, 0x91, 0x20, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
+  0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
+  0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x9A, 0x20, 0x3C, 0x3C,
+  0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
+  0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0xAB,
+  0x15, 0xC0, 0x60, 0x30, 0x30, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+  0x18, 0x18, 0x18, 0x30, 0x30, 0x60, 0xC0, 0x9D, 0x15, 0xC0, 0x60, 0x30, 0x30, 0x18, 0x18, 0x18,
+  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x30, 0x30, 0x60, 0xC0, 0xB4,
+  0x00, 0x03, 0x95, 0x00, 0x03, 0x9B, 0x00, 0x03, 0x95, 0x00, 0x03, 0xB3, 0x17, 0x01, 0x04, 0x08,
+  0x10, 0x10, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x10, 0x10, 0x08, 0x04, 0x01, 0x9B, 0x17, 0x01, 0x04, 0x08, 0x10, 0x10, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10, 0x10, 0x08, 0x04, 0x01, 0xFF,
+  0x91, 0x20, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+  0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+  0x50, 0x50, 0x50, 0x9A, 0x20, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+  0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+  0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0xAC, 0x13, 0x80, 0x40, 0x40, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x40, 0x80, 0x9F, 0x13, 0x80, 0x40,
+  0x40, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40,
+  0x40, 0x80, 0xB5, 0x01, 0x84, 0x01, 0x93, 0x01, 0x01, 0x84, 0x9B, 0x01, 0x84, 0x01, 0x93, 0x01,
+  0x01, 0x84, 0xB4, 0x15, 0x02, 0x04, 0x08, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x08, 0x08, 0x04, 0x02, 0x9D, 0x15, 0x02, 0x04, 0x08, 0x08,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x08, 0x08,
+  0x04, 0x02, 0xFF, 0xD6, 0x09, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0x80, 0xEF,
+  0x14, 0x0E, 0x0E, 0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x03, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03,
+  0x03, 0x07, 0x07, 0x07, 0x0E, 0x0E, 0xFF, 0x91, 0x20, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0,
+  0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0,
+  0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x9A, 0x20, 0xA0, 0xA0, 0xA0, 0xA0,
+  0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0,
+  0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0x11, 0x80,
+  0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00,
+  0x80, 0xA1, 0x11, 0x80, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x00, 0x80, 0xB7, 0x01, 0x02, 0x01, 0x91, 0x01, 0x01, 0x02, 0x9D, 0x01, 0x02,
+  0x01, 0x91, 0x01, 0x01, 0x02, 0xB5, 0x15, 0x01, 0x02, 0x04, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x04, 0x02, 0x01, 0x9D, 0x15, 0x01,
+  0x02, 0x04, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x00, 0x04, 0x02, 0x01, 0xFF, 0xFF, 0x9D, 0x0F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xA3, 0x0F, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xB7, 0x00, 0x80, 0x95, 0x00,
+  0x80, 0x9B, 0x00, 0x80, 0x95, 0x00, 0x80, 0xB4, 0x02, 0x01, 0x02, 0x04, 0x8F, 0x02, 0x04, 0x02,
+  0x01, 0x9D, 0x02, 0x01, 0x02, 0x04, 0x8F, 0x02, 0x04, 0x02, 0x01, 0xFF, 0x91, 0x20, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x9A,
+  0x20, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0xA2, 0x20, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x9A, 0x20, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xAA, 0x17, 0x08, 0x04, 0x02, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02,
+  0x04, 0x08, 0x9B, 0x17, 0x08, 0x04, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x04, 0x08, 0xFF, 0xFF, 0xFF, 0x99,
+  0x17, 0x10, 0x00, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x00, 0x10, 0x9B, 0x17, 0x10, 0x00, 0x04, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x04, 0x00, 0x10, 0xB4, 0x00, 0x02, 0x93, 0x00, 0x02, 0x9D, 0x00, 0x02, 0x93, 0x00, 0x02, 0xFF,
+  0xFF, 0xFF, 0x99, 0x00, 0x80, 0x95, 0x00, 0x80, 0x9B, 0x00, 0x80, 0x95, 0x00, 0x80, 0xB4, 0x15,
+  0x02, 0x02, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x02, 0x02, 0x9D, 0x15, 0x02, 0x02, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x02, 0x02, 0xFF, 0xFF,
+  0xFF, 0x99, 0x17, 0x80, 0x08, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x08, 0x80, 0x9B, 0x17, 0x80, 0x08, 0x00,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x00, 0x08, 0x80, 0xB5, 0x00, 0x02, 0x91, 0x00, 0x02, 0x9F, 0x00, 0x02, 0x91, 0x00,
+  0x02, 0xFF, 0xFF, 0xFF, 0x99, 0x17, 0x80, 0x08, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x08, 0x80, 0x9B, 0x17,
+  0x80, 0x08, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x08, 0x80, 0xB5, 0x00, 0x02, 0x91, 0x00, 0x02, 0x9F, 0x00,
+  0x02, 0x91, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x99, 0x00, 0x80, 0x95, 0x00, 0x80, 0x9B, 0x00, 0x80,
+  0x95, 0x00, 0x80, 0xB4, 0x15, 0x02, 0x02, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x02, 0x02, 0x9D, 0x15, 0x02, 0x02, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x02, 0x02, 0xFF, 0xFF, 0xFF, 0x99, 0x17, 0x10, 0x00, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x00, 0x10,
+  0x9B, 0x17, 0x10, 0x00, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x00, 0x10, 0xB4, 0x00, 0x02, 0x93, 0x00, 0x02,
+  0x9D, 0x00, 0x02, 0x93, 0x00, 0x02, 0xFF, 0x91, 0x20, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x9A, 0x20, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xA2, 0x20, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x9A, 0x20, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0xAE, 0x0F, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0xA3, 0x0F, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xBB, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xA3, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xFF, 0x91, 0x20, 0xB0, 0xB0,
+  0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0,
+  0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0x9A,
+  0x20, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0,
+  0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0,
+  0xB0, 0xB0, 0xA2, 0x20, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0xC1,
+  0xC1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xC1,
+  0xC1, 0x81, 0x01, 0x01, 0x01, 0x9A, 0x20, 0x01, 0x01, 0x81, 0xC1, 0xC1, 0xE1, 0xE1, 0xE1, 0xE1,
+  0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xC1, 0xC1, 0x81, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xAA, 0x03, 0x0C, 0x07, 0x03, 0x01, 0x8F, 0x03,
+  0x01, 0x03, 0x07, 0x0C, 0x9B, 0x03, 0x0C, 0x07, 0x03, 0x01, 0x8F, 0x03, 0x01, 0x03, 0x07, 0x0C,
+  0xB4, 0x15, 0x02, 0x04, 0x08, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x00, 0x08, 0x04, 0x02, 0x9D, 0x15, 0x02, 0x04, 0x08, 0x00, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x08, 0x04, 0x02,
+  0xFF, 0x91, 0x20, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+  0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+  0x48, 0x48, 0x48, 0x48, 0x9A, 0x20, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+  0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+  0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0xAB, 0x15, 0x80, 0x40, 0x20, 0x20, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x20, 0x20, 0x40, 0x80, 0x9D,
+  0x15, 0x80, 0x40, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x20, 0x20, 0x40, 0x80, 0xB4, 0x00, 0x02, 0x95, 0x00, 0x02, 0x9B, 0x00, 0x02,
+  0x95, 0x00, 0x02, 0xB3, 0x17, 0x03, 0x0C, 0x18, 0x30, 0x30, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+  0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x30, 0x30, 0x18, 0x0C, 0x03, 0x9B, 0x17, 0x03,
+  0x0C, 0x18, 0x30, 0x30, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+  0x60, 0x60, 0x30, 0x30, 0x18, 0x0C, 0x03, 0xFF, 0x91, 0x20, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+  0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+  0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x9A, 0x20, 0x24, 0x24, 0x24,
+  0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+  0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0xAB, 0x15,
+  0x40, 0x20, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x10, 0x10, 0x20, 0x40, 0x9D, 0x15, 0x40, 0x20, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x10, 0x20, 0x40, 0xB4, 0x00,
+  0x01, 0x95, 0x00, 0x01, 0x9B, 0x00, 0x01, 0x95, 0x00, 0x01, 0xB3, 0x17, 0x04, 0x10, 0x20, 0x40,
+  0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40,
+  0x40, 0x20, 0x10, 0x04, 0x9B, 0x17, 0x04, 0x10, 0x20, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x20, 0x10, 0x04, 0xFF, 0x91,
+  0x20, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+  0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+  0x1A, 0x1A, 0x9A, 0x20, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+  0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+  0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0xAA, 0x17, 0xC0, 0x30, 0x18, 0x0C, 0x0C, 0x06, 0x06, 0x06, 0x06,
+  0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0C, 0x0C, 0x18, 0x30, 0xC0, 0x9B,
+  0x17, 0xC0, 0x30, 0x18, 0x0C, 0x0C, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+  0x06, 0x06, 0x06, 0x06, 0x0C, 0x0C, 0x18, 0x30, 0xC0, 0xFF, 0xB3, 0x17, 0x04, 0x10, 0x20, 0x40,
+  0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40,
+  0x40, 0x20, 0x10, 0x04, 0x9B, 0x17, 0x04, 0x10, 0x20, 0x40, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x20, 0x10, 0x04, 0xFF, 0xFF,
+  0xFF, 0x99, 0x17, 0x60, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x60, 0x9B, 0x17, 0x60, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0x60,
+};
+
+static const uint32_t FRAME_CACHE_OFFSETS[] PROGMEM = {
+  0, 189, 189, 189, 189, 189, 189, 189, 217, 217, 217, 217,
+  217, 217, 217, 324, 324, 324, 324, 324, 324, 324, 324, 352,
+  352, 352, 352, 352, 352, 352, 459, 459, 459, 459, 459, 459,
+  459, 459, 459, 459, 459, 459, 459, 459, 459, 566, 566, 566,
+  566, 566, 566, 624, 624, 624, 624, 624, 624, 682, 682, 682,
+  789, 966, 966, 1031, 1170, 1314, 1493, 1606, 1744, 1744, 1796, 1825,
+  1854, 1906, 1906, 1935, 2013, 2013, 2013, 2091, 2120, 2120, 2172, 2201,
+  2230, 2282, 2282, 2529, 2529, 2529, 2529, 2776, 2776, 2776, 2776, 2890,
+  2904, 3032, 3146, 3269, 3404, 3436, 3436, 3436, 3492, 3554, 3619, 3681,
+  3737, 3737, 3853, 4031, 4031, 4085, 4192, 4306, 4424, 4550, 4625, 4755,
+  4811, 4956, 5024, 5024, 5042, 5060, 5076, 5093, 5103, 5113, 5122, 5132,
+  5155, 5170, 5200, 5232, 5263, 5293, 5317, 5339, 5361, 5378, 5408, 5431,
+  5468, 5507, 5551, 5596, 5633, 5655, 5677, 5694, 5724, 5747, 5784, 5823,
+  5867, 5912, 5949, 5971, 5993, 6010, 6072, 6179, 6286, 6432, 6578, 6736,
+  6843, 6897, 7108, 7108, 7191, 7348, 7438, 7603, 7895, 8247, 8599, 8951,
+  9303, 9655, 10007, 10359, 10711, 11063, 11415, 11767, 12119, 12471, 12823, 13175,
+  13527, 13879, 14231, 14583, 14918, 15229, 15510, 15783, 16048, 16301, 16526, 16526,
+  16644, 16700, 16742, 16742, 16891, 16963, 17144, 17144, 17144, 17251, 17322, 17384,
+  17514, 17514, 17578, 17588, 17588, 17588, 17600, 17600, 17600, 17600, 17600, 17600,
+  17612, 17624, 17641, 17660, 17679, 17696, 17714, 17734, 17754, 17772, 17786, 17786,
+  17800, 17898, 17999, 18100, 18201, 18302, 18403, 18504, 18605, 18706, 18807, 18902,
+  18902, 18902, 18902, 18902, 18957, 19019, 19081, 19203, 19291, 19353, 19353, 19353,
+  19353, 19460, 19714, 19714, 19776, 19909, 20068, 20143, 20308, 20308, 20308, 20308,
+  20308, 20308, 20308, 20308, 20308, 20520, 20780, 21040, 21300, 21560, 21820, 22080,
+  22340, 22600, 22860, 23120, 23380, 23640, 23900, 24160, 24420, 24680, 24940, 25200,
+  25460, 25752, 26044, 26336, 26628, 26920, 27212, 27504, 27796, 28088, 28380, 28640,
+  28640, 28640, 28696, 28696, 28885, 29096, 29096, 29152, 29152, 29331, 29520, 29520,
+  29574, 29703, 29820, 29887, 29975, 29999, 29999, 30007, 30007, 30007, 30007, 30007,
+  30007, 30016, 30016, 30016, 30016, 30016, 30016, 30053, 30053, 30119, 30184, 30273,
+  30340, 30411, 30468, 30504, 30504, 30504, 30504, 30504, 30504, 30504, 30504, 30689,
+  30689, 30752, 30866, 30976, 31032, 31086, 31271, 31271, 31325, 31439, 31502, 31564,
+  31627, 31633, 31633, 31633, 31633, 31633, 31633, 31633, 31633, 31633, 31639, 31639,
+  31639, 31639, 31639, 31639, 31639, 31639, 31639, 31645, 31645, 31645, 31645, 31645,
+  31645, 31645, 31645, 31645, 31645, 31676, 31739, 31857, 31964, 32086, 32106, 32167,
+  32306, 32413, 32580, 32590, 32750, 32901, 33024, 33167, 33399, 33571, 33771, 33943,
+  34143, 34315, 34515, 34687, 34887, 35059, 35259, 35431, 35631, 35803, 36003, 36175,
+  36375, 36547, 36747, 36919, 37065, 37083, 37103, 37123, 37143, 37161, 37172, 37182,
+  37193, 37203, 37272, 37272, 37272, 37272, 37272, 37272, 37272, 37272, 37451, 37451,
+  37558, 37705, 37819, 38002, 38002, 38002, 38002, 38002, 38002, 38207, 38412, 38412,
+  38593, 38790, 38987, 39184, 39381, 39578, 39775, 39972, 40169, 40366, 40563, 40760,
+  40943, 40943, 40943, 40943, 40943, 41004, 41004, 41136, 41197, 41253, 41314, 41436,
+  41436, 41490, 41490, 41490, 41490, 41588, 41763, 41763, 41870, 41980, 42098, 42236,
+  42339, 42394, 42449, 42584, 42584, 42584, 42713, 42713, 42806, 42859, 42859, 42859,
+  42859, 42859, 42859, 42859, 42898, 42898, 42898, 42898, 42898, 42898, 42898, 42937,
+  42937, 42937, 42937, 42937, 42937, 42937, 42976, 42976, 42976, 42976, 42976, 42976,
+  42976, 43015, 43015, 43015, 43015, 43015, 43015, 43015, 43054, 43054, 43054, 43054,
+  43054, 43085, 43085, 43114, 43114, 43143, 43143, 43143, 43172, 43172, 43201, 43201,
+  43201, 43201, 43201, 43201, 43403, 43403, 43403, 43461, 43575, 43631, 43745, 43849,
+  43908, 43983, 44047, 44047, 44110, 44110, 44110, 44110, 44110, 44110, 44110, 44189,
+  44189, 44268, 44268, 44268, 44268, 44268, 44268, 44268, 44268, 44268, 44268, 44268,
+  44268, 44268, 44268, 44268, 44304, 44304, 44304, 44304, 44304, 44304, 44304, 44340,
+  44340, 44340, 44340, 44403, 44467, 44526, 44601, 44705, 44767, 44879, 44935, 44993,
+  45053, 45053, 45053, 45111, 45269, 45269, 45350, 45462, 45584, 45708, 45780, 45867,
+  45921, 45921, 45973, 45973, 46025, 46058, 46110, 46110, 46162, 46162, 46272, 46272,
+  46272, 46272, 46301, 46365, 46434, 46496, 46564, 46631, 46664, 46664, 46753, 46753,
+  46753, 46753, 46786, 46858, 46995, 47028, 47095, 47125, 47125, 47244, 47264, 47264,
+  47264, 47264, 47322, 47322, 47322, 47366, 47524, 47524, 47524, 47524, 47524, 47580,
+  47733, 47807, 47820, 47957, 48029, 48038, 48047, 48047, 48178, 48227, 48227, 48288,
+  48375, 48436, 48436, 48472, 48533, 48589, 48683, 48683, 48683, 48777, 48833, 48894,
+  48930, 48930, 48991, 49078, 49139, 49139, 49175, 49257, 49339, 49421, 49503, 49585,
+  49667, 49749, 49831, 49913, 50009, 50009, 50034, 50125, 50207, 50295, 50295, 50349,
+  50524, 50524, 50524, 50534, 50595, 50656, 50679, 50814, 50886, 50908, 50993, 51082,
+  51096, 51096, 51227, 51287, 51347, 51347, 51347, 51347, 51407, 51517, 51517, 51517,
+  51577, 51577, 51577, 51687, 51747, 51747, 51747, 51747, 51807, 51807, 51917, 51917,
+  51977, 51977, 51977, 51977, 52143, 52143, 52249, 52383, 52438, 52438, 52493, 52596,
+  52690, 52690, 52690, 52690, 52690, 52705, 52778, 52778, 52793, 52793, 52793, 52897,
+  53064, 53064, 53103, 53172, 53252, 53340, 53419, 53471, 53545, 53545, 53577, 53626,
+  53655, 53684, 53684, 53684, 53684, 53684, 53713, 53742, 53771, 53800, 53833, 53865,
+  54050, 54050, 54050, 54235, 54235, 54235, 54420, 54420, 54420, 54605, 54605, 54605,
+  54790, 54790, 54975, 54975, 55049, 55101, 55181, 55266, 55344, 55388, 55427, 55455,
+  55682, 55682, 55736, 55912, 56095, 56310, 56485, 56555, 56748, 56748, 56748, 56748,
+  56748, 56748, 56748, 56748, 56748, 56748, 56748, 56748, 56748, 56748, 56748, 56815,
+  56815, 56815, 56878, 56878, 56878, 56878, 56878, 56945, 56945, 56945, 56945, 56945,
+  56945, 56945, 56945, 56945, 57012, 57012, 57012, 57075, 57075, 57075, 57075, 57075,
+  57142, 57142, 57142, 57355, 57568, 57751, 57934, 58110, 58165,
+};
+
+static const int FRAME_CACHE_ENTRY_COUNT = 18;
+static const FrameCacheEntry FRAME_CACHE_ENTRIES[] PROGMEM = {
+  { 0,  60,    0},  // IDLE
+  { 1,  50,   60},  // HAPPY
+  { 2,  59,  110},  // SLEEPY
+  { 3,  40,  169},  // EXCITED
+  { 4,  56,  209},  // SAD
+  { 5,  56,  265},  // ANGRY
+  { 6,  44,  321},  // CONFUSED
+  { 7,  44,  365},  // THINKING
+  { 8,  44,  409},  // LOVE
+  { 9,  44,  453},  // SURPRISED
+  {10,  70,  497},  // DEAD
+  {11,  60,  567},  // BORED
+  {12,  50,  627},  // SHY
+  {13,  54,  677},  // NEEDY
+  {14,  60,  731},  // CONTENT
+  {15,  48,  791},  // PLAYFUL
+  {16,  56,  839},  // GRUMPY
+  {17,   1,  895},  // BLINK
+};
+
+#endif // FRAME_CACHE_DATA_H
@@ -0,0 +1,32 @@
+// Frame codec — XOR-delta + RLE for 1bpp SSD1306 page-layout frames.
+// Each frame is stored as the XOR against the frame before it (the first frame
+// of a sequence against a blank screen), then run-length coded:
+//   0x00..0x7F  (c + 1) literal XOR bytes follow
+//   0x80..0xFF  skip (c - 0x7F) unchanged bytes
+// XOR is its own inverse, so the same delta steps a buffer forward (k-1 -> k)
+// or backward (k -> k-1) — PINGPONG playback never needs a second copy.
+
+#ifndef FRAME_CODEC_H
+#define FRAME_CODEC_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+static const size_t FRAME_CODEC_MAX_RUN = 128;
+
+// Worst-case encoded size of a len-byte frame (every byte changed).
+inline size_t frameDeltaBound(size_t len) {
+  return len + (len + FRAME_CODEC_MAX_RUN - 1) / FRAME_CODEC_MAX_RUN;
+}
+
+// Encodes cur as a delta against prev (nullptr = blank frame) into out and
+// stores the encoded length (0 for an unchanged frame) in outLen.
+// Returns false if cap is too small.
+bool encodeFrameDelta(const uint8_t* cur, const uint8_t* prev, size_t len,
+                      uint8_t* out, size_t cap, size_t& outLen);
+
+// XORs an encoded delta into buf. Returns false if the delta runs past len bytes.
+bool applyFrameDelta(const uint8_t* delta, size_t deltaLen, uint8_t* buf,
+                     size_t len);
+
+#endif // FRAME_CODEC_H
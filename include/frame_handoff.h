@@ -0,0 +1,45 @@
+// FrameHandoff — lock-free mailbox that passes finished frames from the renderer
+// to the display task. Three slots rotate between the roles "being written",
+// "latest ready" and "being sent", swapped with a single atomic exchange, so
+// neither side ever waits for the other. If the renderer publishes twice while
+// the bus is busy, the older unsent frame is replaced (counted as dropped) —
+// the panel always receives the newest frame, never a half-written one.
+
+#ifndef FRAME_HANDOFF_H
+#define FRAME_HANDOFF_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+#include "config.h"
+
+class FrameHandoff {
+public:
+  static const size_t FRAME_BYTES = SCREEN_WIDTH * (SCREEN_HEIGHT / 8);
+
+  FrameHandoff();
+
+  // Producer: copies frame into the write slot and makes it the latest ready frame.
+  void publish(const uint8_t* frame);
+
+  // Consumer: returns the newest frame published since the last take(), or nullptr.
+  // The pointer stays valid (and untouched by publish) until the next take().
+  const uint8_t* take();
+
+  uint32_t getPublished() const { return published_; }
+  uint32_t getTaken() const { return taken_; }
+  uint32_t getDropped() const { return dropped_; }
+
+private:
+  static const uint8_t FRESH = 0x80;  // set on ready_ when it holds an untaken frame
+
+  uint8_t slots_[3][FRAME_BYTES];
+  uint8_t writeSlot_;            // owned by the producer
+  uint8_t readSlot_;             // owned by the consumer
+  std::atomic<uint8_t> ready_;   // slot index | FRESH
+  uint32_t published_;
+  uint32_t taken_;
+  uint32_t dropped_;
+};
+
+#endif // FRAME_HANDOFF_H
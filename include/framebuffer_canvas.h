@@ -0,0 +1,92 @@
+// FrameBufferCanvas — software rasterizer behind the ICanvas interface.
+// Renders every primitive into a 128x64 1bpp buffer in SSD1306 page layout
+// (byte = 8 vertical pixels, buffer[x + (y / 8) * 128], bit = y & 7), using the
+// same algorithms as Adafruit_GFX so output is pixel-identical to the panel.
+// Builds in env:native: tests get pixel-exact frames and a real raster cost
+// (pixel writes) for every DrawFrameFn without a board. flush() diffs against
+// the previous flushed frame the same way DisplayManager does, so I2C savings
+// can be measured too.
+
+#ifndef FRAMEBUFFER_CANVAS_H
+#define FRAMEBUFFER_CANVAS_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "canvas.h"
+#include "dirty_rect.h"
+
+class FrameBufferCanvas : public ICanvas {
+public:
+  static const int WIDTH = SCREEN_WIDTH;
+  static const int HEIGHT = SCREEN_HEIGHT;
+  static const int PAGES = SCREEN_HEIGHT / 8;
+  static const int BUFFER_SIZE = SCREEN_WIDTH * SCREEN_HEIGHT / 8;
+
+  FrameBufferCanvas();
+
+  // --- ICanvas implementation ---
+  void clear() override;
+  void flush() override;
+  void fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r,
+                     uint16_t color) override;
+  void drawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r,
+                     uint16_t color) override;
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                uint16_t color) override;
+  void drawRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                uint16_t color) override;
+  void fillCircle(int16_t x, int16_t y, int16_t r, uint16_t color) override;
+  void drawCircle(int16_t x, int16_t y, int16_t r, uint16_t color) override;
+  void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                uint16_t color) override;
+  void fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                    int16_t x2, int16_t y2, uint16_t color) override;
+  void setTextSize(uint8_t size) override;
+  void setCursor(int16_t x, int16_t y) override;
+  void setTextColor(uint16_t color) override;
+  void print(const char* text) override;
+  void println(const char* text) override;
+  uint8_t* frameBuffer() override { return buffer_; }
+
+  // --- Pixel access ---
+  void drawPixel(int16_t x, int16_t y, uint16_t color);
+  bool getPixel(int16_t x, int16_t y) const;
+  int countLitPixels() const;
+  uint8_t* getBuffer() { return buffer_; }
+  const uint8_t* getBuffer() const { return buffer_; }
+
+  // --- Raster cost ---
+  uint32_t getPixelWrites() const { return pixelWrites_; }  // since last clear()
+  uint32_t getFlushCount() const { return flushCount_; }
+
+  // --- Flush accounting (what a dirty-window flush would push to the panel) ---
+  uint32_t getSkippedFlushes() const { return skippedFlushes_; }
+  uint32_t getFlushedBytes() const { return flushedBytes_; }
+  // Window sent by the last flush(); false if that flush was skipped as identical.
+  bool getLastDirtyRect(DirtyRect& out) const;
+
+private:
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+  void drawCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t corners,
+                        uint16_t color);
+  void fillCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t corners,
+                        int16_t delta, uint16_t color);
+  void drawChar(int16_t x, int16_t y, char c);
+  void write(char c);
+
+  uint8_t buffer_[BUFFER_SIZE];
+  uint8_t flushed_[BUFFER_SIZE];  // frame as of the last flush()
+  DirtyRect lastDirty_;
+  bool lastFlushSent_;
+  uint32_t pixelWrites_;
+  uint32_t flushCount_;
+  uint32_t skippedFlushes_;
+  uint32_t flushedBytes_;
+  int16_t cursorX_;
+  int16_t cursorY_;
+  uint8_t textSize_;
+  uint16_t textColor_;
+};
+
+#endif // FRAMEBUFFER_CANVAS_H
@@ -0,0 +1,92 @@
+// HTTP/1.1 wire format for the pooled web server (http_server.h).
+// HttpRequestParser is fed socket bytes as they arrive — a request may come in
+// one byte at a time — and parses in place inside a fixed buffer, so a slow or
+// oversized client costs a bounded, preallocated amount of memory and never
+// blocks. Response heads and chunk framing are formatted here too, which keeps
+// everything protocol-level testable off-device.
+
+#ifndef HTTP_PROTO_H
+#define HTTP_PROTO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "config.h"
+
+enum class HttpMethod : uint8_t { GET, POST, PUT, DELETE_, HEAD, OPTIONS, OTHER };
+
+enum HttpParseState {
+  HTTP_PARSE_NEED_MORE,   // feed more bytes
+  HTTP_PARSE_COMPLETE,    // request line, headers and body are available
+  HTTP_PARSE_ERROR        // malformed or over a limit — see errorStatus()
+};
+
+class HttpRequestParser {
+public:
+  static const int MAX_HEADERS = 16;
+
+  HttpRequestParser();
+
+  // Drops any partial request and leftover bytes.
+  void reset();
+
+  // Appends bytes and advances parsing. Returns how many of len were consumed —
+  // fewer than len once a request completes; the rest belongs to the next request
+  // and is fed again after reset().
+  size_t feed(const uint8_t* data, size_t len);
+
+  HttpParseState state() const { return state_; }
+  bool started() const { return len_ > 0; }  // some bytes of a request have arrived
+  int errorStatus() const { return errorStatus_; }  // 400, 413, 431 or 505
+
+  HttpMethod method() const { return method_; }
+  const char* path() const { return path_; }    // without the query string
+  const char* query() const { return query_; }  // "" when absent
+  const char* body() const { return body_; }    // NUL-terminated
+  size_t bodyLength() const { return contentLength_; }
+
+  // Case-insensitive header lookup; nullptr when absent.
+  const char* header(const char* name) const;
+
+  // HTTP/1.1 defaults to keep-alive, HTTP/1.0 to close; Connection: overrides either.
+  bool keepAlive() const;
+
+  // Looks name up in the query string, then in an urlencoded body, and
+  // percent-decodes the value into out. Returns false if absent or too long for cap;
+  // out == nullptr just tests for presence.
+  bool arg(const char* name, char* out, size_t cap) const;
+  bool hasArg(const char* name) const;
+
+private:
+  char buf_[HTTP_MAX_REQUEST_BYTES + 1];  // +1 so the body can always be NUL-terminated
+  size_t len_;          // bytes held in buf_
+  size_t headerEnd_;    // offset of the body (0 while headers are incomplete)
+  size_t contentLength_;
+  HttpParseState state_;
+  int errorStatus_;
+  HttpMethod method_;
+  bool http11_;
+  const char* path_;
+  const char* query_;
+  const char* body_;
+  const char* headerNames_[MAX_HEADERS];
+  const char* headerValues_[MAX_HEADERS];
+  int headerCount_;
+
+  void parseHead();
+  void fail(int status);
+  static bool findArg(const char* src, size_t srcLen, const char* name, char* out, size_t cap);
+};
+
+// Reason phrase for the status codes the server uses ("Unknown" otherwise).
+const char* httpStatusText(int code);
+
+// Formats a status line and headers ending in the blank line. contentLength < 0
+// selects chunked transfer encoding. extraHeaders is "Name: value\r\n"* or nullptr.
+// Returns the length written, or 0 if it does not fit.
+size_t formatResponseHead(char* out, size_t cap, int code, const char* contentType,
+                          long contentLength, bool keepAlive, const char* extraHeaders);
+
+// Writes the "<hex length>\r\n" that precedes a chunk of len bytes. Returns its length.
+size_t formatChunkHeader(char* out, size_t cap, size_t len);
+
+#endif // HTTP_PROTO_H
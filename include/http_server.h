@@ -0,0 +1,117 @@
+#ifndef HTTP_SERVER_H
+#define HTTP_SERVER_H
+
+// HttpServer — non-blocking, pooled HTTP/1.1 server for WebServerManager.
+// Replaces the Arduino WebServer, which serves one client at a time and blocks
+// loop() while it reads a request or writes a response. Here every socket is
+// non-blocking and update() does a bounded slice of work per connection: accept
+// into a free slot, read what has arrived, dispatch a complete request, write
+// what the socket will take. Responses are either built in the connection's own
+// buffer, streamed zero-copy from flash, or generated chunk by chunk, so a slow
+// client or a second tab only ever costs its own slot, never the frame loop.
+// Excluded from native builds via NATIVE_BUILD guard; the wire format lives in
+// http_proto.h and is tested natively.
+
+#ifndef NATIVE_BUILD
+
+#include <Arduino.h>
+#include <functional>
+#include <WiFi.h>
+#include "config.h"
+#include "http_proto.h"
+
+class HttpServer {
+public:
+  using Handler = std::function<void()>;
+  // Writes the next piece of a streamed body into buf; returns 0 when the body is complete.
+  using ChunkFn = std::function<size_t(char* buf, size_t cap)>;
+
+  static const int MAX_ROUTES = 16;
+
+  explicit HttpServer(uint16_t port);
+
+  void on(const char* uri, HttpMethod method, Handler handler);
+  void onNotFound(Handler handler) { notFound_ = handler; }
+  void begin();
+
+  // Accepts, reads, dispatches and writes without blocking — call every loop().
+  void update();
+
+  // --- Request accessors (valid inside a handler) ---
+  bool hasArg(const char* name) const;
+  String arg(const char* name) const;
+  String header(const char* name) const;
+
+  // --- Responses (one per request) ---
+  void sendHeader(const char* name, const char* value);
+  void send(int code, const char* contentType = nullptr, const char* body = "");
+  // Body stays in flash and is written straight from it as the socket drains.
+  void send_P(int code, const char* contentType, const char* flashBody);
+  void sendStatic(int code, const char* contentType, const uint8_t* data, size_t len);
+  // Chunked transfer encoding; fn is called whenever the socket can take more.
+  void sendStream(int code, const char* contentType, ChunkFn fn);
+
+  // Hands the current socket to the caller (e.g. a Server-Sent Events stream)
+  // and frees its pool slot. The socket stays non-blocking; write to it with writeNow().
+  WiFiClient takeClient();
+
+  // Writes one whole message to a handed-off socket without waiting. False when the
+  // socket could not take all of it right now; the stream is then unusable and the
+  // caller closes it, so a slow client is dropped instead of stalling loop().
+  static bool writeNow(WiFiClient& client, const void* data, size_t len);
+
+  int activeConnections() const;
+
+private:
+  enum ConnState : uint8_t { CONN_FREE, CONN_READING, CONN_WRITING };
+
+  struct Connection {
+    WiFiClient client;
+    ConnState state;
+    bool keepAlive;
+    unsigned long lastActive;
+    HttpRequestParser req;
+    uint8_t carry[HTTP_READ_SLICE_BYTES];  // bytes read past the end of the current request
+    size_t carryLen;
+    char tx[HTTP_TX_BUFFER_BYTES];       // head (+ small body, or the current chunk)
+    size_t txLen;
+    size_t txSent;
+    const uint8_t* body;                 // zero-copy body (flash), sent after tx
+    size_t bodyLen;
+    size_t bodySent;
+    ChunkFn chunks;                      // streamed body, framed as chunks into tx
+    bool chunksDone;
+  };
+
+  struct Route {
+    const char* uri;
+    HttpMethod method;
+    Handler handler;
+  };
+
+  WiFiServer listener_;
+  uint16_t port_;
+  Connection conns_[HTTP_MAX_CONNECTIONS];
+  Route routes_[MAX_ROUTES];
+  int routeCount_;
+  Handler notFound_;
+
+  Connection* current_;         // connection whose request is being handled
+  bool responded_;
+  char extraHeaders_[256];      // sendHeader() lines for the pending response
+  size_t extraLen_;
+
+  void acceptPending(unsigned long now);
+  void readFrom(Connection& c, unsigned long now);
+  void dispatch(Connection& c);
+  void writeTo(Connection& c, unsigned long now);
+  bool fillNextChunk(Connection& c);
+  void finishResponse(Connection& c);
+  void sendError(Connection& c, int code);
+  bool beginResponse(int code, const char* contentType, long contentLength, size_t bodyBytes);
+  void close(Connection& c);
+  void clearResponse(Connection& c);
+};
+
+#endif // NATIVE_BUILD
+#endif // HTTP_SERVER_H
@@ -4,29 +4,32 @@
 #include <Arduino.h>
 #include "config.h"
 
-// Gesture types detected by InputManager
-enum TouchGesture {
-  GESTURE_NONE,
-  GESTURE_TAP,
-  GESTURE_LONG_PRESS,
-  GESTURE_DOUBLE_TAP
-};
+#include "touch_decoder.h"
 
 // Callback for gesture events
 typedef void (*GestureHandlerFn)(TouchGesture gesture, unsigned long currentTime);
 
-// Testable gesture classification (exposed for unit testing)
-TouchGesture classifyGesture(unsigned long pressDuration, unsigned long sincePrevTap);
-
 // ===== INPUT MANAGER =====
+// Touch edges are captured by a GPIO interrupt into a lock-free queue with micros()
+// timestamps (edge_queue.h) and decoded into gestures by TouchDecoder
+// (touch_decoder.h), so gesture timing no longer depends on how often this is called.
 class InputManager {
 public:
   InputManager();
 
+  // Configures the pin and attaches the CHANGE interrupt.
   void init();
   bool isTouched();
+
+  // Drains queued edges through the decoder and fires any gestures now due.
   void handleTouchInteraction();
 
+  // True when the interrupt has queued edges not yet handled (cheap; safe to call every loop()).
+  bool hasPendingEdges() const;
+
+  // When handleTouchInteraction() next has work (debounce, long press, tap window); idle → now + INPUT_IDLE_POLL_MS.
+  unsigned long nextDeadline(unsigned long now) const;
+
   unsigned long getLastInteraction() const { return lastInteraction; }
   void updateLastInteraction(unsigned long time) { lastInteraction = time; }
 
@@ -35,13 +38,9 @@ public:
 private:
   unsigned long lastInteraction;
   GestureHandlerFn onGesture_;
+  TouchDecoder decoder_;
 
-  unsigned long touchStartTime_;
-  unsigned long lastTapTime_;
-  unsigned long pendingTapTime_;
-  bool touchActive_;
-  bool longPressFired_;
-  bool pendingTap_;
+  static void emitGesture(TouchGesture gesture, uint32_t us, void* ctx);
 };
 
 extern InputManager inputManager;
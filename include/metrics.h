@@ -0,0 +1,95 @@
+// Metrics — fixed-memory timing histograms for the hot paths.
+// Each (section, emotion) pair owns a log-scale histogram of durations plus
+// exact min/max/sum, so draw and flush cost can be compared per emotion and
+// against its frameDelay budget. Durations come from the CPU cycle counter
+// and are stored in microseconds. Nothing allocates; the whole table is static.
+
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "emotion.h"
+#include "emotion_registry.h"
+
+enum MetricSection {
+  METRIC_DRAW,         // frame source / DrawFrameFn into the framebuffer
+  METRIC_FLUSH,        // canvas.flush() (handoff or I2C send)
+  METRIC_FRAME,        // draw + flush — compared against the emotion's frameDelay
+  METRIC_PERSONALITY,  // Personality::update()
+  METRIC_HTTP,         // one web request handler
+  METRIC_SECTION_COUNT
+};
+
+struct MetricSummary {
+  uint32_t count;
+  uint32_t minUs;
+  uint32_t avgUs;
+  uint32_t p99Us;  // upper edge of the bucket holding the 99th percentile, capped at maxUs
+  uint32_t maxUs;
+};
+
+// Raw cycle counter; subtract two readings (wraps safely) and pass to Metrics::cyclesToUs().
+#ifdef NATIVE_BUILD
+inline uint32_t metricsCycles() { return (uint32_t)(millis() * 1000UL * METRICS_CPU_MHZ); }
+#else
+inline uint32_t metricsCycles() { return ESP.getCycleCount(); }
+#endif
+
+class Metrics {
+public:
+  // Buckets: 0-3 are linear (8us wide), then two per power of two; the last is open-ended (>= ~24.6ms).
+  static const int BUCKETS = 24;
+
+  Metrics();
+
+  void record(MetricSection section, EmotionState emotion, uint32_t us);
+  MetricSummary summary(MetricSection section, EmotionState emotion) const;
+
+  // Frames whose draw + flush took longer than the emotion's frameDelay.
+  uint32_t overBudget(EmotionState emotion) const;
+
+  void reset();
+
+  // Writes one emotion's metrics as a JSON object. Returns bytes written, 0 if it has no samples.
+  size_t writeEmotionJson(EmotionState emotion, char* buf, size_t cap) const;
+
+  // Prints one line per emotion with samples.
+  void dump() const;
+
+  static uint32_t cyclesToUs(uint32_t cycles) { return cycles / METRICS_CPU_MHZ; }
+  static int bucketFor(uint32_t us);
+  static uint32_t bucketUpperUs(int bucket);
+
+private:
+  struct Cell {
+    uint16_t buckets[BUCKETS];  // halved together when one saturates, keeping the shape
+    uint32_t count;
+    uint32_t minUs;
+    uint32_t maxUs;
+    uint64_t sumUs;
+  };
+
+  Cell cells_[METRIC_SECTION_COUNT][EmotionRegistry::MAX_EMOTIONS];
+  uint32_t overBudget_[EmotionRegistry::MAX_EMOTIONS];
+};
+
+// Times its own lifetime into one (section, emotion) cell.
+class MetricTimer {
+public:
+  MetricTimer(MetricSection section, EmotionState emotion)
+    : section_(section), emotion_(emotion), start_(metricsCycles()) {}
+  ~MetricTimer();
+
+  // Microseconds since construction.
+  uint32_t elapsedUs() const { return Metrics::cyclesToUs(metricsCycles() - start_); }
+
+private:
+  MetricSection section_;
+  EmotionState emotion_;
+  uint32_t start_;
+};
+
+extern Metrics metrics;
+
+#endif // METRICS_H
@@ -0,0 +1,51 @@
+// OLED mirror — streams the 1 KB SSD1306 framebuffer to the web UI as page deltas.
+// Each message carries only the 128-byte pages that changed since the frame the
+// client last received, each coded with the frame codec's XOR-delta/RLE:
+//
+//   [CTRL_FRAME][seq LE16][flags][pageMask] then, per set bit (page 0 first),
+//   [n][n bytes of XOR-delta/RLE for that page]
+//
+// flags & MIRROR_FLAG_KEY means "clear your copy first" (the first frame of a
+// subscription), so a client can never apply deltas to a stale buffer.
+
+#ifndef OLED_MIRROR_H
+#define OLED_MIRROR_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "config.h"
+#include "frame_codec.h"
+
+#define MIRROR_FLAG_KEY   0x01
+#define MIRROR_PAGES      (SCREEN_HEIGHT / 8)
+#define MIRROR_PAGE_BYTES SCREEN_WIDTH
+#define MIRROR_FRAME_BYTES (MIRROR_PAGES * MIRROR_PAGE_BYTES)
+#define MIRROR_HEAD_BYTES 5
+// Header plus every page changed in every byte — the largest message encode() writes.
+// Per page: length byte + frameDeltaBound(128) = 1 + 129.
+#define MIRROR_MSG_MAX    (MIRROR_HEAD_BYTES + MIRROR_PAGES * (1 + MIRROR_PAGE_BYTES + 1))
+
+class MirrorEncoder {
+public:
+  MirrorEncoder();
+
+  // Forgets what the client holds; the next encode() is a keyframe.
+  void reset();
+
+  // Encodes frame against the client's copy into out and updates that copy.
+  // Returns the message length, or 0 when nothing changed (or cap < MIRROR_MSG_MAX).
+  size_t encode(const uint8_t* frame, uint8_t* out, size_t cap);
+
+  uint16_t getSeq() const { return seq_; }
+
+private:
+  uint8_t shadow_[MIRROR_FRAME_BYTES];  // what the client's canvas shows
+  bool key_;
+  uint16_t seq_;
+};
+
+// Applies one mirror message to buf (MIRROR_FRAME_BYTES). Returns false if it is malformed.
+// The device never decodes; this is the reference for the web UI and the tests.
+bool applyMirrorMessage(const uint8_t* msg, size_t len, uint8_t* buf);
+
+#endif // OLED_MIRROR_H
@@ -3,6 +3,9 @@
 
 #include <Arduino.h>
 #include "emotion.h"
+#include "prng.h"
+#include "alias_table.h"
+#include "runtime_config.h"
 
 // Optional real-time hour provider (0–23). If not set, millis()-based fallback is used.
 typedef int (*TimeProviderFn)();
@@ -32,9 +35,13 @@ public:
   // Returns true if currently in forgiveness period (deep neglect, needs more touches)
   bool isForgiving() const { return touchesToForgive_ > 0; }
 
-  // Inject a real-time hour provider (e.g. NTP-backed). Falls back to millis() if null.
+  // Inject a real-time hour provider (e.g. clockService). Falls back to millis() if null.
+  // Called on every tick, so it must not block.
   void setTimeProvider(TimeProviderFn fn) { timeProvider_ = fn; }
 
+  // Reseeds this instance's random stream; the same seed replays the same drifts.
+  void seed(uint32_t s) { rng_.setSeed(s); }
+
   // For testing: inspect internal state
   int getAttentionStage() const { return attentionStage_; }
   unsigned long getLastTouchTime() const { return lastTouchTime_; }
@@ -60,6 +67,18 @@ private:
   // NTP time provider
   TimeProviderFn timeProvider_;
 
+  // Per-instance random stream (jitter, drift picks, micro-expressions)
+  Prng rng_;
+
+  // runtimeConfig.driftWeights compiled for O(1) sampling; rebuilt when the config generation moves
+  AliasTable driftTables_[DRIFT_TABLE_COUNT];
+  uint32_t driftGeneration_;
+
+  // Markov mode: every matrix row compiled for one (hour band, warm) context at a time;
+  // rebuilt only when the context or the config changes, so a drift is one O(1) sample
+  AliasTable markovRows_[DRIFT_EMOTIONS];
+  int markovContext_;                  // band * 2 + warm, or -1 when stale
+
   // Warmth arc — sustained positive bias after frequent interaction
   unsigned long warmthWindowStart_;
   int touchCountRecent_;
@@ -85,9 +104,13 @@ private:
   EmotionState moodDriftGravity(unsigned long currentTime, EmotionState currentEmotion);
   EmotionState clusterDrift(MoodCluster cluster);
   EmotionState randomEmotionExcluding(EmotionState excluded);
+  EmotionState sampleDrift(DriftTable table);
+  EmotionState markovDrift(unsigned long currentTime, EmotionState currentEmotion, bool warm);
+  void buildMarkovRows(int band, bool warm);
+  void refreshDriftTables();
   int getTimeOfDayHour(unsigned long currentTime) const;
   Decision attentionArc(unsigned long currentTime, EmotionState current);
-  Decision nightCycle(unsigned long currentTime, EmotionState current);
+  Decision nightCycle(unsigned long currentTime, EmotionState current, int hour);
   bool shouldMicroExpress();
 
   unsigned long stageBaseThreshold(int stage);
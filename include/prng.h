@@ -0,0 +1,64 @@
+// Prng — small seedable xorshift32 generator for the personality hot path.
+// Each owner (a Personality, a simulated robot) holds its own instance, so host
+// tools can run many in parallel and replay a run from its seed. below() uses
+// Lemire's multiply-shift with rejection: unbiased, and on the ESP32-C3 a single
+// mulhu instead of the divide behind random()'s modulo.
+
+#ifndef PRNG_H
+#define PRNG_H
+
+#include <stdint.h>
+
+class Prng {
+public:
+  explicit Prng(uint32_t seed = 1) { setSeed(seed); }
+
+  // Restarts the stream; any seed (including 0) maps to a valid non-zero state.
+  void setSeed(uint32_t seed) {
+    // splitmix32-style finalizer so nearby seeds give unrelated streams
+    uint32_t z = seed + 0x9E3779B9u;
+    z = (z ^ (z >> 16)) * 0x85EBCA6Bu;
+    z = (z ^ (z >> 13)) * 0xC2B2AE35u;
+    z ^= z >> 16;
+    state_ = z ? z : 0x6D2B79F5u;
+  }
+
+  // Next raw 32-bit value.
+  uint32_t next() {
+    uint32_t x = state_;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return state_ = x;
+  }
+
+  // Uniform value in [0, bound); 0 when bound is 0.
+  uint32_t below(uint32_t bound) {
+    uint64_t m = (uint64_t)next() * bound;
+    uint32_t low = (uint32_t)m;
+    if (low < bound) {
+      uint32_t threshold = (0u - bound) % bound;
+      while (low < threshold) {
+        m = (uint64_t)next() * bound;
+        low = (uint32_t)m;
+      }
+    }
+    return (uint32_t)(m >> 32);
+  }
+
+  // Uniform value in [min, max), same contract as Arduino random(min, max).
+  long range(long min, long max) {
+    if (min >= max) return min;
+    return min + (long)below((uint32_t)(max - min));
+  }
+
+  // True with the given percent chance (0–100).
+  bool chance(int percent) { return (int)below(100) < percent; }
+
+  uint32_t state() const { return state_; }
+
+private:
+  uint32_t state_;
+};
+
+#endif
@@ -1,9 +1,39 @@
 #ifndef RUNTIME_CONFIG_H
 #define RUNTIME_CONFIG_H
 
+#include <stddef.h>
 #include <stdint.h>
 #include "config.h"
 
+// Drift distributions Personality samples from, one weight row each. Wire-stable: append only.
+// The four time-of-day bands come first and the cluster rows follow in MoodCluster order.
+enum DriftTable : uint8_t {
+  DRIFT_NIGHT = 0,      // hours 0–5
+  DRIFT_MORNING,        // hours 6–11
+  DRIFT_AFTERNOON,      // hours 12–17
+  DRIFT_EVENING,        // hours 18–23
+  DRIFT_POSITIVE,       // mood gravity, CLUSTER_POSITIVE
+  DRIFT_NEUTRAL,        // mood gravity, CLUSTER_NEUTRAL
+  DRIFT_NEGATIVE,       // mood gravity, CLUSTER_NEGATIVE
+  DRIFT_GLOW,           // post-touch glow
+  DRIFT_WARMED,         // warmth arc
+  DRIFT_TABLE_COUNT
+};
+
+static const int DRIFT_EMOTIONS = 18;  // weights per row: EmotionState IDLE..BLINK
+
+// Column multipliers for Markov drift. The hour bands share DriftTable's numbering. Wire-stable: append only.
+enum MarkovBias : uint8_t {
+  MARKOV_BIAS_NIGHT = 0,
+  MARKOV_BIAS_MORNING,
+  MARKOV_BIAS_AFTERNOON,
+  MARKOV_BIAS_EVENING,
+  MARKOV_BIAS_WARM,     // while post-touch glow or the warmth arc is active
+  MARKOV_BIAS_COUNT
+};
+
+static const uint8_t MARKOV_BIAS_UNITY = 100;  // multiplier value meaning ×1.0
+
 // Runtime-editable settings, persisted to NVS.
 // Defaults mirror the compile-time constants in config.h.
 struct RuntimeConfig {
@@ -16,6 +46,10 @@ struct RuntimeConfig {
   unsigned long moodDriftIntervalMs;  // base interval between mood drift checks
   uint8_t microExpressionChance;      // % chance of BLINK per drift check
   uint8_t jitterPercent;              // ±% variance applied to all timers
+  uint8_t driftWeights[DRIFT_TABLE_COUNT][DRIFT_EMOTIONS];  // relative weight per emotion
+  bool markovDrift;                   // drift from markovMatrix instead of gravity / glow / warmth pools
+  uint8_t markovMatrix[DRIFT_EMOTIONS][DRIFT_EMOTIONS];     // [current][next] transition weight
+  uint8_t markovBias[MARKOV_BIAS_COUNT][DRIFT_EMOTIONS];    // per-next-emotion multiplier, 100 = ×1
   // Input
   unsigned long longPressMs;          // hold duration to trigger LONG_PRESS
   unsigned long doubleTapWindowMs;    // window after first tap to detect DOUBLE_TAP
@@ -29,8 +63,55 @@ struct RuntimeConfig {
 
 extern RuntimeConfig runtimeConfig;
 
+// Numeric fields addressable by id (BLE CONFIG command). Wire-stable: append only.
+enum ConfigField : uint8_t {
+  CFG_ATTENTION_STAGE0_MS = 0,
+  CFG_ATTENTION_STAGE1_MS,
+  CFG_ATTENTION_STAGE2_MS,
+  CFG_ATTENTION_STAGE3_MS,
+  CFG_ATTENTION_STAGE4_MS,
+  CFG_MOOD_DRIFT_INTERVAL_MS,
+  CFG_MICRO_EXPRESSION_CHANCE,
+  CFG_JITTER_PERCENT,
+  CFG_LONG_PRESS_MS,
+  CFG_DOUBLE_TAP_WINDOW_MS,
+  CFG_ENABLE_EMOTION_BEEP,
+  CFG_SPEAKER_VOLUME,
+  CFG_MARKOV_DRIFT,
+  CFG_FIELD_COUNT
+};
+
 void runtimeConfigLoad();   // Load from NVS; falls back to config.h defaults on first boot
 void runtimeConfigSave();   // Persist current values to NVS
 void runtimeConfigReset();  // Reset to config.h defaults and save
 
+// Sets one field in memory, clamped to the same ranges as POST /api/config. False for an unknown id.
+bool runtimeConfigSetField(uint8_t field, uint32_t value);
+
+// Current value of one field as runtimeConfigSetField() stored it (after clamping); 0 for an unknown id.
+uint32_t runtimeConfigGetField(uint8_t field);
+
+// Field name as used by /api/config (e.g. "jitterPercent"), or nullptr for an unknown id.
+const char* runtimeConfigFieldName(uint8_t field);
+
+// Field id for the first len chars of name, or -1 if no field has that name.
+int runtimeConfigFieldByName(const char* name, size_t len);
+
+// Drift table name as used by /api/config (e.g. "driftMorning"), or nullptr for an unknown id.
+const char* runtimeConfigDriftTableName(uint8_t table);
+
+// Markov bias row name as used by /api/markov (e.g. "biasWarm"), or nullptr for an unknown id.
+const char* runtimeConfigMarkovBiasName(uint8_t bias);
+
+// Parses "30,0,60,..." (EmotionState order, each ≤ 255, missing trailing values are fill) into
+// out[DRIFT_EMOTIONS]. False — out untouched — on junk, too many values or all zeros.
+bool runtimeConfigParseWeights(const char* text, uint8_t* out, uint8_t fill = 0);
+
+// Writes weights[DRIFT_EMOTIONS] as "30,0,60" with trailing fill values dropped; returns the length.
+size_t runtimeConfigFormatWeights(const uint8_t* weights, char* out, size_t cap, uint8_t fill = 0);
+
+// Bumped whenever the config is loaded, saved or reset, so consumers that compile
+// derived state from it (Personality's alias tables) know to rebuild.
+uint32_t runtimeConfigGeneration();
+
 #endif // RUNTIME_CONFIG_H
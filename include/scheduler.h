@@ -0,0 +1,50 @@
+// Scheduler — deadline-driven task runner for loop().
+// Replaces the fixed 50ms gate: each task runs, then reports the absolute
+// millis() time it next needs to run. loop() calls runDue() on every pass, so
+// a task with a 28ms deadline runs every 28ms instead of being rounded up.
+
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <Arduino.h>
+
+// Runs the task body and returns the absolute millis() time of its next deadline.
+typedef unsigned long (*TaskFn)(unsigned long now);
+
+struct ScheduledTask {
+  const char* name;
+  TaskFn fn;
+  unsigned long due;
+  uint32_t runs;
+};
+
+class Scheduler {
+public:
+  static const int MAX_TASKS = 8;
+
+  Scheduler();
+
+  // Registers a task due at firstDue. Returns its id, or -1 if the table is full.
+  int add(const char* name, TaskFn fn, unsigned long firstDue);
+
+  // Pulls a task's deadline forward to now (e.g. after new work was queued for it).
+  void wake(int id, unsigned long now);
+
+  // Runs every task whose deadline has passed, once each. Returns the number run.
+  int runDue(unsigned long now);
+
+  // Earliest pending deadline across all tasks.
+  unsigned long nextDeadline() const;
+
+  unsigned long getDue(int id) const;
+  uint32_t getRuns(int id) const;
+  int count() const { return count_; }
+
+private:
+  ScheduledTask tasks_[MAX_TASKS];
+  int count_;
+};
+
+extern Scheduler scheduler;
+
+#endif // SCHEDULER_H
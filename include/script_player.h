@@ -0,0 +1,46 @@
+// ScriptPlayer — plays a short scripted emotion sequence sent in one BLE write.
+// Each step shows an emotion and holds it for holdMs before the next one; the
+// command task calls tick() every COMMAND_TICK_MS and applies what it returns.
+// Starting a new script replaces the one in progress; any emotion requested after
+// it starts (BLE, web or touch) cancels the rest. Pure logic; tested natively.
+
+#ifndef SCRIPT_PLAYER_H
+#define SCRIPT_PLAYER_H
+
+#include <stdint.h>
+#include "config.h"
+
+struct ScriptStep {
+  uint8_t emotion;
+  uint16_t holdMs;
+};
+
+class ScriptPlayer {
+public:
+  static const int MAX_STEPS = SCRIPT_MAX_STEPS;
+
+  ScriptPlayer();
+
+  // Clears any script; steps appended after this form the new one.
+  void begin();
+
+  // Adds a step to the script being built. False once MAX_STEPS are queued.
+  bool append(uint8_t emotion, uint16_t holdMs);
+
+  void stop();
+  bool active() const { return count_ > 0; }
+
+  // Emotion to show now (the next step just came due), or -1.
+  int tick(unsigned long now);
+
+private:
+  ScriptStep steps_[MAX_STEPS];
+  int count_;
+  int next_;
+  bool started_;
+  unsigned long nextDue_;
+};
+
+extern ScriptPlayer scriptPlayer;
+
+#endif // SCRIPT_PLAYER_H
@@ -1,34 +1,32 @@
 #ifndef SPEAKER_H
 #define SPEAKER_H
 
+#include <atomic>
+#include <esp_timer.h>
 #include "config.h"
 #include "emotion.h"
+#include "tone_sequencer.h"
 
-// ===== BEEP TONE STRUCTURE =====
-struct BeepTone {
-  int frequency;
-  int duration;
-};
-
-// ===== NON-BLOCKING BEEP MANAGER =====
+// ===== TIMER-DRIVEN BEEP MANAGER =====
+// Tones are switched from an esp_timer callback armed for the exact end of each
+// tone (ToneSequencer keeps the absolute schedule), so patterns play as authored
+// regardless of how busy loop() is. Nothing needs to be polled from the loop.
 class BeepManager {
 public:
   BeepManager();
   void init();
-  void update();  // Call in main loop
   void queueEmotionBeep(EmotionState emotion);
-  bool isPlaying() const { return isActive; }
-  
+  bool isPlaying() const { return playing_.load(std::memory_order_acquire); }
+
 private:
-  void startBeep(const BeepTone* pattern, int patternLength);
-  void stopCurrentBeep();
-  
-  const BeepTone* currentPattern;
-  int patternLength;
-  int currentToneIndex;
-  unsigned long toneStartTime;
-  bool isActive;
-  bool isTonePlaying;
+  bool startBeep(const BeepTone* pattern, int patternLength);
+  void applyTone(int frequency);
+  void onToneEnd();
+  static void timerEntry(void* self);
+
+  ToneSequencer seq_;          // owned by the timer callback while playing_
+  esp_timer_handle_t timer_;
+  std::atomic<bool> playing_;  // set by startBeep(), cleared by the callback after the last tone
 };
 
 extern BeepManager beepManager;
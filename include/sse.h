@@ -0,0 +1,20 @@
+// Server-Sent Events framing — shared by /api/events and the native tests.
+// An event is "event: <name>\n" followed by one "data: " line per line of
+// payload and a blank line; a comment line (": ...") keeps idle streams alive.
+
+#ifndef SSE_H
+#define SSE_H
+
+#include <stddef.h>
+
+// Formats one event into out. Returns its length, or 0 if it does not fit in cap
+// (including the terminating NUL) — a partial event would corrupt the stream.
+size_t formatSseEvent(char* out, size_t cap, const char* event, const char* data);
+
+// Response head that opens an event stream on a raw client socket.
+extern const char SSE_RESPONSE_HEAD[];
+
+// Keep-alive comment, sent when a stream has been quiet for SSE_KEEPALIVE_MS.
+extern const char SSE_KEEPALIVE[];
+
+#endif // SSE_H
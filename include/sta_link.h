@@ -0,0 +1,62 @@
+// StaLink — background state machine for the optional home-WiFi (STA) link.
+// Replaces the blocking connect loop in WebServerManager::init(): each update()
+// looks at the link and clock once and returns at most one action for the
+// caller to perform (begin, disconnect, start NTP), so boot and loop() never
+// wait on the radio. A failed attempt backs off exponentially from
+// WIFI_STA_RETRY_MIN_MS to WIFI_STA_RETRY_MAX_MS; a dropped link retries at
+// the minimum. Pure logic (no WiFi calls), so it is tested natively.
+
+#ifndef STA_LINK_H
+#define STA_LINK_H
+
+#include <stdint.h>
+#include "config.h"
+
+enum StaState : uint8_t {
+  STA_OFF,          // no credentials
+  STA_BACKOFF,      // waiting until retryAt before the next attempt
+  STA_CONNECTING,   // begin() issued; waiting for an IP up to WIFI_STA_TIMEOUT_MS
+  STA_WAIT_NTP,     // link up, NTP started; waiting for the clock to be set
+  STA_SYNCED        // link up and clock set
+};
+
+enum StaAction : uint8_t {
+  STA_ACT_NONE,
+  STA_ACT_BEGIN,        // WiFi.begin(ssid, pass) in AP+STA mode
+  STA_ACT_DISCONNECT,   // abandon the attempt / dead link
+  STA_ACT_START_NTP     // configTime(...)
+};
+
+class StaLink {
+public:
+  StaLink();
+
+  // Credentials are available (boot or new ones saved): attempt immediately.
+  void start(unsigned long now);
+  void stop();
+
+  // Advances on the current link/clock status; returns the action to perform now.
+  StaAction update(unsigned long now, bool linkUp, bool timeSet);
+
+  StaState state() const { return state_; }
+  // True once the clock has been set since start() — survives a later link drop.
+  bool synced() const { return synced_; }
+  uint16_t attempts() const { return attempts_; }     // failed attempts since the last success
+  unsigned long retryAt() const { return retryAt_; }
+  unsigned long linkUpAt() const { return linkUpAt_; } // when the link last came up (0 = never)
+
+  // Delay before retry number n (1-based) after n consecutive failures.
+  static unsigned long backoffMs(uint16_t failures);
+
+  static const char* stateName(StaState s);
+
+private:
+  StaState state_;
+  bool synced_;
+  uint16_t attempts_;
+  unsigned long deadline_;
+  unsigned long retryAt_;
+  unsigned long linkUpAt_;
+};
+
+#endif // STA_LINK_H
@@ -0,0 +1,47 @@
+// ToneSequencer — schedule for one beep pattern on an absolute microsecond timeline.
+// Each tone's end is the pattern start plus the sum of authored durations, so a
+// timer callback that runs late shortens the next tone instead of pushing every
+// later one back: a pattern always lasts exactly as long as it was written.
+// BeepManager drives it from an esp_timer; pure logic, tested natively.
+
+#ifndef TONE_SEQUENCER_H
+#define TONE_SEQUENCER_H
+
+#include <stdint.h>
+
+// ===== BEEP TONE STRUCTURE =====
+struct BeepTone {
+  int frequency;   // Hz, 0 = silence
+  int duration;    // ms
+};
+
+class ToneSequencer {
+public:
+  ToneSequencer();
+
+  // Starts pattern at nowUs with its first tone current. False (and idle) for an empty pattern.
+  bool start(const BeepTone* pattern, int length, uint64_t nowUs);
+
+  // Moves to the next tone. False once the last tone has ended (the sequencer is then idle).
+  bool advance();
+
+  void stop();
+  bool active() const { return pattern_ != nullptr; }
+
+  // Current tone's frequency (0 = silence) and absolute end time.
+  int frequency() const { return active() ? pattern_[index_].frequency : 0; }
+  uint64_t toneEndUs() const { return toneEndUs_; }
+
+  // Time from nowUs until the current tone ends; 0 when already past it.
+  uint64_t delayUs(uint64_t nowUs) const { return toneEndUs_ > nowUs ? toneEndUs_ - nowUs : 0; }
+
+  int index() const { return index_; }
+
+private:
+  const BeepTone* pattern_;
+  int length_;
+  int index_;
+  uint64_t toneEndUs_;
+};
+
+#endif // TONE_SEQUENCER_H
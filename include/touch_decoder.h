@@ -0,0 +1,71 @@
+// TouchDecoder — turns debounced touch edges into TAP / LONG_PRESS / DOUBLE_TAP.
+// Fed from EdgeQueue with microsecond edge timestamps, so press length and the
+// gap between taps are measured exactly instead of in control-tick steps. An
+// edge is only committed once the pin has held its new level for
+// TOUCH_DEBOUNCE_US; a glitch that flips back sooner cancels it. Commits use
+// the first edge's timestamp, so debouncing adds no timing error. Thresholds
+// come from runtimeConfig via classifyGesture(). Pure logic; tested natively.
+
+#ifndef TOUCH_DECODER_H
+#define TOUCH_DECODER_H
+
+#include <stdint.h>
+
+// Gesture types detected by InputManager
+enum TouchGesture {
+  GESTURE_NONE,
+  GESTURE_TAP,
+  GESTURE_LONG_PRESS,
+  GESTURE_DOUBLE_TAP
+};
+
+// Testable gesture classification (exposed for unit testing)
+TouchGesture classifyGesture(unsigned long pressDuration, unsigned long sincePrevTap);
+
+class TouchDecoder {
+public:
+  // gesture + the microsecond time it was recognised.
+  typedef void (*EmitFn)(TouchGesture gesture, uint32_t us, void* ctx);
+
+  TouchDecoder();
+
+  void setEmit(EmitFn fn, void* ctx) { emit_ = fn; ctx_ = ctx; }
+
+  // Starts from a known level (no edge pending, no tap pending).
+  void reset(bool touched);
+
+  // One raw edge from the queue (level LOW = touched).
+  void onEdge(uint32_t us, uint8_t level);
+
+  // Commits a settled edge and fires time-based gestures (long press, tap window expiry).
+  void poll(uint32_t nowUs);
+
+  // Earliest time poll() has something to do, or false when idle.
+  bool nextDeadline(uint32_t& us) const;
+
+  bool isTouched() const { return touched_; }
+  uint32_t getBounces() const { return bounces_; }
+
+private:
+  EmitFn emit_;
+  void* ctx_;
+
+  bool touched_;            // debounced level
+  bool candidate_;          // an edge is waiting to settle
+  bool candidateTouched_;
+  uint32_t candidateUs_;
+
+  uint32_t pressUs_;
+  bool longPressFired_;
+  bool pendingTap_;
+  uint32_t pendingTapUs_;
+  bool swallowRelease_;     // release ends a double tap or a press already held at reset
+  uint32_t bounces_;
+
+  void advance(uint32_t us);
+  void expire(uint32_t us);
+  void commit(bool touched, uint32_t us);
+  void fire(TouchGesture g, uint32_t us);
+};
+
+#endif // TOUCH_DECODER_H
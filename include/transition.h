@@ -0,0 +1,60 @@
+// TransitionPlayer — time-driven pacing for the 7-frame blink transition.
+// DisplayManager::performTransitionFrame() used to delay() 100–200ms after each
+// frame, freezing loop() (web, touch, beeps) for ~1s per emotion change.
+// Frames now only draw; this player decides when the next one is due, so every
+// call returns immediately and the scheduler sleeps the render task until then.
+
+#ifndef TRANSITION_H
+#define TRANSITION_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "emotion.h"
+
+// Returned by a transition draw function to say whether it drew the final frame
+enum TransitionResult {
+  TR_DREW_FRAME,  // Frame rendered, caller should advanceTransition()
+  TR_COMPLETE      // Final frame rendered, caller should completeTransition()
+};
+
+// What the caller should do with EmotionManager after TransitionPlayer::update()
+enum TransitionStep {
+  TS_WAITING,   // Current frame is still holding — nothing drawn
+  TS_ADVANCE,   // A frame was drawn — call advanceTransition()
+  TS_COMPLETE   // Final frame's hold elapsed — call completeTransition()
+};
+
+// Draws one transition frame (no waiting); set by main.cpp to DisplayManager.
+typedef TransitionResult (*TransitionDrawFn)(int frame, EmotionState current,
+                                             EmotionState target);
+
+class TransitionPlayer {
+public:
+  static const int FRAME_COUNT = 7;
+
+  TransitionPlayer();
+
+  void setDrawFn(TransitionDrawFn fn) { drawFn_ = fn; }
+
+  // Non-blocking: draws the given frame if the previous one's hold has elapsed.
+  TransitionStep update(int frame, EmotionState current, EmotionState target,
+                        unsigned long now);
+
+  // Absolute millis() time the next transition step is due.
+  unsigned long nextDeadline() const { return due_; }
+
+  void reset();
+
+  // How long a transition frame stays on screen (ms).
+  static unsigned long frameHoldMs(int frame);
+
+private:
+  TransitionDrawFn drawFn_;
+  unsigned long due_;
+  int lastFrame_;     // frame index last drawn (-1 = none yet)
+  bool finalDrawn_;   // last drawn frame was the final one
+};
+
+extern TransitionPlayer transitionPlayer;
+
+#endif // TRANSITION_H
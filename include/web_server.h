@@ -9,7 +9,12 @@
 
 #include <Arduino.h>
 #include <functional>
-#include <WebServer.h>
+#include <WiFi.h>
+#include "http_server.h"
+#include "ws_frame.h"
+#include "control_proto.h"
+#include "oled_mirror.h"
+#include "sta_link.h"
 #include "emotion.h"
 #include "emotion_registry.h"
 #include "input.h"
@@ -22,6 +27,8 @@ class WebServerManager {
 public:
   using EmotionSetFn = std::function<void(EmotionState)>;
   using GestureFn    = std::function<void(TouchGesture)>;
+  using FrameSourceFn = std::function<const uint8_t*()>;
+  using TimeSyncedFn  = std::function<void()>;
 
   WebServerManager();
 
@@ -33,6 +40,10 @@ public:
 
   void setOnEmotionSet(EmotionSetFn fn) { onEmotionSet_ = fn; }
   void setOnGesture(GestureFn fn)       { onGesture_    = fn; }
+  // Last complete OLED frame (SSD1306 page layout) for the /ws mirror.
+  void setFrameSource(FrameSourceFn fn) { frameSource_ = fn; }
+  // Fired once when NTP first sets the clock after (re)connecting.
+  void setOnTimeSynced(TimeSyncedFn fn) { onTimeSynced_ = fn; }
 
   // Set module references before calling init().
   void setEmotionManager(EmotionManager* em) { em_  = em; }
@@ -41,10 +52,13 @@ public:
   void setRuntimeConfig(RuntimeConfig* cfg)  { cfg_ = cfg; }
   void setPersonality(Personality* p)        { p_   = p; }
 
-  bool isNtpSynced() const { return ntpSynced_; }
+  bool isNtpSynced() const { return sta_.synced(); }
+
+  // Pushes the new emotion to every /api/events subscriber and /ws socket (wired to onEmotionChange).
+  void pushEmotion(EmotionState emotion);
 
 private:
-  WebServer server_;
+  HttpServer server_;
 
   EmotionManager* em_;
   BatteryManager* bm_;
@@ -54,6 +68,8 @@ private:
 
   EmotionSetFn onEmotionSet_;
   GestureFn    onGesture_;
+  FrameSourceFn frameSource_;
+  TimeSyncedFn  onTimeSynced_;
 
   // Route handlers — registered in init().
   void handleRoot();
@@ -63,17 +79,58 @@ private:
   void handleApiConfigGet();
   void handleApiConfigPost();
   void handleApiConfigReset();
+  void handleApiMarkovGet();
+  void handleApiMarkovPost();
   void handleApiWifiGet();
   void handleApiWifiPost();
+  void handleApiMetrics();
+  void handleApiEvents();
+  void handleWebSocket();
   void handleNotFound();
 
-  // Attempt STA connection + NTP; blocks up to WIFI_STA_TIMEOUT_MS (call from init() only).
-  void connectStaBlocking(const char* ssid, const char* pass);
+  // Calls a route handler and records its duration under METRIC_HTTP.
+  void timed(void (WebServerManager::*handler)());
+
+  // Server-Sent Events: open streams, and when each kind of event last went out
+  WiFiClient sseClients_[SSE_MAX_CLIENTS];
+  unsigned long sseLastStatus_;
+  unsigned long sseLastWrite_;
+  int lastAttentionStage_;
+
+  // Writes one event to every open stream; closed streams free their slot.
+  void broadcast(const char* event, const char* data);
+  int sseClientCount();
+  void serviceEventStreams(unsigned long now);
+  void formatStatusJson(char* buf, size_t cap);
+
+  // WebSocket control channel: upgraded sockets and their frame parsers
+  struct WsClient {
+    WiFiClient client;
+    WsFrameParser parser;
+    bool mirrorOn;          // subscribed to the OLED mirror
+    bool mirrorCredit;      // client is ready for its next frame
+    MirrorEncoder mirror;   // what this client's canvas shows
+  };
+  WsClient wsClients_[WS_MAX_CLIENTS];
+  unsigned long mirrorLast_;
+  uint8_t mirrorMsg_[MIRROR_MSG_MAX];
+  uint8_t wsTx_[MIRROR_MSG_MAX + 4];   // framed outgoing message
+
+  void serviceWebSockets(unsigned long now);
+  void serviceMirror(unsigned long now);
+  void handleWsFrame(WsClient& ws);
+  void handleControlCommand(WsClient& ws, const uint8_t* data, size_t len);
+  void sendWs(WsClient& ws, WsOpcode opcode, const uint8_t* payload, size_t len);
+  void closeWs(WsClient& ws, uint16_t code);
+  void sendControlState(WsClient& ws, EmotionState emotion);
+
+  // Optional home-WiFi link for NTP: StaLink decides, serviceStaLink() performs its actions.
+  StaLink sta_;
+  volatile bool staLinkUp_;   // set from WiFi events (GOT_IP / DISCONNECTED)
+  void serviceStaLink(unsigned long now);
 
   // Log free heap to Serial with a context label.
   void logHeap(const char* ctx);
-
-  bool ntpSynced_;
 };
 
 extern WebServerManager webServerManager;
@@ -2,7 +2,8 @@
 #define WEB_UI_H
 
 // Full SANGI control page stored in ESP32 flash (PROGMEM).
-// Served via send_P() — zero RAM copy.
+// Browsers get the gzip'd copy in web_ui_gz.h; this plain copy is the fallback for
+// clients without gzip. After editing, run tools/gzip_web_ui.py (firmware builds do it).
 
 #include <pgmspace.h>
 
@@ -60,6 +61,7 @@ summary::-webkit-details-marker{display:none}
 .wd{width:8px;height:8px;border-radius:50%;background:var(--ov);flex-shrink:0}
 .wd.on{background:#4caf50;box-shadow:0 0 6px #4caf5088}
 .wd.ntp{background:var(--p);box-shadow:0 0 6px rgba(0,212,232,.5)}
+#oled{display:block;width:100%;image-rendering:pixelated;background:#000;border-radius:8px;margin-top:10px}
 </style>
 </head>
 <body>
@@ -96,6 +98,11 @@ summary::-webkit-details-marker{display:none}
     <button class="gb" onclick="sg('double')">Double Tap</button>
   </div>
 </div>
+<div class="card">
+  <div class="sl">Screen</div>
+  <button class="tgl" id="mt" onclick="toggleMirror()">Live mirror</button>
+  <canvas id="oled" width="128" height="64" hidden></canvas>
+</div>
 <details>
 <summary>WiFi / NTP</summary>
 <div class="cb">
@@ -175,26 +182,93 @@ EMOS.forEach(function(n,i){
   eg.appendChild(b);
 });
 
+function showEmotion(id,name){
+  cur=id;
+  document.getElementById('se').textContent=name;
+  document.querySelectorAll('.eb').forEach(function(b,i){b.classList.toggle('on',i===cur);});
+}
+function showStage(s){for(var i=0;i<5;i++){document.getElementById('a'+i).classList.toggle('on',i===s);}}
+function applyStatus(d){
+  var pct=Math.max(0,Math.min(100,Math.round((d.batteryVoltage-3.0)/1.2*100)));
+  showEmotion(d.emotion,d.emotionName);
+  document.getElementById('sb').textContent=d.batteryVoltage.toFixed(2)+'V ('+pct+'%)';
+  document.getElementById('su').textContent=fmtUp(d.uptimeMs);
+  document.getElementById('sh').textContent=d.freeHeap+'B free';
+  showStage(d.attentionStage);
+}
 function pollStatus(){
-  fetch('/api/status').then(function(r){return r.json();}).then(function(d){
-    cur=d.emotion;
-    var pct=Math.max(0,Math.min(100,Math.round((d.batteryVoltage-3.0)/1.2*100)));
-    document.getElementById('se').textContent=d.emotionName;
-    document.getElementById('sb').textContent=d.batteryVoltage.toFixed(2)+'V ('+pct+'%)';
-    document.getElementById('su').textContent=fmtUp(d.uptimeMs);
-    document.getElementById('sh').textContent=d.freeHeap+'B free';
-    document.querySelectorAll('.eb').forEach(function(b,i){b.classList.toggle('on',i===cur);});
-    for(var i=0;i<5;i++){document.getElementById('a'+i).classList.toggle('on',i===d.attentionStage);}
-  }).catch(function(){});
+  fetch('/api/status').then(function(r){return r.json();}).then(applyStatus).catch(function(){});
+}
+
+// Live updates: the device pushes changes over /api/events; poll only while the stream is down
+var poller=null;
+function startPolling(){if(!poller){pollStatus();poller=setInterval(pollStatus,3000);}}
+function startEvents(){
+  if(!window.EventSource){startPolling();return;}
+  var es=new EventSource('/api/events');
+  es.addEventListener('status',function(e){applyStatus(JSON.parse(e.data));});
+  es.addEventListener('emotion',function(e){var d=JSON.parse(e.data);showEmotion(d.emotion,d.emotionName);});
+  es.addEventListener('attention',function(e){showStage(JSON.parse(e.data).attentionStage);});
+  es.onopen=function(){if(poller){clearInterval(poller);poller=null;}};
+  es.onerror=startPolling;
+}
+
+// Control socket: binary [op,seq,arg] commands, [0x81,seq,op,status] acks, [0x82,...] state
+var ws=null,seq=0;
+function startControl(){
+  if(!window.WebSocket)return;
+  ws=new WebSocket('ws://'+location.host+'/ws');
+  ws.binaryType='arraybuffer';
+  ws.onmessage=function(e){
+    var d=new Uint8Array(e.data);
+    if(d[0]===0x82&&d.length>=9){showEmotion(d[1],EMOS[d[1]]||'?');showStage(d[2]);}
+    else if(d[0]===0x83)drawMirror(d);
+  };
+  ws.onopen=function(){if(mirrorOn)sendCmd(4,1);};
+  ws.onclose=function(){ws=null;setTimeout(startControl,2000);};
+}
+
+// OLED mirror: [0x83,seqLo,seqHi,flags,pageMask] then per changed page [n] + n bytes XOR-delta/RLE
+var mirrorOn=false,fb=new Uint8Array(1024),octx=null,oimg=null;
+function toggleMirror(){
+  mirrorOn=!mirrorOn;
+  document.getElementById('mt').classList.toggle('on',mirrorOn);
+  document.getElementById('oled').hidden=!mirrorOn;
+  sendCmd(4,mirrorOn?1:0);
+}
+function drawMirror(d){
+  if(d[3]&1)fb.fill(0);
+  var p=5;
+  for(var pg=0;pg<8;pg++){
+    if(!(d[4]&(1<<pg)))continue;
+    var end=p+1+d[p],o=pg*128;p++;
+    while(p<end){var c=d[p++];if(c<0x80){for(var k=0;k<=c;k++)fb[o++]^=d[p++];}else o+=c-0x7F;}
+  }
+  if(!octx){var cv=document.getElementById('oled');octx=cv.getContext('2d');oimg=octx.createImageData(128,64);}
+  var px=oimg.data;
+  for(var y=0;y<64;y++)for(var x=0;x<128;x++){
+    var v=(fb[(y>>3)*128+x]>>(y&7))&1?255:0,i=(y*128+x)*4;
+    px[i]=px[i+1]=px[i+2]=v;px[i+3]=255;
+  }
+  octx.putImageData(oimg,0,0);
+  // Ask for the next frame only once this one is on screen — the device never runs ahead of us
+  requestAnimationFrame(function(){if(mirrorOn)sendCmd(4,1);});
+}
+function sendCmd(op,arg){
+  if(!ws||ws.readyState!==1)return false;
+  seq=(seq+1)&255;
+  ws.send(new Uint8Array([op,seq,arg]));
+  return true;
 }
 
 function se(id){
-  fetch('/api/emotion',{method:'POST',body:new URLSearchParams({emotion:id})});
+  if(!sendCmd(1,id))fetch('/api/emotion',{method:'POST',body:new URLSearchParams({emotion:id})});
   cur=id;
   document.querySelectorAll('.eb').forEach(function(b,i){b.classList.toggle('on',i===id);});
 }
 
-function sg(g){fetch('/api/gesture',{method:'POST',body:new URLSearchParams({gesture:g})});}
+var GESTURES={tap:1,long:2,double:3};
+function sg(g){if(!sendCmd(2,GESTURES[g]))fetch('/api/gesture',{method:'POST',body:new URLSearchParams({gesture:g})});}
 
 function ul(k,unit){
   var v=parseInt(document.getElementById('r-'+k).value);
@@ -227,7 +301,7 @@ function loadConfig(){
 
 function saveConfig(){
   var params=new URLSearchParams();
-  Object.keys(cfg).forEach(function(k){params.append(k,String(cfg[k]));});
+  Object.keys(cfg).forEach(function(k){if(k.indexOf('drift')!==0)params.append(k,String(cfg[k]));});
   fetch('/api/config',{method:'POST',body:params}).then(function(){
     var m=document.getElementById('savemsg');
     m.textContent='Saved!';
@@ -273,8 +347,8 @@ function connectWifi(){
     }).catch(function(){m.textContent='Error';});
 }
 
-pollStatus();
-setInterval(pollStatus,3000);
+startEvents();
+startControl();
 loadConfig();
 loadWifi();
 </script>
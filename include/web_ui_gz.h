@@ -0,0 +1,340 @@
+// GENERATED by tools/gzip_web_ui.py from include/web_ui.h — do not edit.
+// 15668 B of HTML -> 5137 B gzip (32%).
+
+#ifndef WEB_UI_GZ_H
+#define WEB_UI_GZ_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <pgmspace.h>
+
+#define WEB_UI_GZ_SOURCE_HASH 0x31074d94u  // FNV-1a of WEB_UI_HTML this blob was built from
+#define WEB_UI_GZ_ETAG "\"967beede\""     // strong ETag: FNV-1a of the gzip bytes
+
+const size_t WEB_UI_GZ_LEN = 5137;
+const uint8_t WEB_UI_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xbd, 0x5b, 0xeb, 0x72, 0x9b, 0xc8,
+  0xb6, 0xfe, 0xef, 0xa7, 0x20, 0x4a, 0x4d, 0x80, 0x11, 0x92, 0x75, 0xb3, 0xe3, 0x80, 0x71, 0xca,
+  0x49, 0x94, 0xc4, 0xfb, 0x38, 0xb6, 0x2b, 0x72, 0x66, 0xf6, 0x94, 0xb7, 0x4e, 0x15, 0x82, 0x96,
+  0xc4, 0x88, 0xdb, 0xd0, 0xe8, 0xb6, 0x35, 0xae, 0xda, 0x0f, 0x71, 0x9e, 0xe6, 0x3c, 0xce, 0x7e,
+  0x92, 0xb3, 0x56, 0x77, 0x83, 0x00, 0x61, 0x45, 0xce, 0x9e, 0x3a, 0x4e, 0x8d, 0x80, 0xbe, 0xac,
+  0x5e, 0xd7, 0x6f, 0xad, 0x6e, 0x98, 0xf3, 0x17, 0x1f, 0x6e, 0xdf, 0xdf, 0xff, 0x76, 0xd7, 0x97,
+  0xa6, 0x89, 0xef, 0x5d, 0x1c, 0x9d, 0xe3, 0x45, 0xf2, 0xac, 0x60, 0x62, 0xd6, 0x48, 0x50, 0xc3,
+  0x06, 0x62, 0x39, 0x70, 0xf1, 0x49, 0x62, 0x49, 0xf6, 0xd4, 0x8a, 0x29, 0x49, 0xcc, 0xda, 0xb7,
+  0xfb, 0x8f, 0x8d, 0xb3, 0x5a, 0xda, 0x1c, 0x58, 0x3e, 0x31, 0x6b, 0x0b, 0x97, 0x2c, 0xa3, 0x30,
+  0x4e, 0x6a, 0x92, 0x1d, 0x06, 0x09, 0x09, 0x60, 0xd8, 0xd2, 0x75, 0x92, 0xa9, 0xe9, 0x90, 0x85,
+  0x6b, 0x93, 0x06, 0x7b, 0xd0, 0xdc, 0xc0, 0x4d, 0x5c, 0xcb, 0x6b, 0x50, 0xdb, 0xf2, 0x88, 0xd9,
+  0x46, 0x1a, 0x89, 0x9b, 0x78, 0xe4, 0x62, 0x70, 0x79, 0xf3, 0xe9, 0xea, 0xfc, 0x98, 0x3f, 0x1c,
+  0x9d, 0xd3, 0x64, 0x8d, 0x57, 0x3d, 0x0e, 0xc3, 0x64, 0xd3, 0x68, 0x44, 0xfa, 0xcb, 0x56, 0xeb,
+  0x43, 0xaf, 0x7f, 0x66, 0x34, 0x1a, 0x21, 0x7b, 0xe8, 0xbc, 0xee, 0xf4, 0xe1, 0x21, 0xb2, 0xf1,
+  0xa1, 0xd7, 0xee, 0x7d, 0x64, 0x3d, 0xf0, 0xf4, 0xe6, 0xf5, 0xc7, 0xd6, 0x47, 0x7c, 0x1a, 0x4d,
+  0xa0, 0xeb, 0xb2, 0xf5, 0xbe, 0x85, 0x0f, 0x74, 0xac, 0xbf, 0x6c, 0x77, 0xdb, 0xa7, 0x6d, 0xa4,
+  0x40, 0x61, 0x58, 0xfb, 0x7d, 0xa7, 0xd5, 0xe9, 0xb1, 0x87, 0xa9, 0xfe, 0xb2, 0x73, 0xd6, 0x79,
+  0xc7, 0xe8, 0x85, 0x54, 0x7f, 0xd9, 0xef, 0xc0, 0xbf, 0x53, 0xf6, 0xb0, 0xd0, 0x5f, 0x9e, 0xf5,
+  0xdf, 0xb4, 0xde, 0xbc, 0xc1, 0x27, 0x78, 0xe8, 0x75, 0x7b, 0x27, 0xbd, 0x37, 0x8f, 0x47, 0x3f,
+  0x6f, 0x46, 0xe1, 0xaa, 0x41, 0xdd, 0x7f, 0xba, 0xc1, 0x44, 0x1f, 0x85, 0xb1, 0x43, 0xe2, 0x06,
+  0xb4, 0x18, 0xbe, 0x15, 0x4f, 0xdc, 0x40, 0x6f, 0x19, 0x91, 0xe5, 0x38, 0xd8, 0xd7, 0x7a, 0x3c,
+  0x1a, 0x85, 0xce, 0x7a, 0x33, 0xb2, 0xec, 0xd9, 0x24, 0x0e, 0xe7, 0x81, 0xa3, 0x2f, 0xac, 0x58,
+  0x41, 0xee, 0x54, 0xc3, 0x0e, 0xbd, 0x30, 0x16, 0xcf, 0x21, 0x55, 0x8d, 0x31, 0x28, 0xae, 0x31,
+  0xb6, 0x7c, 0xd7, 0x5b, 0xeb, 0x74, 0x4d, 0x13, 0xe2, 0x37, 0xe6, 0xae, 0x46, 0xad, 0x80, 0x36,
+  0x28, 0x89, 0xdd, 0x31, 0x1f, 0x00, 0xab, 0x12, 0xbd, 0xdd, 0x8b, 0x56, 0xd9, 0x22, 0xed, 0xd3,
+  0x08, 0x97, 0x5e, 0x71, 0x1d, 0xeb, 0xbd, 0xb3, 0x56, 0x94, 0xb1, 0x62, 0xcd, 0x93, 0xf0, 0xf1,
+  0xa8, 0x39, 0x75, 0xe2, 0x8d, 0xe3, 0xd2, 0xc8, 0xb3, 0xd6, 0xfa, 0xd8, 0x23, 0x2b, 0xe3, 0xf7,
+  0x39, 0x4d, 0xdc, 0xf1, 0xba, 0x21, 0x8c, 0xa5, 0xd3, 0xc8, 0x02, 0x23, 0x8d, 0x48, 0xb2, 0x24,
+  0x24, 0x30, 0x2c, 0xcf, 0x9d, 0x04, 0x0d, 0x17, 0x38, 0xa0, 0xba, 0x0d, 0xdd, 0x24, 0x16, 0xf4,
+  0x40, 0xca, 0x24, 0x09, 0x7d, 0xbd, 0x03, 0x4b, 0x20, 0xd9, 0x64, 0xb3, 0xe5, 0xa9, 0x8b, 0xcb,
+  0xb2, 0xc7, 0x25, 0x71, 0x27, 0xd3, 0x44, 0x3f, 0x6b, 0xb5, 0x0a, 0x32, 0x46, 0xaa, 0x91, 0x90,
+  0x15, 0x8c, 0x9e, 0x5a, 0x4e, 0xb8, 0xd4, 0x5b, 0x52, 0x4b, 0xea, 0x80, 0x1c, 0x52, 0x3c, 0x19,
+  0x59, 0x4a, 0x4b, 0xeb, 0xb4, 0x3b, 0x5a, 0xa7, 0xdb, 0xd1, 0x9a, 0xaf, 0x55, 0x24, 0xed, 0xe6,
+  0x48, 0xb7, 0xdb, 0x40, 0xba, 0xa8, 0xae, 0x85, 0x6a, 0xec, 0x28, 0x95, 0xda, 0x6a, 0xa6, 0x14,
+  0x24, 0xdc, 0xee, 0xc0, 0x34, 0x61, 0x9e, 0xd8, 0x72, 0xdc, 0x39, 0x4d, 0x19, 0xb7, 0xad, 0xd8,
+  0xd1, 0x1c, 0xf0, 0x5e, 0xd7, 0xa3, 0xbb, 0xc6, 0xa1, 0x63, 0xb5, 0x62, 0x5a, 0x49, 0x05, 0xcc,
+  0x04, 0x7c, 0x94, 0x0e, 0xec, 0x49, 0x34, 0xf4, 0x5c, 0x47, 0x4a, 0x19, 0x99, 0x22, 0x85, 0x55,
+  0x41, 0xd4, 0x56, 0x85, 0xa8, 0xad, 0xd7, 0xaa, 0x06, 0x5d, 0xd0, 0x73, 0xb6, 0xed, 0xc5, 0x7f,
+  0xcd, 0x13, 0x55, 0xb0, 0xb9, 0xc9, 0x9b, 0x19, 0xda, 0xa8, 0x97, 0x57, 0x4c, 0x59, 0xe7, 0xaf,
+  0x41, 0xe7, 0x1e, 0x49, 0xc0, 0x62, 0x0d, 0x34, 0x29, 0xce, 0x6b, 0x9e, 0x95, 0x94, 0x97, 0xda,
+  0x21, 0x89, 0xc1, 0xb5, 0xc6, 0x61, 0xec, 0xeb, 0xf3, 0x28, 0x22, 0xb1, 0x6d, 0x51, 0x52, 0x96,
+  0x11, 0x15, 0x18, 0x22, 0x9d, 0x64, 0x0d, 0x74, 0x70, 0xf5, 0xff, 0xd4, 0x8f, 0x52, 0x69, 0x5e,
+  0x83, 0xbc, 0x2d, 0x23, 0x8b, 0x1d, 0xbe, 0x5c, 0x85, 0x1a, 0xd9, 0x9a, 0xba, 0x67, 0xd1, 0xa4,
+  0x61, 0x4f, 0x5d, 0xcf, 0xd9, 0x14, 0xa7, 0x04, 0x61, 0x40, 0x70, 0xc8, 0x4c, 0x6b, 0xd2, 0x45,
+  0x5e, 0x31, 0x5d, 0xae, 0xac, 0xd9, 0xa6, 0xec, 0x36, 0xd8, 0x2a, 0x46, 0x0a, 0x9d, 0x9d, 0x96,
+  0xfc, 0x14, 0x62, 0x11, 0x06, 0x59, 0xb1, 0x5d, 0x14, 0x75, 0x62, 0x45, 0xfa, 0x09, 0xa3, 0x6a,
+  0xd9, 0x1b, 0x6c, 0xd1, 0xdb, 0x99, 0x34, 0x6f, 0x80, 0x73, 0x58, 0x91, 0xeb, 0x95, 0x49, 0x9d,
+  0xca, 0xbb, 0x65, 0xe9, 0x4d, 0x85, 0xa9, 0x8a, 0x5e, 0x76, 0x82, 0xd6, 0xac, 0xf4, 0xea, 0x5d,
+  0xdf, 0xe7, 0x8e, 0xd7, 0xc9, 0x34, 0xc6, 0x8c, 0x19, 0x59, 0x31, 0xac, 0x6a, 0xb0, 0x7b, 0x00,
+  0xda, 0x30, 0xd0, 0x9b, 0x9d, 0x13, 0xca, 0x38, 0x6e, 0x86, 0xc1, 0xae, 0xa3, 0x47, 0x65, 0xd2,
+  0xd8, 0x20, 0x78, 0x2a, 0x79, 0x4c, 0xc9, 0x9b, 0xdb, 0x55, 0xde, 0xdc, 0x43, 0xbd, 0x91, 0x49,
+  0xa6, 0xb6, 0x49, 0xec, 0x3a, 0x06, 0xfe, 0x34, 0xc0, 0x03, 0xa0, 0x25, 0x21, 0x48, 0x75, 0xee,
+  0x07, 0x54, 0x8f, 0x49, 0x44, 0xac, 0x44, 0xe9, 0x69, 0xed, 0x71, 0xac, 0x32, 0xd5, 0x72, 0xef,
+  0x26, 0xa3, 0xad, 0xbf, 0xe3, 0x12, 0xbb, 0x11, 0xcc, 0x95, 0x24, 0xe2, 0xae, 0x79, 0x52, 0x72,
+  0x99, 0xf0, 0x29, 0x5c, 0xd8, 0x07, 0xb6, 0x6e, 0x30, 0x05, 0x7c, 0x4d, 0x8c, 0x12, 0xe0, 0xe4,
+  0x8d, 0x75, 0x82, 0x3e, 0x32, 0x8f, 0x29, 0xd0, 0x88, 0x42, 0x97, 0x59, 0xb6, 0xa0, 0x65, 0x6a,
+  0x70, 0xf0, 0x6d, 0xb7, 0x5a, 0x3f, 0x31, 0x31, 0xf4, 0x69, 0xb8, 0x20, 0x71, 0xb5, 0xca, 0xab,
+  0x35, 0x5c, 0x36, 0x04, 0x23, 0x53, 0x6d, 0xb6, 0xf2, 0xe0, 0x43, 0x8d, 0xd6, 0xa9, 0x30, 0x1a,
+  0x03, 0x9a, 0x49, 0xbc, 0xeb, 0xeb, 0x67, 0xcc, 0x20, 0x93, 0x51, 0xd9, 0xd7, 0x11, 0xf8, 0xa4,
+  0xd3, 0x67, 0xda, 0x85, 0x89, 0x7d, 0x90, 0xfb, 0x7d, 0xc7, 0x30, 0xdd, 0x8a, 0x28, 0xda, 0x6b,
+  0x18, 0x26, 0xc3, 0x93, 0xd6, 0xf8, 0x51, 0x4d, 0xf6, 0x9e, 0x70, 0x7f, 0x3a, 0xf7, 0x01, 0x42,
+  0xd7, 0x05, 0xd0, 0x2e, 0xf3, 0xb7, 0x47, 0x1a, 0x84, 0x22, 0xcf, 0x05, 0xac, 0x63, 0x05, 0x10,
+  0x43, 0x37, 0xa3, 0x60, 0x98, 0x0a, 0x44, 0x15, 0xb6, 0xda, 0x85, 0x30, 0xc1, 0x8b, 0xae, 0x8f,
+  0x08, 0xa0, 0x3c, 0xd9, 0xa4, 0x18, 0x2d, 0xff, 0xfb, 0x5f, 0xff, 0x2b, 0xe7, 0xb8, 0x60, 0xc9,
+  0xad, 0x28, 0x6f, 0x6e, 0x32, 0xb0, 0x36, 0x9a, 0xb9, 0x49, 0x43, 0x64, 0xcb, 0x06, 0xb4, 0xce,
+  0xc8, 0xd6, 0x5d, 0x04, 0x00, 0xdb, 0xdb, 0xb8, 0x05, 0xed, 0x9c, 0x62, 0xf2, 0x15, 0xe9, 0x8a,
+  0xd8, 0xcf, 0xcd, 0x57, 0xaf, 0x9f, 0x9d, 0xaf, 0x38, 0x56, 0xb4, 0x98, 0x57, 0x66, 0xe9, 0xea,
+  0x35, 0xac, 0x1e, 0x87, 0xcb, 0xcd, 0xa1, 0xfa, 0x4b, 0xf9, 0x47, 0xd7, 0x6d, 0xf1, 0xb9, 0x50,
+  0x0a, 0x8f, 0x88, 0xb7, 0x11, 0xa1, 0xdd, 0x3d, 0x4d, 0x99, 0xe7, 0xb2, 0x74, 0xaa, 0x8a, 0x12,
+  0x5c, 0x05, 0x3c, 0x25, 0x76, 0x83, 0x99, 0x9e, 0x52, 0x71, 0x83, 0x68, 0x9e, 0x3c, 0x24, 0xeb,
+  0x88, 0x98, 0x20, 0xc2, 0x84, 0x0c, 0xd3, 0x90, 0xb2, 0x6c, 0xe4, 0xa1, 0x51, 0xd6, 0x3d, 0x9b,
+  0x04, 0xea, 0x08, 0xc4, 0xca, 0xa7, 0xbd, 0xdd, 0x85, 0xcb, 0x5e, 0x93, 0xcb, 0x3c, 0x31, 0x36,
+  0x56, 0x64, 0xb4, 0x64, 0xe2, 0x6d, 0xf2, 0x42, 0xe6, 0x2a, 0x98, 0x42, 0x10, 0x7f, 0x27, 0x02,
+  0x3b, 0xdf, 0x8f, 0xc0, 0x67, 0xe5, 0xb0, 0x6a, 0x10, 0xdf, 0x09, 0x62, 0xe0, 0xfe, 0x2f, 0xce,
+  0x61, 0x67, 0x15, 0x31, 0xdc, 0xe5, 0x75, 0xd7, 0x68, 0x54, 0x89, 0x87, 0x69, 0x79, 0x94, 0xc0,
+  0x26, 0x04, 0xb5, 0xc7, 0x87, 0x4a, 0xa3, 0x39, 0xd4, 0x22, 0xc1, 0x0e, 0x4e, 0x76, 0x7f, 0x48,
+  0xbd, 0x3f, 0x02, 0x70, 0x23, 0xfa, 0x0c, 0x68, 0xe3, 0xa8, 0x72, 0x08, 0xa0, 0x75, 0x51, 0x17,
+  0xa3, 0x02, 0x6c, 0xe6, 0xcb, 0x8c, 0x1d, 0xed, 0x96, 0x4a, 0x92, 0x9c, 0x43, 0x6f, 0xb5, 0x24,
+  0x90, 0xb8, 0x58, 0x54, 0xfa, 0x9b, 0x3d, 0x61, 0x05, 0xa4, 0xa7, 0x5c, 0x15, 0xed, 0x92, 0x09,
+  0x4e, 0x77, 0xe3, 0x00, 0xa8, 0x2d, 0xdd, 0xd4, 0x12, 0x07, 0x15, 0x02, 0xfb, 0x4b, 0x89, 0x82,
+  0xf9, 0x18, 0x7a, 0xa5, 0xe6, 0x45, 0xef, 0x69, 0x1f, 0x68, 0xcf, 0x70, 0x9e, 0x78, 0x6e, 0x40,
+  0x52, 0xb0, 0x5c, 0xba, 0xfa, 0x38, 0xb4, 0xe7, 0x74, 0x53, 0xe9, 0xa6, 0x38, 0x80, 0x6e, 0xf6,
+  0xd4, 0x22, 0xe8, 0x11, 0x29, 0x17, 0xa7, 0x0c, 0xf7, 0x18, 0x1f, 0x87, 0xe0, 0x1c, 0xc7, 0xe4,
+  0xa5, 0x23, 0x80, 0x05, 0xf5, 0x29, 0x74, 0x7b, 0x56, 0xe1, 0xac, 0x3f, 0xed, 0x6a, 0x30, 0xac,
+  0x80, 0xb8, 0xa5, 0x53, 0x0a, 0xcc, 0x97, 0x3d, 0xdb, 0x1a, 0x9f, 0xb4, 0xca, 0x3e, 0x86, 0xbc,
+  0x8a, 0xae, 0xb3, 0x33, 0x3e, 0x2f, 0x48, 0xa2, 0x4a, 0xcf, 0xad, 0x98, 0x59, 0x55, 0xb7, 0xbc,
+  0x0c, 0x3d, 0xe2, 0x64, 0x91, 0x3a, 0xf2, 0x42, 0x7b, 0x96, 0xab, 0xc3, 0x0c, 0xd7, 0xb7, 0x26,
+  0xa4, 0x01, 0xbe, 0x0a, 0x52, 0xa1, 0xb2, 0x22, 0x77, 0x45, 0xb0, 0x0a, 0x75, 0xf2, 0x72, 0xbd,
+  0x6c, 0xed, 0xd4, 0xe1, 0xe5, 0x48, 0x67, 0x7b, 0xc6, 0xf3, 0x63, 0x71, 0x28, 0x71, 0x7e, 0x2c,
+  0x0e, 0x45, 0x70, 0x67, 0x0f, 0x17, 0xc7, 0x5d, 0x48, 0x36, 0x6c, 0x50, 0xa8, 0x59, 0x83, 0x6d,
+  0x76, 0xed, 0xe2, 0x48, 0x92, 0xce, 0x11, 0xbc, 0xb3, 0xc6, 0xa4, 0x96, 0x1e, 0x6f, 0x60, 0xf3,
+  0x6e, 0xbf, 0x5b, 0xbb, 0x68, 0xbf, 0xe9, 0x34, 0xdb, 0xa7, 0x67, 0xcd, 0x5e, 0xb3, 0x9d, 0x8e,
+  0x3a, 0x3f, 0x06, 0xc2, 0x45, 0xf2, 0xb8, 0x1d, 0xe4, 0xf4, 0x73, 0x8d, 0xd4, 0x03, 0xf2, 0x89,
+  0x95, 0xcc, 0xa9, 0x98, 0x51, 0xea, 0x06, 0x8e, 0x0a, 0xcb, 0xd1, 0x59, 0xed, 0xa2, 0xef, 0x87,
+  0x88, 0x1e, 0x62, 0xa9, 0x62, 0xf7, 0xa2, 0x26, 0xb9, 0x0e, 0x5c, 0x49, 0xed, 0xe2, 0xdf, 0xff,
+  0xfa, 0x9f, 0x74, 0xc8, 0xc1, 0xa4, 0xdf, 0x59, 0x98, 0xcc, 0xd7, 0x7b, 0x49, 0x8f, 0x7e, 0x8c,
+  0xf4, 0xb7, 0x28, 0x71, 0x7d, 0xb2, 0x97, 0xf2, 0xfc, 0xc7, 0x28, 0x7f, 0x26, 0x56, 0xb4, 0x97,
+  0xee, 0xb4, 0x82, 0xee, 0x73, 0x0c, 0x74, 0x99, 0x60, 0xe5, 0x05, 0x2a, 0x97, 0x2e, 0x63, 0xbb,
+  0x92, 0x2f, 0xd8, 0x6e, 0xb2, 0x99, 0xa5, 0x56, 0x9b, 0x33, 0x60, 0xb5, 0x6a, 0x17, 0x37, 0xb7,
+  0x5f, 0xbf, 0x5c, 0x5e, 0x67, 0x93, 0x9f, 0x18, 0xd8, 0x06, 0x13, 0xdc, 0x7e, 0xed, 0x7f, 0xf8,
+  0xde, 0xb8, 0x0e, 0x3a, 0xe5, 0x77, 0x47, 0x75, 0x6b, 0x17, 0xef, 0x6f, 0x6f, 0x3e, 0x7e, 0x1b,
+  0x7c, 0x9f, 0x60, 0x0f, 0xa4, 0xbc, 0xf9, 0xf4, 0xf5, 0xb7, 0xad, 0x74, 0xcf, 0x57, 0x93, 0xf0,
+  0xcb, 0x6a, 0x4f, 0x26, 0x13, 0xbe, 0x12, 0x11, 0x83, 0x6a, 0x3f, 0x62, 0x88, 0x4f, 0x84, 0x26,
+  0xf3, 0x98, 0x54, 0xaf, 0x30, 0x89, 0x53, 0x13, 0xf0, 0x5c, 0x95, 0xb5, 0x8f, 0x6a, 0x52, 0x18,
+  0xd8, 0x9e, 0x6b, 0xcf, 0x80, 0xca, 0x44, 0x91, 0x13, 0x2b, 0x92, 0xd5, 0xda, 0xc5, 0x3d, 0x7a,
+  0x0d, 0x1f, 0x7a, 0xd8, 0x3c, 0x2f, 0x0c, 0x26, 0x38, 0xf1, 0x1a, 0xae, 0xd2, 0x1d, 0xb0, 0x41,
+  0x9f, 0x37, 0xdf, 0x09, 0xe7, 0x23, 0x8f, 0x20, 0x85, 0x0f, 0xec, 0x4e, 0x2a, 0x71, 0xf0, 0x03,
+  0x0a, 0x19, 0xd8, 0x31, 0x21, 0xc1, 0x56, 0x1d, 0x45, 0x0e, 0xa0, 0xe8, 0xe2, 0x4a, 0xf7, 0x93,
+  0x1c, 0x2b, 0x49, 0x38, 0x99, 0x78, 0xe4, 0x8b, 0x1b, 0xc7, 0x61, 0xac, 0xa0, 0x38, 0xee, 0x82,
+  0x48, 0x3e, 0x7b, 0x2c, 0x70, 0x63, 0x5b, 0xc1, 0xc2, 0xa2, 0x6c, 0x3e, 0x02, 0x75, 0x4d, 0xe2,
+  0x27, 0xc2, 0xb5, 0x76, 0xe7, 0xac, 0x26, 0xf1, 0xbc, 0x63, 0xd6, 0x4e, 0x7b, 0x70, 0xef, 0x3a,
+  0x0e, 0xc1, 0xc0, 0xe2, 0x33, 0x72, 0x12, 0xf0, 0x4d, 0x07, 0x9e, 0x08, 0xf3, 0xfd, 0xc8, 0xc5,
+  0xaf, 0xee, 0x47, 0x57, 0x3a, 0x96, 0x6e, 0xee, 0xef, 0x20, 0x1a, 0x45, 0x5b, 0x51, 0xd2, 0xd1,
+  0x56, 0x4e, 0x5c, 0x79, 0xb9, 0x75, 0x94, 0x92, 0xf4, 0x04, 0x22, 0xee, 0x73, 0xe8, 0x13, 0xe9,
+  0x86, 0x24, 0xcb, 0x30, 0x9e, 0x55, 0x8e, 0x82, 0x52, 0x1c, 0xe6, 0xb3, 0x7d, 0xc0, 0xc5, 0x60,
+  0x70, 0x05, 0x61, 0xc0, 0xef, 0xcf, 0x59, 0x51, 0x2f, 0xb1, 0xa2, 0xbe, 0x86, 0xc5, 0x37, 0xd7,
+  0xd3, 0xd2, 0x6d, 0xd0, 0x5a, 0x3a, 0x77, 0xe9, 0xd6, 0x24, 0xc8, 0x4c, 0x36, 0x99, 0x86, 0x1e,
+  0xa4, 0x17, 0xb3, 0x26, 0x16, 0x62, 0x47, 0xe6, 0x35, 0xc9, 0xb7, 0x56, 0x1e, 0x09, 0x26, 0xa8,
+  0x91, 0x6e, 0xa7, 0x26, 0xe1, 0x51, 0xad, 0x1d, 0xfa, 0x11, 0x6c, 0x87, 0x80, 0x64, 0x38, 0x1e,
+  0x3f, 0xc1, 0x77, 0x9e, 0xa3, 0x3b, 0x68, 0x01, 0x8a, 0x4e, 0x25, 0x57, 0x91, 0xe8, 0xcc, 0x38,
+  0x8b, 0x9e, 0xe6, 0xec, 0x9a, 0x58, 0x60, 0xc3, 0x91, 0x67, 0x05, 0x33, 0x29, 0x09, 0xa5, 0x19,
+  0x21, 0x51, 0x81, 0x41, 0xb4, 0x52, 0x91, 0xc1, 0x80, 0x2c, 0x1b, 0xd9, 0x0a, 0xd5, 0x9c, 0x42,
+  0xd5, 0x07, 0x3d, 0x45, 0x8f, 0x1a, 0xd1, 0x9c, 0x23, 0xc1, 0x8e, 0x34, 0x20, 0x76, 0xf2, 0xab,
+  0x3b, 0x76, 0xd1, 0x8f, 0xde, 0xf3, 0xc7, 0xcc, 0x87, 0xaa, 0xcd, 0xe6, 0x0b, 0x79, 0xfc, 0x1d,
+  0x00, 0x38, 0xde, 0xba, 0xcb, 0xae, 0xe3, 0x00, 0xf1, 0xb1, 0x3b, 0x39, 0xc0, 0x69, 0xf2, 0xee,
+  0x71, 0x47, 0xa0, 0xf0, 0x0e, 0xa0, 0x98, 0x4a, 0xd6, 0x45, 0x66, 0x58, 0x56, 0x68, 0x44, 0xdb,
+  0xee, 0x7d, 0x4e, 0x76, 0x85, 0x46, 0xa9, 0x9a, 0xcf, 0xac, 0xb5, 0x6f, 0xe6, 0x20, 0x22, 0x16,
+  0xec, 0xb6, 0xab, 0xe6, 0x52, 0xde, 0xb5, 0x4f, 0xf5, 0x55, 0x98, 0x52, 0xd0, 0x3f, 0x05, 0xa3,
+  0x73, 0xbd, 0xa0, 0xfa, 0x07, 0xf0, 0xb4, 0x17, 0x8f, 0x46, 0x71, 0x6e, 0x2e, 0xa0, 0x17, 0x49,
+  0xb6, 0x93, 0xbf, 0xe2, 0x63, 0x05, 0x16, 0x55, 0x1b, 0x0f, 0x17, 0xf6, 0xe9, 0x64, 0x9f, 0x05,
+  0xa9, 0x1d, 0xbb, 0x51, 0x72, 0x71, 0x04, 0x35, 0xa1, 0xd4, 0xff, 0x72, 0x3b, 0x30, 0x1f, 0xe4,
+  0xab, 0x0f, 0xd7, 0x7d, 0x59, 0x93, 0x3f, 0x5f, 0xde, 0xdd, 0xfd, 0x06, 0xd7, 0xc1, 0x75, 0xbf,
+  0xcf, 0x6e, 0xfa, 0x7f, 0x7f, 0x7f, 0x75, 0xdf, 0xff, 0x80, 0x4d, 0x97, 0xf8, 0xcb, 0xf2, 0x10,
+  0x5c, 0xd3, 0xd4, 0x05, 0xb7, 0xf7, 0x9f, 0xaf, 0x6e, 0xfe, 0xeb, 0xea, 0xe6, 0x13, 0xdc, 0x5e,
+  0xdf, 0xfe, 0x82, 0x54, 0x06, 0xdf, 0xbe, 0xde, 0x7d, 0xbd, 0xe2, 0xbd, 0x1f, 0xfa, 0x6c, 0x1e,
+  0x4b, 0x9c, 0x78, 0xbd, 0x86, 0xc1, 0xf2, 0xd0, 0x60, 0x6b, 0x0f, 0xfa, 0xef, 0xef, 0xaf, 0x6e,
+  0x6f, 0x06, 0xe6, 0x06, 0x64, 0x91, 0x73, 0x16, 0x97, 0xf5, 0x07, 0xa6, 0xa4, 0x07, 0xd9, 0x4a,
+  0xb3, 0x3b, 0xd4, 0x61, 0x13, 0xd2, 0xfe, 0x42, 0x91, 0x3c, 0xde, 0x4a, 0x6d, 0x49, 0x79, 0x17,
+  0xc6, 0xc4, 0x51, 0x65, 0x0d, 0x36, 0x27, 0xad, 0x96, 0xd6, 0x3e, 0x6b, 0xf1, 0x2b, 0xfb, 0x95,
+  0x7d, 0x2a, 0x0f, 0xb5, 0x4a, 0x2a, 0x9d, 0x1c, 0x95, 0x8e, 0xa4, 0x0c, 0xac, 0x1f, 0xa0, 0xd1,
+  0xcd, 0xd1, 0xe8, 0x4a, 0x0a, 0x1a, 0x6b, 0x4e, 0x7f, 0x84, 0x99, 0x5e, 0x8e, 0x50, 0x4f, 0x52,
+  0x2e, 0x83, 0x49, 0xbc, 0x3e, 0x84, 0x8a, 0x1f, 0x86, 0xce, 0x87, 0xd8, 0x1d, 0x27, 0x57, 0xb8,
+  0x03, 0x59, 0x58, 0x1e, 0xa3, 0xf3, 0x05, 0x5a, 0x25, 0xd6, 0x2c, 0x6b, 0x5d, 0x36, 0xe9, 0x94,
+  0x53, 0x38, 0xd9, 0x25, 0xe0, 0xda, 0x71, 0xd8, 0x5f, 0x45, 0x98, 0x2a, 0x81, 0x99, 0xf7, 0x53,
+  0x2b, 0xb0, 0x09, 0x92, 0xc0, 0xf6, 0x06, 0x81, 0x0e, 0x59, 0x63, 0x2b, 0x6b, 0x6d, 0x4d, 0xfe,
+  0x69, 0x3b, 0xef, 0x77, 0x17, 0xab, 0x50, 0x88, 0x5e, 0xdc, 0xfb, 0xc0, 0xf8, 0xbf, 0xb1, 0x67,
+  0x1c, 0x7b, 0x92, 0x0e, 0x85, 0x91, 0x6c, 0xb8, 0xcc, 0x82, 0x70, 0x6b, 0x4c, 0xcc, 0xd1, 0x2c,
+  0x35, 0x33, 0x5e, 0xb7, 0x99, 0x5a, 0xd6, 0x3a, 0xb0, 0x4c, 0x87, 0xf3, 0x59, 0xe4, 0x92, 0xa7,
+  0x65, 0xc8, 0xc5, 0xbf, 0xba, 0x01, 0x6c, 0x59, 0xd8, 0xc4, 0x6d, 0x82, 0x96, 0x39, 0x7f, 0x38,
+  0xb1, 0x73, 0xc2, 0x27, 0x66, 0x6b, 0x8b, 0x20, 0xde, 0xae, 0x2e, 0x1a, 0x7e, 0xc1, 0x63, 0x72,
+  0x14, 0x34, 0xbd, 0xc1, 0xb9, 0x27, 0xc8, 0x39, 0x9f, 0x7c, 0xf4, 0xc8, 0x9d, 0xf3, 0xfe, 0xf6,
+  0xd3, 0xa7, 0xeb, 0x3e, 0xf8, 0x66, 0x8e, 0xd2, 0x83, 0x4c, 0x02, 0x0b, 0xd6, 0x16, 0xc5, 0xd4,
+  0x3b, 0x80, 0x72, 0xf4, 0x69, 0xb8, 0x40, 0xf0, 0x4a, 0xa8, 0xc2, 0x09, 0x91, 0x87, 0x43, 0x41,
+  0xc1, 0x9e, 0xc7, 0x66, 0x4b, 0xb3, 0xc7, 0x13, 0x73, 0x03, 0x2d, 0x47, 0xe3, 0x79, 0x60, 0xb3,
+  0x3a, 0x75, 0xec, 0x27, 0x8a, 0x4f, 0xd5, 0x0d, 0x8e, 0xf1, 0xcd, 0x2f, 0x56, 0x32, 0x6d, 0x8e,
+  0xbd, 0x10, 0xf2, 0xbd, 0x4f, 0x8f, 0x99, 0xb9, 0x54, 0x8d, 0xe6, 0x9b, 0xa1, 0xfd, 0x27, 0xde,
+  0x7e, 0x8c, 0xa2, 0xaa, 0x46, 0x4c, 0xa0, 0xd0, 0x0a, 0x24, 0xff, 0xad, 0x5f, 0x97, 0x7d, 0x49,
+  0xae, 0xd3, 0xba, 0x4c, 0x65, 0x9d, 0xfd, 0x1a, 0x8f, 0x85, 0x75, 0xbe, 0x45, 0xd9, 0x4a, 0xd3,
+  0xd2, 0x4a, 0x5d, 0xee, 0x19, 0xaa, 0xe6, 0x97, 0xd7, 0x4a, 0x7b, 0x9e, 0xc5, 0xcc, 0xf4, 0xed,
+  0xb4, 0x2e, 0x4f, 0x81, 0x19, 0xe4, 0x49, 0xd6, 0x0f, 0xe0, 0xed, 0x17, 0xcb, 0x53, 0x16, 0xda,
+  0x3c, 0x70, 0x13, 0x75, 0x23, 0x88, 0xe0, 0x83, 0x69, 0x9a, 0x68, 0xc8, 0xb7, 0xa8, 0xa5, 0x85,
+  0xaa, 0xa7, 0x4d, 0xf2, 0xdb, 0x85, 0xbe, 0xa8, 0xe3, 0x13, 0x90, 0x39, 0xba, 0x1d, 0xfd, 0x0e,
+  0xd9, 0xac, 0x39, 0x23, 0x6b, 0xaa, 0xa4, 0x28, 0xa2, 0x36, 0xc7, 0x61, 0xdc, 0xb7, 0xec, 0xa9,
+  0x92, 0xae, 0xa2, 0x00, 0xd0, 0xab, 0x88, 0x2d, 0x28, 0x3f, 0xf1, 0x4c, 0x27, 0xb4, 0xc1, 0xe2,
+  0x41, 0xd2, 0x9c, 0x90, 0xa4, 0xef, 0x11, 0xbc, 0x7d, 0xb7, 0xbe, 0x72, 0x14, 0x99, 0x36, 0x80,
+  0x51, 0x18, 0x6b, 0xc0, 0xd8, 0xe3, 0x63, 0x89, 0x17, 0x61, 0x54, 0x1a, 0xbb, 0x31, 0x4d, 0xa0,
+  0xc9, 0x1d, 0x2b, 0xc2, 0x1b, 0x1e, 0x60, 0xd4, 0x50, 0xdd, 0xe4, 0x9f, 0x76, 0x57, 0x4d, 0xd8,
+  0x9a, 0x7c, 0xd5, 0x99, 0x99, 0x3c, 0xb4, 0x86, 0x9a, 0x37, 0xf2, 0xe0, 0xa6, 0x3d, 0x34, 0xb2,
+  0x0e, 0x67, 0xcb, 0x0d, 0x94, 0x89, 0xb0, 0x73, 0x16, 0x0c, 0x41, 0x25, 0xea, 0x2e, 0x64, 0xd5,
+  0x70, 0x9a, 0x0c, 0xd7, 0x6f, 0xf0, 0x0b, 0x00, 0x19, 0xea, 0x12, 0x99, 0x4f, 0x75, 0x9a, 0x2e,
+  0x24, 0xf2, 0xf8, 0xf3, 0xfd, 0x97, 0x6b, 0x53, 0x16, 0x95, 0x8a, 0x5c, 0x07, 0xf2, 0x75, 0x39,
+  0x2b, 0x54, 0x44, 0x66, 0xc1, 0x64, 0x90, 0x80, 0x60, 0xb3, 0xba, 0x5c, 0x2b, 0x14, 0x9d, 0xdb,
+  0x62, 0x33, 0x51, 0xfe, 0x21, 0xb3, 0x01, 0xff, 0xc0, 0xc2, 0x97, 0x6d, 0xc3, 0x44, 0x96, 0x11,
+  0xcb, 0x11, 0xaf, 0x69, 0x45, 0x11, 0xec, 0xf2, 0xdf, 0xe3, 0x0b, 0x42, 0xc5, 0x61, 0x1a, 0x7a,
+  0x54, 0xc1, 0x04, 0x52, 0x86, 0xde, 0x4f, 0x68, 0x61, 0x5c, 0xd0, 0xc2, 0x38, 0xd5, 0xc2, 0x18,
+  0xb4, 0xa0, 0xf9, 0x01, 0x5c, 0x3b, 0x70, 0x5d, 0xc1, 0xb5, 0x3b, 0xd4, 0x68, 0x42, 0x22, 0xb8,
+  0xeb, 0x0d, 0x99, 0x3b, 0xc0, 0xdd, 0xc9, 0xff, 0x8f, 0xa6, 0xf2, 0x25, 0x1d, 0x3b, 0x3e, 0xe6,
+  0x29, 0x34, 0x4e, 0xb5, 0xe6, 0xbb, 0x81, 0x59, 0x03, 0x97, 0x0e, 0xd8, 0x83, 0xb5, 0x62, 0x0f,
+  0x2b, 0x7c, 0x60, 0x1c, 0xc3, 0x13, 0x5e, 0xe1, 0x59, 0xec, 0x6d, 0x71, 0xb2, 0x27, 0x26, 0xe7,
+  0x76, 0xb5, 0xfb, 0x94, 0x09, 0x8c, 0x3e, 0xe5, 0x95, 0x8c, 0x0d, 0xb5, 0x69, 0x39, 0x4e, 0x7f,
+  0x01, 0x8d, 0xd7, 0x2e, 0x2c, 0x06, 0x12, 0x29, 0x02, 0x56, 0xb5, 0x4c, 0xd5, 0xea, 0x66, 0xee,
+  0x29, 0x33, 0x1e, 0x4a, 0xc6, 0x63, 0x6a, 0xa3, 0x23, 0xfc, 0x8f, 0x01, 0x11, 0x99, 0x3c, 0xed,
+  0xfa, 0xe9, 0x96, 0x0f, 0x14, 0x79, 0x84, 0xb5, 0xc0, 0xae, 0x21, 0x03, 0xcd, 0xcd, 0x82, 0x68,
+  0xf4, 0xa4, 0x2d, 0xb8, 0xdf, 0xc8, 0x6c, 0xf1, 0x51, 0xde, 0x22, 0x64, 0x24, 0x1b, 0xa3, 0x26,
+  0x96, 0xf1, 0xef, 0xc5, 0xd7, 0x2b, 0x81, 0x81, 0xef, 0xde, 0xb8, 0x0f, 0xe6, 0x64, 0xa0, 0x44,
+  0x71, 0x81, 0x7d, 0x24, 0x40, 0x26, 0x05, 0x4d, 0x8d, 0x52, 0x61, 0x32, 0xf8, 0xa0, 0xd3, 0x70,
+  0x29, 0x40, 0x58, 0x71, 0x1d, 0x0d, 0x8b, 0x7e, 0xc6, 0x23, 0x42, 0xae, 0xeb, 0x20, 0x89, 0xa7,
+  0x63, 0x1d, 0x36, 0x79, 0x45, 0x76, 0x60, 0x72, 0x61, 0xc6, 0x1f, 0x73, 0x12, 0xaf, 0x07, 0xc4,
+  0x03, 0x84, 0x09, 0xe3, 0x4b, 0xcf, 0x53, 0xe4, 0x26, 0x08, 0x51, 0x01, 0x2f, 0x23, 0xd4, 0x8c,
+  0x10, 0x16, 0xad, 0xd3, 0xe4, 0xc0, 0xa1, 0xc8, 0xa0, 0x08, 0xcd, 0x05, 0xd4, 0x02, 0x76, 0xb8,
+  0x41, 0x1e, 0x8b, 0xac, 0xb3, 0x74, 0xaf, 0x00, 0x30, 0x03, 0x49, 0x05, 0xf5, 0xea, 0x9a, 0x2d,
+  0xc3, 0x3d, 0x3f, 0x31, 0xdc, 0x7a, 0x5d, 0xdd, 0x3c, 0xc9, 0xba, 0x25, 0xd7, 0x5d, 0x75, 0xcf,
+  0x72, 0x14, 0x16, 0xcb, 0xad, 0x04, 0x2a, 0xf4, 0xd6, 0xfc, 0xfc, 0x0a, 0x9c, 0x2d, 0x35, 0x61,
+  0x64, 0x27, 0x1c, 0xcf, 0xc1, 0x9f, 0x95, 0x96, 0xc6, 0x6f, 0xdd, 0x40, 0xc1, 0x4c, 0xca, 0x1e,
+  0xd8, 0xd9, 0x9d, 0xa2, 0x38, 0xcd, 0x11, 0x3f, 0x6f, 0x82, 0x3c, 0x89, 0xec, 0x36, 0xba, 0x4d,
+  0xc4, 0xfc, 0x66, 0xe7, 0x67, 0x18, 0xa9, 0xaa, 0xcc, 0xd0, 0x79, 0x33, 0x38, 0x4d, 0xe1, 0x4a,
+  0x5a, 0x76, 0x87, 0x0e, 0xa0, 0xee, 0x37, 0xc6, 0xa8, 0x64, 0x8c, 0xf2, 0xaa, 0x20, 0xe3, 0x47,
+  0x77, 0x45, 0x1c, 0xa5, 0xa3, 0xd6, 0xe5, 0x5f, 0x24, 0x45, 0xae, 0x03, 0xff, 0x75, 0xf9, 0x27,
+  0x55, 0xde, 0x4f, 0x77, 0x5e, 0xa2, 0xcb, 0x73, 0xa1, 0xd3, 0x9c, 0xb3, 0x83, 0xae, 0x2f, 0xf4,
+  0x3b, 0x6c, 0x4d, 0x77, 0xd8, 0x1a, 0xc3, 0x5e, 0x1e, 0xcf, 0xb2, 0xea, 0xf2, 0x3b, 0x09, 0xef,
+  0xe5, 0x54, 0x7e, 0x6e, 0x4b, 0xa7, 0x59, 0x2c, 0xeb, 0x8a, 0x36, 0x8f, 0x42, 0xcf, 0x13, 0x86,
+  0x60, 0x76, 0x18, 0x93, 0x04, 0xfc, 0x48, 0x3e, 0xb6, 0x22, 0xf7, 0x98, 0xb2, 0x76, 0x5c, 0x6f,
+  0x4a, 0x82, 0xad, 0x6f, 0xc5, 0x59, 0x52, 0x8c, 0x9b, 0xbf, 0x53, 0x0c, 0x10, 0x70, 0x24, 0x3e,
+  0x26, 0x67, 0x57, 0xf0, 0x06, 0x2b, 0xc9, 0xbb, 0xa4, 0xba, 0xe1, 0xee, 0x76, 0x04, 0x69, 0x8c,
+  0x9d, 0x1d, 0xcc, 0x23, 0x07, 0xc2, 0x94, 0xea, 0x12, 0x4c, 0x95, 0xf8, 0x07, 0x63, 0x52, 0x34,
+  0xa7, 0x53, 0x48, 0x6f, 0x36, 0xab, 0x57, 0xa8, 0x84, 0x6f, 0x0d, 0x24, 0xc6, 0x0b, 0x41, 0x9c,
+  0xa1, 0x06, 0xe3, 0x17, 0xd2, 0x84, 0xb7, 0x96, 0x96, 0x10, 0x80, 0x84, 0xcd, 0xa5, 0x09, 0x04,
+  0xbc, 0x2f, 0xb9, 0x14, 0xd4, 0xb6, 0x0c, 0x18, 0xae, 0xe0, 0x30, 0xd8, 0xe1, 0x06, 0x73, 0xcf,
+  0x33, 0x72, 0x0e, 0x9e, 0x58, 0x71, 0x72, 0x07, 0x5d, 0x6e, 0x00, 0xdb, 0x97, 0x0d, 0x24, 0xcf,
+  0x17, 0x7c, 0xa0, 0xba, 0xc9, 0xeb, 0xc1, 0x10, 0xb3, 0x61, 0x6f, 0x93, 0x96, 0xb0, 0xca, 0xb6,
+  0x9f, 0x55, 0xaf, 0x45, 0x77, 0x66, 0x74, 0x19, 0x12, 0x0a, 0x2d, 0x22, 0xe5, 0x25, 0x2b, 0x0b,
+  0x9b, 0xac, 0x79, 0x10, 0xce, 0xa1, 0x28, 0x05, 0x20, 0x29, 0x30, 0x20, 0x0a, 0x14, 0x96, 0xb2,
+  0x18, 0x18, 0x52, 0x13, 0xf6, 0xd7, 0x52, 0x6e, 0x86, 0x30, 0x04, 0x17, 0x9e, 0x23, 0x18, 0xa1,
+  0x15, 0xb0, 0x2b, 0x2c, 0xb5, 0xc5, 0x5d, 0x58, 0x2b, 0x1f, 0x63, 0x7f, 0x1b, 0xdc, 0xde, 0x34,
+  0x23, 0xfc, 0x90, 0x4f, 0x21, 0x4d, 0xd0, 0xba, 0xa5, 0xa6, 0x68, 0x5c, 0x49, 0x4e, 0x04, 0x49,
+  0x91, 0x1e, 0x4f, 0x78, 0xbb, 0x94, 0x8c, 0x83, 0x42, 0x6d, 0xcf, 0x6a, 0x99, 0x7b, 0x16, 0xd7,
+  0xdb, 0x7a, 0xf0, 0xee, 0x9a, 0x3b, 0x2e, 0x9d, 0x91, 0x0f, 0x83, 0x10, 0xd0, 0x39, 0x0f, 0xde,
+  0x60, 0x8b, 0xd4, 0xc8, 0xb6, 0x47, 0xac, 0xb8, 0x60, 0x52, 0x68, 0x35, 0xf2, 0xbe, 0xf2, 0xf8,
+  0x98, 0xd1, 0x21, 0x78, 0xb2, 0x65, 0xe6, 0x2d, 0x96, 0x7a, 0x2f, 0x86, 0x5e, 0x1c, 0x7a, 0x12,
+  0x0d, 0xed, 0x19, 0x49, 0x74, 0x69, 0xe4, 0x06, 0x56, 0xbc, 0x96, 0x1e, 0xc2, 0x48, 0xa3, 0xe4,
+  0x0f, 0xcd, 0x8a, 0x27, 0x43, 0xc9, 0x0e, 0x7d, 0xdf, 0x0a, 0x1c, 0xaa, 0x49, 0x0f, 0xad, 0xd5,
+  0x59, 0x9b, 0x75, 0x60, 0x3f, 0xb3, 0xc7, 0x50, 0xb2, 0xec, 0x99, 0xe8, 0xea, 0x68, 0xcd, 0x66,
+  0x73, 0x88, 0x2e, 0x94, 0x10, 0xe6, 0xba, 0x4b, 0xca, 0x58, 0xc1, 0x19, 0x00, 0xbd, 0x25, 0x27,
+  0x13, 0x4b, 0xef, 0x78, 0xd9, 0xaf, 0x64, 0x34, 0x60, 0xdc, 0xa8, 0xc2, 0xa7, 0xa0, 0x7b, 0xc9,
+  0xdd, 0x29, 0xeb, 0x52, 0xe4, 0x25, 0xd5, 0x8f, 0x8f, 0xa1, 0xd2, 0x08, 0x21, 0x34, 0x81, 0x64,
+  0x73, 0x1a, 0x52, 0x40, 0xac, 0xe3, 0xa5, 0x70, 0xad, 0x25, 0x6d, 0x72, 0x51, 0xee, 0xb1, 0xec,
+  0x90, 0xad, 0x38, 0xb6, 0xd6, 0xa3, 0xf9, 0x78, 0x0c, 0x1b, 0x0c, 0xd1, 0x1d, 0x06, 0x3e, 0x6c,
+  0x8a, 0x40, 0xe3, 0x66, 0xde, 0x52, 0xb9, 0x7a, 0x08, 0x17, 0xfc, 0xe6, 0x06, 0xc9, 0xd9, 0x25,
+  0x4e, 0xce, 0x5c, 0x84, 0x8d, 0x00, 0x76, 0x1d, 0xa8, 0xb5, 0x20, 0x1b, 0xa0, 0xd8, 0xaf, 0x5e,
+  0x39, 0x4d, 0x7e, 0xce, 0x74, 0x61, 0xbe, 0xe1, 0xd6, 0xce, 0x9c, 0x08, 0x0b, 0x31, 0xcc, 0xf8,
+  0x0f, 0x78, 0x37, 0xfc, 0xf3, 0x4f, 0xf9, 0xad, 0xcc, 0xdd, 0x4c, 0x20, 0x1a, 0x14, 0x68, 0xbc,
+  0xd0, 0xc3, 0xca, 0x85, 0x92, 0x22, 0xe5, 0xae, 0xea, 0xc4, 0xd6, 0x52, 0x9c, 0x53, 0x8a, 0xb2,
+  0x30, 0x63, 0xbf, 0xc2, 0x39, 0xf8, 0x11, 0xe6, 0x6d, 0xa0, 0x52, 0xcc, 0xea, 0xbe, 0x83, 0x9f,
+  0x27, 0x89, 0x64, 0xcf, 0xa6, 0xd8, 0x5e, 0x48, 0x49, 0x7e, 0x8e, 0x30, 0x90, 0x01, 0xf0, 0x70,
+  0x0f, 0x88, 0x1d, 0xce, 0x13, 0x25, 0x6f, 0x1b, 0xb6, 0x5b, 0x64, 0x04, 0xb8, 0xb7, 0xdc, 0x5e,
+  0xf7, 0x3f, 0x88, 0x73, 0x52, 0x9d, 0x59, 0xbc, 0x8b, 0xa6, 0xbd, 0x0e, 0xf1, 0xf7, 0xb3, 0xab,
+  0x8d, 0x3d, 0x6b, 0x42, 0xb5, 0x08, 0xe4, 0xfa, 0x62, 0xd1, 0xd9, 0x10, 0x01, 0x0d, 0x50, 0x19,
+  0x60, 0x8f, 0x63, 0xa0, 0x23, 0x61, 0x97, 0xf4, 0x10, 0x0c, 0xa5, 0xba, 0x14, 0x48, 0xa3, 0x35,
+  0x20, 0xa6, 0xf4, 0xf7, 0xdb, 0xaf, 0x0d, 0x87, 0x40, 0x16, 0x3a, 0xfe, 0x7a, 0xdd, 0x67, 0x4e,
+  0x93, 0x0a, 0x61, 0x8e, 0x2d, 0x50, 0x88, 0x36, 0x1e, 0x95, 0x2d, 0xd1, 0x6e, 0x75, 0x7a, 0xaa,
+  0x16, 0xda, 0xc9, 0x8a, 0x7b, 0x57, 0xe8, 0xfa, 0x93, 0x32, 0x3c, 0x16, 0x4f, 0x78, 0xd1, 0xac,
+  0x19, 0xd9, 0x17, 0xe9, 0xdd, 0xde, 0xe4, 0xe4, 0x27, 0xf2, 0x53, 0x45, 0x40, 0xa6, 0xe5, 0xbd,
+  0x04, 0xf0, 0xc0, 0x18, 0x48, 0xf0, 0x93, 0xe1, 0xe2, 0xa2, 0x5b, 0xeb, 0xa4, 0xad, 0x6f, 0xdb,
+  0x7a, 0xab, 0x98, 0xcc, 0x0a, 0x86, 0x17, 0x11, 0xe2, 0x40, 0x15, 0xff, 0xaa, 0xad, 0x8e, 0x47,
+  0xcd, 0xb1, 0x0b, 0x05, 0x53, 0x8b, 0x31, 0xc0, 0x52, 0x84, 0x79, 0x82, 0xb7, 0x69, 0x9d, 0x13,
+  0x4d, 0x20, 0xda, 0xa2, 0xc9, 0xf9, 0x19, 0xfc, 0x60, 0xa9, 0x93, 0xba, 0xec, 0x0b, 0xa0, 0xd0,
+  0x1b, 0xbe, 0x52, 0xda, 0xe7, 0xe7, 0xd1, 0x04, 0x8a, 0x0b, 0xfc, 0x9e, 0xc6, 0x0d, 0xe6, 0x64,
+  0xbb, 0x0b, 0x00, 0xc6, 0xcc, 0xa8, 0xde, 0xae, 0x3b, 0x0f, 0xd1, 0x50, 0x0b, 0xcd, 0x68, 0xf2,
+  0x73, 0xbb, 0x03, 0x54, 0xea, 0x75, 0x3e, 0x84, 0xe5, 0x29, 0x25, 0x3a, 0x87, 0x61, 0x1c, 0x44,
+  0x6d, 0x13, 0x46, 0xd6, 0xeb, 0x43, 0x03, 0xa8, 0xdb, 0xe7, 0xe0, 0x10, 0xad, 0x6d, 0xb5, 0x35,
+  0x03, 0x26, 0x66, 0xe7, 0xa6, 0x6d, 0xcc, 0x80, 0x87, 0xf1, 0xe8, 0x21, 0x84, 0x71, 0xff, 0x9d,
+  0x8e, 0x7f, 0x64, 0xce, 0x1e, 0xd6, 0x4d, 0xbb, 0xd1, 0x5a, 0xbd, 0xfe, 0xc8, 0x22, 0xe0, 0x51,
+  0xe0, 0x00, 0x5a, 0x56, 0x90, 0x5f, 0x98, 0xdf, 0xd1, 0xaf, 0xc1, 0xdc, 0xc0, 0x5e, 0x60, 0x37,
+  0x2b, 0x23, 0x56, 0x80, 0x0d, 0x1d, 0xd6, 0x81, 0x5e, 0x81, 0xbd, 0xa2, 0x86, 0xbe, 0xc2, 0x77,
+  0xa9, 0x1f, 0x20, 0x84, 0x15, 0x10, 0x49, 0x3b, 0xed, 0xa9, 0x59, 0xae, 0x8a, 0x56, 0x26, 0x0e,
+  0x66, 0xf1, 0x9d, 0x57, 0xe3, 0x1a, 0x04, 0x58, 0x9f, 0x9f, 0xf6, 0x8c, 0x35, 0x0a, 0x20, 0x1a,
+  0x57, 0xd0, 0xb8, 0x3a, 0x47, 0xad, 0xac, 0x32, 0xd5, 0x62, 0xfb, 0xc2, 0x54, 0x40, 0x46, 0x65,
+  0x7d, 0x71, 0xd1, 0x55, 0x51, 0x69, 0xf5, 0xd5, 0xf0, 0xe2, 0x42, 0x59, 0xbf, 0x7a, 0xad, 0xaa,
+  0xaf, 0xda, 0x6f, 0x3b, 0x27, 0x27, 0x7a, 0x0b, 0xaa, 0x47, 0x65, 0xcd, 0xfb, 0xd4, 0x9f, 0x7b,
+  0x5c, 0xa3, 0xd1, 0xea, 0xc1, 0x1d, 0x9a, 0xf8, 0x5b, 0x6f, 0x8b, 0x6b, 0x67, 0x68, 0x2e, 0x0c,
+  0x76, 0xd7, 0x1d, 0x9a, 0x30, 0xd1, 0x10, 0xaa, 0x61, 0xb2, 0xc0, 0x96, 0x64, 0x2b, 0x08, 0x72,
+  0x8d, 0x1f, 0xdb, 0xa6, 0x3b, 0xea, 0x4b, 0x3a, 0x43, 0xe6, 0x59, 0x21, 0x11, 0x80, 0x26, 0xa0,
+  0x84, 0x82, 0x84, 0xc5, 0x4b, 0x0c, 0x08, 0x7e, 0xac, 0x30, 0xa0, 0xb0, 0x80, 0x74, 0x20, 0xb1,
+  0x8b, 0x44, 0xd9, 0xab, 0x13, 0x09, 0xb6, 0x50, 0xf9, 0xba, 0x25, 0x20, 0x58, 0xa9, 0xc4, 0xf3,
+  0x80, 0x4a, 0x16, 0xbe, 0x28, 0x96, 0xc2, 0xb1, 0x34, 0xa7, 0xb0, 0x42, 0x4c, 0xa0, 0x66, 0xa7,
+  0xc9, 0x65, 0xe0, 0xfa, 0x0c, 0x73, 0x3f, 0x22, 0x75, 0xe5, 0x20, 0x04, 0x2a, 0x15, 0xe7, 0xa2,
+  0x0f, 0x92, 0x08, 0x24, 0x98, 0x2d, 0xfe, 0xd3, 0x3f, 0xff, 0x04, 0x98, 0x02, 0x6b, 0x39, 0x2c,
+  0xd9, 0x93, 0x17, 0xa6, 0xd9, 0x16, 0x49, 0x40, 0x62, 0x60, 0xc0, 0x83, 0xe7, 0x0f, 0x53, 0x81,
+  0x9f, 0x7a, 0x5b, 0x7d, 0x25, 0xb4, 0x03, 0x93, 0x90, 0xa4, 0x52, 0xc2, 0x89, 0x7c, 0x12, 0xe3,
+  0x95, 0xb4, 0xa0, 0x95, 0xc4, 0xe8, 0xf3, 0x8f, 0xf9, 0x9d, 0x0e, 0xec, 0x8a, 0xb2, 0x30, 0x7b,
+  0x91, 0xf2, 0xd7, 0xd6, 0xa0, 0x51, 0xcd, 0x97, 0x91, 0x59, 0x35, 0xb1, 0xf1, 0x49, 0x32, 0x0d,
+  0x1d, 0x5d, 0xbe, 0xbb, 0x1d, 0xdc, 0xcb, 0x1a, 0xbe, 0x49, 0xd7, 0xd9, 0xf2, 0x5f, 0xaf, 0x07,
+  0x90, 0x98, 0xed, 0xe9, 0x9d, 0x05, 0xda, 0xa1, 0xca, 0x46, 0xcc, 0xd0, 0x5d, 0xe7, 0x51, 0xe5,
+  0x99, 0xbd, 0x62, 0xf7, 0xf4, 0xd7, 0xed, 0x85, 0x80, 0x61, 0xa1, 0x6d, 0x86, 0xa5, 0x9f, 0xfa,
+  0x83, 0xfb, 0x6f, 0x5f, 0xf1, 0x7c, 0x2d, 0xb1, 0x22, 0xbd, 0xad, 0xe1, 0xd9, 0xa0, 0xde, 0xd1,
+  0xf8, 0x79, 0x9f, 0xde, 0x7d, 0xcc, 0xe7, 0xe4, 0x89, 0x32, 0xe1, 0x75, 0x64, 0x2a, 0x7e, 0x47,
+  0x4b, 0xa7, 0x3f, 0xa0, 0x02, 0xf3, 0x7a, 0x98, 0xf0, 0xb7, 0x90, 0xcf, 0xd0, 0x83, 0x98, 0xa1,
+  0x4f, 0x98, 0x1a, 0xf2, 0xba, 0xdf, 0xee, 0xaa, 0xd3, 0xcd, 0xd3, 0xc2, 0x64, 0x15, 0x12, 0x54,
+  0x37, 0xca, 0xf7, 0xb6, 0xed, 0x50, 0xfc, 0xcc, 0xf9, 0xee, 0xc7, 0x1e, 0x4f, 0x1e, 0x66, 0x18,
+  0x3a, 0xfb, 0x40, 0xd9, 0xe3, 0xb3, 0x4a, 0x7b, 0x96, 0xdc, 0x19, 0x59, 0xd1, 0x2d, 0x92, 0x44,
+  0x99, 0xf1, 0x1d, 0x2f, 0x27, 0xce, 0x2f, 0x6f, 0x5b, 0x7a, 0xdb, 0x38, 0xe0, 0xbc, 0x8b, 0x1d,
+  0x0b, 0xf1, 0x62, 0xce, 0x2b, 0x2c, 0x29, 0xc8, 0xc8, 0xb7, 0x37, 0xb2, 0x2e, 0xdf, 0x7e, 0xfc,
+  0x28, 0x8b, 0x31, 0xd5, 0x66, 0x7d, 0xf1, 0x82, 0x8f, 0x2f, 0xf1, 0xe6, 0x85, 0x96, 0x93, 0xbe,
+  0xbd, 0x28, 0xef, 0x76, 0x6c, 0xd6, 0xfe, 0x9c, 0xdd, 0x4e, 0x36, 0xc6, 0x11, 0x98, 0x86, 0x07,
+  0xaa, 0x0e, 0xc7, 0xa8, 0x67, 0x1e, 0x03, 0xe2, 0xdf, 0x81, 0xa7, 0x56, 0xa5, 0x93, 0xab, 0xec,
+  0x58, 0x4a, 0xdb, 0xa7, 0xd6, 0x38, 0x53, 0x2b, 0xff, 0x03, 0x97, 0x25, 0x9e, 0xba, 0x01, 0xfd,
+  0x31, 0x67, 0x10, 0xda, 0x35, 0x7e, 0xc0, 0x07, 0xf8, 0xcc, 0xf4, 0x84, 0x47, 0x2c, 0xf0, 0x98,
+  0x2d, 0xf5, 0x83, 0x07, 0x94, 0xa5, 0x43, 0xca, 0xc3, 0x3c, 0xa6, 0x2c, 0xda, 0x7e, 0xf7, 0x39,
+  0xc0, 0x77, 0x72, 0xe2, 0xf0, 0xdb, 0xf4, 0x04, 0xeb, 0xc9, 0xbd, 0xed, 0x16, 0x19, 0x72, 0x2f,
+  0xd9, 0xb2, 0xf3, 0x0d, 0x16, 0xd6, 0x66, 0x55, 0xa8, 0x33, 0xba, 0x79, 0x9f, 0x01, 0x16, 0x2a,
+  0xdc, 0x65, 0xc6, 0xc0, 0x66, 0xd6, 0x84, 0xa2, 0x9f, 0xac, 0x6e, 0xc7, 0x8a, 0xec, 0xb0, 0x17,
+  0x2a, 0x2a, 0x80, 0x7e, 0x4b, 0xe5, 0xe4, 0xc5, 0xf1, 0x14, 0xc0, 0xc3, 0x20, 0xc1, 0xef, 0x9f,
+  0x84, 0x81, 0xb2, 0x0d, 0x5f, 0x85, 0xcb, 0x57, 0x02, 0x12, 0xa7, 0xb6, 0xe3, 0xea, 0xb9, 0xec,
+  0xed, 0xef, 0x39, 0xb5, 0xe6, 0x6f, 0xfa, 0x64, 0x61, 0x16, 0xbf, 0x60, 0x0a, 0x19, 0x5f, 0x39,
+  0x3a, 0x2f, 0xc4, 0xd1, 0x63, 0xae, 0x8a, 0xce, 0x2d, 0x52, 0x9a, 0x21, 0x1b, 0x8f, 0xa2, 0xac,
+  0x4e, 0x0f, 0x10, 0x73, 0xaa, 0x2e, 0xbc, 0x93, 0xac, 0x8e, 0xea, 0x63, 0x36, 0xa6, 0x2c, 0x68,
+  0x85, 0x70, 0x79, 0x80, 0x30, 0x1e, 0x2b, 0xd0, 0x83, 0xbf, 0xb5, 0x2e, 0xaf, 0xb2, 0x84, 0xd6,
+  0xff, 0x08, 0x39, 0x9e, 0xd4, 0x24, 0x7e, 0x5a, 0x20, 0x0b, 0xc8, 0x36, 0x9d, 0x26, 0xa5, 0xae,
+  0x03, 0xfb, 0x21, 0x39, 0x77, 0x06, 0x1d, 0x82, 0x7e, 0x0a, 0xdf, 0x2f, 0x2d, 0x1d, 0xb9, 0xae,
+  0xb0, 0xaf, 0xec, 0x06, 0x6b, 0x28, 0x60, 0x9c, 0xb7, 0xb2, 0x04, 0xf7, 0xb2, 0xee, 0x34, 0xc5,
+  0x9b, 0x77, 0xd6, 0x04, 0x9e, 0xae, 0xcb, 0xb2, 0xca, 0x4e, 0x88, 0x0b, 0x67, 0xc1, 0x48, 0x94,
+  0x1d, 0x42, 0x9b, 0x05, 0x1a, 0x37, 0xf7, 0x77, 0x12, 0x65, 0xf7, 0xd2, 0x2b, 0xdf, 0xb1, 0xe8,
+  0xd4, 0x90, 0xe4, 0x3a, 0x30, 0x94, 0x58, 0x57, 0x51, 0x91, 0xf4, 0xfb, 0xf4, 0xb6, 0x62, 0xa0,
+  0x7c, 0x13, 0x26, 0x52, 0x36, 0x56, 0xfe, 0xce, 0x31, 0x33, 0x6e, 0x4c, 0x0b, 0x67, 0xe5, 0xb9,
+  0x97, 0xca, 0xf8, 0x85, 0x07, 0xd0, 0x0d, 0x93, 0x3a, 0x63, 0x16, 0x8f, 0xce, 0xf1, 0x6d, 0xb2,
+  0x7c, 0x68, 0x80, 0x16, 0xbe, 0x42, 0x48, 0x23, 0x14, 0xd5, 0x6b, 0x1e, 0x64, 0x8b, 0x26, 0x04,
+  0x97, 0xaf, 0x6c, 0x37, 0x13, 0xc8, 0xd3, 0xbe, 0x89, 0x51, 0x3a, 0x31, 0x9d, 0xb1, 0x27, 0x7a,
+  0x96, 0x3e, 0x0f, 0x1c, 0x56, 0x57, 0x50, 0xac, 0xb1, 0xca, 0x01, 0x34, 0xb8, 0xfa, 0xc0, 0x2a,
+  0x4b, 0x37, 0x46, 0x25, 0xe6, 0x8e, 0x91, 0x76, 0x23, 0x0d, 0x20, 0x40, 0x7a, 0x95, 0x4a, 0x0b,
+  0x0f, 0xff, 0x98, 0x77, 0x5a, 0x9d, 0x53, 0xd9, 0xa8, 0xf2, 0xe0, 0xc3, 0x2b, 0x13, 0x64, 0x4b,
+  0xc7, 0x1f, 0x2d, 0xfd, 0x1a, 0x44, 0xc7, 0x1b, 0xac, 0x53, 0x98, 0x49, 0x0f, 0x09, 0x85, 0xaa,
+  0x81, 0x4e, 0x86, 0xff, 0x28, 0xbc, 0xd3, 0x0c, 0x67, 0x3b, 0xc2, 0xf7, 0xb1, 0x58, 0x2e, 0x08,
+  0xfd, 0xbd, 0x00, 0xca, 0x74, 0x6f, 0xa6, 0x81, 0xc3, 0x4d, 0x00, 0x26, 0x24, 0xd4, 0x6c, 0x69,
+  0x78, 0x00, 0x54, 0x38, 0xec, 0x2b, 0xa3, 0x1d, 0xfe, 0xfd, 0x25, 0xe1, 0x4e, 0x73, 0x04, 0x99,
+  0x88, 0x74, 0x1b, 0x38, 0x7f, 0xfe, 0xc9, 0xf8, 0xb9, 0x30, 0xcf, 0x0a, 0x83, 0xa0, 0xaa, 0xd8,
+  0x39, 0xb5, 0xca, 0x65, 0xbb, 0x5d, 0x78, 0xa5, 0xd5, 0x51, 0xfb, 0x42, 0xd6, 0x69, 0x65, 0x94,
+  0x42, 0x87, 0x8c, 0x08, 0x0c, 0x7b, 0x96, 0x79, 0x22, 0x17, 0x29, 0x6f, 0x11, 0xaf, 0xd8, 0x7e,
+  0x30, 0x68, 0x77, 0x53, 0xd0, 0x4e, 0xff, 0x1e, 0x73, 0xf7, 0x4c, 0xde, 0x74, 0x9b, 0x5c, 0x2c,
+  0x1b, 0x72, 0x70, 0x5f, 0x1d, 0xce, 0xd5, 0x4e, 0x21, 0x82, 0xbc, 0x70, 0x1e, 0x6b, 0x1c, 0x15,
+  0x4f, 0xce, 0x8c, 0xa3, 0x02, 0xc8, 0x1f, 0xe5, 0x65, 0x04, 0x24, 0x14, 0x1f, 0xa0, 0x9c, 0x1f,
+  0x8b, 0x0f, 0x7d, 0x8f, 0xd9, 0xff, 0x24, 0xfd, 0x7f, 0xd9, 0xc8, 0x6d, 0x7e, 0x34, 0x3d, 0x00,
+  0x00,
+};
+
+#endif // WEB_UI_GZ_H
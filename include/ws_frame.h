@@ -0,0 +1,83 @@
+// WebSocket (RFC 6455) handshake and framing — shared by /ws and the native tests.
+// Only what the control channel needs: the Sec-WebSocket-Accept digest, an
+// incremental parser for masked client frames with small payloads, and
+// unmasked server frames. Fragmented messages are not supported.
+
+#ifndef WS_FRAME_H
+#define WS_FRAME_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "config.h"
+
+enum WsOpcode : uint8_t {
+  WS_OP_CONTINUATION = 0x0,
+  WS_OP_TEXT         = 0x1,
+  WS_OP_BINARY       = 0x2,
+  WS_OP_CLOSE        = 0x8,
+  WS_OP_PING         = 0x9,
+  WS_OP_PONG         = 0xA
+};
+
+// Close status codes sent back when a client frame is rejected.
+#define WS_CLOSE_NORMAL      1000
+#define WS_CLOSE_PROTOCOL    1002
+#define WS_CLOSE_UNSUPPORTED 1003
+#define WS_CLOSE_TOO_BIG     1009
+
+// SHA-1 digest of len bytes.
+void sha1(const uint8_t* data, size_t len, uint8_t out[20]);
+
+// Standard base64 with padding. Returns the length written, or 0 if it does not fit
+// in cap (including the terminating NUL).
+size_t base64Encode(const uint8_t* data, size_t len, char* out, size_t cap);
+
+// Sec-WebSocket-Accept for a client's Sec-WebSocket-Key: base64(SHA-1(key + GUID)).
+// out receives 28 characters plus NUL. False if the key is missing or oversized.
+bool wsAcceptKey(const char* clientKey, char out[29]);
+
+// Formats the 101 Switching Protocols response. Returns its length, or 0 if it does not fit.
+size_t formatWsHandshake(char* out, size_t cap, const char* clientKey);
+
+// Formats one unmasked server frame (FIN set). Returns its length, or 0 if it does not fit.
+size_t wsEncodeFrame(uint8_t* out, size_t cap, WsOpcode opcode, const uint8_t* payload, size_t len);
+
+enum WsParseState {
+  WS_PARSE_NEED_MORE,   // feed more bytes
+  WS_PARSE_FRAME,       // one complete frame is available — see opcode()/payload()
+  WS_PARSE_ERROR        // protocol violation — close with closeCode()
+};
+
+class WsFrameParser {
+public:
+  WsFrameParser();
+
+  // Drops any partial frame; call after consuming a complete one.
+  void reset();
+
+  // Appends bytes and advances parsing. Returns how many of len were consumed —
+  // fewer than len once a frame completes; the rest starts the next frame.
+  size_t feed(const uint8_t* data, size_t len);
+
+  WsParseState state() const { return state_; }
+  WsOpcode opcode() const { return opcode_; }
+  const uint8_t* payload() const { return payload_; }  // unmasked
+  size_t payloadLength() const { return payloadLen_; }
+  uint16_t closeCode() const { return closeCode_; }    // 1002 or 1009 after an error
+
+private:
+  uint8_t head_[14];                 // 2-byte header + extended length + mask key
+  size_t headLen_;
+  size_t headNeed_;                  // header bytes expected (known after byte 2)
+  uint8_t payload_[WS_MAX_PAYLOAD];
+  size_t payloadLen_;
+  size_t payloadGot_;
+  WsOpcode opcode_;
+  WsParseState state_;
+  uint16_t closeCode_;
+
+  void parseHead();
+  void fail(uint16_t code);
+};
+
+#endif // WS_FRAME_H
@@ -0,0 +1,47 @@
+#include "alias_table.h"
+
+// Empty table: always samples outcome 0.
+AliasTable::AliasTable() {
+  const uint8_t none = 0;
+  build(&none, 1, 0);
+}
+
+// Vose's method in exact integers: each weight is scaled by n so a full column is
+// worth total_, and underfull columns are topped up from overfull ones.
+void AliasTable::build(const uint8_t* weights, int n, uint8_t fallback) {
+  if (n > MAX_OUTCOMES) n = MAX_OUTCOMES;
+  uint32_t total = 0;
+  for (int i = 0; i < n; i++) total += weights[i];
+  if (n <= 0 || total == 0) {
+    n_ = 1;
+    total_ = 1;
+    prob_[0] = 0;
+    alias_[0] = fallback;
+    return;
+  }
+
+  uint32_t scaled[MAX_OUTCOMES];
+  uint8_t small[MAX_OUTCOMES], large[MAX_OUTCOMES];
+  int ns = 0, nl = 0;
+  for (int i = 0; i < n; i++) {
+    scaled[i] = (uint32_t)weights[i] * n;
+    if (scaled[i] < total) small[ns++] = (uint8_t)i;
+    else                   large[nl++] = (uint8_t)i;
+  }
+  while (ns > 0 && nl > 0) {
+    uint8_t s = small[--ns];
+    uint8_t l = large[nl - 1];
+    prob_[s] = (uint16_t)scaled[s];
+    alias_[s] = l;
+    scaled[l] -= total - scaled[s];
+    if (scaled[l] < total) {
+      nl--;
+      small[ns++] = l;
+    }
+  }
+  // Whatever is left is exactly full
+  while (nl > 0) { uint8_t l = large[--nl]; prob_[l] = (uint16_t)total; alias_[l] = l; }
+  while (ns > 0) { uint8_t s = small[--ns]; prob_[s] = (uint16_t)total; alias_[s] = s; }
+  n_ = (uint8_t)n;
+  total_ = (uint16_t)total;
+}
@@ -1,15 +1,17 @@
 #include "animations.h"
 #include "emotion_registry.h"
+#include "metrics.h"
 
 AnimationManager animationManager;
 
 // Initializes all animation slots to frame 0 with forward playback direction.
-AnimationManager::AnimationManager() {
+AnimationManager::AnimationManager() : frameSource_(nullptr), cachedEmotion_(-1) {
   for (int i = 0; i < EmotionRegistry::MAX_EMOTIONS; i++) {
     states_[i].frame = 0;
     states_[i].lastTick = 0;
     states_[i].direction = 1;
   }
+  resetFrameStats();
 }
 
 // Resets frame, tick timer, and playback direction for the given emotion's animation slot.
@@ -19,10 +21,14 @@ void AnimationManager::resetAnimation(EmotionState emotion) {
     states_[emotion].lastTick = 0;
     states_[emotion].direction = 1;
   }
+  // Something else (a transition) may have drawn since — the cache must not step from stale pixels.
+  cachedEmotion_ = -1;
 }
 
-// Advances the animation for the given emotion by one frame if the frame delay has elapsed.
-// Clears, draws via the registered draw function, and flushes the canvas. Returns true if a frame was rendered.
+// Advances the animation for the given emotion by one frame once its deadline has passed.
+// Streams the frame from the frame source when it has it, else clears and draws via the
+// registered draw function; then flushes the canvas, timing both into metrics.
+// Returns true if a frame was rendered.
 bool AnimationManager::tick(EmotionState emotion, ICanvas& canvas,
                             const void* context) {
   const EmotionDef* def = emotionRegistry.get(emotion);
@@ -36,11 +42,34 @@ bool AnimationManager::tick(EmotionState emotion, ICanvas& canvas,
     s.lastTick = now;
   }
 
-  if (now - s.lastTick < def->frameDelay) return false;
+  unsigned long due = s.lastTick + def->frameDelay;
+  if ((long)(now - due) < 0) return false;
 
-  canvas.clear();
-  def->drawFrame(canvas, s.frame, context);
+  // The first frame after a reset has no deadline to miss.
+  unsigned long late = now - due;
+  bool started = (s.lastTick != 0);
+  FrameStats& st = stats_[emotion];
+  st.frames++;
+  if (started) {
+    if (late > FRAME_DEADLINE_SLACK_MS) st.missed++;
+    if (late > st.maxLateMs) st.maxLateMs = (late > 0xFFFF) ? 0xFFFF : (uint16_t)late;
+  }
+
+  uint32_t frameStart = metricsCycles();
+  uint8_t* fb = (frameSource_ && !context) ? canvas.frameBuffer() : nullptr;
+  if (fb && frameSource_(emotion, s.frame, fb, cachedEmotion_ == (int)emotion)) {
+    cachedEmotion_ = emotion;
+  } else {
+    canvas.clear();
+    def->drawFrame(canvas, s.frame, context);
+    cachedEmotion_ = -1;
+  }
+  uint32_t drawnAt = metricsCycles();
   canvas.flush();
+  uint32_t flushedAt = metricsCycles();
+  metrics.record(METRIC_DRAW, emotion, Metrics::cyclesToUs(drawnAt - frameStart));
+  metrics.record(METRIC_FLUSH, emotion, Metrics::cyclesToUs(flushedAt - drawnAt));
+  metrics.record(METRIC_FRAME, emotion, Metrics::cyclesToUs(flushedAt - frameStart));
 
   // Advance frame
   if (def->loop == LOOP_RESTART) {
@@ -57,6 +86,32 @@ bool AnimationManager::tick(EmotionState emotion, ICanvas& canvas,
       s.direction = 1;
     }
   }
-  s.lastTick = now;
+
+  // Stay on the deadline grid so loop jitter doesn't stretch the frame rate;
+  // resync to now on the first frame or after falling a whole frame behind.
+  s.lastTick = (!started || late >= def->frameDelay) ? now : due;
   return true;
 }
+
+// Returns when the next frame of the emotion is due; unknown emotions report a deadline of now.
+unsigned long AnimationManager::nextDeadline(EmotionState emotion) const {
+  const EmotionDef* def = emotionRegistry.get(emotion);
+  if (!def || !def->drawFrame) return millis();
+  return states_[emotion].lastTick + def->frameDelay;
+}
+
+// Returns the frame-rate counters for an emotion; out-of-range ids share an empty slot.
+const FrameStats& AnimationManager::getFrameStats(EmotionState emotion) const {
+  static const FrameStats empty = {0, 0, 0};
+  if ((int)emotion < 0 || (int)emotion >= EmotionRegistry::MAX_EMOTIONS) return empty;
+  return stats_[emotion];
+}
+
+// Zeroes the frame-rate counters of every emotion.
+void AnimationManager::resetFrameStats() {
+  for (int i = 0; i < EmotionRegistry::MAX_EMOTIONS; i++) {
+    stats_[i].frames = 0;
+    stats_[i].missed = 0;
+    stats_[i].maxLateMs = 0;
+  }
+}
@@ -1,48 +1,45 @@
 #include "ble_control.h"
-#include "emotion_registry.h"
 #include <NimBLEDevice.h>
 
 BleControl bleControl;
 
-static BleEmotionFn s_callback = nullptr;
-static uint8_t s_currentEmotion = 0;
+static BleWriteFn s_onWrite = nullptr;
+static NimBLECharacteristic* s_controlChar = nullptr;
+static NimBLECharacteristic* s_stateChar = nullptr;
 
-#define SERVICE_UUID "face0001-0000-1000-8000-00805f9b34fb"
-#define CHAR_UUID    "face0002-0000-1000-8000-00805f9b34fb"
+#define SERVICE_UUID    "face0001-0000-1000-8000-00805f9b34fb"
+#define CHAR_UUID       "face0002-0000-1000-8000-00805f9b34fb"  // READ current emotion | WRITE commands
+#define STATE_CHAR_UUID "face0003-0000-1000-8000-00805f9b34fb"  // READ | NOTIFY 9-byte STATE
 
-class EmotionCallbacks : public NimBLECharacteristicCallbacks {
-  // Validates the written emotion ID and fires the registered emotion callback if valid.
+class ControlCallbacks : public NimBLECharacteristicCallbacks {
+  // Hands the raw write to the registered callback; decoding happens there.
   void onWrite(NimBLECharacteristic* pChar) override {
     std::string val = pChar->getValue();
-    if (val.length() >= 1) {
-      uint8_t id = (uint8_t)val[0];
-      if (emotionRegistry.get((EmotionState)id) != nullptr && s_callback) {
-        s_callback((EmotionState)id);
-      }
+    if (s_onWrite && !val.empty()) {
+      s_onWrite((const uint8_t*)val.data(), val.length());
     }
   }
-  // Responds to a BLE read request with the current emotion ID byte.
-  void onRead(NimBLECharacteristic* pChar) override {
-    pChar->setValue(&s_currentEmotion, 1);
-  }
 };
 
-static EmotionCallbacks s_charCallbacks;
+static ControlCallbacks s_charCallbacks;
 
-// Initializes NimBLE, creates the emotion service and characteristic, and starts advertising as "SANGI".
-void BleControl::init(BleEmotionFn onEmotion) {
-  onEmotion_ = onEmotion;
-  s_callback = onEmotion;
+// Initializes NimBLE, creates the control and state characteristics, and starts advertising as "SANGI".
+void BleControl::init(BleWriteFn onWrite) {
+  onWrite_ = onWrite;
+  s_onWrite = onWrite;
 
   NimBLEDevice::init("SANGI");
   NimBLEDevice::setPower(ESP_PWR_LVL_P3);
 
   NimBLEServer* pServer = NimBLEDevice::createServer();
   NimBLEService* pService = pServer->createService(SERVICE_UUID);
-  NimBLECharacteristic* pChar = pService->createCharacteristic(
+  s_controlChar = pService->createCharacteristic(
       CHAR_UUID,
       NIMBLE_PROPERTY::READ | NIMBLE_PROPERTY::WRITE);
-  pChar->setCallbacks(&s_charCallbacks);
+  s_controlChar->setCallbacks(&s_charCallbacks);
+  s_stateChar = pService->createCharacteristic(
+      STATE_CHAR_UUID,
+      NIMBLE_PROPERTY::READ | NIMBLE_PROPERTY::NOTIFY);
   pService->start();
 
   NimBLEAdvertising* pAdv = NimBLEDevice::getAdvertising();
@@ -53,7 +50,12 @@ void BleControl::init(BleEmotionFn onEmotion) {
   Serial.println("BLE: advertising as 'SANGI'");
 }
 
-// Updates the cached current emotion ID so subsequent BLE reads reflect the latest state.
-void BleControl::updateCurrentEmotion(uint8_t emotionId) {
-  s_currentEmotion = emotionId;
+// Sets the legacy one-byte emotion value and the STATE value, then notifies STATE subscribers.
+void BleControl::publishState(const ControlState& state) {
+  if (!s_controlChar || !s_stateChar) return;
+  uint8_t msg[CTRL_STATE_BYTES];
+  size_t n = encodeControlState(msg, sizeof(msg), state);
+  s_controlChar->setValue(&state.emotion, 1);
+  s_stateChar->setValue(msg, n);
+  s_stateChar->notify();
 }
@@ -0,0 +1,85 @@
+#include "ble_proto.h"
+#include "input.h"
+#include "runtime_config.h"
+
+static_assert(1 + SCRIPT_MAX_STEPS <= COMMAND_QUEUE_SIZE, "a SEQUENCE must fit in the command queue");
+
+// Reads a little-endian 16-bit value.
+static uint16_t readLe16(const uint8_t* p) {
+  return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+// Reads a little-endian 32-bit value.
+static uint32_t readLe32(const uint8_t* p) {
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// Walks the records once, posting them only when q is set. Returns the first problem found.
+static ControlStatus walkBatch(const uint8_t* data, size_t len, CommandQueue* q, uint32_t now) {
+  size_t i = 1;  // past the version byte
+  bool ok = true;
+  while (i < len) {
+    uint8_t op = data[i++];
+    size_t left = len - i;
+    switch (op) {
+      case BLE_OP_SET_EMOTION:
+      case BLE_OP_GESTURE:
+        if (left < 1) return CTRL_BAD_LENGTH;
+        if (op == BLE_OP_GESTURE && (data[i] < GESTURE_TAP || data[i] > GESTURE_DOUBLE_TAP)) {
+          return CTRL_BAD_VALUE;
+        }
+        if (q) ok &= q->post(op == BLE_OP_GESTURE ? CMD_GESTURE : CMD_SET_EMOTION,
+                             CMD_SRC_BLE, data[i], now);
+        i += 1;
+        break;
+      case BLE_OP_CONFIG:
+        if (left < 5) return CTRL_BAD_LENGTH;
+        if (data[i] >= CFG_FIELD_COUNT) return CTRL_BAD_VALUE;
+        if (q) ok &= q->post(CMD_SET_CONFIG, CMD_SRC_BLE, data[i], now, readLe32(data + i + 1));
+        i += 5;
+        break;
+      case BLE_OP_SEQUENCE: {
+        if (left < 1) return CTRL_BAD_LENGTH;
+        uint8_t n = data[i];
+        if (n == 0 || n > SCRIPT_MAX_STEPS) return CTRL_BAD_VALUE;
+        if (left < 1 + 3u * n) return CTRL_BAD_LENGTH;
+        if (q) {
+          // one batch, so a full queue can't leave a truncated script to play
+          Command script[1 + SCRIPT_MAX_STEPS];
+          script[0] = Command{CMD_SCRIPT_BEGIN, CMD_SRC_BLE, n, now, 0};
+          for (uint8_t s = 0; s < n; s++) {
+            const uint8_t* step = data + i + 1 + 3 * s;
+            script[1 + s] = Command{CMD_SCRIPT_STEP, CMD_SRC_BLE, step[0], now, readLe16(step + 1)};
+          }
+          ok &= q->postBatch(script, 1u + n);
+        }
+        i += 1 + 3u * n;
+        break;
+      }
+      default:
+        return CTRL_UNKNOWN_OP;
+    }
+  }
+  return ok ? CTRL_OK : CTRL_BUSY;
+}
+
+// A dry run validates the whole batch; only then is it posted.
+ControlStatus decodeBleWrite(const uint8_t* data, size_t len, CommandQueue& q, uint32_t now) {
+  if (len == 0) return CTRL_BAD_LENGTH;
+  if (len == 1) {
+    return q.post(CMD_SET_EMOTION, CMD_SRC_BLE, data[0], now) ? CTRL_OK : CTRL_BUSY;
+  }
+  if (data[0] != BLE_PROTO_VERSION) return CTRL_BAD_VERSION;
+  ControlStatus st = walkBatch(data, len, nullptr, now);
+  if (st != CTRL_OK) return st;
+  return walkBatch(data, len, &q, now);
+}
+
+// Compares against the last values seen, then remembers the new ones.
+bool StateChangeFilter::update(uint8_t emotion, uint8_t stage) {
+  if (primed_ && emotion == emotion_ && stage == stage_) return false;
+  primed_ = true;
+  emotion_ = emotion;
+  stage_ = stage;
+  return true;
+}
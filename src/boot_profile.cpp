@@ -0,0 +1,35 @@
+#include "boot_profile.h"
+#include <stdio.h>
+
+BootProfile bootProfile;
+
+// Starts with no phases recorded.
+BootProfile::BootProfile() : count_(0) {}
+
+// Records the phase's end time; the phase began where the previous one ended.
+void BootProfile::mark(const char* phase, uint32_t nowUs) {
+  if (count_ >= MAX_PHASES) return;
+  names_[count_] = phase;
+  ends_[count_] = nowUs;
+  count_++;
+}
+
+// Milliseconds with one decimal, phases in order, then the total.
+size_t BootProfile::format(char* out, size_t cap) const {
+  if (cap == 0) return 0;
+  size_t n = 0;
+  out[0] = '\0';
+  for (int i = 0; i < count_ && n < cap; i++) {
+    uint32_t us = durationUs(i);
+    int w = snprintf(out + n, cap - n, "%s %lu.%lu | ", names_[i],
+                     (unsigned long)(us / 1000), (unsigned long)(us % 1000 / 100));
+    if (w < 0) return n;
+    n += (size_t)w;
+  }
+  if (n < cap) {
+    int w = snprintf(out + n, cap - n, "total %lu.%lu ms",
+                     (unsigned long)(totalUs() / 1000), (unsigned long)(totalUs() % 1000 / 100));
+    if (w > 0) n += (size_t)w;
+  }
+  return n < cap ? n : cap - 1;
+}
@@ -0,0 +1,34 @@
+#include "clock_service.h"
+#include <time.h>
+
+ClockService clockService;
+
+// Any time before 2020 means the clock was never set (no RTC; it starts at 1970).
+static const time_t CLOCK_MIN_VALID_EPOCH = 1577836800;
+
+// Non-blocking: time() and localtime_r() only read the system clock.
+bool systemLocalHour(int& hour) {
+  time_t t = time(nullptr);
+  if (t < CLOCK_MIN_VALID_EPOCH) return false;
+  struct tm ti;
+  localtime_r(&t, &ti);
+  hour = ti.tm_hour;
+  return true;
+}
+
+// Uptime hour 0 until the first tick().
+ClockService::ClockService()
+  : source_(nullptr), hour_(0), wallClock_(false), refreshPending_(false),
+    everRefreshed_(false), lastRefresh_(0), refreshes_(0) {}
+
+// The only place the wall clock is read.
+void ClockService::tick(unsigned long now) {
+  if (everRefreshed_ && !refreshPending_ && now - lastRefresh_ < CLOCK_REFRESH_MS) return;
+  int h = 0;
+  wallClock_ = source_ && source_(h);
+  hour_ = wallClock_ ? h : (int)((now / HOUR_IN_MILLIS) % 24);
+  lastRefresh_ = now;
+  everRefreshed_ = true;
+  refreshPending_ = false;
+  refreshes_++;
+}
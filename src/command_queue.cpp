@@ -0,0 +1,108 @@
+#include "command_queue.h"
+
+CommandQueue commandQueue;
+
+// Every cell starts free for the producer that will claim its position.
+CommandQueue::CommandQueue()
+  : enqueuePos_(0), dequeuePos_(0), posted_(0), dropped_(0), coalesced_(0) {
+  for (uint32_t i = 0; i < CAPACITY; i++) {
+    cells_[i].seq.store(i, std::memory_order_relaxed);
+    cells_[i].cmd = Command{CMD_NONE, 0, 0, 0, 0};
+  }
+}
+
+// Claims the next cell with a CAS on the enqueue index, fills it, then publishes it via seq.
+bool CommandQueue::post(uint8_t type, uint8_t source, uint8_t arg, uint32_t time, uint32_t value) {
+  uint32_t pos = enqueuePos_.load(std::memory_order_relaxed);
+  Cell* cell;
+  for (;;) {
+    cell = &cells_[pos & (CAPACITY - 1)];
+    uint32_t seq = cell->seq.load(std::memory_order_acquire);
+    int32_t dif = (int32_t)(seq - pos);
+    if (dif == 0) {
+      if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+    } else if (dif < 0) {
+      dropped_.fetch_add(1, std::memory_order_relaxed);  // consumer hasn't freed this cell yet
+      return false;
+    } else {
+      pos = enqueuePos_.load(std::memory_order_relaxed);  // another producer took it
+    }
+  }
+  cell->cmd = Command{type, source, arg, time, value};
+  cell->seq.store(pos + 1, std::memory_order_release);
+  posted_.fetch_add(1, std::memory_order_relaxed);
+  return true;
+}
+
+// Claims n consecutive cells with one CAS, fills them back to front and publishes the
+// first cell last, so the consumer never sees a partial batch.
+bool CommandQueue::postBatch(const Command* cmds, uint32_t n) {
+  if (n == 0) return true;
+  if (n > CAPACITY) {
+    dropped_.fetch_add(n, std::memory_order_relaxed);
+    return false;
+  }
+  uint32_t pos = enqueuePos_.load(std::memory_order_relaxed);
+  for (;;) {
+    uint32_t k = 0;
+    int32_t dif = 0;
+    for (; k < n; k++) {
+      dif = (int32_t)(cells_[(pos + k) & (CAPACITY - 1)].seq.load(std::memory_order_acquire) - (pos + k));
+      if (dif != 0) break;
+    }
+    if (k == n) {
+      if (enqueuePos_.compare_exchange_weak(pos, pos + n, std::memory_order_relaxed)) break;
+    } else if (dif < 0) {
+      dropped_.fetch_add(n, std::memory_order_relaxed);  // not enough freed cells for the whole batch
+      return false;
+    } else {
+      pos = enqueuePos_.load(std::memory_order_relaxed);  // another producer took some of them
+    }
+  }
+  for (uint32_t k = n; k-- > 0;) {
+    Cell& cell = cells_[(pos + k) & (CAPACITY - 1)];
+    cell.cmd = cmds[k];
+    cell.seq.store(pos + k + 1, std::memory_order_release);
+  }
+  posted_.fetch_add(n, std::memory_order_relaxed);
+  return true;
+}
+
+// Reads the oldest cell once its producer has published it, then frees it for the next lap.
+bool CommandQueue::pop(Command& out) {
+  Cell& cell = cells_[dequeuePos_ & (CAPACITY - 1)];
+  uint32_t seq = cell.seq.load(std::memory_order_acquire);
+  if ((int32_t)(seq - (dequeuePos_ + 1)) < 0) return false;
+  out = cell.cmd;
+  cell.seq.store(dequeuePos_ + CAPACITY, std::memory_order_release);
+  dequeuePos_++;
+  return true;
+}
+
+// True when the next cell hasn't been published (empty, or a producer is mid-write).
+bool CommandQueue::empty() const {
+  const Cell& cell = cells_[dequeuePos_ & (CAPACITY - 1)];
+  return (int32_t)(cell.seq.load(std::memory_order_acquire) - (dequeuePos_ + 1)) < 0;
+}
+
+// Bounded to one queue's worth so a producer flooding the queue can't pin the consumer.
+CommandDrain CommandQueue::drain(CommandFn fn, void* ctx) {
+  CommandDrain d = {0, 0, -1, 0};
+  Command cmd;
+  for (uint32_t i = 0; i < CAPACITY && pop(cmd); i++) {
+    d.handled++;
+    if (cmd.type == CMD_SCRIPT_BEGIN && d.emotion >= 0) {
+      d.coalesced++;  // the script's first step replaces it
+      d.emotion = -1;
+    }
+    int want = -1;
+    if (cmd.type == CMD_SET_EMOTION) want = cmd.arg;
+    else if (fn) want = fn(cmd, ctx);
+    if (want < 0) continue;
+    if (d.emotion >= 0) d.coalesced++;
+    d.emotion = want;
+    d.source = cmd.source;
+  }
+  coalesced_ += d.coalesced;
+  return d;
+}
@@ -0,0 +1,50 @@
+#include "control_proto.h"
+#include "input.h"
+
+// Length check per opcode, then the gesture range.
+ControlStatus decodeControlCommand(const uint8_t* data, size_t len, ControlCommand& cmd) {
+  cmd.op = (ControlOp)(len > 0 ? data[0] : 0);
+  cmd.seq = len > 1 ? data[1] : 0;
+  cmd.arg = 0;
+  if (len < 2) return CTRL_BAD_LENGTH;
+
+  switch (cmd.op) {
+    case CTRL_SET_EMOTION:
+    case CTRL_GESTURE:
+    case CTRL_MIRROR:
+      if (len != 3) return CTRL_BAD_LENGTH;
+      cmd.arg = data[2];
+      if (cmd.op == CTRL_GESTURE &&
+          (cmd.arg < GESTURE_TAP || cmd.arg > GESTURE_DOUBLE_TAP)) {
+        return CTRL_BAD_VALUE;
+      }
+      if (cmd.op == CTRL_MIRROR && cmd.arg > 1) return CTRL_BAD_VALUE;
+      return CTRL_OK;
+    case CTRL_QUERY:
+      return len == 2 ? CTRL_OK : CTRL_BAD_LENGTH;
+    default:
+      return CTRL_UNKNOWN_OP;
+  }
+}
+
+// [ACK][seq][op][status]
+size_t encodeControlAck(uint8_t* out, size_t cap, uint8_t seq, uint8_t op, ControlStatus status) {
+  if (cap < CTRL_ACK_BYTES) return 0;
+  out[0] = CTRL_ACK;
+  out[1] = seq;
+  out[2] = op;
+  out[3] = status;
+  return CTRL_ACK_BYTES;
+}
+
+// [STATE][emotion][stage][mV LE16][uptime LE32]
+size_t encodeControlState(uint8_t* out, size_t cap, const ControlState& state) {
+  if (cap < CTRL_STATE_BYTES) return 0;
+  out[0] = CTRL_STATE;
+  out[1] = state.emotion;
+  out[2] = state.attentionStage;
+  out[3] = (uint8_t)state.batteryMv;
+  out[4] = (uint8_t)(state.batteryMv >> 8);
+  for (int i = 0; i < 4; i++) out[5 + i] = (uint8_t)(state.uptimeMs >> (8 * i));
+  return CTRL_STATE_BYTES;
+}
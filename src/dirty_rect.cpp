@@ -0,0 +1,40 @@
+#include "dirty_rect.h"
+#include <string.h>
+
+// Scans page by page; untouched pages are rejected with one memcmp each.
+bool findDirtyRect(const uint8_t* cur, const uint8_t* prev, int width,
+                   int pages, DirtyRect& out) {
+  int col0 = width, col1 = -1, page0 = pages, page1 = -1;
+
+  for (int p = 0; p < pages; p++) {
+    const uint8_t* c = cur + p * width;
+    const uint8_t* q = prev + p * width;
+    if (memcmp(c, q, width) == 0) continue;
+
+    int first = 0;
+    while (c[first] == q[first]) first++;
+    int last = width - 1;
+    while (c[last] == q[last]) last--;
+
+    if (first < col0) col0 = first;
+    if (last > col1) col1 = last;
+    if (p < page0) page0 = p;
+    page1 = p;
+  }
+
+  if (page1 < 0) return false;
+  out.col0 = (uint8_t)col0;
+  out.col1 = (uint8_t)col1;
+  out.page0 = (uint8_t)page0;
+  out.page1 = (uint8_t)page1;
+  return true;
+}
+
+// Copies one row segment per page covered by the window.
+void copyDirtyRect(uint8_t* dst, const uint8_t* src, int width,
+                   const DirtyRect& r) {
+  for (int p = r.page0; p <= r.page1; p++) {
+    size_t offset = (size_t)p * width + r.col0;
+    memcpy(dst + offset, src + offset, r.widthCols());
+  }
+}
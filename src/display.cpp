@@ -1,10 +1,17 @@
 #include "display.h"
+#include "face.h"
 
 DisplayManager displayManager;
 
 // Constructs the Adafruit_SSD1306 instance with configured screen dimensions and I2C reset pin.
 DisplayManager::DisplayManager()
-  : display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET) {
+  : display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET),
+    flushedBytes_(0),
+    skippedFlushes_(0),
+    busBusyUs_(0),
+    maxSendUs_(0),
+    flushTask_(nullptr) {
+  memset(shadow_, 0, sizeof(shadow_));
 }
 
 // Initializes I2C bus, scans for devices, and starts the SSD1306 OLED. Returns false if init fails.
@@ -20,6 +27,11 @@ bool DisplayManager::init() {
     return false;
   }
 
+  // Push one full blank frame so the shadow copy matches what the panel shows.
+  display.clearDisplay();
+  display.display();
+  memset(shadow_, 0, sizeof(shadow_));
+
   Serial.println("OLED initialized successfully!");
   return true;
 }
@@ -123,12 +135,12 @@ void DisplayManager::showBootScreen() {
 
   // Blink-out into IDLE — reuses the standard transition timing so the seam is invisible.
   // Frame 1-3: close eyes from confused face
-  display.clearDisplay(); drawEyes(38, 28, 90, 28, 16); display.display(); delay(100);
-  display.clearDisplay(); drawEyes(38, 29, 90, 29, 10); display.display(); delay(100);
-  display.clearDisplay(); drawEyes(38, 30, 90, 30,  4); display.display(); delay(200);
+  clear(); drawEyes(38, 28, 90, 28, 16); flush(); delay(100);
+  clear(); drawEyes(38, 29, 90, 29, 10); flush(); delay(100);
+  clear(); drawEyes(38, 30, 90, 30,  4); flush(); delay(200);
   // Frame 4-5: open eyes symmetrically
-  display.clearDisplay(); drawEyes(38, 29, 90, 29, 10); display.display(); delay(120);
-  display.clearDisplay(); drawEyes(38, 28, 90, 28, 18); display.display(); delay(120);
+  clear(); drawEyes(38, 29, 90, 29, 10); flush(); delay(120);
+  clear(); drawEyes(38, 28, 90, 28, 18); flush(); delay(120);
   // Frame 6: land on IDLE — loop() picks up from here
   drawEmotionFace(EMOTION_IDLE);
   delay(200);
@@ -139,8 +151,90 @@ void DisplayManager::showBootScreen() {
 // Clears the display buffer.
 void DisplayManager::clear() { display.clearDisplay(); }
 
-// Flushes the display buffer to the OLED hardware.
-void DisplayManager::flush() { display.display(); }
+// Hands the frame to the display task when it is running, otherwise sends it in place.
+void DisplayManager::flush() {
+  if (flushTask_) {
+    handoff_.publish(display.getBuffer());
+    xTaskNotifyGive(flushTask_);
+    return;
+  }
+  sendFrame(display.getBuffer());
+}
+
+// Starts the display task; returns false (flush stays synchronous) if it cannot be created.
+bool DisplayManager::startFlushTask() {
+#if ENABLE_ASYNC_FLUSH
+  if (flushTask_) return true;
+  TaskHandle_t task = nullptr;
+  if (xTaskCreate(flushTaskEntry, "oled_flush", DISPLAY_TASK_STACK, this,
+                  DISPLAY_TASK_PRIORITY, &task) != pdPASS) {
+    Serial.println("[DISPLAY] flush task failed to start — flushing synchronously");
+    return false;
+  }
+  flushTask_ = task;
+  return true;
+#else
+  return false;
+#endif
+}
+
+// Display task body: sleeps until notified, then sends the newest handed-off frame.
+void DisplayManager::flushTaskEntry(void* self) {
+  DisplayManager* dm = static_cast<DisplayManager*>(self);
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    const uint8_t* frame;
+    while ((frame = dm->handoff_.take()) != nullptr) {
+      dm->sendFrame(frame);
+    }
+  }
+}
+
+// Pushes only the changed window to the OLED; identical frames skip the I2C transfer entirely.
+void DisplayManager::sendFrame(const uint8_t* frame) {
+  DirtyRect r;
+  if (!findDirtyRect(frame, shadow_, SCREEN_WIDTH, SCREEN_HEIGHT / 8, r)) {
+    skippedFlushes_++;
+    return;
+  }
+  uint32_t start = micros();
+  sendWindow(frame, r);
+  uint32_t took = micros() - start;
+  busBusyUs_ += took;
+  if (took > maxSendUs_) maxSendUs_ = took;
+  copyDirtyRect(shadow_, frame, SCREEN_WIDTH, r);
+  flushedBytes_ += r.byteCount();
+}
+
+// Sets the SSD1306 page/column address window, then streams its bytes in Wire-buffer-sized chunks.
+// Horizontal addressing mode wraps each page row back to col0, so the window is one contiguous stream.
+void DisplayManager::sendWindow(const uint8_t* frame, const DirtyRect& r) {
+  display.ssd1306_command(SSD1306_PAGEADDR);
+  display.ssd1306_command(r.page0);
+  display.ssd1306_command(r.page1);
+  display.ssd1306_command(SSD1306_COLUMNADDR);
+  display.ssd1306_command(r.col0);
+  display.ssd1306_command(r.col1);
+
+  Wire.setClock(OLED_I2C_CLOCK_HZ);
+  Wire.beginTransmission(SCREEN_ADDRESS);
+  Wire.write((uint8_t)0x40);  // Co=0, D/C#=1: data stream follows
+  int used = 1;
+  for (int p = r.page0; p <= r.page1; p++) {
+    const uint8_t* row = frame + p * SCREEN_WIDTH + r.col0;
+    for (int c = 0; c < r.widthCols(); c++) {
+      if (used >= OLED_I2C_CHUNK_BYTES) {
+        Wire.endTransmission();
+        Wire.beginTransmission(SCREEN_ADDRESS);
+        Wire.write((uint8_t)0x40);
+        used = 1;
+      }
+      Wire.write(row[c]);
+      used++;
+    }
+  }
+  Wire.endTransmission();
+}
 
 // Draws a filled rounded rectangle.
 void DisplayManager::fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h,
@@ -214,37 +308,37 @@ void DisplayManager::println(const char* text) { display.println(text); }
 
 // Draws the neutral idle face: two standard-size eyes, no mouth decoration.
 void DisplayManager::drawFace_Normal() {
-  display.clearDisplay();
+  clear();
   drawEyes(40, 28, 88, 28, 20);
-  display.display();
+  flush();
 }
 
 // Draws the happy face: slightly squinted eyes and a wide smile bar.
 void DisplayManager::drawFace_Happy() {
-  display.clearDisplay();
+  clear();
   drawEyes(40, 28, 88, 28, 16);
   display.fillRoundRect(50, 48, 28, 8, 4, SSD1306_WHITE);
-  display.display();
+  flush();
 }
 
 // Draws the blink face: eyes nearly shut (height=4), used during transition animations.
 void DisplayManager::drawFace_Blink() {
-  display.clearDisplay();
+  clear();
   drawEyes(40, 28, 88, 28, 4);
-  display.display();
+  flush();
 }
 
 // Draws the sad face: normal eyes with a narrow frown bar.
 void DisplayManager::drawFace_Sad() {
-  display.clearDisplay();
+  clear();
   drawEyes(40, 28, 88, 28, 20);
   display.fillRoundRect(54, 52, 20, 5, 2, SSD1306_WHITE);  // Smaller mouth
-  display.display();
+  flush();
 }
 
 // Draws the angry face: narrowed eyes, thick angled brows, and a flat frown.
 void DisplayManager::drawFace_Angry() {
-  display.clearDisplay();
+  clear();
 
   // Angry narrowed eyes (smaller, more intense)
   drawEyes(40, 32, 88, 32, 12);
@@ -262,12 +356,12 @@ void DisplayManager::drawFace_Angry() {
   // Simple frown mouth (small horizontal line low on face)
   display.fillRoundRect(52, 50, 24, 5, 2, SSD1306_WHITE);
 
-  display.display();
+  flush();
 }
 
 // Draws the love face: heart-shaped eyes and a wide smile bar.
 void DisplayManager::drawFace_Love() {
-  display.clearDisplay();
+  clear();
   // Left heart eye
   display.fillCircle(34, 26, 7, SSD1306_WHITE);      // Left circle
   display.fillCircle(44, 26, 7, SSD1306_WHITE);      // Right circle
@@ -281,12 +375,12 @@ void DisplayManager::drawFace_Love() {
   display.fillTriangle(75, 32, 87, 40, 99, 32, SSD1306_WHITE);  // Bottom point
 
   display.fillRoundRect(48, 50, 32, 8, 4, SSD1306_WHITE);
-  display.display();
+  flush();
 }
 
 // Draws the sleepy face: half-closed eyes, a yawn circle, and floating Z letters.
 void DisplayManager::drawFace_Sleepy() {
-  display.clearDisplay();
+  clear();
   drawEyes(40, 30, 88, 30, 8);
   display.drawCircle(64, 48, 6, SSD1306_WHITE);
   display.setTextSize(1);
@@ -298,22 +392,22 @@ void DisplayManager::drawFace_Sleepy() {
   display.print("Z");
   display.setCursor(118, 6);
   display.print("z");
-  display.display();
+  flush();
 }
 
 // Draws the excited face: wide eyes with pupils and a large open mouth.
 void DisplayManager::drawFace_Excited() {
-  display.clearDisplay();
+  clear();
   drawEyes(40, 28, 88, 28, 24);
   display.fillCircle(40, 28, 3, SSD1306_BLACK);
   display.fillCircle(88, 28, 3, SSD1306_BLACK);
   display.fillRoundRect(45, 50, 38, 10, 5, SSD1306_WHITE);
-  display.display();
+  flush();
 }
 
 // Draws the confused face: asymmetric eyes (one tall, one short) and a question mark.
 void DisplayManager::drawFace_Confused() {
-  display.clearDisplay();
+  clear();
   display.fillRoundRect(30, 24, 20, 20, 5, SSD1306_WHITE);
   display.fillRoundRect(78, 26, 20, 12, 5, SSD1306_WHITE);
   // Simple filled mouth (24px wide, matches other emotions)
@@ -322,12 +416,12 @@ void DisplayManager::drawFace_Confused() {
   display.setTextSize(2);
   display.setCursor(108, 20);
   display.print("?");
-  display.display();
+  flush();
 }
 
 // Draws the thinking face: normal eyes with a small mouth and an exclamation mark.
 void DisplayManager::drawFace_Thinking() {
-  display.clearDisplay();
+  clear();
   // Normal eyes (original size)
   display.fillRoundRect(35, 22, 18, 20, 5, SSD1306_WHITE);
   display.fillRoundRect(83, 22, 18, 20, 5, SSD1306_WHITE);
@@ -336,35 +430,35 @@ void DisplayManager::drawFace_Thinking() {
   display.setTextSize(2);
   display.setCursor(108, 20);
   display.print("!");
-  display.display();
+  flush();
 }
 
 // Draws the dead face: X-shaped eyes and a small rectangular tongue.
 void DisplayManager::drawFace_Dead() {
-  display.clearDisplay();
+  clear();
   display.drawLine(32, 22, 48, 34, SSD1306_WHITE);
   display.drawLine(48, 22, 32, 34, SSD1306_WHITE);
   display.drawLine(80, 22, 96, 34, SSD1306_WHITE);
   display.drawLine(96, 22, 80, 34, SSD1306_WHITE);
   display.fillRoundRect(58, 46, 12, 14, 3, SSD1306_WHITE);
-  display.display();
+  flush();
 }
 
 // Draws the surprised face: wide eyes with centered pupils and a circular open mouth.
 void DisplayManager::drawFace_Surprised() {
-  display.clearDisplay();
+  clear();
   // Wide eyes with centered pupils (eyes: y=18, height=28, center y = 32)
   display.fillRoundRect(33, 18, 18, 28, 5, SSD1306_WHITE);
   display.fillRoundRect(81, 18, 18, 28, 5, SSD1306_WHITE);
   display.fillCircle(42, 32, 3, SSD1306_BLACK);  // Left pupil centered
   display.fillCircle(90, 32, 3, SSD1306_BLACK);  // Right pupil centered
   display.fillCircle(64, 50, 6, SSD1306_WHITE);
-  display.display();
+  flush();
 }
 
 // Draws a static notification box with title and message text; no animated eyes in this frame.
 void DisplayManager::drawFace_Notification(const char* title, const char* message) {
-  display.clearDisplay();
+  clear();
 
   // ===== NOTIFICATION BOX ONLY (No peeking eyes) =====
   // The peeking eyes only appear during the animateNotification() animation
@@ -418,7 +512,7 @@ void DisplayManager::drawFace_Notification(const char* title, const char* messag
     display.print(truncMessage);
   }
 
-  display.display();
+  flush();
 }
 
 // Dispatches to the appropriate static drawFace_* function based on the given emotion state.
@@ -469,8 +563,8 @@ void DisplayManager::drawEmotionFace(EmotionState emotion) {
   }
 }
 
-// Transition animation — decoupled from EmotionManager.
-// Returns TR_DREW_FRAME (caller should advance) or TR_COMPLETE (caller should complete).
+// Draws one blink-transition frame without waiting; TransitionPlayer holds it for TRANSITION_FRAME_HOLD_MS.
+// Returns TR_DREW_FRAME (caller should advance) or TR_COMPLETE (final frame drawn).
 TransitionResult DisplayManager::performTransitionFrame(int frame,
                                                          EmotionState current,
                                                          EmotionState target) {
@@ -479,46 +573,52 @@ TransitionResult DisplayManager::performTransitionFrame(int frame,
     return sleepyTransitionFrame(frame, target);
   }
 
+#if FACE_MORPH_TRANSITIONS
+  // Both ends drawn by the face grammar: blend their opening poses feature by feature
+  FaceParams from, to;
+  if (faceParamsFor(current, 0, from) && faceParamsFor(target, 0, to)) {
+    FaceParams face;
+    morphFace(from, to, frame < FACE_MORPH_STEPS ? frame : FACE_MORPH_STEPS, FACE_MORPH_STEPS, face);
+    clear();
+    drawFace(*this, face);
+    flush();
+    return frame < FACE_MORPH_STEPS ? TR_DREW_FRAME : TR_COMPLETE;
+  }
+#endif
+
   // Standard 7-frame blink transition — new face grammar (eyes at 38/90, w=24, r=7)
   // Close: 22→16→10→4 (fast, eased). Open: 4→10→18 (slightly slower). Total ~1040ms.
   switch (frame) {
     case 0:
       drawEmotionFace(current);
-      delay(200);
       return TR_DREW_FRAME;
     case 1:
-      display.clearDisplay();
+      clear();
       drawEyes(38, 28, 90, 28, 16);
-      display.display();
-      delay(100);
+      flush();
       return TR_DREW_FRAME;
     case 2:
-      display.clearDisplay();
+      clear();
       drawEyes(38, 29, 90, 29, 10);
-      display.display();
-      delay(100);
+      flush();
       return TR_DREW_FRAME;
     case 3:
-      display.clearDisplay();
+      clear();
       drawEyes(38, 30, 90, 30, 4);
-      display.display();
-      delay(200);
+      flush();
       return TR_DREW_FRAME;
     case 4:
-      display.clearDisplay();
+      clear();
       drawEyes(38, 29, 90, 29, 10);
-      display.display();
-      delay(120);
+      flush();
       return TR_DREW_FRAME;
     case 5:
-      display.clearDisplay();
+      clear();
       drawEyes(38, 28, 90, 28, 18);
-      display.display();
-      delay(120);
+      flush();
       return TR_DREW_FRAME;
     case 6:
       drawEmotionFace(target);
-      delay(200);
       return TR_COMPLETE;
   }
   return TR_COMPLETE;
@@ -530,46 +630,39 @@ TransitionResult DisplayManager::sleepyTransitionFrame(int frame,
   switch (frame) {
     case 0:
       drawEmotionFace(EMOTION_SLEEPY);
-      delay(200);
       return TR_DREW_FRAME;
     case 1:
-      display.clearDisplay();
+      clear();
       drawEyes(38, 28, 90, 28, 16);
       display.drawCircle(64, 50, 5, SSD1306_WHITE);
-      display.display();
-      delay(100);
+      flush();
       return TR_DREW_FRAME;
     case 2:
-      display.clearDisplay();
+      clear();
       drawEyes(38, 29, 90, 29, 10);
       display.drawCircle(64, 51, 6, SSD1306_WHITE);
-      display.display();
-      delay(100);
+      flush();
       return TR_DREW_FRAME;
     case 3:
-      display.clearDisplay();
+      clear();
       drawEyes(38, 30, 90, 30, 4);
       display.drawCircle(64, 52, 7, SSD1306_WHITE);
-      display.display();
-      delay(200);
+      flush();
       return TR_DREW_FRAME;
     case 4:
-      display.clearDisplay();
+      clear();
       drawEyes(38, 29, 90, 29, 10);
       display.drawCircle(64, 51, 6, SSD1306_WHITE);
-      display.display();
-      delay(120);
+      flush();
       return TR_DREW_FRAME;
     case 5:
-      display.clearDisplay();
+      clear();
       drawEyes(38, 28, 90, 28, 18);
       display.drawCircle(64, 50, 5, SSD1306_WHITE);
-      display.display();
-      delay(120);
+      flush();
       return TR_DREW_FRAME;
     case 6:
       drawEmotionFace(target);
-      delay(200);
       return TR_COMPLETE;
   }
   return TR_COMPLETE;
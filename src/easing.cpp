@@ -0,0 +1,80 @@
+#include "easing.h"
+
+// ===== COMPILE-TIME LOOKUP TABLES =====
+// Built from the curve formulas by the compiler (C++11 constexpr, so it also
+// works with the firmware's -std=gnu++11); nothing is computed at boot.
+
+template <int... I> struct IndexSeq {};
+template <int N, int... I> struct MakeIndexSeq : MakeIndexSeq<N - 1, N - 1, I...> {};
+template <int... I> struct MakeIndexSeq<0, I...> { typedef IndexSeq<I...> type; };
+
+struct EaseTable {
+  uint16_t v[EASE_LUT_STEPS + 1];
+};
+
+// Cubic ease-in-out on t in [0, 1].
+constexpr double cubicInOut(double t) {
+  return t < 0.5 ? 4 * t * t * t
+                 : 1 - (-2 * t + 2) * (-2 * t + 2) * (-2 * t + 2) / 2;
+}
+
+// Bounce ease-out (four decaying parabolas) on t in [0, 1].
+constexpr double bounceOut(double t) {
+  return t < 1 / 2.75   ? 7.5625 * t * t
+       : t < 2 / 2.75   ? 7.5625 * (t - 1.5 / 2.75) * (t - 1.5 / 2.75) + 0.75
+       : t < 2.5 / 2.75 ? 7.5625 * (t - 2.25 / 2.75) * (t - 2.25 / 2.75) + 0.9375
+                        : 7.5625 * (t - 2.625 / 2.75) * (t - 2.625 / 2.75) + 0.984375;
+}
+
+// Rounds a [0, 1] value to Q8.8.
+constexpr uint16_t toQ8(double v) {
+  return (uint16_t)(v * EASE_ONE + 0.5);
+}
+
+// Samples curve F at STEPS + 1 evenly spaced points.
+template <double (*F)(double), int... I>
+constexpr EaseTable buildTable(IndexSeq<I...>) {
+  return EaseTable{{toQ8(F((double)I / EASE_LUT_STEPS))...}};
+}
+
+static constexpr EaseTable CUBIC_LUT =
+    buildTable<cubicInOut>(MakeIndexSeq<EASE_LUT_STEPS + 1>::type());
+static constexpr EaseTable BOUNCE_LUT =
+    buildTable<bounceOut>(MakeIndexSeq<EASE_LUT_STEPS + 1>::type());
+
+static_assert(CUBIC_LUT.v[0] == 0 && CUBIC_LUT.v[EASE_LUT_STEPS] == EASE_ONE,
+              "cubic table must span 0..1");
+static_assert(BOUNCE_LUT.v[0] == 0 && BOUNCE_LUT.v[EASE_LUT_STEPS] == EASE_ONE,
+              "bounce table must span 0..1");
+
+// Linearly interpolates a table at frame/totalFrames (8 fractional bits between entries).
+static uint16_t sampleTable(const EaseTable& table, int frame, int totalFrames) {
+  int32_t pos = (int32_t)frame * EASE_LUT_STEPS * 256 / totalFrames;
+  int idx = pos >> 8;
+  if (idx >= EASE_LUT_STEPS) return table.v[EASE_LUT_STEPS];
+  int32_t a = table.v[idx];
+  int32_t b = table.v[idx + 1];
+  return (uint16_t)(a + (b - a) * (pos & 0xFF) / 256);
+}
+
+// ===== PUBLIC API =====
+
+// Clamps the frame to [0, totalFrames] and evaluates the curve in Q8.8.
+uint16_t easeProgressQ8(EaseCurve curve, int frame, int totalFrames) {
+  if (totalFrames <= 0 || frame >= totalFrames) return EASE_ONE;
+  if (frame <= 0) return 0;
+  switch (curve) {
+    case EASE_IN_OUT_QUAD:  return (uint16_t)easeInOutQuad(0, EASE_ONE, frame, totalFrames);
+    case EASE_IN_OUT_CUBIC: return sampleTable(CUBIC_LUT, frame, totalFrames);
+    case EASE_OUT_BOUNCE:   return sampleTable(BOUNCE_LUT, frame, totalFrames);
+    case EASE_LINEAR:
+    default:                return (uint16_t)((int32_t)frame * EASE_ONE / totalFrames);
+  }
+}
+
+// Quad goes through the exact path so it matches easeInOutQuad(); other curves scale Q8.8 progress.
+int easeCurve(EaseCurve curve, int start, int end, int frame, int totalFrames) {
+  if (curve == EASE_IN_OUT_QUAD) return easeInOutQuad(start, end, frame, totalFrames);
+  int32_t p = easeProgressQ8(curve, frame, totalFrames);
+  return start + (int)((int32_t)(end - start) * p / EASE_ONE);
+}
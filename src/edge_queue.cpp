@@ -0,0 +1,18 @@
+#include "edge_queue.h"
+
+// Empty ring.
+EdgeQueue::EdgeQueue() : head_(0), tail_(0), overflows_(0) {
+  for (int i = 0; i < CAPACITY; i++) {
+    ring_[i].us = 0;
+    ring_[i].level = 0;
+  }
+}
+
+// Reads the slot before publishing the new tail, so the producer can't overwrite it mid-copy.
+bool EdgeQueue::pop(TouchEdge& out) {
+  uint8_t tail = tail_.load(std::memory_order_relaxed);
+  if (tail == head_.load(std::memory_order_acquire)) return false;
+  out = ring_[tail];
+  tail_.store((uint8_t)((tail + 1) & (CAPACITY - 1)), std::memory_order_release);
+  return true;
+}
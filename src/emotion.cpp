@@ -5,6 +5,7 @@
 
 #include "emotion.h"
 #include "emotion_registry.h"
+#include "clock_service.h"
 
 EmotionManager emotionManager;
 
@@ -56,11 +57,10 @@ void EmotionManager::update(unsigned long currentTime) {
   // Reserved for future autonomous emotion logic
 }
 
-// Returns a time-of-day–weighted emotion based on uptime hours since boot.
+// Returns a time-of-day–weighted emotion: wall-clock hour once set, uptime hours since boot before.
 EmotionState
 EmotionManager::getTimeBasedEmotion(unsigned long currentTime) const {
-  unsigned long currentUptime = currentTime - bootTime;
-  unsigned long hourOfDay = (currentUptime / HOUR_IN_MILLIS) % 24;
+  int hourOfDay = clockService.hourAt(currentTime - bootTime);
 
   if (hourOfDay >= 6 && hourOfDay < 12) return EMOTION_HAPPY;
   if (hourOfDay >= 12 && hourOfDay < 18) return EMOTION_THINKING;
@@ -0,0 +1,34 @@
+#include "emotion_catalog.h"
+#include "emotion_registry.h"
+#include "emotion_draws.h"
+
+// Registers all emotion definitions with per-emotion frame counts, delays, loop modes, and draw functions.
+void registerEmotions() {
+  // Frame counts and delays now vary per emotion — each has its own temporal character.
+  // Loop durations (approximate):
+  //   PINGPONG full cycle = (frameCount * 2 - 2) * frameDelay
+  //   RESTART full cycle  = frameCount * frameDelay
+  //
+  // frameDelay tiers match emotional energy:
+  //   High energy  (EXCITED, ANGRY, SURPRISED): 25-35ms — snappy, intense
+  //   Neutral      (HAPPY, LOVE, CONFUSED, THINKING, IDLE): 50-60ms — expressive, measured
+  //   Low energy   (SAD, SLEEPY, BORED): 75-85ms — heavy, lingering
+  emotionRegistry.add({EMOTION_IDLE,      "IDLE",      60,  55, LOOP_PINGPONG, true,  drawIdle, &FACE_IDLE});      // ~6.4s  neutral breathing
+  emotionRegistry.add({EMOTION_BLINK,     "BLINK",      1,   0, LOOP_RESTART,  false, drawBlink, &FACE_BLINK});
+  emotionRegistry.add({EMOTION_HAPPY,     "HAPPY",     50,  55, LOOP_PINGPONG, true,  drawHappy, &FACE_HAPPY});     // ~5.4s  warm, measured
+  emotionRegistry.add({EMOTION_SLEEPY,    "SLEEPY",    59,  80, LOOP_RESTART,  false, drawSleepy, nullptr});    // ~4.7s  doze + snap wake
+  emotionRegistry.add({EMOTION_EXCITED,   "EXCITED",   40,  28, LOOP_PINGPONG, true,  drawExcited, &FACE_EXCITED});   // ~2.2s  rapid bounce energy
+  emotionRegistry.add({EMOTION_SAD,       "SAD",       56,  80, LOOP_RESTART,  true,  drawSad, &FACE_SAD});       // ~4.5s  heavy, slow tears
+  emotionRegistry.add({EMOTION_ANGRY,     "ANGRY",     56,  30, LOOP_PINGPONG, true,  drawAngry, &FACE_ANGRY});     // ~3.3s  fast intense shake
+  emotionRegistry.add({EMOTION_CONFUSED,  "CONFUSED",  44,  55, LOOP_PINGPONG, true,  drawConfused, nullptr});  // ~4.7s  measured puzzlement
+  emotionRegistry.add({EMOTION_THINKING,  "THINKING",  44,  55, LOOP_PINGPONG, true,  drawThinking, nullptr});  // ~4.7s  contemplative pace
+  emotionRegistry.add({EMOTION_LOVE,      "LOVE",      44,  55, LOOP_PINGPONG, true,  drawLove, nullptr});      // ~4.7s  gentle pulse
+  emotionRegistry.add({EMOTION_SURPRISED, "SURPRISED", 44,  30, LOOP_RESTART,  true,  drawSurprised, &FACE_SURPRISED}); // ~1.3s  quick shock snap
+  emotionRegistry.add({EMOTION_DEAD,      "DEAD",      70,  65, LOOP_RESTART,  false, drawDead, nullptr});      // ~4.6s  keep RESTART — no zombie bounce
+  emotionRegistry.add({EMOTION_BORED,     "BORED",     60,  80, LOOP_PINGPONG, true,  drawBored, &FACE_BORED});     // ~9.5s  painfully slow
+  emotionRegistry.add({EMOTION_SHY,       "SHY",       50,  60, LOOP_RESTART,  true,  drawShy, &FACE_SHY});       // ~3.0s  bashful recovery arc
+  emotionRegistry.add({EMOTION_NEEDY,     "NEEDY",     54,  65, LOOP_PINGPONG, true,  drawNeedy, &FACE_NEEDY});     // ~3.5s  pleading solicitation
+  emotionRegistry.add({EMOTION_CONTENT,   "CONTENT",   60,  90, LOOP_PINGPONG, true,  drawContent, &FACE_CONTENT});   // ~10.8s quiet purring satisfaction
+  emotionRegistry.add({EMOTION_PLAYFUL,   "PLAYFUL",   48,  40, LOOP_RESTART,  true,  drawPlayful, nullptr});   // ~1.9s  mischievous wink-face
+  emotionRegistry.add({EMOTION_GRUMPY,    "GRUMPY",    56,  45, LOOP_PINGPONG, true,  drawGrumpy, &FACE_GRUMPY});    // ~5.0s  low flat disapproval
+}
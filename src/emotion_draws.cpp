@@ -1,19 +1,27 @@
 #include "emotion_draws.h"
 #include "canvas.h"
+#include "easing.h"
+#include "face.h"
 #include <stdio.h>
 
 // ===== EASING HELPER =====
 
 // Quadratic ease-in-out: interpolates between start and end over totalFrames.
 // frame=0 → start, frame=totalFrames → end. Non-linear for organic motion.
+// Integer-only (easing.h) — same pixels as the old float version, no soft-float.
 static inline int ease(int start, int end, int frame, int totalFrames) {
-  if (totalFrames <= 0) return end;
-  float t = (float)frame / (float)totalFrames;
-  if (t > 1.0f) t = 1.0f;
-  t = (t < 0.5f) ? 2 * t * t : 1 - (-2 * t + 2) * (-2 * t + 2) / 2;
-  return start + (int)((end - start) * t);
+  return easeInOutQuad(start, end, frame, totalFrames);
 }
 
+// ===== KEYFRAME TABLE HELPERS =====
+// Emotions built from the face grammar are keyframe tracks (see face.h); each key
+// sets one channel at one frame. EYES_H keys both eye heights together.
+
+#define KEY(f, ch, curve, v) {f, ch, curve, (int8_t)(v), 0}
+#define PULSE(f, ch, curve, v, alt) {f, ch, curve, v, alt}
+#define EYES_H(f, curve, v) KEY(f, FC_EYE_LH, curve, v), KEY(f, FC_EYE_RH, curve, v)
+#define FACE_TRACK(keys) {keys, (uint8_t)(sizeof(keys) / sizeof(keys[0]))}
+
 // ===== LOCAL HELPERS =====
 
 // Draw X-shaped eyes (dead emotion) — centered on new grammar positions
@@ -42,139 +50,107 @@ static void drawHeartEye(ICanvas& c, int cx, int cy, int r) {
 }
 
 // ===== 2.2 BLINK — transition mortar =====
+// Eyes at Y=30 (2px lower than neutral), height=4 (nearly shut). No mouth.
 
-void drawBlink(ICanvas& canvas, int frame, const void* ctx) {
-  // Eyes at Y=30 (2px lower than neutral), height=4 (nearly shut). No mouth.
-  canvas.drawEyes(38, 30, 90, 30, 4);
-}
+static const FaceKey BLINK_KEYS[] = {
+  KEY(0, FC_EYE_Y, FK_HOLD, 30), EYES_H(0, FK_HOLD, 4), KEY(0, FC_MOUTH_SHAPE, FK_HOLD, MOUTH_NONE),
+};
+const FaceTrack FACE_BLINK = FACE_TRACK(BLINK_KEYS);
 
-// ===== 2.1 IDLE — restful ambient life =====
-// 60 frames @ 50ms = 3.0s loop. Subtle breathing bob with one asymmetric beat.
+void drawBlink(ICanvas& canvas, int frame, const void* ctx) { drawFaceTrack(canvas, FACE_BLINK, frame); }
 
-void drawIdle(ICanvas& canvas, int frame, const void* ctx) {
-  // Breathing cycle: eyes drift Y=28→27 on inhale, back on exhale.
-  // Two full breaths in 60 frames. Asymmetric beat at F50-55.
-  int eyeY;
-  if (frame < 15) {
-    eyeY = ease(28, 27, frame, 14);
-  } else if (frame < 30) {
-    eyeY = ease(27, 28, frame - 15, 14);
-  } else if (frame < 45) {
-    eyeY = ease(28, 27, frame - 30, 14);
-  } else {
-    eyeY = ease(27, 28, frame - 45, 14);
-  }
 
-  int mouthW = (frame >= 7 && frame < 22) ? 12 : 14;
-  int mouthH = (frame >= 7 && frame < 22) ? 4 : 5;
-
-  // Asymmetric beat: right eye lifts 1px extra on frames 50-55
-  int rightEyeY = eyeY;
-  if (frame >= 50 && frame <= 55) {
-    rightEyeY = eyeY - 1;
-  }
+// ===== 2.1 IDLE — restful ambient life =====
+// 60 frames @ 50ms = 3.0s loop. Subtle breathing bob with one asymmetric beat.
+// Two full breaths (eyes Y=28→27→28), narrower mouth on the first inhale,
+// right eye lifts 1px extra on frames 50-55.
+
+static const FaceKey IDLE_KEYS[] = {
+  KEY(0,  FC_EYE_Y, FK_EASE, 28),
+  KEY(7,  FC_MOUTH_W, FK_HOLD, 12), KEY(7, FC_MOUTH_H, FK_HOLD, 4),
+  KEY(14, FC_EYE_Y, FK_HOLD, 27),
+  KEY(15, FC_EYE_Y, FK_EASE, 27),
+  KEY(22, FC_MOUTH_W, FK_HOLD, 14), KEY(22, FC_MOUTH_H, FK_HOLD, 5),
+  KEY(29, FC_EYE_Y, FK_HOLD, 28),
+  KEY(30, FC_EYE_Y, FK_EASE, 28),
+  KEY(44, FC_EYE_Y, FK_HOLD, 27),
+  KEY(45, FC_EYE_Y, FK_EASE, 27),
+  KEY(50, FC_EYE_RDY, FK_HOLD, -1),
+  KEY(56, FC_EYE_RDY, FK_HOLD, 0),
+  KEY(59, FC_EYE_Y, FK_HOLD, 28),
+};
+const FaceTrack FACE_IDLE = FACE_TRACK(IDLE_KEYS);
+
+void drawIdle(ICanvas& canvas, int frame, const void* ctx) { drawFaceTrack(canvas, FACE_IDLE, frame); }
 
-  canvas.drawEyes(38, eyeY, 90, rightEyeY, 22);
-  canvas.drawMouth(57, 52, mouthW, mouthH);
-}
 
 // ===== 2.3 HAPPY — warm contentment =====
 // 50 frames @ 35ms = 1.75s loop.
 // Phases: squish (F0-7), hold smile (F8-25), small bounce (F26-33), relax (F34-39), recover (F40-49)
 
-void drawHappy(ICanvas& canvas, int frame, const void* ctx) {
-  if (frame < 8) {
-    // Squish: eyes close from H=20 to H=8, mouth widens
-    int eyeH = ease(20, 8, frame, 7);
-    int eyeY = ease(28, 31, frame, 7);
-    int mouthX = ease(57, 47, frame, 7);
-    int mouthW = ease(16, 34, frame, 7);
-    int mouthH = ease(5, 9, frame, 7);
-    canvas.drawEyes(38, eyeY, 90, eyeY, eyeH);
-    canvas.fillRoundRect(mouthX, 49, mouthW, mouthH, 5, COLOR_WHITE);
-    if (frame >= 5) {
-      canvas.drawBlush(18, 42, 110, 42, frame - 3);
-    }
-  } else if (frame < 26) {
-    // Hold smile: H=8 arcs, blush pulses, sparkles flicker
-    canvas.drawEyes(38, 31, 90, 31, 8);
-    canvas.fillRoundRect(47, 49, 34, 9, 5, COLOR_WHITE);
-    int blushR = ((frame % 6) < 3) ? 4 : 5;
-    canvas.drawBlush(18, 42, 110, 42, blushR);
-    // Sparkles on frames 10, 14, 18, 22
-    if (frame == 10 || frame == 14 || frame == 18 || frame == 22) {
-      canvas.drawSparkles(14, 16, 114, 16, 2);
-    }
-  } else if (frame < 34) {
-    // Bounce: face shifts up 2px then back
-    int off = (frame < 30) ? -2 : 0;
-    canvas.drawEyes(38, 31 + off, 90, 31 + off, 8);
-    canvas.fillRoundRect(47, 49 + off, 34, 9, 5, COLOR_WHITE);
-    canvas.drawBlush(18, 42 + off, 110, 42 + off, 4);
-  } else if (frame < 40) {
-    // Relax: eyes partially reopen H=8→16, mouth shrinks
-    int eyeH = ease(8, 16, frame - 34, 5);
-    int eyeY = ease(31, 29, frame - 34, 5);
-    int mouthW = ease(34, 18, frame - 34, 5);
-    canvas.drawEyes(38, eyeY, 90, eyeY, eyeH);
-    canvas.fillRoundRect(57 - mouthW / 2 + 7, 51, mouthW, 6, 3, COLOR_WHITE);
-    canvas.drawBlush(18, 42, 110, 42, 3);
-  } else {
-    // Recover: ease back to near-neutral (H=22, Y=28) for invisible loop seam
-    int eyeH = ease(16, 22, frame - 40, 9);
-    int eyeY = ease(29, 28, frame - 40, 9);
-    int mouthW = ease(18, 16, frame - 40, 9);
-    canvas.drawEyes(38, eyeY, 90, eyeY, eyeH);
-    canvas.fillRoundRect(57 - mouthW / 2 + 7, 51, mouthW, 6, 3, COLOR_WHITE);
-    canvas.drawBlush(18, 42, 110, 42, 2);
-  }
-}
+static const FaceKey HAPPY_KEYS[] = {
+  // Squish: eyes close H=20→8, mouth widens; blush grows in from F5
+  EYES_H(0, FK_EASE, 20), KEY(0, FC_EYE_Y, FK_EASE, 28),
+  KEY(0, FC_MOUTH_X, FK_EASE, 57), KEY(0, FC_MOUTH_W, FK_EASE, 16), KEY(0, FC_MOUTH_H, FK_EASE, 5),
+  KEY(0, FC_MOUTH_Y, FK_HOLD, 49), KEY(0, FC_MOUTH_R, FK_HOLD, 5),
+  KEY(5, FC_BLUSH_R, FK_LINEAR, 2),
+  EYES_H(7, FK_HOLD, 8), KEY(7, FC_EYE_Y, FK_HOLD, 31),
+  KEY(7, FC_MOUTH_X, FK_HOLD, 47), KEY(7, FC_MOUTH_W, FK_HOLD, 34), KEY(7, FC_MOUTH_H, FK_HOLD, 9),
+  KEY(7, FC_BLUSH_R, FK_HOLD, 4),
+  // Hold smile: blush pulses, sparkles flicker on F10/14/18/22
+  PULSE(8, FC_BLUSH_R, FK_PULSE3, 4, 5),
+  KEY(10, FC_SPARKLE_R, FK_HOLD, 2), KEY(11, FC_SPARKLE_R, FK_HOLD, 0),
+  KEY(14, FC_SPARKLE_R, FK_HOLD, 2), KEY(15, FC_SPARKLE_R, FK_HOLD, 0),
+  KEY(18, FC_SPARKLE_R, FK_HOLD, 2), KEY(19, FC_SPARKLE_R, FK_HOLD, 0),
+  KEY(22, FC_SPARKLE_R, FK_HOLD, 2), KEY(23, FC_SPARKLE_R, FK_HOLD, 0),
+  // Bounce: face shifts up 2px then back
+  KEY(26, FC_OFFSET_Y, FK_HOLD, -2), KEY(26, FC_BLUSH_R, FK_HOLD, 4),
+  KEY(30, FC_OFFSET_Y, FK_HOLD, 0),
+  // Relax: eyes partially reopen H=8→16, mouth shrinks around the centre
+  EYES_H(34, FK_EASE, 8), KEY(34, FC_EYE_Y, FK_EASE, 31),
+  KEY(34, FC_MOUTH_SHAPE, FK_HOLD, MOUTH_RECT_CENTERED), KEY(34, FC_MOUTH_X, FK_HOLD, 64),
+  KEY(34, FC_MOUTH_Y, FK_HOLD, 51), KEY(34, FC_MOUTH_W, FK_EASE, 34), KEY(34, FC_MOUTH_H, FK_HOLD, 6),
+  KEY(34, FC_MOUTH_R, FK_HOLD, 3), KEY(34, FC_BLUSH_R, FK_HOLD, 3),
+  EYES_H(39, FK_HOLD, 16), KEY(39, FC_EYE_Y, FK_HOLD, 29), KEY(39, FC_MOUTH_W, FK_HOLD, 18),
+  // Recover: ease back to near-neutral (H=22, Y=28) for invisible loop seam
+  EYES_H(40, FK_EASE, 16), KEY(40, FC_EYE_Y, FK_EASE, 29), KEY(40, FC_MOUTH_W, FK_EASE, 18),
+  KEY(40, FC_BLUSH_R, FK_HOLD, 2),
+  EYES_H(49, FK_HOLD, 22), KEY(49, FC_EYE_Y, FK_HOLD, 28), KEY(49, FC_MOUTH_W, FK_HOLD, 16),
+};
+const FaceTrack FACE_HAPPY = FACE_TRACK(HAPPY_KEYS);
+
+void drawHappy(ICanvas& canvas, int frame, const void* ctx) { drawFaceTrack(canvas, FACE_HAPPY, frame); }
+
 
 // ===== 2.4 SAD — melancholy =====
 // 56 frames @ 48ms = 2.69s loop.
 // Phases: droop (F0-8), tear forms (F9-14), tear falls (F15-30), tremble (F31-40), recover (F41-55)
 
-void drawSad(ICanvas& canvas, int frame, const void* ctx) {
-  if (frame < 9) {
-    // Droop: eyes lower Y=28→33, H=22→16, mouth narrows
-    int eyeY = ease(28, 33, frame, 8);
-    int eyeH = ease(22, 16, frame, 8);
-    int mouthW = ease(10, 8, frame, 8);
-    canvas.drawEyes(38, eyeY, 90, eyeY, eyeH);
-    canvas.drawMouth(63 - mouthW / 2, 55, mouthW, 3);
-  } else if (frame < 15) {
-    // Tear forms below left eye inner edge
-    canvas.drawEyes(38, 33, 90, 33, 16);
-    canvas.drawMouth(59, 55, 8, 3);
-    int tearR = (frame < 12) ? 1 : 2;
-    canvas.fillCircle(48, 42, tearR, COLOR_WHITE);
-  } else if (frame < 31) {
-    // Tear falls: Y=42→60, trail line
-    int tearY = ease(42, 60, frame - 15, 15);
-    int trailEndY = tearY - 2;
-    canvas.drawEyes(38, 33, 90, 33, 16);
-    canvas.drawMouth(59, 55, 8, 3);
-    canvas.fillCircle(48, tearY, 2, COLOR_WHITE);
-    if (trailEndY > 43) {
-      canvas.drawLine(48, 43, 48, trailEndY, COLOR_WHITE);
-    }
-  } else if (frame < 41) {
-    // Tremble: 1px horizontal oscillation
-    int xOff = ((frame % 2) == 0) ? -1 : 1;
-    canvas.drawEyes(38 + xOff, 33, 90 + xOff, 33, 16);
-    canvas.drawMouth(59 + xOff, 55, 8, 3);
-  } else {
-    // Full recovery: eyes rise Y=33→28, H=16→22 — full neutral before next wave
-    int eyeY = ease(33, 28, frame - 41, 14);
-    int eyeH = ease(16, 22, frame - 41, 14);
-    canvas.drawEyes(38, eyeY, 90, eyeY, eyeH);
-    if (frame >= 50) {
-      canvas.drawMouth(57, 52, 14, 5);  // neutral mouth for final frames
-    } else {
-      canvas.drawMouth(59, 53, 10, 4);
-    }
-  }
-}
+static const FaceKey SAD_KEYS[] = {
+  // Droop: eyes lower Y=28→33, H=22→16, mouth narrows
+  KEY(0, FC_EYE_Y, FK_EASE, 28), EYES_H(0, FK_EASE, 22),
+  KEY(0, FC_MOUTH_SHAPE, FK_HOLD, MOUTH_RECT_CENTERED), KEY(0, FC_MOUTH_X, FK_HOLD, 63),
+  KEY(0, FC_MOUTH_Y, FK_HOLD, 55), KEY(0, FC_MOUTH_W, FK_EASE, 10), KEY(0, FC_MOUTH_H, FK_HOLD, 3),
+  KEY(8, FC_EYE_Y, FK_HOLD, 33), EYES_H(8, FK_HOLD, 16), KEY(8, FC_MOUTH_W, FK_HOLD, 8),
+  // Tear forms below left eye inner edge, then falls Y=42→60 with a trail
+  KEY(9, FC_TEAR_R, FK_HOLD, 1), KEY(9, FC_TEAR_Y, FK_HOLD, 42),
+  KEY(12, FC_TEAR_R, FK_HOLD, 2),
+  KEY(15, FC_TEAR_Y, FK_EASE, 42),
+  KEY(30, FC_TEAR_Y, FK_HOLD, 60),
+  // Tremble: 1px horizontal oscillation
+  KEY(31, FC_TEAR_R, FK_HOLD, 0), PULSE(31, FC_OFFSET_X, FK_PULSE1, -1, 1),
+  // Full recovery: eyes rise Y=33→28, H=16→22 — neutral mouth for the final frames
+  KEY(41, FC_OFFSET_X, FK_HOLD, 0), KEY(41, FC_EYE_Y, FK_EASE, 33), EYES_H(41, FK_EASE, 16),
+  KEY(41, FC_MOUTH_SHAPE, FK_HOLD, MOUTH_RECT), KEY(41, FC_MOUTH_X, FK_HOLD, 59),
+  KEY(41, FC_MOUTH_Y, FK_HOLD, 53), KEY(41, FC_MOUTH_W, FK_HOLD, 10), KEY(41, FC_MOUTH_H, FK_HOLD, 4),
+  KEY(50, FC_MOUTH_X, FK_HOLD, 57), KEY(50, FC_MOUTH_Y, FK_HOLD, 52),
+  KEY(50, FC_MOUTH_W, FK_HOLD, 14), KEY(50, FC_MOUTH_H, FK_HOLD, 5),
+  KEY(55, FC_EYE_Y, FK_HOLD, 28), EYES_H(55, FK_HOLD, 22),
+};
+const FaceTrack FACE_SAD = FACE_TRACK(SAD_KEYS);
+
+void drawSad(ICanvas& canvas, int frame, const void* ctx) { drawFaceTrack(canvas, FACE_SAD, frame); }
+
 
 // ===== 2.5 CONFUSED — head-tilty puzzlement =====
 // 44 frames @ 35ms = 1.5s loop.
@@ -236,51 +212,32 @@ void drawConfused(ICanvas& canvas, int frame, const void* ctx) {
 // ===== 2.6 ANGRY — fuming frustration =====
 // 56 frames @ 32ms = 1.79s loop.
 // Phases: furrow (F0-6), hold glare (F7-14), shake (F15-34), intensify (F35-44), settle (F45-55)
+// Brow geometry: outer end is higher, inner end lower — angry V shape.
+// Brow bottom stays ≥ 2px above eye top; in hold: eye top 27, brow bottom 24.
+
+static const FaceKey ANGRY_KEYS[] = {
+  // Furrow: brows descend with eyes, gap maintained throughout
+  EYES_H(0, FK_EASE, 18), KEY(0, FC_EYE_Y, FK_EASE, 30),
+  KEY(0, FC_BROW_T, FK_EASE, 2), KEY(0, FC_BROW_OUTER_Y, FK_EASE, 9), KEY(0, FC_BROW_INNER_Y, FK_EASE, 17),
+  KEY(0, FC_MOUTH_X, FK_HOLD, 54), KEY(0, FC_MOUTH_Y, FK_HOLD, 55),
+  KEY(0, FC_MOUTH_W, FK_HOLD, 20), KEY(0, FC_MOUTH_H, FK_HOLD, 4),
+  EYES_H(6, FK_HOLD, 12), KEY(6, FC_EYE_Y, FK_HOLD, 33),
+  KEY(6, FC_BROW_T, FK_HOLD, 5), KEY(6, FC_BROW_OUTER_Y, FK_HOLD, 12), KEY(6, FC_BROW_INNER_Y, FK_HOLD, 20),
+  // Shake: ±3px, then intensify: ±4px with thicker, lower brows
+  PULSE(15, FC_OFFSET_X, FK_PULSE1, -3, 3),
+  PULSE(35, FC_OFFSET_X, FK_PULSE1, -4, 4), EYES_H(35, FK_HOLD, 11),
+  KEY(35, FC_BROW_T, FK_HOLD, 6), KEY(35, FC_BROW_OUTER_Y, FK_HOLD, 11), KEY(35, FC_BROW_INNER_Y, FK_HOLD, 19),
+  // Settle: brows lift, eyes widen back to furrow-start — invisible seam with F0
+  KEY(45, FC_OFFSET_X, FK_HOLD, 0), EYES_H(45, FK_EASE, 12), KEY(45, FC_EYE_Y, FK_EASE, 33),
+  KEY(45, FC_BROW_T, FK_EASE, 5), KEY(45, FC_BROW_OUTER_Y, FK_EASE, 12), KEY(45, FC_BROW_INNER_Y, FK_EASE, 20),
+  KEY(45, FC_MOUTH_Y, FK_HOLD, 54),
+  EYES_H(55, FK_HOLD, 18), KEY(55, FC_EYE_Y, FK_HOLD, 30),
+  KEY(55, FC_BROW_T, FK_HOLD, 2), KEY(55, FC_BROW_OUTER_Y, FK_HOLD, 9), KEY(55, FC_BROW_INNER_Y, FK_HOLD, 17),
+};
+const FaceTrack FACE_ANGRY = FACE_TRACK(ANGRY_KEYS);
+
+void drawAngry(ICanvas& canvas, int frame, const void* ctx) { drawFaceTrack(canvas, FACE_ANGRY, frame); }
 
-void drawAngry(ICanvas& canvas, int frame, const void* ctx) {
-  // Brow geometry: outer(x=18/110) is higher, inner(x=50/78) is lower — angry V shape.
-  // All brow Y coords keep brow bottom pixel ≥ 2px above eye top (eyeY - eyeH/2).
-  // Eye top in hold = 33-6 = 27; brow bottom (inner=20, thick=5) = 24 → 3px gap.
-  if (frame < 7) {
-    // Furrow: brows descend with eyes, gap maintained throughout
-    int eyeH = ease(18, 12, frame, 6);
-    int eyeY = ease(30, 33, frame, 6);
-    int browThick = ease(2, 5, frame, 6);
-    canvas.drawEyes(38, eyeY, 90, eyeY, eyeH);
-    canvas.drawBrow(18, ease(9, 12, frame, 6), 50, ease(17, 20, frame, 6), browThick);
-    canvas.drawBrow(78, ease(17, 20, frame, 6), 110, ease(9, 12, frame, 6), browThick);
-    canvas.fillRoundRect(54, 55, 20, 4, 2, COLOR_WHITE);
-  } else if (frame < 15) {
-    // Hold glare: max furrow — extended pause builds menace before the explosion
-    canvas.drawEyes(38, 33, 90, 33, 12);
-    canvas.drawBrow(18, 12, 50, 20, 5);
-    canvas.drawBrow(78, 20, 110, 12, 5);
-    canvas.fillRoundRect(54, 55, 20, 4, 2, COLOR_WHITE);
-  } else if (frame < 35) {
-    // Shake: ±3px horizontal alternation
-    int xOff = ((frame % 2) == 0) ? -3 : 3;
-    canvas.drawEyes(38 + xOff, 33, 90 + xOff, 33, 12);
-    canvas.drawBrow(18 + xOff, 12, 50 + xOff, 20, 5);
-    canvas.drawBrow(78 + xOff, 20, 110 + xOff, 12, 5);
-    canvas.fillRoundRect(54 + xOff, 55, 20, 4, 2, COLOR_WHITE);
-  } else if (frame < 45) {
-    // Intensify: ±4px shake, brows thicker
-    int xOff = ((frame % 2) == 0) ? -4 : 4;
-    canvas.drawEyes(38 + xOff, 33, 90 + xOff, 33, 11);
-    canvas.drawBrow(18 + xOff, 11, 50 + xOff, 19, 6);
-    canvas.drawBrow(78 + xOff, 19, 110 + xOff, 11, 6);
-    canvas.fillRoundRect(54 + xOff, 55, 20, 4, 2, COLOR_WHITE);
-  } else {
-    // Settle: brows lift, eyes widen back to furrow-start — invisible seam with F0
-    int eyeH = ease(12, 18, frame - 45, 10);
-    int eyeY = ease(33, 30, frame - 45, 10);
-    int browThick = ease(5, 2, frame - 45, 10);
-    canvas.drawEyes(38, eyeY, 90, eyeY, eyeH);
-    canvas.drawBrow(18, ease(12, 9, frame - 45, 10), 50, ease(20, 17, frame - 45, 10), browThick);
-    canvas.drawBrow(78, ease(20, 17, frame - 45, 10), 110, ease(12, 9, frame - 45, 10), browThick);
-    canvas.fillRoundRect(54, 54, 20, 4, 2, COLOR_WHITE);
-  }
-}
 
 // ===== 2.8 LOVE — adoration =====
 // 44 frames @ 35ms = 1.54s loop.
@@ -339,46 +296,34 @@ void drawLove(ICanvas& canvas, int frame, const void* ctx) {
 // 40 frames @ 25ms = 1.0s loop.
 // Phases: widen (F0-5), bounce (F6-25), settle (F26-31), ease back (F32-35), return (F36-39)
 
-void drawExcited(ICanvas& canvas, int frame, const void* ctx) {
-  if (frame < 6) {
-    // Eyes widen H=22→28, pupils appear
-    int eyeH = ease(22, 28, frame, 5);
-    int eyeY = ease(28, 26, frame, 5);
-    int mouthW = ease(24, 36, frame, 5);
-    canvas.drawEyesWithPupils(38, eyeY, 90, eyeY, eyeH, 3);
-    canvas.fillRoundRect(64 - mouthW / 2, 50, mouthW, 10, 5, COLOR_WHITE);
-    if (frame >= 3) {
-      canvas.drawSparkles(10, 10, 118, 10, 2);
-    }
-  } else if (frame < 26) {
-    // Bounce: alternate up/down every frame
-    int yOff = ((frame % 2) == 0) ? -3 : 3;
-    canvas.drawEyesWithPupils(38, 26 + yOff, 90, 26 + yOff, 28, 3);
-    canvas.fillRoundRect(46, 50 + yOff, 36, 10, 5, COLOR_WHITE);
-    canvas.drawSparkles(((frame % 2) == 0) ? 12 : 10,
-                        ((frame % 2) == 0) ? 8 : 14,
-                        ((frame % 2) == 0) ? 116 : 118,
-                        ((frame % 2) == 0) ? 8 : 14, 2);
-  } else if (frame < 32) {
-    // Settle: bounce dampens 3→2→1→0
-    int amp = 3 - (frame - 26) / 2;
-    if (amp < 0) amp = 0;
-    int yOff = ((frame % 2) == 0) ? -amp : amp;
-    canvas.drawEyesWithPupils(38, 26 + yOff, 90, 26 + yOff, 28, 3);
-    canvas.fillRoundRect(46, 50 + yOff, 36, 10, 5, COLOR_WHITE);
-  } else if (frame < 36) {
-    // Ease back: eyes shrink slightly
-    int eyeH = ease(28, 24, frame - 32, 3);
-    canvas.drawEyesWithPupils(38, 26, 90, 26, eyeH, 3);
-    canvas.fillRoundRect(50, 50, 28, 8, 4, COLOR_WHITE);
-  } else {
-    // Return: ease to neutral (H=22, Y=28) — invisible seam with F0
-    int eyeH = ease(24, 22, frame - 36, 3);
-    int eyeY = ease(26, 28, frame - 36, 3);
-    canvas.drawEyesWithPupils(38, eyeY, 90, eyeY, eyeH, 3);
-    canvas.fillRoundRect(51, 51, 26, 7, 4, COLOR_WHITE);
-  }
-}
+static const FaceKey EXCITED_KEYS[] = {
+  // Widen: eyes H=22→28 with pupils, mouth widens, sparkles from F3
+  KEY(0, FC_PUPIL_R, FK_HOLD, 3), EYES_H(0, FK_EASE, 22), KEY(0, FC_EYE_Y, FK_EASE, 28),
+  KEY(0, FC_MOUTH_SHAPE, FK_HOLD, MOUTH_RECT_CENTERED), KEY(0, FC_MOUTH_X, FK_HOLD, 64),
+  KEY(0, FC_MOUTH_Y, FK_HOLD, 50), KEY(0, FC_MOUTH_W, FK_EASE, 24), KEY(0, FC_MOUTH_H, FK_HOLD, 10),
+  KEY(0, FC_MOUTH_R, FK_HOLD, 5),
+  KEY(3, FC_SPARKLE_R, FK_HOLD, 2), KEY(3, FC_SPARKLE_DX, FK_HOLD, 54), KEY(3, FC_SPARKLE_Y, FK_HOLD, 10),
+  EYES_H(5, FK_HOLD, 28), KEY(5, FC_EYE_Y, FK_HOLD, 26), KEY(5, FC_MOUTH_W, FK_HOLD, 36),
+  // Bounce: ±3px every frame, sparkles jump between two spots
+  PULSE(6, FC_OFFSET_Y, FK_PULSE1, -3, 3),
+  PULSE(6, FC_SPARKLE_DX, FK_PULSE1, 52, 54), PULSE(6, FC_SPARKLE_Y, FK_PULSE1, 8, 14),
+  // Settle: bounce dampens 3→2→1
+  KEY(26, FC_SPARKLE_R, FK_HOLD, 0),
+  PULSE(28, FC_OFFSET_Y, FK_PULSE1, -2, 2),
+  PULSE(30, FC_OFFSET_Y, FK_PULSE1, -1, 1),
+  // Ease back: eyes shrink slightly, smaller mouth
+  KEY(32, FC_OFFSET_Y, FK_HOLD, 0), EYES_H(32, FK_EASE, 28),
+  KEY(32, FC_MOUTH_W, FK_HOLD, 28), KEY(32, FC_MOUTH_H, FK_HOLD, 8), KEY(32, FC_MOUTH_R, FK_HOLD, 4),
+  EYES_H(35, FK_HOLD, 24),
+  // Return: ease to neutral (H=22, Y=28) — invisible seam with F0
+  EYES_H(36, FK_EASE, 24), KEY(36, FC_EYE_Y, FK_EASE, 26),
+  KEY(36, FC_MOUTH_Y, FK_HOLD, 51), KEY(36, FC_MOUTH_W, FK_HOLD, 26), KEY(36, FC_MOUTH_H, FK_HOLD, 7),
+  EYES_H(39, FK_HOLD, 22), KEY(39, FC_EYE_Y, FK_HOLD, 28),
+};
+const FaceTrack FACE_EXCITED = FACE_TRACK(EXCITED_KEYS);
+
+void drawExcited(ICanvas& canvas, int frame, const void* ctx) { drawFaceTrack(canvas, FACE_EXCITED, frame); }
+
 
 // ===== 2.10 SLEEPY — drifting off =====
 // 59 frames @ 80ms = 4.7s per cycle, LOOP_RESTART.
@@ -464,45 +409,25 @@ void drawThinking(ICanvas& canvas, int frame, const void* ctx) {
 // Phases: snap open (F0-5), hold shock (F6-10), double-take blink (F11-13),
 //         tremor hold (F14-25), settle (F26-43)
 
-void drawSurprised(ICanvas& canvas, int frame, const void* ctx) {
-  if (frame < 6) {
-    // Snap open: eyes widen H=20→28, mouth opens
-    int eyeH = ease(20, 28, frame, 5);
-    int eyeY = ease(28, 25, frame, 5);
-    int mouthR = ease(4, 7, frame, 5);
-    canvas.drawEyesWithPupils(38, eyeY, 90, eyeY, eyeH, 3);
-    canvas.fillCircle(64, 53, mouthR, COLOR_WHITE);
-  } else if (frame < 11) {
-    // Hold shock
-    canvas.drawEyesWithPupils(38, 25, 90, 25, 28, 3);
-    canvas.fillCircle(64, 53, 7, COLOR_WHITE);
-  } else if (frame == 11) {
-    // Double-take shut: quick blink, no pupils
-    canvas.drawEyes(38, 30, 90, 30, 4);
-    canvas.fillCircle(64, 53, 7, COLOR_WHITE);
-  } else if (frame < 14) {
-    // Double-take reopen
-    canvas.drawEyesWithPupils(38, 25, 90, 25, 28, 3);
-    canvas.fillCircle(64, 53, 7, COLOR_WHITE);
-  } else if (frame < 26) {
-    // Tremor hold: 1px vertical jitter, mouth pulses
-    int yOff = ((frame % 2) == 0) ? -1 : 1;
-    int mouthR = ((frame % 2) == 0) ? 8 : 6;
-    canvas.drawEyesWithPupils(38, 25 + yOff, 90, 25 + yOff, 28, 3);
-    canvas.fillCircle(64, 53, mouthR, COLOR_WHITE);
-  } else {
-    // Settle: eyes shrink H=28→20, mouth closes — extended to F43 for invisible seam
-    int eyeH = ease(28, 20, frame - 26, 17);
-    int eyeY = ease(25, 28, frame - 26, 17);
-    int mouthR = ease(7, 4, frame - 26, 17);
-    canvas.drawEyesWithPupils(38, eyeY, 90, eyeY, eyeH, 3);
-    if (mouthR > 3) {
-      canvas.fillCircle(64, 53, mouthR, COLOR_WHITE);
-    } else {
-      canvas.drawCircle(64, 52, 4, COLOR_WHITE);
-    }
-  }
-}
+static const FaceKey SURPRISED_KEYS[] = {
+  // Snap open: eyes widen H=20→28, mouth opens
+  KEY(0, FC_PUPIL_R, FK_HOLD, 3), EYES_H(0, FK_EASE, 20), KEY(0, FC_EYE_Y, FK_EASE, 28),
+  KEY(0, FC_MOUTH_SHAPE, FK_HOLD, MOUTH_DISC), KEY(0, FC_MOUTH_X, FK_HOLD, 64),
+  KEY(0, FC_MOUTH_Y, FK_HOLD, 53), KEY(0, FC_MOUTH_R, FK_EASE, 4),
+  EYES_H(5, FK_HOLD, 28), KEY(5, FC_EYE_Y, FK_HOLD, 25), KEY(5, FC_MOUTH_R, FK_HOLD, 7),
+  // Double-take: one shut frame without pupils, then reopen
+  KEY(11, FC_PUPIL_R, FK_HOLD, 0), EYES_H(11, FK_HOLD, 4), KEY(11, FC_EYE_Y, FK_HOLD, 30),
+  KEY(12, FC_PUPIL_R, FK_HOLD, 3), EYES_H(12, FK_HOLD, 28), KEY(12, FC_EYE_Y, FK_HOLD, 25),
+  // Tremor hold: 1px vertical jitter, mouth pulses
+  PULSE(14, FC_EYE_Y, FK_PULSE1, 24, 26), PULSE(14, FC_MOUTH_R, FK_PULSE1, 8, 6),
+  // Settle: eyes shrink H=28→20, mouth closes — extended to F43 for invisible seam
+  EYES_H(26, FK_EASE, 28), KEY(26, FC_EYE_Y, FK_EASE, 25), KEY(26, FC_MOUTH_R, FK_EASE, 7),
+  EYES_H(43, FK_HOLD, 20), KEY(43, FC_EYE_Y, FK_HOLD, 28), KEY(43, FC_MOUTH_R, FK_HOLD, 4),
+};
+const FaceTrack FACE_SURPRISED = FACE_TRACK(SURPRISED_KEYS);
+
+void drawSurprised(ICanvas& canvas, int frame, const void* ctx) { drawFaceTrack(canvas, FACE_SURPRISED, frame); }
+
 
 // ===== 2.13 DEAD — dark comedy knockout =====
 // 70 frames @ 55ms = 3.85s loop.
@@ -549,45 +474,28 @@ void drawDead(ICanvas& canvas, int frame, const void* ctx) {
 // 60 frames @ 65ms = 3.9s half-cycle, 7.8s full ping-pong cycle.
 // Phases: droop (F0-12), hold (F13-18), slow blink (F19-22), drift (F23-35),
 //         sigh (F36-42), reopen (F43-59)
+// Right eye sits 2px lower throughout (head tilt).
+
+static const FaceKey BORED_KEYS[] = {
+  KEY(0, FC_EYE_RDY, FK_HOLD, 2), EYES_H(0, FK_EASE, 22),
+  KEY(0, FC_MOUTH_Y, FK_HOLD, 53), KEY(0, FC_MOUTH_H, FK_HOLD, 4),
+  EYES_H(12, FK_HOLD, 8),
+  // Slow blink: H=2 then back to H=8
+  EYES_H(19, FK_HOLD, 2),
+  EYES_H(21, FK_HOLD, 8),
+  // Sigh: mouth opens into small O
+  KEY(36, FC_MOUTH_SHAPE, FK_HOLD, MOUTH_RING), KEY(36, FC_MOUTH_X, FK_HOLD, 64),
+  KEY(36, FC_MOUTH_Y, FK_HOLD, 54), KEY(36, FC_MOUTH_R, FK_HOLD, 4),
+  // Reopen: eyes to H=22 (full neutral) — clean ping-pong turnaround at F59
+  KEY(43, FC_MOUTH_SHAPE, FK_HOLD, MOUTH_RECT), KEY(43, FC_MOUTH_X, FK_HOLD, 57),
+  KEY(43, FC_MOUTH_Y, FK_HOLD, 53), KEY(43, FC_MOUTH_R, FK_HOLD, 2),
+  EYES_H(43, FK_EASE, 8),
+  EYES_H(59, FK_HOLD, 22),
+};
+const FaceTrack FACE_BORED = FACE_TRACK(BORED_KEYS);
+
+void drawBored(ICanvas& canvas, int frame, const void* ctx) { drawFaceTrack(canvas, FACE_BORED, frame); }
 
-void drawBored(ICanvas& canvas, int frame, const void* ctx) {
-  if (frame < 13) {
-    // Droop: eyes close H=22→8, right eye 2px lower (head tilt)
-    int eyeH = ease(22, 8, frame, 12);
-    int leftY = ease(28, 28, frame, 12);   // left stays at 28
-    int rightY = ease(30, 30, frame, 12);  // right 2px lower (tilt) — constant
-    canvas.fillRoundRect(26, leftY - eyeH / 2, 24, eyeH, 7, COLOR_WHITE);
-    canvas.fillRoundRect(78, rightY - eyeH / 2, 24, eyeH, 7, COLOR_WHITE);
-    canvas.fillRoundRect(57, 53, 14, 4, 2, COLOR_WHITE);
-  } else if (frame < 19) {
-    // Hold half-closed: H=8, tilt maintained
-    canvas.fillRoundRect(26, 28 - 4, 24, 8, 7, COLOR_WHITE);
-    canvas.fillRoundRect(78, 30 - 4, 24, 8, 7, COLOR_WHITE);
-    canvas.fillRoundRect(57, 53, 14, 4, 2, COLOR_WHITE);
-  } else if (frame < 23) {
-    // Slow blink: H=2 then back to H=8
-    int eyeH = (frame < 21) ? 2 : 8;
-    canvas.fillRoundRect(26, 28 - eyeH / 2, 24, eyeH, 7, COLOR_WHITE);
-    canvas.fillRoundRect(78, 30 - eyeH / 2, 24, eyeH, 7, COLOR_WHITE);
-    canvas.fillRoundRect(57, 53, 14, 4, 2, COLOR_WHITE);
-  } else if (frame < 36) {
-    // Drift: H=8, tilt
-    canvas.fillRoundRect(26, 28 - 4, 24, 8, 7, COLOR_WHITE);
-    canvas.fillRoundRect(78, 30 - 4, 24, 8, 7, COLOR_WHITE);
-    canvas.fillRoundRect(57, 53, 14, 4, 2, COLOR_WHITE);
-  } else if (frame < 43) {
-    // Sigh: mouth opens into small O
-    canvas.fillRoundRect(26, 28 - 4, 24, 8, 7, COLOR_WHITE);
-    canvas.fillRoundRect(78, 30 - 4, 24, 8, 7, COLOR_WHITE);
-    canvas.drawCircle(64, 54, 4, COLOR_WHITE);
-  } else {
-    // Reopen: eyes to H=22 (full neutral) — clean ping-pong turnaround at F59
-    int eyeH = ease(8, 22, frame - 43, 16);
-    canvas.fillRoundRect(26, 28 - eyeH / 2, 24, eyeH, 7, COLOR_WHITE);
-    canvas.fillRoundRect(78, 30 - eyeH / 2, 24, eyeH, 7, COLOR_WHITE);
-    canvas.fillRoundRect(57, 53, 14, 4, 2, COLOR_WHITE);
-  }
-}
 
 // ===== 2.15 SHY — bashful recovery after neglect =====
 // 50 frames @ 60ms = 3.0s loop.
@@ -595,143 +503,73 @@ void drawBored(ICanvas& canvas, int frame, const void* ctx) {
 // Visually distinct: asymmetric eye heights (one squinting, one peeking), prominent blush.
 // Eyes fixed at standard positions (38, 90), Y=28. Expression through scale only.
 
-void drawShy(ICanvas& canvas, int frame, const void* ctx) {
-  if (frame < 8) {
-    // Startle: both eyes squeeze shut asymmetrically — left hides more than right
-    int leftH  = ease(22, 4, frame, 7);   // left squints nearly shut
-    int rightH = ease(22, 10, frame, 7);   // right stays half-open (peeking)
-    canvas.fillRoundRect(26, 28 - leftH / 2, 24, leftH, 7, COLOR_WHITE);
-    canvas.fillRoundRect(78, 28 - rightH / 2, 24, rightH, 7, COLOR_WHITE);
-    // Blush starts appearing
-    if (frame >= 4) {
-      int blushR = ease(1, 3, frame - 4, 3);
-      canvas.drawBlush(16, 42, 108, 42, blushR);
-    }
-  } else if (frame < 19) {
-    // Avert: left eye a narrow slit, right eye half-open — bashful squint
-    int leftH  = ease(4, 3, frame - 8, 10);   // left barely open
-    int rightH = ease(10, 12, frame - 8, 10);  // right peeks open a touch more
-    canvas.fillRoundRect(26, 28 - leftH / 2, 24, leftH, 7, COLOR_WHITE);
-    canvas.fillRoundRect(78, 28 - rightH / 2, 24, rightH, 7, COLOR_WHITE);
-    // Full blush, pulses gently
-    int blushR = ((frame % 4) < 2) ? 4 : 5;
-    canvas.drawBlush(16, 42, 108, 42, blushR);
-    // Tiny closed mouth — pressed together nervously
-    canvas.fillRoundRect(60, 53, 8, 3, 2, COLOR_WHITE);
-  } else if (frame < 31) {
-    // Peek: both eyes open further, left catches up — timid glance
-    int f = frame - 19;
-    int leftH  = ease(3, 12, f, 11);    // left cracks open
-    int rightH = ease(12, 18, f, 11);   // right opens wider
-    canvas.fillRoundRect(26, 28 - leftH / 2, 24, leftH, 7, COLOR_WHITE);
-    canvas.fillRoundRect(78, 28 - rightH / 2, 24, rightH, 7, COLOR_WHITE);
-    // Blush steady
-    canvas.drawBlush(16, 42, 108, 42, 5);
-    // Small tentative smile starts forming
-    int mouthW = ease(8, 14, f, 11);
-    int mouthH = ease(3, 4, f, 11);
-    canvas.fillRoundRect(60, 53, mouthW, mouthH, 2, COLOR_WHITE);
-  } else if (frame < 42) {
-    // Warm up: eyes become more symmetric, approaching neutral
-    int f = frame - 31;
-    int leftH  = ease(12, 20, f, 10);   // left nearly matches right
-    int rightH = ease(18, 22, f, 10);   // right reaches full open
-    canvas.fillRoundRect(26, 28 - leftH / 2, 24, leftH, 7, COLOR_WHITE);
-    canvas.fillRoundRect(78, 28 - rightH / 2, 24, rightH, 7, COLOR_WHITE);
-    // Blush fading
-    int blushR = ease(5, 3, f, 10);
-    canvas.drawBlush(16, 42, 108, 42, blushR);
-    // Smile grows warmer
-    int mouthW = ease(14, 18, f, 10);
-    int mouthH = ease(4, 5, f, 10);
-    canvas.fillRoundRect(60, 53, mouthW, mouthH, 3, COLOR_WHITE);
-  } else {
-    // Linger: near-neutral with residual blush — left eye still slightly smaller
-    int f = frame - 42;
-    int leftH  = ease(20, 22, f, 7);
-    int rightH = 22;
-    canvas.fillRoundRect(26, 28 - leftH / 2, 24, leftH, 7, COLOR_WHITE);
-    canvas.fillRoundRect(78, 28 - rightH / 2, 24, rightH, 7, COLOR_WHITE);
-    // Blush lingers softly
-    int blushR = ease(3, 1, f, 7);
-    if (blushR > 0) canvas.drawBlush(16, 42, 108, 42, blushR);
-    // Gentle smile
-    canvas.fillRoundRect(60, 53, 14, 5, 3, COLOR_WHITE);
-  }
-}
+static const FaceKey SHY_KEYS[] = {
+  // Startle: left squints nearly shut, right stays half-open; blush starts at F4
+  KEY(0, FC_EYE_LH, FK_EASE, 22), KEY(0, FC_EYE_RH, FK_EASE, 22),
+  KEY(0, FC_MOUTH_SHAPE, FK_HOLD, MOUTH_NONE),
+  KEY(0, FC_BLUSH_LX, FK_HOLD, 16), KEY(0, FC_BLUSH_RX, FK_HOLD, 108),
+  KEY(4, FC_BLUSH_R, FK_EASE, 1),
+  KEY(7, FC_EYE_LH, FK_HOLD, 4), KEY(7, FC_EYE_RH, FK_HOLD, 10), KEY(7, FC_BLUSH_R, FK_HOLD, 3),
+  // Avert: bashful squint, blush pulses, tiny pressed mouth
+  KEY(8, FC_EYE_LH, FK_EASE, 4), KEY(8, FC_EYE_RH, FK_EASE, 10),
+  PULSE(8, FC_BLUSH_R, FK_PULSE2, 4, 5),
+  KEY(8, FC_MOUTH_SHAPE, FK_HOLD, MOUTH_RECT), KEY(8, FC_MOUTH_X, FK_HOLD, 60),
+  KEY(8, FC_MOUTH_Y, FK_HOLD, 53), KEY(8, FC_MOUTH_W, FK_HOLD, 8), KEY(8, FC_MOUTH_H, FK_HOLD, 3),
+  KEY(18, FC_EYE_LH, FK_HOLD, 3), KEY(18, FC_EYE_RH, FK_HOLD, 12),
+  // Peek: both eyes open further, tentative smile forms
+  KEY(19, FC_EYE_LH, FK_EASE, 3), KEY(19, FC_EYE_RH, FK_EASE, 12), KEY(19, FC_BLUSH_R, FK_HOLD, 5),
+  KEY(19, FC_MOUTH_W, FK_EASE, 8), KEY(19, FC_MOUTH_H, FK_EASE, 3),
+  KEY(30, FC_EYE_LH, FK_HOLD, 12), KEY(30, FC_EYE_RH, FK_HOLD, 18),
+  KEY(30, FC_MOUTH_W, FK_HOLD, 14), KEY(30, FC_MOUTH_H, FK_HOLD, 4),
+  // Warm up: eyes approach neutral, blush fades, smile grows warmer
+  KEY(31, FC_EYE_LH, FK_EASE, 12), KEY(31, FC_EYE_RH, FK_EASE, 18), KEY(31, FC_BLUSH_R, FK_EASE, 5),
+  KEY(31, FC_MOUTH_W, FK_EASE, 14), KEY(31, FC_MOUTH_H, FK_EASE, 4), KEY(31, FC_MOUTH_R, FK_HOLD, 3),
+  KEY(41, FC_EYE_LH, FK_HOLD, 20), KEY(41, FC_EYE_RH, FK_HOLD, 22), KEY(41, FC_BLUSH_R, FK_HOLD, 3),
+  KEY(41, FC_MOUTH_W, FK_HOLD, 18), KEY(41, FC_MOUTH_H, FK_HOLD, 5),
+  // Linger: near-neutral with residual blush, left eye still slightly smaller
+  KEY(42, FC_EYE_LH, FK_EASE, 20), KEY(42, FC_BLUSH_R, FK_EASE, 3),
+  KEY(42, FC_MOUTH_W, FK_HOLD, 14), KEY(42, FC_MOUTH_H, FK_HOLD, 5),
+  KEY(49, FC_EYE_LH, FK_HOLD, 22), KEY(49, FC_BLUSH_R, FK_HOLD, 1),
+};
+const FaceTrack FACE_SHY = FACE_TRACK(SHY_KEYS);
+
+void drawShy(ICanvas& canvas, int frame, const void* ctx) { drawFaceTrack(canvas, FACE_SHY, frame); }
+
 
 // ===== 2.16 NEEDY — pleading solicitation =====
 // 54 frames @ 65ms = 3.5s loop.
 // Phases: swell (F0-14), plead (F15-35), quiver (F36-45), settle (F46-53)
-// Visually distinct: oversized eyes (H=28 at peak, vs 22 normal), pupils looking
-// upward, small open mouth that trembles. No blush — NEEDY is direct, not bashful.
+// Visually distinct: oversized eyes (H=28 at peak, vs 22 normal), catch-lights high
+// in the eyes, thick downturned mouth that trembles. No blush — NEEDY is direct, not bashful.
 // Eyes at standard X positions (38, 90). Y shifts up slightly to create "looking up at you."
 
-void drawNeedy(ICanvas& canvas, int frame, const void* ctx) {
-  if (frame < 15) {
-    // Swell: eyes grow from neutral H=22 to oversized H=28, shift up Y=28→25
-    int eyeH = ease(22, 28, frame, 14);
-    int eyeY = ease(28, 25, frame, 14);
-    canvas.drawEyes(38, eyeY, 90, eyeY, eyeH);
-    // Sad mouth fades in — thick downturned arc
-    int mouthW = ease(0, 14, frame, 14);
-    if (mouthW > 4) {
-      int mx = 64 - mouthW / 2;
-      for (int i = 0; i < 3; i++) {
-        canvas.drawLine(mx, 53 + i, 64, 56 + i, COLOR_WHITE);
-        canvas.drawLine(64, 56 + i, mx + mouthW, 53 + i, COLOR_WHITE);
-      }
-    }
-  } else if (frame < 36) {
-    // Plead: eyes pulse H=28→25→28 in slow rhythm
-    int pulseFrame = (frame - 15) % 10;
-    int eyeH;
-    if (pulseFrame < 5) {
-      eyeH = ease(28, 25, pulseFrame, 4);
-    } else {
-      eyeH = ease(25, 28, pulseFrame - 5, 4);
-    }
-    canvas.drawEyes(38, 25, 90, 25, eyeH);
-    // Small highlight dots near top of each eye — catch-light for pleading look
-    canvas.fillCircle(42, 20, 2, COLOR_BLACK);
-    canvas.fillCircle(94, 20, 2, COLOR_BLACK);
-    // Sad mouth — thick downturned arc, quivers slightly
-    int mouthW = ((frame % 6) < 3) ? 14 : 12;
-    int mx = 64 - mouthW / 2;
-    int dip = ((frame % 6) < 3) ? 56 : 55;
-    for (int i = 0; i < 3; i++) {
-      canvas.drawLine(mx, 53 + i, 64, dip + i, COLOR_WHITE);
-      canvas.drawLine(64, dip + i, mx + mouthW, 53 + i, COLOR_WHITE);
-    }
-  } else if (frame < 46) {
-    // Quiver: eyes tremble — height jitters between 27 and 28
-    int eyeH = ((frame % 2) == 0) ? 28 : 27;
-    canvas.drawEyes(38, 25, 90, 25, eyeH);
-    canvas.fillCircle(42, 20, 2, COLOR_BLACK);
-    canvas.fillCircle(94, 20, 2, COLOR_BLACK);
-    // Mouth quivers — thick
-    int dip = ((frame % 2) == 0) ? 56 : 55;
-    for (int i = 0; i < 3; i++) {
-      canvas.drawLine(57, 53 + i, 64, dip + i, COLOR_WHITE);
-      canvas.drawLine(64, dip + i, 71, 53 + i, COLOR_WHITE);
-    }
-  } else {
-    // Settle: eyes ease back toward neutral H=28→22, Y=25→28
-    int f = frame - 46;
-    int eyeH = ease(28, 22, f, 7);
-    int eyeY = ease(25, 28, f, 7);
-    canvas.drawEyes(38, eyeY, 90, eyeY, eyeH);
-    // Mouth fades out — thick
-    int mouthW = ease(14, 0, f, 7);
-    if (mouthW > 4) {
-      int mx = 64 - mouthW / 2;
-      for (int i = 0; i < 3; i++) {
-        canvas.drawLine(mx, 53 + i, 64, 56 + i, COLOR_WHITE);
-        canvas.drawLine(64, 56 + i, mx + mouthW, 53 + i, COLOR_WHITE);
-      }
-    }
-  }
-}
+static const FaceKey NEEDY_KEYS[] = {
+  // Swell: eyes grow H=22→28 and shift up Y=28→25; sad mouth fades in
+  EYES_H(0, FK_EASE, 22), KEY(0, FC_EYE_Y, FK_EASE, 28),
+  KEY(0, FC_MOUTH_SHAPE, FK_HOLD, MOUTH_V), KEY(0, FC_MOUTH_X, FK_HOLD, 64),
+  KEY(0, FC_MOUTH_Y, FK_HOLD, 53), KEY(0, FC_MOUTH_W, FK_EASE, 0), KEY(0, FC_MOUTH_H, FK_HOLD, 3),
+  KEY(0, FC_MOUTH_R, FK_HOLD, 3),
+  EYES_H(14, FK_HOLD, 28), KEY(14, FC_EYE_Y, FK_HOLD, 25), KEY(14, FC_MOUTH_W, FK_HOLD, 14),
+  // Plead: eyes pulse H=28→25→28 every 10 frames, catch-lights, mouth quivers
+  EYES_H(15, FK_EASE, 28),
+  KEY(15, FC_PUPIL_R, FK_HOLD, 2), KEY(15, FC_PUPIL_DX, FK_HOLD, 4), KEY(15, FC_PUPIL_DY, FK_HOLD, -5),
+  PULSE(15, FC_MOUTH_W, FK_PULSE3, 14, 12), PULSE(15, FC_MOUTH_H, FK_PULSE3, 3, 2),
+  EYES_H(19, FK_HOLD, 25), EYES_H(20, FK_EASE, 25),
+  EYES_H(24, FK_HOLD, 28), EYES_H(25, FK_EASE, 28),
+  EYES_H(29, FK_HOLD, 25), EYES_H(30, FK_EASE, 25),
+  EYES_H(34, FK_HOLD, 28),
+  // Quiver: eye height and mouth dip jitter every frame
+  PULSE(36, FC_EYE_LH, FK_PULSE1, 28, 27), PULSE(36, FC_EYE_RH, FK_PULSE1, 28, 27),
+  KEY(36, FC_MOUTH_W, FK_HOLD, 14), PULSE(36, FC_MOUTH_H, FK_PULSE1, 3, 2),
+  // Settle: eyes ease back to neutral, mouth fades out
+  EYES_H(46, FK_EASE, 28), KEY(46, FC_EYE_Y, FK_EASE, 25), KEY(46, FC_PUPIL_R, FK_HOLD, 0),
+  KEY(46, FC_MOUTH_W, FK_EASE, 14), KEY(46, FC_MOUTH_H, FK_HOLD, 3),
+  EYES_H(53, FK_HOLD, 22), KEY(53, FC_EYE_Y, FK_HOLD, 28), KEY(53, FC_MOUTH_W, FK_HOLD, 0),
+};
+const FaceTrack FACE_NEEDY = FACE_TRACK(NEEDY_KEYS);
+
+void drawNeedy(ICanvas& canvas, int frame, const void* ctx) { drawFaceTrack(canvas, FACE_NEEDY, frame); }
+
 
 // ===== 2.18 PLAYFUL — mischievous invitation =====
 // 48 frames @ 40ms = 1.92s loop, LOOP_RESTART.
@@ -799,62 +637,33 @@ void drawPlayful(ICanvas& canvas, int frame, const void* ctx) {
 // 56 frames @ 45ms = ~2.5s loop, LOOP_PINGPONG.
 // Phases: furrow (F0-8), stare (F9-16), slow bilateral squint (F17-48), settle (F49-55)
 // Mouth: flattened downturned frown — 3px drop, not a sharp V.
-// Signature beat: both eyes slowly squint H=10→4 and reopen over 32 frames (~675ms each way).
+// Signature beat: both eyes slowly squint H=10→7 and reopen over 32 frames (~675ms each way).
 // No pupils. No asymmetry. Just slow, heavy, unimpressed judgment.
 
-static void drawGrumpyFrown(ICanvas& c) {
-  // Flattened downturned frown: 3px drop (corners y=57, center y=54)
-  for (int i = 0; i < 3; i++) {
-    c.drawLine(54, 57 + i, 64, 54 + i, COLOR_WHITE);  // left corner → center
-    c.drawLine(64, 54 + i, 74, 57 + i, COLOR_WHITE);  // center → right corner
-  }
-}
-
-void drawGrumpy(ICanvas& canvas, int frame, const void* ctx) {
-  if (frame < 9) {
-    // Furrow: flat brows lower Y=9→15, eyes narrow H=22→10, frown fades in
-    int eyeH  = ease(22, 10, frame, 8);
-    int eyeY  = ease(28, 30, frame, 8);
-    int browY = ease(9, 15, frame, 8);
-    int browT = ease(2, 3, frame, 8);
-    canvas.drawEyes(38, eyeY, 90, eyeY, eyeH);
-    canvas.drawBrow(18, browY, 50, browY, browT);   // flat — both endpoints same Y
-    canvas.drawBrow(78, browY, 110, browY, browT);
-    if (frame >= 5) drawGrumpyFrown(canvas);
-
-  } else if (frame < 17) {
-    // Hold stare: heavy brows just above half-lidded H=10 eyes — unmoving disapproval
-    canvas.drawEyes(38, 30, 90, 30, 10);
-    canvas.drawBrow(18, 15, 50, 15, 3);
-    canvas.drawBrow(78, 15, 110, 15, 3);
-    drawGrumpyFrown(canvas);
-
-  } else if (frame < 49) {
-    // Slow bilateral squint: 15 frames closing + 2 hold + 15 reopening = 32 frames
-    // At 45ms/frame: ~675ms to close, ~675ms to reopen
-    int sqF  = frame - 17;
-    int eyeH;
-    if (sqF < 15)      eyeH = ease(10, 7, sqF, 14);
-    else if (sqF < 17) eyeH = 7;
-    else               eyeH = ease(7, 10, sqF - 17, 14);
-    canvas.drawEyes(38, 30, 90, 30, eyeH);
-    canvas.drawBrow(18, 15, 50, 15, 3);
-    canvas.drawBrow(78, 15, 110, 15, 3);
-    drawGrumpyFrown(canvas);
+static const FaceKey GRUMPY_KEYS[] = {
+  // Furrow: flat brows lower Y=9→15, eyes narrow H=22→10, frown appears at F5
+  EYES_H(0, FK_EASE, 22), KEY(0, FC_EYE_Y, FK_EASE, 28),
+  KEY(0, FC_BROW_T, FK_EASE, 2), KEY(0, FC_BROW_OUTER_Y, FK_EASE, 9), KEY(0, FC_BROW_INNER_Y, FK_EASE, 9),
+  KEY(0, FC_MOUTH_SHAPE, FK_HOLD, MOUTH_NONE),
+  KEY(5, FC_MOUTH_SHAPE, FK_HOLD, MOUTH_V), KEY(5, FC_MOUTH_X, FK_HOLD, 64), KEY(5, FC_MOUTH_Y, FK_HOLD, 57),
+  KEY(5, FC_MOUTH_W, FK_HOLD, 20), KEY(5, FC_MOUTH_H, FK_HOLD, -3), KEY(5, FC_MOUTH_R, FK_HOLD, 3),
+  EYES_H(8, FK_HOLD, 10), KEY(8, FC_EYE_Y, FK_HOLD, 30),
+  KEY(8, FC_BROW_T, FK_HOLD, 3), KEY(8, FC_BROW_OUTER_Y, FK_HOLD, 15), KEY(8, FC_BROW_INNER_Y, FK_HOLD, 15),
+  // Slow bilateral squint: 15 frames closing + 2 hold + 15 reopening
+  EYES_H(17, FK_EASE, 10),
+  EYES_H(31, FK_HOLD, 7),
+  EYES_H(34, FK_EASE, 7),
+  EYES_H(48, FK_HOLD, 10),
+  // Settle: brows ease back Y=15→9, eyes widen H=10→22 — clean pingpong seam with F0
+  EYES_H(49, FK_EASE, 10), KEY(49, FC_EYE_Y, FK_EASE, 30),
+  KEY(49, FC_BROW_T, FK_EASE, 3), KEY(49, FC_BROW_OUTER_Y, FK_EASE, 15), KEY(49, FC_BROW_INNER_Y, FK_EASE, 15),
+  EYES_H(55, FK_HOLD, 22), KEY(55, FC_EYE_Y, FK_HOLD, 28),
+  KEY(55, FC_BROW_T, FK_HOLD, 2), KEY(55, FC_BROW_OUTER_Y, FK_HOLD, 9), KEY(55, FC_BROW_INNER_Y, FK_HOLD, 9),
+};
+const FaceTrack FACE_GRUMPY = FACE_TRACK(GRUMPY_KEYS);
+
+void drawGrumpy(ICanvas& canvas, int frame, const void* ctx) { drawFaceTrack(canvas, FACE_GRUMPY, frame); }
 
-  } else {
-    // Settle: brows ease back Y=15→9, eyes widen H=10→22 — clean pingpong seam with F0
-    int sF    = frame - 49;
-    int eyeH  = ease(10, 22, sF, 6);
-    int eyeY  = ease(30, 28, sF, 6);
-    int browY = ease(15, 9, sF, 6);
-    int browT = ease(3, 2, sF, 6);
-    canvas.drawEyes(38, eyeY, 90, eyeY, eyeH);
-    canvas.drawBrow(18, browY, 50, browY, browT);
-    canvas.drawBrow(78, browY, 110, browY, browT);
-    drawGrumpyFrown(canvas);
-  }
-}
 
 // ===== 2.17 CONTENT — quiet satisfaction =====
 // 60 frames @ 90ms = 5.4s loop, LOOP_PINGPONG.
@@ -863,56 +672,30 @@ void drawGrumpy(ICanvas& canvas, int frame, const void* ctx) {
 // vs HAPPY: no bounce, no sparkles, slower tempo — settled warmth, not excitement.
 // Phases: settle (F0-14), deep content (F15-40), slow blink (F41-48), warm hold (F49-59)
 
-void drawContent(ICanvas& canvas, int frame, const void* ctx) {
-  if (frame < 15) {
-    // Settle: eyes ease from neutral to relaxed H=14, Y drifts slightly
-    int eyeH = ease(22, 14, frame, 14);
-    int eyeY = ease(28, 29, frame, 14);
-    canvas.drawEyes(38, eyeY, 90, eyeY, eyeH);
-    // Smile grows — wide, gentle, closed-mouth curve
-    int mouthW = ease(14, 28, frame, 14);
-    int mouthH = ease(5, 7, frame, 14);
-    canvas.fillRoundRect(64 - mouthW / 2, 51, mouthW, mouthH, 4, COLOR_WHITE);
-    // Blush fades in — warmth signal
-    if (frame >= 6) {
-      int blushR = ease(1, 4, frame - 6, 8);
-      canvas.drawBlush(18, 44, 110, 44, blushR);
-    }
-  } else if (frame < 41) {
-    // Deep content: relaxed eyes with slow breathing bob (Y oscillates 29→28→29)
-    int breathCycle = (frame - 15) % 13;
-    int eyeY;
-    if (breathCycle < 7) {
-      eyeY = ease(29, 28, breathCycle, 6);
-    } else {
-      eyeY = ease(28, 29, breathCycle - 7, 5);
-    }
-    canvas.drawEyes(38, eyeY, 90, eyeY, 14);
-    // Wide gentle smile held steady
-    canvas.fillRoundRect(50, 51, 28, 7, 4, COLOR_WHITE);
-    // Blush pulses gently — like a purr rhythm
-    int blushR = ((frame % 8) < 4) ? 4 : 5;
-    canvas.drawBlush(18, 44, 110, 44, blushR);
-  } else if (frame < 49) {
-    // Slow trust-blink: eyes close gently then reopen
-    int blinkFrame = frame - 41;
-    int eyeH;
-    if (blinkFrame < 4) {
-      eyeH = ease(14, 3, blinkFrame, 3);  // close
-    } else {
-      eyeH = ease(3, 14, blinkFrame - 4, 3);  // reopen
-    }
-    canvas.drawEyes(38, 29, 90, 29, eyeH);
-    canvas.fillRoundRect(50, 51, 28, 7, 4, COLOR_WHITE);
-    canvas.drawBlush(18, 44, 110, 44, 4);
-  } else {
-    // Warm hold: eyes relax slightly more, smile softens — seamless loop point
-    int eyeH = ease(14, 16, frame - 49, 10);
-    int mouthW = ease(28, 24, frame - 49, 10);
-    canvas.drawEyes(38, 29, 90, 29, eyeH);
-    canvas.fillRoundRect(64 - mouthW / 2, 51, mouthW, 7, 4, COLOR_WHITE);
-    // Blush gently fading toward loop seam
-    int blushR = ease(4, 3, frame - 49, 10);
-    canvas.drawBlush(18, 44, 110, 44, blushR);
-  }
-}
+static const FaceKey CONTENT_KEYS[] = {
+  // Settle: eyes relax to H=14, wide gentle smile grows, blush fades in from F6
+  EYES_H(0, FK_EASE, 22), KEY(0, FC_EYE_Y, FK_EASE, 28),
+  KEY(0, FC_MOUTH_SHAPE, FK_HOLD, MOUTH_RECT_CENTERED), KEY(0, FC_MOUTH_X, FK_HOLD, 64),
+  KEY(0, FC_MOUTH_Y, FK_HOLD, 51), KEY(0, FC_MOUTH_W, FK_EASE, 14), KEY(0, FC_MOUTH_H, FK_EASE, 5),
+  KEY(0, FC_MOUTH_R, FK_HOLD, 4), KEY(0, FC_BLUSH_Y, FK_HOLD, 44),
+  KEY(6, FC_BLUSH_R, FK_EASE, 1),
+  EYES_H(14, FK_HOLD, 14), KEY(14, FC_EYE_Y, FK_HOLD, 29),
+  KEY(14, FC_MOUTH_W, FK_HOLD, 28), KEY(14, FC_MOUTH_H, FK_HOLD, 7), KEY(14, FC_BLUSH_R, FK_HOLD, 4),
+  // Deep content: slow breathing bob (Y 29→28→29 every 13 frames), blush purrs
+  KEY(15, FC_EYE_Y, FK_EASE, 29), PULSE(15, FC_BLUSH_R, FK_PULSE4, 4, 5),
+  KEY(21, FC_EYE_Y, FK_HOLD, 28), KEY(22, FC_EYE_Y, FK_EASE, 28),
+  KEY(27, FC_EYE_Y, FK_HOLD, 29), KEY(28, FC_EYE_Y, FK_EASE, 29),
+  KEY(34, FC_EYE_Y, FK_HOLD, 28), KEY(35, FC_EYE_Y, FK_EASE, 28),
+  KEY(40, FC_EYE_Y, FK_HOLD, 29),
+  // Slow trust-blink: eyes close gently then reopen
+  EYES_H(41, FK_EASE, 14), KEY(41, FC_BLUSH_R, FK_HOLD, 4),
+  EYES_H(44, FK_HOLD, 3), EYES_H(45, FK_EASE, 3),
+  EYES_H(48, FK_HOLD, 14),
+  // Warm hold: eyes relax slightly more, smile softens, blush fades toward the loop seam
+  EYES_H(49, FK_EASE, 14), KEY(49, FC_MOUTH_W, FK_EASE, 28), KEY(49, FC_BLUSH_R, FK_EASE, 4),
+  EYES_H(59, FK_HOLD, 16), KEY(59, FC_MOUTH_W, FK_HOLD, 24), KEY(59, FC_BLUSH_R, FK_HOLD, 3),
+};
+const FaceTrack FACE_CONTENT = FACE_TRACK(CONTENT_KEYS);
+
+void drawContent(ICanvas& canvas, int frame, const void* ctx) { drawFaceTrack(canvas, FACE_CONTENT, frame); }
+
@@ -0,0 +1,202 @@
+#include "face.h"
+#include "canvas.h"
+#include "easing.h"
+#include "emotion_registry.h"
+
+// Tear sits under the left eye's inner corner; its trail starts just below the lid.
+static const int TEAR_DX = 10;
+static const int TEAR_TRAIL_TOP = 43;
+// V mouths narrower than this are not drawn (nothing readable yet while fading in).
+static const int MOUTH_V_MIN_W = 5;
+
+const FaceParams FACE_NEUTRAL = {{
+  FACE_EYE_LY, 0, FACE_EYE_H, FACE_EYE_H,   // eye Y, right dY, left H, right H
+  0, 0, 0,                                  // pupil r, dx, dy
+  0, 9, 17,                                 // brow thickness, outer Y, inner Y
+  MOUTH_RECT, NEUTRAL_MOUTH_X, FACE_MOUTH_Y, FACE_MOUTH_W, FACE_MOUTH_H, 2,
+  0, 18, 110, 42,                           // blush r, left X, right X, Y
+  0, 50, 16,                                // sparkle r, dx, Y
+  0, 42,                                    // tear r, Y
+  0, 0                                      // offset X, Y
+}};
+
+// Value of a channel at frame, given its latest key and the channel's following key (may be null).
+static int keyValue(const FaceKey& k, const FaceKey* next, int frame) {
+  int span = next ? next->frame - k.frame : 0;
+  int t = frame - k.frame;
+  switch (k.curve) {
+    case FK_EASE:
+      return span > 0 ? easeInOutQuad(k.value, next->value, t, span) : k.value;
+    case FK_LINEAR:
+      return span > 0 ? k.value + (next->value - k.value) * t / span : k.value;
+    case FK_PULSE1:
+    case FK_PULSE2:
+    case FK_PULSE3:
+    case FK_PULSE4: {
+      int half = k.curve - FK_PULSE1 + 1;
+      return (frame % (2 * half)) < half ? k.value : k.alt;
+    }
+    case FK_HOLD:
+    default:
+      return k.value;
+  }
+}
+
+// One pass over the keys finds each channel's active key and the key after it.
+void evaluateFace(const FaceTrack& track, int frame, FaceParams& out) {
+  const FaceKey* cur[FC_COUNT] = {nullptr};
+  const FaceKey* next[FC_COUNT] = {nullptr};
+  for (int i = 0; i < track.keyCount; i++) {
+    const FaceKey& k = track.keys[i];
+    if (k.channel >= FC_COUNT) continue;
+    if (k.frame <= frame) {
+      cur[k.channel] = &k;
+      next[k.channel] = nullptr;
+    } else if (!next[k.channel]) {
+      next[k.channel] = &k;
+    }
+  }
+  out = FACE_NEUTRAL;
+  for (int ch = 0; ch < FC_COUNT; ch++) {
+    if (cur[ch]) out.v[ch] = (int8_t)keyValue(*cur[ch], next[ch], frame);
+  }
+}
+
+// Draws the mouth in its current shape, shifted by the face offset.
+static void drawMouthShape(ICanvas& c, const FaceParams& f, int ox, int oy) {
+  int x = f.v[FC_MOUTH_X] + ox;
+  int y = f.v[FC_MOUTH_Y] + oy;
+  int w = f.v[FC_MOUTH_W];
+  int h = f.v[FC_MOUTH_H];
+  int r = f.v[FC_MOUTH_R];
+  switch (f.v[FC_MOUTH_SHAPE]) {
+    case MOUTH_RECT:
+      c.fillRoundRect(x, y, w, h, r, COLOR_WHITE);
+      break;
+    case MOUTH_RECT_CENTERED:
+      c.fillRoundRect(x - w / 2, y, w, h, r, COLOR_WHITE);
+      break;
+    case MOUTH_DISC:
+      c.fillCircle(x, y, r, COLOR_WHITE);
+      break;
+    case MOUTH_RING:
+      c.drawCircle(x, y, r, COLOR_WHITE);
+      break;
+    case MOUTH_V:
+      if (w < MOUTH_V_MIN_W) break;
+      for (int i = 0; i < r; i++) {
+        c.drawLine(x - w / 2, y + i, x, y + h + i, COLOR_WHITE);
+        c.drawLine(x, y + h + i, x - w / 2 + w, y + i, COLOR_WHITE);
+      }
+      break;
+    default:
+      break;
+  }
+}
+
+// Draws in a fixed order: eyes, pupils (black), brows, tear, mouth, blush, sparkles.
+void drawFace(ICanvas& c, const FaceParams& f) {
+  int ox = f.v[FC_OFFSET_X];
+  int oy = f.v[FC_OFFSET_Y];
+  int lx = FACE_EYE_LX + ox;
+  int rx = FACE_EYE_RX + ox;
+  int ly = f.v[FC_EYE_Y] + oy;
+  int ry = ly + f.v[FC_EYE_RDY];
+  int lh = f.v[FC_EYE_LH];
+  int rh = f.v[FC_EYE_RH];
+
+  c.fillRoundRect(lx - FACE_EYE_W / 2, ly - lh / 2, FACE_EYE_W, lh, FACE_EYE_R, COLOR_WHITE);
+  c.fillRoundRect(rx - FACE_EYE_W / 2, ry - rh / 2, FACE_EYE_W, rh, FACE_EYE_R, COLOR_WHITE);
+
+  if (f.v[FC_PUPIL_R] > 0) {
+    int dx = f.v[FC_PUPIL_DX];
+    int dy = f.v[FC_PUPIL_DY];
+    c.fillCircle(lx + dx, ly + dy, f.v[FC_PUPIL_R], COLOR_BLACK);
+    c.fillCircle(rx + dx, ry + dy, f.v[FC_PUPIL_R], COLOR_BLACK);
+  }
+
+  if (f.v[FC_BROW_T] > 0) {
+    int outer = f.v[FC_BROW_OUTER_Y] + oy;
+    int inner = f.v[FC_BROW_INNER_Y] + oy;
+    c.drawBrow(lx - 20, outer, lx + 12, inner, f.v[FC_BROW_T]);
+    c.drawBrow(rx - 12, inner, rx + 20, outer, f.v[FC_BROW_T]);
+  }
+
+  if (f.v[FC_TEAR_R] > 0) {
+    int tx = lx + TEAR_DX;
+    int ty = f.v[FC_TEAR_Y] + oy;
+    c.fillCircle(tx, ty, f.v[FC_TEAR_R], COLOR_WHITE);
+    if (ty - 2 > TEAR_TRAIL_TOP + oy) c.drawLine(tx, TEAR_TRAIL_TOP + oy, tx, ty - 2, COLOR_WHITE);
+  }
+
+  drawMouthShape(c, f, ox, oy);
+
+  if (f.v[FC_BLUSH_R] > 0) {
+    c.drawBlush(f.v[FC_BLUSH_LX] + ox, f.v[FC_BLUSH_Y] + oy,
+                f.v[FC_BLUSH_RX] + ox, f.v[FC_BLUSH_Y] + oy, f.v[FC_BLUSH_R]);
+  }
+
+  if (f.v[FC_SPARKLE_R] > 0) {
+    int dx = f.v[FC_SPARKLE_DX];
+    c.drawSparkles(SCREEN_WIDTH / 2 - dx, f.v[FC_SPARKLE_Y],
+                   SCREEN_WIDTH / 2 + dx, f.v[FC_SPARKLE_Y], f.v[FC_SPARKLE_R]);
+  }
+}
+
+// Resolves and rasterizes a single frame.
+void drawFaceTrack(ICanvas& canvas, const FaceTrack& track, int frame) {
+  FaceParams p;
+  evaluateFace(track, frame, p);
+  drawFace(canvas, p);
+}
+
+// A feature that is absent on one side (radius/thickness 0) grows or shrinks in place
+// at the other side's position instead of sliding in from the neutral spot.
+static void adoptPosition(FaceParams& a, const FaceParams& b, int sizeCh,
+                          int firstCh, int lastCh) {
+  if (a.v[sizeCh] != 0 || b.v[sizeCh] == 0) return;
+  for (int ch = firstCh; ch <= lastCh; ch++) a.v[ch] = b.v[ch];
+}
+
+// Rewrites a centred rect mouth as a left-anchored one so X means the same on both sides.
+static void normalizeMouth(FaceParams& p) {
+  if (p.v[FC_MOUTH_SHAPE] == MOUTH_RECT_CENTERED) {
+    p.v[FC_MOUTH_SHAPE] = MOUTH_RECT;
+    p.v[FC_MOUTH_X] = p.v[FC_MOUTH_X] - p.v[FC_MOUTH_W] / 2;
+  }
+}
+
+// Eases channel by channel; the mouth shape is discrete and flips at the midpoint.
+void morphFace(const FaceParams& from, const FaceParams& to, int step, int steps,
+               FaceParams& out) {
+  FaceParams a = from;
+  FaceParams b = to;
+  normalizeMouth(a);
+  normalizeMouth(b);
+  adoptPosition(a, b, FC_PUPIL_R, FC_PUPIL_DX, FC_PUPIL_DY);
+  adoptPosition(b, a, FC_PUPIL_R, FC_PUPIL_DX, FC_PUPIL_DY);
+  adoptPosition(a, b, FC_BROW_T, FC_BROW_OUTER_Y, FC_BROW_INNER_Y);
+  adoptPosition(b, a, FC_BROW_T, FC_BROW_OUTER_Y, FC_BROW_INNER_Y);
+  adoptPosition(a, b, FC_BLUSH_R, FC_BLUSH_LX, FC_BLUSH_Y);
+  adoptPosition(b, a, FC_BLUSH_R, FC_BLUSH_LX, FC_BLUSH_Y);
+  adoptPosition(a, b, FC_SPARKLE_R, FC_SPARKLE_DX, FC_SPARKLE_Y);
+  adoptPosition(b, a, FC_SPARKLE_R, FC_SPARKLE_DX, FC_SPARKLE_Y);
+  adoptPosition(a, b, FC_TEAR_R, FC_TEAR_Y, FC_TEAR_Y);
+  adoptPosition(b, a, FC_TEAR_R, FC_TEAR_Y, FC_TEAR_Y);
+
+  for (int ch = 0; ch < FC_COUNT; ch++) {
+    if (ch == FC_MOUTH_SHAPE) {
+      out.v[ch] = (2 * step < steps) ? a.v[ch] : b.v[ch];
+    } else {
+      out.v[ch] = (int8_t)easeInOutQuad(a.v[ch], b.v[ch], step, steps);
+    }
+  }
+}
+
+// Looks up the emotion's registered track.
+bool faceParamsFor(EmotionState emotion, int frame, FaceParams& out) {
+  const EmotionDef* def = emotionRegistry.get(emotion);
+  if (!def || !def->face) return false;
+  evaluateFace(*def->face, frame, out);
+  return true;
+}
@@ -0,0 +1,91 @@
+#include "frame_cache.h"
+#include "frame_codec.h"
+#include "frame_cache_data.h"
+#include <string.h>
+
+FrameCache frameCache;
+
+// Starts with nothing enabled — begin() checks the baked data against the registry.
+FrameCache::FrameCache()
+    : enabled_(0), emotion_(-1), frame_(0), deltaSteps_(0), keyframeReplays_(0) {}
+
+// Enables entries whose registered frame count matches what was baked.
+int FrameCache::begin() {
+  enabled_ = 0;
+  emotion_ = -1;
+  int count = 0;
+  for (int i = 0; i < FRAME_CACHE_ENTRY_COUNT; i++) {
+    const FrameCacheEntry& entry = FRAME_CACHE_ENTRIES[i];
+    const EmotionDef* def = emotionRegistry.get((EmotionState)entry.emotion);
+    if (entry.emotion >= 32 || !def || def->frameCount != entry.frameCount) {
+      Serial.printf("[CACHE] %s: stale (%d baked, %d registered) — drawing live\n",
+                    emotionRegistry.getName((EmotionState)entry.emotion),
+                    entry.frameCount, def ? def->frameCount : 0);
+      continue;
+    }
+    enabled_ |= (1UL << entry.emotion);
+    count++;
+  }
+  return count;
+}
+
+// Returns true when begin() enabled the emotion.
+bool FrameCache::has(EmotionState emotion) const {
+  return (int)emotion >= 0 && (int)emotion < 32 && (enabled_ & (1UL << emotion));
+}
+
+// Steps one delta when the target is adjacent to what fb holds; otherwise clears and replays from the keyframe.
+bool FrameCache::render(EmotionState emotion, int frame, uint8_t* fb,
+                        bool continuing) {
+  if (!has(emotion)) return false;
+  const FrameCacheEntry* entry = find(emotion);
+  if (!entry || frame < 0 || frame >= entry->frameCount) return false;
+
+  if (continuing && emotion_ == (int)emotion) {
+    if (frame == frame_) return true;
+    // delta k turns frame k-1 into k and, being an XOR, k back into k-1.
+    if (frame == frame_ + 1 || frame == frame_ - 1) {
+      applyFrame(*entry, frame > frame_ ? frame : frame_, fb);
+      frame_ = frame;
+      deltaSteps_++;
+      return true;
+    }
+  }
+
+  memset(fb, 0, FRAME_CACHE_FRAME_BYTES);
+  for (int k = 0; k <= frame; k++) applyFrame(*entry, k, fb);
+  emotion_ = emotion;
+  frame_ = frame;
+  keyframeReplays_++;
+  return true;
+}
+
+// Sums the encoded sizes of every frame of the emotion.
+size_t FrameCache::flashBytes(EmotionState emotion) const {
+  const FrameCacheEntry* entry = find(emotion);
+  if (!entry) return 0;
+  return FRAME_CACHE_OFFSETS[entry->firstFrame + entry->frameCount] -
+         FRAME_CACHE_OFFSETS[entry->firstFrame];
+}
+
+// Returns the size of the whole baked frame blob.
+size_t FrameCache::totalFlashBytes() const {
+  return sizeof(FRAME_CACHE_DATA);
+}
+
+// Linear scan of the baked index (at most one entry per emotion).
+const FrameCacheEntry* FrameCache::find(EmotionState emotion) const {
+  for (int i = 0; i < FRAME_CACHE_ENTRY_COUNT; i++) {
+    if (FRAME_CACHE_ENTRIES[i].emotion == (uint8_t)emotion) return &FRAME_CACHE_ENTRIES[i];
+  }
+  return nullptr;
+}
+
+// XORs one baked delta into fb.
+bool FrameCache::applyFrame(const FrameCacheEntry& entry, int frame,
+                            uint8_t* fb) const {
+  uint32_t start = FRAME_CACHE_OFFSETS[entry.firstFrame + frame];
+  uint32_t end = FRAME_CACHE_OFFSETS[entry.firstFrame + frame + 1];
+  return applyFrameDelta(FRAME_CACHE_DATA + start, end - start, fb,
+                         FRAME_CACHE_FRAME_BYTES);
+}
@@ -0,0 +1,64 @@
+#include "frame_codec.h"
+
+// True when byte i differs between the two frames (nullptr prev = blank).
+static inline bool byteChanged(const uint8_t* cur, const uint8_t* prev, size_t i) {
+  return cur[i] != (prev ? prev[i] : 0);
+}
+
+// Emits alternating skip/literal runs over the XOR of the two frames; trailing unchanged bytes are dropped.
+bool encodeFrameDelta(const uint8_t* cur, const uint8_t* prev, size_t len,
+                      uint8_t* out, size_t cap, size_t& outLen) {
+  size_t n = 0;
+  size_t i = 0;
+
+  // Trailing unchanged bytes need no skip codes — the decoder just stops.
+  size_t end = len;
+  while (end > 0 && !byteChanged(cur, prev, end - 1)) end--;
+
+  while (i < end) {
+    size_t run = 0;
+    while (i + run < end && run < FRAME_CODEC_MAX_RUN &&
+           !byteChanged(cur, prev, i + run)) {
+      run++;
+    }
+    if (run > 0) {
+      if (n + 1 > cap) return false;
+      out[n++] = (uint8_t)(0x7F + run);
+      i += run;
+      continue;
+    }
+
+    // A lone unchanged byte is cheaper inside the literal (1 byte) than as a skip code plus a new header (2).
+    while (i + run < end && run < FRAME_CODEC_MAX_RUN &&
+           (byteChanged(cur, prev, i + run) ||
+            (i + run + 1 < end && byteChanged(cur, prev, i + run + 1)))) {
+      run++;
+    }
+    if (n + 1 + run > cap) return false;
+    out[n++] = (uint8_t)(run - 1);
+    for (size_t k = 0; k < run; k++, i++) {
+      out[n++] = cur[i] ^ (prev ? prev[i] : 0);
+    }
+  }
+  outLen = n;
+  return true;
+}
+
+// Walks the run codes; skip runs cost nothing, literal runs are XORed in place.
+bool applyFrameDelta(const uint8_t* delta, size_t deltaLen, uint8_t* buf,
+                     size_t len) {
+  size_t pos = 0;
+  size_t i = 0;
+  while (i < deltaLen) {
+    uint8_t code = delta[i++];
+    if (code & 0x80) {
+      pos += (size_t)code - 0x7F;
+      if (pos > len) return false;
+      continue;
+    }
+    size_t run = (size_t)code + 1;
+    if (pos + run > len || i + run > deltaLen) return false;
+    for (size_t k = 0; k < run; k++) buf[pos++] ^= delta[i++];
+  }
+  return true;
+}
@@ -0,0 +1,26 @@
+#include "frame_handoff.h"
+#include <string.h>
+
+// Slot 0 is written first, slot 1 starts as the (stale) ready frame, slot 2 is the consumer's.
+FrameHandoff::FrameHandoff()
+  : writeSlot_(0), readSlot_(2), ready_(1), published_(0), taken_(0), dropped_(0) {
+  memset(slots_, 0, sizeof(slots_));
+}
+
+// Fills the private write slot, then swaps it in as the ready frame and keeps the slot it replaced.
+void FrameHandoff::publish(const uint8_t* frame) {
+  memcpy(slots_[writeSlot_], frame, FRAME_BYTES);
+  uint8_t prev = ready_.exchange((uint8_t)(writeSlot_ | FRESH), std::memory_order_acq_rel);
+  if (prev & FRESH) dropped_++;
+  writeSlot_ = prev & ~FRESH;
+  published_++;
+}
+
+// Swaps the consumer's slot for the ready frame when one is pending.
+const uint8_t* FrameHandoff::take() {
+  if (!(ready_.load(std::memory_order_acquire) & FRESH)) return nullptr;
+  uint8_t prev = ready_.exchange(readSlot_, std::memory_order_acq_rel);
+  readSlot_ = prev & ~FRESH;
+  taken_++;
+  return slots_[readSlot_];
+}
@@ -0,0 +1,450 @@
+#include "framebuffer_canvas.h"
+
+// Classic 5x7 ASCII glyphs (0x20–0x7E), one byte per column, LSB = top row.
+// Same cell layout as Adafruit_GFX's built-in font: 6px advance, 8px line height.
+static const uint8_t FONT_5X7[][5] PROGMEM = {
+  {0x00, 0x00, 0x00, 0x00, 0x00}, {0x00, 0x00, 0x5F, 0x00, 0x00},  // ' ' !
+  {0x00, 0x07, 0x00, 0x07, 0x00}, {0x14, 0x7F, 0x14, 0x7F, 0x14},  // " #
+  {0x24, 0x2A, 0x7F, 0x2A, 0x12}, {0x23, 0x13, 0x08, 0x64, 0x62},  // $ %
+  {0x36, 0x49, 0x55, 0x22, 0x50}, {0x00, 0x05, 0x03, 0x00, 0x00},  // & '
+  {0x00, 0x1C, 0x22, 0x41, 0x00}, {0x00, 0x41, 0x22, 0x1C, 0x00},  // ( )
+  {0x14, 0x08, 0x3E, 0x08, 0x14}, {0x08, 0x08, 0x3E, 0x08, 0x08},  // * +
+  {0x00, 0x50, 0x30, 0x00, 0x00}, {0x08, 0x08, 0x08, 0x08, 0x08},  // , -
+  {0x00, 0x60, 0x60, 0x00, 0x00}, {0x20, 0x10, 0x08, 0x04, 0x02},  // . /
+  {0x3E, 0x51, 0x49, 0x45, 0x3E}, {0x00, 0x42, 0x7F, 0x40, 0x00},  // 0 1
+  {0x42, 0x61, 0x51, 0x49, 0x46}, {0x21, 0x41, 0x45, 0x4B, 0x31},  // 2 3
+  {0x18, 0x14, 0x12, 0x7F, 0x10}, {0x27, 0x45, 0x45, 0x45, 0x39},  // 4 5
+  {0x3C, 0x4A, 0x49, 0x49, 0x30}, {0x01, 0x71, 0x09, 0x05, 0x03},  // 6 7
+  {0x36, 0x49, 0x49, 0x49, 0x36}, {0x06, 0x49, 0x49, 0x29, 0x1E},  // 8 9
+  {0x00, 0x36, 0x36, 0x00, 0x00}, {0x00, 0x56, 0x36, 0x00, 0x00},  // : ;
+  {0x08, 0x14, 0x22, 0x41, 0x00}, {0x14, 0x14, 0x14, 0x14, 0x14},  // < =
+  {0x00, 0x41, 0x22, 0x14, 0x08}, {0x02, 0x01, 0x51, 0x09, 0x06},  // > ?
+  {0x32, 0x49, 0x79, 0x41, 0x3E}, {0x7E, 0x11, 0x11, 0x11, 0x7E},  // @ A
+  {0x7F, 0x49, 0x49, 0x49, 0x36}, {0x3E, 0x41, 0x41, 0x41, 0x22},  // B C
+  {0x7F, 0x41, 0x41, 0x22, 0x1C}, {0x7F, 0x49, 0x49, 0x49, 0x41},  // D E
+  {0x7F, 0x09, 0x09, 0x09, 0x01}, {0x3E, 0x41, 0x49, 0x49, 0x7A},  // F G
+  {0x7F, 0x08, 0x08, 0x08, 0x7F}, {0x00, 0x41, 0x7F, 0x41, 0x00},  // H I
+  {0x20, 0x40, 0x41, 0x3F, 0x01}, {0x7F, 0x08, 0x14, 0x22, 0x41},  // J K
+  {0x7F, 0x40, 0x40, 0x40, 0x40}, {0x7F, 0x02, 0x0C, 0x02, 0x7F},  // L M
+  {0x7F, 0x04, 0x08, 0x10, 0x7F}, {0x3E, 0x41, 0x41, 0x41, 0x3E},  // N O
+  {0x7F, 0x09, 0x09, 0x09, 0x06}, {0x3E, 0x41, 0x51, 0x21, 0x5E},  // P Q
+  {0x7F, 0x09, 0x19, 0x29, 0x46}, {0x46, 0x49, 0x49, 0x49, 0x31},  // R S
+  {0x01, 0x01, 0x7F, 0x01, 0x01}, {0x3F, 0x40, 0x40, 0x40, 0x3F},  // T U
+  {0x1F, 0x20, 0x40, 0x20, 0x1F}, {0x3F, 0x40, 0x38, 0x40, 0x3F},  // V W
+  {0x63, 0x14, 0x08, 0x14, 0x63}, {0x07, 0x08, 0x70, 0x08, 0x07},  // X Y
+  {0x61, 0x51, 0x49, 0x45, 0x43}, {0x00, 0x7F, 0x41, 0x41, 0x00},  // Z [
+  {0x02, 0x04, 0x08, 0x10, 0x20}, {0x00, 0x41, 0x41, 0x7F, 0x00},  // '\' ]
+  {0x04, 0x02, 0x01, 0x02, 0x04}, {0x40, 0x40, 0x40, 0x40, 0x40},  // ^ _
+  {0x00, 0x01, 0x02, 0x04, 0x00}, {0x20, 0x54, 0x54, 0x54, 0x78},  // ` a
+  {0x7F, 0x48, 0x44, 0x44, 0x38}, {0x38, 0x44, 0x44, 0x44, 0x20},  // b c
+  {0x38, 0x44, 0x44, 0x48, 0x7F}, {0x38, 0x54, 0x54, 0x54, 0x18},  // d e
+  {0x08, 0x7E, 0x09, 0x01, 0x02}, {0x0C, 0x52, 0x52, 0x52, 0x3E},  // f g
+  {0x7F, 0x08, 0x04, 0x04, 0x78}, {0x00, 0x44, 0x7D, 0x40, 0x00},  // h i
+  {0x20, 0x40, 0x44, 0x3D, 0x00}, {0x7F, 0x10, 0x28, 0x44, 0x00},  // j k
+  {0x00, 0x41, 0x7F, 0x40, 0x00}, {0x7C, 0x04, 0x18, 0x04, 0x78},  // l m
+  {0x7C, 0x08, 0x04, 0x04, 0x78}, {0x38, 0x44, 0x44, 0x44, 0x38},  // n o
+  {0x7C, 0x14, 0x14, 0x14, 0x08}, {0x08, 0x14, 0x14, 0x18, 0x7C},  // p q
+  {0x7C, 0x08, 0x04, 0x04, 0x08}, {0x48, 0x54, 0x54, 0x54, 0x20},  // r s
+  {0x04, 0x3F, 0x44, 0x40, 0x20}, {0x3C, 0x40, 0x40, 0x20, 0x7C},  // t u
+  {0x1C, 0x20, 0x40, 0x20, 0x1C}, {0x3C, 0x40, 0x30, 0x40, 0x3C},  // v w
+  {0x44, 0x28, 0x10, 0x28, 0x44}, {0x0C, 0x50, 0x50, 0x50, 0x3C},  // x y
+  {0x44, 0x64, 0x54, 0x4C, 0x44}, {0x00, 0x08, 0x36, 0x41, 0x00},  // z {
+  {0x00, 0x00, 0x7F, 0x00, 0x00}, {0x00, 0x41, 0x36, 0x08, 0x00},  // | }
+  {0x10, 0x08, 0x08, 0x10, 0x08},                                  // ~
+};
+static const char FONT_FIRST = 0x20;
+static const char FONT_LAST = 0x7E;
+
+// Starts blank with white, size-1 text at the origin.
+FrameBufferCanvas::FrameBufferCanvas()
+    : lastFlushSent_(false), flushCount_(0), skippedFlushes_(0),
+      flushedBytes_(0), cursorX_(0), cursorY_(0), textSize_(1),
+      textColor_(COLOR_WHITE) {
+  clear();
+  memset(flushed_, 0, sizeof(flushed_));
+}
+
+// ===== ICanvas =====
+
+// Blanks the buffer and resets the per-frame raster cost counter.
+void FrameBufferCanvas::clear() {
+  memset(buffer_, 0, sizeof(buffer_));
+  pixelWrites_ = 0;
+}
+
+// Diffs against the last flushed frame and accounts for the window a panel flush would send.
+void FrameBufferCanvas::flush() {
+  flushCount_++;
+  lastFlushSent_ = findDirtyRect(buffer_, flushed_, WIDTH, PAGES, lastDirty_);
+  if (!lastFlushSent_) {
+    skippedFlushes_++;
+    return;
+  }
+  flushedBytes_ += lastDirty_.byteCount();
+  copyDirtyRect(flushed_, buffer_, WIDTH, lastDirty_);
+}
+
+// Reports the window sent by the most recent flush().
+bool FrameBufferCanvas::getLastDirtyRect(DirtyRect& out) const {
+  if (!lastFlushSent_) return false;
+  out = lastDirty_;
+  return true;
+}
+
+// Filled rounded rectangle — Adafruit_GFX algorithm (center fill + two quarter-disc sides).
+void FrameBufferCanvas::fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                                      int16_t r, uint16_t color) {
+  int16_t maxRadius = ((w < h) ? w : h) / 2;
+  if (r > maxRadius) r = maxRadius;
+  fillRect(x + r, y, w - 2 * r, h, color);
+  fillCircleHelper(x + w - r - 1, y + r, r, 1, h - 2 * r - 1, color);
+  fillCircleHelper(x + r, y + r, r, 2, h - 2 * r - 1, color);
+}
+
+// Rounded rectangle outline — four edges plus four quarter-circle corners.
+void FrameBufferCanvas::drawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                                      int16_t r, uint16_t color) {
+  int16_t maxRadius = ((w < h) ? w : h) / 2;
+  if (r > maxRadius) r = maxRadius;
+  drawFastHLine(x + r, y, w - 2 * r, color);
+  drawFastHLine(x + r, y + h - 1, w - 2 * r, color);
+  drawFastVLine(x, y + r, h - 2 * r, color);
+  drawFastVLine(x + w - 1, y + r, h - 2 * r, color);
+  drawCircleHelper(x + r, y + r, r, 1, color);
+  drawCircleHelper(x + w - r - 1, y + r, r, 2, color);
+  drawCircleHelper(x + w - r - 1, y + h - r - 1, r, 4, color);
+  drawCircleHelper(x + r, y + h - r - 1, r, 8, color);
+}
+
+// Filled rectangle as a run of vertical lines; non-positive sizes draw nothing.
+void FrameBufferCanvas::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                                 uint16_t color) {
+  for (int16_t i = x; i < x + w; i++) {
+    drawFastVLine(i, y, h, color);
+  }
+}
+
+// Rectangle outline.
+void FrameBufferCanvas::drawRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                                 uint16_t color) {
+  drawFastHLine(x, y, w, color);
+  drawFastHLine(x, y + h - 1, w, color);
+  drawFastVLine(x, y, h, color);
+  drawFastVLine(x + w - 1, y, h, color);
+}
+
+// Filled circle — center column plus mirrored half-disc columns.
+void FrameBufferCanvas::fillCircle(int16_t x, int16_t y, int16_t r,
+                                   uint16_t color) {
+  drawFastVLine(x, y - r, 2 * r + 1, color);
+  fillCircleHelper(x, y, r, 3, 0, color);
+}
+
+// Circle outline — midpoint algorithm over eight octants.
+void FrameBufferCanvas::drawCircle(int16_t x0, int16_t y0, int16_t r,
+                                   uint16_t color) {
+  int16_t f = 1 - r;
+  int16_t ddFx = 1;
+  int16_t ddFy = -2 * r;
+  int16_t x = 0;
+  int16_t y = r;
+
+  drawPixel(x0, y0 + r, color);
+  drawPixel(x0, y0 - r, color);
+  drawPixel(x0 + r, y0, color);
+  drawPixel(x0 - r, y0, color);
+
+  while (x < y) {
+    if (f >= 0) {
+      y--;
+      ddFy += 2;
+      f += ddFy;
+    }
+    x++;
+    ddFx += 2;
+    f += ddFx;
+
+    drawPixel(x0 + x, y0 + y, color);
+    drawPixel(x0 - x, y0 + y, color);
+    drawPixel(x0 + x, y0 - y, color);
+    drawPixel(x0 - x, y0 - y, color);
+    drawPixel(x0 + y, y0 + x, color);
+    drawPixel(x0 - y, y0 + x, color);
+    drawPixel(x0 + y, y0 - x, color);
+    drawPixel(x0 - y, y0 - x, color);
+  }
+}
+
+// Bresenham line; steep lines are walked along Y.
+void FrameBufferCanvas::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                                 uint16_t color) {
+  bool steep = abs(y1 - y0) > abs(x1 - x0);
+  int16_t t;
+  if (steep) {
+    t = x0; x0 = y0; y0 = t;
+    t = x1; x1 = y1; y1 = t;
+  }
+  if (x0 > x1) {
+    t = x0; x0 = x1; x1 = t;
+    t = y0; y0 = y1; y1 = t;
+  }
+
+  int16_t dx = x1 - x0;
+  int16_t dy = abs(y1 - y0);
+  int16_t err = dx / 2;
+  int16_t ystep = (y0 < y1) ? 1 : -1;
+
+  for (; x0 <= x1; x0++) {
+    if (steep) drawPixel(y0, x0, color);
+    else drawPixel(x0, y0, color);
+    err -= dy;
+    if (err < 0) {
+      y0 += ystep;
+      err += dx;
+    }
+  }
+}
+
+// Filled triangle — Adafruit_GFX scanline fill (vertices sorted by Y, flat-top/bottom halves).
+void FrameBufferCanvas::fillTriangle(int16_t x0, int16_t y0, int16_t x1,
+                                     int16_t y1, int16_t x2, int16_t y2,
+                                     uint16_t color) {
+  int16_t a, b, y, last, t;
+
+  if (y0 > y1) { t = y0; y0 = y1; y1 = t; t = x0; x0 = x1; x1 = t; }
+  if (y1 > y2) { t = y2; y2 = y1; y1 = t; t = x2; x2 = x1; x1 = t; }
+  if (y0 > y1) { t = y0; y0 = y1; y1 = t; t = x0; x0 = x1; x1 = t; }
+
+  if (y0 == y2) {  // All on one scanline
+    a = b = x0;
+    if (x1 < a) a = x1;
+    else if (x1 > b) b = x1;
+    if (x2 < a) a = x2;
+    else if (x2 > b) b = x2;
+    drawFastHLine(a, y0, b - a + 1, color);
+    return;
+  }
+
+  int16_t dx01 = x1 - x0, dy01 = y1 - y0;
+  int16_t dx02 = x2 - x0, dy02 = y2 - y0;
+  int16_t dx12 = x2 - x1, dy12 = y2 - y1;
+  int32_t sa = 0, sb = 0;
+
+  // Upper half; includes y1 only when the lower half is flat
+  last = (y1 == y2) ? y1 : y1 - 1;
+  for (y = y0; y <= last; y++) {
+    a = x0 + sa / dy01;
+    b = x0 + sb / dy02;
+    sa += dx01;
+    sb += dx02;
+    if (a > b) { t = a; a = b; b = t; }
+    drawFastHLine(a, y, b - a + 1, color);
+  }
+
+  // Lower half
+  sa = (int32_t)dx12 * (y - y1);
+  sb = (int32_t)dx02 * (y - y0);
+  for (; y <= y2; y++) {
+    a = x1 + sa / dy12;
+    b = x0 + sb / dy02;
+    sa += dx12;
+    sb += dx02;
+    if (a > b) { t = a; a = b; b = t; }
+    drawFastHLine(a, y, b - a + 1, color);
+  }
+}
+
+// Sets the text scale; 0 is treated as 1 like Adafruit_GFX.
+void FrameBufferCanvas::setTextSize(uint8_t size) {
+  textSize_ = (size > 0) ? size : 1;
+}
+
+// Moves the text cursor (top-left of the next glyph cell).
+void FrameBufferCanvas::setCursor(int16_t x, int16_t y) {
+  cursorX_ = x;
+  cursorY_ = y;
+}
+
+// Sets the glyph color; background stays transparent.
+void FrameBufferCanvas::setTextColor(uint16_t color) {
+  textColor_ = color;
+}
+
+// Renders text at the cursor, wrapping at the right edge.
+void FrameBufferCanvas::print(const char* text) {
+  if (!text) return;
+  while (*text) write(*text++);
+}
+
+// Renders text and moves the cursor to the start of the next line.
+void FrameBufferCanvas::println(const char* text) {
+  print(text);
+  write('\n');
+}
+
+// ===== PIXEL ACCESS =====
+
+// Sets, clears or inverts (color 2) one pixel; out-of-bounds writes are dropped.
+void FrameBufferCanvas::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  if (x < 0 || x >= WIDTH || y < 0 || y >= HEIGHT) return;
+  uint8_t& cell = buffer_[x + (y / 8) * WIDTH];
+  uint8_t bit = (uint8_t)(1 << (y & 7));
+  switch (color) {
+    case COLOR_WHITE: cell |= bit; break;
+    case COLOR_BLACK: cell &= (uint8_t)~bit; break;
+    case 2:           cell ^= bit; break;  // SSD1306_INVERSE
+    default: return;
+  }
+  pixelWrites_++;
+}
+
+// Returns true if the pixel is lit; out-of-bounds reads are dark.
+bool FrameBufferCanvas::getPixel(int16_t x, int16_t y) const {
+  if (x < 0 || x >= WIDTH || y < 0 || y >= HEIGHT) return false;
+  return (buffer_[x + (y / 8) * WIDTH] >> (y & 7)) & 1;
+}
+
+// Counts lit pixels across the whole frame.
+int FrameBufferCanvas::countLitPixels() const {
+  int lit = 0;
+  for (int i = 0; i < BUFFER_SIZE; i++) {
+    uint8_t b = buffer_[i];
+    while (b) {
+      b &= (uint8_t)(b - 1);
+      lit++;
+    }
+  }
+  return lit;
+}
+
+// ===== INTERNAL HELPERS =====
+
+// Horizontal run clipped to the screen.
+void FrameBufferCanvas::drawFastHLine(int16_t x, int16_t y, int16_t w,
+                                      uint16_t color) {
+  if (y < 0 || y >= HEIGHT) return;
+  if (x < 0) { w += x; x = 0; }
+  if (x + w > WIDTH) w = WIDTH - x;
+  for (int16_t i = 0; i < w; i++) drawPixel(x + i, y, color);
+}
+
+// Vertical run clipped to the screen.
+void FrameBufferCanvas::drawFastVLine(int16_t x, int16_t y, int16_t h,
+                                      uint16_t color) {
+  if (x < 0 || x >= WIDTH) return;
+  if (y < 0) { h += y; y = 0; }
+  if (y + h > HEIGHT) h = HEIGHT - y;
+  for (int16_t i = 0; i < h; i++) drawPixel(x, y + i, color);
+}
+
+// Quarter-circle outlines for round-rect corners (bits: 1=TL, 2=TR, 4=BR, 8=BL).
+void FrameBufferCanvas::drawCircleHelper(int16_t x0, int16_t y0, int16_t r,
+                                         uint8_t corners, uint16_t color) {
+  int16_t f = 1 - r;
+  int16_t ddFx = 1;
+  int16_t ddFy = -2 * r;
+  int16_t x = 0;
+  int16_t y = r;
+
+  while (x < y) {
+    if (f >= 0) {
+      y--;
+      ddFy += 2;
+      f += ddFy;
+    }
+    x++;
+    ddFx += 2;
+    f += ddFx;
+    if (corners & 0x4) {
+      drawPixel(x0 + x, y0 + y, color);
+      drawPixel(x0 + y, y0 + x, color);
+    }
+    if (corners & 0x2) {
+      drawPixel(x0 + x, y0 - y, color);
+      drawPixel(x0 + y, y0 - x, color);
+    }
+    if (corners & 0x8) {
+      drawPixel(x0 - y, y0 + x, color);
+      drawPixel(x0 - x, y0 + y, color);
+    }
+    if (corners & 0x1) {
+      drawPixel(x0 - y, y0 - x, color);
+      drawPixel(x0 - x, y0 - y, color);
+    }
+  }
+}
+
+// Half-disc column fill (bit 1 = right side, bit 2 = left side), stretched by delta rows.
+void FrameBufferCanvas::fillCircleHelper(int16_t x0, int16_t y0, int16_t r,
+                                         uint8_t corners, int16_t delta,
+                                         uint16_t color) {
+  int16_t f = 1 - r;
+  int16_t ddFx = 1;
+  int16_t ddFy = -2 * r;
+  int16_t x = 0;
+  int16_t y = r;
+  int16_t px = x;
+  int16_t py = y;
+
+  delta++;  // Avoid some +1's in the loop
+
+  while (x < y) {
+    if (f >= 0) {
+      y--;
+      ddFy += 2;
+      f += ddFy;
+    }
+    x++;
+    ddFx += 2;
+    f += ddFx;
+    // These checks avoid double-drawing certain lines
+    if (x < (y + 1)) {
+      if (corners & 1) drawFastVLine(x0 + x, y0 - y, 2 * y + delta, color);
+      if (corners & 2) drawFastVLine(x0 - x, y0 - y, 2 * y + delta, color);
+    }
+    if (y != py) {
+      if (corners & 1) drawFastVLine(x0 + py, y0 - px, 2 * px + delta, color);
+      if (corners & 2) drawFastVLine(x0 - py, y0 - px, 2 * px + delta, color);
+      py = y;
+    }
+    px = x;
+  }
+}
+
+// One glyph cell at (x, y); each font pixel becomes a textSize_ square.
+void FrameBufferCanvas::drawChar(int16_t x, int16_t y, char c) {
+  if (c < FONT_FIRST || c > FONT_LAST) return;
+  if (x >= WIDTH || y >= HEIGHT || x + 6 * textSize_ - 1 < 0 ||
+      y + 8 * textSize_ - 1 < 0) {
+    return;
+  }
+  const uint8_t* glyph = FONT_5X7[c - FONT_FIRST];
+  for (int8_t i = 0; i < 5; i++) {
+    uint8_t line = glyph[i];
+    for (int8_t j = 0; j < 8; j++, line >>= 1) {
+      if (!(line & 1)) continue;
+      if (textSize_ == 1) {
+        drawPixel(x + i, y + j, textColor_);
+      } else {
+        fillRect(x + i * textSize_, y + j * textSize_, textSize_, textSize_,
+                 textColor_);
+      }
+    }
+  }
+}
+
+// Advances the cursor for one character, handling newline and right-edge wrap.
+void FrameBufferCanvas::write(char c) {
+  if (c == '\n') {
+    cursorX_ = 0;
+    cursorY_ += textSize_ * 8;
+    return;
+  }
+  if (c == '\r') return;
+  if (cursorX_ + textSize_ * 6 > WIDTH) {
+    cursorX_ = 0;
+    cursorY_ += textSize_ * 8;
+  }
+  drawChar(cursorX_, cursorY_, c);
+  cursorX_ += textSize_ * 6;
+}
@@ -0,0 +1,278 @@
+#include "http_proto.h"
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+#include <stdlib.h>
+
+// Case-insensitive string equality.
+static bool equalsIgnoreCase(const char* a, const char* b) {
+  while (*a && *b) {
+    if (tolower((unsigned char)*a) != tolower((unsigned char)*b)) return false;
+    a++;
+    b++;
+  }
+  return *a == *b;
+}
+
+// True if the comma-separated header value lists token (case-insensitive).
+static bool listsToken(const char* value, const char* token) {
+  size_t tlen = strlen(token);
+  const char* p = value;
+  while (*p) {
+    while (*p == ' ' || *p == ',') p++;
+    const char* start = p;
+    while (*p && *p != ',') p++;
+    const char* end = p;
+    while (end > start && end[-1] == ' ') end--;
+    if ((size_t)(end - start) == tlen) {
+      size_t i = 0;
+      while (i < tlen && tolower((unsigned char)start[i]) == tolower((unsigned char)token[i])) i++;
+      if (i == tlen) return true;
+    }
+  }
+  return false;
+}
+
+// Starts empty, waiting for a request line.
+HttpRequestParser::HttpRequestParser() { reset(); }
+
+// Clears the buffer and every parsed field.
+void HttpRequestParser::reset() {
+  len_ = 0;
+  buf_[0] = '\0';
+  headerEnd_ = 0;
+  contentLength_ = 0;
+  state_ = HTTP_PARSE_NEED_MORE;
+  errorStatus_ = 0;
+  method_ = HttpMethod::OTHER;
+  http11_ = false;
+  path_ = query_ = body_ = "";
+  headerCount_ = 0;
+}
+
+// Marks the request as failed with the status the server should answer.
+void HttpRequestParser::fail(int status) {
+  state_ = HTTP_PARSE_ERROR;
+  errorStatus_ = status;
+}
+
+// Buffers bytes until the head is complete, parses it, then waits for Content-Length body bytes.
+size_t HttpRequestParser::feed(const uint8_t* data, size_t len) {
+  size_t used = 0;
+  while (used < len && state_ == HTTP_PARSE_NEED_MORE) {
+    if (headerEnd_ == 0) {
+      // Head: copy byte by byte so the blank line is noticed without rescanning the buffer
+      if (len_ >= HTTP_MAX_HEADER_BYTES) { fail(431); break; }
+      buf_[len_++] = (char)data[used++];
+      if (len_ >= 4 && memcmp(buf_ + len_ - 4, "\r\n\r\n", 4) == 0) {
+        headerEnd_ = len_;
+        parseHead();
+        if (state_ == HTTP_PARSE_NEED_MORE && contentLength_ == 0) {
+          buf_[len_] = '\0';
+          body_ = buf_ + headerEnd_;
+          state_ = HTTP_PARSE_COMPLETE;
+        }
+      }
+    } else {
+      size_t want = headerEnd_ + contentLength_ - len_;
+      size_t take = len - used < want ? len - used : want;
+      memcpy(buf_ + len_, data + used, take);
+      len_ += take;
+      used += take;
+      if (len_ == headerEnd_ + contentLength_) {
+        buf_[len_] = '\0';
+        body_ = buf_ + headerEnd_;
+        state_ = HTTP_PARSE_COMPLETE;
+      }
+    }
+  }
+  return used;
+}
+
+// Splits the request line and headers in place (NUL-terminating each token) and validates limits.
+void HttpRequestParser::parseHead() {
+  char* p = buf_;
+  char* end = buf_ + headerEnd_;
+
+  // Request line: METHOD SP target SP HTTP/1.x CRLF
+  char* sp1 = (char*)memchr(p, ' ', end - p);
+  if (!sp1) { fail(400); return; }
+  *sp1 = '\0';
+  if      (!strcmp(p, "GET"))     method_ = HttpMethod::GET;
+  else if (!strcmp(p, "POST"))    method_ = HttpMethod::POST;
+  else if (!strcmp(p, "PUT"))     method_ = HttpMethod::PUT;
+  else if (!strcmp(p, "DELETE"))  method_ = HttpMethod::DELETE_;
+  else if (!strcmp(p, "HEAD"))    method_ = HttpMethod::HEAD;
+  else if (!strcmp(p, "OPTIONS")) method_ = HttpMethod::OPTIONS;
+  else                            method_ = HttpMethod::OTHER;
+
+  char* target = sp1 + 1;
+  char* sp2 = (char*)memchr(target, ' ', end - target);
+  char* eol = (char*)memchr(target, '\r', end - target);
+  if (!sp2 || !eol || sp2 > eol || *target != '/') { fail(400); return; }
+  *sp2 = '\0';
+  *eol = '\0';
+  const char* version = sp2 + 1;
+  if (strncmp(version, "HTTP/1.", 7) != 0) { fail(505); return; }
+  http11_ = (version[7] == '1');
+
+  path_ = target;
+  char* q = strchr(target, '?');
+  if (q) {
+    *q = '\0';
+    query_ = q + 1;
+  } else {
+    query_ = "";
+  }
+
+  // Header lines: Name: value CRLF ... CRLF
+  p = eol + 2;
+  while (p < end - 2) {
+    char* lineEnd = (char*)memchr(p, '\r', end - p);
+    if (!lineEnd) { fail(400); return; }
+    *lineEnd = '\0';
+    char* colon = strchr(p, ':');
+    if (!colon || colon == p) { fail(400); return; }
+    *colon = '\0';
+    char* value = colon + 1;
+    while (*value == ' ' || *value == '\t') value++;
+    char* vend = lineEnd;
+    while (vend > value && (vend[-1] == ' ' || vend[-1] == '\t')) *--vend = '\0';
+    if (headerCount_ >= MAX_HEADERS) { fail(431); return; }
+    headerNames_[headerCount_] = p;
+    headerValues_[headerCount_] = value;
+    headerCount_++;
+    p = lineEnd + 2;
+  }
+
+  const char* te = header("Transfer-Encoding");
+  if (te) { fail(400); return; }  // chunked request bodies are never sent by the UI
+  const char* cl = header("Content-Length");
+  if (cl) {
+    char* numEnd = nullptr;
+    unsigned long n = strtoul(cl, &numEnd, 10);
+    if (numEnd == cl || *numEnd != '\0') { fail(400); return; }
+    if (n > HTTP_MAX_REQUEST_BYTES - headerEnd_) { fail(413); return; }
+    contentLength_ = (size_t)n;
+  }
+}
+
+// Linear scan — requests carry a handful of headers.
+const char* HttpRequestParser::header(const char* name) const {
+  for (int i = 0; i < headerCount_; i++) {
+    if (equalsIgnoreCase(headerNames_[i], name)) return headerValues_[i];
+  }
+  return nullptr;
+}
+
+// Applies the version default, then any Connection: close / keep-alive token.
+bool HttpRequestParser::keepAlive() const {
+  const char* c = header("Connection");
+  if (c && listsToken(c, "close")) return false;
+  if (c && listsToken(c, "keep-alive")) return true;
+  return http11_;
+}
+
+// Hex digit value, or -1.
+static int hexValue(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+// Finds name=value in an &-separated urlencoded string and decodes value into out
+// (out == nullptr only reports whether the name is present).
+bool HttpRequestParser::findArg(const char* src, size_t srcLen, const char* name,
+                                char* out, size_t cap) {
+  size_t nameLen = strlen(name);
+  const char* p = src;
+  const char* end = src + srcLen;
+  while (p < end) {
+    const char* pairEnd = (const char*)memchr(p, '&', end - p);
+    if (!pairEnd) pairEnd = end;
+    const char* eq = (const char*)memchr(p, '=', pairEnd - p);
+    const char* keyEnd = eq ? eq : pairEnd;
+    if ((size_t)(keyEnd - p) == nameLen && memcmp(p, name, nameLen) == 0) {
+      if (!out) return true;
+      size_t n = 0;
+      for (const char* v = eq ? eq + 1 : pairEnd; v < pairEnd; v++) {
+        char c = *v;
+        if (c == '+') {
+          c = ' ';
+        } else if (c == '%' && pairEnd - v >= 3 && hexValue(v[1]) >= 0 && hexValue(v[2]) >= 0) {
+          c = (char)(hexValue(v[1]) * 16 + hexValue(v[2]));
+          v += 2;
+        }
+        if (n + 1 >= cap) return false;
+        out[n++] = c;
+      }
+      out[n] = '\0';
+      return true;
+    }
+    p = pairEnd + 1;
+  }
+  return false;
+}
+
+// Query string first (GET), then a form body (POST from URLSearchParams).
+bool HttpRequestParser::arg(const char* name, char* out, size_t cap) const {
+  if (out && cap == 0) return false;
+  if (findArg(query_, strlen(query_), name, out, cap)) return true;
+  const char* type = header("Content-Type");
+  bool form = !type || strncmp(type, "application/x-www-form-urlencoded", 33) == 0 ||
+              strncmp(type, "text/plain", 10) == 0;
+  return form && findArg(body_, contentLength_, name, out, cap);
+}
+
+// True when the name appears in the query or form body, whatever its value.
+bool HttpRequestParser::hasArg(const char* name) const { return arg(name, nullptr, 0); }
+
+// Reason phrases for the codes the routes and the server itself produce.
+const char* httpStatusText(int code) {
+  switch (code) {
+    case 200: return "OK";
+    case 204: return "No Content";
+    case 304: return "Not Modified";
+    case 400: return "Bad Request";
+    case 404: return "Not Found";
+    case 405: return "Method Not Allowed";
+    case 408: return "Request Timeout";
+    case 413: return "Payload Too Large";
+    case 431: return "Request Header Fields Too Large";
+    case 500: return "Internal Server Error";
+    case 503: return "Service Unavailable";
+    case 505: return "HTTP Version Not Supported";
+    default:  return "Unknown";
+  }
+}
+
+// Status line, Content-Type/Length (or chunked), Connection, extras, blank line.
+size_t formatResponseHead(char* out, size_t cap, int code, const char* contentType,
+                          long contentLength, bool keepAlive, const char* extraHeaders) {
+  int n = snprintf(out, cap, "HTTP/1.1 %d %s\r\n", code, httpStatusText(code));
+  if (n < 0 || (size_t)n >= cap) return 0;
+  size_t len = (size_t)n;
+  if (contentType && *contentType) {
+    n = snprintf(out + len, cap - len, "Content-Type: %s\r\n", contentType);
+    if (n < 0 || (size_t)n >= cap - len) return 0;
+    len += (size_t)n;
+  }
+  if (contentLength < 0) {
+    n = snprintf(out + len, cap - len, "Transfer-Encoding: chunked\r\n");
+  } else {
+    n = snprintf(out + len, cap - len, "Content-Length: %ld\r\n", contentLength);
+  }
+  if (n < 0 || (size_t)n >= cap - len) return 0;
+  len += (size_t)n;
+  n = snprintf(out + len, cap - len, "Connection: %s\r\n%s\r\n",
+               keepAlive ? "keep-alive" : "close", extraHeaders ? extraHeaders : "");
+  if (n < 0 || (size_t)n >= cap - len) return 0;
+  return len + (size_t)n;
+}
+
+// Lowercase hex length line.
+size_t formatChunkHeader(char* out, size_t cap, size_t len) {
+  int n = snprintf(out, cap, "%lx\r\n", (unsigned long)len);
+  return (n < 0 || (size_t)n >= cap) ? 0 : (size_t)n;
+}
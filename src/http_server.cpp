@@ -0,0 +1,369 @@
+// http_server.cpp — non-blocking pooled HTTP/1.1 server (see http_server.h).
+
+#ifndef NATIVE_BUILD
+
+#include "http_server.h"
+#include <errno.h>
+#include <lwip/sockets.h>
+
+// Switches a socket between blocking and non-blocking mode.
+static void setNonBlocking(int fd, bool on) {
+  int flags = lwip_fcntl(fd, F_GETFL, 0);
+  if (flags < 0) return;
+  lwip_fcntl(fd, F_SETFL, on ? (flags | O_NONBLOCK) : (flags & ~O_NONBLOCK));
+}
+
+// True for the errno values that mean "try again later" on a non-blocking socket.
+static bool wouldBlock() {
+  return errno == EAGAIN || errno == EWOULDBLOCK;
+}
+
+// Every slot starts free; the listener opens in begin().
+HttpServer::HttpServer(uint16_t port)
+  : listener_(port, HTTP_MAX_CONNECTIONS),
+    port_(port),
+    routeCount_(0),
+    current_(nullptr),
+    responded_(false),
+    extraLen_(0) {
+  extraHeaders_[0] = '\0';
+  for (int i = 0; i < HTTP_MAX_CONNECTIONS; i++) {
+    conns_[i].state = CONN_FREE;
+    conns_[i].carryLen = 0;
+    clearResponse(conns_[i]);
+  }
+}
+
+// Adds an exact-path route; extra routes beyond MAX_ROUTES are logged and ignored.
+void HttpServer::on(const char* uri, HttpMethod method, Handler handler) {
+  if (routeCount_ >= MAX_ROUTES) {
+    Serial.printf("[HTTP] route table full — %s not registered\n", uri);
+    return;
+  }
+  routes_[routeCount_].uri = uri;
+  routes_[routeCount_].method = method;
+  routes_[routeCount_].handler = handler;
+  routeCount_++;
+}
+
+// Opens the listening socket (accept() on it never blocks).
+void HttpServer::begin() {
+  listener_.begin();
+  listener_.setNoDelay(true);
+}
+
+// One bounded pass over the pool: accept, then read and/or write each live connection.
+void HttpServer::update() {
+  unsigned long now = millis();
+  acceptPending(now);
+  for (int i = 0; i < HTTP_MAX_CONNECTIONS; i++) {
+    Connection& c = conns_[i];
+    if (c.state == CONN_READING) readFrom(c, now);
+    if (c.state == CONN_WRITING) writeTo(c, now);
+  }
+}
+
+// Moves waiting clients into free slots; with the pool full they stay in the TCP backlog.
+void HttpServer::acceptPending(unsigned long now) {
+  for (int i = 0; i < HTTP_MAX_CONNECTIONS; i++) {
+    Connection& c = conns_[i];
+    if (c.state != CONN_FREE) continue;
+    WiFiClient client = listener_.available();
+    if (!client) return;
+    setNonBlocking(client.fd(), true);
+    client.setNoDelay(true);
+    c.client = client;
+    c.state = CONN_READING;
+    c.keepAlive = false;
+    c.lastActive = now;
+    c.req.reset();
+    c.carryLen = 0;
+    clearResponse(c);
+  }
+}
+
+// Feeds pipelined leftovers or one read slice to the parser, then acts on its state.
+void HttpServer::readFrom(Connection& c, unsigned long now) {
+  if (c.carryLen > 0) {
+    size_t used = c.req.feed(c.carry, c.carryLen);
+    memmove(c.carry, c.carry + used, c.carryLen - used);
+    c.carryLen -= used;
+  } else {
+    uint8_t buf[HTTP_READ_SLICE_BYTES];
+    int n = lwip_recv(c.client.fd(), buf, sizeof(buf), MSG_DONTWAIT);
+    if (n == 0 || (n < 0 && !wouldBlock())) {
+      close(c);  // peer closed or socket error
+      return;
+    }
+    if (n > 0) {
+      c.lastActive = now;
+      size_t used = c.req.feed(buf, (size_t)n);
+      c.carryLen = (size_t)n - used;
+      memcpy(c.carry, buf + used, c.carryLen);
+    }
+  }
+
+  switch (c.req.state()) {
+    case HTTP_PARSE_COMPLETE:
+      dispatch(c);
+      break;
+    case HTTP_PARSE_ERROR:
+      sendError(c, c.req.errorStatus());
+      break;
+    case HTTP_PARSE_NEED_MORE:
+      if (c.req.started() && now - c.lastActive > HTTP_REQUEST_TIMEOUT_MS) {
+        sendError(c, 408);
+      } else if (!c.req.started() && now - c.lastActive > HTTP_KEEPALIVE_MS) {
+        close(c);
+      }
+      break;
+  }
+}
+
+// Runs the matching route (or the not-found handler) with this connection as the current request.
+void HttpServer::dispatch(Connection& c) {
+  current_ = &c;
+  responded_ = false;
+  extraLen_ = 0;
+  extraHeaders_[0] = '\0';
+  c.keepAlive = c.req.keepAlive();
+
+  Handler* handler = nullptr;
+  for (int i = 0; i < routeCount_; i++) {
+    if (routes_[i].method == c.req.method() && strcmp(routes_[i].uri, c.req.path()) == 0) {
+      handler = &routes_[i].handler;
+      break;
+    }
+  }
+  if (handler) {
+    (*handler)();
+  } else if (notFound_) {
+    notFound_();
+  } else {
+    send(404, "text/plain", "Not found");
+  }
+
+  current_ = nullptr;
+  if (c.state == CONN_READING && !responded_) sendError(c, 500);  // handler sent nothing
+}
+
+// Writes up to HTTP_WRITE_SLICE_BYTES of head, flash body or chunks — whatever the socket accepts.
+void HttpServer::writeTo(Connection& c, unsigned long now) {
+  size_t budget = HTTP_WRITE_SLICE_BYTES;
+  while (budget > 0) {
+    const uint8_t* p;
+    size_t n;
+    if (c.txSent < c.txLen) {
+      p = (const uint8_t*)c.tx + c.txSent;
+      n = c.txLen - c.txSent;
+    } else if (c.body && c.bodySent < c.bodyLen) {
+      p = c.body + c.bodySent;
+      n = c.bodyLen - c.bodySent;
+    } else if (c.chunks && !c.chunksDone) {
+      fillNextChunk(c);
+      continue;
+    } else {
+      finishResponse(c);
+      return;
+    }
+
+    if (n > budget) n = budget;
+    int w = lwip_send(c.client.fd(), p, n, MSG_DONTWAIT);
+    if (w < 0) {
+      if (!wouldBlock()) { close(c); return; }
+      break;  // socket buffer full — continue next pass
+    }
+    if (c.txSent < c.txLen) c.txSent += (size_t)w;
+    else c.bodySent += (size_t)w;
+    budget -= (size_t)w;
+    c.lastActive = now;
+    if ((size_t)w < n) break;
+  }
+  if (now - c.lastActive > HTTP_REQUEST_TIMEOUT_MS) close(c);  // client stopped reading
+}
+
+// Asks the stream for its next piece and frames it as one chunk in tx (or the final 0-chunk).
+bool HttpServer::fillNextChunk(Connection& c) {
+  const size_t reserve = 8;  // room for the "<hex>\r\n" prefix
+  size_t n = c.chunks(c.tx + reserve, sizeof(c.tx) - reserve - 2);
+  if (n == 0) {
+    memcpy(c.tx, "0\r\n\r\n", 5);
+    c.txSent = 0;
+    c.txLen = 5;
+    c.chunksDone = true;
+    return false;
+  }
+  char head[reserve];
+  size_t h = formatChunkHeader(head, sizeof(head), n);
+  memcpy(c.tx + reserve - h, head, h);
+  memcpy(c.tx + reserve + n, "\r\n", 2);
+  c.txSent = reserve - h;
+  c.txLen = reserve + n + 2;
+  return true;
+}
+
+// Returns the slot to reading for the next keep-alive request, or closes it.
+void HttpServer::finishResponse(Connection& c) {
+  if (!c.keepAlive) {
+    close(c);
+    return;
+  }
+  clearResponse(c);
+  c.req.reset();
+  c.state = CONN_READING;
+}
+
+// Answers a protocol error (or handler failure) and closes once it is sent.
+void HttpServer::sendError(Connection& c, int code) {
+  Connection* prev = current_;
+  current_ = &c;
+  extraLen_ = 0;
+  extraHeaders_[0] = '\0';
+  c.keepAlive = false;
+  send(code, "text/plain", httpStatusText(code));
+  current_ = prev;
+}
+
+// Formats the head into tx; bodyBytes more will follow it there. False if they do not fit.
+bool HttpServer::beginResponse(int code, const char* contentType, long contentLength,
+                               size_t bodyBytes) {
+  Connection& c = *current_;
+  clearResponse(c);
+  size_t h = formatResponseHead(c.tx, sizeof(c.tx), code, contentType, contentLength,
+                                c.keepAlive, extraHeaders_);
+  if (h == 0 || h + bodyBytes > sizeof(c.tx)) {
+    Serial.printf("[HTTP] %s: %d response too large for tx buffer\n", c.req.path(), code);
+    c.keepAlive = false;
+    h = formatResponseHead(c.tx, sizeof(c.tx), 500, "text/plain", 0, false, nullptr);
+    c.txLen = h;
+    c.state = CONN_WRITING;
+    responded_ = true;
+    return false;
+  }
+  c.txLen = h;
+  c.state = CONN_WRITING;
+  responded_ = true;
+  return true;
+}
+
+// Releases the socket and the slot.
+void HttpServer::close(Connection& c) {
+  c.client.stop();
+  c.client = WiFiClient();
+  c.state = CONN_FREE;
+  c.carryLen = 0;
+  c.req.reset();
+  clearResponse(c);
+}
+
+// Forgets any pending response on the slot.
+void HttpServer::clearResponse(Connection& c) {
+  c.txLen = 0;
+  c.txSent = 0;
+  c.body = nullptr;
+  c.bodyLen = 0;
+  c.bodySent = 0;
+  c.chunks = nullptr;
+  c.chunksDone = false;
+}
+
+// ===== REQUEST ACCESSORS =====
+
+// True when the current request carries the argument in its query or form body.
+bool HttpServer::hasArg(const char* name) const {
+  return current_ && current_->req.hasArg(name);
+}
+
+// Decoded argument value, or "" when absent or longer than 255 bytes.
+String HttpServer::arg(const char* name) const {
+  char value[256];
+  if (!current_ || !current_->req.arg(name, value, sizeof(value))) return String();
+  return String(value);
+}
+
+// Request header value, or "" when absent.
+String HttpServer::header(const char* name) const {
+  const char* v = current_ ? current_->req.header(name) : nullptr;
+  return String(v ? v : "");
+}
+
+// ===== RESPONSES =====
+
+// Queues a header for the next send*() call; dropped with a log line if the buffer is full.
+void HttpServer::sendHeader(const char* name, const char* value) {
+  int n = snprintf(extraHeaders_ + extraLen_, sizeof(extraHeaders_) - extraLen_,
+                   "%s: %s\r\n", name, value);
+  if (n < 0 || (size_t)n >= sizeof(extraHeaders_) - extraLen_) {
+    extraHeaders_[extraLen_] = '\0';
+    Serial.printf("[HTTP] header %s dropped\n", name);
+    return;
+  }
+  extraLen_ += (size_t)n;
+}
+
+// Head and body are copied into the connection's tx buffer.
+void HttpServer::send(int code, const char* contentType, const char* body) {
+  if (!current_) return;
+  size_t len = body ? strlen(body) : 0;
+  if (!beginResponse(code, contentType, (long)len, len)) return;
+  memcpy(current_->tx + current_->txLen, body, len);
+  current_->txLen += len;
+}
+
+// Flash-resident text body.
+void HttpServer::send_P(int code, const char* contentType, const char* flashBody) {
+  sendStatic(code, contentType, (const uint8_t*)flashBody, strlen(flashBody));
+}
+
+// Only the head is buffered; the body is written from where it lives.
+void HttpServer::sendStatic(int code, const char* contentType, const uint8_t* data, size_t len) {
+  if (!current_) return;
+  if (!beginResponse(code, contentType, (long)len, 0)) return;
+  current_->body = data;
+  current_->bodyLen = len;
+}
+
+// Head now, then fn-generated chunks as the socket drains.
+void HttpServer::sendStream(int code, const char* contentType, ChunkFn fn) {
+  if (!current_) return;
+  if (!beginResponse(code, contentType, -1, 0)) return;
+  current_->chunks = fn;
+}
+
+// Detaches the socket (still non-blocking) and frees the slot without closing it.
+WiFiClient HttpServer::takeClient() {
+  if (!current_) return WiFiClient();
+  Connection& c = *current_;
+  WiFiClient client = c.client;
+  c.client = WiFiClient();
+  c.state = CONN_FREE;
+  c.carryLen = 0;
+  c.req.reset();
+  clearResponse(c);
+  responded_ = true;
+  return client;
+}
+
+// Same MSG_DONTWAIT send as writeTo(), but with no tx slot to resume from: a message
+// the socket buffer can't take in full counts as a failed write.
+bool HttpServer::writeNow(WiFiClient& client, const void* data, size_t len) {
+  const uint8_t* p = (const uint8_t*)data;
+  while (len > 0) {
+    int w = lwip_send(client.fd(), p, len, MSG_DONTWAIT);
+    if (w <= 0) return false;  // EAGAIN included: a later retry would send a torn message
+    p += w;
+    len -= (size_t)w;
+  }
+  return true;
+}
+
+// Slots currently holding a client.
+int HttpServer::activeConnections() const {
+  int n = 0;
+  for (int i = 0; i < HTTP_MAX_CONNECTIONS; i++) {
+    if (conns_[i].state != CONN_FREE) n++;
+  }
+  return n;
+}
+
+#endif // NATIVE_BUILD
@@ -1,24 +1,31 @@
 #include "input.h"
+#include "edge_queue.h"
 #include "runtime_config.h"
 
 InputManager inputManager;
 
-// Initializes gesture state machine fields to their idle/default values.
+// Filled by the touch-pin interrupt, drained by handleTouchInteraction().
+static EdgeQueue touchEdges;
+
+// CHANGE interrupt on TOUCH_PIN: timestamp the edge and queue it. Nothing else runs in the ISR.
+static void IRAM_ATTR onTouchEdge() {
+  touchEdges.push((uint32_t)micros(), (uint8_t)digitalRead(TOUCH_PIN));
+}
+
+// Starts idle with no gesture handler.
 InputManager::InputManager()
   : lastInteraction(0),
-    onGesture_(nullptr),
-    touchStartTime_(0),
-    lastTapTime_(0),
-    pendingTapTime_(0),
-    touchActive_(false),
-    longPressFired_(false),
-    pendingTap_(false) {
+    onGesture_(nullptr) {
+  decoder_.setEmit(emitGesture, this);
 }
 
-// Configures the touch pin with pull-up and logs the GPIO assignment.
+// Configures the touch pin with pull-up, attaches the edge interrupt and logs the GPIO assignment.
 void InputManager::init() {
   pinMode(TOUCH_PIN, INPUT_PULLUP);
-  Serial.printf("Touch sensor configured on GPIO%d\n", TOUCH_PIN);
+  decoder_.reset(isTouched());
+  attachInterrupt(digitalPinToInterrupt(TOUCH_PIN), onTouchEdge, CHANGE);
+  Serial.printf("Touch sensor configured on GPIO%d (edge interrupt, %dus debounce)\n",
+                TOUCH_PIN, TOUCH_DEBOUNCE_US);
 }
 
 // Returns true if the touch pin is currently asserted (active low).
@@ -26,61 +33,45 @@ bool InputManager::isTouched() {
   return digitalRead(TOUCH_PIN) == LOW;
 }
 
-// Returns gesture classification based on press duration and time since last tap.
-// Exposed for unit testing.
-TouchGesture classifyGesture(unsigned long pressDuration, unsigned long sincePrevTap) {
-  if (pressDuration >= runtimeConfig.longPressMs) return GESTURE_LONG_PRESS;
-  if (sincePrevTap <= runtimeConfig.doubleTapWindowMs) return GESTURE_DOUBLE_TAP;
-  return GESTURE_TAP;
+// Decoder callback: forwards the gesture to the handler and counts it as interaction.
+void InputManager::emitGesture(TouchGesture gesture, uint32_t us, void* ctx) {
+  (void)us;
+  InputManager* self = static_cast<InputManager*>(ctx);
+  unsigned long now = millis();
+  self->lastInteraction = now;
+  if (self->onGesture_) self->onGesture_(gesture, now);
 }
 
-// Polls the touch pin and fires the gesture callback (TAP, LONG_PRESS, or DOUBLE_TAP) on state changes.
+// Feeds every queued edge to the decoder in order, then lets it fire time-based gestures.
 void InputManager::handleTouchInteraction() {
-  bool currentlyTouched = isTouched();
-  unsigned long now = millis();
-
-  // Detect press start (HIGH→LOW, i.e. not touched → touched)
-  if (currentlyTouched && !touchActive_) {
-    touchActive_ = true;
-    touchStartTime_ = now;
-    longPressFired_ = false;
-
-    // If a tap was pending and a new touch arrives within the window: double tap
-    if (pendingTap_ && now - pendingTapTime_ <= runtimeConfig.doubleTapWindowMs) {
-      pendingTap_ = false;
-      lastTapTime_ = 0;
-      if (onGesture_) onGesture_(GESTURE_DOUBLE_TAP, now);
-      lastInteraction = now;
-    }
+  uint32_t dropped = touchEdges.takeOverflows();
+  if (dropped) {
+    // Lost edges leave the decoder's idea of the level unreliable — resync from the pin.
+    Serial.printf("[INPUT] %u touch edges dropped, resyncing\n", (unsigned)dropped);
+    decoder_.reset(isTouched());
   }
 
-  // While held: fire long press on threshold crossing (before release)
-  if (touchActive_ && !longPressFired_) {
-    if (now - touchStartTime_ >= runtimeConfig.longPressMs) {
-      longPressFired_ = true;
-      pendingTap_ = false;  // cancel any pending tap
-      if (onGesture_) onGesture_(GESTURE_LONG_PRESS, now);
-      lastInteraction = now;
-    }
+  bool sawEdge = false;
+  TouchEdge edge;
+  while (touchEdges.pop(edge)) {
+    decoder_.onEdge(edge.us, edge.level);
+    sawEdge = true;
   }
+  // Read the clock only after draining, so it is never older than an edge just handled.
+  decoder_.poll((uint32_t)micros());
+  if (sawEdge) lastInteraction = millis();
+}
 
-  // Detect release (LOW→HIGH, i.e. touched → not touched)
-  if (!currentlyTouched && touchActive_) {
-    touchActive_ = false;
-    unsigned long duration = now - touchStartTime_;
-
-    if (!longPressFired_ && duration < runtimeConfig.longPressMs) {
-      // Short press: set pending tap, wait for possible second tap
-      pendingTap_ = true;
-      pendingTapTime_ = now;
-      lastTapTime_ = now;
-    }
-    lastInteraction = now;
-  }
+// Edges are waiting in the ISR queue.
+bool InputManager::hasPendingEdges() const {
+  return !touchEdges.empty();
+}
 
-  // Fire pending tap if double-tap window has expired
-  if (pendingTap_ && !touchActive_ && now - pendingTapTime_ > runtimeConfig.doubleTapWindowMs) {
-    pendingTap_ = false;
-    if (onGesture_) onGesture_(GESTURE_TAP, now);
-  }
+// Converts the decoder's microsecond deadline to millis(), rounding up so the task never runs early.
+unsigned long InputManager::nextDeadline(unsigned long now) const {
+  uint32_t dueUs;
+  if (!decoder_.nextDeadline(dueUs)) return now + INPUT_IDLE_POLL_MS;
+  int32_t aheadUs = (int32_t)(dueUs - (uint32_t)micros());
+  if (aheadUs <= 0) return now;
+  return now + ((unsigned long)aheadUs + 999) / 1000;
 }
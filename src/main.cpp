@@ -5,7 +5,7 @@
 #include "config.h"
 #include "emotion.h"
 #include "emotion_registry.h"
-#include "emotion_draws.h"
+#include "emotion_catalog.h"
 #include "display.h"
 #include "animations.h"
 #include "battery.h"
@@ -15,98 +15,123 @@
 #include "personality.h"
 #include "runtime_config.h"
 #include "web_server.h"
+#include "scheduler.h"
+#include "transition.h"
+#include "frame_cache.h"
+#include "metrics.h"
+#include "boot_profile.h"
+#include "clock_service.h"
+#include "command_queue.h"
+#include "ble_proto.h"
+#include "script_player.h"
 #include <WiFi.h>
 
 // ===== GLOBAL STATE =====
 unsigned long bootTime = 0;
+static int renderTaskId = -1;
+static int inputTaskId = -1;
 
 // ===== CALLBACKS (wiring between decoupled modules) =====
 
 // Called when a blink transition completes; resets the animation state for the new emotion.
 void onTransitionComplete(EmotionState newEmotion) {
   animationManager.resetAnimation(newEmotion);
+  scheduler.wake(renderTaskId, millis());
 }
 
-// Called when the active emotion changes; queues a beep if enableEmotionBeep is set.
+// Called when the active emotion changes; queues a beep if enableEmotionBeep is set,
+// wakes the render task so the transition starts without waiting for the old frame deadline,
+// and pushes the change to open web UI event streams.
 void onEmotionChange(EmotionState from, EmotionState to) {
   if (runtimeConfig.enableEmotionBeep) {
-    beepManager.queueEmotionBeep(to);
+    beepManager.queueEmotionBeep(to);  // plays from its own timer — nothing to schedule
   }
+  scheduler.wake(renderTaskId, millis());
+  webServerManager.pushEmotion(to);
 }
 
 // ===== BLE CALLBACK =====
 
-// BLE write callback: sets the target emotion when a valid emotion ID is received over BLE.
-void onBleEmotion(EmotionState e) {
-  emotionManager.setTargetEmotion(e);
-  Serial.printf("BLE: emotion set to %s\n", emotionRegistry.getName(e));
+// BLE write callback — runs on the NimBLE host task, so it only decodes and queues the batch for loop().
+void onBleWrite(const uint8_t* data, size_t len) {
+  ControlStatus st = decodeBleWrite(data, len, commandQueue, millis());
+  if (st != CTRL_OK) {
+    Serial.printf("[BLE] write of %u bytes rejected (status %d)\n", (unsigned)len, (int)st);
+  }
 }
 
 // ===== GESTURE CALLBACK =====
 
-// Touch gesture callback: resets neglect arc on any touch, then maps gesture type to emotion.
+// Touch gesture callback: queued like every other command, handled by applyGesture() in commandTask.
+void onGesture(TouchGesture gesture, unsigned long currentTime) {
+  commandQueue.post(CMD_GESTURE, CMD_SRC_TOUCH, (uint8_t)gesture, currentTime);
+}
+
+// Resets neglect arc on any touch, then maps gesture type to the emotion to show (-1 for none).
 // Multi-touch forgiveness: deep neglect (GRUMPY/ANGRY) requires multiple touches before recovery.
 // During forgiveness, SANGI stays in its current sulk emotion — no SHY yet.
-void onGesture(TouchGesture gesture, unsigned long currentTime) {
+int applyGesture(TouchGesture gesture, unsigned long currentTime) {
   bool wasNeglected = personality.onTouch(currentTime, emotionManager.getCurrentEmotion());
 
   // Still forgiving — SANGI hasn't warmed up yet, stay in sulk
   if (personality.isForgiving()) {
-    return;
+    return -1;
   }
 
   // Neglect recovery complete — enter SHY before warmth arc
   if (wasNeglected) {
-    emotionManager.setTargetEmotion(EMOTION_SHY);
-    return;
+    return EMOTION_SHY;
   }
 
   // Normal touch responses
   switch (gesture) {
-    case GESTURE_TAP:
-      emotionManager.setTargetEmotion(EMOTION_HAPPY);
-      break;
-    case GESTURE_LONG_PRESS:
-      emotionManager.setTargetEmotion(EMOTION_LOVE);
-      break;
-    case GESTURE_DOUBLE_TAP:
-      emotionManager.setTargetEmotion(EMOTION_EXCITED);
-      break;
-    default: break;
+    case GESTURE_TAP:        return EMOTION_HAPPY;
+    case GESTURE_LONG_PRESS: return EMOTION_LOVE;
+    case GESTURE_DOUBLE_TAP: return EMOTION_EXCITED;
+    default:                 return -1;
   }
 }
 
-// ===== EMOTION REGISTRY SETUP =====
-
-// Registers all emotion definitions with per-emotion frame counts, delays, loop modes, and draw functions.
-void registerEmotions() {
-  // Frame counts and delays now vary per emotion — each has its own temporal character.
-  // Loop durations (approximate):
-  //   PINGPONG full cycle = (frameCount * 2 - 2) * frameDelay
-  //   RESTART full cycle  = frameCount * frameDelay
-  //
-  // frameDelay tiers match emotional energy:
-  //   High energy  (EXCITED, ANGRY, SURPRISED): 25-35ms — snappy, intense
-  //   Neutral      (HAPPY, LOVE, CONFUSED, THINKING, IDLE): 50-60ms — expressive, measured
-  //   Low energy   (SAD, SLEEPY, BORED): 75-85ms — heavy, lingering
-  emotionRegistry.add({EMOTION_IDLE,      "IDLE",      60,  55, LOOP_PINGPONG, true,  drawIdle});      // ~6.4s  neutral breathing
-  emotionRegistry.add({EMOTION_BLINK,     "BLINK",      1,   0, LOOP_RESTART,  false, drawBlink});
-  emotionRegistry.add({EMOTION_HAPPY,     "HAPPY",     50,  55, LOOP_PINGPONG, true,  drawHappy});     // ~5.4s  warm, measured
-  emotionRegistry.add({EMOTION_SLEEPY,    "SLEEPY",    59,  80, LOOP_RESTART,  false, drawSleepy});    // ~4.7s  doze + snap wake
-  emotionRegistry.add({EMOTION_EXCITED,   "EXCITED",   40,  28, LOOP_PINGPONG, true,  drawExcited});   // ~2.2s  rapid bounce energy
-  emotionRegistry.add({EMOTION_SAD,       "SAD",       56,  80, LOOP_RESTART,  true,  drawSad});       // ~4.5s  heavy, slow tears
-  emotionRegistry.add({EMOTION_ANGRY,     "ANGRY",     56,  30, LOOP_PINGPONG, true,  drawAngry});     // ~3.3s  fast intense shake
-  emotionRegistry.add({EMOTION_CONFUSED,  "CONFUSED",  44,  55, LOOP_PINGPONG, true,  drawConfused});  // ~4.7s  measured puzzlement
-  emotionRegistry.add({EMOTION_THINKING,  "THINKING",  44,  55, LOOP_PINGPONG, true,  drawThinking});  // ~4.7s  contemplative pace
-  emotionRegistry.add({EMOTION_LOVE,      "LOVE",      44,  55, LOOP_PINGPONG, true,  drawLove});      // ~4.7s  gentle pulse
-  emotionRegistry.add({EMOTION_SURPRISED, "SURPRISED", 44,  30, LOOP_RESTART,  true,  drawSurprised}); // ~1.3s  quick shock snap
-  emotionRegistry.add({EMOTION_DEAD,      "DEAD",      70,  65, LOOP_RESTART,  false, drawDead});      // ~4.6s  keep RESTART — no zombie bounce
-  emotionRegistry.add({EMOTION_BORED,     "BORED",     60,  80, LOOP_PINGPONG, true,  drawBored});     // ~9.5s  painfully slow
-  emotionRegistry.add({EMOTION_SHY,       "SHY",       50,  60, LOOP_RESTART,  true,  drawShy});       // ~3.0s  bashful recovery arc
-  emotionRegistry.add({EMOTION_NEEDY,     "NEEDY",     54,  65, LOOP_PINGPONG, true,  drawNeedy});     // ~3.5s  pleading solicitation
-  emotionRegistry.add({EMOTION_CONTENT,   "CONTENT",   60,  90, LOOP_PINGPONG, true,  drawContent});   // ~10.8s quiet purring satisfaction
-  emotionRegistry.add({EMOTION_PLAYFUL,   "PLAYFUL",   48,  40, LOOP_RESTART,  true,  drawPlayful});   // ~1.9s  mischievous wink-face
-  emotionRegistry.add({EMOTION_GRUMPY,    "GRUMPY",    56,  45, LOOP_PINGPONG, true,  drawGrumpy});    // ~5.0s  low flat disapproval
+// Notifies BLE subscribers when the emotion or attention stage changed since the last push.
+void publishBleState(unsigned long currentTime) {
+  uint8_t emotion = (uint8_t)emotionManager.getCurrentEmotion();
+  uint8_t stage = (uint8_t)personality.getAttentionStage();
+  if (!bleControl.stateChanged(emotion, stage)) return;
+  ControlState st;
+  st.emotion        = emotion;
+  st.attentionStage = stage;
+  st.batteryMv      = (uint16_t)(batteryManager.readVoltage() * 1000.0f);
+  st.uptimeMs       = currentTime;
+  bleControl.publishState(st);
+}
+
+// ===== COMMAND QUEUE =====
+
+static const char* const commandSourceNames[] = {"BLE", "WEB", "TOUCH"};
+
+// What one drain changed that commandTask must act on afterwards.
+struct CommandTaskState {
+  bool configDirty;  // a CMD_SET_CONFIG changed a field; save once after the drain
+};
+
+// drain() handler for everything except CMD_SET_EMOTION; returns the emotion asked for.
+static int handleCommand(const Command& cmd, void* ctx) {
+  CommandTaskState* state = (CommandTaskState*)ctx;
+  switch (cmd.type) {
+    case CMD_GESTURE:
+      return applyGesture((TouchGesture)cmd.arg, cmd.time);
+    case CMD_SET_CONFIG:
+      state->configDirty |= runtimeConfigSetField(cmd.arg, cmd.value);
+      return -1;
+    case CMD_SCRIPT_BEGIN:
+      scriptPlayer.begin();
+      return -1;
+    case CMD_SCRIPT_STEP:
+      scriptPlayer.append(cmd.arg, (uint16_t)cmd.value);
+      return -1;
+    default:
+      return -1;
+  }
 }
 
 // ===== POWER MANAGEMENT =====
@@ -147,40 +172,175 @@ void debugCycleTick(unsigned long currentTime) {
 }
 #endif
 
+// ===== SCHEDULED TASKS =====
+// Each task returns the millis() time it next needs to run; loop() runs them via the scheduler.
+
+// Personality, emotion state and BLE — the 50ms control cadence.
+unsigned long controlTask(unsigned long currentTime) {
+  clockService.tick(currentTime);
+  emotionManager.update(currentTime);
+  publishBleState(currentTime);
+
+#if DEBUG_MODE_ENABLED && DEBUG_MODE_CYCLE
+  debugCycleTick(currentTime);
+#elif !DEBUG_MODE_ENABLED
+  Personality::Decision d;
+  {
+    MetricTimer t(METRIC_PERSONALITY, emotionManager.getCurrentEmotion());
+    d = personality.update(currentTime, emotionManager.getCurrentEmotion());
+  }
+  if (d.shouldChange) {
+    emotionManager.setTargetEmotion(d.emotion);
+  }
+#endif
+
+  checkSleepConditions();
+  return currentTime + CONTROL_TICK_MS;
+}
+
+// Single consumer of commandQueue: runs queued gestures in order, then applies only the
+// last emotion requested this tick, so a burst of writes starts one transition.
+// An emotion requested after a script began cancels the rest of the script.
+unsigned long commandTask(unsigned long currentTime) {
+  CommandTaskState state = {false};
+  CommandDrain d = commandQueue.drain(handleCommand, &state);
+  if (d.emotion >= 0 && emotionRegistry.get((EmotionState)d.emotion) != nullptr) {
+    scriptPlayer.stop();
+    emotionManager.setTargetEmotion((EmotionState)d.emotion);
+    Serial.printf("[CMD] %s: emotion → %s (%d coalesced)\n",
+                  commandSourceNames[d.source],
+                  emotionRegistry.getName((EmotionState)d.emotion),
+                  d.coalesced);
+  }
+  if (state.configDirty) {
+    runtimeConfigSave();
+    Serial.printf("[CMD] Config saved\n");
+  }
+  int step = scriptPlayer.tick(currentTime);
+  if (step >= 0 && emotionRegistry.get((EmotionState)step) != nullptr) {
+    emotionManager.setTargetEmotion((EmotionState)step);
+  }
+  return currentTime + COMMAND_TICK_MS;
+}
+
+// Decodes queued touch edges; due again when a debounce, long press or tap window ends.
+// loop() wakes it as soon as the interrupt queues an edge.
+unsigned long inputTask(unsigned long currentTime) {
+  inputManager.handleTouchInteraction();
+  return inputManager.nextDeadline(currentTime);
+}
+
+// Draws the next transition frame or animation frame; due again at the emotion's own frameDelay.
+unsigned long renderTask(unsigned long currentTime) {
+  if (emotionManager.isTransitionActive()) {
+    TransitionStep step = transitionPlayer.update(
+        emotionManager.getTransitionFrame(),
+        emotionManager.getCurrentEmotion(),
+        emotionManager.getTargetEmotion(),
+        currentTime);
+    if (step == TS_COMPLETE) {
+      emotionManager.completeTransition();
+      return currentTime;
+    }
+    if (step == TS_ADVANCE) emotionManager.advanceTransition();
+    return transitionPlayer.nextDeadline();
+  }
+
+  EmotionState current = emotionManager.getCurrentEmotion();
+  animationManager.tick(current, displayManager);
+  unsigned long due = animationManager.nextDeadline(current);
+  unsigned long earliest = currentTime + MIN_FRAME_INTERVAL_MS;
+  return ((long)(due - earliest) < 0) ? earliest : due;
+}
+
+// Periodic battery / heap / frame-rate report.
+unsigned long reportTask(unsigned long currentTime) {
+  EmotionState current = emotionManager.getCurrentEmotion();
+  float voltage = batteryManager.readVoltage();
+  Serial.printf("Battery: %.2fV | Emotion: %s | Uptime: %lus\n",
+                voltage,
+                emotionRegistry.getName(current),
+                (currentTime - bootTime) / 1000);
+  Serial.printf("[WEB] heap: %u | clients: %d\n",
+                ESP.getFreeHeap(),
+                WiFi.softAPgetStationNum());
+  const FrameStats& fs = animationManager.getFrameStats(current);
+  Serial.printf("[ANIM] %s: %lu frames | %lu missed | max late %ums\n",
+                emotionRegistry.getName(current),
+                (unsigned long)fs.frames,
+                (unsigned long)fs.missed,
+                fs.maxLateMs);
+  Serial.printf("[DISPLAY] flushed %lu B | skipped %lu identical frames\n",
+                (unsigned long)displayManager.getFlushedBytes(),
+                (unsigned long)displayManager.getSkippedFlushes());
+  Serial.printf("[DISPLAY] handed off %lu | dropped %lu | bus busy %lums (max send %luus)\n",
+                (unsigned long)displayManager.getHandedOffFrames(),
+                (unsigned long)displayManager.getDroppedFrames(),
+                (unsigned long)(displayManager.getBusBusyUs() / 1000),
+                (unsigned long)displayManager.getMaxSendUs());
+  Serial.printf("[CMD] posted %lu | dropped %lu | coalesced %lu\n",
+                (unsigned long)commandQueue.getPosted(),
+                (unsigned long)commandQueue.getDropped(),
+                (unsigned long)commandQueue.getCoalesced());
+  return currentTime + REPORT_INTERVAL_MS;
+}
+
+// Per-emotion draw/flush/personality/HTTP timing histograms.
+unsigned long metricsTask(unsigned long currentTime) {
+  metrics.dump();
+  return currentTime + METRICS_DUMP_INTERVAL_MS;
+}
+
 // ===== SETUP =====
 
 // Initializes all hardware and software modules in dependency order; runs once at boot.
 void setup() {
   Serial.begin(115200);
-  delay(2000);
+  // Give a USB-CDC host a moment to attach, but never hold the face back for it
+  while (!Serial && millis() < BOOT_SERIAL_WAIT_MS) delay(10);
+  bootProfile.mark("serial", micros());
 
   Serial.println("\n\n>>> ESP32 BOOT SUCCESSFUL <<<");
-  Serial.flush();
-  delay(100);
   Serial.println("=== SANGI Robot Initializing ===");
-  Serial.flush();
 
   bootTime = millis();
-  randomSeed(analogRead(0) + millis());
+  personality.seed(esp_random());  // hardware RNG; drift stays reproducible on host via seed()
 
   runtimeConfigLoad();
   registerEmotions();
+  bootProfile.mark("config", micros());
 
   if (!displayManager.init()) {
     Serial.println("FATAL: Display init failed");
     for (;;) { delay(1000); }
   }
+  bootProfile.mark("display", micros());
+
+#if ENABLE_FRAME_CACHE
+  int baked = frameCache.begin();
+  animationManager.setFrameSource([](EmotionState e, int frame, uint8_t* fb, bool continuing) {
+    return frameCache.render(e, frame, fb, continuing);
+  });
+  Serial.printf("[CACHE] %d emotions baked, %u bytes flash\n", baked,
+                (unsigned)frameCache.totalFlashBytes());
+  bootProfile.mark("cache", micros());
+#endif
 
   emotionManager.init(bootTime);
   emotionManager.setOnTransitionComplete(onTransitionComplete);
   emotionManager.setOnEmotionChange(onEmotionChange);
+  transitionPlayer.setDrawFn([](int frame, EmotionState current, EmotionState target) {
+    return displayManager.performTransitionFrame(frame, current, target);
+  });
 
   inputManager.init();
   inputManager.updateLastInteraction(bootTime);
   inputManager.setOnGesture(onGesture);
   batteryManager.init();
   beepManager.init();
-  bleControl.init(onBleEmotion);
+  bootProfile.mark("io", micros());
+  bleControl.init(onBleWrite);
+  bootProfile.mark("ble", micros());
 
   webServerManager.setEmotionManager(&emotionManager);
   webServerManager.setBatteryManager(&batteryManager);
@@ -188,30 +348,31 @@ void setup() {
   webServerManager.setRuntimeConfig(&runtimeConfig);
   webServerManager.setPersonality(&personality);
   webServerManager.setOnEmotionSet([](EmotionState e) {
-    emotionManager.setTargetEmotion(e);
-    Serial.printf("[WEB] emotion → %s\n", emotionRegistry.getName(e));
+    commandQueue.post(CMD_SET_EMOTION, CMD_SRC_WEB, (uint8_t)e, millis());
   });
   webServerManager.setOnGesture([](TouchGesture g) {
-    onGesture(g, millis());
+    commandQueue.post(CMD_GESTURE, CMD_SRC_WEB, (uint8_t)g, millis());
+  });
+  webServerManager.setFrameSource([]() -> const uint8_t* {
+    return displayManager.frameBuffer();
   });
   webServerManager.init();
+  bootProfile.mark("wifi", micros());
 
-#ifndef NATIVE_BUILD
-  // Wire real-time hour provider — falls back to millis() until NTP syncs.
-  // Set unconditionally so it works even when NTP connects later via the web UI.
-  personality.setTimeProvider([]() -> int {
-    if (webServerManager.isNtpSynced()) {
-      struct tm ti;
-      if (getLocalTime(&ti, 100)) return ti.tm_hour;
-    }
-    return (int)((millis() / HOUR_IN_MILLIS) % 24);
-  });
-#endif
+  // Hour of day for personality — cached by clockService (refreshed from controlTask),
+  // uptime-based until NTP sets the wall clock, then re-read as soon as it syncs.
+  clockService.setSource(systemLocalHour);
+  clockService.tick(millis());
+  personality.setTimeProvider([]() -> int { return clockService.hour(); });
+  webServerManager.setOnTimeSynced([]() { clockService.requestRefresh(); });
 
   personality.init(bootTime);
+  bootProfile.mark("personality", micros());
+  uint32_t faceAtUs = micros();  // first boot-screen frame goes out now
 
 #if !DEBUG_MODE_ENABLED
   displayManager.showBootScreen();
+  bootProfile.mark("bootscreen", micros());
 #else
   Serial.println("Skipping boot screen in DEBUG MODE");
 #endif
@@ -228,6 +389,23 @@ void setup() {
 #endif
 #endif
 
+  // Boot screen is done with the panel — from here on frames are sent by the display task
+  displayManager.startFlushTask();
+
+  unsigned long now = millis();
+  scheduler.add("control", controlTask, now);
+  inputTaskId = scheduler.add("input", inputTask, now);
+  scheduler.add("commands", commandTask, now);
+  renderTaskId = scheduler.add("render", renderTask, now);
+  scheduler.add("report", reportTask, now + REPORT_INTERVAL_MS);
+  scheduler.add("metrics", metricsTask, now + METRICS_DUMP_INTERVAL_MS);
+
+  bootProfile.mark("tasks", micros());
+
+  char report[256];
+  bootProfile.format(report, sizeof(report));
+  Serial.printf("[BOOT] %s\n", report);
+  Serial.printf("[BOOT] face animating at %lu ms\n", (unsigned long)(faceAtUs / 1000));
   Serial.printf("=== SANGI Ready! (%d emotions registered) ===\n",
                 emotionRegistry.count());
 }
@@ -235,54 +413,14 @@ void setup() {
 // ===== MAIN LOOP =====
 
 // Web server is polled on every loop() iteration (no delay) for fast HTTP responses.
-// All other modules are throttled to a ~50ms tick via millis() comparison.
+// Everything else runs from the scheduler exactly when its own deadline is due —
+// animations at their registered frameDelay, control logic every CONTROL_TICK_MS,
+// touch decoding whenever the edge interrupt has queued something.
 void loop() {
   // Poll web server at full speed — HTTP state machine requires rapid handleClient() calls.
   webServerManager.update();
 
-  unsigned long currentTime = millis();
-  static unsigned long lastTick = 0;
-  if (currentTime - lastTick < 50) return;
-  lastTick = currentTime;
-
-  beepManager.update();
-  emotionManager.update(currentTime);
-  bleControl.updateCurrentEmotion((uint8_t)emotionManager.getCurrentEmotion());
+  if (inputManager.hasPendingEdges()) scheduler.wake(inputTaskId, millis());
 
-#if DEBUG_MODE_ENABLED && DEBUG_MODE_CYCLE
-  debugCycleTick(currentTime);
-#elif !DEBUG_MODE_ENABLED
-  Personality::Decision d = personality.update(currentTime, emotionManager.getCurrentEmotion());
-  if (d.shouldChange) {
-    emotionManager.setTargetEmotion(d.emotion);
-  }
-#endif
-
-  inputManager.handleTouchInteraction();
-
-  if (emotionManager.isTransitionActive()) {
-    TransitionResult r = displayManager.performTransitionFrame(
-        emotionManager.getTransitionFrame(),
-        emotionManager.getCurrentEmotion(),
-        emotionManager.getTargetEmotion());
-    if (r == TR_COMPLETE) emotionManager.completeTransition();
-    else emotionManager.advanceTransition();
-  } else {
-    animationManager.tick(emotionManager.getCurrentEmotion(), displayManager);
-  }
-
-  checkSleepConditions();
-
-  static unsigned long lastDebug = 0;
-  if (currentTime - lastDebug > 10000) {
-    float voltage = batteryManager.readVoltage();
-    Serial.printf("Battery: %.2fV | Emotion: %s | Uptime: %lus\n",
-                  voltage,
-                  emotionRegistry.getName(emotionManager.getCurrentEmotion()),
-                  (currentTime - bootTime) / 1000);
-    Serial.printf("[WEB] heap: %u | clients: %d\n",
-                  ESP.getFreeHeap(),
-                  WiFi.softAPgetStationNum());
-    lastDebug = currentTime;
-  }
+  scheduler.runDue(millis());
 }
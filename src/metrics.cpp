@@ -0,0 +1,151 @@
+#include "metrics.h"
+
+Metrics metrics;
+
+static const char* const SECTION_NAMES[METRIC_SECTION_COUNT] = {
+  "draw", "flush", "frame", "personality", "http"
+};
+
+// Starts with every histogram empty.
+Metrics::Metrics() { reset(); }
+
+// Maps a duration to its bucket: 8us linear steps below 32us, then two buckets per octave.
+int Metrics::bucketFor(uint32_t us) {
+  uint32_t u = us >> 3;
+  if (u < 4) return (int)u;
+  int octave = 31 - __builtin_clz(u);
+  int b = 4 + (octave - 2) * 2 + (int)((u >> (octave - 1)) & 1);
+  return b < BUCKETS ? b : BUCKETS - 1;
+}
+
+// Largest duration that still lands in the bucket (the last bucket is open-ended).
+uint32_t Metrics::bucketUpperUs(int bucket) {
+  if (bucket >= BUCKETS - 1) return 0xFFFFFFFFu;
+  if (bucket < 4) return ((uint32_t)(bucket + 1) << 3) - 1;
+  int octave = 2 + (bucket - 4) / 2;
+  uint32_t lower = (uint32_t)(2 + ((bucket - 4) & 1)) << (octave - 1);
+  return ((lower + (1u << (octave - 1))) << 3) - 1;
+}
+
+// Adds one sample; frame samples over the emotion's frameDelay also count as over budget.
+void Metrics::record(MetricSection section, EmotionState emotion, uint32_t us) {
+  if ((int)section < 0 || section >= METRIC_SECTION_COUNT) return;
+  if ((int)emotion < 0 || (int)emotion >= EmotionRegistry::MAX_EMOTIONS) return;
+  Cell& c = cells_[section][emotion];
+  int b = bucketFor(us);
+  if (c.buckets[b] == 0xFFFF) {
+    for (int i = 0; i < BUCKETS; i++) c.buckets[i] >>= 1;
+    c.count >>= 1;
+    c.sumUs >>= 1;
+  }
+  c.buckets[b]++;
+  c.count++;
+  c.sumUs += us;
+  if (us < c.minUs) c.minUs = us;
+  if (us > c.maxUs) c.maxUs = us;
+
+  if (section == METRIC_FRAME) {
+    const EmotionDef* def = emotionRegistry.get(emotion);
+    if (def && def->frameDelay > 0 && us > def->frameDelay * 1000UL) overBudget_[emotion]++;
+  }
+}
+
+// Computes min/avg/p99/max for one cell; all zero when it has no samples.
+MetricSummary Metrics::summary(MetricSection section, EmotionState emotion) const {
+  MetricSummary s = {0, 0, 0, 0, 0};
+  if ((int)section < 0 || section >= METRIC_SECTION_COUNT) return s;
+  if ((int)emotion < 0 || (int)emotion >= EmotionRegistry::MAX_EMOTIONS) return s;
+  const Cell& c = cells_[section][emotion];
+  if (c.count == 0) return s;
+
+  uint32_t total = 0;
+  for (int i = 0; i < BUCKETS; i++) total += c.buckets[i];
+  uint32_t target = total - total / 100;  // samples at or below the 99th percentile
+  uint32_t seen = 0;
+  int b = 0;
+  for (; b < BUCKETS - 1; b++) {
+    seen += c.buckets[b];
+    if (seen >= target) break;
+  }
+  uint32_t upper = bucketUpperUs(b);
+
+  s.count = c.count;
+  s.minUs = c.minUs;
+  s.maxUs = c.maxUs;
+  s.avgUs = (uint32_t)(c.sumUs / c.count);
+  s.p99Us = upper < c.maxUs ? upper : c.maxUs;
+  return s;
+}
+
+// Returns how many frames of the emotion overran its frameDelay.
+uint32_t Metrics::overBudget(EmotionState emotion) const {
+  if ((int)emotion < 0 || (int)emotion >= EmotionRegistry::MAX_EMOTIONS) return 0;
+  return overBudget_[emotion];
+}
+
+// Empties every histogram and over-budget counter.
+void Metrics::reset() {
+  for (int s = 0; s < METRIC_SECTION_COUNT; s++) {
+    for (int e = 0; e < EmotionRegistry::MAX_EMOTIONS; e++) {
+      Cell& c = cells_[s][e];
+      memset(c.buckets, 0, sizeof(c.buckets));
+      c.count = 0;
+      c.minUs = 0xFFFFFFFFu;
+      c.maxUs = 0;
+      c.sumUs = 0;
+    }
+  }
+  memset(overBudget_, 0, sizeof(overBudget_));
+}
+
+// {"name":"HAPPY","budgetUs":55000,"over":3,"draw":[count,min,avg,p99,max],...}
+size_t Metrics::writeEmotionJson(EmotionState emotion, char* buf, size_t cap) const {
+  bool any = false;
+  for (int s = 0; s < METRIC_SECTION_COUNT; s++) {
+    if (summary((MetricSection)s, emotion).count) any = true;
+  }
+  if (!any || cap == 0) return 0;
+
+  const EmotionDef* def = emotionRegistry.get(emotion);
+  size_t n = 0;
+  int w = snprintf(buf, cap, "{\"name\":\"%s\",\"budgetUs\":%lu,\"over\":%lu",
+                   emotionRegistry.getName(emotion),
+                   def ? def->frameDelay * 1000UL : 0UL,
+                   (unsigned long)overBudget(emotion));
+  if (w < 0 || (size_t)w >= cap) return 0;
+  n = (size_t)w;
+  for (int s = 0; s < METRIC_SECTION_COUNT; s++) {
+    MetricSummary m = summary((MetricSection)s, emotion);
+    w = snprintf(buf + n, cap - n, ",\"%s\":[%lu,%lu,%lu,%lu,%lu]", SECTION_NAMES[s],
+                 (unsigned long)m.count, (unsigned long)m.minUs, (unsigned long)m.avgUs,
+                 (unsigned long)m.p99Us, (unsigned long)m.maxUs);
+    if (w < 0 || (size_t)w >= cap - n) return 0;
+    n += (size_t)w;
+  }
+  if (n + 2 > cap) return 0;
+  buf[n++] = '}';
+  buf[n] = '\0';
+  return n;
+}
+
+// One [METRICS] line per emotion: avg/p99/max per section in us, plus over-budget frames.
+void Metrics::dump() const {
+  for (int e = 0; e < EmotionRegistry::MAX_EMOTIONS; e++) {
+    MetricSummary frame = summary(METRIC_FRAME, (EmotionState)e);
+    MetricSummary draw = summary(METRIC_DRAW, (EmotionState)e);
+    MetricSummary flush = summary(METRIC_FLUSH, (EmotionState)e);
+    MetricSummary http = summary(METRIC_HTTP, (EmotionState)e);
+    if (!frame.count && !http.count) continue;
+    Serial.printf("[METRICS] %-9s frames %lu over %lu | draw %lu/%lu/%lu | flush %lu/%lu/%lu | http %lu/%lu/%lu us\n",
+                  emotionRegistry.getName((EmotionState)e),
+                  (unsigned long)frame.count, (unsigned long)overBudget((EmotionState)e),
+                  (unsigned long)draw.avgUs, (unsigned long)draw.p99Us, (unsigned long)draw.maxUs,
+                  (unsigned long)flush.avgUs, (unsigned long)flush.p99Us, (unsigned long)flush.maxUs,
+                  (unsigned long)http.avgUs, (unsigned long)http.p99Us, (unsigned long)http.maxUs);
+  }
+}
+
+// Records the scope's duration.
+MetricTimer::~MetricTimer() {
+  metrics.record(section_, emotion_, elapsedUs());
+}
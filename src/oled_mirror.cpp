@@ -0,0 +1,56 @@
+#include "oled_mirror.h"
+#include "control_proto.h"
+#include <string.h>
+
+// Starts with a blank shadow and a pending keyframe.
+MirrorEncoder::MirrorEncoder() : seq_(0) { reset(); }
+
+// A keyframe is a delta against blank, so the shadow is simply cleared.
+void MirrorEncoder::reset() {
+  memset(shadow_, 0, sizeof(shadow_));
+  key_ = true;
+}
+
+// Per page: skip identical pages with memcmp, delta-code the rest and copy them into the shadow.
+size_t MirrorEncoder::encode(const uint8_t* frame, uint8_t* out, size_t cap) {
+  if (cap < MIRROR_MSG_MAX) return 0;
+  size_t n = MIRROR_HEAD_BYTES;
+  uint8_t mask = 0;
+  for (int page = 0; page < MIRROR_PAGES; page++) {
+    const uint8_t* cur = frame + page * MIRROR_PAGE_BYTES;
+    uint8_t* prev = shadow_ + page * MIRROR_PAGE_BYTES;
+    if (memcmp(cur, prev, MIRROR_PAGE_BYTES) == 0) continue;
+    size_t deltaLen = 0;
+    encodeFrameDelta(cur, prev, MIRROR_PAGE_BYTES, out + n + 1, cap - n - 1, deltaLen);
+    out[n] = (uint8_t)deltaLen;
+    n += 1 + deltaLen;
+    memcpy(prev, cur, MIRROR_PAGE_BYTES);
+    mask |= (uint8_t)(1 << page);
+  }
+  if (!mask && !key_) return 0;
+
+  seq_++;
+  out[0] = CTRL_FRAME;
+  out[1] = (uint8_t)seq_;
+  out[2] = (uint8_t)(seq_ >> 8);
+  out[3] = key_ ? MIRROR_FLAG_KEY : 0;
+  out[4] = mask;
+  key_ = false;
+  return n;
+}
+
+// Walks the page mask, bounds-checking every length byte before applying its delta.
+bool applyMirrorMessage(const uint8_t* msg, size_t len, uint8_t* buf) {
+  if (len < MIRROR_HEAD_BYTES || msg[0] != CTRL_FRAME) return false;
+  if (msg[3] & MIRROR_FLAG_KEY) memset(buf, 0, MIRROR_FRAME_BYTES);
+  size_t pos = MIRROR_HEAD_BYTES;
+  for (int page = 0; page < MIRROR_PAGES; page++) {
+    if (!(msg[4] & (1 << page))) continue;
+    if (pos >= len) return false;
+    size_t n = msg[pos++];
+    if (pos + n > len) return false;
+    if (!applyFrameDelta(msg + pos, n, buf + page * MIRROR_PAGE_BYTES, MIRROR_PAGE_BYTES)) return false;
+    pos += n;
+  }
+  return pos == len;
+}
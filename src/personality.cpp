@@ -12,6 +12,9 @@ Personality::Personality()
     nextStageThreshold_(runtimeConfig.attentionStage0Ms),
     attentionStage_(0),
     timeProvider_(nullptr),
+    rng_(1),
+    driftGeneration_(0),
+    markovContext_(-1),
     warmthWindowStart_(0),
     touchCountRecent_(0),
     warmthActive_(false),
@@ -45,7 +48,7 @@ void Personality::init(unsigned long currentTime) {
 unsigned long Personality::jitter(unsigned long base) {
   unsigned long jitterAmt = base * runtimeConfig.jitterPercent / 100;
   if (jitterAmt == 0) return base;
-  long delta = (long)random(0, (long)(jitterAmt * 2 + 1)) - (long)jitterAmt;
+  long delta = (long)rng_.below((uint32_t)(jitterAmt * 2 + 1)) - (long)jitterAmt;
   long result = (long)base + delta;
   if (result < (long)(base / 2)) result = (long)(base / 2);
   return (unsigned long)result;
@@ -91,77 +94,94 @@ MoodCluster Personality::clusterOf(EmotionState e) {
   }
 }
 
+static_assert(DRIFT_EMOTIONS == EMOTION_BLINK + 1, "one drift weight per EmotionState");
+static_assert(DRIFT_POSITIVE + CLUSTER_NEGATIVE == DRIFT_NEGATIVE, "cluster rows follow MoodCluster order");
+static_assert((int)MARKOV_BIAS_EVENING == (int)DRIFT_EVENING, "Markov hour bands follow DriftTable order");
+
+static const uint8_t BAND_OF_HOUR[24] = {
+  DRIFT_NIGHT, DRIFT_NIGHT, DRIFT_NIGHT, DRIFT_NIGHT, DRIFT_NIGHT, DRIFT_NIGHT,
+  DRIFT_MORNING, DRIFT_MORNING, DRIFT_MORNING, DRIFT_MORNING, DRIFT_MORNING, DRIFT_MORNING,
+  DRIFT_AFTERNOON, DRIFT_AFTERNOON, DRIFT_AFTERNOON, DRIFT_AFTERNOON, DRIFT_AFTERNOON, DRIFT_AFTERNOON,
+  DRIFT_EVENING, DRIFT_EVENING, DRIFT_EVENING, DRIFT_EVENING, DRIFT_EVENING, DRIFT_EVENING
+};
+
+static const uint8_t MARKOV_ROW_EMPTY = 0xFF;  // fallback outcome of an all-zero matrix row
+
+// Recompiles every drift table if runtimeConfig was loaded or saved since the last build.
+void Personality::refreshDriftTables() {
+  uint32_t gen = runtimeConfigGeneration();
+  if (gen == driftGeneration_) return;
+  for (int t = 0; t < DRIFT_TABLE_COUNT; t++) {
+    driftTables_[t].build(runtimeConfig.driftWeights[t], DRIFT_EMOTIONS, EMOTION_IDLE);
+  }
+  driftGeneration_ = gen;
+  markovContext_ = -1;
+}
+
+// One constant-time draw from the given drift distribution.
+EmotionState Personality::sampleDrift(DriftTable table) {
+  refreshDriftTables();
+  return (EmotionState)driftTables_[table].sample(rng_);
+}
+
 // Pick a random emotion from a specific cluster.
 EmotionState Personality::clusterDrift(MoodCluster cluster) {
-  switch (cluster) {
-    case CLUSTER_POSITIVE: {
-      static const EmotionState pool[] = {EMOTION_HAPPY, EMOTION_EXCITED, EMOTION_LOVE, EMOTION_PLAYFUL, EMOTION_CONTENT};
-      return pool[random(0, 5)];
-    }
-    case CLUSTER_NEGATIVE: {
-      static const EmotionState pool[] = {EMOTION_SAD, EMOTION_BORED, EMOTION_NEEDY, EMOTION_SLEEPY};
-      return pool[random(0, 4)];
-    }
-    default: {
-      static const EmotionState pool[] = {EMOTION_IDLE, EMOTION_THINKING, EMOTION_CONFUSED, EMOTION_SURPRISED};
-      return pool[random(0, 4)];
-    }
-  }
+  return sampleDrift((DriftTable)(DRIFT_POSITIVE + cluster));
 }
 
 // Hour-of-day weighted random emotion for normal (unbiased) drift.
 EmotionState Personality::moodDrift(unsigned long currentTime) {
   int hour = getTimeOfDayHour(currentTime);
-  int r = (int)random(0, 100);
-
-  if (hour < 6) {
-    // Night: SLEEPY 60%, IDLE 30%, THINKING 10%
-    if (r < 60) return EMOTION_SLEEPY;
-    if (r < 90) return EMOTION_IDLE;
-    return EMOTION_THINKING;
-  } else if (hour < 12) {
-    // Morning: HAPPY 30%, EXCITED 20%, PLAYFUL 15%, IDLE 20%, THINKING 10%, CONTENT 5%
-    if (r < 30) return EMOTION_HAPPY;
-    if (r < 50) return EMOTION_EXCITED;
-    if (r < 65) return EMOTION_PLAYFUL;
-    if (r < 85) return EMOTION_IDLE;
-    if (r < 95) return EMOTION_THINKING;
-    return EMOTION_CONTENT;
-  } else if (hour < 18) {
-    // Afternoon: THINKING 25%, IDLE 25%, HAPPY 15%, CONTENT 10%, CONFUSED 10%, SURPRISED 10%, PLAYFUL 5%
-    if (r < 25) return EMOTION_THINKING;
-    if (r < 50) return EMOTION_IDLE;
-    if (r < 65) return EMOTION_HAPPY;
-    if (r < 75) return EMOTION_CONTENT;
-    if (r < 85) return EMOTION_CONFUSED;
-    if (r < 95) return EMOTION_SURPRISED;
-    return EMOTION_PLAYFUL;
-  } else {
-    // Evening: IDLE 25%, SLEEPY 30%, SAD 10%, LOVE 15%, CONTENT 10%, THINKING 10%
-    if (r < 25) return EMOTION_IDLE;
-    if (r < 55) return EMOTION_SLEEPY;
-    if (r < 65) return EMOTION_SAD;
-    if (r < 80) return EMOTION_LOVE;
-    if (r < 90) return EMOTION_CONTENT;
-    return EMOTION_THINKING;
-  }
+  return sampleDrift((DriftTable)BAND_OF_HOUR[(unsigned)hour % 24]);
 }
 
 // Positive drift pool for post-interaction glow (any touch).
 EmotionState Personality::moodDriftGlow() {
-  static const EmotionState pool[] = {EMOTION_HAPPY, EMOTION_EXCITED, EMOTION_LOVE, EMOTION_SURPRISED, EMOTION_CONTENT, EMOTION_PLAYFUL};
-  return pool[random(0, 6)];
+  return sampleDrift(DRIFT_GLOW);
 }
 
 // Positive drift pool for sustained warmth arc (frequent interaction).
 EmotionState Personality::moodDriftWarmed() {
-  static const EmotionState pool[] = {EMOTION_HAPPY, EMOTION_EXCITED, EMOTION_LOVE, EMOTION_CONTENT};
-  return pool[random(0, 4)];
+  return sampleDrift(DRIFT_WARMED);
+}
+
+// Compiles every matrix row × hour-band bias × (warm ? warm bias : 1), rescaled so each
+// row's largest weight is 255; rounding up keeps every non-zero weight reachable.
+void Personality::buildMarkovRows(int band, bool warm) {
+  const uint8_t* bandBias = runtimeConfig.markovBias[band];
+  const uint8_t* warmBias = runtimeConfig.markovBias[MARKOV_BIAS_WARM];
+  for (int from = 0; from < DRIFT_EMOTIONS; from++) {
+    uint32_t eff[DRIFT_EMOTIONS];
+    uint32_t peak = 0;
+    for (int to = 0; to < DRIFT_EMOTIONS; to++) {
+      eff[to] = (uint32_t)runtimeConfig.markovMatrix[from][to] * bandBias[to] *
+                (warm ? warmBias[to] : MARKOV_BIAS_UNITY);
+      if (eff[to] > peak) peak = eff[to];
+    }
+    uint8_t weights[DRIFT_EMOTIONS];
+    for (int to = 0; to < DRIFT_EMOTIONS; to++) {
+      weights[to] = peak ? (uint8_t)(((uint64_t)eff[to] * 255 + peak - 1) / peak) : 0;  // round up
+    }
+    markovRows_[from].build(weights, DRIFT_EMOTIONS, MARKOV_ROW_EMPTY);
+  }
+  markovContext_ = band * 2 + (warm ? 1 : 0);
+}
+
+// One draw from the current emotion's transition row; falls back to time-of-day drift
+// for an emotion outside the matrix or a row with no weights.
+EmotionState Personality::markovDrift(unsigned long currentTime, EmotionState currentEmotion,
+                                      bool warm) {
+  refreshDriftTables();
+  int band = BAND_OF_HOUR[(unsigned)getTimeOfDayHour(currentTime) % 24];
+  if (markovContext_ != band * 2 + (warm ? 1 : 0)) buildMarkovRows(band, warm);
+  if ((unsigned)currentEmotion >= (unsigned)DRIFT_EMOTIONS) return moodDrift(currentTime);
+  uint8_t next = markovRows_[currentEmotion].sample(rng_);
+  return next == MARKOV_ROW_EMPTY ? moodDrift(currentTime) : (EmotionState)next;
 }
 
 // Mood gravity: 65% chance to stay in current cluster, 35% normal time-of-day drift.
 EmotionState Personality::moodDriftGravity(unsigned long currentTime, EmotionState currentEmotion) {
-  int r = (int)random(0, 100);
+  int r = (int)rng_.below(100);
   if (r < 65) {
     MoodCluster cluster = clusterOf(currentEmotion);
     return clusterDrift(cluster);
@@ -171,6 +191,7 @@ EmotionState Personality::moodDriftGravity(unsigned long currentTime, EmotionSta
 
 // Picks a random driftable emotion from the variety pool, excluding one emotion.
 // Used by habituation to force variety after consecutive same-emotion drifts.
+// One draw over the pool minus the excluded slot, instead of retrying on a hit.
 EmotionState Personality::randomEmotionExcluding(EmotionState excluded) {
   static const EmotionState pool[] = {
     EMOTION_HAPPY, EMOTION_EXCITED, EMOTION_THINKING, EMOTION_IDLE,
@@ -178,8 +199,12 @@ EmotionState Personality::randomEmotionExcluding(EmotionState excluded) {
     EMOTION_CONTENT, EMOTION_PLAYFUL
   };
   static const int poolSize = 10;
-  int idx;
-  do { idx = (int)random(0, poolSize); } while (pool[idx] == excluded);
+  int skip = -1;
+  for (int i = 0; i < poolSize; i++) {
+    if (pool[i] == excluded) { skip = i; break; }
+  }
+  int idx = (int)rng_.below(skip < 0 ? poolSize : poolSize - 1);
+  if (skip >= 0 && idx >= skip) idx++;
   return pool[idx];
 }
 
@@ -216,11 +241,10 @@ Personality::Decision Personality::attentionArc(unsigned long currentTime,
 }
 
 // Night cycle (2-4 AM): restless light sleep with random wake moments.
-// Only activates when NTP time provider is set and returns hours 2 or 3.
+// Only activates when NTP time provider is set and returns hours 2 or 3 (hour < 0 = no provider).
 Personality::Decision Personality::nightCycle(unsigned long currentTime,
-                                                EmotionState current) {
-  if (!timeProvider_) return {current, false};
-  int hour = timeProvider_();
+                                                EmotionState current, int hour) {
+  if (hour < 0) return {current, false};
   bool inWindow = (hour == 2 || hour == 3);
 
   if (inWindow && !nightCycleActive_) {
@@ -237,7 +261,7 @@ Personality::Decision Personality::nightCycle(unsigned long currentTime,
   if (currentTime - lastDriftTime_ < jitter(45000)) return {current, false};
   lastDriftTime_ = currentTime;
 
-  int r = (int)random(0, 100);
+  int r = (int)rng_.below(100);
   EmotionState target;
   if (r < 70) {
     target = EMOTION_SLEEPY;
@@ -255,15 +279,16 @@ Personality::Decision Personality::nightCycle(unsigned long currentTime,
 
 // Returns true MICRO_EXPRESSION_CHANCE% of the time.
 bool Personality::shouldMicroExpress() {
-  return (int)random(0, 100) < runtimeConfig.microExpressionChance;
+  return rng_.chance(runtimeConfig.microExpressionChance);
 }
 
 // Evaluates all personality subsystems and returns the next emotion Decision.
 Personality::Decision Personality::update(unsigned long currentTime,
                                            EmotionState currentEmotion) {
   // 0. Night cycle (highest priority when active, overrides normal drift)
-  if (nightCycleActive_ || (timeProvider_ && (timeProvider_() == 2 || timeProvider_() == 3))) {
-    Decision nc = nightCycle(currentTime, currentEmotion);
+  int hour = timeProvider_ ? timeProvider_() : -1;  // read once per tick
+  if (nightCycleActive_ || hour == 2 || hour == 3) {
+    Decision nc = nightCycle(currentTime, currentEmotion, hour);
     if (nc.shouldChange) return nc;
     if (nightCycleActive_) return {currentEmotion, false};  // suppress normal drift during night
   }
@@ -284,20 +309,24 @@ Personality::Decision Personality::update(unsigned long currentTime,
 
     // Select drift emotion based on current bias
     EmotionState drifted;
-    if (glowCycles_ > 0) {
-      glowCycles_--;
+    bool glow = glowCycles_ > 0;
+    bool warm = !glow && warmthActive_;
+    if (runtimeConfig.markovDrift) {
+      // Transition matrix; glow and warmth become a column multiplier instead of a pool
+      drifted = markovDrift(currentTime, currentEmotion, glow || warm);
+    } else if (glow) {
       drifted = moodDriftGlow();
-    } else if (warmthActive_) {
+    } else if (warm) {
       drifted = moodDriftWarmed();
-      warmthDriftCyclesLeft_--;
-      if (warmthDriftCyclesLeft_ <= 0) {
-        warmthActive_ = false;
-        Serial.println("[Personality] Warmth arc ended");
-      }
     } else {
       // Mood gravity: bias toward current cluster
       drifted = moodDriftGravity(currentTime, currentEmotion);
     }
+    if (glow) glowCycles_--;
+    if (warm && --warmthDriftCyclesLeft_ <= 0) {
+      warmthActive_ = false;
+      Serial.println("[Personality] Warmth arc ended");
+    }
 
     // Habituation: track consecutive same-emotion drift selections
     if (drifted == lastDriftEmotion_) {
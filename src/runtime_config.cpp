@@ -1,4 +1,7 @@
 #include "runtime_config.h"
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
 
 // Initialized with compile-time defaults so personality works even before runtimeConfigLoad() is called.
 RuntimeConfig runtimeConfig = {
@@ -10,6 +13,10 @@ RuntimeConfig runtimeConfig = {
   MOOD_DRIFT_INTERVAL_MS,
   MICRO_EXPRESSION_CHANCE,
   JITTER_PERCENT,
+  DRIFT_WEIGHTS_DEFAULT,
+  MARKOV_DRIFT_ENABLED,
+  MARKOV_MATRIX_DEFAULT,
+  MARKOV_BIAS_DEFAULT,
   LONG_PRESS_MS,
   DOUBLE_TAP_WINDOW_MS,
   ENABLE_EMOTION_BEEP,
@@ -18,11 +25,153 @@ RuntimeConfig runtimeConfig = {
   WIFI_STA_PASSWORD   // staPassword
 };
 
+// /api/config names, in ConfigField order.
+static const char* const FIELD_NAMES[CFG_FIELD_COUNT] = {
+  "attentionStage0Ms", "attentionStage1Ms", "attentionStage2Ms", "attentionStage3Ms",
+  "attentionStage4Ms", "moodDriftIntervalMs", "microExpressionChance", "jitterPercent",
+  "longPressMs", "doubleTapWindowMs", "enableEmotionBeep", "speakerVolume", "markovDrift"
+};
+
+// Looks the id up in FIELD_NAMES.
+const char* runtimeConfigFieldName(uint8_t field) {
+  return field < CFG_FIELD_COUNT ? FIELD_NAMES[field] : nullptr;
+}
+
+// Linear scan — a dozen short names.
+int runtimeConfigFieldByName(const char* name, size_t len) {
+  for (int f = 0; f < CFG_FIELD_COUNT; f++) {
+    if (strlen(FIELD_NAMES[f]) == len && strncmp(name, FIELD_NAMES[f], len) == 0) return f;
+  }
+  return -1;
+}
+
+static const uint8_t DEFAULT_DRIFT_WEIGHTS[DRIFT_TABLE_COUNT][DRIFT_EMOTIONS] = DRIFT_WEIGHTS_DEFAULT;
+
+// /api/config names, in DriftTable order.
+static const char* const DRIFT_TABLE_NAMES[DRIFT_TABLE_COUNT] = {
+  "driftNight", "driftMorning", "driftAfternoon", "driftEvening",
+  "driftPositive", "driftNeutral", "driftNegative", "driftGlow", "driftWarmed"
+};
+
+static const uint8_t DEFAULT_MARKOV_MATRIX[DRIFT_EMOTIONS][DRIFT_EMOTIONS] = MARKOV_MATRIX_DEFAULT;
+static const uint8_t DEFAULT_MARKOV_BIAS[MARKOV_BIAS_COUNT][DRIFT_EMOTIONS] = MARKOV_BIAS_DEFAULT;
+
+// /api/markov names, in MarkovBias order.
+static const char* const MARKOV_BIAS_NAMES[MARKOV_BIAS_COUNT] = {
+  "biasNight", "biasMorning", "biasAfternoon", "biasEvening", "biasWarm"
+};
+
+static uint32_t configGeneration = 1;
+
+// Looks the id up in DRIFT_TABLE_NAMES.
+const char* runtimeConfigDriftTableName(uint8_t table) {
+  return table < DRIFT_TABLE_COUNT ? DRIFT_TABLE_NAMES[table] : nullptr;
+}
+
+// Looks the id up in MARKOV_BIAS_NAMES.
+const char* runtimeConfigMarkovBiasName(uint8_t bias) {
+  return bias < MARKOV_BIAS_COUNT ? MARKOV_BIAS_NAMES[bias] : nullptr;
+}
+
+// Parses into a scratch row first so a bad list leaves out untouched.
+bool runtimeConfigParseWeights(const char* text, uint8_t* out, uint8_t fill) {
+  uint8_t row[DRIFT_EMOTIONS];
+  memset(row, fill, sizeof(row));
+  const char* p = text;
+  for (int i = 0; *p; i++) {
+    if (i >= DRIFT_EMOTIONS || *p < '0' || *p > '9') return false;
+    char* end;
+    unsigned long v = strtoul(p, &end, 10);
+    if (v > 255) return false;
+    row[i] = (uint8_t)v;
+    p = end;
+    if (*p == ',') p++;
+    else if (*p) return false;
+  }
+  uint32_t sum = 0;
+  for (int i = 0; i < DRIFT_EMOTIONS; i++) sum += row[i];
+  if (sum == 0) return false;
+  memcpy(out, row, sizeof(row));
+  return true;
+}
+
+// Trailing fill values carry no information and keep the GET responses short.
+size_t runtimeConfigFormatWeights(const uint8_t* weights, char* out, size_t cap, uint8_t fill) {
+  int last = DRIFT_EMOTIONS - 1;
+  while (last > 0 && weights[last] == fill) last--;
+  size_t len = 0;
+  for (int i = 0; i <= last && len < cap; i++) {
+    int n = snprintf(out + len, cap - len, i ? ",%u" : "%u", weights[i]);
+    if (n < 0 || (size_t)n >= cap - len) return 0;
+    len += (size_t)n;
+  }
+  return len;
+}
+
+// Counts load/save/reset calls.
+uint32_t runtimeConfigGeneration() {
+  return configGeneration;
+}
+
+// Clamps to [0, hi] and narrows to a byte-sized field.
+static uint8_t clampByte(uint32_t v, uint8_t hi) {
+  return (uint8_t)(v > hi ? hi : v);
+}
+
+// Writes one field by id, clamped like POST /api/config; false for an unknown id.
+bool runtimeConfigSetField(uint8_t field, uint32_t value) {
+  RuntimeConfig& c = runtimeConfig;
+  switch (field) {
+    case CFG_ATTENTION_STAGE0_MS:     c.attentionStage0Ms     = value; break;
+    case CFG_ATTENTION_STAGE1_MS:     c.attentionStage1Ms     = value; break;
+    case CFG_ATTENTION_STAGE2_MS:     c.attentionStage2Ms     = value; break;
+    case CFG_ATTENTION_STAGE3_MS:     c.attentionStage3Ms     = value; break;
+    case CFG_ATTENTION_STAGE4_MS:     c.attentionStage4Ms     = value; break;
+    case CFG_MOOD_DRIFT_INTERVAL_MS:  c.moodDriftIntervalMs   = value; break;
+    case CFG_MICRO_EXPRESSION_CHANCE: c.microExpressionChance = clampByte(value, 100); break;
+    case CFG_JITTER_PERCENT:          c.jitterPercent         = clampByte(value, 50); break;
+    case CFG_LONG_PRESS_MS:           c.longPressMs           = value; break;
+    case CFG_DOUBLE_TAP_WINDOW_MS:    c.doubleTapWindowMs     = value; break;
+    case CFG_ENABLE_EMOTION_BEEP:     c.enableEmotionBeep     = value != 0; break;
+    case CFG_SPEAKER_VOLUME:          c.speakerVolume         = clampByte(value, 255); break;
+    case CFG_MARKOV_DRIFT:            c.markovDrift           = value != 0; break;
+    default: return false;
+  }
+  return true;
+}
+
+// Reads back the field runtimeConfigSetField() writes.
+uint32_t runtimeConfigGetField(uint8_t field) {
+  const RuntimeConfig& c = runtimeConfig;
+  switch (field) {
+    case CFG_ATTENTION_STAGE0_MS:     return c.attentionStage0Ms;
+    case CFG_ATTENTION_STAGE1_MS:     return c.attentionStage1Ms;
+    case CFG_ATTENTION_STAGE2_MS:     return c.attentionStage2Ms;
+    case CFG_ATTENTION_STAGE3_MS:     return c.attentionStage3Ms;
+    case CFG_ATTENTION_STAGE4_MS:     return c.attentionStage4Ms;
+    case CFG_MOOD_DRIFT_INTERVAL_MS:  return c.moodDriftIntervalMs;
+    case CFG_MICRO_EXPRESSION_CHANCE: return c.microExpressionChance;
+    case CFG_JITTER_PERCENT:          return c.jitterPercent;
+    case CFG_LONG_PRESS_MS:           return c.longPressMs;
+    case CFG_DOUBLE_TAP_WINDOW_MS:    return c.doubleTapWindowMs;
+    case CFG_ENABLE_EMOTION_BEEP:     return c.enableEmotionBeep ? 1 : 0;
+    case CFG_SPEAKER_VOLUME:          return c.speakerVolume;
+    case CFG_MARKOV_DRIFT:            return c.markovDrift ? 1 : 0;
+    default: return 0;
+  }
+}
+
 #ifdef NATIVE_BUILD
 
-void runtimeConfigLoad()  {}  // Already initialized with defaults above
-void runtimeConfigSave()  {}
-void runtimeConfigReset() {}
+void runtimeConfigLoad()  { configGeneration++; }  // Already initialized with defaults above
+void runtimeConfigSave()  { configGeneration++; }
+void runtimeConfigReset() {
+  memcpy(runtimeConfig.driftWeights, DEFAULT_DRIFT_WEIGHTS, sizeof(DEFAULT_DRIFT_WEIGHTS));
+  runtimeConfig.markovDrift = MARKOV_DRIFT_ENABLED;
+  memcpy(runtimeConfig.markovMatrix, DEFAULT_MARKOV_MATRIX, sizeof(DEFAULT_MARKOV_MATRIX));
+  memcpy(runtimeConfig.markovBias, DEFAULT_MARKOV_BIAS, sizeof(DEFAULT_MARKOV_BIAS));
+  configGeneration++;
+}
 
 #else
 
@@ -41,6 +190,19 @@ void runtimeConfigLoad() {
   runtimeConfig.moodDriftIntervalMs   = prefs.getULong("drift",     MOOD_DRIFT_INTERVAL_MS);
   runtimeConfig.microExpressionChance = prefs.getUChar("micro",     MICRO_EXPRESSION_CHANCE);
   runtimeConfig.jitterPercent         = prefs.getUChar("jitter",    JITTER_PERCENT);
+  if (prefs.getBytesLength("dweights") == sizeof(runtimeConfig.driftWeights))
+    prefs.getBytes("dweights", runtimeConfig.driftWeights, sizeof(runtimeConfig.driftWeights));
+  else
+    memcpy(runtimeConfig.driftWeights, DEFAULT_DRIFT_WEIGHTS, sizeof(DEFAULT_DRIFT_WEIGHTS));
+  runtimeConfig.markovDrift           = prefs.getBool ("markov",    MARKOV_DRIFT_ENABLED);
+  if (prefs.getBytesLength("mmatrix") == sizeof(runtimeConfig.markovMatrix))
+    prefs.getBytes("mmatrix", runtimeConfig.markovMatrix, sizeof(runtimeConfig.markovMatrix));
+  else
+    memcpy(runtimeConfig.markovMatrix, DEFAULT_MARKOV_MATRIX, sizeof(DEFAULT_MARKOV_MATRIX));
+  if (prefs.getBytesLength("mbias") == sizeof(runtimeConfig.markovBias))
+    prefs.getBytes("mbias", runtimeConfig.markovBias, sizeof(runtimeConfig.markovBias));
+  else
+    memcpy(runtimeConfig.markovBias, DEFAULT_MARKOV_BIAS, sizeof(DEFAULT_MARKOV_BIAS));
   runtimeConfig.longPressMs           = prefs.getULong("longpress", LONG_PRESS_MS);
   runtimeConfig.doubleTapWindowMs     = prefs.getULong("doubletap", DOUBLE_TAP_WINDOW_MS);
   runtimeConfig.enableEmotionBeep     = prefs.getBool ("beep",      ENABLE_EMOTION_BEEP);
@@ -50,6 +212,7 @@ void runtimeConfigLoad() {
   String pass = prefs.getString("stapass", WIFI_STA_PASSWORD);
   strlcpy(runtimeConfig.staPassword, pass.c_str(), sizeof(runtimeConfig.staPassword));
   prefs.end();
+  configGeneration++;
 }
 
 void runtimeConfigSave() {
@@ -62,6 +225,10 @@ void runtimeConfigSave() {
   prefs.putULong("drift",     runtimeConfig.moodDriftIntervalMs);
   prefs.putUChar("micro",     runtimeConfig.microExpressionChance);
   prefs.putUChar("jitter",    runtimeConfig.jitterPercent);
+  prefs.putBytes("dweights",  runtimeConfig.driftWeights, sizeof(runtimeConfig.driftWeights));
+  prefs.putBool  ("markov",   runtimeConfig.markovDrift);
+  prefs.putBytes("mmatrix",   runtimeConfig.markovMatrix, sizeof(runtimeConfig.markovMatrix));
+  prefs.putBytes("mbias",     runtimeConfig.markovBias, sizeof(runtimeConfig.markovBias));
   prefs.putULong("longpress", runtimeConfig.longPressMs);
   prefs.putULong("doubletap", runtimeConfig.doubleTapWindowMs);
   prefs.putBool  ("beep",     runtimeConfig.enableEmotionBeep);
@@ -69,6 +236,7 @@ void runtimeConfigSave() {
   prefs.putString("stassid",  runtimeConfig.staSsid);
   prefs.putString("stapass",  runtimeConfig.staPassword);
   prefs.end();
+  configGeneration++;
 }
 
 void runtimeConfigReset() {
@@ -80,6 +248,10 @@ void runtimeConfigReset() {
   runtimeConfig.moodDriftIntervalMs  = MOOD_DRIFT_INTERVAL_MS;
   runtimeConfig.microExpressionChance = MICRO_EXPRESSION_CHANCE;
   runtimeConfig.jitterPercent        = JITTER_PERCENT;
+  memcpy(runtimeConfig.driftWeights, DEFAULT_DRIFT_WEIGHTS, sizeof(DEFAULT_DRIFT_WEIGHTS));
+  runtimeConfig.markovDrift          = MARKOV_DRIFT_ENABLED;
+  memcpy(runtimeConfig.markovMatrix, DEFAULT_MARKOV_MATRIX, sizeof(DEFAULT_MARKOV_MATRIX));
+  memcpy(runtimeConfig.markovBias, DEFAULT_MARKOV_BIAS, sizeof(DEFAULT_MARKOV_BIAS));
   runtimeConfig.longPressMs          = LONG_PRESS_MS;
   runtimeConfig.doubleTapWindowMs    = DOUBLE_TAP_WINDOW_MS;
   runtimeConfig.enableEmotionBeep    = ENABLE_EMOTION_BEEP;
@@ -0,0 +1,68 @@
+#include "scheduler.h"
+
+Scheduler scheduler;
+
+// Wrap-safe "deadline has passed" check for millis() timestamps.
+static inline bool isDue(unsigned long now, unsigned long due) {
+  return (long)(now - due) >= 0;
+}
+
+// Starts with an empty task table.
+Scheduler::Scheduler() : count_(0) {
+  for (int i = 0; i < MAX_TASKS; i++) {
+    tasks_[i].name = nullptr;
+    tasks_[i].fn = nullptr;
+    tasks_[i].due = 0;
+    tasks_[i].runs = 0;
+  }
+}
+
+// Appends a task to the table; returns its id or -1 when full or fn is null.
+int Scheduler::add(const char* name, TaskFn fn, unsigned long firstDue) {
+  if (!fn || count_ >= MAX_TASKS) return -1;
+  ScheduledTask& t = tasks_[count_];
+  t.name = name;
+  t.fn = fn;
+  t.due = firstDue;
+  t.runs = 0;
+  return count_++;
+}
+
+// Makes the task due immediately if its current deadline is later than now.
+void Scheduler::wake(int id, unsigned long now) {
+  if (id < 0 || id >= count_) return;
+  if (!isDue(now, tasks_[id].due)) tasks_[id].due = now;
+}
+
+// Runs each due task once in registration order and stores its reported next deadline.
+int Scheduler::runDue(unsigned long now) {
+  int ran = 0;
+  for (int i = 0; i < count_; i++) {
+    ScheduledTask& t = tasks_[i];
+    if (!isDue(now, t.due)) continue;
+    t.due = t.fn(now);
+    t.runs++;
+    ran++;
+  }
+  return ran;
+}
+
+// Returns the soonest deadline of all registered tasks (0 when none are registered).
+unsigned long Scheduler::nextDeadline() const {
+  if (count_ == 0) return 0;
+  unsigned long earliest = tasks_[0].due;
+  for (int i = 1; i < count_; i++) {
+    if ((long)(tasks_[i].due - earliest) < 0) earliest = tasks_[i].due;
+  }
+  return earliest;
+}
+
+// Returns the task's pending deadline, or 0 for an unknown id.
+unsigned long Scheduler::getDue(int id) const {
+  return (id >= 0 && id < count_) ? tasks_[id].due : 0;
+}
+
+// Returns how many times the task has run, or 0 for an unknown id.
+uint32_t Scheduler::getRuns(int id) const {
+  return (id >= 0 && id < count_) ? tasks_[id].runs : 0;
+}
@@ -0,0 +1,44 @@
+#include "script_player.h"
+
+ScriptPlayer scriptPlayer;
+
+// Nothing to play.
+ScriptPlayer::ScriptPlayer() {
+  stop();
+}
+
+// Drops the current script and waits for new steps.
+void ScriptPlayer::begin() {
+  stop();
+}
+
+// The first step plays on the next tick; later ones when the previous hold ends.
+bool ScriptPlayer::append(uint8_t emotion, uint16_t holdMs) {
+  if (count_ >= MAX_STEPS) return false;
+  steps_[count_].emotion = emotion;
+  steps_[count_].holdMs = holdMs;
+  count_++;
+  return true;
+}
+
+// Forgets every step.
+void ScriptPlayer::stop() {
+  count_ = 0;
+  next_ = 0;
+  started_ = false;
+  nextDue_ = 0;
+}
+
+// Steps forward when the current hold has elapsed; ends the script after the last hold.
+int ScriptPlayer::tick(unsigned long now) {
+  if (count_ == 0) return -1;
+  if (started_ && (long)(now - nextDue_) < 0) return -1;
+  if (next_ >= count_) {
+    stop();
+    return -1;
+  }
+  const ScriptStep& step = steps_[next_++];
+  started_ = true;
+  nextDue_ = now + step.holdMs;
+  return step.emotion;
+}
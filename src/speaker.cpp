@@ -114,14 +114,10 @@ static const BeepTone PATTERN_GRUMPY[] = {
 
 // ===== BEEP MANAGER IMPLEMENTATION =====
 
-// Initializes beep state machine fields to idle; hardware setup is deferred to init().
+// Idle; hardware and the tone timer are set up in init().
 BeepManager::BeepManager()
-  : currentPattern(nullptr),
-    patternLength(0),
-    currentToneIndex(0),
-    toneStartTime(0),
-    isActive(false),
-    isTonePlaying(false) {
+  : timer_(nullptr),
+    playing_(false) {
 }
 
 static const BeepTone PATTERN_STARTUP[] = {
@@ -131,73 +127,54 @@ static const BeepTone PATTERN_STARTUP[] = {
   {1047, 200}            // C6
 };
 
-// Configures the LEDC PWM channel and plays the startup C major arpeggio tone sequence.
+// Configures the LEDC PWM channel, creates the tone timer and starts the startup C major arpeggio.
+// The chime plays from the timer like any other pattern, so boot carries on underneath it.
 void BeepManager::init() {
   ledcSetup(SPEAKER_CHANNEL, SPEAKER_BASE_FREQ, SPEAKER_RESOLUTION);
   ledcAttachPin(SPEAKER_PIN, SPEAKER_CHANNEL);
   ledcWrite(SPEAKER_CHANNEL, 0); // Start silent
 
-  // Startup test tone — C major arpeggio
-  Serial.println("[SPEAKER] Playing startup tone...");
-  for (int i = 0; i < (int)(sizeof(PATTERN_STARTUP) / sizeof(BeepTone)); i++) {
-    int freq = PATTERN_STARTUP[i].frequency;
-    int dur  = PATTERN_STARTUP[i].duration;
-    if (freq > 0) {
-      Serial.printf("[SPEAKER] tone %dHz for %dms\n", freq, dur);
-      ledcWriteTone(SPEAKER_CHANNEL, freq);
-      ledcWrite(SPEAKER_CHANNEL, runtimeConfig.speakerVolume);
-    } else {
-      Serial.printf("[SPEAKER] silence %dms\n", dur);
-      ledcWrite(SPEAKER_CHANNEL, 0);
-    }
-    delay(dur);
+  esp_timer_create_args_t args = {};
+  args.callback = timerEntry;
+  args.arg = this;
+  args.dispatch_method = ESP_TIMER_TASK;
+  args.name = "beep";
+  if (esp_timer_create(&args, &timer_) != ESP_OK) {
+    timer_ = nullptr;
+    Serial.println("[SPEAKER] tone timer unavailable — beeps disabled");
+    return;
   }
-  ledcWrite(SPEAKER_CHANNEL, 0);
+
+  Serial.println("[SPEAKER] Playing startup tone...");
+  startBeep(PATTERN_STARTUP, sizeof(PATTERN_STARTUP) / sizeof(BeepTone));
   Serial.printf("[SPEAKER] init done — GPIO %d, volume %d/255\n", SPEAKER_PIN, runtimeConfig.speakerVolume);
 }
 
-// Advances the non-blocking beep state machine; moves to the next tone when the current duration elapses.
-void BeepManager::update() {
-  if (!isActive || currentPattern == nullptr) {
-    return;
+// Drives the PWM for one tone; frequency 0 is silence.
+void BeepManager::applyTone(int frequency) {
+  if (frequency > 0) {
+    ledcWriteTone(SPEAKER_CHANNEL, frequency);
+    ledcWrite(SPEAKER_CHANNEL, runtimeConfig.speakerVolume); // Configurable volume to prevent power issues
+  } else {
+    ledcWrite(SPEAKER_CHANNEL, 0);
   }
+}
 
-  unsigned long currentTime = millis();
+// esp_timer trampoline (runs on the esp_timer task).
+void BeepManager::timerEntry(void* self) {
+  static_cast<BeepManager*>(self)->onToneEnd();
+}
 
-  // Handle millis() overflow (49 days)
-  if (currentTime < toneStartTime) {
-    toneStartTime = currentTime;
+// The current tone just ended: start the next one and arm the timer for its end, or go silent.
+void BeepManager::onToneEnd() {
+  if (!seq_.advance()) {
+    applyTone(0);
+    playing_.store(false, std::memory_order_release);
     return;
   }
-
-  // Check if current tone duration has elapsed
-  if (currentTime - toneStartTime >= (unsigned long)currentPattern[currentToneIndex].duration) {
-    // Stop current tone
-    ledcWrite(SPEAKER_CHANNEL, 0);
-
-    // Move to next tone
-    currentToneIndex++;
-
-    // Check if pattern is complete
-    if (currentToneIndex >= patternLength) {
-      stopCurrentBeep();
-      return;
-    }
-
-    // Start next tone
-    int frequency = currentPattern[currentToneIndex].frequency;
-    if (frequency > 0) {
-      ledcWriteTone(SPEAKER_CHANNEL, frequency);
-      ledcWrite(SPEAKER_CHANNEL, runtimeConfig.speakerVolume); // Configurable volume to prevent power issues
-      isTonePlaying = true;
-    } else {
-      // Silence (frequency = 0)
-      ledcWrite(SPEAKER_CHANNEL, 0);
-      isTonePlaying = false;
-    }
-
-    toneStartTime = currentTime;
-  }
+  applyTone(seq_.frequency());
+  uint64_t wait = seq_.delayUs((uint64_t)esp_timer_get_time());
+  esp_timer_start_once(timer_, wait > 0 ? wait : 1);
 }
 
 // Lookup table replaces the 14-case switch
@@ -229,9 +206,9 @@ static const EmotionPattern EMOTION_PATTERNS[] = {
 };
 static const int NUM_PATTERNS = sizeof(EMOTION_PATTERNS) / sizeof(EmotionPattern);
 
-// Looks up the beep pattern for the given emotion and starts playback. No-ops if already active or BLINK.
+// Looks up the beep pattern for the given emotion and starts playback. No-ops if already playing or BLINK.
 void BeepManager::queueEmotionBeep(EmotionState emotion) {
-  if (isActive) return;
+  if (isPlaying()) return;
   if (emotion == EMOTION_BLINK) return;  // No sound for blink
 
   for (int i = 0; i < NUM_PATTERNS; i++) {
@@ -246,32 +223,13 @@ void BeepManager::queueEmotionBeep(EmotionState emotion) {
   startBeep(PATTERN_IDLE, sizeof(PATTERN_IDLE) / sizeof(BeepTone));
 }
 
-// Begins playback of the given tone pattern; starts the first tone immediately.
-void BeepManager::startBeep(const BeepTone* pattern, int patternLength) {
-  currentPattern = pattern;
-  this->patternLength = patternLength;
-  currentToneIndex = 0;
-  toneStartTime = millis();
-  isActive = true;
-
-  // Start first tone
-  int frequency = currentPattern[0].frequency;
-  if (frequency > 0) {
-    ledcWriteTone(SPEAKER_CHANNEL, frequency);
-    ledcWrite(SPEAKER_CHANNEL, runtimeConfig.speakerVolume); // Configurable volume to prevent power issues
-    isTonePlaying = true;
-  } else {
-    ledcWrite(SPEAKER_CHANNEL, 0);
-    isTonePlaying = false;
-  }
-}
-
-// Stops all PWM output and resets the beep state machine to idle.
-void BeepManager::stopCurrentBeep() {
-  ledcWrite(SPEAKER_CHANNEL, 0);
-  currentPattern = nullptr;
-  patternLength = 0;
-  currentToneIndex = 0;
-  isActive = false;
-  isTonePlaying = false;
+// Starts the first tone now and arms the timer for its end; the callback plays the rest.
+bool BeepManager::startBeep(const BeepTone* pattern, int patternLength) {
+  if (!timer_ || isPlaying()) return false;
+  uint64_t now = (uint64_t)esp_timer_get_time();
+  if (!seq_.start(pattern, patternLength, now)) return false;
+  playing_.store(true, std::memory_order_release);
+  applyTone(seq_.frequency());
+  esp_timer_start_once(timer_, seq_.delayUs(now));
+  return true;
 }
@@ -0,0 +1,45 @@
+#include "sse.h"
+#include <string.h>
+
+const char SSE_RESPONSE_HEAD[] =
+  "HTTP/1.1 200 OK\r\n"
+  "Content-Type: text/event-stream\r\n"
+  "Cache-Control: no-cache\r\n"
+  "Connection: keep-alive\r\n"
+  "Access-Control-Allow-Origin: *\r\n"
+  "\r\n";
+
+const char SSE_KEEPALIVE[] = ": ping\n\n";
+
+// Appends len bytes of s at out[n]; false once the event would overflow cap.
+static bool put(char* out, size_t cap, size_t& n, const char* s, size_t len) {
+  if (n + len >= cap) return false;
+  memcpy(out + n, s, len);
+  n += len;
+  return true;
+}
+
+// Splits data on '\n' so a multi-line payload becomes several data: lines of one event.
+size_t formatSseEvent(char* out, size_t cap, const char* event, const char* data) {
+  size_t n = 0;
+  if (event && *event) {
+    if (!put(out, cap, n, "event: ", 7) || !put(out, cap, n, event, strlen(event)) ||
+        !put(out, cap, n, "\n", 1)) {
+      return 0;
+    }
+  }
+  const char* line = data ? data : "";
+  for (;;) {
+    const char* nl = strchr(line, '\n');
+    size_t len = nl ? (size_t)(nl - line) : strlen(line);
+    if (!put(out, cap, n, "data: ", 6) || !put(out, cap, n, line, len) ||
+        !put(out, cap, n, "\n", 1)) {
+      return 0;
+    }
+    if (!nl) break;
+    line = nl + 1;
+  }
+  if (!put(out, cap, n, "\n", 1)) return 0;
+  out[n] = '\0';
+  return n;
+}
@@ -0,0 +1,84 @@
+#include "sta_link.h"
+
+// Wrap-safe "deadline has passed" check for millis() timestamps.
+static inline bool isDue(unsigned long now, unsigned long due) {
+  return (long)(now - due) >= 0;
+}
+
+// Starts with no credentials.
+StaLink::StaLink()
+  : state_(STA_OFF), synced_(false), attempts_(0), deadline_(0), retryAt_(0), linkUpAt_(0) {}
+
+// Schedules an attempt for the next update() and forgets the previous sync.
+void StaLink::start(unsigned long now) {
+  state_ = STA_BACKOFF;
+  synced_ = false;
+  attempts_ = 0;
+  retryAt_ = now;
+}
+
+// Stops retrying; the caller drops the link itself.
+void StaLink::stop() {
+  state_ = STA_OFF;
+}
+
+// Doubles from the minimum per failure, capped at the maximum.
+unsigned long StaLink::backoffMs(uint16_t failures) {
+  unsigned long ms = WIFI_STA_RETRY_MIN_MS;
+  for (uint16_t i = 1; i < failures && ms < WIFI_STA_RETRY_MAX_MS; i++) ms *= 2;
+  return ms < WIFI_STA_RETRY_MAX_MS ? ms : WIFI_STA_RETRY_MAX_MS;
+}
+
+// One transition at most per call.
+StaAction StaLink::update(unsigned long now, bool linkUp, bool timeSet) {
+  switch (state_) {
+    case STA_OFF:
+      return STA_ACT_NONE;
+
+    case STA_BACKOFF:
+      if (!isDue(now, retryAt_)) return STA_ACT_NONE;
+      state_ = STA_CONNECTING;
+      deadline_ = now + WIFI_STA_TIMEOUT_MS;
+      return STA_ACT_BEGIN;
+
+    case STA_CONNECTING:
+      if (linkUp) {
+        state_ = timeSet ? STA_SYNCED : STA_WAIT_NTP;
+        synced_ = synced_ || timeSet;
+        attempts_ = 0;
+        linkUpAt_ = now;
+        return STA_ACT_START_NTP;
+      }
+      if (!isDue(now, deadline_)) return STA_ACT_NONE;
+      attempts_++;
+      state_ = STA_BACKOFF;
+      retryAt_ = now + backoffMs(attempts_);
+      return STA_ACT_DISCONNECT;
+
+    case STA_WAIT_NTP:
+    case STA_SYNCED:
+      if (!linkUp) {
+        state_ = STA_BACKOFF;
+        retryAt_ = now + WIFI_STA_RETRY_MIN_MS;
+        return STA_ACT_DISCONNECT;
+      }
+      if (state_ == STA_WAIT_NTP && timeSet) {
+        state_ = STA_SYNCED;
+        synced_ = true;
+      }
+      return STA_ACT_NONE;
+  }
+  return STA_ACT_NONE;
+}
+
+// Lowercase names for /api/wifi and logs.
+const char* StaLink::stateName(StaState s) {
+  switch (s) {
+    case STA_OFF:        return "off";
+    case STA_BACKOFF:    return "backoff";
+    case STA_CONNECTING: return "connecting";
+    case STA_WAIT_NTP:   return "wait_ntp";
+    case STA_SYNCED:     return "synced";
+  }
+  return "unknown";
+}
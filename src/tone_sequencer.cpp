@@ -0,0 +1,38 @@
+#include "tone_sequencer.h"
+
+// Idle.
+ToneSequencer::ToneSequencer() {
+  stop();
+}
+
+// The first tone ends one authored duration after nowUs.
+bool ToneSequencer::start(const BeepTone* pattern, int length, uint64_t nowUs) {
+  if (!pattern || length <= 0) {
+    stop();
+    return false;
+  }
+  pattern_ = pattern;
+  length_ = length;
+  index_ = 0;
+  toneEndUs_ = nowUs + (uint64_t)pattern[0].duration * 1000;
+  return true;
+}
+
+// Each end time builds on the previous one, not on when advance() happened to run.
+bool ToneSequencer::advance() {
+  if (!active()) return false;
+  if (++index_ >= length_) {
+    stop();
+    return false;
+  }
+  toneEndUs_ += (uint64_t)pattern_[index_].duration * 1000;
+  return true;
+}
+
+// Forgets the pattern.
+void ToneSequencer::stop() {
+  pattern_ = nullptr;
+  length_ = 0;
+  index_ = 0;
+  toneEndUs_ = 0;
+}
@@ -0,0 +1,129 @@
+#include "touch_decoder.h"
+#include "runtime_config.h"
+#include <Arduino.h>
+#include <limits.h>
+
+// Wrap-safe "a is at or after b" for micros() timestamps.
+static inline bool atOrAfter(uint32_t a, uint32_t b) {
+  return (int32_t)(a - b) >= 0;
+}
+
+// Returns gesture classification based on press duration and time since last tap.
+// Exposed for unit testing.
+TouchGesture classifyGesture(unsigned long pressDuration, unsigned long sincePrevTap) {
+  if (pressDuration >= runtimeConfig.longPressMs) return GESTURE_LONG_PRESS;
+  if (sincePrevTap <= runtimeConfig.doubleTapWindowMs) return GESTURE_DOUBLE_TAP;
+  return GESTURE_TAP;
+}
+
+// Released, nothing pending.
+TouchDecoder::TouchDecoder()
+  : emit_(nullptr), ctx_(nullptr), bounces_(0) {
+  reset(false);
+}
+
+// Drops any half-seen edge or tap and adopts the given level.
+void TouchDecoder::reset(bool touched) {
+  touched_ = touched;
+  candidate_ = false;
+  candidateTouched_ = touched;
+  candidateUs_ = 0;
+  pressUs_ = 0;
+  longPressFired_ = touched;  // a press already in progress never becomes a gesture
+  pendingTap_ = false;
+  pendingTapUs_ = 0;
+  swallowRelease_ = touched;
+}
+
+// Brings the debounced state forward to us: settles a pending edge, then fires expiries.
+void TouchDecoder::advance(uint32_t us) {
+  if (candidate_ && atOrAfter(us, candidateUs_ + TOUCH_DEBOUNCE_US)) {
+    expire(candidateUs_);
+    commit(candidateTouched_, candidateUs_);
+    candidate_ = false;
+  }
+  expire(us);
+}
+
+// An opposite edge inside the debounce window cancels the pending one as a bounce.
+void TouchDecoder::onEdge(uint32_t us, uint8_t level) {
+  bool touched = (level == LOW);
+  advance(us);
+  if (candidate_) {
+    if (touched == touched_) {
+      candidate_ = false;
+      bounces_++;
+    }
+    return;
+  }
+  if (touched == touched_) return;  // repeat of the settled level
+  candidate_ = true;
+  candidateTouched_ = touched;
+  candidateUs_ = us;
+}
+
+// Called with the current time whenever edges have been drained (or a deadline is due).
+void TouchDecoder::poll(uint32_t nowUs) {
+  advance(nowUs);
+}
+
+// Long press once the hold crosses longPressMs; TAP once doubleTapWindowMs passes without a second press.
+void TouchDecoder::expire(uint32_t us) {
+  if (touched_ && !longPressFired_ &&
+      classifyGesture((us - pressUs_) / 1000, ULONG_MAX) == GESTURE_LONG_PRESS) {
+    longPressFired_ = true;
+    pendingTap_ = false;
+    fire(GESTURE_LONG_PRESS, pressUs_ + runtimeConfig.longPressMs * 1000UL);
+  }
+  if (pendingTap_ && !touched_ &&
+      classifyGesture(0, (us - pendingTapUs_) / 1000) == GESTURE_TAP) {
+    pendingTap_ = false;
+    fire(GESTURE_TAP, us);
+  }
+}
+
+// Press: a pending tap within the window makes a double tap. Release: a short press becomes a pending tap.
+void TouchDecoder::commit(bool touched, uint32_t us) {
+  if (touched) {
+    touched_ = true;
+    pressUs_ = us;
+    longPressFired_ = false;
+    swallowRelease_ = false;
+    if (pendingTap_) {
+      pendingTap_ = false;
+      if (classifyGesture(0, (us - pendingTapUs_) / 1000) == GESTURE_DOUBLE_TAP) {
+        swallowRelease_ = true;  // the second press's release is part of the double tap
+        fire(GESTURE_DOUBLE_TAP, us);
+      }
+    }
+    return;
+  }
+  touched_ = false;
+  if (!longPressFired_ && !swallowRelease_) {
+    pendingTap_ = true;
+    pendingTapUs_ = us;
+  }
+  swallowRelease_ = false;
+}
+
+// Forwards to the emit callback if set.
+void TouchDecoder::fire(TouchGesture g, uint32_t us) {
+  if (emit_) emit_(g, us, ctx_);
+}
+
+// Soonest of: pending edge settling, long-press threshold, tap window closing.
+bool TouchDecoder::nextDeadline(uint32_t& us) const {
+  bool any = false;
+  uint32_t best = 0;
+  uint32_t due[3];
+  int n = 0;
+  if (candidate_) due[n++] = candidateUs_ + TOUCH_DEBOUNCE_US;
+  if (touched_ && !longPressFired_) due[n++] = pressUs_ + runtimeConfig.longPressMs * 1000UL;
+  if (pendingTap_ && !touched_) due[n++] = pendingTapUs_ + (runtimeConfig.doubleTapWindowMs + 1) * 1000UL;
+  for (int i = 0; i < n; i++) {
+    if (!any || (int32_t)(due[i] - best) < 0) best = due[i];
+    any = true;
+  }
+  if (any) us = best;
+  return any;
+}
@@ -0,0 +1,49 @@
+#include "transition.h"
+
+TransitionPlayer transitionPlayer;
+
+static const unsigned long FRAME_HOLD_MS[TransitionPlayer::FRAME_COUNT] =
+    TRANSITION_FRAME_HOLD_MS;
+
+// Starts idle with no draw function.
+TransitionPlayer::TransitionPlayer() : drawFn_(nullptr) {
+  reset();
+}
+
+// Forgets any in-progress transition so the next update() draws immediately.
+void TransitionPlayer::reset() {
+  due_ = 0;
+  lastFrame_ = -1;
+  finalDrawn_ = false;
+}
+
+// Returns the on-screen hold for a frame; out-of-range frames hold for 0ms.
+unsigned long TransitionPlayer::frameHoldMs(int frame) {
+  if (frame < 0 || frame >= FRAME_COUNT) return 0;
+  return FRAME_HOLD_MS[frame];
+}
+
+// Draws at most one frame per call and never waits. A frame index that does not
+// follow the last one drawn (a retarget restarted the blink) is drawn straight away.
+TransitionStep TransitionPlayer::update(int frame, EmotionState current,
+                                        EmotionState target, unsigned long now) {
+  bool inSequence = (lastFrame_ >= 0 && frame == lastFrame_ + 1);
+  if (inSequence && (long)(now - due_) < 0) return TS_WAITING;
+
+  if (inSequence && finalDrawn_) {
+    reset();
+    return TS_COMPLETE;
+  }
+
+  TransitionResult r = TR_DREW_FRAME;
+  if (drawFn_) {
+    r = drawFn_(frame, current, target);
+  } else if (frame >= FRAME_COUNT - 1) {
+    r = TR_COMPLETE;
+  }
+
+  lastFrame_ = frame;
+  finalDrawn_ = (r == TR_COMPLETE);
+  due_ = now + frameHoldMs(frame);
+  return TS_ADVANCE;
+}
@@ -6,6 +6,9 @@
 
 #include "web_server.h"
 #include "web_ui.h"
+#include "web_ui_gz.h"
+#include "metrics.h"
+#include "sse.h"
 #include <WiFi.h>
 
 WebServerManager webServerManager;
@@ -13,7 +16,8 @@ WebServerManager webServerManager;
 WebServerManager::WebServerManager()
   : server_(WIFI_SERVER_PORT),
     em_(nullptr), bm_(nullptr), im_(nullptr), cfg_(nullptr), p_(nullptr),
-    ntpSynced_(false) {}
+    sseLastStatus_(0), sseLastWrite_(0), lastAttentionStage_(-1), mirrorLast_(0),
+    staLinkUp_(false) {}
 
 // ===== DIAGNOSTICS =====
 
@@ -21,22 +25,42 @@ void WebServerManager::logHeap(const char* ctx) {
   Serial.printf("[WEB] Free heap (%s): %u bytes\n", ctx, ESP.getFreeHeap());
 }
 
-// ===== STA CONNECT =====
+// ===== STA LINK =====
 
-// Blocking STA connect + NTP start. Called once during init() if credentials are saved.
-void WebServerManager::connectStaBlocking(const char* ssid, const char* pass) {
-  WiFi.mode(WIFI_AP_STA);
-  WiFi.begin(ssid, pass);
-  Serial.printf("[WEB] Connecting to \"%s\" for NTP...\n", ssid);
-  unsigned long t = millis();
-  while (WiFi.status() != WL_CONNECTED && millis() - t < WIFI_STA_TIMEOUT_MS) {
-    delay(200);
+// Performs whatever StaLink asks for this pass; never waits on the radio.
+void WebServerManager::serviceStaLink(unsigned long now) {
+  StaState before = sta_.state();
+  bool timeSet = false;
+  if (before == STA_CONNECTING || before == STA_WAIT_NTP) {
+    struct tm ti;
+    timeSet = getLocalTime(&ti, 0);
+  }
+  bool wasSynced = sta_.synced();
+
+  switch (sta_.update(now, staLinkUp_, timeSet)) {
+    case STA_ACT_BEGIN:
+      WiFi.mode(WIFI_AP_STA);
+      WiFi.begin(cfg_->staSsid, cfg_->staPassword);
+      Serial.printf("[WEB] Connecting to \"%s\" for NTP (attempt %u)\n",
+                    cfg_->staSsid, (unsigned)sta_.attempts() + 1);
+      break;
+    case STA_ACT_DISCONNECT:
+      WiFi.disconnect();
+      Serial.printf("[WEB] STA %s — retry in %lu ms\n",
+                    before == STA_CONNECTING ? "timed out" : "link lost",
+                    sta_.retryAt() - now);
+      break;
+    case STA_ACT_START_NTP:
+      configTime(NTP_UTC_OFFSET_S, NTP_DST_OFFSET_S, NTP_SERVER);
+      Serial.printf("[WEB] STA connected at %lu ms | STA IP: %s\n",
+                    now, WiFi.localIP().toString().c_str());
+      break;
+    case STA_ACT_NONE:
+      break;
   }
-  if (WiFi.status() == WL_CONNECTED) {
-    configTime(NTP_UTC_OFFSET_S, NTP_DST_OFFSET_S, NTP_SERVER);
-    Serial.printf("[WEB] STA connected | STA IP: %s\n", WiFi.localIP().toString().c_str());
-  } else {
-    Serial.println("[WEB] STA timed out — NTP disabled");
+  if (!wasSynced && sta_.synced()) {
+    Serial.printf("[WEB] NTP sync confirmed at %lu ms\n", now);
+    if (onTimeSynced_) onTimeSynced_();
   }
 }
 
@@ -44,17 +68,20 @@ void WebServerManager::connectStaBlocking(const char* ssid, const char* pass) {
 
 void WebServerManager::init() {
   logHeap("pre-WiFi");
-  ntpSynced_ = false;
+  bool haveSta = cfg_ && strlen(cfg_->staSsid) > 0;
 
-  WiFi.mode(WIFI_AP);
+  WiFi.mode(haveSta ? WIFI_AP_STA : WIFI_AP);
   WiFi.softAP(WIFI_AP_SSID, nullptr, WIFI_AP_CHANNEL);  // nullptr = open network
   Serial.printf("[WEB] AP started — SSID: %s | IP: %s\n",
                 WIFI_AP_SSID, WiFi.softAPIP().toString().c_str());
 
-  // Connect to home WiFi for NTP if credentials are saved
-  if (cfg_ && strlen(cfg_->staSsid) > 0) {
-    connectStaBlocking(cfg_->staSsid, cfg_->staPassword);
-  }
+  // Home WiFi for NTP connects in the background (serviceStaLink); StaLink owns retries
+  WiFi.setAutoReconnect(false);
+  WiFi.onEvent([this](arduino_event_id_t, arduino_event_info_t) { staLinkUp_ = true; },
+               ARDUINO_EVENT_WIFI_STA_GOT_IP);
+  WiFi.onEvent([this](arduino_event_id_t, arduino_event_info_t) { staLinkUp_ = false; },
+               ARDUINO_EVENT_WIFI_STA_DISCONNECTED);
+  if (haveSta) sta_.start(millis());
 
   logHeap("post-WiFi");
 
@@ -63,16 +90,21 @@ void WebServerManager::init() {
   }
 
   // Route registration
-  server_.on("/",                HTTP_GET,  [this]() { handleRoot(); });
-  server_.on("/api/status",      HTTP_GET,  [this]() { handleApiStatus(); });
-  server_.on("/api/emotion",     HTTP_POST, [this]() { handleApiEmotion(); });
-  server_.on("/api/gesture",     HTTP_POST, [this]() { handleApiGesture(); });
-  server_.on("/api/config",      HTTP_GET,  [this]() { handleApiConfigGet(); });
-  server_.on("/api/config",      HTTP_POST, [this]() { handleApiConfigPost(); });
-  server_.on("/api/config/reset",HTTP_POST, [this]() { handleApiConfigReset(); });
-  server_.on("/api/wifi",        HTTP_GET,  [this]() { handleApiWifiGet(); });
-  server_.on("/api/wifi",        HTTP_POST, [this]() { handleApiWifiPost(); });
-  server_.onNotFound([this]() { handleNotFound(); });
+  server_.on("/",                HttpMethod::GET,  [this]() { timed(&WebServerManager::handleRoot); });
+  server_.on("/api/status",      HttpMethod::GET,  [this]() { timed(&WebServerManager::handleApiStatus); });
+  server_.on("/api/emotion",     HttpMethod::POST, [this]() { timed(&WebServerManager::handleApiEmotion); });
+  server_.on("/api/gesture",     HttpMethod::POST, [this]() { timed(&WebServerManager::handleApiGesture); });
+  server_.on("/api/config",      HttpMethod::GET,  [this]() { timed(&WebServerManager::handleApiConfigGet); });
+  server_.on("/api/config",      HttpMethod::POST, [this]() { timed(&WebServerManager::handleApiConfigPost); });
+  server_.on("/api/config/reset",HttpMethod::POST, [this]() { timed(&WebServerManager::handleApiConfigReset); });
+  server_.on("/api/markov",      HttpMethod::GET,  [this]() { timed(&WebServerManager::handleApiMarkovGet); });
+  server_.on("/api/markov",      HttpMethod::POST, [this]() { timed(&WebServerManager::handleApiMarkovPost); });
+  server_.on("/api/wifi",        HttpMethod::GET,  [this]() { timed(&WebServerManager::handleApiWifiGet); });
+  server_.on("/api/wifi",        HttpMethod::POST, [this]() { timed(&WebServerManager::handleApiWifiPost); });
+  server_.on("/api/metrics",     HttpMethod::GET,  [this]() { timed(&WebServerManager::handleApiMetrics); });
+  server_.on("/api/events",      HttpMethod::GET,  [this]() { timed(&WebServerManager::handleApiEvents); });
+  server_.on("/ws",              HttpMethod::GET,  [this]() { timed(&WebServerManager::handleWebSocket); });
+  server_.onNotFound([this]() { timed(&WebServerManager::handleNotFound); });
 
   server_.begin();
   Serial.printf("[WEB] Server listening on port %d\n", WIFI_SERVER_PORT);
@@ -81,39 +113,58 @@ void WebServerManager::init() {
 // ===== UPDATE =====
 
 void WebServerManager::update() {
-  server_.handleClient();
-  // Confirm NTP sync once time is actually set (may lag a few seconds after WiFi connect)
-  if (!ntpSynced_ && WiFi.status() == WL_CONNECTED) {
-    struct tm ti;
-    if (getLocalTime(&ti, 0)) {
-      ntpSynced_ = true;
-      Serial.println("[WEB] NTP sync confirmed");
-    }
-  }
+  server_.update();
+  unsigned long now = millis();
+  serviceWebSockets(now);
+  serviceEventStreams(now);
+  serviceStaLink(now);
 }
 
 // ===== ROUTE HANDLERS =====
 
-// GET / — serves the full HTML control UI from PROGMEM.
+// Runs a route handler under a METRIC_HTTP timer attributed to the current emotion.
+void WebServerManager::timed(void (WebServerManager::*handler)()) {
+  MetricTimer t(METRIC_HTTP, em_ ? em_->getCurrentEmotion() : EMOTION_IDLE);
+  (this->*handler)();
+}
+
+// GET / — serves the control UI gzip'd straight from flash; 304 when the browser's copy is current.
+// Clients that do not accept gzip get the uncompressed page.
 void WebServerManager::handleRoot() {
-  server_.sendHeader("Content-Encoding", "identity");
-  server_.send_P(200, "text/html", WEB_UI_HTML);
+  if (server_.header("Accept-Encoding").indexOf("gzip") < 0) {
+    server_.send_P(200, "text/html", WEB_UI_HTML);
+    return;
+  }
+  server_.sendHeader("ETag", WEB_UI_GZ_ETAG);
+  server_.sendHeader("Cache-Control", "no-cache");  // always revalidate — answered by 304 below
+  server_.sendHeader("Vary", "Accept-Encoding");
+  if (server_.header("If-None-Match").indexOf(WEB_UI_GZ_ETAG) >= 0) {
+    server_.send(304);
+    return;
+  }
+  server_.sendHeader("Content-Encoding", "gzip");
+  server_.sendStatic(200, "text/html", WEB_UI_GZ, WEB_UI_GZ_LEN);
 }
 
-// GET /api/status — returns robot state as JSON (hand-crafted, no library).
-void WebServerManager::handleApiStatus() {
-  char buf[256];
+// Formats the robot state snapshot shared by /api/status and the "status" event.
+void WebServerManager::formatStatusJson(char* buf, size_t cap) {
   int emotionId        = em_ ? (int)em_->getCurrentEmotion() : 0;
   const char* emoName  = em_ ? emotionRegistry.getName(em_->getCurrentEmotion()) : "UNKNOWN";
   float voltage        = bm_ ? bm_->readVoltage() : 0.0f;
   int stage            = p_  ? p_->getAttentionStage() : 0;
   uint32_t freeHeap    = ESP.getFreeHeap();
 
-  snprintf(buf, sizeof(buf),
+  snprintf(buf, cap,
     "{\"emotion\":%d,\"emotionName\":\"%s\","
     "\"batteryVoltage\":%.2f,\"uptimeMs\":%lu,"
     "\"attentionStage\":%d,\"freeHeap\":%u}",
     emotionId, emoName, voltage, millis(), stage, freeHeap);
+}
+
+// GET /api/status — returns robot state as JSON (hand-crafted, no library).
+void WebServerManager::handleApiStatus() {
+  char buf[256];
+  formatStatusJson(buf, sizeof(buf));
 
   server_.sendHeader("Access-Control-Allow-Origin", "*");
   server_.send(200, "application/json", buf);
@@ -155,40 +206,65 @@ void WebServerManager::handleApiGesture() {
   server_.send(200, "application/json", "{\"ok\":true}");
 }
 
-// GET /api/config — returns all runtimeConfig fields as JSON.
+// GET /api/config — returns all runtimeConfig fields as JSON, streamed so the drift
+// tables (one chunk each) never have to fit the tx buffer at once.
 void WebServerManager::handleApiConfigGet() {
   if (!cfg_) {
     server_.send(503, "application/json", "{\"error\":\"config unavailable\"}");
     return;
   }
-  char buf[512];
-  snprintf(buf, sizeof(buf),
-    "{\"attentionStage0Ms\":%lu,\"attentionStage1Ms\":%lu,\"attentionStage2Ms\":%lu,"
-    "\"attentionStage3Ms\":%lu,\"attentionStage4Ms\":%lu,"
-    "\"moodDriftIntervalMs\":%lu,\"microExpressionChance\":%u,"
-    "\"jitterPercent\":%u,"
-    "\"longPressMs\":%lu,\"doubleTapWindowMs\":%lu,"
-    "\"enableEmotionBeep\":%s,\"speakerVolume\":%u}",
-    cfg_->attentionStage0Ms,
-    cfg_->attentionStage1Ms, cfg_->attentionStage2Ms,
-    cfg_->attentionStage3Ms, cfg_->attentionStage4Ms,
-    cfg_->moodDriftIntervalMs,
-    cfg_->microExpressionChance,
-    cfg_->jitterPercent,
-    cfg_->longPressMs, cfg_->doubleTapWindowMs,
-    cfg_->enableEmotionBeep ? "true" : "false",
-    cfg_->speakerVolume);
-
+  const RuntimeConfig* cfg = cfg_;
+  int t = -1;         // -1: scalar fields, then drift tables, then the closing brace
   server_.sendHeader("Access-Control-Allow-Origin", "*");
-  server_.send(200, "application/json", buf);
+  server_.sendStream(200, "application/json", [cfg, t](char* out, size_t cap) mutable -> size_t {
+    int n = 0;
+    if (t < 0) {
+      n = snprintf(out, cap,
+        "{\"attentionStage0Ms\":%lu,\"attentionStage1Ms\":%lu,\"attentionStage2Ms\":%lu,"
+        "\"attentionStage3Ms\":%lu,\"attentionStage4Ms\":%lu,"
+        "\"moodDriftIntervalMs\":%lu,\"microExpressionChance\":%u,"
+        "\"jitterPercent\":%u,"
+        "\"longPressMs\":%lu,\"doubleTapWindowMs\":%lu,"
+        "\"enableEmotionBeep\":%s,\"speakerVolume\":%u,\"markovDrift\":%s",
+        cfg->attentionStage0Ms,
+        cfg->attentionStage1Ms, cfg->attentionStage2Ms,
+        cfg->attentionStage3Ms, cfg->attentionStage4Ms,
+        cfg->moodDriftIntervalMs,
+        cfg->microExpressionChance,
+        cfg->jitterPercent,
+        cfg->longPressMs, cfg->doubleTapWindowMs,
+        cfg->enableEmotionBeep ? "true" : "false",
+        cfg->speakerVolume,
+        cfg->markovDrift ? "true" : "false");
+    } else if (t < DRIFT_TABLE_COUNT) {
+      char weights[DRIFT_EMOTIONS * 4];
+      runtimeConfigFormatWeights(cfg->driftWeights[t], weights, sizeof(weights));
+      n = snprintf(out, cap, ",\"%s\":\"%s\"", runtimeConfigDriftTableName((uint8_t)t), weights);
+    } else if (t == DRIFT_TABLE_COUNT) {
+      n = snprintf(out, cap, "}");
+    }
+    t++;
+    return n > 0 && (size_t)n < cap ? (size_t)n : 0;
+  });
 }
 
 // POST /api/config — updates any subset of runtimeConfig fields and saves to NVS.
+// Drift tables (driftNight=30,0,60,...) are validated first; one bad list rejects the request.
 void WebServerManager::handleApiConfigPost() {
   if (!cfg_) {
     server_.send(503, "application/json", "{\"error\":\"config unavailable\"}");
     return;
   }
+  uint8_t drift[DRIFT_TABLE_COUNT][DRIFT_EMOTIONS];
+  memcpy(drift, cfg_->driftWeights, sizeof(drift));
+  for (int t = 0; t < DRIFT_TABLE_COUNT; t++) {
+    const char* name = runtimeConfigDriftTableName((uint8_t)t);
+    if (server_.hasArg(name) && !runtimeConfigParseWeights(server_.arg(name).c_str(), drift[t])) {
+      server_.send(400, "application/json", "{\"error\":\"bad drift weights\"}");
+      return;
+    }
+  }
+  memcpy(cfg_->driftWeights, drift, sizeof(drift));
   if (server_.hasArg("attentionStage0Ms"))
     cfg_->attentionStage0Ms   = (unsigned long)server_.arg("attentionStage0Ms").toInt();
   if (server_.hasArg("attentionStage1Ms"))
@@ -219,6 +295,10 @@ void WebServerManager::handleApiConfigPost() {
     int v = server_.arg("speakerVolume").toInt();
     cfg_->speakerVolume = (uint8_t)(v < 0 ? 0 : v > 255 ? 255 : v);
   }
+  if (server_.hasArg("markovDrift")) {
+    String v = server_.arg("markovDrift");
+    cfg_->markovDrift = v == "1" || v == "true";
+  }
   runtimeConfigSave();
   Serial.printf("[WEB] Config saved\n");
   server_.sendHeader("Access-Control-Allow-Origin", "*");
@@ -233,18 +313,89 @@ void WebServerManager::handleApiConfigReset() {
   server_.send(200, "application/json", "{\"ok\":true}");
 }
 
+// GET /api/markov — transition matrix rows (row0 = from IDLE … row17 = from BLINK) and
+// bias rows, streamed one row per chunk.
+void WebServerManager::handleApiMarkovGet() {
+  if (!cfg_) {
+    server_.send(503, "application/json", "{\"error\":\"config unavailable\"}");
+    return;
+  }
+  const RuntimeConfig* cfg = cfg_;
+  int i = -1;         // -1: preamble, then matrix rows, then bias rows, then the closing brace
+  server_.sendHeader("Access-Control-Allow-Origin", "*");
+  server_.sendStream(200, "application/json", [cfg, i](char* out, size_t cap) mutable -> size_t {
+    char weights[DRIFT_EMOTIONS * 4];
+    int n = 0;
+    if (i < 0) {
+      n = snprintf(out, cap, "{\"enabled\":%s", cfg->markovDrift ? "true" : "false");
+    } else if (i < DRIFT_EMOTIONS) {
+      runtimeConfigFormatWeights(cfg->markovMatrix[i], weights, sizeof(weights));
+      n = snprintf(out, cap, ",\"row%d\":\"%s\"", i, weights);
+    } else if (i < DRIFT_EMOTIONS + MARKOV_BIAS_COUNT) {
+      uint8_t b = (uint8_t)(i - DRIFT_EMOTIONS);
+      runtimeConfigFormatWeights(cfg->markovBias[b], weights, sizeof(weights), MARKOV_BIAS_UNITY);
+      n = snprintf(out, cap, ",\"%s\":\"%s\"", runtimeConfigMarkovBiasName(b), weights);
+    } else if (i == DRIFT_EMOTIONS + MARKOV_BIAS_COUNT) {
+      n = snprintf(out, cap, "}");
+    }
+    i++;
+    return n > 0 && (size_t)n < cap ? (size_t)n : 0;
+  });
+}
+
+// POST /api/markov — swaps any subset of matrix rows (row0=20,12,8,...) and bias rows
+// (biasWarm=100,220,...; missing trailing multipliers are 100), optionally toggles
+// enabled, and saves. All rows are validated first; Personality picks the change up
+// on its next drift.
+void WebServerManager::handleApiMarkovPost() {
+  if (!cfg_) {
+    server_.send(503, "application/json", "{\"error\":\"config unavailable\"}");
+    return;
+  }
+  uint8_t matrix[DRIFT_EMOTIONS][DRIFT_EMOTIONS];
+  uint8_t bias[MARKOV_BIAS_COUNT][DRIFT_EMOTIONS];
+  memcpy(matrix, cfg_->markovMatrix, sizeof(matrix));
+  memcpy(bias, cfg_->markovBias, sizeof(bias));
+  bool ok = true;
+  for (int r = 0; r < DRIFT_EMOTIONS && ok; r++) {
+    char name[8];
+    snprintf(name, sizeof(name), "row%d", r);
+    if (server_.hasArg(name)) ok = runtimeConfigParseWeights(server_.arg(name).c_str(), matrix[r]);
+  }
+  for (int b = 0; b < MARKOV_BIAS_COUNT && ok; b++) {
+    const char* name = runtimeConfigMarkovBiasName((uint8_t)b);
+    if (server_.hasArg(name))
+      ok = runtimeConfigParseWeights(server_.arg(name).c_str(), bias[b], MARKOV_BIAS_UNITY);
+  }
+  if (!ok) {
+    server_.send(400, "application/json", "{\"error\":\"bad markov weights\"}");
+    return;
+  }
+  memcpy(cfg_->markovMatrix, matrix, sizeof(matrix));
+  memcpy(cfg_->markovBias, bias, sizeof(bias));
+  if (server_.hasArg("enabled")) {
+    String v = server_.arg("enabled");
+    cfg_->markovDrift = v == "1" || v == "true";
+  }
+  runtimeConfigSave();
+  Serial.printf("[WEB] Markov drift %s, matrix saved\n", cfg_->markovDrift ? "on" : "off");
+  server_.sendHeader("Access-Control-Allow-Origin", "*");
+  server_.send(200, "application/json", "{\"ok\":true}");
+}
+
 // GET /api/wifi — returns STA connection status and saved SSID (password never returned).
 void WebServerManager::handleApiWifiGet() {
-  bool connected = (WiFi.status() == WL_CONNECTED);
+  bool connected = staLinkUp_;
   char staIp[20] = "";
   if (connected) strlcpy(staIp, WiFi.localIP().toString().c_str(), sizeof(staIp));
   char buf[160];
   snprintf(buf, sizeof(buf),
-    "{\"ssid\":\"%s\",\"connected\":%s,\"ntpSynced\":%s,\"staIp\":\"%s\"}",
+    "{\"ssid\":\"%s\",\"connected\":%s,\"ntpSynced\":%s,\"staIp\":\"%s\","
+    "\"state\":\"%s\",\"failedAttempts\":%u}",
     cfg_ ? cfg_->staSsid : "",
-    connected   ? "true" : "false",
-    ntpSynced_  ? "true" : "false",
-    staIp);
+    connected      ? "true" : "false",
+    sta_.synced()  ? "true" : "false",
+    staIp, StaLink::stateName(sta_.state()), (unsigned)sta_.attempts());
   server_.sendHeader("Access-Control-Allow-Origin", "*");
   server_.send(200, "application/json", buf);
 }
@@ -276,18 +427,314 @@ void WebServerManager::handleApiWifiPost() {
     runtimeConfigSave();
   }
 
-  // Start non-blocking STA connection; update() will confirm NTP once time is set
-  ntpSynced_ = false;
-  WiFi.mode(WIFI_AP_STA);
+  // Restart the background STA link with the new credentials; update() drives it
   WiFi.disconnect();
-  WiFi.begin(cfg_->staSsid, cfg_->staPassword);
-  configTime(NTP_UTC_OFFSET_S, NTP_DST_OFFSET_S, NTP_SERVER);
-  Serial.printf("[WEB] WiFi creds saved — connecting to \"%s\"\n", cfg_->staSsid);
+  staLinkUp_ = false;
+  if (cfg_) sta_.start(millis());
+  Serial.printf("[WEB] WiFi creds saved — connecting to \"%s\"\n", cfg_ ? cfg_->staSsid : "");
 
   server_.sendHeader("Access-Control-Allow-Origin", "*");
   server_.send(200, "application/json", "{\"ok\":true}");
 }
 
+// GET /api/metrics — per-emotion timing summaries, streamed one emotion per chunk.
+// Each section is [count, minUs, avgUs, p99Us, maxUs]; "over" counts frames past budgetUs.
+void WebServerManager::handleApiMetrics() {
+  int e = -1;         // -1: preamble, then emotion ids, then the closing bracket
+  bool first = true;
+  server_.sendHeader("Access-Control-Allow-Origin", "*");
+  server_.sendStream(200, "application/json", [e, first](char* out, size_t cap) mutable -> size_t {
+    if (e < 0) {
+      e = 0;
+      int n = snprintf(out, cap, "{\"sections\":[\"draw\",\"flush\",\"frame\",\"personality\",\"http\"],"
+                                 "\"fields\":[\"count\",\"minUs\",\"avgUs\",\"p99Us\",\"maxUs\"],\"emotions\":[");
+      return n > 0 ? (size_t)n : 0;
+    }
+    while (e < EmotionRegistry::MAX_EMOTIONS) {
+      size_t n = metrics.writeEmotionJson((EmotionState)e++, out + 1, cap - 1);
+      if (!n) continue;
+      if (first) {
+        first = false;
+        memmove(out, out + 1, n);
+        return n;
+      }
+      out[0] = ',';
+      return n + 1;
+    }
+    if (e == EmotionRegistry::MAX_EMOTIONS) {
+      e++;
+      memcpy(out, "]}", 2);
+      return 2;
+    }
+    return 0;
+  });
+}
+
+// GET /api/events — opens a Server-Sent Events stream. The socket is kept after the
+// handler returns; events are written to it by broadcast() only when something changes.
+void WebServerManager::handleApiEvents() {
+  int slot = -1;
+  for (int i = 0; i < SSE_MAX_CLIENTS; i++) {
+    if (!sseClients_[i].connected()) { slot = i; break; }
+  }
+  if (slot < 0) {
+    server_.send(503, "application/json", "{\"error\":\"too many event streams\"}");
+    return;
+  }
+  WiFiClient client = server_.takeClient();
+  client.setNoDelay(true);
+
+  // Open with a full snapshot so the page can render before the first change
+  char data[256];
+  char event[320];
+  formatStatusJson(data, sizeof(data));
+  size_t n = formatSseEvent(event, sizeof(event), "status", data);
+  if (!HttpServer::writeNow(client, SSE_RESPONSE_HEAD, strlen(SSE_RESPONSE_HEAD)) ||
+      (n && !HttpServer::writeNow(client, event, n))) {
+    client.stop();
+    Serial.println("[SSE] stream dropped while opening");
+    return;
+  }
+  sseClients_[slot] = client;
+  Serial.printf("[SSE] stream %d opened (%d open)\n", slot, sseClientCount());
+}
+
+// GET /ws — upgrades to a WebSocket carrying the binary control protocol (control_proto.h).
+// Commands skip HTTP parsing and String arguments entirely; acks and state come back on the same socket.
+void WebServerManager::handleWebSocket() {
+  String key = server_.header("Sec-WebSocket-Key");
+  if (!server_.header("Upgrade").equalsIgnoreCase("websocket") ||
+      server_.header("Sec-WebSocket-Version") != "13" || key.length() == 0) {
+    server_.send(400, "application/json", "{\"error\":\"websocket upgrade required\"}");
+    return;
+  }
+  int slot = -1;
+  for (int i = 0; i < WS_MAX_CLIENTS; i++) {
+    if (!wsClients_[i].client.connected()) { slot = i; break; }
+  }
+  if (slot < 0) {
+    server_.send(503, "application/json", "{\"error\":\"too many control sockets\"}");
+    return;
+  }
+  char head[160];
+  size_t n = formatWsHandshake(head, sizeof(head), key.c_str());
+  if (!n) {
+    server_.send(400, "application/json", "{\"error\":\"bad websocket key\"}");
+    return;
+  }
+  WsClient& ws = wsClients_[slot];
+  ws.client = server_.takeClient();
+  ws.client.setNoDelay(true);
+  if (!HttpServer::writeNow(ws.client, head, n)) {
+    ws.client.stop();
+    Serial.println("[WS] control socket dropped during handshake");
+    return;
+  }
+  ws.parser.reset();
+  ws.mirrorOn = false;
+  ws.mirrorCredit = false;
+  sendControlState(ws, em_ ? em_->getShownEmotion() : EMOTION_IDLE);
+  Serial.printf("[WS] control socket %d opened\n", slot);
+}
+
+// ===== WEBSOCKET CONTROL =====
+
+// Feeds whatever each socket has buffered to its parser and handles every complete frame.
+void WebServerManager::serviceWebSockets(unsigned long now) {
+  uint8_t buf[64];
+  for (int i = 0; i < WS_MAX_CLIENTS; i++) {
+    WsClient& ws = wsClients_[i];
+    while (ws.client.connected() && ws.client.available() > 0) {
+      int n = ws.client.read(buf, sizeof(buf));
+      if (n <= 0) break;
+      size_t pos = 0;
+      while (pos < (size_t)n && ws.client.connected()) {
+        pos += ws.parser.feed(buf + pos, (size_t)n - pos);
+        if (ws.parser.state() == WS_PARSE_FRAME) {
+          handleWsFrame(ws);
+          ws.parser.reset();
+        } else if (ws.parser.state() == WS_PARSE_ERROR) {
+          closeWs(ws, ws.parser.closeCode());
+        }
+      }
+    }
+  }
+  serviceMirror(now);
+}
+
+// Sends each mirror subscriber holding a credit the pages that changed since its last frame.
+// Runs between scheduler tasks, so the framebuffer always holds a finished frame.
+void WebServerManager::serviceMirror(unsigned long now) {
+  if (!frameSource_ || now - mirrorLast_ < MIRROR_MIN_INTERVAL_MS) return;
+  const uint8_t* frame = nullptr;
+  for (int i = 0; i < WS_MAX_CLIENTS; i++) {
+    WsClient& ws = wsClients_[i];
+    if (!ws.mirrorCredit || !ws.client.connected()) continue;
+    if (!frame) frame = frameSource_();
+    size_t n = ws.mirror.encode(frame, mirrorMsg_, sizeof(mirrorMsg_));
+    if (!n) continue;  // unchanged — keep the credit for the next change
+    ws.mirrorCredit = false;
+    sendWs(ws, WS_OP_BINARY, mirrorMsg_, n);
+  }
+  mirrorLast_ = now;
+}
+
+// Binary frames are commands; ping/close are answered per RFC 6455; text is refused.
+void WebServerManager::handleWsFrame(WsClient& ws) {
+  switch (ws.parser.opcode()) {
+    case WS_OP_BINARY: {
+      MetricTimer t(METRIC_HTTP, em_ ? em_->getCurrentEmotion() : EMOTION_IDLE);
+      handleControlCommand(ws, ws.parser.payload(), ws.parser.payloadLength());
+      break;
+    }
+    case WS_OP_PING:
+      sendWs(ws, WS_OP_PONG, ws.parser.payload(), ws.parser.payloadLength());
+      break;
+    case WS_OP_PONG:
+      break;
+    case WS_OP_CLOSE:
+      closeWs(ws, WS_CLOSE_NORMAL);
+      break;
+    default:
+      closeWs(ws, WS_CLOSE_UNSUPPORTED);
+      break;
+  }
+}
+
+// Applies one command through the same callbacks as the HTTP routes, then acknowledges it.
+void WebServerManager::handleControlCommand(WsClient& ws, const uint8_t* data, size_t len) {
+  ControlCommand cmd;
+  ControlStatus status = decodeControlCommand(data, len, cmd);
+  if (status == CTRL_OK && cmd.op == CTRL_MIRROR) {  // credits are answered by frames, not acks
+    if (cmd.arg && !ws.mirrorOn) ws.mirror.reset();
+    ws.mirrorOn = cmd.arg;
+    ws.mirrorCredit = cmd.arg;
+    return;
+  }
+  if (status == CTRL_OK && cmd.op == CTRL_SET_EMOTION && !emotionRegistry.get((EmotionState)cmd.arg)) {
+    status = CTRL_BAD_VALUE;
+  }
+
+  uint8_t ack[CTRL_ACK_BYTES];
+  encodeControlAck(ack, sizeof(ack), cmd.seq, cmd.op, status);
+  sendWs(ws, WS_OP_BINARY, ack, sizeof(ack));
+  if (status != CTRL_OK) return;
+
+  switch (cmd.op) {
+    case CTRL_SET_EMOTION:
+      if (onEmotionSet_) onEmotionSet_((EmotionState)cmd.arg);  // state follows via pushEmotion()
+      break;
+    case CTRL_GESTURE:
+      if (onGesture_) onGesture_((TouchGesture)cmd.arg);
+      break;
+    case CTRL_QUERY:
+      sendControlState(ws, em_ ? em_->getShownEmotion() : EMOTION_IDLE);
+      break;
+    default:
+      break;
+  }
+}
+
+// Frames and writes one message; a failed or short (would-block) write drops the socket.
+void WebServerManager::sendWs(WsClient& ws, WsOpcode opcode, const uint8_t* payload, size_t len) {
+  size_t n = wsEncodeFrame(wsTx_, sizeof(wsTx_), opcode, payload, len);
+  if (!n) return;
+  if (!HttpServer::writeNow(ws.client, wsTx_, n)) {
+    ws.client.stop();
+    Serial.println("[WS] control socket dropped");
+  }
+}
+
+// Sends a close frame with the status code and releases the socket.
+void WebServerManager::closeWs(WsClient& ws, uint16_t code) {
+  uint8_t payload[2] = {(uint8_t)(code >> 8), (uint8_t)code};
+  sendWs(ws, WS_OP_CLOSE, payload, sizeof(payload));
+  ws.client.stop();
+  ws.parser.reset();
+  Serial.printf("[WS] control socket closed (%u)\n", code);
+}
+
+// Emotion, attention stage, battery and uptime in one 9-byte STATE message.
+void WebServerManager::sendControlState(WsClient& ws, EmotionState emotion) {
+  ControlState st;
+  st.emotion        = (uint8_t)emotion;
+  st.attentionStage = p_  ? (uint8_t)p_->getAttentionStage() : 0;
+  st.batteryMv      = bm_ ? (uint16_t)(bm_->readVoltage() * 1000.0f) : 0;
+  st.uptimeMs       = millis();
+  uint8_t msg[CTRL_STATE_BYTES];
+  encodeControlState(msg, sizeof(msg), st);
+  sendWs(ws, WS_OP_BINARY, msg, sizeof(msg));
+}
+
+// ===== SERVER-SENT EVENTS =====
+
+// Pushes the new emotion immediately; no-op without subscribers.
+void WebServerManager::pushEmotion(EmotionState emotion) {
+  for (int i = 0; i < WS_MAX_CLIENTS; i++) {
+    if (wsClients_[i].client.connected()) sendControlState(wsClients_[i], emotion);
+  }
+  if (!sseClientCount()) return;
+  char data[64];
+  snprintf(data, sizeof(data), "{\"emotion\":%d,\"emotionName\":\"%s\"}",
+           (int)emotion, emotionRegistry.getName(emotion));
+  broadcast("emotion", data);
+}
+
+// Counts streams that are still open.
+int WebServerManager::sseClientCount() {
+  int open = 0;
+  for (int i = 0; i < SSE_MAX_CLIENTS; i++) {
+    if (sseClients_[i].connected()) open++;
+  }
+  return open;
+}
+
+// Sends one formatted event to every open stream and drops streams that can't take it now.
+void WebServerManager::broadcast(const char* event, const char* data) {
+  char buf[320];
+  size_t n = formatSseEvent(buf, sizeof(buf), event, data);
+  if (!n) return;
+  for (int i = 0; i < SSE_MAX_CLIENTS; i++) {
+    if (!sseClients_[i].connected()) continue;
+    if (!HttpServer::writeNow(sseClients_[i], buf, n)) {
+      sseClients_[i].stop();
+      Serial.printf("[SSE] stream %d closed\n", i);
+    }
+  }
+  sseLastWrite_ = millis();
+}
+
+// Attention-stage changes, the periodic status snapshot, and keep-alives — only while someone listens.
+void WebServerManager::serviceEventStreams(unsigned long now) {
+  if (!sseClientCount()) return;
+
+  int stage = p_ ? p_->getAttentionStage() : 0;
+  if (stage != lastAttentionStage_) {
+    lastAttentionStage_ = stage;
+    char data[32];
+    snprintf(data, sizeof(data), "{\"attentionStage\":%d}", stage);
+    broadcast("attention", data);
+  }
+
+  if (now - sseLastStatus_ >= SSE_STATUS_INTERVAL_MS) {
+    sseLastStatus_ = now;
+    char data[256];
+    formatStatusJson(data, sizeof(data));
+    broadcast("status", data);
+  }
+
+  if (now - sseLastWrite_ >= SSE_KEEPALIVE_MS) {
+    for (int i = 0; i < SSE_MAX_CLIENTS; i++) {
+      if (!sseClients_[i].connected()) continue;
+      if (!HttpServer::writeNow(sseClients_[i], SSE_KEEPALIVE, strlen(SSE_KEEPALIVE))) {
+        sseClients_[i].stop();
+        Serial.printf("[SSE] stream %d closed\n", i);
+      }
+    }
+    sseLastWrite_ = now;
+  }
+}
+
 // 404 handler for unregistered routes.
 void WebServerManager::handleNotFound() {
   server_.send(404, "text/plain", "Not found");
@@ -0,0 +1,179 @@
+#include "ws_frame.h"
+#include <stdio.h>
+#include <string.h>
+
+static const char WS_GUID[] = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+
+// 32-bit left rotate.
+static inline uint32_t rol(uint32_t v, int n) { return (v << n) | (v >> (32 - n)); }
+
+// Runs the 80-round compression function over one 64-byte block.
+static void sha1Block(uint32_t h[5], const uint8_t* block) {
+  uint32_t w[80];
+  for (int i = 0; i < 16; i++) {
+    w[i] = ((uint32_t)block[i * 4] << 24) | ((uint32_t)block[i * 4 + 1] << 16) |
+           ((uint32_t)block[i * 4 + 2] << 8) | block[i * 4 + 3];
+  }
+  for (int i = 16; i < 80; i++) w[i] = rol(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+
+  uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4];
+  for (int i = 0; i < 80; i++) {
+    uint32_t f, k;
+    if (i < 20)      { f = (b & c) | (~b & d);           k = 0x5A827999; }
+    else if (i < 40) { f = b ^ c ^ d;                    k = 0x6ED9EBA1; }
+    else if (i < 60) { f = (b & c) | (b & d) | (c & d);  k = 0x8F1BBCDC; }
+    else             { f = b ^ c ^ d;                    k = 0xCA62C1D6; }
+    uint32_t t = rol(a, 5) + f + e + k + w[i];
+    e = d;
+    d = c;
+    c = rol(b, 30);
+    b = a;
+    a = t;
+  }
+  h[0] += a; h[1] += b; h[2] += c; h[3] += d; h[4] += e;
+}
+
+// Whole blocks straight from data, then the padded tail (one or two blocks).
+void sha1(const uint8_t* data, size_t len, uint8_t out[20]) {
+  uint32_t h[5] = {0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0};
+  size_t full = len & ~(size_t)63;
+  for (size_t off = 0; off < full; off += 64) sha1Block(h, data + off);
+
+  uint8_t tail[128];
+  size_t rest = len - full;
+  memcpy(tail, data + full, rest);
+  tail[rest] = 0x80;
+  size_t tailLen = rest + 1 + 8 <= 64 ? 64 : 128;
+  memset(tail + rest + 1, 0, tailLen - rest - 1);
+  uint64_t bits = (uint64_t)len * 8;
+  for (int i = 0; i < 8; i++) tail[tailLen - 1 - i] = (uint8_t)(bits >> (8 * i));
+  sha1Block(h, tail);
+  if (tailLen == 128) sha1Block(h, tail + 64);
+
+  for (int i = 0; i < 5; i++) {
+    out[i * 4]     = (uint8_t)(h[i] >> 24);
+    out[i * 4 + 1] = (uint8_t)(h[i] >> 16);
+    out[i * 4 + 2] = (uint8_t)(h[i] >> 8);
+    out[i * 4 + 3] = (uint8_t)h[i];
+  }
+}
+
+// Three input bytes → four output characters; the last group is padded with '='.
+size_t base64Encode(const uint8_t* data, size_t len, char* out, size_t cap) {
+  static const char ALPHABET[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  size_t need = (len + 2) / 3 * 4;
+  if (need + 1 > cap) return 0;
+  size_t n = 0;
+  for (size_t i = 0; i < len; i += 3) {
+    uint32_t v = (uint32_t)data[i] << 16;
+    if (i + 1 < len) v |= (uint32_t)data[i + 1] << 8;
+    if (i + 2 < len) v |= data[i + 2];
+    out[n++] = ALPHABET[(v >> 18) & 63];
+    out[n++] = ALPHABET[(v >> 12) & 63];
+    out[n++] = i + 1 < len ? ALPHABET[(v >> 6) & 63] : '=';
+    out[n++] = i + 2 < len ? ALPHABET[v & 63] : '=';
+  }
+  out[n] = '\0';
+  return n;
+}
+
+// Keys are 24 base64 characters in practice; anything past 64 is refused.
+bool wsAcceptKey(const char* clientKey, char out[29]) {
+  if (!clientKey) return false;
+  size_t keyLen = strlen(clientKey);
+  if (keyLen == 0 || keyLen > 64) return false;
+  uint8_t joined[64 + sizeof(WS_GUID)];
+  memcpy(joined, clientKey, keyLen);
+  memcpy(joined + keyLen, WS_GUID, sizeof(WS_GUID) - 1);
+  uint8_t digest[20];
+  sha1(joined, keyLen + sizeof(WS_GUID) - 1, digest);
+  return base64Encode(digest, sizeof(digest), out, 29) == 28;
+}
+
+// Upgrade response with the computed accept key.
+size_t formatWsHandshake(char* out, size_t cap, const char* clientKey) {
+  char accept[29];
+  if (!wsAcceptKey(clientKey, accept)) return 0;
+  int n = snprintf(out, cap,
+                   "HTTP/1.1 101 Switching Protocols\r\n"
+                   "Upgrade: websocket\r\n"
+                   "Connection: Upgrade\r\n"
+                   "Sec-WebSocket-Accept: %s\r\n"
+                   "\r\n", accept);
+  return (n < 0 || (size_t)n >= cap) ? 0 : (size_t)n;
+}
+
+// 2-byte header, 16-bit extended length above 125 bytes; servers never mask.
+size_t wsEncodeFrame(uint8_t* out, size_t cap, WsOpcode opcode, const uint8_t* payload, size_t len) {
+  if (len > 0xFFFF) return 0;
+  size_t head = len < 126 ? 2 : 4;
+  if (head + len > cap) return 0;
+  out[0] = (uint8_t)(0x80 | opcode);
+  if (len < 126) {
+    out[1] = (uint8_t)len;
+  } else {
+    out[1] = 126;
+    out[2] = (uint8_t)(len >> 8);
+    out[3] = (uint8_t)len;
+  }
+  if (len) memcpy(out + head, payload, len);
+  return head + len;
+}
+
+// Starts waiting for a frame header.
+WsFrameParser::WsFrameParser() { reset(); }
+
+// Clears header, payload and state.
+void WsFrameParser::reset() {
+  headLen_ = 0;
+  headNeed_ = 2;
+  payloadLen_ = 0;
+  payloadGot_ = 0;
+  opcode_ = WS_OP_CONTINUATION;
+  state_ = WS_PARSE_NEED_MORE;
+  closeCode_ = 0;
+}
+
+// Marks the stream as broken with the close code to send.
+void WsFrameParser::fail(uint16_t code) {
+  state_ = WS_PARSE_ERROR;
+  closeCode_ = code;
+}
+
+// Reads FIN/opcode/mask/length from the first two bytes and sizes the rest of the header.
+void WsFrameParser::parseHead() {
+  bool fin = head_[0] & 0x80;
+  opcode_ = (WsOpcode)(head_[0] & 0x0F);
+  bool masked = head_[1] & 0x80;
+  uint8_t len7 = head_[1] & 0x7F;
+  if (!fin || opcode_ == WS_OP_CONTINUATION) { fail(WS_CLOSE_PROTOCOL); return; }
+  if ((head_[0] & 0x70) != 0 || !masked)     { fail(WS_CLOSE_PROTOCOL); return; }
+  if (len7 == 127)                           { fail(WS_CLOSE_TOO_BIG); return; }
+  headNeed_ = 2 + (len7 == 126 ? 2 : 0) + 4;
+}
+
+// Header bytes one at a time (at most 8), then the payload unmasked as it is copied in.
+size_t WsFrameParser::feed(const uint8_t* data, size_t len) {
+  size_t used = 0;
+  while (used < len && state_ == WS_PARSE_NEED_MORE) {
+    if (headLen_ < headNeed_) {
+      head_[headLen_++] = data[used++];
+      if (headLen_ == 2) parseHead();
+      if (state_ != WS_PARSE_NEED_MORE || headLen_ < headNeed_) continue;
+
+      size_t len7 = head_[1] & 0x7F;
+      payloadLen_ = len7 == 126 ? ((size_t)head_[2] << 8 | head_[3]) : len7;
+      if (payloadLen_ > WS_MAX_PAYLOAD) { fail(WS_CLOSE_TOO_BIG); break; }
+      if (payloadLen_ == 0) state_ = WS_PARSE_FRAME;
+      continue;
+    }
+    const uint8_t* mask = head_ + headNeed_ - 4;
+    while (used < len && payloadGot_ < payloadLen_) {
+      payload_[payloadGot_] = data[used++] ^ mask[payloadGot_ & 3];
+      payloadGot_++;
+    }
+    if (payloadGot_ == payloadLen_) state_ = WS_PARSE_FRAME;
+  }
+  return used;
+}
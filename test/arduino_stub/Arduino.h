@@ -21,7 +21,9 @@ inline unsigned long& _stubMillisRef() {
 }
 inline unsigned long millis() { return _stubMillisRef(); }
 inline void stubSetMillis(unsigned long ms) { _stubMillisRef() = ms; }
-inline void delay(unsigned long) {}
+inline unsigned long micros() { return _stubMillisRef() * 1000UL; }
+// delay() advances the fake clock, so a blocking call shows up as loop latency in tests
+inline void delay(unsigned long ms) { _stubMillisRef() += ms; }
 
 // Random
 inline long random(long min, long max) {
@@ -39,15 +41,23 @@ inline int& _stubDigitalReadRef() { static int val = HIGH; return val; }
 inline int digitalRead(uint8_t) { return _stubDigitalReadRef(); }
 inline void stubSetDigitalRead(int v) { _stubDigitalReadRef() = v; }
 inline int analogRead(uint8_t) { return 0; }
+#define CHANGE 0x03
+#define IRAM_ATTR
+inline int digitalPinToInterrupt(uint8_t pin) { return pin; }
+inline void attachInterrupt(int, void (*)(), int) {}
+
+// Serial stub — host tools that drive the firmware for hours of simulated time mute it
+inline bool& _stubSerialMutedRef() { static bool muted = false; return muted; }
+inline void stubSetSerialMuted(bool muted) { _stubSerialMutedRef() = muted; }
 
-// Serial stub
 struct SerialStub {
   void begin(int) {}
-  void print(const char* s) { if (s) fputs(s, stdout); }
-  void print(int v) { printf("%d", v); }
-  void println(const char* s = "") { if (s) puts(s); else puts(""); }
-  void println(int v) { printf("%d\n", v); }
+  void print(const char* s) { if (s && !_stubSerialMutedRef()) fputs(s, stdout); }
+  void print(int v) { if (!_stubSerialMutedRef()) printf("%d", v); }
+  void println(const char* s = "") { if (!_stubSerialMutedRef()) puts(s ? s : ""); }
+  void println(int v) { if (!_stubSerialMutedRef()) printf("%d\n", v); }
   void printf(const char* fmt, ...) {
+    if (_stubSerialMutedRef()) return;
     va_list args;
     va_start(args, fmt);
     vprintf(fmt, args);
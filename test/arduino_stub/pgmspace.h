@@ -0,0 +1,10 @@
+// Minimal pgmspace.h stub for native testing — flash and RAM are the same on the host.
+
+#ifndef PGMSPACE_H
+#define PGMSPACE_H
+
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+
+#endif // PGMSPACE_H
@@ -12,6 +12,33 @@
 #include "input.h"
 #include "personality.h"
 #include "runtime_config.h"
+#include "scheduler.h"
+#include "transition.h"
+#include "framebuffer_canvas.h"
+#include "frame_codec.h"
+#include "frame_cache.h"
+#include "easing.h"
+#include "face.h"
+#include "frame_handoff.h"
+#include "metrics.h"
+#include "web_ui.h"
+#include "web_ui_gz.h"
+#include "sse.h"
+#include "http_proto.h"
+#include "ws_frame.h"
+#include "control_proto.h"
+#include "oled_mirror.h"
+#include "sta_link.h"
+#include "boot_profile.h"
+#include "clock_service.h"
+#include "edge_queue.h"
+#include "touch_decoder.h"
+#include "command_queue.h"
+#include "ble_proto.h"
+#include "script_player.h"
+#include "tone_sequencer.h"
+#include "prng.h"
+#include "alias_table.h"
 #include "mock_canvas.h"
 
 // ===== TEST HELPERS =====
@@ -27,24 +54,24 @@ void stubEmotionChange(EmotionState f, EmotionState t) {
 
 static void registerTestEmotions() {
   emotionRegistry = EmotionRegistry();
-  emotionRegistry.add({EMOTION_IDLE,      "IDLE",      60, 55, LOOP_PINGPONG, true,  drawIdle});
-  emotionRegistry.add({EMOTION_BLINK,     "BLINK",      1,  0, LOOP_RESTART,  false, drawBlink});
-  emotionRegistry.add({EMOTION_HAPPY,     "HAPPY",     50, 35, LOOP_RESTART,  true,  drawHappy});
+  emotionRegistry.add({EMOTION_IDLE,      "IDLE",      60, 55, LOOP_PINGPONG, true,  drawIdle, &FACE_IDLE});
+  emotionRegistry.add({EMOTION_BLINK,     "BLINK",      1,  0, LOOP_RESTART,  false, drawBlink, &FACE_BLINK});
+  emotionRegistry.add({EMOTION_HAPPY,     "HAPPY",     50, 35, LOOP_RESTART,  true,  drawHappy, &FACE_HAPPY});
   emotionRegistry.add({EMOTION_SLEEPY,    "SLEEPY",    59, 50, LOOP_RESTART,  false, drawSleepy});
-  emotionRegistry.add({EMOTION_EXCITED,   "EXCITED",   40, 25, LOOP_RESTART,  true,  drawExcited});
-  emotionRegistry.add({EMOTION_SAD,       "SAD",       56, 48, LOOP_RESTART,  true,  drawSad});
-  emotionRegistry.add({EMOTION_ANGRY,     "ANGRY",     56, 32, LOOP_RESTART,  true,  drawAngry});
+  emotionRegistry.add({EMOTION_EXCITED,   "EXCITED",   40, 25, LOOP_RESTART,  true,  drawExcited, &FACE_EXCITED});
+  emotionRegistry.add({EMOTION_SAD,       "SAD",       56, 48, LOOP_RESTART,  true,  drawSad, &FACE_SAD});
+  emotionRegistry.add({EMOTION_ANGRY,     "ANGRY",     56, 32, LOOP_RESTART,  true,  drawAngry, &FACE_ANGRY});
   emotionRegistry.add({EMOTION_CONFUSED,  "CONFUSED",  44, 45, LOOP_PINGPONG, true,  drawConfused});
   emotionRegistry.add({EMOTION_THINKING,  "THINKING",  44, 45, LOOP_PINGPONG, true,  drawThinking});
   emotionRegistry.add({EMOTION_LOVE,      "LOVE",      44, 48, LOOP_PINGPONG, true,  drawLove});
-  emotionRegistry.add({EMOTION_SURPRISED, "SURPRISED", 44, 30, LOOP_RESTART,  true,  drawSurprised});
+  emotionRegistry.add({EMOTION_SURPRISED, "SURPRISED", 44, 30, LOOP_RESTART,  true,  drawSurprised, &FACE_SURPRISED});
   emotionRegistry.add({EMOTION_DEAD,      "DEAD",      70, 55, LOOP_RESTART,  false, drawDead});
-  emotionRegistry.add({EMOTION_BORED,     "BORED",     60, 65, LOOP_PINGPONG, true,  drawBored});
-  emotionRegistry.add({EMOTION_SHY,       "SHY",       50, 60, LOOP_RESTART,  true,  drawShy});
-  emotionRegistry.add({EMOTION_NEEDY,     "NEEDY",     54, 65, LOOP_PINGPONG, true,  drawNeedy});
-  emotionRegistry.add({EMOTION_CONTENT,   "CONTENT",   60, 90, LOOP_PINGPONG, true,  drawContent});
+  emotionRegistry.add({EMOTION_BORED,     "BORED",     60, 65, LOOP_PINGPONG, true,  drawBored, &FACE_BORED});
+  emotionRegistry.add({EMOTION_SHY,       "SHY",       50, 60, LOOP_RESTART,  true,  drawShy, &FACE_SHY});
+  emotionRegistry.add({EMOTION_NEEDY,     "NEEDY",     54, 65, LOOP_PINGPONG, true,  drawNeedy, &FACE_NEEDY});
+  emotionRegistry.add({EMOTION_CONTENT,   "CONTENT",   60, 90, LOOP_PINGPONG, true,  drawContent, &FACE_CONTENT});
   emotionRegistry.add({EMOTION_PLAYFUL,   "PLAYFUL",   48, 40, LOOP_RESTART,  true,  drawPlayful});
-  emotionRegistry.add({EMOTION_GRUMPY,    "GRUMPY",    56, 45, LOOP_PINGPONG, true,  drawGrumpy});
+  emotionRegistry.add({EMOTION_GRUMPY,    "GRUMPY",    56, 45, LOOP_PINGPONG, true,  drawGrumpy, &FACE_GRUMPY});
 }
 
 void setUp() {
@@ -275,6 +302,965 @@ void test_tick_pingpong_reverses_at_ends() {
   TEST_ASSERT_EQUAL(120, drawCount);
 }
 
+void test_next_deadline_matches_frame_delay() {
+  MockCanvas canvas;
+  animationManager.resetAnimation(EMOTION_EXCITED);
+  stubSetMillis(100);
+  animationManager.tick(EMOTION_EXCITED, canvas);
+  TEST_ASSERT_EQUAL(125, animationManager.nextDeadline(EMOTION_EXCITED));  // EXCITED: 25ms
+}
+
+void test_tick_stays_on_deadline_grid() {
+  // A frame drawn 3ms late must not push every later frame back by 3ms.
+  MockCanvas canvas;
+  animationManager.resetAnimation(EMOTION_EXCITED);
+  stubSetMillis(100);
+  animationManager.tick(EMOTION_EXCITED, canvas);
+  stubSetMillis(128);
+  TEST_ASSERT_TRUE(animationManager.tick(EMOTION_EXCITED, canvas));
+  TEST_ASSERT_EQUAL(150, animationManager.nextDeadline(EMOTION_EXCITED));
+}
+
+void test_tick_counts_missed_deadlines() {
+  MockCanvas canvas;
+  animationManager.resetFrameStats();
+  animationManager.resetAnimation(EMOTION_ANGRY);  // 32ms
+  stubSetMillis(1000);
+  animationManager.tick(EMOTION_ANGRY, canvas);    // first frame — nothing to miss
+  stubSetMillis(1032);
+  animationManager.tick(EMOTION_ANGRY, canvas);    // on time
+  stubSetMillis(1164);
+  animationManager.tick(EMOTION_ANGRY, canvas);    // 100ms late — missed, resyncs to now
+
+  const FrameStats& st = animationManager.getFrameStats(EMOTION_ANGRY);
+  TEST_ASSERT_EQUAL(3, st.frames);
+  TEST_ASSERT_EQUAL(1, st.missed);
+  TEST_ASSERT_EQUAL(100, st.maxLateMs);
+  TEST_ASSERT_EQUAL(1196, animationManager.nextDeadline(EMOTION_ANGRY));
+}
+
+// ===== SCHEDULER TESTS =====
+
+static int schedTaskRuns = 0;
+static unsigned long schedEvery20(unsigned long now) { schedTaskRuns++; return now + 20; }
+
+static MockCanvas schedCanvas;
+static unsigned long schedRenderExcited(unsigned long now) {
+  schedCanvas.reset();
+  animationManager.tick(EMOTION_EXCITED, schedCanvas);
+  return animationManager.nextDeadline(EMOTION_EXCITED);
+}
+
+void test_scheduler_runs_task_only_when_due() {
+  Scheduler s;
+  schedTaskRuns = 0;
+  int id = s.add("t", schedEvery20, 0);
+  TEST_ASSERT_EQUAL(0, id);
+  TEST_ASSERT_EQUAL(1, s.runDue(0));
+  TEST_ASSERT_EQUAL(0, s.runDue(19));
+  TEST_ASSERT_EQUAL(1, s.runDue(20));
+  TEST_ASSERT_EQUAL(2, schedTaskRuns);
+  TEST_ASSERT_EQUAL(40, s.nextDeadline());
+}
+
+void test_scheduler_wake_pulls_deadline_forward() {
+  Scheduler s;
+  schedTaskRuns = 0;
+  int id = s.add("t", schedEvery20, 0);
+  s.runDue(0);
+  s.wake(id, 5);
+  TEST_ASSERT_EQUAL(5, s.getDue(id));
+  TEST_ASSERT_EQUAL(1, s.runDue(5));
+  TEST_ASSERT_EQUAL(2, (int)s.getRuns(id));
+}
+
+void test_scheduler_rejects_overflow() {
+  Scheduler s;
+  for (int i = 0; i < Scheduler::MAX_TASKS; i++) {
+    TEST_ASSERT_EQUAL(i, s.add("t", schedEvery20, 0));
+  }
+  TEST_ASSERT_EQUAL(-1, s.add("t", schedEvery20, 0));
+  TEST_ASSERT_EQUAL(-1, Scheduler().add("null", nullptr, 0));
+}
+
+void test_scheduler_meets_sub_50ms_frame_delay() {
+  // Old loop() gated everything at 50ms — EXCITED (25ms here) played at half speed.
+  // Polling the scheduler every 1ms for one second must hit every 25ms deadline.
+  Scheduler s;
+  animationManager.resetAnimation(EMOTION_EXCITED);
+  animationManager.resetFrameStats();
+  s.add("render", schedRenderExcited, 0);
+  for (unsigned long t = 0; t <= 1000; t++) {
+    stubSetMillis(t);
+    s.runDue(t);
+  }
+  const FrameStats& st = animationManager.getFrameStats(EMOTION_EXCITED);
+  TEST_ASSERT_EQUAL(40, st.frames);
+  TEST_ASSERT_EQUAL(0, st.missed);
+}
+
+// ===== TRANSITION PLAYER TESTS =====
+
+static int transitionDraws = 0;
+static TransitionResult stubTransitionDraw(int frame, EmotionState, EmotionState) {
+  transitionDraws++;
+  return (frame >= TransitionPlayer::FRAME_COUNT - 1) ? TR_COMPLETE : TR_DREW_FRAME;
+}
+
+// Drives the active transition one step, the way main.cpp's render task does.
+static unsigned long transitionRenderTask(unsigned long now) {
+  if (!emotionManager.isTransitionActive()) return now + 10;
+  TransitionStep step = transitionPlayer.update(emotionManager.getTransitionFrame(),
+                                                emotionManager.getCurrentEmotion(),
+                                                emotionManager.getTargetEmotion(), now);
+  if (step == TS_COMPLETE) {
+    emotionManager.completeTransition();
+    return now;
+  }
+  if (step == TS_ADVANCE) emotionManager.advanceTransition();
+  return transitionPlayer.nextDeadline();
+}
+
+static int webPolls = 0;
+static unsigned long webPollTask(unsigned long now) { webPolls++; return now; }
+
+void test_transition_player_holds_each_frame() {
+  TransitionPlayer p;
+  transitionDraws = 0;
+  p.setDrawFn(stubTransitionDraw);
+  TEST_ASSERT_EQUAL(TS_ADVANCE, p.update(0, EMOTION_IDLE, EMOTION_HAPPY, 1000));
+  TEST_ASSERT_EQUAL(1200, p.nextDeadline());  // frame 0 holds 200ms
+  TEST_ASSERT_EQUAL(TS_WAITING, p.update(1, EMOTION_IDLE, EMOTION_HAPPY, 1199));
+  TEST_ASSERT_EQUAL(TS_ADVANCE, p.update(1, EMOTION_IDLE, EMOTION_HAPPY, 1200));
+  TEST_ASSERT_EQUAL(1300, p.nextDeadline());  // frame 1 holds 100ms
+  TEST_ASSERT_EQUAL(2, transitionDraws);
+}
+
+void test_transition_player_restart_draws_immediately() {
+  TransitionPlayer p;
+  transitionDraws = 0;
+  p.setDrawFn(stubTransitionDraw);
+  p.update(0, EMOTION_IDLE, EMOTION_HAPPY, 0);
+  p.update(1, EMOTION_IDLE, EMOTION_HAPPY, 200);
+  // Retarget mid-blink: EmotionManager restarts at frame 0 — no waiting for frame 1's hold
+  TEST_ASSERT_EQUAL(TS_ADVANCE, p.update(0, EMOTION_IDLE, EMOTION_SAD, 210));
+  TEST_ASSERT_EQUAL(3, transitionDraws);
+}
+
+void test_transition_completes_after_all_frame_holds() {
+  transitionPlayer.reset();
+  transitionPlayer.setDrawFn(stubTransitionDraw);
+  Scheduler s;
+  s.add("render", transitionRenderTask, 0);
+  emotionManager.setTargetEmotion(EMOTION_HAPPY);
+  unsigned long t = 0;
+  for (; t < 2000 && emotionManager.isTransitionActive(); t++) {
+    stubSetMillis(t);
+    s.runDue(t);
+  }
+  TEST_ASSERT_EQUAL(EMOTION_HAPPY, emotionManager.getCurrentEmotion());
+  TEST_ASSERT_EQUAL(1041, t);  // 200+100+100+200+120+120+200ms of holds, then the loop's final t++
+}
+
+void test_transition_keeps_loop_latency_bounded() {
+  // The old transition delay()ed up to 200ms per frame inside one loop() pass.
+  // Every pass must now return without advancing the clock, and the web task
+  // must keep running on every pass for the whole blink.
+  transitionPlayer.reset();
+  transitionPlayer.setDrawFn(stubTransitionDraw);
+  Scheduler s;
+  s.add("web", webPollTask, 0);
+  s.add("render", transitionRenderTask, 0);
+  webPolls = 0;
+  emotionManager.setTargetEmotion(EMOTION_SAD);
+
+  unsigned long worstPassMs = 0;
+  for (unsigned long t = 0; t < 1200; t++) {
+    stubSetMillis(t);
+    s.runDue(t);
+    unsigned long pass = millis() - t;
+    if (pass > worstPassMs) worstPassMs = pass;
+  }
+  TEST_ASSERT_EQUAL(0, worstPassMs);
+  TEST_ASSERT_EQUAL(1200, webPolls);
+  TEST_ASSERT_FALSE(emotionManager.isTransitionActive());
+  TEST_ASSERT_EQUAL(EMOTION_SAD, lastCompletedEmotion);
+}
+
+// ===== FRAMEBUFFER CANVAS TESTS =====
+
+void test_framebuffer_uses_ssd1306_page_layout() {
+  FrameBufferCanvas fb;
+  fb.fillRect(0, 0, 2, 9, COLOR_WHITE);
+  const uint8_t* buf = fb.getBuffer();
+  TEST_ASSERT_EQUAL_HEX8(0xFF, buf[0]);    // column 0, page 0: rows 0-7
+  TEST_ASSERT_EQUAL_HEX8(0xFF, buf[1]);
+  TEST_ASSERT_EQUAL_HEX8(0x01, buf[128]);  // column 0, page 1: row 8 only
+  TEST_ASSERT_EQUAL_HEX8(0x00, buf[2]);
+  TEST_ASSERT_EQUAL(18, fb.countLitPixels());
+  TEST_ASSERT_EQUAL(18, (int)fb.getPixelWrites());
+}
+
+void test_framebuffer_black_clears_pixels() {
+  FrameBufferCanvas fb;
+  fb.fillCircle(64, 32, 10, COLOR_WHITE);
+  fb.fillCircle(64, 32, 3, COLOR_BLACK);  // pupil
+  TEST_ASSERT_TRUE(fb.getPixel(64, 24));
+  TEST_ASSERT_FALSE(fb.getPixel(64, 32));
+  fb.clear();
+  TEST_ASSERT_EQUAL(0, fb.countLitPixels());
+  TEST_ASSERT_EQUAL(0, (int)fb.getPixelWrites());
+}
+
+void test_framebuffer_clips_offscreen_primitives() {
+  FrameBufferCanvas fb;
+  fb.fillCircle(-5, -5, 20, COLOR_WHITE);
+  fb.drawLine(-10, 70, 200, -40, COLOR_WHITE);
+  fb.fillTriangle(120, 60, 140, 70, 110, 90, COLOR_WHITE);
+  fb.fillRoundRect(100, 50, 60, 30, 7, COLOR_WHITE);
+  TEST_ASSERT_TRUE(fb.getPixel(0, 0));
+  TEST_ASSERT_TRUE(fb.getPixel(127, 63));
+  TEST_ASSERT_FALSE(fb.getPixel(128, 0));  // reads past the edge are dark
+}
+
+void test_framebuffer_circle_outline_is_symmetric() {
+  FrameBufferCanvas fb;
+  fb.drawCircle(64, 32, 7, COLOR_WHITE);
+  for (int dy = -7; dy <= 7; dy++) {
+    for (int dx = -7; dx <= 7; dx++) {
+      TEST_ASSERT_EQUAL(fb.getPixel(64 + dx, 32 + dy), fb.getPixel(64 - dx, 32 - dy));
+      TEST_ASSERT_EQUAL(fb.getPixel(64 + dx, 32 + dy), fb.getPixel(64 + dy, 32 + dx));
+    }
+  }
+  TEST_ASSERT_TRUE(fb.getPixel(64, 25));
+  TEST_ASSERT_FALSE(fb.getPixel(64, 32));
+}
+
+void test_framebuffer_text_renders_and_advances() {
+  FrameBufferCanvas fb;
+  fb.setTextSize(1);
+  fb.setCursor(0, 0);
+  fb.print("I");
+  int lit = fb.countLitPixels();
+  TEST_ASSERT_EQUAL(11, lit);             // 'I' columns 0x41,0x7F,0x41 → 2 + 7 + 2
+  TEST_ASSERT_TRUE(fb.getPixel(2, 0));    // stem top
+  TEST_ASSERT_TRUE(fb.getPixel(2, 6));    // stem bottom
+  fb.print("I");                          // next cell starts 6px right
+  TEST_ASSERT_TRUE(fb.getPixel(8, 3));
+  fb.setTextSize(2);
+  fb.setCursor(0, 20);
+  fb.print(".");
+  TEST_ASSERT_EQUAL(lit * 2 + 16, fb.countLitPixels());  // '.' is 4 pixels → 4 squares of 2x2
+}
+
+void test_framebuffer_idle_frame_is_pixel_exact() {
+  FrameBufferCanvas fb;
+  drawIdle(fb, 0, nullptr);
+  // Left eye: fillRoundRect(26, 17, 24, 22, r=7)
+  TEST_ASSERT_TRUE(fb.getPixel(38, 28));
+  TEST_ASSERT_TRUE(fb.getPixel(26, 28));
+  TEST_ASSERT_TRUE(fb.getPixel(49, 28));
+  TEST_ASSERT_FALSE(fb.getPixel(50, 28));
+  TEST_ASSERT_FALSE(fb.getPixel(26, 17));  // rounded corner
+  TEST_ASSERT_TRUE(fb.getPixel(38, 17));
+  TEST_ASSERT_FALSE(fb.getPixel(38, 16));
+  // Mouth: fillRoundRect(57, 52, 14, 5, r=2)
+  TEST_ASSERT_TRUE(fb.getPixel(64, 54));
+  TEST_ASSERT_FALSE(fb.getPixel(57, 52));
+  // Nothing between the eyes
+  TEST_ASSERT_FALSE(fb.getPixel(64, 28));
+}
+
+void test_framebuffer_renders_every_emotion_frame() {
+  // Every registered frame rasterizes to something visible, within the panel.
+  FrameBufferCanvas fb;
+  EmotionState ids[EmotionRegistry::MAX_EMOTIONS];
+  int n = emotionRegistry.getCyclable(ids, EmotionRegistry::MAX_EMOTIONS);
+  TEST_ASSERT_TRUE(n > 0);
+  for (int i = 0; i < n; i++) {
+    const EmotionDef* def = emotionRegistry.get(ids[i]);
+    for (int f = 0; f < def->frameCount; f++) {
+      fb.clear();
+      def->drawFrame(fb, f, nullptr);
+      TEST_ASSERT_TRUE(fb.countLitPixels() > 0);
+      TEST_ASSERT_TRUE(fb.getPixelWrites() > 0);
+    }
+  }
+}
+
+// ===== DIRTY RECT / PARTIAL FLUSH TESTS =====
+
+void test_dirty_rect_identical_frames_report_clean() {
+  uint8_t a[FrameBufferCanvas::BUFFER_SIZE] = {0};
+  uint8_t b[FrameBufferCanvas::BUFFER_SIZE] = {0};
+  DirtyRect r;
+  TEST_ASSERT_FALSE(findDirtyRect(a, b, 128, 8, r));
+}
+
+void test_dirty_rect_bounds_changed_bytes() {
+  uint8_t a[FrameBufferCanvas::BUFFER_SIZE] = {0};
+  uint8_t b[FrameBufferCanvas::BUFFER_SIZE] = {0};
+  a[2 * 128 + 40] = 0x10;  // page 2, column 40
+  a[5 * 128 + 90] = 0x01;  // page 5, column 90
+  DirtyRect r;
+  TEST_ASSERT_TRUE(findDirtyRect(a, b, 128, 8, r));
+  TEST_ASSERT_EQUAL(40, r.col0);
+  TEST_ASSERT_EQUAL(90, r.col1);
+  TEST_ASSERT_EQUAL(2, r.page0);
+  TEST_ASSERT_EQUAL(5, r.page1);
+  TEST_ASSERT_EQUAL(51 * 4, r.byteCount());
+
+  copyDirtyRect(b, a, 128, r);
+  TEST_ASSERT_FALSE(findDirtyRect(a, b, 128, 8, r));
+}
+
+void test_flush_skips_identical_frame() {
+  FrameBufferCanvas fb;
+  drawIdle(fb, 0, nullptr);
+  fb.flush();
+  uint32_t sent = fb.getFlushedBytes();
+  fb.clear();
+  drawIdle(fb, 0, nullptr);
+  fb.flush();
+  DirtyRect r;
+  TEST_ASSERT_FALSE(fb.getLastDirtyRect(r));
+  TEST_ASSERT_EQUAL(1, (int)fb.getSkippedFlushes());
+  TEST_ASSERT_EQUAL(sent, fb.getFlushedBytes());
+}
+
+void test_idle_breathing_flushes_small_window() {
+  // IDLE moves the eyes by 1px per breath — a full cycle must send a fraction
+  // of 60 whole frames, and the first (full) frame bounds the face region.
+  FrameBufferCanvas fb;
+  for (int frame = 0; frame < 60; frame++) {
+    fb.clear();
+    drawIdle(fb, frame, nullptr);
+    fb.flush();
+  }
+  uint32_t fullFrames = 60u * FrameBufferCanvas::BUFFER_SIZE;
+  TEST_ASSERT_TRUE(fb.getFlushedBytes() * 10 < fullFrames);
+  TEST_ASSERT_TRUE(fb.getSkippedFlushes() > 0);
+}
+
+// ===== FRAME CACHE TESTS =====
+
+void test_frame_delta_roundtrips_both_directions() {
+  uint8_t a[FrameBufferCanvas::BUFFER_SIZE] = {0};
+  uint8_t b[FrameBufferCanvas::BUFFER_SIZE] = {0};
+  for (int i = 0; i < 300; i++) a[(i * 37) % 1024] = (uint8_t)(i * 13 + 1);
+  for (int i = 500; i < 700; i++) b[i] = 0xFF;  // long literal run (> 128)
+
+  static uint8_t enc[1100];
+  size_t len = 0;
+  TEST_ASSERT_TRUE(encodeFrameDelta(b, a, sizeof(a), enc, sizeof(enc), len));
+  TEST_ASSERT_TRUE(len <= frameDeltaBound(sizeof(a)));
+
+  uint8_t buf[FrameBufferCanvas::BUFFER_SIZE];
+  memcpy(buf, a, sizeof(buf));
+  TEST_ASSERT_TRUE(applyFrameDelta(enc, len, buf, sizeof(buf)));
+  TEST_ASSERT_EQUAL_MEMORY(b, buf, sizeof(buf));
+  TEST_ASSERT_TRUE(applyFrameDelta(enc, len, buf, sizeof(buf)));  // XOR steps back
+  TEST_ASSERT_EQUAL_MEMORY(a, buf, sizeof(buf));
+
+  TEST_ASSERT_TRUE(encodeFrameDelta(a, a, sizeof(a), enc, sizeof(enc), len));
+  TEST_ASSERT_EQUAL(0, (int)len);  // identical frame costs nothing
+  TEST_ASSERT_FALSE(encodeFrameDelta(b, a, sizeof(a), enc, 16, len));
+}
+
+void test_frame_cache_matches_live_render() {
+  // Baked frames must be bit-identical to running the draw functions. A failure
+  // here means a DrawFrameFn changed: run `pio run -e framegen -t exec`.
+  TEST_ASSERT_EQUAL(emotionRegistry.count(), frameCache.begin());
+  static FrameBufferCanvas live;
+  static uint8_t fb[FRAME_CACHE_FRAME_BYTES];
+  for (int id = 0; id < EmotionRegistry::MAX_EMOTIONS; id++) {
+    const EmotionDef* def = emotionRegistry.get((EmotionState)id);
+    if (!def) continue;
+    for (int frame = 0; frame < def->frameCount; frame++) {
+      live.clear();
+      def->drawFrame(live, frame, nullptr);
+      TEST_ASSERT_TRUE(frameCache.render(def->id, frame, fb, frame > 0));
+      TEST_ASSERT_EQUAL_MEMORY_MESSAGE(live.getBuffer(), fb, sizeof(fb), def->name);
+    }
+    // Random access (cold) lands on the same pixels.
+    int mid = def->frameCount / 2;
+    live.clear();
+    def->drawFrame(live, mid, nullptr);
+    TEST_ASSERT_TRUE(frameCache.render(def->id, mid, fb, false));
+    TEST_ASSERT_EQUAL_MEMORY_MESSAGE(live.getBuffer(), fb, sizeof(fb), def->name);
+  }
+}
+
+void test_frame_cache_drives_pingpong_without_draw_calls() {
+  frameCache.begin();
+  AnimationManager anim;
+  anim.setFrameSource([](EmotionState e, int frame, uint8_t* buf, bool continuing) {
+    return frameCache.render(e, frame, buf, continuing);
+  });
+  static FrameBufferCanvas cached;
+  static FrameBufferCanvas live;
+  uint32_t replays = frameCache.getKeyframeReplays();
+  uint32_t steps = frameCache.getDeltaSteps();
+
+  // Full IDLE pingpong cycle: 0..59..1 = 118 frames.
+  unsigned long t = 1000;
+  for (int i = 0; i < 118; i++, t += 55) {
+    stubSetMillis(t);
+    int frame = (i < 60) ? i : 118 - i;
+    TEST_ASSERT_TRUE(anim.tick(EMOTION_IDLE, cached));
+    live.clear();
+    drawIdle(live, frame, nullptr);
+    TEST_ASSERT_EQUAL_MEMORY(live.getBuffer(), cached.getBuffer(), FrameBufferCanvas::BUFFER_SIZE);
+  }
+  TEST_ASSERT_EQUAL(0, (int)cached.getPixelWrites());  // no geometry was run
+  TEST_ASSERT_EQUAL(1, (int)(frameCache.getKeyframeReplays() - replays));
+  TEST_ASSERT_EQUAL(117, (int)(frameCache.getDeltaSteps() - steps));
+}
+
+void test_frame_cache_skips_stale_frame_count() {
+  emotionRegistry = EmotionRegistry();
+  emotionRegistry.add({EMOTION_IDLE, "IDLE", 61, 55, LOOP_PINGPONG, true, drawIdle});
+  emotionRegistry.add({EMOTION_SAD,  "SAD",  56, 80, LOOP_RESTART,  true, drawSad});
+  TEST_ASSERT_EQUAL(1, frameCache.begin());
+  TEST_ASSERT_FALSE(frameCache.has(EMOTION_IDLE));
+  TEST_ASSERT_TRUE(frameCache.has(EMOTION_SAD));
+  static uint8_t fb[FRAME_CACHE_FRAME_BYTES];
+  TEST_ASSERT_FALSE(frameCache.render(EMOTION_IDLE, 0, fb, false));
+  TEST_ASSERT_TRUE(frameCache.flashBytes(EMOTION_SAD) > 0);
+}
+
+// ===== FRAME HANDOFF TESTS =====
+
+void test_handoff_take_is_empty_until_published() {
+  FrameHandoff h;
+  TEST_ASSERT_NULL(h.take());
+  static uint8_t frame[FrameHandoff::FRAME_BYTES];
+  memset(frame, 0xA5, sizeof(frame));
+  h.publish(frame);
+  const uint8_t* got = h.take();
+  TEST_ASSERT_NOT_NULL(got);
+  TEST_ASSERT_EQUAL_MEMORY(frame, got, sizeof(frame));
+  TEST_ASSERT_NULL(h.take());  // nothing new since
+}
+
+void test_handoff_keeps_newest_and_counts_dropped() {
+  FrameHandoff h;
+  static uint8_t frame[FrameHandoff::FRAME_BYTES];
+  for (int i = 1; i <= 3; i++) {
+    memset(frame, i, sizeof(frame));
+    h.publish(frame);
+  }
+  const uint8_t* got = h.take();
+  TEST_ASSERT_NOT_NULL(got);
+  TEST_ASSERT_EQUAL(3, got[0]);
+  TEST_ASSERT_EQUAL(3, (int)h.getPublished());
+  TEST_ASSERT_EQUAL(2, (int)h.getDropped());
+  TEST_ASSERT_EQUAL(1, (int)h.getTaken());
+}
+
+void test_handoff_never_writes_the_frame_being_sent() {
+  // While the display task holds a frame, any number of publishes must leave it intact.
+  FrameHandoff h;
+  static uint8_t frame[FrameHandoff::FRAME_BYTES];
+  memset(frame, 0x11, sizeof(frame));
+  h.publish(frame);
+  const uint8_t* sending = h.take();
+  for (int i = 0; i < 5; i++) {
+    memset(frame, 0x20 + i, sizeof(frame));
+    h.publish(frame);
+    TEST_ASSERT_EQUAL(0x11, sending[0]);
+    TEST_ASSERT_EQUAL(0x11, sending[FrameHandoff::FRAME_BYTES - 1]);
+  }
+  TEST_ASSERT_EQUAL(0x24, h.take()[0]);
+}
+
+// ===== METRICS TESTS =====
+
+void test_metrics_buckets_cover_every_duration() {
+  const uint32_t samples[] = {0, 7, 8, 31, 32, 47, 48, 63, 64, 100, 1000, 24575, 24576, 1000000};
+  for (unsigned i = 0; i < sizeof(samples) / sizeof(samples[0]); i++) {
+    int b = Metrics::bucketFor(samples[i]);
+    TEST_ASSERT_TRUE(samples[i] <= Metrics::bucketUpperUs(b));
+    if (b > 0) TEST_ASSERT_TRUE(samples[i] > Metrics::bucketUpperUs(b - 1));
+  }
+  TEST_ASSERT_EQUAL(Metrics::BUCKETS - 1, Metrics::bucketFor(0xFFFFFFFFu));
+}
+
+void test_metrics_summary_min_avg_p99_max() {
+  metrics.reset();
+  for (int i = 0; i < 99; i++) metrics.record(METRIC_DRAW, EMOTION_HAPPY, 100);
+  metrics.record(METRIC_DRAW, EMOTION_HAPPY, 5100);
+  MetricSummary m = metrics.summary(METRIC_DRAW, EMOTION_HAPPY);
+  TEST_ASSERT_EQUAL(100, (int)m.count);
+  TEST_ASSERT_EQUAL(100, (int)m.minUs);
+  TEST_ASSERT_EQUAL(150, (int)m.avgUs);
+  TEST_ASSERT_EQUAL(5100, (int)m.maxUs);
+  // The single outlier is the top 1% — p99 stays in the 100us bucket
+  TEST_ASSERT_TRUE(m.p99Us >= 100 && m.p99Us < 128);
+  TEST_ASSERT_EQUAL(0, (int)metrics.summary(METRIC_FLUSH, EMOTION_HAPPY).count);
+}
+
+void test_metrics_counts_frames_over_budget() {
+  metrics.reset();
+  metrics.record(METRIC_FRAME, EMOTION_HAPPY, 30000);  // HAPPY budget is 35ms
+  metrics.record(METRIC_FRAME, EMOTION_HAPPY, 36000);
+  TEST_ASSERT_EQUAL(1, (int)metrics.overBudget(EMOTION_HAPPY));
+}
+
+void test_metrics_tick_records_draw_and_flush() {
+  metrics.reset();
+  MockCanvas canvas;
+  animationManager.resetAnimation(EMOTION_IDLE);
+  stubSetMillis(56);
+  animationManager.tick(EMOTION_IDLE, canvas);
+  TEST_ASSERT_EQUAL(1, (int)metrics.summary(METRIC_DRAW, EMOTION_IDLE).count);
+  TEST_ASSERT_EQUAL(1, (int)metrics.summary(METRIC_FLUSH, EMOTION_IDLE).count);
+  TEST_ASSERT_EQUAL(1, (int)metrics.summary(METRIC_FRAME, EMOTION_IDLE).count);
+}
+
+void test_metrics_json_lists_sections() {
+  metrics.reset();
+  char buf[384];
+  TEST_ASSERT_EQUAL(0, (int)metrics.writeEmotionJson(EMOTION_SAD, buf, sizeof(buf)));
+  metrics.record(METRIC_HTTP, EMOTION_SAD, 2000);
+  size_t n = metrics.writeEmotionJson(EMOTION_SAD, buf, sizeof(buf));
+  TEST_ASSERT_EQUAL(strlen(buf), n);
+  TEST_ASSERT_NOT_NULL(strstr(buf, "\"name\":\"SAD\""));
+  TEST_ASSERT_NOT_NULL(strstr(buf, "\"http\":[1,2000,2000,2000,2000]"));
+  TEST_ASSERT_EQUAL('}', buf[n - 1]);
+  TEST_ASSERT_EQUAL(0, (int)metrics.writeEmotionJson(EMOTION_SAD, buf, 20));  // too small
+}
+
+// ===== WEB UI / EVENT STREAM TESTS =====
+
+// FNV-1a 32-bit, as used by tools/gzip_web_ui.py.
+static uint32_t fnv1a32(const uint8_t* data, size_t len) {
+  uint32_t h = 0x811C9DC5u;
+  for (size_t i = 0; i < len; i++) h = (h ^ data[i]) * 0x01000193u;
+  return h;
+}
+
+void test_web_ui_gzip_blob_matches_page() {
+  // A failure here means web_ui.h changed: run `python3 tools/gzip_web_ui.py`.
+  TEST_ASSERT_EQUAL_HEX32(WEB_UI_GZ_SOURCE_HASH,
+                          fnv1a32((const uint8_t*)WEB_UI_HTML, strlen(WEB_UI_HTML)));
+}
+
+void test_web_ui_gzip_blob_is_valid_and_small() {
+  TEST_ASSERT_EQUAL_HEX8(0x1f, WEB_UI_GZ[0]);
+  TEST_ASSERT_EQUAL_HEX8(0x8b, WEB_UI_GZ[1]);
+  TEST_ASSERT_EQUAL_HEX8(0x08, WEB_UI_GZ[2]);  // deflate
+  // gzip trailer ends with the uncompressed size (little-endian)
+  const uint8_t* t = WEB_UI_GZ + WEB_UI_GZ_LEN - 4;
+  uint32_t isize = t[0] | (t[1] << 8) | (t[2] << 16) | ((uint32_t)t[3] << 24);
+  TEST_ASSERT_EQUAL((uint32_t)strlen(WEB_UI_HTML), isize);
+  TEST_ASSERT_TRUE(WEB_UI_GZ_LEN * 3 < isize);
+
+  char etag[16];
+  snprintf(etag, sizeof(etag), "\"%08x\"", (unsigned)fnv1a32(WEB_UI_GZ, WEB_UI_GZ_LEN));
+  TEST_ASSERT_EQUAL_STRING(WEB_UI_GZ_ETAG, etag);
+}
+
+void test_sse_event_framing() {
+  char buf[128];
+  size_t n = formatSseEvent(buf, sizeof(buf), "emotion", "{\"emotion\":2}");
+  TEST_ASSERT_EQUAL_STRING("event: emotion\ndata: {\"emotion\":2}\n\n", buf);
+  TEST_ASSERT_EQUAL(strlen(buf), n);
+  // Multi-line payloads become one data: line each
+  formatSseEvent(buf, sizeof(buf), nullptr, "a\nb");
+  TEST_ASSERT_EQUAL_STRING("data: a\ndata: b\n\n", buf);
+}
+
+void test_sse_event_never_truncates() {
+  char buf[24];
+  TEST_ASSERT_EQUAL(0, (int)formatSseEvent(buf, sizeof(buf), "status", "{\"batteryVoltage\":3.70}"));
+  // Exactly fitting (with the NUL) is accepted
+  const char* expect = "event: e\ndata: 12345\n\n";
+  TEST_ASSERT_EQUAL((int)strlen(expect), (int)formatSseEvent(buf, strlen(expect) + 1, "e", "12345"));
+}
+
+// ===== HTTP PROTOCOL TESTS =====
+
+// Feeds a whole string to the parser; returns bytes consumed.
+static size_t feedStr(HttpRequestParser& p, const char* s) {
+  return p.feed((const uint8_t*)s, strlen(s));
+}
+
+void test_http_parses_get_with_query_args() {
+  static HttpRequestParser p;
+  p.reset();
+  feedStr(p, "GET /api/status?emotion=3&name=hi+there%21 HTTP/1.1\r\nHost: 192.168.4.1\r\n"
+             "accept-encoding: gzip, br\r\n\r\n");
+  TEST_ASSERT_EQUAL(HTTP_PARSE_COMPLETE, p.state());
+  TEST_ASSERT_TRUE(p.method() == HttpMethod::GET);
+  TEST_ASSERT_EQUAL_STRING("/api/status", p.path());
+  TEST_ASSERT_EQUAL_STRING("gzip, br", p.header("Accept-Encoding"));
+  char v[16];
+  TEST_ASSERT_TRUE(p.arg("name", v, sizeof(v)));
+  TEST_ASSERT_EQUAL_STRING("hi there!", v);
+  TEST_ASSERT_TRUE(p.hasArg("emotion"));
+  TEST_ASSERT_FALSE(p.hasArg("emo"));
+  TEST_ASSERT_FALSE(p.arg("name", v, 4));  // too long for the buffer
+}
+
+void test_http_parses_form_body_fed_byte_by_byte() {
+  static HttpRequestParser p;
+  p.reset();
+  const char* req = "POST /api/wifi HTTP/1.1\r\nContent-Type: application/x-www-form-urlencoded\r\n"
+                    "Content-Length: 27\r\n\r\nssid=Home%20Net&password=pw";
+  size_t n = strlen(req);
+  for (size_t i = 0; i < n; i++) {
+    TEST_ASSERT_EQUAL(HTTP_PARSE_NEED_MORE, p.state());
+    TEST_ASSERT_EQUAL(1, (int)p.feed((const uint8_t*)req + i, 1));
+  }
+  TEST_ASSERT_EQUAL(HTTP_PARSE_COMPLETE, p.state());
+  TEST_ASSERT_TRUE(p.method() == HttpMethod::POST);
+  char v[16];
+  TEST_ASSERT_TRUE(p.arg("ssid", v, sizeof(v)));
+  TEST_ASSERT_EQUAL_STRING("Home Net", v);
+  TEST_ASSERT_TRUE(p.arg("password", v, sizeof(v)));
+  TEST_ASSERT_EQUAL_STRING("pw", v);
+}
+
+void test_http_keepalive_and_pipelining() {
+  static HttpRequestParser p;
+  p.reset();
+  const char* two = "GET /a HTTP/1.1\r\n\r\nGET /b HTTP/1.0\r\n\r\n";
+  size_t used = feedStr(p, two);
+  TEST_ASSERT_EQUAL(HTTP_PARSE_COMPLETE, p.state());
+  TEST_ASSERT_EQUAL_STRING("/a", p.path());
+  TEST_ASSERT_TRUE(p.keepAlive());  // HTTP/1.1 default
+  TEST_ASSERT_TRUE(used < strlen(two));
+
+  p.reset();
+  p.feed((const uint8_t*)two + used, strlen(two) - used);
+  TEST_ASSERT_EQUAL(HTTP_PARSE_COMPLETE, p.state());
+  TEST_ASSERT_EQUAL_STRING("/b", p.path());
+  TEST_ASSERT_FALSE(p.keepAlive());  // HTTP/1.0 default
+
+  p.reset();
+  feedStr(p, "GET / HTTP/1.1\r\nConnection: Close\r\n\r\n");
+  TEST_ASSERT_FALSE(p.keepAlive());
+}
+
+void test_http_rejects_oversized_and_malformed_requests() {
+  static HttpRequestParser p;
+  p.reset();
+  feedStr(p, "GET / HTTP/1.1\r\nX-Pad: ");
+  for (int i = 0; i < HTTP_MAX_HEADER_BYTES && p.state() == HTTP_PARSE_NEED_MORE; i++) feedStr(p, "a");
+  TEST_ASSERT_EQUAL(HTTP_PARSE_ERROR, p.state());
+  TEST_ASSERT_EQUAL(431, p.errorStatus());
+
+  p.reset();
+  feedStr(p, "POST /api/config HTTP/1.1\r\nContent-Length: 100000\r\n\r\n");
+  TEST_ASSERT_EQUAL(413, p.errorStatus());
+
+  p.reset();
+  feedStr(p, "garbage\r\n\r\n");
+  TEST_ASSERT_EQUAL(400, p.errorStatus());
+
+  p.reset();
+  feedStr(p, "GET / HTTP/2.0\r\n\r\n");
+  TEST_ASSERT_EQUAL(505, p.errorStatus());
+}
+
+void test_http_response_head_and_chunk_framing() {
+  char buf[160];
+  size_t n = formatResponseHead(buf, sizeof(buf), 200, "text/html", 42, true, "ETag: \"x\"\r\n");
+  TEST_ASSERT_EQUAL_STRING("HTTP/1.1 200 OK\r\nContent-Type: text/html\r\nContent-Length: 42\r\n"
+                           "Connection: keep-alive\r\nETag: \"x\"\r\n\r\n", buf);
+  TEST_ASSERT_EQUAL((int)strlen(buf), (int)n);
+
+  formatResponseHead(buf, sizeof(buf), 200, "application/json", -1, false, nullptr);
+  TEST_ASSERT_NOT_NULL(strstr(buf, "Transfer-Encoding: chunked\r\n"));
+  TEST_ASSERT_NULL(strstr(buf, "Content-Length"));
+  TEST_ASSERT_EQUAL(0, (int)formatResponseHead(buf, 20, 200, "text/html", 42, true, nullptr));
+
+  TEST_ASSERT_EQUAL(5, (int)formatChunkHeader(buf, sizeof(buf), 0x1ab));
+  TEST_ASSERT_EQUAL_STRING("1ab\r\n", buf);
+}
+
+// ===== WEBSOCKET / CONTROL PROTOCOL / MIRROR TESTS =====
+
+void test_ws_sha1_and_accept_key() {
+  uint8_t d[20];
+  char hex[41];
+  sha1((const uint8_t*)"abc", 3, d);
+  for (int i = 0; i < 20; i++) snprintf(hex + i * 2, 3, "%02x", d[i]);
+  TEST_ASSERT_EQUAL_STRING("a9993e364706816aba3e25717850c26c9cd0d89d", hex);
+  // 56 bytes: padding spills into a second block
+  const char* two = "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+  sha1((const uint8_t*)two, strlen(two), d);
+  for (int i = 0; i < 20; i++) snprintf(hex + i * 2, 3, "%02x", d[i]);
+  TEST_ASSERT_EQUAL_STRING("84983e441c3bd26ebaae4aa1f95129e5e54670f1", hex);
+
+  char accept[29];
+  TEST_ASSERT_TRUE(wsAcceptKey("dGhlIHNhbXBsZSBub25jZQ==", accept));  // RFC 6455 section 1.3
+  TEST_ASSERT_EQUAL_STRING("s3pPLMBiTxaQ9kYGzzhZRbK+xOo=", accept);
+  TEST_ASSERT_FALSE(wsAcceptKey("", accept));
+}
+
+void test_ws_parses_masked_frames_incrementally() {
+  static WsFrameParser p;
+  p.reset();
+  // RFC 6455 section 5.7: masked "Hello", followed by the start of the next frame
+  const uint8_t wire[] = {0x81, 0x85, 0x37, 0xfa, 0x21, 0x3d, 0x7f, 0x9f, 0x4d, 0x51, 0x58, 0x82};
+  for (size_t i = 0; i < 10; i++) TEST_ASSERT_EQUAL(1, (int)p.feed(wire + i, 1));
+  TEST_ASSERT_EQUAL(WS_PARSE_NEED_MORE, p.state());
+  TEST_ASSERT_EQUAL(1, (int)p.feed(wire + 10, 2));  // stops at the frame boundary
+  TEST_ASSERT_EQUAL(WS_PARSE_FRAME, p.state());
+  TEST_ASSERT_EQUAL(WS_OP_TEXT, p.opcode());
+  TEST_ASSERT_EQUAL(5, (int)p.payloadLength());
+  TEST_ASSERT_EQUAL_MEMORY("Hello", p.payload(), 5);
+}
+
+void test_ws_rejects_unmasked_fragmented_and_oversized_frames() {
+  static WsFrameParser p;
+  const uint8_t unmasked[] = {0x82, 0x01, 0x00};
+  p.reset();
+  p.feed(unmasked, sizeof(unmasked));
+  TEST_ASSERT_EQUAL(WS_PARSE_ERROR, p.state());
+  TEST_ASSERT_EQUAL(WS_CLOSE_PROTOCOL, p.closeCode());
+
+  const uint8_t fragment[] = {0x02, 0x81, 0, 0, 0, 0, 0x00};
+  p.reset();
+  p.feed(fragment, sizeof(fragment));
+  TEST_ASSERT_EQUAL(WS_CLOSE_PROTOCOL, p.closeCode());
+
+  const uint8_t big[] = {0x82, 0xFE, 0x01, 0x00, 0, 0, 0, 0};  // 256-byte payload
+  p.reset();
+  p.feed(big, sizeof(big));
+  TEST_ASSERT_EQUAL(WS_CLOSE_TOO_BIG, p.closeCode());
+}
+
+void test_ws_encodes_server_frames() {
+  uint8_t out[300];
+  const uint8_t ack[] = {0x81, 7, 1, 0};
+  TEST_ASSERT_EQUAL(6, (int)wsEncodeFrame(out, sizeof(out), WS_OP_BINARY, ack, sizeof(ack)));
+  TEST_ASSERT_EQUAL_HEX8(0x82, out[0]);
+  TEST_ASSERT_EQUAL_HEX8(0x04, out[1]);  // unmasked, length 4
+  TEST_ASSERT_EQUAL_MEMORY(ack, out + 2, 4);
+
+  uint8_t payload[200] = {0};
+  TEST_ASSERT_EQUAL(204, (int)wsEncodeFrame(out, sizeof(out), WS_OP_BINARY, payload, 200));
+  TEST_ASSERT_EQUAL(126, out[1]);
+  TEST_ASSERT_EQUAL(200, (out[2] << 8) | out[3]);
+  TEST_ASSERT_EQUAL(0, (int)wsEncodeFrame(out, 100, WS_OP_BINARY, payload, 200));
+}
+
+void test_control_decodes_commands() {
+  ControlCommand cmd;
+  const uint8_t setEmotion[] = {CTRL_SET_EMOTION, 9, EMOTION_HAPPY};
+  TEST_ASSERT_EQUAL(CTRL_OK, decodeControlCommand(setEmotion, 3, cmd));
+  TEST_ASSERT_EQUAL(CTRL_SET_EMOTION, cmd.op);
+  TEST_ASSERT_EQUAL(9, cmd.seq);
+  TEST_ASSERT_EQUAL(EMOTION_HAPPY, cmd.arg);
+
+  const uint8_t gesture[] = {CTRL_GESTURE, 10, GESTURE_DOUBLE_TAP};
+  TEST_ASSERT_EQUAL(CTRL_OK, decodeControlCommand(gesture, 3, cmd));
+  const uint8_t badGesture[] = {CTRL_GESTURE, 11, 7};
+  TEST_ASSERT_EQUAL(CTRL_BAD_VALUE, decodeControlCommand(badGesture, 3, cmd));
+  TEST_ASSERT_EQUAL(11, cmd.seq);  // still acknowledgeable
+
+  const uint8_t query[] = {CTRL_QUERY, 12, 0};
+  TEST_ASSERT_EQUAL(CTRL_OK, decodeControlCommand(query, 2, cmd));
+  TEST_ASSERT_EQUAL(CTRL_BAD_LENGTH, decodeControlCommand(query, 3, cmd));
+  TEST_ASSERT_EQUAL(CTRL_BAD_LENGTH, decodeControlCommand(setEmotion, 2, cmd));
+  const uint8_t unknown[] = {0x7F, 13};
+  TEST_ASSERT_EQUAL(CTRL_UNKNOWN_OP, decodeControlCommand(unknown, 2, cmd));
+  const uint8_t mirror[] = {CTRL_MIRROR, 14, 2};
+  TEST_ASSERT_EQUAL(CTRL_BAD_VALUE, decodeControlCommand(mirror, 3, cmd));
+}
+
+void test_control_encodes_ack_and_state() {
+  uint8_t out[16];
+  TEST_ASSERT_EQUAL(CTRL_ACK_BYTES, (int)encodeControlAck(out, sizeof(out), 42, CTRL_GESTURE, CTRL_BAD_VALUE));
+  const uint8_t ack[] = {CTRL_ACK, 42, CTRL_GESTURE, CTRL_BAD_VALUE};
+  TEST_ASSERT_EQUAL_MEMORY(ack, out, CTRL_ACK_BYTES);
+
+  ControlState st = {EMOTION_SAD, 3, 3812, 0x01020304};
+  TEST_ASSERT_EQUAL(CTRL_STATE_BYTES, (int)encodeControlState(out, sizeof(out), st));
+  const uint8_t state[] = {CTRL_STATE, EMOTION_SAD, 3, 0xE4, 0x0E, 0x04, 0x03, 0x02, 0x01};
+  TEST_ASSERT_EQUAL_MEMORY(state, out, CTRL_STATE_BYTES);
+  TEST_ASSERT_EQUAL(0, (int)encodeControlState(out, 8, st));
+}
+
+void test_control_state_reports_pending_transition_target() {
+  emotionManager.setTargetEmotion(EMOTION_HAPPY);
+  TEST_ASSERT_TRUE(emotionManager.isTransitionActive());
+  TEST_ASSERT_EQUAL(EMOTION_IDLE, emotionManager.getCurrentEmotion());
+
+  ControlState st = {(uint8_t)emotionManager.getShownEmotion(), 0, 0, 0};
+  uint8_t out[CTRL_STATE_BYTES];
+  encodeControlState(out, sizeof(out), st);
+  TEST_ASSERT_EQUAL(CTRL_STATE, out[0]);
+  TEST_ASSERT_EQUAL(EMOTION_HAPPY, out[1]);
+
+  emotionManager.completeTransition();
+  TEST_ASSERT_EQUAL(EMOTION_HAPPY, emotionManager.getShownEmotion());
+}
+
+void test_mirror_sends_keyframe_then_changed_pages_only() {
+  static MirrorEncoder enc;
+  static uint8_t frame[MIRROR_FRAME_BYTES];
+  static uint8_t client[MIRROR_FRAME_BYTES];
+  static uint8_t msg[MIRROR_MSG_MAX];
+  enc.reset();
+  memset(frame, 0, sizeof(frame));
+  memset(client, 0xA5, sizeof(client));  // stale contents the keyframe must clear
+
+  // Blank screen: keyframe with no pages
+  size_t n = enc.encode(frame, msg, sizeof(msg));
+  TEST_ASSERT_EQUAL(MIRROR_HEAD_BYTES, (int)n);
+  TEST_ASSERT_EQUAL_HEX8(MIRROR_FLAG_KEY, msg[3]);
+  TEST_ASSERT_TRUE(applyMirrorMessage(msg, n, client));
+  TEST_ASSERT_EQUAL_MEMORY(frame, client, MIRROR_FRAME_BYTES);
+
+  // Nothing changed: no message
+  TEST_ASSERT_EQUAL(0, (int)enc.encode(frame, msg, sizeof(msg)));
+
+  // Two pixels on pages 2 and 7
+  frame[2 * 128 + 40] = 0x18;
+  frame[7 * 128 + 127] = 0x80;
+  n = enc.encode(frame, msg, sizeof(msg));
+  TEST_ASSERT_EQUAL_HEX8(0, msg[3]);
+  TEST_ASSERT_EQUAL_HEX8(0x84, msg[4]);
+  TEST_ASSERT_TRUE(n < 20);
+  TEST_ASSERT_EQUAL(2, enc.getSeq());
+  TEST_ASSERT_TRUE(applyMirrorMessage(msg, n, client));
+  TEST_ASSERT_EQUAL_MEMORY(frame, client, MIRROR_FRAME_BYTES);
+}
+
+void test_mirror_worst_case_fits_and_bad_messages_are_rejected() {
+  static MirrorEncoder enc;
+  static uint8_t frame[MIRROR_FRAME_BYTES];
+  static uint8_t client[MIRROR_FRAME_BYTES];
+  static uint8_t msg[MIRROR_MSG_MAX];
+  enc.reset();
+  for (int i = 0; i < MIRROR_FRAME_BYTES; i++) frame[i] = (uint8_t)(i * 37 + 1);  // no zero bytes
+  size_t n = enc.encode(frame, msg, sizeof(msg));
+  TEST_ASSERT_TRUE(n > 0 && n <= MIRROR_MSG_MAX);
+  TEST_ASSERT_EQUAL_HEX8(0xFF, msg[4]);
+  TEST_ASSERT_TRUE(applyMirrorMessage(msg, n, client));
+  TEST_ASSERT_EQUAL_MEMORY(frame, client, MIRROR_FRAME_BYTES);
+
+  TEST_ASSERT_FALSE(applyMirrorMessage(msg, n - 1, client));  // truncated
+  msg[0] = CTRL_STATE;
+  TEST_ASSERT_FALSE(applyMirrorMessage(msg, n, client));
+  TEST_ASSERT_EQUAL(0, (int)enc.encode(frame, msg, MIRROR_MSG_MAX - 1));
+}
+
+// ===== EASING TESTS =====
+
+// The float ease() draw functions used before easing.h — reference for bit-exactness.
+static int referenceFloatEase(int start, int end, int frame, int totalFrames) {
+  if (totalFrames <= 0) return end;
+  float t = (float)frame / (float)totalFrames;
+  if (t > 1.0f) t = 1.0f;
+  t = (t < 0.5f) ? 2 * t * t : 1 - (-2 * t + 2) * (-2 * t + 2) / 2;
+  return start + (int)((end - start) * t);
+}
+
+void test_ease_quad_bit_exact_with_float() {
+  int mismatches = 0;
+  for (int total = 0; total <= 255; total++) {
+    for (int frame = -2; frame <= total + 2; frame++) {
+      for (int d = -71; d <= 71; d++) {
+        if (referenceFloatEase(28, 28 + d, frame, total) !=
+            easeInOutQuad(28, 28 + d, frame, total)) {
+          mismatches++;
+        }
+      }
+    }
+  }
+  TEST_ASSERT_EQUAL(0, mismatches);
+}
+
+void test_ease_curves_span_start_to_end() {
+  const EaseCurve curves[] = {EASE_LINEAR, EASE_IN_OUT_QUAD, EASE_IN_OUT_CUBIC, EASE_OUT_BOUNCE};
+  for (int c = 0; c < 4; c++) {
+    TEST_ASSERT_EQUAL(10, easeCurve(curves[c], 10, 40, 0, 17));
+    TEST_ASSERT_EQUAL(40, easeCurve(curves[c], 10, 40, 17, 17));
+    TEST_ASSERT_EQUAL(40, easeCurve(curves[c], 10, 40, 25, 17));  // clamps past the end
+    TEST_ASSERT_EQUAL(EASE_ONE / 2, easeProgressQ8(EASE_LINEAR, 8, 16));
+  }
+}
+
+void test_ease_cubic_lut_tracks_formula() {
+  // Q8.8 table with interpolation stays within 1/128 of the float curve and never runs backwards.
+  int prev = 0;
+  for (int frame = 0; frame <= 200; frame++) {
+    float t = frame / 200.0f;
+    float exact = (t < 0.5f) ? 4 * t * t * t : 1 - (-2 * t + 2) * (-2 * t + 2) * (-2 * t + 2) / 2;
+    int q = easeProgressQ8(EASE_IN_OUT_CUBIC, frame, 200);
+    int err = q - (int)(exact * EASE_ONE + 0.5f);
+    TEST_ASSERT_TRUE(err >= -2 && err <= 2);
+    TEST_ASSERT_TRUE(q >= prev);
+    prev = q;
+  }
+}
+
+void test_ease_bounce_touches_down_before_settling() {
+  // First landing of the bounce is at t = 1/2.75 — progress reaches 1.0 there
+  // (less the table's sampling blur around the cusp), then dips to 0.75.
+  TEST_ASSERT_TRUE(easeProgressQ8(EASE_OUT_BOUNCE, 100, 275) >= EASE_ONE - 8);
+  TEST_ASSERT_TRUE(easeProgressQ8(EASE_OUT_BOUNCE, 35, 64) < EASE_ONE - 40);
+  TEST_ASSERT_EQUAL(EASE_ONE, easeProgressQ8(EASE_OUT_BOUNCE, 64, 64));
+}
+
+// ===== FACE GRAMMAR TESTS =====
+
+void test_face_tracks_key_each_channel_in_frame_order() {
+  // evaluateFace() walks a track once, so each channel's keys must ascend by frame.
+  for (int id = 0; id < EmotionRegistry::MAX_EMOTIONS; id++) {
+    const EmotionDef* def = emotionRegistry.get((EmotionState)id);
+    if (!def || !def->face) continue;
+    int last[FC_COUNT];
+    for (int ch = 0; ch < FC_COUNT; ch++) last[ch] = -1;
+    for (int k = 0; k < def->face->keyCount; k++) {
+      const FaceKey& key = def->face->keys[k];
+      TEST_ASSERT_TRUE_MESSAGE(key.channel < FC_COUNT, def->name);
+      TEST_ASSERT_TRUE_MESSAGE((int)key.frame > last[key.channel], def->name);
+      TEST_ASSERT_TRUE_MESSAGE(key.frame < def->frameCount, def->name);
+      last[key.channel] = key.frame;
+    }
+  }
+}
+
+void test_face_idle_opens_on_neutral_pose() {
+  FaceParams p;
+  TEST_ASSERT_TRUE(faceParamsFor(EMOTION_IDLE, 0, p));
+  TEST_ASSERT_EQUAL_MEMORY(FACE_NEUTRAL.v, p.v, sizeof(p.v));
+}
+
+void test_face_params_only_for_grammar_emotions() {
+  FaceParams p;
+  TEST_ASSERT_TRUE(faceParamsFor(EMOTION_HAPPY, 0, p));
+  TEST_ASSERT_TRUE(faceParamsFor(EMOTION_GRUMPY, 0, p));
+  TEST_ASSERT_FALSE(faceParamsFor(EMOTION_CONFUSED, 0, p));
+  TEST_ASSERT_FALSE(faceParamsFor(EMOTION_DEAD, 0, p));
+}
+
+void test_face_morph_lands_on_both_endpoints() {
+  // Centered (EXCITED) and left-anchored (ANGRY) mouths blend without a jump at either end.
+  static FrameBufferCanvas expected;
+  static FrameBufferCanvas morphed;
+  FaceParams from, to, mid;
+  faceParamsFor(EMOTION_EXCITED, 10, from);
+  faceParamsFor(EMOTION_ANGRY, 20, to);
+  const FaceParams* ends[2] = {&from, &to};
+  for (int i = 0; i < 2; i++) {
+    morphFace(from, to, i * 6, 6, mid);
+    expected.clear();
+    drawFace(expected, *ends[i]);
+    morphed.clear();
+    drawFace(morphed, mid);
+    TEST_ASSERT_EQUAL_MEMORY(expected.getBuffer(), morphed.getBuffer(), 1024);
+  }
+  morphFace(from, to, 3, 6, mid);
+  TEST_ASSERT_TRUE(mid.v[FC_EYE_LH] < from.v[FC_EYE_LH] && mid.v[FC_EYE_LH] > to.v[FC_EYE_LH]);
+}
+
 // ===== DRAW FUNCTION TESTS (via MockCanvas) =====
 
 void test_draw_idle_draws_eyes() {
@@ -312,6 +1298,73 @@ void test_bored_draws_half_lidded_eyes() {
 }
 
 
+// ===== STA LINK / BOOT PROFILE TESTS =====
+
+void test_sta_link_retries_with_backoff() {
+  StaLink sta;
+  TEST_ASSERT_EQUAL(STA_ACT_NONE, sta.update(0, false, false));  // no credentials
+  sta.start(1000);
+  TEST_ASSERT_EQUAL(STA_ACT_BEGIN, sta.update(1000, false, false));
+  TEST_ASSERT_EQUAL(STA_CONNECTING, sta.state());
+  TEST_ASSERT_EQUAL(STA_ACT_NONE, sta.update(1000 + WIFI_STA_TIMEOUT_MS - 1, false, false));
+  TEST_ASSERT_EQUAL(STA_ACT_DISCONNECT, sta.update(1000 + WIFI_STA_TIMEOUT_MS, false, false));
+  TEST_ASSERT_EQUAL(STA_BACKOFF, sta.state());
+  TEST_ASSERT_EQUAL(1, sta.attempts());
+  unsigned long t = 1000 + WIFI_STA_TIMEOUT_MS;
+  TEST_ASSERT_EQUAL((unsigned long)(t + WIFI_STA_RETRY_MIN_MS), sta.retryAt());
+
+  TEST_ASSERT_EQUAL(STA_ACT_NONE, sta.update(sta.retryAt() - 1, false, false));
+  t = sta.retryAt();
+  TEST_ASSERT_EQUAL(STA_ACT_BEGIN, sta.update(t, false, false));
+  t += WIFI_STA_TIMEOUT_MS;
+  TEST_ASSERT_EQUAL(STA_ACT_DISCONNECT, sta.update(t, false, false));
+  TEST_ASSERT_EQUAL((unsigned long)(t + 2 * WIFI_STA_RETRY_MIN_MS), sta.retryAt());
+
+  TEST_ASSERT_EQUAL((unsigned long)WIFI_STA_RETRY_MIN_MS, StaLink::backoffMs(1));
+  TEST_ASSERT_EQUAL((unsigned long)(4 * WIFI_STA_RETRY_MIN_MS), StaLink::backoffMs(3));
+  TEST_ASSERT_EQUAL((unsigned long)WIFI_STA_RETRY_MAX_MS, StaLink::backoffMs(60));
+}
+
+void test_sta_link_syncs_and_recovers_from_link_loss() {
+  StaLink sta;
+  sta.start(0);
+  sta.update(0, false, false);
+  TEST_ASSERT_EQUAL(STA_ACT_START_NTP, sta.update(800, true, false));
+  TEST_ASSERT_EQUAL(STA_WAIT_NTP, sta.state());
+  TEST_ASSERT_EQUAL(800, (int)sta.linkUpAt());
+  TEST_ASSERT_FALSE(sta.synced());
+  TEST_ASSERT_EQUAL(STA_ACT_NONE, sta.update(1500, true, true));
+  TEST_ASSERT_EQUAL(STA_SYNCED, sta.state());
+  TEST_ASSERT_TRUE(sta.synced());
+
+  // Link drops: retry soon, but the clock stays usable
+  TEST_ASSERT_EQUAL(STA_ACT_DISCONNECT, sta.update(9000, false, true));
+  TEST_ASSERT_EQUAL(STA_BACKOFF, sta.state());
+  TEST_ASSERT_TRUE(sta.synced());
+  TEST_ASSERT_EQUAL((unsigned long)(9000 + WIFI_STA_RETRY_MIN_MS), sta.retryAt());
+
+  // New credentials start over
+  sta.start(20000);
+  TEST_ASSERT_FALSE(sta.synced());
+  TEST_ASSERT_EQUAL(STA_ACT_BEGIN, sta.update(20000, false, false));
+  TEST_ASSERT_EQUAL_STRING("connecting", StaLink::stateName(sta.state()));
+}
+
+void test_boot_profile_reports_phase_durations() {
+  BootProfile bp;
+  bp.mark("serial", 12000);
+  bp.mark("display", 53450);
+  bp.mark("wifi", 310000);
+  TEST_ASSERT_EQUAL(3, bp.count());
+  TEST_ASSERT_EQUAL(41450, (int)bp.durationUs(1));
+  char buf[96];
+  bp.format(buf, sizeof(buf));
+  TEST_ASSERT_EQUAL_STRING("serial 12.0 | display 41.4 | wifi 256.5 | total 310.0 ms", buf);
+  char small[16];
+  size_t n = bp.format(small, sizeof(small));
+  TEST_ASSERT_EQUAL((int)strlen(small), (int)n);  // truncated but terminated
+}
+
 // ===== PERSONALITY ENGINE TESTS =====
 
 void test_attention_arc_needy_before_bored() {
@@ -677,6 +1730,62 @@ void test_night_cycle_requires_time_provider() {
   TEST_ASSERT_FALSE(p.isNightCycleActive());
 }
 
+static int providerCalls = 0;
+
+void test_night_cycle_reads_time_provider_once_per_tick() {
+  Personality p;
+  p.init(0);
+  providerCalls = 0;
+  p.setTimeProvider([]() -> int { providerCalls++; return 2; });
+  p.update(200000, EMOTION_IDLE);
+  TEST_ASSERT_TRUE(p.isNightCycleActive());
+  TEST_ASSERT_EQUAL(1, providerCalls);
+}
+
+// ===== CLOCK SERVICE TESTS =====
+
+static int fakeWallHour = -1;  // -1 = clock not set
+
+static bool fakeWallClock(int& hour) {
+  if (fakeWallHour < 0) return false;
+  hour = fakeWallHour;
+  return true;
+}
+
+void test_clock_service_falls_back_to_uptime_hour() {
+  ClockService c;
+  c.setSource(fakeWallClock);
+  fakeWallHour = -1;
+  c.tick(5 * HOUR_IN_MILLIS + 10);
+  TEST_ASSERT_FALSE(c.isWallClock());
+  TEST_ASSERT_EQUAL(5, c.hour());
+  TEST_ASSERT_EQUAL(7, c.hourAt(7 * HOUR_IN_MILLIS));  // uptime follows the caller's clock
+}
+
+void test_clock_service_caches_between_refreshes() {
+  ClockService c;
+  c.setSource(fakeWallClock);
+  fakeWallHour = 14;
+  c.tick(1000);
+  TEST_ASSERT_TRUE(c.isWallClock());
+  TEST_ASSERT_EQUAL(14, c.hour());
+  TEST_ASSERT_EQUAL(14, c.hourAt(9 * HOUR_IN_MILLIS));
+
+  fakeWallHour = 15;
+  c.tick(1000 + CLOCK_REFRESH_MS - 1);  // too soon — still cached
+  TEST_ASSERT_EQUAL(14, c.hour());
+  TEST_ASSERT_EQUAL(1, (int)c.getRefreshes());
+  c.tick(1000 + CLOCK_REFRESH_MS);
+  TEST_ASSERT_EQUAL(15, c.hour());
+
+  fakeWallHour = 16;
+  c.requestRefresh();  // e.g. NTP just synced
+  c.tick(1000 + CLOCK_REFRESH_MS + 1);
+  TEST_ASSERT_EQUAL(16, c.hour());
+  TEST_ASSERT_EQUAL(3, (int)c.getRefreshes());
+  fakeWallHour = -1;
+}
+
 // ===== GESTURE DETECTION TESTS =====
 
 void test_classify_gesture_tap() {
@@ -705,6 +1814,514 @@ void test_classify_gesture_boundary_double_tap() {
   TEST_ASSERT_EQUAL(GESTURE_TAP, classifyGesture(100, DOUBLE_TAP_WINDOW_MS + 1));
 }
 
+// ===== TOUCH EDGE QUEUE / DECODER TESTS =====
+
+static TouchGesture touchLog[8];
+static uint32_t touchLogUs[8];
+static int touchLogCount = 0;
+
+static void recordTouch(TouchGesture g, uint32_t us, void*) {
+  if (touchLogCount < 8) {
+    touchLog[touchLogCount] = g;
+    touchLogUs[touchLogCount] = us;
+  }
+  touchLogCount++;
+}
+
+static void startTouchDecoder(TouchDecoder& d) {
+  touchLogCount = 0;
+  d.setEmit(recordTouch, nullptr);
+  d.reset(false);
+}
+
+void test_edge_queue_fifo_and_overflow() {
+  EdgeQueue q;
+  TouchEdge e;
+  TEST_ASSERT_TRUE(q.empty());
+  TEST_ASSERT_FALSE(q.pop(e));
+  for (int i = 0; i < EdgeQueue::CAPACITY - 1; i++) {
+    TEST_ASSERT_TRUE(q.push(100 + i, i & 1));
+  }
+  TEST_ASSERT_FALSE(q.push(999, 0));  // one slot always stays empty
+  TEST_ASSERT_EQUAL_UINT32(1, q.takeOverflows());
+  TEST_ASSERT_EQUAL_UINT32(0, q.takeOverflows());
+  TEST_ASSERT_TRUE(q.pop(e));
+  TEST_ASSERT_EQUAL_UINT32(100, e.us);
+  TEST_ASSERT_EQUAL(0, e.level);
+  TEST_ASSERT_TRUE(q.push(500, 1));   // wraps into the freed slot
+  int n = 1;
+  while (q.pop(e)) n++;
+  TEST_ASSERT_EQUAL(EdgeQueue::CAPACITY, n);
+  TEST_ASSERT_EQUAL_UINT32(500, e.us);
+}
+
+void test_touch_decoder_catches_tap_shorter_than_control_tick() {
+  TouchDecoder d;
+  startTouchDecoder(d);
+  // 20ms touch — would fall between two 50ms polls of the pin
+  d.onEdge(1000000, LOW);
+  d.onEdge(1020000, HIGH);
+  d.poll(1025000);
+  TEST_ASSERT_EQUAL(0, touchLogCount);  // still inside the double-tap window
+  d.poll(1020000 + DOUBLE_TAP_WINDOW_MS * 1000UL + 1000);
+  TEST_ASSERT_EQUAL(1, touchLogCount);
+  TEST_ASSERT_EQUAL(GESTURE_TAP, touchLog[0]);
+}
+
+void test_touch_decoder_rejects_bounce() {
+  TouchDecoder d;
+  startTouchDecoder(d);
+  // Press that flips back inside TOUCH_DEBOUNCE_US is noise
+  d.onEdge(1000000, LOW);
+  d.onEdge(1000000 + TOUCH_DEBOUNCE_US / 2, HIGH);
+  d.poll(3000000);
+  TEST_ASSERT_EQUAL(0, touchLogCount);
+  TEST_ASSERT_FALSE(d.isTouched());
+  TEST_ASSERT_EQUAL_UINT32(1, d.getBounces());
+}
+
+void test_touch_decoder_double_tap_fires_once() {
+  TouchDecoder d;
+  startTouchDecoder(d);
+  d.onEdge(1000000, LOW);
+  d.onEdge(1080000, HIGH);
+  d.onEdge(1200000, LOW);
+  d.onEdge(1280000, HIGH);
+  d.poll(3000000);
+  // The second tap's release must not queue an extra TAP after the DOUBLE_TAP
+  TEST_ASSERT_EQUAL(1, touchLogCount);
+  TEST_ASSERT_EQUAL(GESTURE_DOUBLE_TAP, touchLog[0]);
+  TEST_ASSERT_EQUAL_UINT32(1200000, touchLogUs[0]);
+}
+
+void test_touch_decoder_long_press_at_threshold() {
+  TouchDecoder d;
+  startTouchDecoder(d);
+  d.onEdge(1000000, LOW);
+  d.poll(1000000 + TOUCH_DEBOUNCE_US);
+  uint32_t due = 0;
+  TEST_ASSERT_TRUE(d.nextDeadline(due));
+  TEST_ASSERT_EQUAL_UINT32(1000000 + LONG_PRESS_MS * 1000UL, due);
+  d.poll(due - 1);
+  TEST_ASSERT_EQUAL(0, touchLogCount);
+  d.poll(due);
+  TEST_ASSERT_EQUAL(1, touchLogCount);
+  TEST_ASSERT_EQUAL(GESTURE_LONG_PRESS, touchLog[0]);
+  // Releasing after a long press adds nothing; decoder goes idle
+  d.onEdge(2000000, HIGH);
+  d.poll(3000000);
+  TEST_ASSERT_EQUAL(1, touchLogCount);
+  TEST_ASSERT_FALSE(d.nextDeadline(due));
+}
+
+// ===== COMMAND QUEUE TESTS =====
+
+// Maps each gesture to emotion 100 + gesture so tests can tell handler results apart.
+static int gestureToEmotion(const Command& cmd, void* ctx) {
+  (*(int*)ctx)++;
+  return cmd.type == CMD_GESTURE ? 100 + cmd.arg : -1;
+}
+
+void test_command_queue_fifo_and_full() {
+  CommandQueue q;
+  Command c;
+  TEST_ASSERT_TRUE(q.empty());
+  TEST_ASSERT_FALSE(q.pop(c));
+  for (uint32_t i = 0; i < CommandQueue::CAPACITY; i++) {
+    TEST_ASSERT_TRUE(q.post(CMD_SET_EMOTION, CMD_SRC_BLE, (uint8_t)i, i));
+  }
+  TEST_ASSERT_FALSE(q.post(CMD_SET_EMOTION, CMD_SRC_BLE, 99, 0));  // all cells in use
+  TEST_ASSERT_EQUAL_UINT32(1, q.getDropped());
+  TEST_ASSERT_TRUE(q.pop(c));
+  TEST_ASSERT_EQUAL(0, c.arg);
+  TEST_ASSERT_TRUE(q.post(CMD_GESTURE, CMD_SRC_TOUCH, 7, 0));      // next lap reuses the freed cell
+  for (uint32_t i = 1; i < CommandQueue::CAPACITY; i++) {
+    TEST_ASSERT_TRUE(q.pop(c));
+    TEST_ASSERT_EQUAL(i, c.arg);
+  }
+  TEST_ASSERT_TRUE(q.pop(c));
+  TEST_ASSERT_EQUAL(CMD_GESTURE, c.type);
+  TEST_ASSERT_EQUAL(7, c.arg);
+  TEST_ASSERT_TRUE(q.empty());
+}
+
+void test_command_queue_drain_coalesces_emotion_burst() {
+  CommandQueue q;
+  for (int i = 0; i < 10; i++) q.post(CMD_SET_EMOTION, CMD_SRC_BLE, (uint8_t)(i % 4), 0);
+  q.post(CMD_SET_EMOTION, CMD_SRC_WEB, EMOTION_LOVE, 0);
+  int calls = 0;
+  CommandDrain d = q.drain(gestureToEmotion, &calls);
+  TEST_ASSERT_EQUAL(11, d.handled);
+  TEST_ASSERT_EQUAL(10, d.coalesced);
+  TEST_ASSERT_EQUAL(EMOTION_LOVE, d.emotion);
+  TEST_ASSERT_EQUAL(CMD_SRC_WEB, d.source);
+  TEST_ASSERT_EQUAL(0, calls);  // emotion requests never reach the handler
+  TEST_ASSERT_EQUAL_UINT32(10, q.getCoalesced());
+  d = q.drain(gestureToEmotion, &calls);
+  TEST_ASSERT_EQUAL(0, d.handled);
+  TEST_ASSERT_EQUAL(-1, d.emotion);
+}
+
+void test_command_queue_gestures_run_in_order_last_request_wins() {
+  CommandQueue q;
+  q.post(CMD_GESTURE, CMD_SRC_TOUCH, GESTURE_TAP, 0);
+  q.post(CMD_SET_EMOTION, CMD_SRC_BLE, EMOTION_SAD, 0);
+  q.post(CMD_GESTURE, CMD_SRC_WEB, GESTURE_LONG_PRESS, 0);
+  int calls = 0;
+  CommandDrain d = q.drain(gestureToEmotion, &calls);
+  TEST_ASSERT_EQUAL(2, calls);  // every gesture is handled (personality sees each touch)
+  TEST_ASSERT_EQUAL(100 + GESTURE_LONG_PRESS, d.emotion);
+  TEST_ASSERT_EQUAL(CMD_SRC_WEB, d.source);
+  TEST_ASSERT_EQUAL(2, d.coalesced);
+}
+
+// ===== BLE PROTOCOL / SCRIPT PLAYER TESTS =====
+
+void test_ble_write_legacy_single_byte() {
+  CommandQueue q;
+  const uint8_t msg[] = {EMOTION_SAD};
+  TEST_ASSERT_EQUAL(CTRL_OK, decodeBleWrite(msg, sizeof(msg), q, 42));
+  Command c;
+  TEST_ASSERT_TRUE(q.pop(c));
+  TEST_ASSERT_EQUAL(CMD_SET_EMOTION, c.type);
+  TEST_ASSERT_EQUAL(CMD_SRC_BLE, c.source);
+  TEST_ASSERT_EQUAL(EMOTION_SAD, c.arg);
+  TEST_ASSERT_EQUAL_UINT32(42, c.time);
+}
+
+void test_ble_write_batch_posts_records_in_order() {
+  CommandQueue q;
+  const uint8_t msg[] = {
+    BLE_PROTO_VERSION,
+    BLE_OP_GESTURE, GESTURE_DOUBLE_TAP,
+    BLE_OP_CONFIG, CFG_LONG_PRESS_MS, 0x20, 0x03, 0x00, 0x00,   // 800
+    BLE_OP_SEQUENCE, 2, EMOTION_HAPPY, 0xF4, 0x01, EMOTION_LOVE, 0xE8, 0x03,
+    BLE_OP_SET_EMOTION, EMOTION_SHY
+  };
+  TEST_ASSERT_EQUAL(CTRL_OK, decodeBleWrite(msg, sizeof(msg), q, 0));
+  const struct { uint8_t type, arg; uint32_t value; } want[] = {
+    {CMD_GESTURE, GESTURE_DOUBLE_TAP, 0},
+    {CMD_SET_CONFIG, CFG_LONG_PRESS_MS, 800},
+    {CMD_SCRIPT_BEGIN, 2, 0},
+    {CMD_SCRIPT_STEP, EMOTION_HAPPY, 500},
+    {CMD_SCRIPT_STEP, EMOTION_LOVE, 1000},
+    {CMD_SET_EMOTION, EMOTION_SHY, 0},
+  };
+  Command c;
+  for (size_t i = 0; i < sizeof(want) / sizeof(want[0]); i++) {
+    TEST_ASSERT_TRUE(q.pop(c));
+    TEST_ASSERT_EQUAL(want[i].type, c.type);
+    TEST_ASSERT_EQUAL(want[i].arg, c.arg);
+    TEST_ASSERT_EQUAL_UINT32(want[i].value, c.value);
+  }
+  TEST_ASSERT_TRUE(q.empty());
+}
+
+void test_ble_write_rejects_malformed_batch_atomically() {
+  CommandQueue q;
+  const uint8_t badVersion[] = {9, BLE_OP_SET_EMOTION, 1};
+  TEST_ASSERT_EQUAL(CTRL_BAD_VERSION, decodeBleWrite(badVersion, sizeof(badVersion), q, 0));
+  // Valid first record, truncated second — nothing may be queued
+  const uint8_t truncated[] = {BLE_PROTO_VERSION, BLE_OP_SET_EMOTION, 1, BLE_OP_CONFIG, 0, 1};
+  TEST_ASSERT_EQUAL(CTRL_BAD_LENGTH, decodeBleWrite(truncated, sizeof(truncated), q, 0));
+  const uint8_t badGesture[] = {BLE_PROTO_VERSION, BLE_OP_SET_EMOTION, 1, BLE_OP_GESTURE, 9};
+  TEST_ASSERT_EQUAL(CTRL_BAD_VALUE, decodeBleWrite(badGesture, sizeof(badGesture), q, 0));
+  const uint8_t badOp[] = {BLE_PROTO_VERSION, 0x7F};
+  TEST_ASSERT_EQUAL(CTRL_UNKNOWN_OP, decodeBleWrite(badOp, sizeof(badOp), q, 0));
+  TEST_ASSERT_TRUE(q.empty());
+}
+
+void test_ble_sequence_is_all_or_nothing_when_queue_is_short() {
+  CommandQueue q;
+  for (uint32_t i = 0; i < CommandQueue::CAPACITY - 2; i++) {
+    q.post(CMD_GESTURE, CMD_SRC_TOUCH, GESTURE_TAP, 0);
+  }
+  // begin + 2 steps needs 3 cells; only 2 are free
+  const uint8_t msg[] = {BLE_PROTO_VERSION, BLE_OP_SEQUENCE, 2,
+                         EMOTION_HAPPY, 0xF4, 0x01, EMOTION_LOVE, 0xE8, 0x03};
+  TEST_ASSERT_EQUAL(CTRL_BUSY, decodeBleWrite(msg, sizeof(msg), q, 0));
+  TEST_ASSERT_EQUAL_UINT32(3, q.getDropped());
+  Command c;
+  for (uint32_t i = 0; i < CommandQueue::CAPACITY - 2; i++) {
+    TEST_ASSERT_TRUE(q.pop(c));
+    TEST_ASSERT_EQUAL(CMD_GESTURE, c.type);
+  }
+  TEST_ASSERT_TRUE(q.empty());  // no script fragment left behind
+  TEST_ASSERT_EQUAL(CTRL_OK, decodeBleWrite(msg, sizeof(msg), q, 0));
+  TEST_ASSERT_TRUE(q.pop(c));
+  TEST_ASSERT_EQUAL(CMD_SCRIPT_BEGIN, c.type);
+}
+
+void test_command_queue_script_overrides_earlier_emotion_only() {
+  CommandQueue q;
+  q.post(CMD_SET_EMOTION, CMD_SRC_BLE, EMOTION_SAD, 0);
+  q.post(CMD_SCRIPT_BEGIN, CMD_SRC_BLE, 1, 0);
+  q.post(CMD_SCRIPT_STEP, CMD_SRC_BLE, EMOTION_HAPPY, 0, 500);
+  int calls = 0;
+  CommandDrain d = q.drain(gestureToEmotion, &calls);
+  TEST_ASSERT_EQUAL(-1, d.emotion);  // the script's first step wins
+  TEST_ASSERT_EQUAL(1, d.coalesced);
+  // A request after the script is returned, and the caller cancels the script
+  q.post(CMD_SCRIPT_BEGIN, CMD_SRC_BLE, 1, 0);
+  q.post(CMD_SET_EMOTION, CMD_SRC_WEB, EMOTION_LOVE, 0);
+  d = q.drain(gestureToEmotion, &calls);
+  TEST_ASSERT_EQUAL(EMOTION_LOVE, d.emotion);
+  TEST_ASSERT_EQUAL(0, d.coalesced);
+}
+
+void test_ble_state_filter_only_reports_changes() {
+  StateChangeFilter f;
+  TEST_ASSERT_TRUE(f.update(EMOTION_IDLE, 0));   // first push always goes out
+  TEST_ASSERT_FALSE(f.update(EMOTION_IDLE, 0));
+  TEST_ASSERT_TRUE(f.update(EMOTION_IDLE, 1));   // attention stage change
+  TEST_ASSERT_TRUE(f.update(EMOTION_BORED, 1));  // emotion change
+  TEST_ASSERT_FALSE(f.update(EMOTION_BORED, 1));
+}
+
+void test_runtime_config_set_field_clamps() {
+  RuntimeConfig saved = runtimeConfig;
+  TEST_ASSERT_TRUE(runtimeConfigSetField(CFG_JITTER_PERCENT, 90));
+  TEST_ASSERT_EQUAL(50, runtimeConfig.jitterPercent);
+  TEST_ASSERT_EQUAL_UINT32(50, runtimeConfigGetField(CFG_JITTER_PERCENT));
+  TEST_ASSERT_TRUE(runtimeConfigSetField(CFG_LONG_PRESS_MS, 750));
+  TEST_ASSERT_EQUAL_UINT32(750, runtimeConfig.longPressMs);
+  TEST_ASSERT_FALSE(runtimeConfigSetField(CFG_FIELD_COUNT, 1));
+  runtimeConfig = saved;
+}
+
+void test_runtime_config_field_names_round_trip() {
+  for (int f = 0; f < CFG_FIELD_COUNT; f++) {
+    const char* name = runtimeConfigFieldName((uint8_t)f);
+    TEST_ASSERT_NOT_NULL(name);
+    TEST_ASSERT_EQUAL(f, runtimeConfigFieldByName(name, strlen(name)));
+  }
+  TEST_ASSERT_EQUAL(-1, runtimeConfigFieldByName("jitterPercentX", 14));
+  TEST_ASSERT_EQUAL(CFG_JITTER_PERCENT, runtimeConfigFieldByName("jitterPercent=5", 13));
+  TEST_ASSERT_NULL(runtimeConfigFieldName(CFG_FIELD_COUNT));
+}
+
+void test_script_player_steps_through_holds() {
+  ScriptPlayer p;
+  p.begin();
+  p.append(EMOTION_HAPPY, 500);
+  p.append(EMOTION_LOVE, 200);
+  TEST_ASSERT_TRUE(p.active());
+  TEST_ASSERT_EQUAL(EMOTION_HAPPY, p.tick(1000));
+  TEST_ASSERT_EQUAL(-1, p.tick(1499));
+  TEST_ASSERT_EQUAL(EMOTION_LOVE, p.tick(1500));
+  TEST_ASSERT_EQUAL(-1, p.tick(1600));
+  TEST_ASSERT_TRUE(p.active());                  // still holding the last step
+  TEST_ASSERT_EQUAL(-1, p.tick(1700));
+  TEST_ASSERT_FALSE(p.active());
+  // A new script replaces the old one; steps past MAX_STEPS are refused
+  p.begin();
+  for (int i = 0; i < ScriptPlayer::MAX_STEPS; i++) TEST_ASSERT_TRUE(p.append(EMOTION_IDLE, 10));
+  TEST_ASSERT_FALSE(p.append(EMOTION_IDLE, 10));
+}
+
+// ===== TONE SEQUENCER TESTS =====
+
+static const BeepTone TEST_TONES[] = {{1400, 40}, {0, 30}, {1600, 120}};
+
+void test_tone_sequencer_plays_authored_durations() {
+  ToneSequencer seq;
+  TEST_ASSERT_FALSE(seq.start(TEST_TONES, 0, 0));
+  TEST_ASSERT_TRUE(seq.start(TEST_TONES, 3, 1000000));
+  TEST_ASSERT_EQUAL(1400, seq.frequency());
+  TEST_ASSERT_EQUAL_UINT32(1040000, (uint32_t)seq.toneEndUs());
+  TEST_ASSERT_EQUAL_UINT32(40000, (uint32_t)seq.delayUs(1000000));
+  TEST_ASSERT_TRUE(seq.advance());
+  TEST_ASSERT_EQUAL(0, seq.frequency());
+  TEST_ASSERT_EQUAL_UINT32(1070000, (uint32_t)seq.toneEndUs());
+  TEST_ASSERT_TRUE(seq.advance());
+  TEST_ASSERT_EQUAL(1600, seq.frequency());
+  TEST_ASSERT_EQUAL_UINT32(1190000, (uint32_t)seq.toneEndUs());
+  TEST_ASSERT_FALSE(seq.advance());
+  TEST_ASSERT_FALSE(seq.active());
+}
+
+void test_tone_sequencer_late_callback_does_not_stretch_pattern() {
+  ToneSequencer seq;
+  seq.start(TEST_TONES, 3, 0);
+  // Callback for the first tone runs 25ms late: the gap is shortened, the end stays put
+  seq.advance();
+  TEST_ASSERT_EQUAL_UINT32(5000, (uint32_t)seq.delayUs(65000));
+  // Later than the whole gap: next tone starts immediately, pattern still ends on time
+  seq.advance();
+  TEST_ASSERT_EQUAL_UINT32(190000, (uint32_t)seq.toneEndUs());
+  TEST_ASSERT_EQUAL_UINT32(0, (uint32_t)seq.delayUs(200000));
+}
+
+// ===== PRNG TESTS =====
+
+void test_prng_same_seed_replays_stream() {
+  Prng a(42), b(42), c(43);
+  bool differs = false;
+  for (int i = 0; i < 16; i++) {
+    uint32_t x = a.next();
+    TEST_ASSERT_EQUAL_UINT32(x, b.next());
+    if (x != c.next()) differs = true;
+  }
+  TEST_ASSERT_TRUE(differs);
+  Prng zero(0);
+  TEST_ASSERT_NOT_EQUAL(0, zero.next());
+}
+
+void test_prng_below_is_bounded_and_covers_range() {
+  Prng rng(7);
+  int hits[6] = {0};
+  for (int i = 0; i < 6000; i++) {
+    uint32_t v = rng.below(6);
+    TEST_ASSERT_TRUE(v < 6);
+    hits[v]++;
+  }
+  for (int i = 0; i < 6; i++) TEST_ASSERT_INT_WITHIN(150, 1000, hits[i]);
+  TEST_ASSERT_EQUAL_UINT32(0, rng.below(0));
+  TEST_ASSERT_EQUAL(5, rng.range(5, 5));
+  for (int i = 0; i < 100; i++) {
+    long r = rng.range(-3, 4);
+    TEST_ASSERT_TRUE(r >= -3 && r < 4);
+  }
+}
+
+void test_personality_seed_replays_jitter() {
+  Personality a, b;
+  a.seed(99);
+  b.seed(99);
+  for (int i = 0; i < 20; i++) {
+    TEST_ASSERT_EQUAL_UINT32((uint32_t)a.jitter(120000), (uint32_t)b.jitter(120000));
+  }
+}
+
+// ===== ALIAS TABLE / DRIFT WEIGHT TESTS =====
+
+void test_alias_table_matches_weights() {
+  const uint8_t w[5] = {60, 0, 30, 10, 0};
+  AliasTable t;
+  t.build(w, 5, 0);
+  Prng rng(3);
+  int hits[5] = {0};
+  for (int i = 0; i < 10000; i++) hits[t.sample(rng)]++;
+  TEST_ASSERT_INT_WITHIN(250, 6000, hits[0]);
+  TEST_ASSERT_INT_WITHIN(250, 3000, hits[2]);
+  TEST_ASSERT_INT_WITHIN(250, 1000, hits[3]);
+  TEST_ASSERT_EQUAL(0, hits[1]);
+  TEST_ASSERT_EQUAL(0, hits[4]);
+}
+
+void test_alias_table_all_zero_samples_fallback() {
+  const uint8_t w[3] = {0, 0, 0};
+  AliasTable t;
+  t.build(w, 3, 7);
+  Prng rng(1);
+  for (int i = 0; i < 20; i++) TEST_ASSERT_EQUAL(7, t.sample(rng));
+}
+
+void test_drift_weights_parse_and_format() {
+  uint8_t row[DRIFT_EMOTIONS];
+  memset(row, 9, sizeof(row));
+  TEST_ASSERT_TRUE(runtimeConfigParseWeights("30,0,60", row));
+  TEST_ASSERT_EQUAL(30, row[0]);
+  TEST_ASSERT_EQUAL(60, row[2]);
+  TEST_ASSERT_EQUAL(0, row[DRIFT_EMOTIONS - 1]);
+  char buf[DRIFT_EMOTIONS * 4];
+  TEST_ASSERT_EQUAL(7, (int)runtimeConfigFormatWeights(row, buf, sizeof(buf)));
+  TEST_ASSERT_EQUAL_STRING("30,0,60", buf);
+
+  TEST_ASSERT_FALSE(runtimeConfigParseWeights("0,0", row));     // all zero
+  TEST_ASSERT_FALSE(runtimeConfigParseWeights("1,256", row));   // over 255
+  TEST_ASSERT_FALSE(runtimeConfigParseWeights("1,x", row));
+  TEST_ASSERT_FALSE(runtimeConfigParseWeights("1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1", row));
+  TEST_ASSERT_EQUAL(30, row[0]);  // failures leave the row alone
+  TEST_ASSERT_EQUAL_STRING("driftGlow", runtimeConfigDriftTableName(DRIFT_GLOW));
+}
+
+void test_personality_drift_follows_config_weights() {
+  RuntimeConfig saved = runtimeConfig;
+  runtimeConfig.microExpressionChance = 0;
+  runtimeConfig.attentionStage0Ms = 10UL * MOOD_DRIFT_INTERVAL_MS;
+  memset(runtimeConfig.driftWeights[DRIFT_GLOW], 0, DRIFT_EMOTIONS);
+  runtimeConfig.driftWeights[DRIFT_GLOW][EMOTION_LOVE] = 1;
+  runtimeConfigSave();
+
+  Personality p;
+  p.init(0);
+  p.onTouch(1000, EMOTION_IDLE);
+  Personality::Decision d = p.update(1000 + 2 * MOOD_DRIFT_INTERVAL_MS, EMOTION_IDLE);
+  TEST_ASSERT_TRUE(d.shouldChange);
+  TEST_ASSERT_EQUAL(EMOTION_LOVE, d.emotion);
+
+  runtimeConfig = saved;
+  runtimeConfigSave();
+}
+
+// ===== MARKOV DRIFT TESTS =====
+
+// Markov mode on, neutral biases, no micro-expressions and no neglect within the test.
+static RuntimeConfig enableTestMarkov() {
+  RuntimeConfig saved = runtimeConfig;
+  TEST_ASSERT_TRUE(runtimeConfigSetField(CFG_MARKOV_DRIFT, 1));
+  runtimeConfig.microExpressionChance = 0;
+  runtimeConfig.attentionStage0Ms = 100UL * MOOD_DRIFT_INTERVAL_MS;
+  memset(runtimeConfig.markovBias, MARKOV_BIAS_UNITY, sizeof(runtimeConfig.markovBias));
+  memset(runtimeConfig.markovMatrix[EMOTION_IDLE], 0, DRIFT_EMOTIONS);
+  return saved;
+}
+
+void test_markov_drift_follows_row_and_hot_swaps() {
+  RuntimeConfig saved = enableTestMarkov();
+  runtimeConfig.markovMatrix[EMOTION_IDLE][EMOTION_CONTENT] = 7;
+  runtimeConfigSave();
+
+  Personality p;
+  p.init(0);
+  Personality::Decision d = p.update(2 * MOOD_DRIFT_INTERVAL_MS, EMOTION_IDLE);
+  TEST_ASSERT_TRUE(d.shouldChange);
+  TEST_ASSERT_EQUAL(EMOTION_CONTENT, d.emotion);
+
+  // Swapped in place, as POST /api/markov does
+  runtimeConfig.markovMatrix[EMOTION_IDLE][EMOTION_CONTENT] = 0;
+  runtimeConfig.markovMatrix[EMOTION_IDLE][EMOTION_PLAYFUL] = 3;
+  runtimeConfigSave();
+  d = p.update(4 * MOOD_DRIFT_INTERVAL_MS, EMOTION_IDLE);
+  TEST_ASSERT_EQUAL(EMOTION_PLAYFUL, d.emotion);
+
+  runtimeConfig = saved;
+  runtimeConfigSave();
+}
+
+void test_markov_warm_bias_reweights_row() {
+  RuntimeConfig saved = enableTestMarkov();
+  runtimeConfig.markovMatrix[EMOTION_IDLE][EMOTION_HAPPY] = 50;
+  runtimeConfig.markovMatrix[EMOTION_IDLE][EMOTION_SAD] = 50;
+  runtimeConfig.markovBias[MARKOV_BIAS_WARM][EMOTION_SAD] = 0;
+  runtimeConfigSave();
+
+  Personality p;
+  p.init(0);
+  p.onTouch(1000, EMOTION_IDLE);  // glow: the warm bias applies to the next drifts
+  for (int i = 1; i <= GLOW_DRIFT_CYCLES; i++) {
+    Personality::Decision d = p.update(1000 + i * 2 * MOOD_DRIFT_INTERVAL_MS, EMOTION_IDLE);
+    TEST_ASSERT_EQUAL(EMOTION_HAPPY, d.emotion);
+  }
+  TEST_ASSERT_EQUAL(0, p.getGlowCycles());
+
+  runtimeConfig = saved;
+  runtimeConfigSave();
+}
+
+void test_markov_bias_parse_fills_unity() {
+  uint8_t row[DRIFT_EMOTIONS];
+  TEST_ASSERT_TRUE(runtimeConfigParseWeights("0,200", row, MARKOV_BIAS_UNITY));
+  TEST_ASSERT_EQUAL(0, row[0]);
+  TEST_ASSERT_EQUAL(200, row[1]);
+  TEST_ASSERT_EQUAL(MARKOV_BIAS_UNITY, row[DRIFT_EMOTIONS - 1]);
+  char buf[DRIFT_EMOTIONS * 4];
+  runtimeConfigFormatWeights(row, buf, sizeof(buf), MARKOV_BIAS_UNITY);
+  TEST_ASSERT_EQUAL_STRING("0,200", buf);
+  TEST_ASSERT_EQUAL_STRING("biasWarm", runtimeConfigMarkovBiasName(MARKOV_BIAS_WARM));
+}
+
 void test_all_emotions_draw_without_crash() {
   // Each emotion tested up to its own frame count (not a uniform 51)
   struct { DrawFrameFn fn; int frames; } emotions[] = {
@@ -1209,6 +2826,95 @@ int main(int argc, char** argv) {
   RUN_TEST(test_tick_returns_false_for_unknown_emotion);
   RUN_TEST(test_tick_loop_pingpong_plays_bored);
   RUN_TEST(test_tick_pingpong_reverses_at_ends);
+  RUN_TEST(test_next_deadline_matches_frame_delay);
+  RUN_TEST(test_tick_stays_on_deadline_grid);
+  RUN_TEST(test_tick_counts_missed_deadlines);
+
+  // Scheduler
+  RUN_TEST(test_scheduler_runs_task_only_when_due);
+  RUN_TEST(test_scheduler_wake_pulls_deadline_forward);
+  RUN_TEST(test_scheduler_rejects_overflow);
+  RUN_TEST(test_scheduler_meets_sub_50ms_frame_delay);
+
+  // Transition player
+  RUN_TEST(test_transition_player_holds_each_frame);
+  RUN_TEST(test_transition_player_restart_draws_immediately);
+  RUN_TEST(test_transition_completes_after_all_frame_holds);
+  RUN_TEST(test_transition_keeps_loop_latency_bounded);
+
+  // Framebuffer canvas
+  RUN_TEST(test_framebuffer_uses_ssd1306_page_layout);
+  RUN_TEST(test_framebuffer_black_clears_pixels);
+  RUN_TEST(test_framebuffer_clips_offscreen_primitives);
+  RUN_TEST(test_framebuffer_circle_outline_is_symmetric);
+  RUN_TEST(test_framebuffer_text_renders_and_advances);
+  RUN_TEST(test_framebuffer_idle_frame_is_pixel_exact);
+  RUN_TEST(test_framebuffer_renders_every_emotion_frame);
+
+  // Dirty rect / partial flush
+  RUN_TEST(test_dirty_rect_identical_frames_report_clean);
+  RUN_TEST(test_dirty_rect_bounds_changed_bytes);
+  RUN_TEST(test_flush_skips_identical_frame);
+  RUN_TEST(test_idle_breathing_flushes_small_window);
+
+  // Frame cache
+  RUN_TEST(test_frame_delta_roundtrips_both_directions);
+  RUN_TEST(test_frame_cache_matches_live_render);
+  RUN_TEST(test_frame_cache_drives_pingpong_without_draw_calls);
+  RUN_TEST(test_frame_cache_skips_stale_frame_count);
+
+  // Frame handoff
+  RUN_TEST(test_handoff_take_is_empty_until_published);
+  RUN_TEST(test_handoff_keeps_newest_and_counts_dropped);
+  RUN_TEST(test_handoff_never_writes_the_frame_being_sent);
+
+  // Metrics
+  RUN_TEST(test_metrics_buckets_cover_every_duration);
+  RUN_TEST(test_metrics_summary_min_avg_p99_max);
+  RUN_TEST(test_metrics_counts_frames_over_budget);
+  RUN_TEST(test_metrics_tick_records_draw_and_flush);
+  RUN_TEST(test_metrics_json_lists_sections);
+
+  // Web UI
+  RUN_TEST(test_web_ui_gzip_blob_matches_page);
+  RUN_TEST(test_web_ui_gzip_blob_is_valid_and_small);
+  RUN_TEST(test_sse_event_framing);
+  RUN_TEST(test_sse_event_never_truncates);
+
+  // HTTP protocol
+  RUN_TEST(test_http_parses_get_with_query_args);
+  RUN_TEST(test_http_parses_form_body_fed_byte_by_byte);
+  RUN_TEST(test_http_keepalive_and_pipelining);
+  RUN_TEST(test_http_rejects_oversized_and_malformed_requests);
+  RUN_TEST(test_http_response_head_and_chunk_framing);
+
+  // WebSocket / control protocol / OLED mirror
+  RUN_TEST(test_ws_sha1_and_accept_key);
+  RUN_TEST(test_ws_parses_masked_frames_incrementally);
+  RUN_TEST(test_ws_rejects_unmasked_fragmented_and_oversized_frames);
+  RUN_TEST(test_ws_encodes_server_frames);
+  RUN_TEST(test_control_decodes_commands);
+  RUN_TEST(test_control_encodes_ack_and_state);
+  RUN_TEST(test_control_state_reports_pending_transition_target);
+  RUN_TEST(test_mirror_sends_keyframe_then_changed_pages_only);
+  RUN_TEST(test_mirror_worst_case_fits_and_bad_messages_are_rejected);
+
+  // STA link / boot profile
+  RUN_TEST(test_sta_link_retries_with_backoff);
+  RUN_TEST(test_sta_link_syncs_and_recovers_from_link_loss);
+  RUN_TEST(test_boot_profile_reports_phase_durations);
+
+  // Easing
+  RUN_TEST(test_ease_quad_bit_exact_with_float);
+  RUN_TEST(test_ease_curves_span_start_to_end);
+  RUN_TEST(test_ease_cubic_lut_tracks_formula);
+  RUN_TEST(test_ease_bounce_touches_down_before_settling);
+
+  // Face grammar
+  RUN_TEST(test_face_tracks_key_each_channel_in_frame_order);
+  RUN_TEST(test_face_idle_opens_on_neutral_pose);
+  RUN_TEST(test_face_params_only_for_grammar_emotions);
+  RUN_TEST(test_face_morph_lands_on_both_endpoints);
 
   // Draw functions — legacy
   RUN_TEST(test_draw_idle_draws_eyes);
@@ -1290,6 +2996,11 @@ int main(int argc, char** argv) {
   RUN_TEST(test_night_cycle_inactive_outside_window);
   RUN_TEST(test_night_cycle_produces_mostly_sleepy);
   RUN_TEST(test_night_cycle_requires_time_provider);
+  RUN_TEST(test_night_cycle_reads_time_provider_once_per_tick);
+
+  // Clock service
+  RUN_TEST(test_clock_service_falls_back_to_uptime_hour);
+  RUN_TEST(test_clock_service_caches_between_refreshes);
 
   // Gesture detection
   RUN_TEST(test_classify_gesture_tap);
@@ -1298,5 +3009,48 @@ int main(int argc, char** argv) {
   RUN_TEST(test_classify_gesture_boundary_long_press);
   RUN_TEST(test_classify_gesture_boundary_double_tap);
 
+  // Touch edge queue / decoder
+  RUN_TEST(test_edge_queue_fifo_and_overflow);
+  RUN_TEST(test_touch_decoder_catches_tap_shorter_than_control_tick);
+  RUN_TEST(test_touch_decoder_rejects_bounce);
+  RUN_TEST(test_touch_decoder_double_tap_fires_once);
+  RUN_TEST(test_touch_decoder_long_press_at_threshold);
+
+  // Command queue
+  RUN_TEST(test_command_queue_fifo_and_full);
+  RUN_TEST(test_command_queue_drain_coalesces_emotion_burst);
+  RUN_TEST(test_command_queue_gestures_run_in_order_last_request_wins);
+
+  // BLE protocol / script player
+  RUN_TEST(test_ble_write_legacy_single_byte);
+  RUN_TEST(test_ble_write_batch_posts_records_in_order);
+  RUN_TEST(test_ble_write_rejects_malformed_batch_atomically);
+  RUN_TEST(test_ble_sequence_is_all_or_nothing_when_queue_is_short);
+  RUN_TEST(test_command_queue_script_overrides_earlier_emotion_only);
+  RUN_TEST(test_ble_state_filter_only_reports_changes);
+  RUN_TEST(test_runtime_config_set_field_clamps);
+  RUN_TEST(test_runtime_config_field_names_round_trip);
+  RUN_TEST(test_script_player_steps_through_holds);
+
+  // Tone sequencer
+  RUN_TEST(test_tone_sequencer_plays_authored_durations);
+  RUN_TEST(test_tone_sequencer_late_callback_does_not_stretch_pattern);
+
+  // PRNG
+  RUN_TEST(test_prng_same_seed_replays_stream);
+  RUN_TEST(test_prng_below_is_bounded_and_covers_range);
+  RUN_TEST(test_personality_seed_replays_jitter);
+
+  // Alias table / drift weights
+  RUN_TEST(test_alias_table_matches_weights);
+  RUN_TEST(test_alias_table_all_zero_samples_fallback);
+  RUN_TEST(test_drift_weights_parse_and_format);
+  RUN_TEST(test_personality_drift_follows_config_weights);
+
+  // Markov drift
+  RUN_TEST(test_markov_drift_follows_row_and_hot_swaps);
+  RUN_TEST(test_markov_warm_bias_reweights_row);
+  RUN_TEST(test_markov_bias_parse_fills_unity);
+
   return UNITY_END();
 }
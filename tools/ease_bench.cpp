@@ -0,0 +1,75 @@
+// ease_bench — compares the integer easing against the float ease() it replaced.
+// Checks bit-exactness over the whole supported domain, then times both over
+// the argument ranges the draw functions actually use.
+//
+// Run with: pio run -e easebench -t exec
+// Host CPUs have an FPU, so the float timing here is a best case; on the
+// ESP32-C3 every float op in the reference becomes a soft-float library call.
+
+#include <stdio.h>
+#include <chrono>
+#include "easing.h"
+
+// The float ease() formerly in src/emotion_draws.cpp, kept verbatim as the reference.
+static int easeFloat(int start, int end, int frame, int totalFrames) {
+  if (totalFrames <= 0) return end;
+  float t = (float)frame / (float)totalFrames;
+  if (t > 1.0f) t = 1.0f;
+  t = (t < 0.5f) ? 2 * t * t : 1 - (-2 * t + 2) * (-2 * t + 2) / 2;
+  return start + (int)((end - start) * t);
+}
+
+typedef int (*EaseFn)(int, int, int, int);
+
+// Integer quad ease behind a function pointer, like the float reference.
+static int easeInt(int start, int end, int frame, int totalFrames) {
+  return easeInOutQuad(start, end, frame, totalFrames);
+}
+
+// Cubic LUT ease, for comparison with the exact quad path.
+static int easeCubic(int start, int end, int frame, int totalFrames) {
+  return easeCurve(EASE_IN_OUT_CUBIC, start, end, frame, totalFrames);
+}
+
+// Returns ns per call over the draw-function domain (deltas up to 24px, up to 20 frames).
+static double timeEase(EaseFn fn, int rounds) {
+  volatile int sink = 0;
+  long calls = 0;
+  auto t0 = std::chrono::steady_clock::now();
+  for (int r = 0; r < rounds; r++) {
+    for (int total = 1; total <= 20; total++) {
+      for (int frame = 0; frame <= total; frame++) {
+        for (int d = -24; d <= 24; d++) {
+          sink = sink + fn(28, 28 + d, frame, total);
+          calls++;
+        }
+      }
+    }
+  }
+  auto t1 = std::chrono::steady_clock::now();
+  (void)sink;
+  return std::chrono::duration<double, std::nano>(t1 - t0).count() / calls;
+}
+
+// Verifies the integer ease against the float one, then prints timings; non-zero exit on mismatch.
+int main() {
+  long checked = 0, mismatched = 0;
+  for (int total = 1; total <= 255; total++) {
+    for (int frame = -2; frame <= total + 2; frame++) {
+      for (int d = -71; d <= 71; d++) {
+        checked++;
+        if (easeFloat(0, d, frame, total) != easeInOutQuad(0, d, frame, total)) mismatched++;
+      }
+    }
+  }
+  printf("[EASE] bit-exact check: %ld inputs, %ld mismatches\n", checked, mismatched);
+
+  const int rounds = 2000;
+  double f = timeEase(easeFloat, rounds);
+  double i = timeEase(easeInt, rounds);
+  double c = timeEase(easeCubic, rounds);
+  printf("[EASE] float quad  %6.2f ns/call\n", f);
+  printf("[EASE] int quad    %6.2f ns/call (%.2fx)\n", i, f / i);
+  printf("[EASE] Q8.8 cubic  %6.2f ns/call (%.2fx)\n", c, f / c);
+  return mismatched ? 1 : 0;
+}
@@ -0,0 +1,133 @@
+// framegen — bakes every registered emotion into include/frame_cache_data.h.
+// Renders each DrawFrameFn for every frame index through FrameBufferCanvas
+// (the same Adafruit_GFX algorithms the OLED uses), encodes the frames as
+// XOR-delta/RLE streams and writes them out as PROGMEM arrays, with a report
+// of the flash used per emotion.
+//
+// Run with: pio run -e framegen -t exec
+// (or pass an output path: framegen path/to/frame_cache_data.h)
+
+#include <stdio.h>
+#include <string.h>
+#include "emotion_registry.h"
+#include "emotion_catalog.h"
+#include "framebuffer_canvas.h"
+#include "frame_codec.h"
+
+static const size_t FRAME_BYTES = FrameBufferCanvas::BUFFER_SIZE;
+static const size_t MAX_BLOB = 512 * 1024;
+static const int MAX_FRAMES = EmotionRegistry::MAX_EMOTIONS * 256;
+
+static uint8_t blob[MAX_BLOB];
+static uint32_t offsets[MAX_FRAMES + 1];
+
+struct BakedEmotion {
+  const EmotionDef* def;
+  int firstFrame;
+  size_t bytes;
+};
+
+// Renders one frame of an emotion into a fresh canvas.
+static void renderFrame(const EmotionDef* def, int frame, FrameBufferCanvas& canvas) {
+  canvas.clear();
+  def->drawFrame(canvas, frame, nullptr);
+}
+
+// Writes a byte array as a C initializer, 16 values per line.
+static void writeBytes(FILE* f, const uint8_t* data, size_t len) {
+  for (size_t i = 0; i < len; i++) {
+    fprintf(f, "%s0x%02X,", (i % 16 == 0) ? "\n  " : " ", data[i]);
+  }
+  fprintf(f, "\n");
+}
+
+// Bakes all emotions and writes the header; returns non-zero on failure.
+int main(int argc, char** argv) {
+  const char* outPath = (argc > 1) ? argv[1] : "include/frame_cache_data.h";
+  registerEmotions();
+
+  static FrameBufferCanvas canvas;
+  static uint8_t prev[FRAME_BYTES];
+  BakedEmotion baked[EmotionRegistry::MAX_EMOTIONS];
+  int bakedCount = 0;
+  int frameTotal = 0;
+  size_t used = 0;
+
+  for (int id = 0; id < EmotionRegistry::MAX_EMOTIONS; id++) {
+    const EmotionDef* def = emotionRegistry.get((EmotionState)id);
+    if (!def || !def->drawFrame) continue;
+    if (def->frameCount < 1 || def->frameCount > 255 ||
+        frameTotal + def->frameCount > MAX_FRAMES) {
+      fprintf(stderr, "framegen: %s has %d frames — skipped\n", def->name, def->frameCount);
+      continue;
+    }
+
+    BakedEmotion& b = baked[bakedCount++];
+    b.def = def;
+    b.firstFrame = frameTotal;
+    size_t startBytes = used;
+
+    for (int frame = 0; frame < def->frameCount; frame++) {
+      renderFrame(def, frame, canvas);
+      offsets[frameTotal++] = (uint32_t)used;
+      size_t n = 0;
+      if (!encodeFrameDelta(canvas.getBuffer(), frame ? prev : nullptr,
+                            FRAME_BYTES, blob + used, MAX_BLOB - used, n)) {
+        fprintf(stderr, "framegen: out of space at %s frame %d\n", def->name, frame);
+        return 1;
+      }
+      used += n;
+      memcpy(prev, canvas.getBuffer(), FRAME_BYTES);
+    }
+    b.bytes = used - startBytes;
+  }
+  offsets[frameTotal] = (uint32_t)used;
+
+  FILE* f = fopen(outPath, "w");
+  if (!f) {
+    fprintf(stderr, "framegen: cannot write %s\n", outPath);
+    return 1;
+  }
+
+  fprintf(f, "// frame_cache_data.h — GENERATED by tools/framegen.cpp. Do not edit by hand.\n");
+  fprintf(f, "// Regenerate after changing any DrawFrameFn or frame count:\n");
+  fprintf(f, "//   pio run -e framegen -t exec\n");
+  fprintf(f, "//\n");
+  fprintf(f, "// Flash used per emotion (raw = frames x %u B):\n", (unsigned)FRAME_BYTES);
+  printf("[FRAMEGEN] %-10s %6s %8s %8s\n", "emotion", "frames", "bytes", "raw %");
+  for (int i = 0; i < bakedCount; i++) {
+    const BakedEmotion& b = baked[i];
+    double pct = 100.0 * b.bytes / ((double)b.def->frameCount * FRAME_BYTES);
+    fprintf(f, "//   %-10s %3d frames %6u B  (%4.1f%% of raw)\n", b.def->name,
+            b.def->frameCount, (unsigned)b.bytes, pct);
+    printf("[FRAMEGEN] %-10s %6d %8u %7.1f%%\n", b.def->name, b.def->frameCount,
+           (unsigned)b.bytes, pct);
+  }
+  size_t indexBytes = (frameTotal + 1) * sizeof(uint32_t) + bakedCount * 4;
+  fprintf(f, "//   data %u B + index %u B = %u B for %d frames\n", (unsigned)used,
+          (unsigned)indexBytes, (unsigned)(used + indexBytes), frameTotal);
+  printf("[FRAMEGEN] total: data %u B + index %u B, %d frames -> %s\n",
+         (unsigned)used, (unsigned)indexBytes, frameTotal, outPath);
+
+  fprintf(f, "\n#ifndef FRAME_CACHE_DATA_H\n#define FRAME_CACHE_DATA_H\n\n");
+  fprintf(f, "#include \"frame_cache.h\"\n\n");
+  fprintf(f, "static const uint8_t FRAME_CACHE_DATA[] PROGMEM = {");
+  writeBytes(f, blob, used);
+  fprintf(f, "};\n\n");
+
+  fprintf(f, "static const uint32_t FRAME_CACHE_OFFSETS[] PROGMEM = {");
+  for (int i = 0; i <= frameTotal; i++) {
+    fprintf(f, "%s%u,", (i % 12 == 0) ? "\n  " : " ", (unsigned)offsets[i]);
+  }
+  fprintf(f, "\n};\n\n");
+
+  fprintf(f, "static const int FRAME_CACHE_ENTRY_COUNT = %d;\n", bakedCount);
+  fprintf(f, "static const FrameCacheEntry FRAME_CACHE_ENTRIES[] PROGMEM = {\n");
+  for (int i = 0; i < bakedCount; i++) {
+    fprintf(f, "  {%2d, %3d, %4d},  // %s\n", (int)baked[i].def->id,
+            baked[i].def->frameCount, baked[i].firstFrame, baked[i].def->name);
+  }
+  fprintf(f, "};\n\n#endif // FRAME_CACHE_DATA_H\n");
+  fclose(f);
+  return 0;
+}
@@ -0,0 +1,80 @@
+#!/usr/bin/env python3
+"""Bakes include/web_ui.h into include/web_ui_gz.h — a gzip'd PROGMEM blob.
+
+handleRoot() streams the blob straight from flash with Content-Encoding: gzip
+and answers repeat visits with 304 via the strong ETag written here.
+
+Runs automatically before every firmware build (extra_scripts in platformio.ini)
+and only rewrites the header when the page changed. Standalone:
+    python3 tools/gzip_web_ui.py
+"""
+
+import gzip
+import os
+
+SRC = os.path.join("include", "web_ui.h")
+OUT = os.path.join("include", "web_ui_gz.h")
+OPEN, CLOSE = 'R"rawhtml(', ')rawhtml"'
+
+
+def fnv1a32(data):
+    """FNV-1a, 32-bit — same function the native test uses to detect a stale blob."""
+    h = 0x811C9DC5
+    for b in data:
+        h = ((h ^ b) * 0x01000193) & 0xFFFFFFFF
+    return h
+
+
+def render(html):
+    # mtime=0 and a fixed OS byte keep the output (and so the ETag) identical across rebuilds
+    gz = bytearray(gzip.compress(html, compresslevel=9, mtime=0))
+    gz[9] = 0xFF
+    gz = bytes(gz)
+    rows = []
+    for i in range(0, len(gz), 16):
+        rows.append("  " + ", ".join("0x%02x" % b for b in gz[i:i + 16]) + ",")
+    return "\n".join([
+        "// GENERATED by tools/gzip_web_ui.py from include/web_ui.h — do not edit.",
+        "// %d B of HTML -> %d B gzip (%d%%)." % (len(html), len(gz), 100 * len(gz) // len(html)),
+        "",
+        "#ifndef WEB_UI_GZ_H",
+        "#define WEB_UI_GZ_H",
+        "",
+        "#include <stdint.h>",
+        "#include <stddef.h>",
+        "#include <pgmspace.h>",
+        "",
+        "#define WEB_UI_GZ_SOURCE_HASH 0x%08xu  // FNV-1a of WEB_UI_HTML this blob was built from" % fnv1a32(html),
+        "#define WEB_UI_GZ_ETAG \"\\\"%08x\\\"\"     // strong ETag: FNV-1a of the gzip bytes" % fnv1a32(gz),
+        "",
+        "const size_t WEB_UI_GZ_LEN = %d;" % len(gz),
+        "const uint8_t WEB_UI_GZ[] PROGMEM = {",
+        *rows,
+        "};",
+        "",
+        "#endif // WEB_UI_GZ_H",
+        "",
+    ])
+
+
+def main(root="."):
+    with open(os.path.join(root, SRC), encoding="utf-8") as f:
+        text = f.read()
+    html = text.split(OPEN, 1)[1].split(CLOSE, 1)[0].encode("utf-8")
+    out = render(html)
+    path = os.path.join(root, OUT)
+    if os.path.exists(path):
+        with open(path, encoding="utf-8") as f:
+            if f.read() == out:
+                return
+    with open(path, "w", encoding="utf-8") as f:
+        f.write(out)
+    print("[gzip_web_ui] wrote %s" % OUT)
+
+
+try:
+    Import("env")  # noqa: F821 — defined when PlatformIO runs this as an extra script
+    main(env["PROJECT_DIR"])  # noqa: F821
+except NameError:
+    if __name__ == "__main__":
+        main()
@@ -0,0 +1,223 @@
+// personality_sim — runs Personality + EmotionManager through simulated days in seconds.
+// Steps a virtual millis() clock at the control tick, feeds scripted touches
+// through the same onTouch() path as the firmware, and reports time spent per
+// emotion, emotion changes per hour of day and time spent per attention stage —
+// so RuntimeConfig can be tuned for a week-long deployment without waiting a week.
+//
+// Run with: pio run -e personasim -t exec
+// or directly: .pio/build/personasim/program [options]
+//   --days N            simulated days (default 7)
+//   --start-hour H      wall-clock hour at boot (default 8)
+//   --tick MS           simulation step (default CONTROL_TICK_MS)
+//   --seed N            random seed (default 1)
+//   --touch SCHEDULE    comma-separated START-END/EVERY windows: a tap every EVERY
+//                       minutes between hours START and END, e.g. 8-9/10,18-22/30;
+//                       "none" for no touches (default 8-9/10,12-13/20,18-22/30)
+//   --cfg NAME=VALUE    override a RuntimeConfig field (same names as /api/config),
+//                       including drift tables, e.g. driftEvening=25,0,30,0,10
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "emotion.h"
+#include "emotion_registry.h"
+#include "emotion_catalog.h"
+#include "personality.h"
+#include "runtime_config.h"
+#include "input.h"
+
+static const unsigned long MS_PER_MIN  = 60UL * 1000UL;
+static const unsigned long MS_PER_HOUR = 60UL * MS_PER_MIN;
+static const int MAX_WINDOWS = 16;
+static const int STAGES = 6;
+
+struct TouchWindow {
+  int startHour;
+  int endHour;
+  int everyMin;
+};
+
+struct SimOptions {
+  int days;
+  int startHour;
+  unsigned long tickMs;
+  unsigned seed;
+  TouchWindow windows[MAX_WINDOWS];
+  int windowCount;
+};
+
+struct SimReport {
+  unsigned long long emotionMs[EmotionRegistry::MAX_EMOTIONS];
+  unsigned long long stageMs[STAGES];
+  unsigned long changesByHour[24];
+  unsigned long changes;
+  unsigned long touches;
+};
+
+static const char* const STAGE_NAMES[STAGES] = {"none", "NEEDY", "BORED", "SAD", "GRUMPY", "ANGRY"};
+
+static int simStartHour = 0;
+static unsigned long simNow = 0;
+
+// Wall-clock hour for the personality's night cycle, derived from the virtual clock.
+static int simHour() {
+  return (int)((simStartHour + simNow / MS_PER_HOUR) % 24);
+}
+
+// Parses "8-9/10,18-22/30" into touch windows; false on a malformed entry.
+static bool parseSchedule(const char* spec, SimOptions& o) {
+  o.windowCount = 0;
+  if (strcmp(spec, "none") == 0) return true;
+  const char* p = spec;
+  while (*p) {
+    TouchWindow w;
+    int used = 0;
+    if (sscanf(p, "%d-%d/%d%n", &w.startHour, &w.endHour, &w.everyMin, &used) != 3) return false;
+    if (w.startHour < 0 || w.startHour > 23 || w.endHour < 0 || w.endHour > 24 || w.everyMin <= 0) return false;
+    if (o.windowCount >= MAX_WINDOWS) return false;
+    o.windows[o.windowCount++] = w;
+    p += used;
+    if (*p == ',') p++;
+    else if (*p) return false;
+  }
+  return true;
+}
+
+// Applies one --cfg NAME=VALUE through runtimeConfigSetField() or, for a drift table,
+// runtimeConfigParseWeights(); false for an unknown name or a bad value.
+static bool applyConfig(const char* arg) {
+  const char* eq = strchr(arg, '=');
+  if (!eq) return false;
+  for (int t = 0; t < DRIFT_TABLE_COUNT; t++) {
+    const char* name = runtimeConfigDriftTableName((uint8_t)t);
+    if (strlen(name) == (size_t)(eq - arg) && strncmp(arg, name, eq - arg) == 0) {
+      return runtimeConfigParseWeights(eq + 1, runtimeConfig.driftWeights[t]);
+    }
+  }
+  int field = runtimeConfigFieldByName(arg, (size_t)(eq - arg));
+  return field >= 0 && runtimeConfigSetField((uint8_t)field, (uint32_t)strtoul(eq + 1, nullptr, 10));
+}
+
+// True when a scheduled tap lands in (prev, now] at the current hour of day.
+static bool touchDue(const SimOptions& o, unsigned long prev, unsigned long now) {
+  int hour = simHour();
+  for (int i = 0; i < o.windowCount; i++) {
+    const TouchWindow& w = o.windows[i];
+    if (hour < w.startHour || hour >= w.endHour) continue;
+    unsigned long every = (unsigned long)w.everyMin * MS_PER_MIN;
+    if (now / every != prev / every) return true;
+  }
+  return false;
+}
+
+// Mirrors applyGesture() in main.cpp for a TAP: forgiveness holds the sulk, recovery shows SHY.
+static int respondToTap(unsigned long now) {
+  bool wasNeglected = personality.onTouch(now, emotionManager.getCurrentEmotion());
+  if (personality.isForgiving()) return -1;
+  return wasNeglected ? EMOTION_SHY : EMOTION_HAPPY;
+}
+
+// Sets the target and completes the transition at once — blink transitions are sub-second.
+static void changeEmotion(EmotionState e, SimReport& r) {
+  if (e == emotionManager.getCurrentEmotion()) return;
+  emotionManager.setTargetEmotion(e);
+  if (emotionManager.isTransitionActive()) emotionManager.completeTransition();
+  r.changes++;
+  r.changesByHour[simHour()]++;
+}
+
+// Runs the control loop for o.days of virtual time.
+static void simulate(const SimOptions& o, SimReport& r) {
+  memset(&r, 0, sizeof(r));
+  simStartHour = o.startHour;
+  simNow = 0;
+  stubSetMillis(0);
+  emotionManager.init(0);
+  personality.seed(o.seed);
+  personality.init(0);
+  personality.setTimeProvider(simHour);
+
+  unsigned long end = (unsigned long)o.days * 24UL * MS_PER_HOUR;
+  unsigned long prev = 0;
+  for (simNow = 0; simNow < end; prev = simNow, simNow += o.tickMs) {
+    stubSetMillis(simNow);
+    if (simNow > 0 && touchDue(o, prev, simNow)) {
+      r.touches++;
+      int want = respondToTap(simNow);
+      if (want >= 0) changeEmotion((EmotionState)want, r);
+    }
+    Personality::Decision d = personality.update(simNow, emotionManager.getCurrentEmotion());
+    if (d.shouldChange) changeEmotion(d.emotion, r);
+
+    int current = emotionManager.getCurrentEmotion();
+    if (current >= 0 && current < EmotionRegistry::MAX_EMOTIONS) r.emotionMs[current] += o.tickMs;
+    int stage = personality.getAttentionStage();
+    if (stage >= 0 && stage < STAGES) r.stageMs[stage] += o.tickMs;
+  }
+}
+
+// Prints one "name  hours  percent" row.
+static void printShare(const char* name, unsigned long long ms, unsigned long long total) {
+  printf("  %-10s %9.1f h  %5.1f%%\n", name, ms / (double)MS_PER_HOUR,
+         total ? 100.0 * ms / total : 0.0);
+}
+
+// Emotion time, attention-stage time and per-hour change rates.
+static void printReport(const SimOptions& o, const SimReport& r) {
+  unsigned long long total = (unsigned long long)o.days * 24ULL * MS_PER_HOUR;
+  printf("Simulated %d day(s) from %02d:00, tick %lums, seed %u — %lu touches, %lu emotion changes\n\n",
+         o.days, o.startHour, o.tickMs, o.seed, r.touches, r.changes);
+
+  printf("Time per emotion:\n");
+  for (int id = 0; id < EmotionRegistry::MAX_EMOTIONS; id++) {
+    if (r.emotionMs[id]) printShare(emotionRegistry.getName((EmotionState)id), r.emotionMs[id], total);
+  }
+
+  printf("\nTime per attention stage:\n");
+  for (int s = 0; s < STAGES; s++) printShare(STAGE_NAMES[s], r.stageMs[s], total);
+
+  printf("\nEmotion changes per hour of day (average over %d day(s)):\n", o.days);
+  for (int h = 0; h < 24; h++) {
+    double perDay = r.changesByHour[h] / (double)o.days;
+    printf("  %02d:00 %6.1f  ", h, perDay);
+    for (int i = 0; i < (int)(perDay + 0.5) && i < 60; i++) putchar('#');
+    putchar('\n');
+  }
+  printf("  overall %.1f changes/hour\n", r.changes / (total / (double)MS_PER_HOUR));
+}
+
+// Parses options, runs the simulation and prints the report; non-zero exit on bad arguments.
+int main(int argc, char** argv) {
+  SimOptions o;
+  o.days = 7;
+  o.startHour = 8;
+  o.tickMs = CONTROL_TICK_MS;
+  o.seed = 1;
+  parseSchedule("8-9/10,12-13/20,18-22/30", o);
+
+  for (int i = 1; i < argc; i++) {
+    const char* a = argv[i];
+    const char* v = (i + 1 < argc) ? argv[i + 1] : nullptr;
+    bool ok = v != nullptr;
+    if      (ok && strcmp(a, "--days") == 0)       o.days = atoi(v);
+    else if (ok && strcmp(a, "--start-hour") == 0) o.startHour = atoi(v) % 24;
+    else if (ok && strcmp(a, "--tick") == 0)       o.tickMs = strtoul(v, nullptr, 10);
+    else if (ok && strcmp(a, "--seed") == 0)       o.seed = (unsigned)strtoul(v, nullptr, 10);
+    else if (ok && strcmp(a, "--touch") == 0)      ok = parseSchedule(v, o);
+    else if (ok && strcmp(a, "--cfg") == 0)        ok = applyConfig(v);
+    else ok = false;
+    if (!ok || o.days <= 0 || o.tickMs == 0) {
+      fprintf(stderr, "personality_sim: bad argument '%s'%s%s\n", a, v ? " " : "", v ? v : "");
+      return 1;
+    }
+    i++;
+  }
+
+  registerEmotions();
+  stubSetSerialMuted(true);  // Personality logs every drift; hours of it would drown the report
+  SimReport report;
+  simulate(o, report);
+  stubSetSerialMuted(false);
+  printReport(o, report);
+  return 0;
+}
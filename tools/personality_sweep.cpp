@@ -0,0 +1,310 @@
+// personality_sweep — Monte Carlo sweep of RuntimeConfig values over simulated robots.
+// Every point of the grid (cartesian product of the --grid axes) is run on
+// --robots seeded robots, each a Personality with its own random touch history,
+// spread across all host cores. One CSV row per grid point summarises emotion
+// churn and neglect exposure, so tuning starts from data instead of a device on
+// a desk for a week.
+//
+// Robots are stepped in batches of BATCH_SIZE laid out structure-of-arrays: the
+// Personality objects sit in one contiguous array and the simulation's own
+// per-robot state and counters in parallel arrays, so a worker walks each array
+// linearly on every tick. Batches are handed to threads from an atomic counter;
+// every robot seeds its own Personality and touch stream from (seed, point, robot),
+// so results do not depend on the thread count, scheduling or batch size.
+//
+// Run with: pio run -e personasweep -t exec
+// or directly: .pio/build/personasweep/program [options]
+//   --grid NAME=V1,V2,...  sweep a RuntimeConfig field (repeatable; /api/config names)
+//   --robots N             robots per grid point (default 1000)
+//   --days N               simulated days per robot (default 1)
+//   --tick MS              simulation step (default 1000)
+//   --touch-every MIN      mean minutes between touches while awake (default 30)
+//   --awake H1-H2          hours the owner is around to touch (default 8-22)
+//   --start-hour H         wall-clock hour at boot (default 8)
+//   --threads N            worker threads (default: all cores)
+//   --seed N               base seed (default 1)
+//   --out FILE             CSV path (default stdout)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <algorithm>
+#include <memory>
+#include "emotion_registry.h"
+#include "emotion_catalog.h"
+#include "personality.h"
+#include "prng.h"
+#include "runtime_config.h"
+
+static const unsigned long MS_PER_MIN  = 60UL * 1000UL;
+static const unsigned long MS_PER_HOUR = 60UL * MS_PER_MIN;
+static const int BATCH_SIZE = 64;
+static const int MAX_AXES = 8;
+static const int MAX_VALUES = 16;
+
+struct GridAxis {
+  int field;
+  int count;
+  uint32_t values[MAX_VALUES];
+};
+
+struct SweepOptions {
+  GridAxis axes[MAX_AXES];
+  int axisCount;
+  int robots;
+  int days;
+  unsigned long tickMs;
+  unsigned long touchEveryMs;
+  int awakeFrom;
+  int awakeTo;
+  int startHour;
+  int threads;
+  unsigned seed;
+  const char* outPath;
+};
+
+// Per-robot results for one grid point, indexed by robot.
+struct PointResults {
+  std::vector<float> churnPerHour;
+  std::vector<float> neglectShare;      // attention stage ≥ 1 (NEEDY onwards)
+  std::vector<float> deepNeglectShare;  // attention stage ≥ 4 (GRUMPY / ANGRY)
+  std::vector<float> negativeShare;     // showing a CLUSTER_NEGATIVE emotion
+};
+
+// One batch of robots, structure-of-arrays.
+struct RobotBatch {
+  int count;
+  Personality personality[BATCH_SIZE];
+  Prng touchRng[BATCH_SIZE];
+  EmotionState emotion[BATCH_SIZE];
+  unsigned long nextTouchMs[BATCH_SIZE];
+  uint32_t changes[BATCH_SIZE];
+  uint32_t neglectTicks[BATCH_SIZE];
+  uint32_t deepTicks[BATCH_SIZE];
+  uint32_t negativeTicks[BATCH_SIZE];
+};
+
+// Each worker steps one batch at a time, all robots at the same virtual time.
+static thread_local unsigned long tlNow = 0;
+static int sweepStartHour = 0;
+
+// Wall-clock hour for the night cycle, from the calling worker's virtual clock.
+static int sweepHour() {
+  return (int)((sweepStartHour + tlNow / MS_PER_HOUR) % 24);
+}
+
+// Exponentially distributed gap with the given mean, from the robot's touch stream.
+static unsigned long nextGap(Prng& rng, unsigned long meanMs) {
+  double u = (double)rng.range(1, 1000001) / 1000001.0;
+  return (unsigned long)(-log(u) * (double)meanMs) + 1;
+}
+
+// Mirrors applyGesture() in main.cpp for a TAP: forgiveness holds the sulk, recovery shows SHY.
+static int respondToTap(Personality& p, EmotionState current, unsigned long now) {
+  bool wasNeglected = p.onTouch(now, current);
+  if (p.isForgiving()) return -1;
+  return wasNeglected ? EMOTION_SHY : EMOTION_HAPPY;
+}
+
+// Simulates robots [first, first + count) of one grid point into out.
+static void runBatch(const SweepOptions& o, RobotBatch& b, int point, int first, int count,
+                     PointResults& out) {
+  b.count = count;
+  tlNow = 0;
+  for (int r = 0; r < count; r++) {
+    uint32_t seed = o.seed * 2654435761u ^ (uint32_t)point * 40503u ^ (uint32_t)(first + r) * 2246822519u;
+    b.personality[r].seed(seed);
+    b.touchRng[r].setSeed(~seed);
+    b.personality[r].init(0);
+    b.personality[r].setTimeProvider(sweepHour);
+    b.emotion[r] = EMOTION_IDLE;
+    b.nextTouchMs[r] = nextGap(b.touchRng[r], o.touchEveryMs);
+    b.changes[r] = b.neglectTicks[r] = b.deepTicks[r] = b.negativeTicks[r] = 0;
+  }
+
+  unsigned long end = (unsigned long)o.days * 24UL * MS_PER_HOUR;
+  for (unsigned long now = 0; now < end; now += o.tickMs) {
+    tlNow = now;
+    int hour = sweepHour();
+    bool awake = hour >= o.awakeFrom && hour < o.awakeTo;
+
+    for (int r = 0; r < count; r++) {
+      if (now < b.nextTouchMs[r]) continue;
+      b.nextTouchMs[r] = now + nextGap(b.touchRng[r], o.touchEveryMs);
+      if (!awake) continue;
+      int want = respondToTap(b.personality[r], b.emotion[r], now);
+      if (want >= 0 && want != b.emotion[r]) {
+        b.emotion[r] = (EmotionState)want;
+        b.changes[r]++;
+      }
+    }
+    for (int r = 0; r < count; r++) {
+      Personality::Decision d = b.personality[r].update(now, b.emotion[r]);
+      if (d.shouldChange && d.emotion != b.emotion[r]) {
+        b.emotion[r] = d.emotion;
+        b.changes[r]++;
+      }
+    }
+    for (int r = 0; r < count; r++) {
+      int stage = b.personality[r].getAttentionStage();
+      b.neglectTicks[r] += stage >= 1;
+      b.deepTicks[r] += stage >= 4;
+      b.negativeTicks[r] += Personality::clusterOf(b.emotion[r]) == CLUSTER_NEGATIVE;
+    }
+  }
+
+  double ticks = (double)(end / o.tickMs);
+  double hours = end / (double)MS_PER_HOUR;
+  for (int r = 0; r < count; r++) {
+    out.churnPerHour[first + r]     = (float)(b.changes[r] / hours);
+    out.neglectShare[first + r]     = (float)(b.neglectTicks[r] / ticks);
+    out.deepNeglectShare[first + r] = (float)(b.deepTicks[r] / ticks);
+    out.negativeShare[first + r]    = (float)(b.negativeTicks[r] / ticks);
+  }
+}
+
+// Runs every robot of one grid point (runtimeConfig already set) across o.threads workers.
+static void runPoint(const SweepOptions& o, int point, PointResults& out) {
+  out.churnPerHour.assign(o.robots, 0);
+  out.neglectShare.assign(o.robots, 0);
+  out.deepNeglectShare.assign(o.robots, 0);
+  out.negativeShare.assign(o.robots, 0);
+
+  int batches = (o.robots + BATCH_SIZE - 1) / BATCH_SIZE;
+  std::atomic<int> nextBatch(0);
+  auto worker = [&]() {
+    std::unique_ptr<RobotBatch> b(new RobotBatch());
+    for (int i = nextBatch.fetch_add(1); i < batches; i = nextBatch.fetch_add(1)) {
+      int first = i * BATCH_SIZE;
+      int count = std::min(BATCH_SIZE, o.robots - first);
+      runBatch(o, *b, point, first, count, out);
+    }
+  };
+  std::vector<std::thread> pool;
+  for (int t = 1; t < o.threads; t++) pool.emplace_back(worker);
+  worker();
+  for (std::thread& t : pool) t.join();
+}
+
+// Mean of v.
+static double mean(const std::vector<float>& v) {
+  double sum = 0;
+  for (float x : v) sum += x;
+  return v.empty() ? 0 : sum / v.size();
+}
+
+// 95th percentile of v (partially sorts a copy).
+static double p95(std::vector<float> v) {
+  if (v.empty()) return 0;
+  size_t k = (size_t)(0.95 * (v.size() - 1));
+  std::nth_element(v.begin(), v.begin() + k, v.end());
+  return v[k];
+}
+
+// Parses NAME=V1,V2,... into a grid axis; false for an unknown field or malformed list.
+static bool parseAxis(const char* arg, SweepOptions& o) {
+  const char* eq = strchr(arg, '=');
+  if (!eq || o.axisCount >= MAX_AXES) return false;
+  GridAxis& a = o.axes[o.axisCount];
+  a.field = runtimeConfigFieldByName(arg, (size_t)(eq - arg));
+  a.count = 0;
+  if (a.field < 0) return false;
+  const char* p = eq + 1;
+  while (*p) {
+    char* endp;
+    unsigned long v = strtoul(p, &endp, 10);
+    if (endp == p || a.count >= MAX_VALUES) return false;
+    a.values[a.count++] = (uint32_t)v;
+    p = endp;
+    if (*p == ',') p++;
+    else if (*p) return false;
+  }
+  if (a.count == 0) return false;
+  o.axisCount++;
+  return true;
+}
+
+// Parses options; false (after printing what was wrong) on bad input.
+static bool parseArgs(int argc, char** argv, SweepOptions& o) {
+  for (int i = 1; i < argc; i += 2) {
+    const char* a = argv[i];
+    const char* v = (i + 1 < argc) ? argv[i + 1] : nullptr;
+    bool ok = v != nullptr;
+    if      (ok && strcmp(a, "--grid") == 0)        ok = parseAxis(v, o);
+    else if (ok && strcmp(a, "--robots") == 0)      o.robots = atoi(v);
+    else if (ok && strcmp(a, "--days") == 0)        o.days = atoi(v);
+    else if (ok && strcmp(a, "--tick") == 0)        o.tickMs = strtoul(v, nullptr, 10);
+    else if (ok && strcmp(a, "--touch-every") == 0) o.touchEveryMs = strtoul(v, nullptr, 10) * MS_PER_MIN;
+    else if (ok && strcmp(a, "--awake") == 0)       ok = sscanf(v, "%d-%d", &o.awakeFrom, &o.awakeTo) == 2;
+    else if (ok && strcmp(a, "--start-hour") == 0)  o.startHour = atoi(v) % 24;
+    else if (ok && strcmp(a, "--threads") == 0)     o.threads = atoi(v);
+    else if (ok && strcmp(a, "--seed") == 0)        o.seed = (unsigned)strtoul(v, nullptr, 10);
+    else if (ok && strcmp(a, "--out") == 0)         o.outPath = v;
+    else ok = false;
+    if (!ok || o.robots <= 0 || o.days <= 0 || o.tickMs == 0 || o.touchEveryMs == 0 || o.threads <= 0) {
+      fprintf(stderr, "personality_sweep: bad argument '%s'%s%s\n", a, v ? " " : "", v ? v : "");
+      return false;
+    }
+  }
+  return true;
+}
+
+// Walks the grid in row-major order, one CSV row per point.
+int main(int argc, char** argv) {
+  SweepOptions o;
+  memset(&o, 0, sizeof(o));
+  o.robots = 1000;
+  o.days = 1;
+  o.tickMs = 1000;
+  o.touchEveryMs = 30 * MS_PER_MIN;
+  o.awakeFrom = 8;
+  o.awakeTo = 22;
+  o.startHour = 8;
+  o.threads = (int)std::max(1u, std::thread::hardware_concurrency());
+  o.seed = 1;
+  if (!parseArgs(argc, argv, o)) return 1;
+
+  FILE* out = o.outPath ? fopen(o.outPath, "w") : stdout;
+  if (!out) {
+    fprintf(stderr, "personality_sweep: cannot open %s\n", o.outPath);
+    return 1;
+  }
+
+  registerEmotions();
+  stubSetSerialMuted(true);  // Personality logs every drift
+  sweepStartHour = o.startHour;
+  const RuntimeConfig defaults = runtimeConfig;
+
+  int points = 1;
+  for (int a = 0; a < o.axisCount; a++) points *= o.axes[a].count;
+
+  for (int a = 0; a < o.axisCount; a++) fprintf(out, "%s,", runtimeConfigFieldName(o.axes[a].field));
+  fprintf(out, "robots,churn_per_hour_mean,churn_per_hour_p95,neglect_share,deep_neglect_share,negative_share\n");
+
+  PointResults res;
+  for (int point = 0; point < points; point++) {
+    runtimeConfig = defaults;
+    for (int a = o.axisCount - 1, rest = point; a >= 0; a--) {
+      runtimeConfigSetField((uint8_t)o.axes[a].field, o.axes[a].values[rest % o.axes[a].count]);
+      rest /= o.axes[a].count;
+    }
+    runPoint(o, point, res);
+
+    // Values as applied: runtimeConfigSetField() clamps, and the row must say what actually ran
+    for (int a = 0; a < o.axisCount; a++) {
+      fprintf(out, "%u,", (unsigned)runtimeConfigGetField((uint8_t)o.axes[a].field));
+    }
+    fprintf(out, "%d,%.2f,%.2f,%.4f,%.4f,%.4f\n", o.robots,
+            mean(res.churnPerHour), p95(res.churnPerHour),
+            mean(res.neglectShare), mean(res.deepNeglectShare), mean(res.negativeShare));
+    fflush(out);
+    fprintf(stderr, "[sweep] %d/%d points\n", point + 1, points);
+  }
+
+  if (out != stdout) fclose(out);
+  return 0;
+}